@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <benchmark/benchmark.h>
+#include "hft/timing/perf_counters.hpp"
+
+namespace hft {
+namespace bench {
+
+/**
+ * @brief Hardware counters per iteration, reported as benchmark counters
+ *
+ * start() before the timed loop, report() after it. Adds one
+ * per-iteration counter per event the PMU gave us (instructions, cycles,
+ * l1d_misses, llc_misses, branch_misses, dtlb_misses) plus IPC. Where
+ * counters are unavailable (no PMU access, perf_event_paranoid, VMs)
+ * nothing is added and the benchmark runs as before.
+ */
+class PerfCounterRecorder {
+public:
+    void start() noexcept { group_.start(); }
+    void pause() noexcept { group_.pause(); }
+    void resume() noexcept { group_.resume(); }
+
+    void report(benchmark::State& state) noexcept {
+        const PerfCounts counts = group_.stop();
+        if (counts.valid_mask == 0 || state.iterations() == 0) return;
+        for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+            const auto event = static_cast<PerfEvent>(i);
+            if (!counts.has(event)) continue;
+            state.counters[perf_event_name(event)] =
+                benchmark::Counter(static_cast<double>(counts[event]), benchmark::Counter::kAvgIterations);
+        }
+        if (counts.has(PerfEvent::INSTRUCTIONS) && counts.has(PerfEvent::CYCLES) && counts[PerfEvent::CYCLES] != 0) {
+            state.counters["IPC"] = static_cast<double>(counts[PerfEvent::INSTRUCTIONS]) / counts[PerfEvent::CYCLES];
+        }
+        if (counts.multiplexed) state.counters["perf_multiplexed"] = 1;
+    }
+
+    [[nodiscard]] bool available() const noexcept { return group_.available(); }
+
+private:
+    PerfCounterGroup group_;
+};
+
+/**
+ * @brief Fixture base giving each benchmark a PerfCounterRecorder (perf_)
+ *
+ * The counter group is opened in SetUp, on the thread that runs the
+ * benchmark body.
+ */
+class PerfCounterFixture : public benchmark::Fixture {
+public:
+    void SetUp(const ::benchmark::State&) override { perf_ = std::make_unique<PerfCounterRecorder>(); }
+    void TearDown(const ::benchmark::State&) override { perf_.reset(); }
+
+protected:
+    std::unique_ptr<PerfCounterRecorder> perf_;
+};
+
+} // namespace bench
+} // namespace hft
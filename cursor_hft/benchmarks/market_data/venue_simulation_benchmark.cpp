@@ -3,6 +3,7 @@
 #include "hft/market_data/treasury_instruments.hpp"
 #include "hft/timing/hft_timer.hpp"
 #include <memory>
+#include <string>
 #include <vector>
 
 using namespace hft::market_data;
@@ -20,7 +21,7 @@ static void BM_OrderSubmission(benchmark::State& state) {
 
     for (auto _ : state) {
         auto start = hft::HFTTimer::get_cycles();
-        venue.submit_order(order);
+        (void)venue.submit_order(order);
         auto end = hft::HFTTimer::get_cycles();
         
         auto latency = hft::HFTTimer::cycles_to_ns(end - start);
@@ -44,7 +45,7 @@ static void BM_MarketDataProcessing(benchmark::State& state) {
         order.side = (i % 2 == 0) ? OrderSide::Buy : OrderSide::Sell;
         order.limit_price = Price32nd::from_decimal(99.0 + (i % 2 == 0 ? -0.1 : 0.1));
         order.quantity = 10;
-        venue.submit_order(order);
+        (void)venue.submit_order(order);
     }
     
     // Process responses to get to acknowledged state
@@ -84,7 +85,7 @@ static void BM_OrderCancellation(benchmark::State& state) {
     order.side = OrderSide::Buy;
     order.limit_price = Price32nd::from_decimal(99.0);
     order.quantity = 10;
-    venue.submit_order(order);
+    (void)venue.submit_order(order);
     
     // Process acknowledgment
     VenueResponse responses[1];
@@ -92,7 +93,7 @@ static void BM_OrderCancellation(benchmark::State& state) {
     
     for (auto _ : state) {
         auto start = hft::HFTTimer::get_cycles();
-        venue.cancel_order(order.order_id);
+        (void)venue.cancel_order(order.order_id);
         auto end = hft::HFTTimer::get_cycles();
         
         auto latency = hft::HFTTimer::cycles_to_ns(end - start);
@@ -101,6 +102,52 @@ static void BM_OrderCancellation(benchmark::State& state) {
 }
 BENCHMARK(BM_OrderCancellation)->UseRealTime()->MinTime(5.0);
 
+// Cancel/replace against a deep resting book: indexed lookup should not grow with depth
+static void BM_CancelReplaceDeepBook(benchmark::State& state) {
+    const uint64_t resting = static_cast<uint64_t>(state.range(0));
+    auto venue = std::make_unique<PrimaryDealerVenue>();
+    VenueResponse responses[256];
+
+    TreasuryTick tick{};
+    tick.instrument_type = TreasuryType::Note_10Y;
+    tick.bid_price = Price32nd::from_decimal(99.0);
+    tick.ask_price = Price32nd::from_decimal(99.5);
+    tick.bid_size = 100;
+    tick.ask_size = 100;
+    venue->process_market_update(tick);
+
+    // Bids spread over 32 levels below the touch
+    TreasuryOrder order{};
+    order.instrument_type = TreasuryType::Note_10Y;
+    order.order_type = OrderType::Limit;
+    order.side = OrderSide::Buy;
+    order.quantity = 10;
+    for (uint64_t i = 0; i < resting; ++i) {
+        order.order_id = i + 1;
+        order.limit_price = Price32nd::from_decimal(99.0 - static_cast<double>(i % 32) / 32.0);
+        (void)venue->submit_order(order);
+        while (venue->get_venue_responses(responses, 256) > 0) {}
+    }
+
+    uint64_t next_cancel = 1;
+    uint64_t next_order_id = resting + 1;
+    for (auto _ : state) {
+        auto start = hft::HFTTimer::get_cycles();
+        (void)venue->cancel_order(next_cancel);
+        order.order_id = next_order_id;
+        order.limit_price = Price32nd::from_decimal(99.0 - static_cast<double>(next_cancel % 32) / 32.0);
+        (void)venue->submit_order(order);
+        auto end = hft::HFTTimer::get_cycles();
+
+        state.SetIterationTime(static_cast<double>(hft::HFTTimer::cycles_to_ns(end - start)) / 1e9);
+        while (venue->get_venue_responses(responses, 256) > 0) {}
+        next_cancel = next_cancel + 1 == next_order_id ? next_cancel : next_cancel + 1;
+        ++next_order_id;
+    }
+    state.counters["RestingOrders"] = static_cast<double>(venue->active_orders());
+}
+BENCHMARK(BM_CancelReplaceDeepBook)->Arg(100)->Arg(1000)->Arg(2000)->UseManualTime();
+
 // Benchmark order router throughput
 static void BM_OrderRouterThroughput(benchmark::State& state) {
     TreasuryOrderRouter router;
@@ -131,7 +178,7 @@ static void BM_OrderRouterThroughput(benchmark::State& state) {
         strategy.process_market_tick(tick);
         
         // Process venue responses
-        router.process_venue_responses();
+        (void)router.process_venue_responses();
         
         VenueResponse fills[256];
         size_t fill_count = router.get_fills(fills, 256);
@@ -148,4 +195,60 @@ static void BM_OrderRouterThroughput(benchmark::State& state) {
 }
 BENCHMARK(BM_OrderRouterThroughput)->UseRealTime()->MinTime(5.0);
 
+// Simulated multi-venue session on VenueSimulation: simulated seconds per wall second
+static void BM_SimulatedMultiVenueSession(benchmark::State& state) {
+    constexpr size_t VENUES = 4;
+    const uint64_t ticks = static_cast<uint64_t>(state.range(0));
+    constexpr uint64_t TICK_INTERVAL_NS = 1'000'000;  // 1ms between ticks
+    uint64_t responses = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::unique_ptr<PrimaryDealerVenue>> venues;
+        auto sim = std::make_unique<VenueSimulation>(34'200'000'000'000);  // 09:30
+        for (size_t v = 0; v < VENUES; ++v) {
+            venues.push_back(std::make_unique<PrimaryDealerVenue>("Venue" + std::to_string(v)));
+            sim->add_venue(*venues.back());
+        }
+        state.ResumeTiming();
+
+        TreasuryTick tick{};
+        tick.instrument_type = TreasuryType::Note_10Y;
+        tick.bid_size = 100;
+        tick.ask_size = 100;
+        uint64_t next_order_id = 1;
+        responses = 0;
+        // Ticks are fed in slices so the pending-tick queue stays bounded
+        for (uint64_t i = 0; i < ticks; ++i) {
+            tick.timestamp_ns = 34'200'000'000'000 + i * TICK_INTERVAL_NS;
+            tick.bid_price = Price32nd::from_decimal(99.0 + static_cast<double>(i % 16) / 32.0);
+            tick.ask_price = Price32nd::from_decimal(99.0 + static_cast<double>(i % 16 + 1) / 32.0);
+            (void)sim->schedule_market_data(tick);
+            if ((i + 1) % 4096 != 0 && i + 1 != ticks) continue;
+            responses += sim->run_until(
+                i + 1 == ticks ? VenueSimulation::NEVER : tick.timestamp_ns,
+                [&](const TreasuryTick& t) {
+                    TreasuryOrder order{};
+                    order.order_id = next_order_id++;
+                    order.instrument_type = t.instrument_type;
+                    order.order_type = OrderType::Limit;
+                    order.side = (order.order_id & 1) ? OrderSide::Buy : OrderSide::Sell;
+                    order.limit_price = order.side == OrderSide::Buy ? t.bid_price : t.ask_price;
+                    order.quantity = 10;
+                    (void)sim->venue(order.order_id % VENUES).submit_order(order);
+                },
+                [&](size_t v, const VenueResponse& r) {
+                    if (r.new_status == OrderStatus::PartiallyFilled) (void)sim->venue(v).cancel_order(r.order_id);
+                });
+        }
+    }
+
+    const double simulated_s = static_cast<double>(ticks * TICK_INTERVAL_NS) / 1e9;
+    state.counters["SimSecondsPerSecond"] = benchmark::Counter(
+        simulated_s * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    state.counters["Events"] = static_cast<double>(responses);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ticks));
+}
+BENCHMARK(BM_SimulatedMultiVenueSession)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN(); 
\ No newline at end of file
@@ -6,11 +6,17 @@
 
 #include <benchmark/benchmark.h>
 #include <hft/memory/object_pool.hpp>
+#include <hft/memory/concurrent_object_pool.hpp>
+#include <hft/memory/huge_page_pool.hpp>
 #include <hft/timing/hft_timer.hpp>
 #include <cstdint>
 #include <vector>
+#include <algorithm>
+#include <array>
 #include <random>
 #include <cstring>
+#include <memory>
+#include <mutex>
 
 using namespace hft;
 
@@ -96,4 +102,90 @@ static void BM_ObjectPool_ValidateMemory(benchmark::State& state) {
 }
 BENCHMARK(BM_ObjectPool_ValidateMemory)->MinTime(0.1);
 
+// Shared pool scaling: each thread acquires/releases through its own magazine
+using SharedPool = ConcurrentObjectPool<SmallObject, POOL_SIZE, 32, 16>;
+
+static SharedPool& shared_pool() {
+    static auto pool = std::make_unique<SharedPool>();
+    return *pool;
+}
+
+static void BM_ConcurrentPool_AcquireRelease_Cached(benchmark::State& state) {
+    auto* cache = shared_pool().attach();
+    std::array<SmallObject*, 8> held{};
+    for (auto _ : state) {
+        for (auto& obj : held) obj = cache->acquire();
+        benchmark::DoNotOptimize(held);
+        for (auto* obj : held) cache->release(obj);
+    }
+    shared_pool().detach(cache);
+    state.SetItemsProcessed(state.iterations() * held.size());
+}
+BENCHMARK(BM_ConcurrentPool_AcquireRelease_Cached)->ThreadRange(1, 8)->UseRealTime()->MinTime(0.1);
+
+// Same workload on the global lock-free list only (one CAS per operation)
+static void BM_ConcurrentPool_AcquireRelease_Global(benchmark::State& state) {
+    std::array<SmallObject*, 8> held{};
+    for (auto _ : state) {
+        for (auto& obj : held) obj = shared_pool().acquire();
+        benchmark::DoNotOptimize(held);
+        for (auto* obj : held) shared_pool().release(obj);
+    }
+    state.SetItemsProcessed(state.iterations() * held.size());
+}
+BENCHMARK(BM_ConcurrentPool_AcquireRelease_Global)->ThreadRange(1, 8)->UseRealTime()->MinTime(0.1);
+
+// Baseline: single-threaded ObjectPool shared behind a mutex
+static std::mutex pool_mutex;
+static ObjectPool<SmallObject, POOL_SIZE, false>& mutex_pool() {
+    static auto pool = std::make_unique<ObjectPool<SmallObject, POOL_SIZE, false>>();
+    return *pool;
+}
+
+static void BM_MutexPool_AcquireRelease(benchmark::State& state) {
+    std::array<SmallObject*, 8> held{};
+    for (auto _ : state) {
+        for (auto& obj : held) {
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            obj = mutex_pool().acquire();
+        }
+        benchmark::DoNotOptimize(held);
+        for (auto* obj : held) {
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            mutex_pool().release(obj);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * held.size());
+}
+BENCHMARK(BM_MutexPool_AcquireRelease)->ThreadRange(1, 8)->UseRealTime()->MinTime(0.1);
+
+// Random access across a large pool: huge pages vs 4K pages (TLB reach)
+static void BM_HugePagePool_RandomTouch(benchmark::State& state) {
+    using LargePool = HugePageObjectPool<SmallObject>;
+    LargePool::Options opts;
+    opts.objects_per_slab = 262144;  // 16MB of 64-byte objects, beyond ObjectPool's cap
+    opts.huge_pages = state.range(0) != 0;
+    opts.lock_memory = false;
+    LargePool pool(opts);
+    if (!pool.valid()) {
+        state.SkipWithError("mmap failed");
+        return;
+    }
+    
+    std::vector<SmallObject*> live;
+    live.reserve(opts.objects_per_slab);
+    while (auto* obj = pool.acquire()) live.push_back(obj);
+    std::mt19937 gen(42);
+    std::shuffle(live.begin(), live.end(), gen);
+    
+    size_t i = 0;
+    for (auto _ : state) {
+        live[i]->data[0] += 1;
+        benchmark::DoNotOptimize(live[i]->data[0]);
+        i = (i + 1) & (live.size() - 1);
+    }
+    state.SetLabel(pool.huge_pages_active() ? "huge pages" : "regular pages");
+}
+BENCHMARK(BM_HugePagePool_RandomTouch)->Arg(0)->Arg(1)->MinTime(0.1);
+
 BENCHMARK_MAIN(); 
\ No newline at end of file
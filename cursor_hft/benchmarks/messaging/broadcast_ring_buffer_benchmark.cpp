@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <array>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <hft/messaging/broadcast_ring_buffer.hpp>
+#include <hft/timing/hft_timer.hpp>
+
+using namespace hft;
+
+namespace {
+constexpr size_t ITEMS_PER_RUN = 200000;
+constexpr size_t MAX_CONSUMERS = 4;
+using BroadcastRing = BroadcastRingBuffer<uint64_t, 1024, MAX_CONSUMERS>;
+} // namespace
+
+// Single-threaded publish/read with one consumer
+static void BM_BroadcastSinglePushPop(benchmark::State& state) {
+    auto ring = std::make_unique<BroadcastRing>();
+    auto consumer = ring->subscribe();
+    uint64_t value = 42;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ring->try_push(value));
+        benchmark::DoNotOptimize(consumer.try_pop(value));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_BroadcastSinglePushPop)->UseRealTime();
+
+// Producer cost as consumers are added (gating scan cost)
+static void BM_BroadcastBatchFanout(benchmark::State& state) {
+    const size_t consumers = static_cast<size_t>(state.range(0));
+    auto ring = std::make_unique<BroadcastRing>();
+    std::vector<BroadcastRing::Consumer> handles;
+    for (size_t c = 0; c < consumers; ++c) handles.push_back(ring->subscribe());
+
+    std::array<uint64_t, 64> input{};
+    std::array<uint64_t, 64> output;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ring->try_push_batch(input.begin(), input.end()));
+        for (auto& h : handles) {
+            benchmark::DoNotOptimize(h.try_pop_batch(output.begin(), output.end()));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_BroadcastBatchFanout)
+    ->Arg(1)->Arg(2)->Arg(4)
+    ->UseRealTime();
+
+// One producer thread, N consumer threads each reading every item
+static void BM_BroadcastConcurrentFanout(benchmark::State& state) {
+    const size_t consumers = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto ring = std::make_unique<BroadcastRing>();
+        std::vector<BroadcastRing::Consumer> handles;
+        for (size_t c = 0; c < consumers; ++c) handles.push_back(ring->subscribe());
+        state.ResumeTiming();
+
+        std::vector<std::thread> threads;
+        for (size_t c = 0; c < consumers; ++c) {
+            threads.emplace_back([&, c]() {
+                std::array<uint64_t, 64> out;
+                size_t received = 0;
+                while (received < ITEMS_PER_RUN) {
+                    const size_t n = handles[c].try_pop_batch(out.begin(), out.end());
+                    received += n;
+                    if (n == 0) std::this_thread::yield();
+                }
+                benchmark::DoNotOptimize(out);
+            });
+        }
+
+        for (uint64_t i = 0; i < ITEMS_PER_RUN;) {
+            if (ring->try_push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();  // Consumers may share our core
+            }
+        }
+        for (auto& t : threads) t.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ITEMS_PER_RUN);
+    state.counters["Consumers"] = static_cast<double>(consumers);
+}
+BENCHMARK(BM_BroadcastConcurrentFanout)
+    ->Arg(1)->Arg(2)->Arg(3)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
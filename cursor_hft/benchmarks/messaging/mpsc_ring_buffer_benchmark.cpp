@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <array>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <hft/messaging/mpsc_ring_buffer.hpp>
+#include <hft/messaging/spsc_ring_buffer.hpp>
+#include <hft/timing/hft_timer.hpp>
+
+using namespace hft;
+
+namespace {
+constexpr size_t ITEMS_PER_RUN = 200000;
+
+// Status quo: producers serialized behind a mutex in front of an SPSC ring
+struct MutexGuardedSPSC {
+    std::mutex mutex;
+    SPSCRingBuffer<uint64_t, 1024> ring;
+
+    bool try_push(uint64_t value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return ring.try_push(value);
+    }
+    template<typename Iterator>
+    size_t try_pop_batch(Iterator begin, Iterator end) {
+        return ring.try_pop_batch(begin, end);
+    }
+};
+
+template<typename Queue>
+void run_contended(benchmark::State& state, Queue& queue) {
+    const size_t producers = static_cast<size_t>(state.range(0));
+    const size_t per_producer = ITEMS_PER_RUN / producers;
+
+    for (auto _ : state) {
+        std::atomic<bool> start{false};
+        std::vector<std::thread> threads;
+        for (size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&]() {
+                while (!start.load(std::memory_order_acquire)) {}
+                for (size_t i = 0; i < per_producer;) {
+                    if (queue.try_push(i)) {
+                        ++i;
+                    } else {
+                        std::this_thread::yield();  // Consumer may share our core
+                    }
+                }
+            });
+        }
+
+        std::array<uint64_t, 64> out;
+        size_t received = 0;
+        start.store(true, std::memory_order_release);
+        while (received < per_producer * producers) {
+            const size_t n = queue.try_pop_batch(out.begin(), out.end());
+            received += n;
+            if (n == 0) std::this_thread::yield();
+        }
+        for (auto& t : threads) t.join();
+        benchmark::DoNotOptimize(out);
+    }
+
+    state.SetItemsProcessed(state.iterations() * per_producer * producers);
+}
+} // namespace
+
+// Uncontended push/pop cost
+static void BM_MPSCSinglePushPop(benchmark::State& state) {
+    MPSCRingBuffer<int, 1024> buffer;
+    int value = 42;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(buffer.try_push(value));
+        benchmark::DoNotOptimize(buffer.try_pop(value));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_MPSCSinglePushPop)->UseRealTime();
+
+// Batch claim: one CAS per batch
+static void BM_MPSCBatchOperations(benchmark::State& state) {
+    const size_t batch_size = state.range(0);
+    MPSCRingBuffer<int, 1024> buffer;
+    std::vector<int> input(batch_size, 7);
+    std::vector<int> output(batch_size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(buffer.try_push_batch(input.begin(), input.end()));
+        benchmark::DoNotOptimize(buffer.try_pop_batch(output.begin(), output.end()));
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch_size * 2);
+}
+BENCHMARK(BM_MPSCBatchOperations)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->UseRealTime();
+
+// Several producer threads into one consumer
+static void BM_MPSCContended(benchmark::State& state) {
+    auto queue = std::make_unique<MPSCRingBuffer<uint64_t, 1024>>();
+    run_contended(state, *queue);
+    state.SetLabel("lock-free MPSC");
+}
+BENCHMARK(BM_MPSCContended)
+    ->Arg(1)->Arg(2)->Arg(4)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Same workload through a mutex-guarded SPSC ring
+static void BM_MutexSPSCContended(benchmark::State& state) {
+    auto queue = std::make_unique<MutexGuardedSPSC>();
+    run_contended(state, *queue);
+    state.SetLabel("mutex + SPSC baseline");
+}
+BENCHMARK(BM_MutexSPSCContended)
+    ->Arg(1)->Arg(2)->Arg(4)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -2,20 +2,31 @@
 #include <thread>
 #include <array>
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <cstring>
+#include <string>
 #include <hft/messaging/spsc_ring_buffer.hpp>
+#include <hft/messaging/shm_ring_buffer.hpp>
+#include <hft/messaging/wait_strategy.hpp>
 #include <hft/timing/hft_timer.hpp>
+#include "common/perf_counter_fixture.hpp"
 
 using namespace hft;
+using hft::bench::PerfCounterRecorder;
 
 // Benchmark single push/pop operations
 static void BM_SinglePushPop(benchmark::State& state) {
     SPSCRingBuffer<int, 1024> buffer;
     int value = 42;
     
+    PerfCounterRecorder perf;
+    perf.start();
     for (auto _ : state) {
         benchmark::DoNotOptimize(buffer.try_push(value));
         benchmark::DoNotOptimize(buffer.try_pop(value));
     }
+    perf.report(state);
     
     state.SetItemsProcessed(state.iterations() * 2); // Count both push and pop
     state.SetBytesProcessed(state.iterations() * 2 * sizeof(int));
@@ -34,10 +45,13 @@ static void BM_BatchOperations(benchmark::State& state) {
         input[i] = static_cast<int>(i);
     }
     
+    PerfCounterRecorder perf;
+    perf.start();
     for (auto _ : state) {
         benchmark::DoNotOptimize(buffer.try_push_batch(input.begin(), input.end()));
         benchmark::DoNotOptimize(buffer.try_pop_batch(output.begin(), output.end()));
     }
+    perf.report(state);
     
     state.SetItemsProcessed(state.iterations() * batch_size * 2);
     state.SetBytesProcessed(state.iterations() * batch_size * 2 * sizeof(int));
@@ -123,10 +137,13 @@ static void BM_MessageSize(benchmark::State& state) {
     SPSCRingBuffer<Message<MessageSize>, 1024> buffer;
     Message<MessageSize> msg{};
     
+    PerfCounterRecorder perf;
+    perf.start();
     for (auto _ : state) {
         benchmark::DoNotOptimize(buffer.try_push(msg));
         benchmark::DoNotOptimize(buffer.try_pop(msg));
     }
+    perf.report(state);
     
     state.SetItemsProcessed(state.iterations() * 2);
     state.SetBytesProcessed(state.iterations() * 2 * MessageSize);
@@ -144,12 +161,15 @@ static void BM_CacheLineEffects(benchmark::State& state) {
     SPSCRingBuffer<int, 1024> buffer;
     std::vector<int> data(1024);
     
+    PerfCounterRecorder perf;
+    perf.start();
     for (auto _ : state) {
         for (size_t i = 0; i < 1024; i += stride) {
             benchmark::DoNotOptimize(buffer.try_push(data[i]));
             benchmark::DoNotOptimize(buffer.try_pop(data[i]));
         }
     }
+    perf.report(state);
     
     state.SetItemsProcessed(state.iterations() * (1024 / stride) * 2);
     state.SetBytesProcessed(state.iterations() * (1024 / stride) * 2 * sizeof(int));
@@ -159,4 +179,171 @@ BENCHMARK(BM_CacheLineEffects)
     ->Range(1, 64)
     ->UseRealTime();
 
+// Benchmark in-place writes via claim/commit vs building on the stack and copying
+static void BM_ClaimCommit(benchmark::State& state) {
+    auto buffer = std::make_unique<SPSCRingBuffer<Message<64>, 1024>>();
+    Message<64> msg{};
+    uint64_t seq = 0;
+    
+    PerfCounterRecorder perf;
+    perf.start();
+    for (auto _ : state) {
+        auto slot = buffer->claim();
+        std::memcpy(slot[0].data, &seq, sizeof(seq));
+        buffer->commit();
+        benchmark::DoNotOptimize(buffer->try_pop(msg));
+        ++seq;
+    }
+    perf.report(state);
+    
+    state.SetItemsProcessed(state.iterations() * 2);
+    state.SetBytesProcessed(state.iterations() * 2 * sizeof(Message<64>));
+}
+BENCHMARK(BM_ClaimCommit)->UseRealTime();
+
+static void BM_StackBuildAndPush(benchmark::State& state) {
+    auto buffer = std::make_unique<SPSCRingBuffer<Message<64>, 1024>>();
+    Message<64> msg{};
+    uint64_t seq = 0;
+    
+    PerfCounterRecorder perf;
+    perf.start();
+    for (auto _ : state) {
+        Message<64> staged;
+        std::memcpy(staged.data, &seq, sizeof(seq));
+        benchmark::DoNotOptimize(buffer->try_push(staged));
+        benchmark::DoNotOptimize(buffer->try_pop(msg));
+        ++seq;
+    }
+    perf.report(state);
+    
+    state.SetItemsProcessed(state.iterations() * 2);
+    state.SetBytesProcessed(state.iterations() * 2 * sizeof(Message<64>));
+}
+BENCHMARK(BM_StackBuildAndPush)->UseRealTime();
+
+// Benchmark cross-thread streaming (index cache-line traffic dominates)
+static void BM_CrossThreadThroughput(benchmark::State& state) {
+    constexpr size_t ITEMS = 1000000;
+    
+    for (auto _ : state) {
+        auto buffer = std::make_unique<SPSCRingBuffer<uint64_t, 1024>>();
+        std::thread producer([&]() {
+            for (uint64_t i = 0; i < ITEMS;) {
+                if (buffer->try_push(i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        
+        uint64_t value = 0;
+        for (size_t received = 0; received < ITEMS;) {
+            if (buffer->try_pop(value)) {
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        benchmark::DoNotOptimize(value);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * ITEMS);
+}
+BENCHMARK(BM_CrossThreadThroughput)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Same stream through the shared-memory ring (one handle per side, as across processes)
+static void BM_ShmCrossThreadThroughput(benchmark::State& state) {
+    constexpr size_t ITEMS = 1000000;
+    const std::string name = "hft_bench_shm_" + std::to_string(::getpid());
+    
+    for (auto _ : state) {
+        ShmSPSCRingBuffer<uint64_t, 1024> consumer;
+        if (!consumer.create(name.c_str(), ShmRole::CONSUMER)) {
+            state.SkipWithError("shared-memory ring unavailable");
+            return;
+        }
+        std::thread producer([&]() {
+            ShmSPSCRingBuffer<uint64_t, 1024> ring;
+            if (!ring.open(name.c_str(), ShmRole::PRODUCER)) return;
+            for (uint64_t i = 0; i < ITEMS;) {
+                if (ring.try_push(i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        
+        uint64_t value = 0;
+        for (size_t received = 0; received < ITEMS;) {
+            if (consumer.try_pop(value)) {
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        benchmark::DoNotOptimize(value);
+    }
+    ShmSPSCRingBuffer<uint64_t, 1024>::unlink(name.c_str());
+    
+    state.SetItemsProcessed(state.iterations() * ITEMS);
+}
+BENCHMARK(BM_ShmCrossThreadThroughput)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Producer-side cost of each wait strategy with no consumer parked
+template<typename Wait>
+static void BM_PushNotify(benchmark::State& state) {
+    SPSCRingBuffer<int, 1024> buffer;
+    Wait wait;
+    int value = 42;
+    
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(push_and_notify(buffer, wait, value));
+        benchmark::DoNotOptimize(buffer.try_pop(value));
+    }
+    
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_TEMPLATE(BM_PushNotify, SpinWait)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushNotify, SpinYieldWait<>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushNotify, ParkingWait<>)->UseRealTime();
+
+// Low-rate queue: wake-up latency from push to consumer, by strategy
+template<typename Wait>
+static void BM_WakeLatency(benchmark::State& state) {
+    SPSCRingBuffer<HFTTimer::timestamp_t, 64> buffer;
+    Wait wait;
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<uint64_t> received{0};
+    
+    std::thread consumer([&]() {
+        HFTTimer::timestamp_t sent = 0;
+        while (pop_wait(buffer, wait, sent, stop)) {
+            total_ns.fetch_add(HFTTimer::get_timestamp_ns() - sent, std::memory_order_relaxed);
+            received.fetch_add(1, std::memory_order_release);
+        }
+    });
+    
+    uint64_t sent_count = 0;
+    for (auto _ : state) {
+        (void)push_and_notify(buffer, wait, HFTTimer::get_timestamp_ns());
+        ++sent_count;
+        while (received.load(std::memory_order_acquire) < sent_count) {
+            std::this_thread::yield();
+        }
+    }
+    stop.store(true, std::memory_order_release);
+    wait.notify_all();
+    consumer.join();
+    
+    state.counters["wake_latency_ns"] = sent_count ? static_cast<double>(total_ns.load()) / sent_count : 0.0;
+}
+BENCHMARK_TEMPLATE(BM_WakeLatency, SpinYieldWait<>)->UseRealTime()->Iterations(2000);
+BENCHMARK_TEMPLATE(BM_WakeLatency, ParkingWait<>)->UseRealTime()->Iterations(2000);
+
 BENCHMARK_MAIN();
@@ -222,6 +222,22 @@ BENCHMARK_F(AdvancedMarketMakerBenchmark, HedgeRatioCalculation)(benchmark::Stat
     state.SetItemsProcessed(state.iterations());
 }
 
+// Benchmark a single-instrument tick moving the curve (incremental refit + hedge recompute)
+BENCHMARK_F(AdvancedMarketMakerBenchmark, HedgeRatioSingleTick)(benchmark::State& state) {
+    std::array<double, 6> yields;
+    for (size_t i = 0; i < yields.size(); ++i) {
+        yields[i] = 0.02 + 0.001 * i;
+    }
+    
+    uint64_t tick = 0;
+    for (auto _ : state) {
+        yields[4] = 0.024 + 0.00001 * static_cast<double>(++tick & 63);
+        strategy_->update_hedge_ratios(yields);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
 // Benchmark comprehensive strategy workflow
 BENCHMARK_F(AdvancedMarketMakerBenchmark, CompleteWorkflow)(benchmark::State& state) {
     auto update = create_market_update();
@@ -306,6 +322,11 @@ BENCHMARK_REGISTER_F(AdvancedMarketMakerBenchmark, HedgeRatioCalculation)
     ->ReportAggregatesOnly(true)
     ->DisplayAggregatesOnly(true);
 
+BENCHMARK_REGISTER_F(AdvancedMarketMakerBenchmark, HedgeRatioSingleTick)
+    ->Iterations(100000)
+    ->ReportAggregatesOnly(true)
+    ->DisplayAggregatesOnly(true);
+
 BENCHMARK_REGISTER_F(AdvancedMarketMakerBenchmark, CompleteWorkflow)
     ->Iterations(25000)
     ->ReportAggregatesOnly(true)
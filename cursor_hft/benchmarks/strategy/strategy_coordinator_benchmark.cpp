@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <thread>
+#include <utility>
+#include "hft/strategy/strategy_coordinator.hpp"
+#include "hft/strategy/simple_market_maker.hpp"
+#include "hft/memory/object_pool.hpp"
+#include "hft/trading/order_book.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+
+using namespace hft::strategy;
+using namespace hft::trading;
+using namespace hft::market_data;
+
+namespace {
+
+// StrategyCoordinator over N SimpleMarketMakers
+template<size_t N, typename = std::make_index_sequence<N>>
+struct CoordinatorOf;
+
+template<size_t N, size_t... Is>
+struct CoordinatorOf<N, std::index_sequence<Is...>> {
+    template<size_t>
+    using Strategy = SimpleMarketMaker;
+    using type = StrategyCoordinator<Strategy<Is>...>;
+};
+
+struct Infrastructure {
+    Infrastructure()
+        : order_pool(std::make_unique<hft::ObjectPool<TreasuryOrder, 4096>>()),
+          level_pool(std::make_unique<hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>>()),
+          update_buffer(std::make_unique<hft::SPSCRingBuffer<OrderBookUpdate, 8192>>()),
+          order_book(std::make_unique<TreasuryOrderBook>(*order_pool, *level_pool, *update_buffer)) {}
+
+    template<typename Coordinator>
+    std::unique_ptr<Coordinator> make_coordinator() {
+        return std::make_unique<Coordinator>(*order_pool, *level_pool, *update_buffer, *order_book);
+    }
+
+    std::unique_ptr<hft::ObjectPool<TreasuryOrder, 4096>> order_pool;
+    std::unique_ptr<hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>> level_pool;
+    std::unique_ptr<hft::SPSCRingBuffer<OrderBookUpdate, 8192>> update_buffer;
+    std::unique_ptr<TreasuryOrderBook> order_book;
+};
+
+SimpleMarketMaker::MarketUpdate make_update() {
+    return SimpleMarketMaker::MarketUpdate(TreasuryType::Note_10Y,
+                                           Price32nd::from_decimal(102.5),
+                                           Price32nd::from_decimal(102.53125),
+                                           5000000, 5000000);
+}
+
+} // namespace
+
+// Coordination latency vs strategy count, strategies run inline on the caller
+template<size_t N>
+static void BM_Coordinate_Sequential(benchmark::State& state) {
+    Infrastructure infra;
+    auto coordinator = infra.make_coordinator<typename CoordinatorOf<N>::type>();
+    const auto update = make_update();
+    uint64_t overhead_ns = 0;
+
+    for (auto _ : state) {
+        auto results = coordinator->coordinate_strategies(update);
+        benchmark::DoNotOptimize(results);
+        overhead_ns += results[0].coordination_overhead_ns;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["Strategies"] = static_cast<double>(N);
+    // Coordinator's own share of each call (target: <1us); see also get_average_coordination_latency_ns()
+    state.counters["OverheadNs"] = benchmark::Counter(static_cast<double>(overhead_ns), benchmark::Counter::kAvgIterations);
+    state.counters["AvgLatencyNs"] = static_cast<double>(coordinator->get_average_coordination_latency_ns());
+}
+
+// Same sweep with one pinned worker per strategy (cores 1..N; 0 left to the caller)
+template<size_t N>
+static void BM_Coordinate_Parallel(benchmark::State& state) {
+    Infrastructure infra;
+    using Coordinator = typename CoordinatorOf<N>::type;
+    auto coordinator = infra.make_coordinator<Coordinator>();
+    const auto update = make_update();
+
+    const int cpus = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::array<int, Coordinator::MAX_STRATEGIES> cores;
+    for (size_t i = 0; i < N; ++i) {
+        cores[i] = cpus > 1 ? 1 + static_cast<int>(i) % (cpus - 1) : -1;
+    }
+    coordinator->start_parallel(cores);
+
+    for (auto _ : state) {
+        auto results = coordinator->coordinate_strategies(update);
+        benchmark::DoNotOptimize(results);
+    }
+
+    coordinator->stop_parallel();
+    state.SetItemsProcessed(state.iterations());
+    state.counters["Strategies"] = static_cast<double>(N);
+    state.counters["Cores"] = static_cast<double>(cpus);
+}
+
+BENCHMARK_TEMPLATE(BM_Coordinate_Sequential, 1);
+BENCHMARK_TEMPLATE(BM_Coordinate_Sequential, 2);
+BENCHMARK_TEMPLATE(BM_Coordinate_Sequential, 4);
+BENCHMARK_TEMPLATE(BM_Coordinate_Sequential, 6);
+BENCHMARK_TEMPLATE(BM_Coordinate_Sequential, 8);
+
+BENCHMARK_TEMPLATE(BM_Coordinate_Parallel, 1)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Coordinate_Parallel, 2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Coordinate_Parallel, 4)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Coordinate_Parallel, 6)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Coordinate_Parallel, 8)->UseRealTime();
@@ -4,12 +4,19 @@
 #include <random>
 #include <chrono>
 #include <cstring>
+#include <string>
 #include "hft/market_data/feed_handler.hpp"
 #include "hft/trading/order_book.hpp"
+#include "hft/trading/risk_control_system.hpp"
+#include "hft/strategy/strategy_coordinator.hpp"
+#include "hft/strategy/fast_lane.hpp"
 #include "hft/timing/hft_timer.hpp"
+#include "hft/timing/latency_tracer.hpp"
+#include "common/perf_counter_fixture.hpp"
 
 using namespace hft::market_data;
 using namespace hft::trading;
+using namespace hft::strategy;
 
 /**
  * @brief End-to-end system integration benchmark
@@ -21,11 +28,18 @@ using namespace hft::trading;
  * 4. Trade decision logic (simulated)
  * 5. Order placement response
  * 
+ * The TickToTrade* pair compares the coordinated quote path with the
+ * FastLane on the same feed; the *Traced variants trace every tick and
+ * report where the time went, stage by stage. Both paths and the
+ * pre-trade gates also report hardware counters for their timed window.
+ * 
  * Target: <15 microseconds end-to-end
  */
-class EndToEndBenchmarkFixture : public benchmark::Fixture {
+class EndToEndBenchmarkFixture : public hft::bench::PerfCounterFixture {
 public:
     void SetUp(const ::benchmark::State& state) override {
+        PerfCounterFixture::SetUp(state);
+        
         // Initialize object pools
         order_pool_ = std::make_unique<TreasuryOrderPool>();
         level_pool_ = std::make_unique<PriceLevelPool>();
@@ -36,16 +50,32 @@ public:
         order_book_ = std::make_unique<TreasuryOrderBook>(
             *order_pool_, *level_pool_, *update_buffer_);
         
+        // Quote paths: coordinated (coordinator + full risk) and fast lane
+        RiskControlSystem::RiskLimits limits;
+        limits.max_orders_per_second = 1000000000;  // Benchmark rate, not a trading limit
+        risk_ = std::make_unique<RiskControlSystem>(limits);
+        session_ = std::make_unique<VenueSession>();
+        coordinator_ = std::make_unique<StrategyCoordinator<SimpleMarketMaker>>(
+            *order_pool_, *level_pool_, *update_buffer_, *order_book_);
+        lane_strategy_ = std::make_unique<SimpleMarketMaker>(*order_pool_, *order_book_);
+        lane_ = std::make_unique<FastLane>(*lane_strategy_, *risk_, *session_);
+        
         // Pre-generate test data for consistent benchmarking
         generate_market_data(1000);
         next_order_id_ = 1;
     }
 
     void TearDown(const ::benchmark::State& state) override {
+        feed_handler_->set_tracer(nullptr);
+        tracer_.reset();
+        lane_.reset();
+        lane_strategy_.reset();
+        coordinator_.reset();
         order_book_->reset();
         order_pool_->reset();
         level_pool_->reset();
         feed_handler_->reset_stats();
+        PerfCounterFixture::TearDown(state);
     }
 
 protected:
@@ -119,7 +149,93 @@ protected:
     std::unique_ptr<PriceLevelPool> level_pool_;
     std::unique_ptr<OrderBookUpdateBuffer> update_buffer_;
     std::unique_ptr<TreasuryFeedHandler> feed_handler_;
+    // Coordinated quote path: strategy via the coordinator, full risk per side, then the session
+    bool send_coordinated_quote(const TreasuryTick& tick) {
+        SimpleMarketMaker::MarketUpdate update(tick.instrument_type, tick.bid_price, tick.ask_price,
+                                               tick.bid_size, tick.ask_size);
+        update.trace_id = tick.trace_id;
+        const auto results = coordinator_->coordinate_strategies(update);
+        const auto& result = results[0];
+        if (result.action != StrategyCoordinator<SimpleMarketMaker>::StrategyResult::Action::UPDATE_QUOTES) {
+            return false;
+        }
+        if (tracer_) tracer_->stamp(result.trace_id, hft::TraceStage::DECISION);
+        
+        const std::array<RiskControlSystem::RiskCheckRequest, 2> sides{{
+            {result.instrument, OrderSide::BID, result.bid_size, result.bid_price},
+            {result.instrument, OrderSide::ASK, result.ask_size, result.ask_price}}};
+        if (risk_->check_orders(sides) != 0b11) {
+            return false;
+        }
+        risk_->record_order_activity();
+        risk_->record_order_activity();
+        if (tracer_) tracer_->stamp(result.trace_id, hft::TraceStage::RISK);
+        
+        QuoteUpdate quote{};
+        quote.sequence = next_order_id_++;
+        quote.tick_time_ns = tick.timestamp_ns;
+        quote.bid_price = result.bid_price;
+        quote.ask_price = result.ask_price;
+        quote.bid_size = result.bid_size;
+        quote.ask_size = result.ask_size;
+        quote.instrument = result.instrument;
+        quote.trace_id = result.trace_id;
+        quote.send_time_ns = hft::HFTTimer::get_timestamp_ns();
+        if (!session_->try_push(quote)) return false;
+        if (tracer_) (void)tracer_->finish(quote.trace_id, hft::TraceStage::SEND);
+        return true;
+    }
+    
+    // Trace every tick from the feed handler through whichever quote path runs
+    void enable_tracing() {
+        tracer_ = std::make_unique<hft::PipelineTracer>(1);
+        feed_handler_->set_tracer(tracer_.get());
+        lane_->set_tracer(tracer_.get());
+    }
+    
+    // Per-stage p50 / p99 (time since the previous stamped stage) and the traced total
+    void report_stage_breakdown(benchmark::State& state) {
+        tracer_->drain();
+        for (auto stage : {hft::TraceStage::PARSED, hft::TraceStage::DECISION,
+                           hft::TraceStage::RISK, hft::TraceStage::SEND}) {
+            const auto breakdown = tracer_->stage_breakdown(stage);
+            const std::string name = hft::trace_stage_name(stage);
+            state.counters[name + "_p50_ns"] = breakdown.p50_ns;
+            state.counters[name + "_p99_ns"] = breakdown.p99_ns;
+        }
+        const auto total = tracer_->total_breakdown();
+        state.counters["Traced"] = total.count;
+        state.counters["TracedP50_ns"] = total.p50_ns;
+        state.counters["TracedP99_ns"] = total.p99_ns;
+    }
+    
+    // Gateway side of the venue session
+    void drain_session() {
+        QuoteUpdate sent;
+        while (session_->try_pop(sent)) {
+            benchmark::DoNotOptimize(sent);
+        }
+    }
+    
+    // Timed loops shared by the plain and traced tick-to-trade benchmarks
+    void run_coordinated(benchmark::State& state);
+    void run_fast_lane(benchmark::State& state);
+    
+    static void report_latencies(benchmark::State& state, std::vector<uint64_t>& latencies) {
+        if (latencies.empty()) return;
+        std::sort(latencies.begin(), latencies.end());
+        state.counters["MedianLatency_ns"] = latencies[latencies.size() / 2];
+        state.counters["P99Latency_ns"] = latencies[latencies.size() * 99 / 100];
+        state.counters["MaxLatency_ns"] = latencies.back();
+    }
+
     std::unique_ptr<TreasuryOrderBook> order_book_;
+    std::unique_ptr<RiskControlSystem> risk_;
+    std::unique_ptr<VenueSession> session_;
+    std::unique_ptr<StrategyCoordinator<SimpleMarketMaker>> coordinator_;
+    std::unique_ptr<SimpleMarketMaker> lane_strategy_;
+    std::unique_ptr<FastLane> lane_;
+    std::unique_ptr<hft::PipelineTracer> tracer_;
     std::vector<RawMarketMessage> test_messages_;
     uint64_t next_order_id_;
 };
@@ -198,6 +314,158 @@ BENCHMARK_F(EndToEndBenchmarkFixture, TickToTradeLatency)(benchmark::State& stat
     state.SetLabel("Target: <15μs tick-to-trade");
 }
 
+// Tick-to-trade through the coordinator and full risk: raw message to quote in the venue session
+BENCHMARK_F(EndToEndBenchmarkFixture, TickToTradeCoordinated)(benchmark::State& state) {
+    run_coordinated(state);
+    state.SetLabel("Coordinator + full risk");
+}
+
+// Same path with every tick traced: where the coordinated tick-to-trade time goes
+BENCHMARK_F(EndToEndBenchmarkFixture, TickToTradeCoordinatedTraced)(benchmark::State& state) {
+    enable_tracing();
+    run_coordinated(state);
+    report_stage_breakdown(state);
+    state.SetLabel("Coordinator + full risk, per-stage");
+}
+
+// Tick-to-trade through the fast lane; full risk runs after the send, outside the timed window
+BENCHMARK_F(EndToEndBenchmarkFixture, TickToTradeFastLane)(benchmark::State& state) {
+    run_fast_lane(state);
+    state.SetLabel("Fast lane, deferred full risk");
+}
+
+// Same path with every tick traced
+BENCHMARK_F(EndToEndBenchmarkFixture, TickToTradeFastLaneTraced)(benchmark::State& state) {
+    enable_tracing();
+    run_fast_lane(state);
+    report_stage_breakdown(state);
+    state.SetLabel("Fast lane, per-stage");
+}
+
+void EndToEndBenchmarkFixture::run_coordinated(benchmark::State& state) {
+    size_t processed_messages = 0;
+    size_t quotes_sent = 0;
+    std::vector<uint64_t> latencies;
+    latencies.reserve(1000);
+    
+    // Counters cover the timed window only
+    perf_->start();
+    perf_->pause();
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (processed_messages >= test_messages_.size()) {
+            feed_handler_->reset_stats();
+            processed_messages = 0;
+        }
+        const auto& raw_msg = test_messages_[processed_messages++];
+        state.ResumeTiming();
+        
+        perf_->resume();
+        const auto start_cycles = hft::HFTTimer::get_cycles();
+        TreasuryTick tick;
+        if (feed_handler_->process_messages(&raw_msg, 1) > 0 &&
+            feed_handler_->get_parsed_ticks(&tick, 1) > 0 &&
+            send_coordinated_quote(tick)) {
+            ++quotes_sent;
+        }
+        const uint64_t latency_ns = hft::HFTTimer::cycles_to_ns(hft::HFTTimer::get_cycles() - start_cycles);
+        perf_->pause();
+        latencies.push_back(latency_ns);
+        state.SetIterationTime(latency_ns / 1e9);
+        
+        drain_session();
+    }
+    
+    report_latencies(state, latencies);
+    perf_->report(state);
+    state.counters["QuotesSent"] = quotes_sent;
+}
+
+void EndToEndBenchmarkFixture::run_fast_lane(benchmark::State& state) {
+    size_t processed_messages = 0;
+    uint64_t full_risk_ns = 0;
+    std::vector<uint64_t> latencies;
+    latencies.reserve(1000);
+    
+    // Counters cover the timed window only
+    perf_->start();
+    perf_->pause();
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (processed_messages >= test_messages_.size()) {
+            feed_handler_->reset_stats();
+            processed_messages = 0;
+        }
+        const auto& raw_msg = test_messages_[processed_messages++];
+        state.ResumeTiming();
+        
+        perf_->resume();
+        const auto start_cycles = hft::HFTTimer::get_cycles();
+        TreasuryTick tick;
+        if (feed_handler_->process_messages(&raw_msg, 1) > 0 &&
+            feed_handler_->get_parsed_ticks(&tick, 1) > 0) {
+            lane_->on_tick(tick);
+        }
+        const auto sent_cycles = hft::HFTTimer::get_cycles();
+        perf_->pause();
+        (void)lane_->run_full_risk();
+        const auto checked_cycles = hft::HFTTimer::get_cycles();
+        
+        const uint64_t latency_ns = hft::HFTTimer::cycles_to_ns(sent_cycles - start_cycles);
+        full_risk_ns += hft::HFTTimer::cycles_to_ns(checked_cycles - sent_cycles);
+        latencies.push_back(latency_ns);
+        state.SetIterationTime(latency_ns / 1e9);
+        
+        drain_session();
+    }
+    
+    report_latencies(state, latencies);
+    perf_->report(state);
+    const auto& stats = lane_->stats();
+    state.counters["QuotesSent"] = stats.quotes_sent;
+    state.counters["EnvelopeRejects"] = stats.envelope_rejects;
+    state.counters["FullRiskRejects"] = stats.full_risk_rejects;
+    state.counters["AvgFullRiskAfter_ns"] = state.iterations() ? full_risk_ns / state.iterations() : 0;
+}
+
+// Pre-trade gate for one coordinator tick: 8 strategies quoting both sides
+static std::array<RiskControlSystem::RiskCheckRequest, 16> make_gate_orders() {
+    std::array<RiskControlSystem::RiskCheckRequest, 16> orders;
+    for (size_t i = 0; i < orders.size(); ++i) {
+        orders[i] = {static_cast<TreasuryType>((i / 2) % 6), (i & 1) ? OrderSide::ASK : OrderSide::BID,
+                     1000000 + 1000 * i, Price32nd::from_decimal(99.5)};
+    }
+    return orders;
+}
+
+BENCHMARK_F(EndToEndBenchmarkFixture, PreTradeGateScalar)(benchmark::State& state) {
+    const auto orders = make_gate_orders();
+    perf_->start();
+    for (auto _ : state) {
+        uint64_t approved = 0;
+        for (size_t i = 0; i < orders.size(); ++i) {
+            const auto& order = orders[i];
+            approved |= static_cast<uint64_t>(
+                risk_->check_order_risk(order.instrument, order.side, order.quantity, order.price)) << i;
+        }
+        benchmark::DoNotOptimize(approved);
+    }
+    perf_->report(state);
+    state.SetItemsProcessed(state.iterations() * orders.size());
+    state.SetLabel("16 check_order_risk calls");
+}
+
+BENCHMARK_F(EndToEndBenchmarkFixture, PreTradeGateBatch)(benchmark::State& state) {
+    const auto orders = make_gate_orders();
+    perf_->start();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(risk_->check_orders(orders));
+    }
+    perf_->report(state);
+    state.SetItemsProcessed(state.iterations() * orders.size());
+    state.SetLabel("One check_orders pass");
+}
+
 // Component interaction overhead analysis
 BENCHMARK_F(EndToEndBenchmarkFixture, ComponentInteractionOverhead)(benchmark::State& state) {
     size_t batch_size = 10;
@@ -362,6 +630,24 @@ BENCHMARK_F(EndToEndBenchmarkFixture, MemoryAllocationAnalysis)(benchmark::State
 BENCHMARK_REGISTER_F(EndToEndBenchmarkFixture, TickToTradeLatency)
     ->UseManualTime()->Iterations(1000)->Unit(benchmark::kNanosecond);
 
+BENCHMARK_REGISTER_F(EndToEndBenchmarkFixture, TickToTradeCoordinated)
+    ->UseManualTime()->Iterations(1000)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_REGISTER_F(EndToEndBenchmarkFixture, TickToTradeFastLane)
+    ->UseManualTime()->Iterations(1000)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_REGISTER_F(EndToEndBenchmarkFixture, TickToTradeCoordinatedTraced)
+    ->UseManualTime()->Iterations(1000)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_REGISTER_F(EndToEndBenchmarkFixture, TickToTradeFastLaneTraced)
+    ->UseManualTime()->Iterations(1000)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_REGISTER_F(EndToEndBenchmarkFixture, PreTradeGateScalar)
+    ->Unit(benchmark::kNanosecond);
+
+BENCHMARK_REGISTER_F(EndToEndBenchmarkFixture, PreTradeGateBatch)
+    ->Unit(benchmark::kNanosecond);
+
 BENCHMARK_REGISTER_F(EndToEndBenchmarkFixture, ComponentInteractionOverhead)
     ->Iterations(1000);
 
@@ -0,0 +1,244 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include "hft/market_data/feed_handler.hpp"
+#include "hft/trading/order_book.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+#include "hft/strategy/strategy_coordinator.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+#include "hft/messaging/wait_strategy.hpp"
+#include "hft/timing/hft_timer.hpp"
+#include "hft/timing/hdr_histogram.hpp"
+
+using namespace hft::market_data;
+using namespace hft::trading;
+using namespace hft::strategy;
+
+/**
+ * @brief Latency under a fixed offered load
+ *
+ * An open-loop producer thread releases raw ticks on a fixed schedule
+ * (benchmark argument = messages per second) into an SPSC ring. The
+ * pipeline thread runs each one through TreasuryFeedHandler ->
+ * StrategyCoordinator<SimpleMarketMaker> -> OrderLifecycleManager, which
+ * creates one resting quote pair per instrument and amends it from then on.
+ *
+ * Latency is taken from each message's scheduled release time, carried in
+ * timestamp_exchange_ns, not from when it was actually sent or picked up.
+ * A stalled pipeline (or producer) therefore shows up as queueing delay on
+ * every message scheduled during the stall instead of being hidden
+ * (coordinated omission). Percentiles come from an HdrHistogram.
+ *
+ * Both threads poll with the Wait strategy: SpinWait needs two free
+ * cores, SpinYieldWait keeps the numbers meaningful on a shared one.
+ *
+ * Gate on the results with
+ *   hft_load_latency_benchmark --benchmark_out=load_latency.json
+ *   scripts/simple_benchmark_validator.py --results load_latency.json
+ */
+
+namespace {
+
+constexpr double RUN_SECONDS = 0.5;                  // Schedule length per offered rate
+constexpr size_t DISTINCT_MESSAGES = 1024;           // Pre-built ticks, cycled
+constexpr size_t INSTRUMENTS = 6;
+
+using MessageRing = hft::SPSCRingBuffer<RawMarketMessage, 16384>;
+
+RawMarketMessage make_tick(uint32_t instrument_id, double bid, uint64_t size) {
+    RawMarketMessage msg{};
+    msg.message_type = static_cast<uint32_t>(MessageType::Tick);
+    msg.instrument_id = instrument_id;
+    const double ask = bid + 0.03125;
+    std::memcpy(msg.raw_data, &bid, sizeof(double));
+    std::memcpy(msg.raw_data + 8, &ask, sizeof(double));
+    std::memcpy(msg.raw_data + 16, &size, sizeof(uint64_t));
+    std::memcpy(msg.raw_data + 24, &size, sizeof(uint64_t));
+    return msg;
+}
+
+// Sequence and schedule are stamped at release, so the checksum is too
+void seal(RawMarketMessage& msg) noexcept {
+    uint16_t sum = 0;
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&msg);
+    for (size_t i = 0; i < offsetof(RawMarketMessage, checksum); ++i) {
+        sum ^= bytes[i];
+    }
+    msg.checksum = sum;
+}
+
+/**
+ * @brief Feed handler, strategy and order lifecycle for one run
+ */
+class LoadPipeline {
+public:
+    LoadPipeline()
+        : order_pool_(std::make_unique<TreasuryOrderPool>()),
+          level_pool_(std::make_unique<PriceLevelPool>()),
+          update_buffer_(std::make_unique<OrderBookUpdateBuffer>()),
+          feed_handler_(std::make_unique<TreasuryFeedHandler>()),
+          order_book_(std::make_unique<TreasuryOrderBook>(*order_pool_, *level_pool_, *update_buffer_)),
+          coordinator_(std::make_unique<StrategyCoordinator<SimpleMarketMaker>>(
+              *order_pool_, *level_pool_, *update_buffer_, *order_book_)),
+          lifecycle_(std::make_unique<OrderLifecycleManager>(*order_pool_, *level_pool_, *update_buffer_)),
+          working_bid_{}, working_ask_{}, orders_sent_(0) {}
+
+    /**
+     * @brief Tick in, quotes replaced at the lifecycle manager
+     */
+    void on_message(const RawMarketMessage& msg) noexcept {
+        TreasuryTick tick;
+        if (feed_handler_->process_messages(&msg, 1) == 0 || feed_handler_->get_parsed_ticks(&tick, 1) == 0) {
+            return;
+        }
+        const SimpleMarketMaker::MarketUpdate update(tick.instrument_type, tick.bid_price, tick.ask_price,
+                                                     tick.bid_size, tick.ask_size);
+        const auto results = coordinator_->coordinate_strategies(update);
+        const auto& result = results[0];
+        if (result.action != StrategyCoordinator<SimpleMarketMaker>::StrategyResult::Action::UPDATE_QUOTES) {
+            return;
+        }
+        const size_t slot = static_cast<size_t>(result.instrument) % INSTRUMENTS;
+        replace(working_bid_[slot], result.instrument, OrderSide::BID, result.bid_price, result.bid_size);
+        replace(working_ask_[slot], result.instrument, OrderSide::ASK, result.ask_price, result.ask_size);
+    }
+
+    // New orders and amends accepted by the lifecycle manager
+    [[nodiscard]] uint64_t orders_sent() const noexcept { return orders_sent_; }
+    [[nodiscard]] uint64_t feed_rejects() const noexcept {
+        const auto stats = feed_handler_->get_quality_stats();
+        return stats.invalid_messages + stats.duplicate_messages + stats.sequence_gaps;
+    }
+
+private:
+    // Strategy sizes rounded down to the 1M lot every instrument accepts
+    void replace(uint64_t& working, TreasuryType instrument, OrderSide side, Price32nd price, uint64_t size) noexcept {
+        const uint64_t quantity = size / 1000000 * 1000000;
+        if (quantity == 0) return;
+        if (working != 0) {
+            orders_sent_ += lifecycle_->modify_order(working, price, quantity) ? 1 : 0;
+            return;
+        }
+        working = lifecycle_->create_order(instrument, side, OrderType::LIMIT, price, quantity);
+        orders_sent_ += working != 0 ? 1 : 0;
+    }
+
+    std::unique_ptr<TreasuryOrderPool> order_pool_;
+    std::unique_ptr<PriceLevelPool> level_pool_;
+    std::unique_ptr<OrderBookUpdateBuffer> update_buffer_;
+    std::unique_ptr<TreasuryFeedHandler> feed_handler_;
+    std::unique_ptr<TreasuryOrderBook> order_book_;
+    std::unique_ptr<StrategyCoordinator<SimpleMarketMaker>> coordinator_;
+    std::unique_ptr<OrderLifecycleManager> lifecycle_;
+    std::array<uint64_t, INSTRUMENTS> working_bid_;
+    std::array<uint64_t, INSTRUMENTS> working_ask_;
+    uint64_t orders_sent_;
+};
+
+std::vector<RawMarketMessage> make_messages() {
+    std::vector<RawMarketMessage> messages;
+    messages.reserve(DISTINCT_MESSAGES);
+    std::mt19937 gen(42);  // Fixed seed for reproducibility
+    std::uniform_real_distribution<> price_dist(99.0, 101.0);
+    std::uniform_int_distribution<uint64_t> qty_dist(1000000, 10000000);
+    std::uniform_int_distribution<uint32_t> instrument_dist(1, INSTRUMENTS);
+    for (size_t i = 0; i < DISTINCT_MESSAGES; ++i) {
+        messages.push_back(make_tick(instrument_dist(gen), price_dist(gen), qty_dist(gen)));
+    }
+    return messages;
+}
+
+} // namespace
+
+// Offered rate (messages/s) -> scheduled-time latency percentiles through the whole pipeline
+template<typename Wait>
+static void BM_OfferedLoadLatency(benchmark::State& state) {
+    const uint64_t rate = static_cast<uint64_t>(state.range(0));
+    const uint64_t total = static_cast<uint64_t>(static_cast<double>(rate) * RUN_SECONDS);
+    const double interval_ns = 1e9 / static_cast<double>(rate);
+    const auto messages = make_messages();
+
+    auto histogram = std::make_unique<hft::HdrHistogram<>>();
+    uint64_t orders_sent = 0;
+    uint64_t feed_rejects = 0;
+    uint64_t producer_late = 0;
+
+    for (auto _ : state) {
+        auto pipeline = std::make_unique<LoadPipeline>();
+        auto ring = std::make_unique<MessageRing>();
+        std::atomic<bool> producer_done{false};
+        histogram->reset();
+
+        const uint64_t start_ns = hft::HFTTimer::get_timestamp_ns() + 1000000;  // Both threads running by then
+        std::thread producer([&] {
+            Wait wait;
+            for (uint64_t i = 0; i < total; ++i) {
+                const uint64_t scheduled_ns = start_ns + static_cast<uint64_t>(static_cast<double>(i) * interval_ns);
+                wait.wait([&] { return hft::HFTTimer::get_timestamp_ns() >= scheduled_ns; });
+                RawMarketMessage msg = messages[i % messages.size()];
+                msg.sequence_number = i + 1;
+                msg.timestamp_exchange_ns = scheduled_ns;
+                seal(msg);
+                // A full ring delays the send but not the schedule: the wait is charged to the message
+                if (!ring->try_push(msg)) {
+                    ++producer_late;
+                    wait.wait([&] { return ring->try_push(msg); });
+                }
+            }
+            producer_done.store(true, std::memory_order_release);
+        });
+
+        Wait wait;
+        uint64_t received = 0;
+        RawMarketMessage msg;
+        while (received < total) {
+            bool drained = false;
+            wait.wait([&] {
+                if (ring->try_pop(msg)) return true;
+                drained = producer_done.load(std::memory_order_acquire) && ring->empty();
+                return drained;
+            });
+            if (drained) break;
+            pipeline->on_message(msg);
+            const uint64_t done_ns = hft::HFTTimer::get_timestamp_ns();
+            histogram->record_latency(done_ns > msg.timestamp_exchange_ns ? done_ns - msg.timestamp_exchange_ns : 0);
+            ++received;
+        }
+        const uint64_t end_ns = hft::HFTTimer::get_timestamp_ns();
+        producer.join();
+
+        state.SetIterationTime(static_cast<double>(end_ns - start_ns) / 1e9);
+        orders_sent = pipeline->orders_sent();
+        feed_rejects = pipeline->feed_rejects();
+    }
+
+    hft::HdrSnapshot<> snapshot;
+    histogram->snapshot_into(snapshot);
+    state.counters["OfferedRate"] = static_cast<double>(rate);
+    state.counters["Messages"] = static_cast<double>(snapshot.total_samples());
+    state.counters["P50_ns"] = static_cast<double>(snapshot.value_at_percentile(50.0));
+    state.counters["P99_ns"] = static_cast<double>(snapshot.value_at_percentile(99.0));
+    state.counters["P999_ns"] = static_cast<double>(snapshot.value_at_percentile(99.9));
+    state.counters["Max_ns"] = static_cast<double>(snapshot.max_latency());
+    state.counters["OrdersSent"] = static_cast<double>(orders_sent);
+    state.counters["FeedRejects"] = static_cast<double>(feed_rejects);
+    state.counters["ProducerBlocked"] = static_cast<double>(producer_late);
+    state.SetItemsProcessed(static_cast<int64_t>(total));
+    state.SetLabel("Open loop, latency from scheduled send");
+}
+
+BENCHMARK_TEMPLATE(BM_OfferedLoadLatency, hft::SpinWait)
+    ->Arg(100000)->Arg(250000)->Arg(500000)->Arg(1000000)
+    ->Iterations(1)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_OfferedLoadLatency, hft::SpinYieldWait<>)
+    ->Arg(100000)->Arg(250000)->Arg(500000)->Arg(1000000)
+    ->Iterations(1)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,8 +1,10 @@
 #include "hft/timing/hft_timer.hpp"
+#include "hft/timing/hdr_histogram.hpp"
 #include <benchmark/benchmark.h>
 #include <thread>
 #include <vector>
 #include <random>
+#include <memory>
 
 namespace hft {
 namespace benchmark {
@@ -108,6 +110,60 @@ static void BM_HistogramReset(::benchmark::State& state) {
 }
 BENCHMARK(BM_HistogramReset);
 
+static void BM_HdrRecordLatency(::benchmark::State& state) {
+    auto histogram = std::make_unique<HdrHistogram<>>();
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<HFTTimer::ns_t> dist(100, 10000);
+    
+    for (auto _ : state) {
+        histogram->record_latency(dist(gen));
+    }
+}
+BENCHMARK(BM_HdrRecordLatency);
+
+static void BM_HdrGetStats(::benchmark::State& state) {
+    auto histogram = std::make_unique<HdrHistogram<>>();
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<HFTTimer::ns_t> dist(100, 10000);
+    
+    for (int i = 0; i < 1000000; ++i) {
+        histogram->record_latency(dist(gen));
+    }
+    
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(histogram->get_stats());
+    }
+}
+BENCHMARK(BM_HdrGetStats);
+
+// Per-thread shards: compare with BM_ConcurrentRecording on the shared histogram
+static void BM_ShardedConcurrentRecording(::benchmark::State& state) {
+    auto histogram = std::make_unique<ShardedLatencyHistogram<>>();
+    const int num_threads = state.range(0);
+    
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_threads; ++i) {
+            threads.emplace_back([&histogram]() {
+                auto* shard = histogram->attach();
+                for (int j = 0; j < 1000; ++j) {
+                    const auto start = HFTTimer::get_cycles();
+                    const auto end = HFTTimer::get_cycles();
+                    shard->record_latency(HFTTimer::cycles_to_ns(end - start));
+                }
+                histogram->detach(shard);
+            });
+        }
+        
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+}
+BENCHMARK(BM_ShardedConcurrentRecording)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
 } // namespace benchmark
 } // namespace hft
 
@@ -1,6 +1,9 @@
 #include <benchmark/benchmark.h>
 #include <random>
+#include <memory>
+#include <vector>
 #include "hft/market_data/treasury_instruments.hpp"
+#include "hft/market_data/yield_tables.hpp"
 #include "hft/timing/hft_timer.hpp"
 
 using namespace hft::market_data;
@@ -82,4 +85,71 @@ static void BM_YieldCalculation_Throughput(benchmark::State& state) {
 }
 BENCHMARK(BM_YieldCalculation_Throughput);
 
+static void BM_YieldTables_PriceToYield(benchmark::State& state) {
+    auto tables = std::make_unique<YieldTables>();
+    tables->build_on_the_run(days_from_civil(2026, 10, 15));
+    const auto type = static_cast<TreasuryType>(state.range(0) % 6);
+
+    // Quoted prices for yields between 1% and 6%
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> yield_dist(0.01, 0.06);
+    std::vector<double> prices(1024);
+    for (auto& p : prices) p = Price32nd::from_decimal(tables->clean_price(type, yield_dist(rng))).to_decimal();
+
+    size_t i = 0;
+    for (auto _ : state) {
+        double yield = tables->price_to_yield(type, prices[i++ & 1023]);
+        benchmark::DoNotOptimize(yield);
+    }
+
+    state.SetLabel("Tabulated price to yield (Act/Act)");
+}
+BENCHMARK(BM_YieldTables_PriceToYield)->Arg(0)->Arg(1)->Arg(2)->Arg(3)->Arg(4)->Arg(5);
+
+static void BM_YieldTables_ExactYield(benchmark::State& state) {
+    auto tables = std::make_unique<YieldTables>();
+    tables->build_on_the_run(days_from_civil(2026, 10, 15));
+    const auto type = static_cast<TreasuryType>(state.range(0) % 6);
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> yield_dist(0.01, 0.06);
+    std::vector<double> prices(1024);
+    for (auto& p : prices) p = Price32nd::from_decimal(tables->clean_price(type, yield_dist(rng))).to_decimal();
+
+    size_t i = 0;
+    for (auto _ : state) {
+        double yield = tables->exact_yield(type, prices[i++ & 1023]);
+        benchmark::DoNotOptimize(yield);
+    }
+
+    state.SetLabel("Table-seeded Newton on full coupon schedule");
+}
+BENCHMARK(BM_YieldTables_ExactYield)->Arg(2)->Arg(5);
+
+static void BM_YieldTables_BatchCurve(benchmark::State& state) {
+    auto tables = std::make_unique<YieldTables>();
+    tables->build_on_the_run(days_from_civil(2026, 10, 15));
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    // Bid and ask across the whole curve, instruments interleaved as on the feed
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> yield_dist(0.01, 0.06);
+    std::vector<TreasuryType> types(n);
+    std::vector<double> prices(n), yields(n);
+    for (size_t i = 0; i < n; ++i) {
+        types[i] = static_cast<TreasuryType>(i % 6);
+        prices[i] = Price32nd::from_decimal(tables->clean_price(types[i], yield_dist(rng))).to_decimal();
+    }
+
+    for (auto _ : state) {
+        tables->price_to_yield(types.data(), prices.data(), yields.data(), n);
+        benchmark::DoNotOptimize(yields.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(n * state.iterations());
+    state.SetLabel("Batched mixed-instrument price to yield");
+}
+BENCHMARK(BM_YieldTables_BatchCurve)->Arg(12)->Arg(64)->Arg(1024);
+
 BENCHMARK_MAIN(); 
\ No newline at end of file
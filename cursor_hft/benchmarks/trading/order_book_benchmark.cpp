@@ -5,14 +5,18 @@
 #include <algorithm>
 #include "hft/trading/order_book.hpp"
 #include "hft/timing/hft_timer.hpp"
+#include "common/perf_counter_fixture.hpp"
 
 using namespace hft::trading;
 using namespace hft::market_data;
 
 // Global test fixtures for benchmarks
-class OrderBookBenchmarkFixture : public benchmark::Fixture {
+// Layout-sensitive benchmarks also report hardware counters per iteration (perf_)
+class OrderBookBenchmarkFixture : public hft::bench::PerfCounterFixture {
 public:
     void SetUp(const ::benchmark::State& state) override {
+        PerfCounterFixture::SetUp(state);
+        
         // Initialize object pools and ring buffer
         order_pool_ = std::make_unique<TreasuryOrderPool>();
         level_pool_ = std::make_unique<PriceLevelPool>();
@@ -34,6 +38,7 @@ public:
         order_book_->reset();
         order_pool_->reset();
         level_pool_->reset();
+        PerfCounterFixture::TearDown(state);
     }
 
 protected:
@@ -83,13 +88,16 @@ protected:
 BENCHMARK_F(OrderBookBenchmarkFixture, AddOrderLatency)(benchmark::State& state) {
     size_t order_idx = 0;
     
+    perf_->start();
     for (auto _ : state) {
         state.PauseTiming();
+        perf_->pause();
         if (order_idx >= test_orders_.size()) {
             reset_state();
             order_idx = 0;
         }
         const auto& order = test_orders_[order_idx++];
+        perf_->resume();
         state.ResumeTiming();
         
         // Measure single order addition (target: <200ns)
@@ -100,6 +108,7 @@ BENCHMARK_F(OrderBookBenchmarkFixture, AddOrderLatency)(benchmark::State& state)
         state.SetIterationTime(hft::HFTTimer::cycles_to_ns(end - start) / 1e9);
     }
     
+    perf_->report(state);
     state.SetLabel("Target: <200ns per order addition");
     state.counters["Orders"] = order_book_->get_stats().total_orders;
     state.counters["BidLevels"] = order_book_->get_stats().total_bid_levels;
@@ -117,8 +126,10 @@ BENCHMARK_F(OrderBookBenchmarkFixture, CancelOrderLatency)(benchmark::State& sta
     
     size_t cancel_idx = 0;
     
+    perf_->start();
     for (auto _ : state) {
         state.PauseTiming();
+        perf_->pause();
         if (cancel_idx >= order_ids.size()) {
             // Repopulate
             reset_state();
@@ -131,6 +142,7 @@ BENCHMARK_F(OrderBookBenchmarkFixture, CancelOrderLatency)(benchmark::State& sta
             cancel_idx = 0;
         }
         uint64_t order_id = order_ids[cancel_idx++];
+        perf_->resume();
         state.ResumeTiming();
         
         // Measure single order cancellation (target: <200ns)
@@ -141,6 +153,7 @@ BENCHMARK_F(OrderBookBenchmarkFixture, CancelOrderLatency)(benchmark::State& sta
         state.SetIterationTime(hft::HFTTimer::cycles_to_ns(end - start) / 1e9);
     }
     
+    perf_->report(state);
     state.SetLabel("Target: <200ns per order cancellation");
 }
 
@@ -150,6 +163,7 @@ BENCHMARK_F(OrderBookBenchmarkFixture, BestBidOfferLatency)(benchmark::State& st
         order_book_->add_order(test_orders_[i]);
     }
     
+    perf_->start();
     for (auto _ : state) {
         // Measure best bid/offer lookup (target: <50ns)
         auto start = hft::HFTTimer::get_cycles();
@@ -160,6 +174,7 @@ BENCHMARK_F(OrderBookBenchmarkFixture, BestBidOfferLatency)(benchmark::State& st
         state.SetIterationTime(hft::HFTTimer::cycles_to_ns(end - start) / 1e9);
     }
     
+    perf_->report(state);
     state.SetLabel("Target: <50ns per best bid/offer lookup");
 }
 
@@ -236,6 +251,59 @@ BENCHMARK_F(OrderBookBenchmarkFixture, ProcessTradeLatency)(benchmark::State& st
     state.SetLabel("Target: <500ns per trade processing");
 }
 
+BENCHMARK_F(OrderBookBenchmarkFixture, MatchOrderLatency)(benchmark::State& state) {
+    // Resting ask ladder: 20 levels x 5 orders; each aggressor sweeps 3 levels
+    constexpr int LEVELS = 20;
+    constexpr int ORDERS_PER_LEVEL = 5;
+    constexpr uint64_t RESTING_QTY = 1000000;
+    auto refill = [&]() -> bool {
+        for (int l = 0; l < LEVELS; ++l) {
+            const double price = 100.0 + l / 32.0;
+            const auto resting = order_book_->get_market_depth(OrderSide::ASK, LEVELS);
+            size_t have = 0;
+            for (const auto& d : resting) {
+                if (d.price.to_decimal() == price) have = d.order_count;
+            }
+            for (size_t o = have; o < ORDERS_PER_LEVEL; ++o) {
+                if (!order_book_->add_order(create_test_order(OrderSide::ASK, price, RESTING_QTY))) return false;
+            }
+        }
+        return true;
+    };
+    if (!refill()) {
+        state.SkipWithError("cannot build the resting ladder");
+        return;
+    }
+    
+    uint64_t trades = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (!refill()) {
+            state.ResumeTiming();
+            state.SkipWithError("cannot refill the resting ladder");
+            break;
+        }
+        OrderBookUpdate drained;
+        while (update_buffer_->try_pop(drained)) {}
+        const auto aggressor = create_test_order(OrderSide::BID, 100.0625, 3 * ORDERS_PER_LEVEL * RESTING_QTY);
+        state.ResumeTiming();
+        
+        auto start = hft::HFTTimer::get_cycles();
+        auto result = order_book_->match_order(aggressor);
+        auto end = hft::HFTTimer::get_cycles();
+        benchmark::DoNotOptimize(result);
+        trades += result.trade_count;
+        
+        state.SetIterationTime(hft::HFTTimer::cycles_to_ns(end - start) / 1e9);
+    }
+    
+    state.counters["TradesPerMatch"] = benchmark::Counter(
+        static_cast<double>(trades), benchmark::Counter::kAvgIterations);
+    state.counters["MatchesPerSecond"] = benchmark::Counter(
+        static_cast<double>(trades), benchmark::Counter::kIsRate);
+    state.SetLabel("15-order sweep across 3 levels with trade emission");
+}
+
 // Throughput benchmarks
 BENCHMARK_F(OrderBookBenchmarkFixture, OrderAdditionThroughput)(benchmark::State& state) {
     size_t order_idx = 0;
@@ -266,6 +334,7 @@ BENCHMARK_F(OrderBookBenchmarkFixture, MixedOperationsThroughput)(benchmark::Sta
     size_t operations = 0;
     size_t order_idx = 0;
     
+    perf_->start();
     for (auto _ : state) {
         int operation = operation_dist(gen);
         
@@ -307,6 +376,7 @@ BENCHMARK_F(OrderBookBenchmarkFixture, MixedOperationsThroughput)(benchmark::Sta
     
     state.counters["OperationsPerSecond"] = benchmark::Counter(
         operations, benchmark::Counter::kIsRate);
+    perf_->report(state);
     state.SetLabel("Mixed operations throughput");
 }
 
@@ -335,6 +405,56 @@ BENCHMARK_F(OrderBookBenchmarkFixture, MarketDepthRetrieval)(benchmark::State& s
     state.SetLabel("Market depth retrieval (10 levels each side)");
 }
 
+BENCHMARK_F(OrderBookBenchmarkFixture, MarketDepthIntoArray)(benchmark::State& state) {
+    // Same deep book as MarketDepthRetrieval, written into caller-owned arrays
+    for (int i = 0; i < 50; ++i) {
+        if (!order_book_->add_order(create_test_order(OrderSide::BID, 99.0 - i * 0.03125, 1000000)) ||
+            !order_book_->add_order(create_test_order(OrderSide::ASK, 100.0 + i * 0.03125, 1000000))) {
+            state.SkipWithError("book setup failed");
+            return;
+        }
+    }
+    
+    std::array<TreasuryOrderBook::MarketDepth, 10> bids;
+    std::array<TreasuryOrderBook::MarketDepth, 10> asks;
+    
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(order_book_->get_market_depth(OrderSide::BID, bids));
+        benchmark::DoNotOptimize(order_book_->get_market_depth(OrderSide::ASK, asks));
+        benchmark::ClobberMemory();
+    }
+    
+    state.SetLabel("Market depth into std::array (10 levels each side, no allocation)");
+}
+
+BENCHMARK_F(OrderBookBenchmarkFixture, IncrementalDepthDrain)(benchmark::State& state) {
+    // Mirror maintenance: one add + one cancel per tick, then drain the journal
+    for (int i = 0; i < 50; ++i) {
+        if (!order_book_->add_order(create_test_order(OrderSide::BID, 99.0 - i * 0.03125, 1000000)) ||
+            !order_book_->add_order(create_test_order(OrderSide::ASK, 100.0 + i * 0.03125, 1000000))) {
+            state.SkipWithError("book setup failed");
+            return;
+        }
+    }
+    order_book_->set_depth_tracking(true);
+    
+    std::array<TreasuryOrderBook::DepthChange, 64> changes;
+    size_t total_changes = 0;
+    
+    for (auto _ : state) {
+        const auto order = create_test_order(OrderSide::BID, 98.5, 1000000);
+        benchmark::DoNotOptimize(order_book_->add_order(order));
+        benchmark::DoNotOptimize(order_book_->cancel_order(order.order_id));
+        auto delta = order_book_->drain_depth_changes(changes);
+        total_changes += delta.count;
+        benchmark::DoNotOptimize(delta);
+    }
+    
+    state.counters["ChangesPerDrain"] = benchmark::Counter(
+        static_cast<double>(total_changes), benchmark::Counter::kAvgIterations);
+    state.SetLabel("Add+cancel plus incremental depth drain");
+}
+
 BENCHMARK_F(OrderBookBenchmarkFixture, ObjectPoolEfficiency)(benchmark::State& state) {
     size_t pool_acquisitions = 0;
     
@@ -509,6 +629,9 @@ BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, ModifyOrderLatency)
 BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, ProcessTradeLatency)
     ->UseManualTime()->Iterations(5000)->Unit(benchmark::kNanosecond);
     
+BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, MatchOrderLatency)
+    ->UseManualTime()->Iterations(5000)->Unit(benchmark::kNanosecond);
+    
 BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, OrderAdditionThroughput)
     ->Iterations(50000);
     
@@ -518,6 +641,12 @@ BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, MixedOperationsThroughput)
 BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, MarketDepthRetrieval)
     ->Iterations(10000);
     
+BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, MarketDepthIntoArray)
+    ->Iterations(10000);
+    
+BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, IncrementalDepthDrain)
+    ->Iterations(10000);
+    
 BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, ObjectPoolEfficiency)
     ->UseManualTime()->Iterations(1000)->Unit(benchmark::kNanosecond);
     
@@ -530,4 +659,136 @@ BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, LatencyDistributionAnalysis)
 BENCHMARK_REGISTER_F(OrderBookBenchmarkFixture, HighLoadSustainedOperations)
     ->Iterations(100);
 
+// Deep-book benchmarks: list-walk vs ladder-indexed level lookup, with the
+// cache and TLB misses behind the difference
+template<typename BookType>
+class DeepBookBenchmarkFixture : public hft::bench::PerfCounterFixture {
+public:
+    using LevelPool = hft::ObjectPool<typename BookType::PriceLevel, 1024, false>;
+
+    void SetUp(const ::benchmark::State& state) override {
+        hft::bench::PerfCounterFixture::SetUp(state);
+        order_pool_ = std::make_unique<TreasuryOrderPool>();
+        level_pool_ = std::make_unique<LevelPool>();
+        update_buffer_ = std::make_unique<OrderBookUpdateBuffer>();
+        order_book_ = std::make_unique<BookType>(*order_pool_, *level_pool_, *update_buffer_);
+        next_order_id_ = 1;
+    }
+
+    void TearDown(const ::benchmark::State& state) override {
+        order_book_->reset();
+        order_pool_->reset();
+        level_pool_->reset();
+        hft::bench::PerfCounterFixture::TearDown(state);
+    }
+
+protected:
+    // Populate `levels` resting levels per side, one 1/64 tick apart
+    void build_deep_book(size_t levels) {
+        for (size_t i = 0; i < levels; ++i) {
+            add(OrderSide::BID, 99.0 - static_cast<double>(i) / 64.0);
+            add(OrderSide::ASK, 100.0 + static_cast<double>(i) / 64.0);
+        }
+    }
+
+    // Add then cancel a passive order in the deepest quartile: the list book
+    // walks most of the levels, the ladder goes straight to the slot.
+    void run_add_cancel(benchmark::State& state) {
+        const size_t levels = static_cast<size_t>(state.range(0));
+        build_deep_book(levels);
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<size_t> depth_dist(levels * 3 / 4, levels - 1);
+        
+        perf_->start();
+        for (auto _ : state) {
+            state.PauseTiming();
+            perf_->pause();
+            const double price = 99.0 - static_cast<double>(depth_dist(gen)) / 64.0;
+            perf_->resume();
+            state.ResumeTiming();
+            
+            auto start = hft::HFTTimer::get_cycles();
+            const uint64_t id = add(OrderSide::BID, price);
+            benchmark::DoNotOptimize(order_book_->cancel_order(id));
+            auto end = hft::HFTTimer::get_cycles();
+            
+            state.SetIterationTime(hft::HFTTimer::cycles_to_ns(end - start) / 1e9);
+        }
+        
+        perf_->report(state);
+        state.counters["Levels"] = static_cast<double>(levels);
+        state.SetLabel("Deep-book passive add+cancel");
+    }
+    
+    // Create and remove a brand new level between two existing ticks
+    // (half-32nd offset), exercising sorted insertion and level removal.
+    void run_new_level(benchmark::State& state) {
+        const size_t levels = static_cast<size_t>(state.range(0));
+        build_deep_book(levels);
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<size_t> depth_dist(levels / 2, levels - 1);
+        
+        perf_->start();
+        for (auto _ : state) {
+            state.PauseTiming();
+            perf_->pause();
+            const double price = 100.0 + (static_cast<double>(depth_dist(gen)) + 0.5) / 64.0;
+            perf_->resume();
+            state.ResumeTiming();
+            
+            auto start = hft::HFTTimer::get_cycles();
+            const uint64_t id = add(OrderSide::ASK, price);
+            benchmark::DoNotOptimize(order_book_->cancel_order(id));
+            auto end = hft::HFTTimer::get_cycles();
+            
+            state.SetIterationTime(hft::HFTTimer::cycles_to_ns(end - start) / 1e9);
+        }
+        
+        perf_->report(state);
+        state.counters["Levels"] = static_cast<double>(levels);
+        state.SetLabel("Deep-book level insert+remove");
+    }
+
+    uint64_t add(OrderSide side, double price) {
+        const uint64_t id = next_order_id_++;
+        TreasuryOrder order(id, TreasuryType::Note_10Y, side, OrderType::LIMIT,
+                            Price32nd::from_decimal(price), 1000000, id);
+        return order_book_->add_order(order) ? id : 0;
+    }
+
+    std::unique_ptr<TreasuryOrderPool> order_pool_;
+    std::unique_ptr<LevelPool> level_pool_;
+    std::unique_ptr<OrderBookUpdateBuffer> update_buffer_;
+    std::unique_ptr<BookType> order_book_;
+    uint64_t next_order_id_;
+};
+
+BENCHMARK_TEMPLATE_DEFINE_F(DeepBookBenchmarkFixture, DeepBookAddCancelList, TreasuryOrderBook)(benchmark::State& state) {
+    run_add_cancel(state);
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(DeepBookBenchmarkFixture, DeepBookAddCancelLadder, TreasuryLadderOrderBook)(benchmark::State& state) {
+    run_add_cancel(state);
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(DeepBookBenchmarkFixture, DeepBookNewLevelList, TreasuryOrderBook)(benchmark::State& state) {
+    run_new_level(state);
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(DeepBookBenchmarkFixture, DeepBookNewLevelLadder, TreasuryLadderOrderBook)(benchmark::State& state) {
+    run_new_level(state);
+}
+
+BENCHMARK_REGISTER_F(DeepBookBenchmarkFixture, DeepBookAddCancelList)
+    ->UseManualTime()->Iterations(10000)->Unit(benchmark::kNanosecond)->Arg(10)->Arg(50)->Arg(200)->Arg(500);
+
+BENCHMARK_REGISTER_F(DeepBookBenchmarkFixture, DeepBookAddCancelLadder)
+    ->UseManualTime()->Iterations(10000)->Unit(benchmark::kNanosecond)->Arg(10)->Arg(50)->Arg(200)->Arg(500);
+
+BENCHMARK_REGISTER_F(DeepBookBenchmarkFixture, DeepBookNewLevelList)
+    ->UseManualTime()->Iterations(10000)->Unit(benchmark::kNanosecond)->Arg(10)->Arg(50)->Arg(200)->Arg(500);
+
+BENCHMARK_REGISTER_F(DeepBookBenchmarkFixture, DeepBookNewLevelLadder)
+    ->UseManualTime()->Iterations(10000)->Unit(benchmark::kNanosecond)->Arg(10)->Arg(50)->Arg(200)->Arg(500);
+
 BENCHMARK_MAIN();
\ No newline at end of file
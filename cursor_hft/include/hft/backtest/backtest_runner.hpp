@@ -0,0 +1,552 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "hft/timing/hft_timer.hpp"
+#include "hft/timing/hdr_histogram.hpp"
+#include "hft/runtime/work_stealing_pool.hpp"
+#include "hft/trading/order_book.hpp"
+#include "hft/trading/risk_control_system.hpp"
+// Strategy headers before venue_simulation.hpp: they name trading::TreasuryOrder unqualified
+#include "hft/strategy/advanced_market_maker.hpp"
+#include "hft/strategy/multi_strategy_manager.hpp"
+#include "hft/strategy/strategy_coordinator.hpp"
+#include "hft/market_data/market_data_capture.hpp"
+#include "hft/market_data/feed_handler.hpp"
+#include "hft/market_data/venue_simulation.hpp"
+#include "hft/config/system_traits.hpp"
+
+namespace hft {
+namespace backtest {
+
+using market_data::TreasuryType;
+using market_data::Price32nd;
+using strategy::AdvancedMarketMaker;
+using strategy::SimpleMarketMaker;
+
+constexpr size_t INSTRUMENT_COUNT = config::SystemTraits::MAX_INSTRUMENTS;
+constexpr uint32_t ALL_INSTRUMENTS = (1u << INSTRUMENT_COUNT) - 1;
+
+// ========================= 1. Strategy Adapter =========================
+
+/**
+ * @brief AdvancedMarketMaker in the form StrategyCoordinator hosts
+ *
+ * The coordinator feeds top-of-book SimpleMarketMaker updates and expects
+ * SimpleMarketMaker decisions; run_strategy() does the translation, as it
+ * does for MultiStrategyManager. Aggressive and rebalance decisions
+ * surface as NO_ACTION.
+ */
+class BacktestMarketMaker {
+public:
+    BacktestMarketMaker(trading::TreasuryOrderPool& order_pool, trading::TreasuryOrderBook& order_book) noexcept
+        : strategy_(order_pool, order_book) {}
+
+    BacktestMarketMaker(const BacktestMarketMaker&) = delete;
+    BacktestMarketMaker& operator=(const BacktestMarketMaker&) = delete;
+
+    [[nodiscard]] SimpleMarketMaker::TradingDecision make_decision(const SimpleMarketMaker::MarketUpdate& update) noexcept {
+        const strategy::StrategyQuote quote = strategy::run_strategy(strategy_, update);
+        SimpleMarketMaker::TradingDecision decision;
+        decision.instrument = quote.instrument;
+        decision.trace_id = update.trace_id;
+        switch (quote.action) {
+            case strategy::StrategyQuote::Action::UPDATE_QUOTES:
+                decision.action = SimpleMarketMaker::TradingDecision::Action::UPDATE_QUOTES;
+                decision.bid_price = quote.bid_price;
+                decision.ask_price = quote.ask_price;
+                decision.bid_size = quote.bid_size;
+                decision.ask_size = quote.ask_size;
+                break;
+            case strategy::StrategyQuote::Action::CANCEL_QUOTES:
+                decision.action = SimpleMarketMaker::TradingDecision::Action::CANCEL_QUOTES;
+                break;
+            default:
+                break;
+        }
+        return decision;
+    }
+
+    [[nodiscard]] int64_t get_position(TreasuryType instrument) const noexcept { return strategy_.get_position(instrument); }
+    [[nodiscard]] double get_unrealized_pnl(TreasuryType instrument) const noexcept { return strategy_.get_unrealized_pnl(instrument); }
+    [[nodiscard]] double get_daily_pnl(TreasuryType instrument) const noexcept { return strategy_.get_daily_pnl(instrument); }
+    [[nodiscard]] uint32_t get_risk_score(TreasuryType instrument) const noexcept { return strategy_.get_risk_score(instrument); }
+
+    [[nodiscard]] AdvancedMarketMaker& advanced() noexcept { return strategy_; }
+
+private:
+    AdvancedMarketMaker strategy_;
+};
+
+// ========================= 2. Configuration and Results =========================
+
+/**
+ * @brief Backtest inputs shared by every shard
+ */
+struct BacktestConfig {
+    std::vector<std::string> days;                                  // Capture base path per trading day
+    std::vector<AdvancedMarketMaker::SpreadParameters> parameter_grid{AdvancedMarketMaker::SpreadParameters{}};
+    bool shard_by_instrument = false;                               // One shard per (day, instrument) instead of per day
+    size_t venues = 2;                                              // Simulated venues per shard (instruments spread over them)
+    market_data::VenueLatencyModel latency{50'000, 10'000, 100'000, 0.1};
+    trading::RiskControlSystem::RiskLimits risk_limits = default_risk_limits();
+    uint64_t seed = 1;
+
+    /**
+     * @brief Production limits, except the order rate limit
+     *
+     * RiskControlSystem meters order rates on the wall clock, which a
+     * backtest runs through many times faster than the recorded session.
+     */
+    [[nodiscard]] static trading::RiskControlSystem::RiskLimits default_risk_limits() noexcept {
+        trading::RiskControlSystem::RiskLimits limits;
+        limits.max_orders_per_second = UINT32_MAX;
+        limits.max_cancels_per_minute = UINT32_MAX;
+        return limits;
+    }
+};
+
+/**
+ * @brief One unit of work: a day, a parameter set and the instruments to trade
+ */
+struct ShardSpec {
+    uint32_t day = 0;                                   // Index into BacktestConfig::days
+    uint32_t params = 0;                                // Index into BacktestConfig::parameter_grid
+    uint32_t instrument_mask = ALL_INSTRUMENTS;         // Bit per TreasuryType
+};
+
+/**
+ * @brief P&L, fill and latency totals; merge() combines shards
+ */
+struct BacktestStats {
+    double cash = 0.0;                                  // Realized cash flow (face * price / 100)
+    double pnl = 0.0;                                   // Cash plus positions marked at the last mid
+    std::array<int64_t, INSTRUMENT_COUNT> positions{};  // Closing positions (face)
+    uint64_t ticks = 0;
+    uint64_t unknown_instrument_ticks = 0;              // Instrument outside this build's universe
+    uint64_t trades = 0;
+    uint64_t orders_submitted = 0;
+    uint64_t risk_rejects = 0;                          // Refused by RiskControlSystem pre-trade
+    uint64_t venue_rejects = 0;                         // Orders the venue refused
+    uint64_t cancels = 0;
+    uint64_t fills = 0;
+    uint64_t filled_quantity = 0;
+    HdrSnapshot<> ack_latency;                          // Simulated submit-to-acknowledgement (ns)
+    HdrSnapshot<> decision_latency;                     // Wall-clock strategy decision time (ns)
+
+    void merge(const BacktestStats& other) noexcept {
+        cash += other.cash;
+        pnl += other.pnl;
+        for (size_t i = 0; i < INSTRUMENT_COUNT; ++i) positions[i] += other.positions[i];
+        ticks += other.ticks;
+        unknown_instrument_ticks += other.unknown_instrument_ticks;
+        trades += other.trades;
+        orders_submitted += other.orders_submitted;
+        risk_rejects += other.risk_rejects;
+        venue_rejects += other.venue_rejects;
+        cancels += other.cancels;
+        fills += other.fills;
+        filled_quantity += other.filled_quantity;
+        ack_latency.merge(other.ack_latency);
+        decision_latency.merge(other.decision_latency);
+    }
+};
+
+struct ShardResult {
+    ShardSpec spec;
+    bool completed = false;                             // false if the day's capture could not be opened
+    HFTTimer::ns_t wall_ns = 0;
+    BacktestStats stats;
+};
+
+struct BacktestReport {
+    std::vector<ShardResult> shards;                    // In shard order (see BacktestRunner::shards())
+    std::vector<BacktestStats> by_params;               // Merged per parameter_grid entry
+    BacktestStats total;
+    size_t failed_shards = 0;
+    size_t lanes = 0;
+    uint64_t steals = 0;
+    HFTTimer::ns_t wall_ns = 0;
+};
+
+// ========================= 3. Backtest Session =========================
+
+/**
+ * @brief One shard end to end, on simulated time
+ *
+ * Replays a day's capture through its own TreasuryFeedHandler into a
+ * VenueSimulation. Each tick goes to StrategyCoordinator (one
+ * AdvancedMarketMaker with the shard's spread parameters); quote changes
+ * pass RiskControlSystem pre-trade checks and become cancel/replace on the
+ * instrument's venue, which fills them on queue position against the
+ * replayed trades. Fills update risk, the strategy's inventory and the
+ * shard's P&L.
+ *
+ * Capture messages are replayed in chunks, and the simulation is run up
+ * to the newest market data timestamp after each, so venue responses
+ * interleave with market data at their modelled times.
+ *
+ * Nothing is shared with other sessions except the read-only capture
+ * mapping, so sessions run on any thread. A shard's results depend only
+ * on its inputs and seeds (decision latency aside, which is measured).
+ */
+class BacktestSession {
+public:
+    static constexpr size_t REPLAY_CHUNK = 4096;        // Messages per replay step (< feed handler buffers)
+
+    BacktestSession(const BacktestConfig& config, const ShardSpec& spec)
+        : spec_(spec),
+          order_pool_(std::make_unique<trading::TreasuryOrderPool>()),
+          level_pool_(std::make_unique<trading::PriceLevelPool>()),
+          update_buffer_(std::make_unique<trading::OrderBookUpdateBuffer>()),
+          order_book_(std::make_unique<trading::TreasuryOrderBook>(*order_pool_, *level_pool_, *update_buffer_)),
+          coordinator_(std::make_unique<Coordinator>(*order_pool_, *level_pool_, *update_buffer_, *order_book_)),
+          risk_(std::make_unique<trading::RiskControlSystem>(config.risk_limits)),
+          feed_(std::make_unique<market_data::TreasuryFeedHandler>()),
+          sim_(std::make_unique<market_data::VenueSimulation>()),
+          ack_latency_(std::make_unique<HdrHistogram<>>()),
+          decision_latency_(std::make_unique<HdrHistogram<>>()),
+          quotes_{}, last_mid_{}, next_order_seq_(1), stats_{} {
+        coordinator_->get_strategy<0>().advanced().set_spread_parameters(config.parameter_grid[spec.params]);
+
+        // Same latency draws for every parameter set on a day: sweep points differ only by the strategy
+        const size_t venue_count = std::clamp<size_t>(config.venues, 1, market_data::VenueSimulation::MAX_VENUES);
+        for (size_t v = 0; v < venue_count; ++v) {
+            char name[16];
+            std::snprintf(name, sizeof(name), "BT%zu", v);
+            const uint64_t seed = config.seed * 0x9E3779B97F4A7C15ULL ^ (uint64_t{spec.day} << 32) ^
+                                  (uint64_t{spec.instrument_mask} << 8) ^ v;
+            venues_.push_back(std::make_unique<market_data::PrimaryDealerVenue>(name, config.latency, seed | 1));
+            (void)sim_->add_venue(*venues_.back());
+        }
+    }
+
+    BacktestSession(const BacktestSession&) = delete;
+    BacktestSession& operator=(const BacktestSession&) = delete;
+
+    /**
+     * @brief Replay the whole capture and return the shard's results
+     */
+    [[nodiscard]] ShardResult run(const market_data::CaptureReader& capture) noexcept {
+        const HFTTimer::ns_t start = HFTTimer::get_timestamp_ns();
+        const auto on_tick = [this](const market_data::TreasuryTick& tick) { handle_tick(tick); };
+        const auto on_response = [this](size_t, const market_data::VenueResponse& r) { handle_response(r); };
+
+        market_data::CaptureReplayer replayer(capture);
+        market_data::TreasuryTick ticks[256];
+        market_data::TreasuryTrade trades[256];
+        uint64_t horizon = 0;
+        while (!replayer.done()) {
+            (void)replayer.replay(*feed_, REPLAY_CHUNK);
+            size_t n;
+            while ((n = feed_->get_parsed_ticks(ticks, 256)) > 0) {
+                for (size_t i = 0; i < n; ++i) {
+                    if (!trades_instrument(ticks[i].instrument_type)) continue;
+                    horizon = std::max<uint64_t>(horizon, ticks[i].timestamp_ns);
+                    (void)sim_->schedule_market_data(ticks[i]);
+                }
+            }
+            while ((n = feed_->get_parsed_trades(trades, 256)) > 0) {
+                for (size_t i = 0; i < n; ++i) {
+                    if (!trades_instrument(trades[i].instrument_type)) continue;
+                    horizon = std::max<uint64_t>(horizon, trades[i].timestamp_ns);
+                    ++stats_.trades;
+                    (void)sim_->schedule_trade(trades[i]);
+                }
+            }
+            (void)sim_->run_until(horizon, on_tick, on_response);
+        }
+        (void)sim_->run(on_tick, on_response);
+
+        ShardResult result;
+        result.spec = spec_;
+        result.completed = true;
+        result.stats = stats_;
+        result.stats.pnl = stats_.cash;
+        for (size_t i = 0; i < INSTRUMENT_COUNT; ++i) {
+            result.stats.pnl += static_cast<double>(stats_.positions[i]) * last_mid_[i] / 100.0;
+        }
+        ack_latency_->snapshot_into(result.stats.ack_latency);
+        decision_latency_->snapshot_into(result.stats.decision_latency);
+        result.wall_ns = HFTTimer::get_timestamp_ns() - start;
+        return result;
+    }
+
+private:
+    using Coordinator = strategy::StrategyCoordinator<BacktestMarketMaker>;
+
+    enum class QuoteState : uint8_t { Idle, Pending, Live };
+
+    // Working order for one instrument and side
+    struct WorkingQuote {
+        uint64_t order_id = 0;
+        uint64_t submit_ns = 0;
+        Price32nd price{};
+        QuoteState state = QuoteState::Idle;
+        bool cancel_on_ack = false;     // Pulled while pending; cancel once the venue has it
+    };
+
+    // Order IDs carry their quote slot (instrument * 2 + side) in the low bits
+    static constexpr uint64_t SLOT_BITS = 4;
+
+    [[nodiscard]] bool trades_instrument(TreasuryType instrument) const noexcept {
+        return (spec_.instrument_mask >> static_cast<uint32_t>(instrument)) & 1u;
+    }
+
+    [[nodiscard]] market_data::PrimaryDealerVenue& venue_for(TreasuryType instrument) noexcept {
+        return *venues_[static_cast<size_t>(instrument) % venues_.size()];
+    }
+
+    void handle_tick(const market_data::TreasuryTick& tick) noexcept {
+        ++stats_.ticks;
+        const size_t index = static_cast<size_t>(tick.instrument_type);
+        if (__builtin_expect(index >= INSTRUMENT_COUNT, 0)) {
+            ++stats_.unknown_instrument_ticks;
+            return;
+        }
+        const double mid = (tick.bid_price.to_decimal() + tick.ask_price.to_decimal()) / 2.0;
+        last_mid_[index] = mid;
+        risk_->update_market_price(tick.instrument_type, Price32nd::from_decimal(mid));
+
+        SimpleMarketMaker::MarketUpdate update(tick.instrument_type, tick.bid_price, tick.ask_price,
+                                               tick.bid_size, tick.ask_size);
+        update.update_time_ns = tick.timestamp_ns;
+        const auto results = coordinator_->coordinate_strategies(update);
+        const auto& result = results[0];
+        decision_latency_->record_latency(result.execution_time_ns);
+
+        switch (result.action) {
+            case Coordinator::StrategyResult::Action::UPDATE_QUOTES:
+                requote(tick.instrument_type, market_data::OrderSide::Buy, result.bid_price, result.bid_size);
+                requote(tick.instrument_type, market_data::OrderSide::Sell, result.ask_price, result.ask_size);
+                break;
+            case Coordinator::StrategyResult::Action::CANCEL_QUOTES:
+            case Coordinator::StrategyResult::Action::RISK_LIMIT_HIT:
+                pull(slot_of(tick.instrument_type, market_data::OrderSide::Buy));
+                pull(slot_of(tick.instrument_type, market_data::OrderSide::Sell));
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Instrument already checked against INSTRUMENT_COUNT by handle_tick()
+    [[nodiscard]] static size_t slot_of(TreasuryType instrument, market_data::OrderSide side) noexcept {
+        return static_cast<size_t>(instrument) * 2 + (side == market_data::OrderSide::Sell ? 1 : 0);
+    }
+
+    // Cancel the working order; its fills until the cancel lands still count
+    void pull(size_t slot) noexcept {
+        WorkingQuote& quote = quotes_[slot];
+        if (quote.state == QuoteState::Pending) {
+            quote.cancel_on_ack = true;  // The venue has no order to cancel yet
+            return;
+        }
+        if (quote.state != QuoteState::Live) return;
+        const auto instrument = static_cast<TreasuryType>(slot / 2);
+        if (venue_for(instrument).cancel_order(quote.order_id)) {
+            ++stats_.cancels;
+            risk_->record_order_activity(true);
+        }
+        quote.state = QuoteState::Idle;
+    }
+
+    void requote(TreasuryType instrument, market_data::OrderSide side, Price32nd price, uint64_t size) noexcept {
+        const size_t slot = slot_of(instrument, side);
+        WorkingQuote& quote = quotes_[slot];
+        if (size == 0) {
+            pull(slot);
+            return;
+        }
+        if (quote.state == QuoteState::Pending) return;  // Replace once the venue has it
+        if (quote.state == QuoteState::Live && quote.price.whole == price.whole &&
+            quote.price.thirty_seconds == price.thirty_seconds && quote.price.half_32nds == price.half_32nds) {
+            return;
+        }
+        pull(slot);
+
+        const trading::OrderSide risk_side = side == market_data::OrderSide::Buy ? trading::OrderSide::BID
+                                                                                : trading::OrderSide::ASK;
+        if (!risk_->check_order_risk(instrument, risk_side, size, price)) {
+            ++stats_.risk_rejects;
+            return;
+        }
+
+        market_data::TreasuryOrder order{};
+        order.order_id = next_order_seq_++ << SLOT_BITS | slot;
+        order.instrument_type = instrument;
+        order.order_type = market_data::OrderType::Limit;
+        order.side = side;
+        order.limit_price = price;
+        order.quantity = size;
+        order.timestamp_created_ns = sim_->now_ns();
+        if (!venue_for(instrument).submit_order(order)) return;
+        risk_->record_order_activity();
+        ++stats_.orders_submitted;
+        quote = WorkingQuote{order.order_id, sim_->now_ns(), price, QuoteState::Pending};
+    }
+
+    void handle_response(const market_data::VenueResponse& response) noexcept {
+        const size_t slot = response.order_id & ((uint64_t{1} << SLOT_BITS) - 1);
+        if (slot >= quotes_.size()) return;
+        WorkingQuote& quote = quotes_[slot];
+        const bool current = quote.order_id == response.order_id;
+
+        switch (response.new_status) {
+            case market_data::OrderStatus::Acknowledged:
+                if (current) {
+                    ack_latency_->record_latency(response.timestamp_venue_ns - quote.submit_ns);
+                    quote.state = QuoteState::Live;
+                    if (quote.cancel_on_ack) {
+                        quote.cancel_on_ack = false;
+                        pull(slot);
+                    }
+                }
+                break;
+            case market_data::OrderStatus::PartiallyFilled:
+            case market_data::OrderStatus::Filled:
+                apply_fill(slot, response.fill_quantity, response.fill_price);
+                if (current && response.new_status == market_data::OrderStatus::Filled) quote.state = QuoteState::Idle;
+                break;
+            case market_data::OrderStatus::Rejected:
+                // A refused cancel (filled first) also arrives as a reject; only a pending order can be refused
+                if (current && quote.state == QuoteState::Pending) {
+                    ++stats_.venue_rejects;
+                    quote.state = QuoteState::Idle;
+                }
+                break;
+            case market_data::OrderStatus::Cancelled:
+            case market_data::OrderStatus::Expired:
+                if (current) quote.state = QuoteState::Idle;
+                break;
+            default:
+                break;
+        }
+    }
+
+    void apply_fill(size_t slot, uint64_t quantity, Price32nd price) noexcept {
+        const auto instrument = static_cast<TreasuryType>(slot / 2);
+        const int64_t signed_quantity = (slot & 1) ? -static_cast<int64_t>(quantity) : static_cast<int64_t>(quantity);
+        ++stats_.fills;
+        stats_.filled_quantity += quantity;
+        stats_.cash -= static_cast<double>(signed_quantity) * price.to_decimal() / 100.0;
+        stats_.positions[slot / 2] += signed_quantity;
+        risk_->update_position(instrument, signed_quantity, price);
+        coordinator_->get_strategy<0>().advanced().update_position(instrument, signed_quantity);
+    }
+
+    ShardSpec spec_;
+    std::unique_ptr<trading::TreasuryOrderPool> order_pool_;
+    std::unique_ptr<trading::PriceLevelPool> level_pool_;
+    std::unique_ptr<trading::OrderBookUpdateBuffer> update_buffer_;
+    std::unique_ptr<trading::TreasuryOrderBook> order_book_;
+    std::unique_ptr<Coordinator> coordinator_;
+    std::unique_ptr<trading::RiskControlSystem> risk_;
+    std::unique_ptr<market_data::TreasuryFeedHandler> feed_;
+    std::vector<std::unique_ptr<market_data::PrimaryDealerVenue>> venues_;
+    std::unique_ptr<market_data::VenueSimulation> sim_;
+    std::unique_ptr<HdrHistogram<>> ack_latency_;
+    std::unique_ptr<HdrHistogram<>> decision_latency_;
+    std::array<WorkingQuote, INSTRUMENT_COUNT * 2> quotes_;
+    std::array<double, INSTRUMENT_COUNT> last_mid_;
+    uint64_t next_order_seq_;
+    BacktestStats stats_;
+};
+
+// ========================= 4. Parallel Runner =========================
+
+/**
+ * @brief Shards a multi-day backtest or parameter sweep across a WorkStealingPool
+ *
+ * Shards are every (day, parameter set, instrument group) combination,
+ * numbered day-major so shards running at the same time mostly read the
+ * same capture pages. Each capture is mapped once and shared read-only;
+ * everything else is per shard (see BacktestSession), so shards scale
+ * with cores and the results do not depend on how they were scheduled.
+ * Results are merged per parameter set and overall once every shard is done.
+ */
+class BacktestRunner {
+public:
+    explicit BacktestRunner(BacktestConfig config) : config_(std::move(config)) {
+        if (config_.parameter_grid.empty()) {
+            config_.parameter_grid.emplace_back();
+        }
+    }
+
+    /**
+     * @brief Shards in run order
+     */
+    [[nodiscard]] std::vector<ShardSpec> shards() const {
+        std::vector<ShardSpec> specs;
+        const uint32_t groups = config_.shard_by_instrument ? INSTRUMENT_COUNT : 1;
+        specs.reserve(config_.days.size() * config_.parameter_grid.size() * groups);
+        for (uint32_t day = 0; day < config_.days.size(); ++day) {
+            for (uint32_t params = 0; params < config_.parameter_grid.size(); ++params) {
+                for (uint32_t group = 0; group < groups; ++group) {
+                    specs.push_back(ShardSpec{day, params, config_.shard_by_instrument ? 1u << group : ALL_INSTRUMENTS});
+                }
+            }
+        }
+        return specs;
+    }
+
+    /**
+     * @brief Run every shard on the pool and merge the results
+     */
+    [[nodiscard]] BacktestReport run(WorkStealingPool& pool) {
+        const HFTTimer::ns_t start = HFTTimer::get_timestamp_ns();
+        std::vector<std::unique_ptr<market_data::CaptureReader>> captures;
+        captures.reserve(config_.days.size());
+        for (const auto& path : config_.days) {
+            captures.push_back(std::make_unique<market_data::CaptureReader>());
+            (void)captures.back()->open(path);
+        }
+
+        BacktestReport report;
+        const std::vector<ShardSpec> specs = shards();
+        report.shards.resize(specs.size());
+        // Sessions are allocated here: the shard tasks run noexcept and must not allocate
+        std::vector<std::unique_ptr<BacktestSession>> sessions(specs.size());
+        for (size_t task = 0; task < specs.size(); ++task) {
+            report.shards[task].spec = specs[task];
+            if (captures[specs[task].day]->is_open()) {
+                sessions[task] = std::make_unique<BacktestSession>(config_, specs[task]);
+            }
+        }
+
+        const uint64_t steals_before = pool.steals();
+        pool.parallel_for(specs.size(), [&](size_t task, size_t) {
+            if (!sessions[task]) return;
+            report.shards[task] = sessions[task]->run(*captures[specs[task].day]);
+            sessions[task].reset();
+        });
+
+        report.by_params.resize(config_.parameter_grid.size());
+        for (const auto& shard : report.shards) {
+            if (!shard.completed) {
+                ++report.failed_shards;
+                continue;
+            }
+            report.by_params[shard.spec.params].merge(shard.stats);
+            report.total.merge(shard.stats);
+        }
+        report.lanes = pool.lane_count();
+        report.steals = pool.steals() - steals_before;
+        report.wall_ns = HFTTimer::get_timestamp_ns() - start;
+        return report;
+    }
+
+    [[nodiscard]] const BacktestConfig& config() const noexcept { return config_; }
+
+private:
+    BacktestConfig config_;
+};
+
+} // namespace backtest
+} // namespace hft
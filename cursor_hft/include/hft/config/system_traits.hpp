@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include "hft/market_data/treasury_instruments.hpp"
+
+namespace hft {
+namespace config {
+
+using market_data::TreasuryType;
+
+/**
+ * @brief One venue instrument id and the instrument slot it trades in
+ *
+ * Several ids may share a slot: an off-the-run 10Y listed next to the
+ * on-the-run one is risk-managed and quoted in the Note_10Y slot.
+ */
+struct InstrumentListing {
+    uint32_t exchange_id;
+    TreasuryType type;
+};
+
+/**
+ * @brief Capacities and instrument universe of the production build
+ *
+ * Every subsystem sizes its fixed arrays, pools and rings from the one
+ * selected traits type (SystemTraits below), so the OMS, books and
+ * strategies always agree on pool types. A deployment overrides the whole
+ * struct, e.g. a two-instrument bills desk:
+ *
+ *     struct BillsDeskTraits : hft::config::DefaultSystemTraits {
+ *         static constexpr std::array INSTRUMENTS = {
+ *             hft::config::InstrumentListing{1, TreasuryType::Bill_3M},
+ *             hft::config::InstrumentListing{2, TreasuryType::Bill_6M}};
+ *         static constexpr size_t MAX_INSTRUMENTS = 2;
+ *         static constexpr bool PARTIAL_UNIVERSE = true;
+ *         static constexpr size_t ORDER_POOL_SIZE = 512;
+ *     };
+ *
+ * In a partial universe, per-instrument accessors reject TreasuryType
+ * values at or past MAX_INSTRUMENTS (ticks dropped, empty state returned)
+ * rather than folding them onto another instrument's slot.
+ */
+struct DefaultSystemTraits {
+    /** @brief Venue instrument ids understood by the feed normalizer */
+    static constexpr std::array INSTRUMENTS = {
+        InstrumentListing{1, TreasuryType::Bill_3M},
+        InstrumentListing{2, TreasuryType::Bill_6M},
+        InstrumentListing{3, TreasuryType::Note_2Y},
+        InstrumentListing{4, TreasuryType::Note_5Y},
+        InstrumentListing{5, TreasuryType::Note_10Y},
+        InstrumentListing{6, TreasuryType::Bond_30Y},
+    };
+    /** @brief Slot for ids not listed */
+    static constexpr TreasuryType UNLISTED_INSTRUMENT = TreasuryType::Bill_3M;
+
+    static constexpr size_t MAX_INSTRUMENTS = 6;     // Per-instrument array width (slots 0..N-1)
+    static constexpr size_t MAX_VENUES = 8;
+    static constexpr size_t MAX_ORDERS = 65536;      // OrderLifecycleManager slots
+    static constexpr size_t ORDER_POOL_SIZE = 4096;  // Resting orders across all books
+    static constexpr size_t LEVEL_POOL_SIZE = 1024;  // Price levels across all books
+    static constexpr size_t UPDATE_RING_SIZE = 8192; // Book update ring (power of two)
+    static constexpr bool PARTIAL_UNIVERSE = false;  // MAX_INSTRUMENTS below TREASURY_TYPE_COUNT is deliberate
+};
+
+/**
+ * @brief Shape every traits type must have
+ */
+template<typename T>
+concept SystemTraitsType = requires {
+    { T::INSTRUMENTS.size() } -> std::convertible_to<size_t>;
+    { T::INSTRUMENTS[0].exchange_id } -> std::convertible_to<uint32_t>;
+    { T::INSTRUMENTS[0].type } -> std::convertible_to<TreasuryType>;
+    { T::UNLISTED_INSTRUMENT } -> std::convertible_to<TreasuryType>;
+    { T::MAX_INSTRUMENTS } -> std::convertible_to<size_t>;
+    { T::MAX_VENUES } -> std::convertible_to<size_t>;
+    { T::MAX_ORDERS } -> std::convertible_to<size_t>;
+    { T::ORDER_POOL_SIZE } -> std::convertible_to<size_t>;
+    { T::LEVEL_POOL_SIZE } -> std::convertible_to<size_t>;
+    { T::UPDATE_RING_SIZE } -> std::convertible_to<size_t>;
+};
+
+namespace detail {
+
+template<typename Traits>
+constexpr uint32_t max_exchange_id() noexcept {
+    uint32_t id = 0;
+    for (const auto& listing : Traits::INSTRUMENTS) id = std::max(id, listing.exchange_id);
+    return id;
+}
+
+template<typename Traits, size_t Size>
+constexpr std::array<TreasuryType, Size> dense_instrument_table() noexcept {
+    std::array<TreasuryType, Size> table{};
+    table.fill(Traits::UNLISTED_INSTRUMENT);
+    for (const auto& listing : Traits::INSTRUMENTS) {
+        if (listing.exchange_id < Size) table[listing.exchange_id] = listing.type;
+    }
+    return table;
+}
+
+template<typename Traits>
+constexpr auto sorted_listings() noexcept {
+    auto sorted = Traits::INSTRUMENTS;
+    std::sort(sorted.begin(), sorted.end(),
+              [](const InstrumentListing& a, const InstrumentListing& b) { return a.exchange_id < b.exchange_id; });
+    return sorted;
+}
+
+} // namespace detail
+
+/**
+ * @brief Compile-time exchange id -> instrument slot lookup
+ *
+ * Generated from Traits::INSTRUMENTS: a direct-indexed table when the ids
+ * are small (the usual venue numbering), otherwise a sorted array searched
+ * by bisection. Either way there is no switch to edit when the universe
+ * grows.
+ */
+template<typename Traits>
+class InstrumentDirectory {
+public:
+    static constexpr size_t LISTED = Traits::INSTRUMENTS.size();
+    static constexpr uint32_t DENSE_LIMIT = 4096;
+
+    [[nodiscard]] static constexpr TreasuryType lookup(uint32_t exchange_id) noexcept {
+        if constexpr (DENSE) {
+            return exchange_id < DENSE_TABLE.size() ? DENSE_TABLE[exchange_id] : Traits::UNLISTED_INSTRUMENT;
+        } else {
+            const auto it = std::lower_bound(SORTED.begin(), SORTED.end(), exchange_id,
+                                             [](const InstrumentListing& l, uint32_t id) { return l.exchange_id < id; });
+            return it != SORTED.end() && it->exchange_id == exchange_id ? it->type : Traits::UNLISTED_INSTRUMENT;
+        }
+    }
+
+    [[nodiscard]] static constexpr bool listed(uint32_t exchange_id) noexcept {
+        const auto it = std::lower_bound(SORTED.begin(), SORTED.end(), exchange_id,
+                                         [](const InstrumentListing& l, uint32_t id) { return l.exchange_id < id; });
+        return it != SORTED.end() && it->exchange_id == exchange_id;
+    }
+
+    /**
+     * @brief Id orders for a slot are sent under: its first listing (0 if unlisted)
+     */
+    [[nodiscard]] static constexpr uint32_t primary_id(TreasuryType type) noexcept {
+        for (const auto& listing : Traits::INSTRUMENTS) {
+            if (listing.type == type) return listing.exchange_id;
+        }
+        return 0;
+    }
+
+private:
+    static constexpr bool DENSE = detail::max_exchange_id<Traits>() < DENSE_LIMIT;
+    static constexpr auto DENSE_TABLE =
+        detail::dense_instrument_table<Traits, DENSE ? detail::max_exchange_id<Traits>() + 1 : 1>();
+    static constexpr auto SORTED = detail::sorted_listings<Traits>();
+    static_assert(std::adjacent_find(SORTED.begin(), SORTED.end(),
+                                     [](const InstrumentListing& a, const InstrumentListing& b) {
+                                         return a.exchange_id == b.exchange_id;
+                                     }) == SORTED.end(),
+                  "An exchange id is listed twice");
+};
+
+/**
+ * @brief Rejects traits the subsystems cannot be built with
+ */
+template<SystemTraitsType Traits>
+consteval bool valid_system_traits() {
+    bool slots_covered = static_cast<size_t>(Traits::UNLISTED_INSTRUMENT) < Traits::MAX_INSTRUMENTS;
+    for (const auto& listing : Traits::INSTRUMENTS) {
+        slots_covered &= static_cast<size_t>(listing.type) < Traits::MAX_INSTRUMENTS;
+    }
+    return slots_covered && Traits::INSTRUMENTS.size() > 0 &&
+           Traits::MAX_INSTRUMENTS <= market_data::TREASURY_TYPE_COUNT &&
+           Traits::MAX_VENUES > 0 && Traits::MAX_VENUES <= 255 &&
+           Traits::MAX_ORDERS > 0 && Traits::MAX_ORDERS < UINT32_MAX &&
+           Traits::ORDER_POOL_SIZE > 0 && Traits::ORDER_POOL_SIZE <= 65536 &&
+           Traits::LEVEL_POOL_SIZE > 0 && Traits::LEVEL_POOL_SIZE <= 65536 &&
+           Traits::UPDATE_RING_SIZE >= 2 && (Traits::UPDATE_RING_SIZE & (Traits::UPDATE_RING_SIZE - 1)) == 0;
+}
+
+/**
+ * @brief Every TreasuryType has a slot, unless the traits opt into a partial universe
+ */
+template<SystemTraitsType Traits>
+consteval bool covers_every_treasury_type() {
+    if constexpr (requires { { Traits::PARTIAL_UNIVERSE } -> std::convertible_to<bool>; }) {
+        if (Traits::PARTIAL_UNIVERSE) return true;
+    }
+    return Traits::MAX_INSTRUMENTS == market_data::TREASURY_TYPE_COUNT;
+}
+
+static_assert(covers_every_treasury_type<DefaultSystemTraits>(), "DefaultSystemTraits must cover every TreasuryType");
+
+} // namespace config
+} // namespace hft
+
+// Deployments pick their traits at build time: HFT_SYSTEM_TRAITS_HEADER names
+// a header defining a traits struct and HFT_SYSTEM_TRAITS the struct (CMake
+// cache variables of the same names). Without them the build uses
+// DefaultSystemTraits. One selection per build: every translation unit of a
+// binary must see the same traits.
+#if defined(HFT_SYSTEM_TRAITS_HEADER)
+#include HFT_SYSTEM_TRAITS_HEADER
+#endif
+
+namespace hft {
+namespace config {
+
+#if defined(HFT_SYSTEM_TRAITS)
+using SystemTraits = HFT_SYSTEM_TRAITS;
+#else
+using SystemTraits = DefaultSystemTraits;
+#endif
+
+static_assert(valid_system_traits<SystemTraits>(),
+              "SystemTraits: every listed slot must be < MAX_INSTRUMENTS <= TREASURY_TYPE_COUNT, "
+              "pools within ObjectPool limits, update ring a power of two");
+static_assert(covers_every_treasury_type<SystemTraits>(),
+              "SystemTraits: MAX_INSTRUMENTS must cover every TreasuryType; "
+              "set PARTIAL_UNIVERSE = true to build for fewer");
+
+using Instruments = InstrumentDirectory<SystemTraits>;
+
+} // namespace config
+} // namespace hft
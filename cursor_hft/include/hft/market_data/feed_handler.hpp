@@ -9,10 +9,22 @@
 #include <string_view>
 #include <atomic>
 #include <utility>
+#include <functional>
 #include "hft/market_data/treasury_instruments.hpp"
+#include "hft/market_data/sequence_window.hpp"
+#include "hft/market_data/yield_tables.hpp"
 #include "hft/timing/hft_timer.hpp"
+#include "hft/timing/hdr_histogram.hpp"
+#include "hft/timing/latency_tracer.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
+#include "hft/config/system_traits.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 using hft::HFTTimer;
 using hft::LatencyHistogram;
@@ -52,16 +64,9 @@ enum class ValidationResult : uint8_t {
 
 class MessageNormalizer {
 public:
-    static TreasuryType normalize_instrument_id(uint32_t exchange_id) noexcept {
-        switch (exchange_id) {
-            case 1: return TreasuryType::Bill_3M;
-            case 2: return TreasuryType::Bill_6M;
-            case 3: return TreasuryType::Note_2Y;
-            case 4: return TreasuryType::Note_5Y;
-            case 5: return TreasuryType::Note_10Y;
-            case 6: return TreasuryType::Bond_30Y;
-            default: return TreasuryType::Bill_3M;
-        }
+    // Table generated from config::SystemTraits::INSTRUMENTS
+    static constexpr TreasuryType normalize_instrument_id(uint32_t exchange_id) noexcept {
+        return config::Instruments::lookup(exchange_id);
     }
     static HFTTimer::timestamp_t normalize_timestamp(
         uint64_t exchange_timestamp, uint32_t /*exchange_id*/) noexcept {
@@ -80,6 +85,164 @@ public:
 
 // ========================= 3. High-Performance Message Parser =========================
 
+/**
+ * @brief Decoded fields of up to WIDTH messages in SoA form
+ *
+ * raw[w][lane] holds raw_data bytes [8w, 8w+8) of each message. Lane masks
+ * have bit i set for lane i. yield[0] is the bid (tick) or trade yield and
+ * yield[1] the ask yield of each tick, both for the 64th-rounded price.
+ */
+struct alignas(64) DecodedBatch {
+    static constexpr size_t WIDTH = 8;
+
+    size_t count;
+    uint32_t checksum_ok_mask;
+    uint32_t tick_mask;
+    uint32_t trade_mask;
+    uint64_t sequence_number[WIDTH];
+    uint64_t timestamp_ns[WIDTH];
+    uint32_t message_type[WIDTH];
+    uint32_t instrument_id[WIDTH];
+    uint64_t raw[4][WIDTH];
+    alignas(32) double yield[2][WIDTH];
+
+    bool checksum_ok(size_t lane) const noexcept { return (checksum_ok_mask >> lane) & 1u; }
+};
+
+/**
+ * @brief Vectorized checksum, classification and field extraction for bursts
+ *
+ * Checksum is the XOR of the 56 bytes before the checksum field, computed
+ * 32/16 bytes at a time (AVX2, NEON) or 8 at a time (portable fallback)
+ * and folded to one byte. Full batches gather message_type across lanes
+ * and classify all 8 with one compare on AVX2.
+ */
+class BatchMessageDecoder {
+public:
+    static constexpr size_t CHECKSUM_BYTES = offsetof(RawMarketMessage, checksum);
+    static_assert(CHECKSUM_BYTES == 56, "checksum folding assumes 7 words before the checksum");
+
+    static uint8_t compute_checksum(const RawMarketMessage& msg) noexcept {
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(&msg);
+        uint64_t x;
+#if defined(__AVX2__)
+        const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+        // Drop bytes 56..63 (checksum and padding)
+        const __m256i keep = _mm256_setr_epi64x(-1, -1, -1, 0);
+        const __m256i v = _mm256_xor_si256(lo, _mm256_and_si256(hi, keep));
+        const __m128i h = _mm_xor_si128(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        x = static_cast<uint64_t>(_mm_cvtsi128_si64(h)) ^ static_cast<uint64_t>(_mm_extract_epi64(h, 1));
+#elif defined(__ARM_NEON)
+        const uint8x16_t v0 = vld1q_u8(p);
+        const uint8x16_t v1 = vld1q_u8(p + 16);
+        const uint8x16_t v2 = vld1q_u8(p + 32);
+        const uint8x16_t v = veorq_u8(veorq_u8(v0, v1), v2);
+        const uint64x2_t w = vreinterpretq_u64_u8(v);
+        uint64_t tail;
+        std::memcpy(&tail, p + 48, sizeof(tail));
+        x = vgetq_lane_u64(w, 0) ^ vgetq_lane_u64(w, 1) ^ tail;
+#else
+        uint64_t w[7];
+        std::memcpy(w, p, sizeof(w));
+        x = w[0] ^ w[1] ^ w[2] ^ w[3] ^ w[4] ^ w[5] ^ w[6];
+#endif
+        x ^= x >> 32;
+        x ^= x >> 16;
+        x ^= x >> 8;
+        return static_cast<uint8_t>(x);
+    }
+
+    static bool validate_checksum(const RawMarketMessage& msg) noexcept {
+        return compute_checksum(msg) == msg.checksum;
+    }
+
+    /**
+     * @brief Decode min(count, WIDTH) messages into SoA scratch
+     * @return Number of messages decoded
+     */
+    static size_t decode(const RawMarketMessage* msgs, size_t count, DecodedBatch& out) noexcept {
+        const size_t n = std::min(count, DecodedBatch::WIDTH);
+        out.count = n;
+
+        uint32_t ok = 0;
+        for (size_t i = 0; i < n; ++i) {
+            ok |= static_cast<uint32_t>(validate_checksum(msgs[i])) << i;
+        }
+        out.checksum_ok_mask = ok;
+
+#if defined(__AVX2__)
+        if (n == DecodedBatch::WIDTH) {
+            // 64-byte messages: stride of 16 ints between lanes
+            constexpr int STRIDE = sizeof(RawMarketMessage) / sizeof(int);
+            const __m256i lanes = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                     _mm256_set1_epi32(STRIDE));
+            const int* base = reinterpret_cast<const int*>(msgs);
+            const __m256i types = _mm256_i32gather_epi32(
+                base + offsetof(RawMarketMessage, message_type) / sizeof(int), lanes, sizeof(int));
+            const __m256i instruments = _mm256_i32gather_epi32(
+                base + offsetof(RawMarketMessage, instrument_id) / sizeof(int), lanes, sizeof(int));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.message_type), types);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.instrument_id), instruments);
+            out.tick_mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(
+                _mm256_cmpeq_epi32(types, _mm256_set1_epi32(static_cast<int>(MessageType::Tick))))));
+            out.trade_mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(
+                _mm256_cmpeq_epi32(types, _mm256_set1_epi32(static_cast<int>(MessageType::Trade))))));
+        } else
+#endif
+        {
+            uint32_t ticks = 0;
+            uint32_t trades = 0;
+            for (size_t i = 0; i < n; ++i) {
+                out.message_type[i] = msgs[i].message_type;
+                out.instrument_id[i] = msgs[i].instrument_id;
+                ticks |= static_cast<uint32_t>(msgs[i].message_type == static_cast<uint32_t>(MessageType::Tick)) << i;
+                trades |= static_cast<uint32_t>(msgs[i].message_type == static_cast<uint32_t>(MessageType::Trade)) << i;
+            }
+            out.tick_mask = ticks;
+            out.trade_mask = trades;
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            out.sequence_number[i] = msgs[i].sequence_number;
+            out.timestamp_ns[i] = msgs[i].timestamp_exchange_ns;
+            uint64_t words[4];
+            std::memcpy(words, msgs[i].raw_data, sizeof(words));
+            out.raw[0][i] = words[0];
+            out.raw[1][i] = words[1];
+            out.raw[2][i] = words[2];
+            out.raw[3][i] = words[3];
+        }
+        decode_yields(out);
+        return n;
+    }
+
+private:
+    // One batched table lookup per price column; lanes without a price get par
+    static void decode_yields(DecodedBatch& out) noexcept {
+        constexpr double PAR = 100.0;
+        TreasuryType types[DecodedBatch::WIDTH];
+        alignas(32) double prices[2][DecodedBatch::WIDTH];
+        const uint32_t priced = out.tick_mask | out.trade_mask;
+        for (size_t i = 0; i < out.count; ++i) {
+            types[i] = MessageNormalizer::normalize_instrument_id(out.instrument_id[i]);
+            prices[0][i] = ((priced >> i) & 1u) ? quoted_price(out.raw[0][i]) : PAR;
+            prices[1][i] = ((out.tick_mask >> i) & 1u) ? quoted_price(out.raw[1][i]) : PAR;
+        }
+        const YieldTables& tables = default_yield_tables();
+        tables.price_to_yield(types, prices[0], out.yield[0], out.count);
+        if (out.tick_mask) {
+            tables.price_to_yield(types, prices[1], out.yield[1], out.count);
+        }
+    }
+
+    static double quoted_price(uint64_t raw_bits) noexcept {
+        double price;
+        std::memcpy(&price, &raw_bits, sizeof(double));
+        return Price32nd::from_decimal(price).to_decimal();
+    }
+};
+
 template<typename OutputType>
 class MessageParser {
 public:
@@ -111,6 +274,92 @@ public:
         return ValidationResult::Valid;
     }
 
+    // Parse without timing (no cycle counter reads)
+    static ValidationResult parse_message(const RawMarketMessage& raw_msg, OutputType& parsed_msg) noexcept {
+        if (!validate_checksum(raw_msg)) {
+            return ValidationResult::InvalidChecksum;
+        }
+        if constexpr (std::is_same_v<OutputType, TreasuryTick>) {
+            return parse_tick(raw_msg, parsed_msg) ? ValidationResult::Valid : ValidationResult::InvalidFormat;
+        } else if constexpr (std::is_same_v<OutputType, TreasuryTrade>) {
+            return parse_trade(raw_msg, parsed_msg) ? ValidationResult::Valid : ValidationResult::InvalidFormat;
+        } else {
+            return ValidationResult::InvalidFormat;
+        }
+    }
+
+    // Build one output from a decoded lane (checksum already computed)
+    static ValidationResult parse_decoded(const DecodedBatch& batch, size_t lane, OutputType& out) noexcept {
+        if (!batch.checksum_ok(lane)) {
+            return ValidationResult::InvalidChecksum;
+        }
+        const uint32_t instrument_id = batch.instrument_id[lane];
+        if constexpr (std::is_same_v<OutputType, TreasuryTick>) {
+            out.instrument_type = MessageNormalizer::normalize_instrument_id(instrument_id);
+            out.timestamp_ns = MessageNormalizer::normalize_timestamp(batch.timestamp_ns[lane], instrument_id);
+            out.bid_price = decode_price(batch.raw[0][lane]);
+            out.ask_price = decode_price(batch.raw[1][lane]);
+            out.bid_size = batch.raw[2][lane];
+            out.ask_size = batch.raw[3][lane];
+            out.bid_yield = batch.yield[0][lane];
+            out.ask_yield = batch.yield[1][lane];
+            out.trace_id = 0;
+            return out.is_valid() ? ValidationResult::Valid : ValidationResult::InvalidFormat;
+        } else if constexpr (std::is_same_v<OutputType, TreasuryTrade>) {
+            out.instrument_type = MessageNormalizer::normalize_instrument_id(instrument_id);
+            out.timestamp_ns = MessageNormalizer::normalize_timestamp(batch.timestamp_ns[lane], instrument_id);
+            out.trade_price = decode_price(batch.raw[0][lane]);
+            out.trade_size = batch.raw[1][lane];
+            out.trade_yield = batch.yield[0][lane];
+            std::memcpy(out.trade_id, &batch.raw[2][lane], 8);
+            std::memcpy(out.trade_id + 8, &batch.raw[3][lane], 8);
+            return ValidationResult::Valid;
+        } else {
+            return ValidationResult::InvalidFormat;
+        }
+    }
+
+    /**
+     * @brief Burst parsing through the vectorized decoder
+     *
+     * Decodes DecodedBatch::WIDTH messages per iteration and writes only
+     * valid results, compacted, to out. Timing is optional and taken once
+     * per call rather than per message.
+     *
+     * @return Number of valid outputs written
+     */
+    static size_t parse_burst(
+        const RawMarketMessage* raw, size_t count,
+        OutputType* out, size_t max_out,
+        size_t& invalid_count,
+        HFTTimer::ns_t* burst_latency_ns = nullptr) noexcept {
+        const auto start = burst_latency_ns ? HFTTimer::get_cycles() : 0;
+        DecodedBatch batch;
+        size_t written = 0;
+        invalid_count = 0;
+        for (size_t base = 0; base < count && written < max_out; base += DecodedBatch::WIDTH) {
+            const size_t n = BatchMessageDecoder::decode(raw + base, count - base, batch);
+            // Next batch is 8 cache lines ahead
+            for (size_t i = 0; i < DecodedBatch::WIDTH && base + n + i < count; ++i) {
+                __builtin_prefetch(&raw[base + n + i], 0, 3);
+            }
+            for (size_t lane = 0; lane < n; ++lane) {
+                if (written == max_out) {
+                    break;
+                }
+                if (parse_decoded(batch, lane, out[written]) == ValidationResult::Valid) {
+                    ++written;
+                } else {
+                    ++invalid_count;
+                }
+            }
+        }
+        if (burst_latency_ns) {
+            *burst_latency_ns = HFTTimer::cycles_to_ns(HFTTimer::get_cycles() - start);
+        }
+        return written;
+    }
+
     // Batch parsing for high throughput
     template<typename InputIterator, typename OutputIterator>
     static size_t parse_batch(
@@ -140,12 +389,13 @@ public:
 private:
     // Fast checksum validation (simple XOR over all bytes except checksum field)
     static bool validate_checksum(const RawMarketMessage& msg) noexcept {
-        uint16_t sum = 0;
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&msg);
-        for (size_t i = 0; i < offsetof(RawMarketMessage, checksum); ++i) {
-            sum ^= ptr[i];
-        }
-        return sum == msg.checksum;
+        return BatchMessageDecoder::validate_checksum(msg);
+    }
+
+    static Price32nd decode_price(uint64_t raw_bits) noexcept {
+        double price;
+        std::memcpy(&price, &raw_bits, sizeof(double));
+        return Price32nd::from_decimal(price);
     }
 
     // Parse tick message from raw bytes
@@ -156,10 +406,9 @@ private:
         out.ask_price = MessageNormalizer::normalize_price(raw.raw_data + 8, 0);
         std::memcpy(&out.bid_size, raw.raw_data + 16, sizeof(uint64_t));
         std::memcpy(&out.ask_size, raw.raw_data + 24, sizeof(uint64_t));
-        out.bid_yield = YieldCalculator::price_to_yield(
-            TreasuryInstrument(out.instrument_type, 0, 0), out.bid_price, 0);
-        out.ask_yield = YieldCalculator::price_to_yield(
-            TreasuryInstrument(out.instrument_type, 0, 0), out.ask_price, 0);
+        out.bid_yield = default_yield_tables().price_to_yield(out.instrument_type, out.bid_price);
+        out.ask_yield = default_yield_tables().price_to_yield(out.instrument_type, out.ask_price);
+        out.trace_id = 0;
         return out.is_valid();
     }
 
@@ -169,8 +418,7 @@ private:
         out.timestamp_ns = MessageNormalizer::normalize_timestamp(raw.timestamp_exchange_ns, raw.instrument_id);
         out.trade_price = MessageNormalizer::normalize_price(raw.raw_data, 0);
         std::memcpy(&out.trade_size, raw.raw_data + 8, sizeof(uint64_t));
-        out.trade_yield = YieldCalculator::price_to_yield(
-            TreasuryInstrument(out.instrument_type, 0, 0), out.trade_price, 0);
+        out.trade_yield = default_yield_tables().price_to_yield(out.instrument_type, out.trade_price);
         std::memcpy(&out.trade_id, raw.raw_data + 16, 16);
         return true;
     }
@@ -185,63 +433,184 @@ private:
 
 // ========================= 4. Feed Handler Pipeline =========================
 
+/**
+ * @brief Sequenced feed handler: dedup, gap detection, optional gap recovery
+ *
+ * Sequence tracking uses a SequenceWindow bitmap, so duplicate and gap
+ * checks are O(1). By default messages are delivered as they arrive and
+ * gaps are only counted. With gap recovery enabled, a gap switches the
+ * handler to Recovering: later messages are buffered, the missing range
+ * is requested through the retransmit callback, and buffered messages are
+ * released in sequence order as soon as the gap fills. A gap wider than
+ * the recovery buffer, or flush_recovery(), gives up on the missing
+ * sequences and releases what was buffered.
+ */
 class TreasuryFeedHandler {
 public:
-    TreasuryFeedHandler(size_t buffer_size = 8192) noexcept
-        : expected_sequence_(0), recent_messages_{}, recent_messages_count_(0), 
-          recent_messages_idx_(0), stats_{}, parse_latency_hist_() {}
+    static constexpr size_t SEQUENCE_WINDOW = 1024;
+    static constexpr size_t RECOVERY_CAPACITY = SEQUENCE_WINDOW;
+
+    enum class FeedState : uint8_t {
+        Live,
+        Recovering
+    };
 
-    // Process incoming raw messages
+    // Called with the inclusive range of missing sequence numbers
+    using RetransmitCallback = std::function<void(uint64_t first_missing, uint64_t last_missing)>;
+
+    TreasuryFeedHandler(size_t buffer_size = 8192) noexcept
+        : stats_{}, parse_latency_hist_(), per_message_timing_(false),
+          recovery_enabled_(false), state_(FeedState::Live), released_(0) {}
+
+    /**
+     * @brief Process incoming raw messages
+     * @param receive_ns Receive timestamp of these messages (e.g. SO_TIMESTAMPING);
+     *                   when non-zero it is the output timestamp_ns instead of the exchange's
+     */
     size_t process_messages(
         const RawMarketMessage* raw_messages,
-        size_t message_count) noexcept {
+        size_t message_count,
+        HFTTimer::ns_t receive_ns = 0) noexcept {
         size_t processed = 0;
-        for (size_t i = 0; i < message_count; ++i) {
-            const RawMarketMessage& msg = raw_messages[i];
-            
-            // Duplicate detection first
-            if (is_duplicate(msg.sequence_number)) {
-                ++stats_.duplicate_messages;
-                continue;  // Skip processing and don't update expected_sequence_
+        DecodedBatch batch;
+        for (size_t base = 0; base < message_count; base += DecodedBatch::WIDTH) {
+            const auto batch_start = HFTTimer::get_cycles();
+            batch_start_cycles_ = batch_start;
+            const size_t n = BatchMessageDecoder::decode(raw_messages + base, message_count - base, batch);
+            if (receive_ns != 0) {
+                for (size_t lane = 0; lane < n; ++lane) batch.timestamp_ns[lane] = receive_ns;
             }
-            
-            // Check for sequence gaps AFTER confirming it's not a duplicate
-            if (expected_sequence_ != 0 && msg.sequence_number > expected_sequence_) {
-                ++stats_.sequence_gaps;
+            // Prefetch the next batch
+            for (size_t i = 0; i < DecodedBatch::WIDTH && base + n + i < message_count; ++i) {
+                __builtin_prefetch(&raw_messages[base + n + i], 0, 3);
             }
-            
-            // Update expected sequence only for non-duplicates
-            expected_sequence_ = msg.sequence_number + 1;
-            add_recent(msg.sequence_number);
-            
-            // Parse and classify
-            HFTTimer::ns_t latency = 0;
-            ValidationResult res = ValidationResult::InvalidFormat;
-            if (msg.message_type == static_cast<uint32_t>(MessageType::Tick)) {
-                TreasuryTick tick;
-                res = MessageParser<TreasuryTick>::parse_message(msg, tick, latency);
-                if (res == ValidationResult::Valid) {
-                    (void)tick_buffer_.try_push(tick);
+
+            size_t parsed = 0;
+            for (size_t lane = 0; lane < n; ++lane) {
+                const uint64_t seq = batch.sequence_number[lane];
+                if (recovery_enabled_ && buffered_count_ > 0 && seq > released_ + RECOVERY_CAPACITY) {
+                    // Gap wider than the recovery buffer: give up on it
+                    parsed += flush_recovery();
                 }
-            } else if (msg.message_type == static_cast<uint32_t>(MessageType::Trade)) {
-                TreasuryTrade trade;
-                res = MessageParser<TreasuryTrade>::parse_message(msg, trade, latency);
-                if (res == ValidationResult::Valid) {
-                    (void)trade_buffer_.try_push(trade);
+                const uint64_t prev_highest = sequence_window_.highest();
+                const bool first = sequence_window_.empty();
+                const auto status = sequence_window_.observe(seq);
+
+                if (status == SequenceStatus::Duplicate || status == SequenceStatus::Stale) {
+                    ++stats_.duplicate_messages;
+                    continue;
+                }
+                if (status == SequenceStatus::Gap) {
+                    ++stats_.sequence_gaps;
+                }
+                if (recovery_enabled_ && !first && seq <= released_) {
+                    // Arrived after its gap was given up; order can no longer be kept
+                    ++stats_.late_messages;
+                    continue;
+                }
+                ++processed;
+
+                if (!recovery_enabled_) {
+                    deliver(batch, lane);
+                    ++parsed;
+                    continue;
+                }
+
+                if (first) {
+                    released_ = seq - 1;
+                }
+                if (seq == released_ + 1) {
+                    deliver(batch, lane);
+                    ++parsed;
+                    released_ = seq;
+                    parsed += release_buffered();
+                } else if (seq - released_ > RECOVERY_CAPACITY) {
+                    // Gap alone exceeds the buffer: skip it
+                    stats_.lost_messages += seq - released_ - 1;
+                    deliver(batch, lane);
+                    ++parsed;
+                    released_ = seq;
+                } else {
+                    recovery_buffer_[seq & (RECOVERY_CAPACITY - 1)] = raw_messages[base + lane];
+                    recovery_receive_ns_[seq & (RECOVERY_CAPACITY - 1)] = receive_ns;
+                    ++buffered_count_;
+                    state_ = FeedState::Recovering;
+                    if (status == SequenceStatus::Gap) {
+                        request_retransmit(prev_highest + 1, seq - 1);
+                    }
                 }
-            } else {
-                res = ValidationResult::InvalidFormat;
             }
-            parse_latency_hist_.record_latency(latency);
-            ++stats_.total_messages_processed;
-            if (res != ValidationResult::Valid) ++stats_.invalid_messages;
-            // Prefetch next message
-            if (i + 1 < message_count) __builtin_prefetch(&raw_messages[i + 1], 0, 3);
-            ++processed;
+
+            // One timing per batch, spread evenly over its messages
+            if (!per_message_timing_ && parsed > 0) {
+                const auto batch_ns = HFTTimer::cycles_to_ns(HFTTimer::get_cycles() - batch_start);
+                parse_latency_hist_.record_latency(batch_ns / parsed, parsed);
+            }
         }
         return processed;
     }
 
+    /**
+     * @brief Time every message individually (two counter reads each)
+     *        instead of once per decoded batch
+     */
+    void set_per_message_timing(bool enabled) noexcept { per_message_timing_ = enabled; }
+    [[nodiscard]] bool per_message_timing() const noexcept { return per_message_timing_; }
+
+    /**
+     * @brief Start sampled tick-to-trade traces here (nullptr: off)
+     *
+     * Sampled ticks leave with a non-zero trace_id, stamped INGRESS at
+     * their batch's pickup and PARSED once in the tick ring.
+     */
+    void set_tracer(PipelineTracer* tracer) noexcept { tracer_ = tracer; }
+    [[nodiscard]] PipelineTracer* tracer() const noexcept { return tracer_; }
+
+    /**
+     * @brief Buffer out-of-order messages and request retransmission of gaps
+     */
+    void enable_gap_recovery(RetransmitCallback callback) noexcept {
+        retransmit_callback_ = std::move(callback);
+        recovery_enabled_ = true;
+        if (!sequence_window_.empty()) {
+            released_ = sequence_window_.highest();
+        }
+    }
+
+    void disable_gap_recovery() noexcept {
+        (void)flush_recovery();
+        recovery_enabled_ = false;
+        retransmit_callback_ = nullptr;
+    }
+
+    /**
+     * @brief Give up on outstanding gaps (e.g. retransmit timeout) and
+     *        release everything buffered, in order
+     * @return Number of messages released
+     */
+    size_t flush_recovery() noexcept {
+        size_t released = 0;
+        const uint64_t highest = sequence_window_.highest();
+        while (buffered_count_ > 0 && released_ < highest) {
+            const uint64_t next = released_ + 1;
+            if (sequence_window_.contains(next)) {
+                deliver(recovery_buffer_[next & (RECOVERY_CAPACITY - 1)], recovery_receive_ns_[next & (RECOVERY_CAPACITY - 1)]);
+                --buffered_count_;
+                ++released;
+            } else {
+                ++stats_.lost_messages;
+            }
+            released_ = next;
+        }
+        buffered_count_ = 0;
+        state_ = FeedState::Live;
+        return released;
+    }
+
+    [[nodiscard]] FeedState feed_state() const noexcept { return state_; }
+    [[nodiscard]] size_t buffered_messages() const noexcept { return buffered_count_; }
+    [[nodiscard]] uint64_t last_released_sequence() const noexcept { return released_; }
+
     // Get parsed treasury ticks
     size_t get_parsed_ticks(TreasuryTick* output_buffer, size_t max_count) noexcept {
         return tick_buffer_.try_pop_batch(output_buffer, output_buffer + max_count);
@@ -258,6 +627,10 @@ public:
         uint64_t invalid_messages = 0;
         uint64_t duplicate_messages = 0;
         uint64_t sequence_gaps = 0;
+        uint64_t retransmit_requests = 0;
+        uint64_t recovered_messages = 0;  // Released from the recovery buffer
+        uint64_t lost_messages = 0;       // Given up on by flush_recovery()
+        uint64_t late_messages = 0;       // Arrived after being given up on
         HFTTimer::ns_t avg_parse_latency_ns = 0;
         HFTTimer::ns_t max_parse_latency_ns = 0;
     };
@@ -275,54 +648,112 @@ public:
     }
 
 private:
+    using SequenceStatus = SequenceWindow<SEQUENCE_WINDOW>::Status;
+
     TreasuryTickBuffer tick_buffer_;
     TreasuryTradeBuffer trade_buffer_;
-    uint64_t expected_sequence_;
-    
-    // Optimized duplicate detection using circular buffer with sorted search
-    static constexpr size_t RECENT_SIZE = 1024;
-    std::array<uint64_t, RECENT_SIZE> recent_messages_;
-    size_t recent_messages_count_;  // Number of valid entries (0 to RECENT_SIZE)
-    size_t recent_messages_idx_;    // Current write position
+    SequenceWindow<SEQUENCE_WINDOW> sequence_window_;
     
     QualityStats stats_;
-    LatencyHistogram parse_latency_hist_;
-
-    // Optimized duplicate detection using binary search on sorted portion
-    bool is_duplicate(uint64_t seq) const noexcept {
-        if (recent_messages_count_ == 0) return false;
-        
-        // For small counts, linear search is faster than binary search
-        if (recent_messages_count_ <= 16) {
-            for (size_t i = 0; i < recent_messages_count_; ++i) {
-                if (recent_messages_[i] == seq) return true;
+    HdrHistogram<> parse_latency_hist_;  // Single writer: plain stores per record
+    bool per_message_timing_;
+    PipelineTracer* tracer_ = nullptr;
+    HFTTimer::cycle_t batch_start_cycles_ = 0;
+
+    // Gap recovery
+    bool recovery_enabled_;
+    FeedState state_;
+    uint64_t released_;       // Highest sequence delivered downstream
+    size_t buffered_count_ = 0;
+    RetransmitCallback retransmit_callback_;
+    std::array<RawMarketMessage, RECOVERY_CAPACITY> recovery_buffer_;
+    std::array<HFTTimer::ns_t, RECOVERY_CAPACITY> recovery_receive_ns_;  // 0: keep the exchange timestamp
+
+    // Parse one decoded lane into the output rings
+    void deliver(const DecodedBatch& batch, size_t lane) noexcept {
+        const auto start = per_message_timing_ ? HFTTimer::get_cycles() : 0;
+        ValidationResult res = ValidationResult::InvalidFormat;
+        if ((batch.tick_mask >> lane) & 1u) {
+            // Parse straight into the ring slot; commit only if valid
+            auto slot = tick_buffer_.claim();
+            TreasuryTick overflow_tick;
+            TreasuryTick& tick = slot.empty() ? overflow_tick : slot[0];
+            res = MessageParser<TreasuryTick>::parse_decoded(batch, lane, tick);
+            if (res == ValidationResult::Valid && !slot.empty()) {
+                if (tracer_) tick.trace_id = begin_trace(batch_start_cycles_);
+                tick_buffer_.commit();
+            }
+        } else if ((batch.trade_mask >> lane) & 1u) {
+            TreasuryTrade trade;
+            res = MessageParser<TreasuryTrade>::parse_decoded(batch, lane, trade);
+            if (res == ValidationResult::Valid) {
+                (void)trade_buffer_.try_push(trade);
             }
-            return false;
         }
-        
-        // Binary search for larger counts
-        return std::binary_search(recent_messages_.begin(), 
-                                recent_messages_.begin() + recent_messages_count_, seq);
+        finish_delivery(res, start);
     }
-    
-    void add_recent(uint64_t seq) noexcept {
-        if (recent_messages_count_ < RECENT_SIZE) {
-            // Still filling the buffer - insert in sorted order
-            auto insert_pos = std::upper_bound(recent_messages_.begin(),
-                                             recent_messages_.begin() + recent_messages_count_, seq);
-            std::move_backward(insert_pos, recent_messages_.begin() + recent_messages_count_,
-                             recent_messages_.begin() + recent_messages_count_ + 1);
-            *insert_pos = seq;
-            ++recent_messages_count_;
-        } else {
-            // Buffer full - replace oldest entry and re-sort
-            // For high-frequency trading, we accept the occasional sort cost
-            // vs constant O(n) duplicate detection
-            recent_messages_[recent_messages_idx_++ % RECENT_SIZE] = seq;
-            if (recent_messages_idx_ % 64 == 0) {  // Re-sort every 64 additions
-                std::sort(recent_messages_.begin(), recent_messages_.end());
+
+    // Parse one buffered message into the output rings
+    void deliver(const RawMarketMessage& msg, HFTTimer::ns_t receive_ns) noexcept {
+        const auto start = per_message_timing_ ? HFTTimer::get_cycles() : 0;
+        ValidationResult res = ValidationResult::InvalidFormat;
+        if (msg.message_type == static_cast<uint32_t>(MessageType::Tick)) {
+            auto slot = tick_buffer_.claim();
+            TreasuryTick overflow_tick;
+            TreasuryTick& tick = slot.empty() ? overflow_tick : slot[0];
+            res = MessageParser<TreasuryTick>::parse_message(msg, tick);
+            if (receive_ns != 0) tick.timestamp_ns = receive_ns;
+            if (res == ValidationResult::Valid && !slot.empty()) {
+                if (tracer_) tick.trace_id = begin_trace(start ? start : HFTTimer::get_cycles());
+                tick_buffer_.commit();
+            }
+        } else if (msg.message_type == static_cast<uint32_t>(MessageType::Trade)) {
+            TreasuryTrade trade;
+            res = MessageParser<TreasuryTrade>::parse_message(msg, trade);
+            if (receive_ns != 0) trade.timestamp_ns = receive_ns;
+            if (res == ValidationResult::Valid) {
+                (void)trade_buffer_.try_push(trade);
             }
         }
+        ++stats_.recovered_messages;
+        finish_delivery(res, start);
+    }
+
+    uint32_t begin_trace(HFTTimer::cycle_t ingress_cycles) noexcept {
+        const uint32_t trace_id = tracer_->begin(ingress_cycles);
+        tracer_->stamp(trace_id, TraceStage::PARSED);
+        return trace_id;
+    }
+
+    void finish_delivery(ValidationResult res, HFTTimer::cycle_t start) noexcept {
+        if (per_message_timing_) {
+            parse_latency_hist_.record_latency(HFTTimer::cycles_to_ns(HFTTimer::get_cycles() - start));
+        }
+        ++stats_.total_messages_processed;
+        if (res != ValidationResult::Valid) ++stats_.invalid_messages;
+    }
+
+    // Release buffered messages that are now contiguous with released_
+    size_t release_buffered() noexcept {
+        size_t released = 0;
+        while (buffered_count_ > 0 && sequence_window_.contains(released_ + 1)) {
+            ++released_;
+            deliver(recovery_buffer_[released_ & (RECOVERY_CAPACITY - 1)], recovery_receive_ns_[released_ & (RECOVERY_CAPACITY - 1)]);
+            --buffered_count_;
+            ++released;
+        }
+        if (buffered_count_ == 0) {
+            state_ = FeedState::Live;
+        }
+        return released;
+    }
+
+    void request_retransmit(uint64_t first, uint64_t last) noexcept {
+        if (first > last) return;
+        ++stats_.retransmit_requests;
+        if (retransmit_callback_) {
+            retransmit_callback_(first, last);
+        }
     }
 };
 
@@ -380,9 +811,13 @@ public:
             const RawMarketMessage& msg = raw_messages[i];
             HFTTimer::ns_t latency = 0;
             if (msg.message_type == static_cast<uint32_t>(MessageType::Tick)) {
-                TreasuryTick tick;
+                auto slot = tick_buffer.claim();
+                TreasuryTick overflow_tick;
+                TreasuryTick& tick = slot.empty() ? overflow_tick : slot[0];
                 if (MessageParser<TreasuryTick>::parse_message(msg, tick, latency) == ValidationResult::Valid) {
-                    (void)tick_buffer.try_push(tick);
+                    if (!slot.empty()) {
+                        tick_buffer.commit();
+                    }
                     ++processed;
                 }
             } else if (msg.message_type == static_cast<uint32_t>(MessageType::Trade)) {
@@ -412,5 +847,154 @@ private:
     uint64_t messages_processed_;
 };
 
+// ========================= 6. A/B Line Arbitration =========================
+
+/**
+ * @brief First-arrival arbitration between redundant A and B feed lines
+ *
+ * Each sequence number is accepted from whichever line delivers it first
+ * with a valid checksum; the other line's copy is dropped against a
+ * SequenceWindow before any parsing. A corrupt copy never enters the window,
+ * so the clean copy on the other line still wins. Accepted messages are forwarded, as contiguous runs straight
+ * from the caller's buffer, to one TreasuryFeedHandler, whose tick and
+ * trade rings are the output.
+ *
+ * Per line it tracks wins, losses and lag (how long after the winning copy
+ * the losing copy arrived). Both lines must be fed from the same thread.
+ */
+class FeedArbitrator {
+public:
+    enum class Line : uint8_t {
+        A = 0,
+        B = 1
+    };
+
+    static constexpr size_t WINDOW_SIZE = TreasuryFeedHandler::SEQUENCE_WINDOW;
+
+    struct LineStats {
+        uint64_t messages = 0;   // Copies received on this line
+        uint64_t wins = 0;       // Copies accepted (arrived first)
+        uint64_t losses = 0;     // Copies dropped (other line was first)
+        uint64_t stale = 0;      // Copies older than the arbitration window
+        uint64_t corrupt = 0;    // Copies failing the checksum (left to the other line)
+        HFTTimer::ns_t avg_lag_ns = 0;  // When losing: delay behind the other line
+        HFTTimer::ns_t max_lag_ns = 0;
+
+        [[nodiscard]] double win_rate() const noexcept {
+            const uint64_t decided = wins + losses;
+            return decided ? static_cast<double>(wins) / static_cast<double>(decided) : 0.0;
+        }
+    };
+
+    FeedArbitrator() noexcept : arrival_ns_{}, arrival_seq_{}, stats_{} {}
+
+    /**
+     * @brief Arbitrate a burst received on one line
+     * @param receive_ns Receive time for the burst (0: read the timer once)
+     * @param stamp_receive_time Forward a non-zero receive_ns as the winners' timestamp_ns
+     * @return Number of messages accepted and forwarded
+     */
+    size_t process_line(Line line, const RawMarketMessage* msgs, size_t count,
+                        HFTTimer::ns_t receive_ns = 0, bool stamp_receive_time = false) noexcept {
+        if (count == 0) {
+            return 0;
+        }
+        const HFTTimer::ns_t now = receive_ns ? receive_ns : HFTTimer::get_timestamp_ns();
+        const HFTTimer::ns_t stamp_ns = stamp_receive_time ? receive_ns : 0;
+        const size_t idx = static_cast<size_t>(line);
+        RawLineStats& stats = stats_[idx];
+        stats.messages += count;
+
+        size_t accepted = 0;
+        size_t run_start = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t seq = msgs[i].sequence_number;
+            if (__builtin_expect(!BatchMessageDecoder::validate_checksum(msgs[i]), 0)) {
+                accepted += forward(msgs + run_start, i - run_start, stamp_ns);
+                run_start = i + 1;
+                ++stats.corrupt;
+                continue;
+            }
+            const auto status = window_.observe(seq);
+            if (__builtin_expect(status != SequenceStatus::Duplicate && status != SequenceStatus::Stale, 1)) {
+                const size_t slot = seq & (WINDOW_SIZE - 1);
+                arrival_ns_[slot] = now;
+                arrival_seq_[slot] = seq;
+                ++stats.wins;
+                continue;
+            }
+
+            // Drop this copy; forward the run of winners before it
+            accepted += forward(msgs + run_start, i - run_start, stamp_ns);
+            run_start = i + 1;
+            if (status == SequenceStatus::Stale) {
+                ++stats.stale;
+                continue;
+            }
+            ++stats.losses;
+            const size_t slot = seq & (WINDOW_SIZE - 1);
+            if (arrival_seq_[slot] == seq) {
+                const HFTTimer::ns_t lag = now > arrival_ns_[slot] ? now - arrival_ns_[slot] : 0;
+                stats.lag_sum_ns += lag;
+                stats.max_lag_ns = std::max(stats.max_lag_ns, lag);
+            }
+        }
+        accepted += forward(msgs + run_start, count - run_start, stamp_ns);
+        return accepted;
+    }
+
+    [[nodiscard]] LineStats line_stats(Line line) const noexcept {
+        const RawLineStats& raw = stats_[static_cast<size_t>(line)];
+        LineStats out;
+        out.messages = raw.messages;
+        out.wins = raw.wins;
+        out.losses = raw.losses;
+        out.stale = raw.stale;
+        out.corrupt = raw.corrupt;
+        out.avg_lag_ns = raw.losses ? raw.lag_sum_ns / raw.losses : 0;
+        out.max_lag_ns = raw.max_lag_ns;
+        return out;
+    }
+
+    void reset_stats() noexcept {
+        stats_ = {};
+    }
+
+    // Downstream handler (quality stats, gap recovery, output rings)
+    TreasuryFeedHandler& handler() noexcept { return handler_; }
+    const TreasuryFeedHandler& handler() const noexcept { return handler_; }
+
+    size_t get_parsed_ticks(TreasuryTick* output_buffer, size_t max_count) noexcept {
+        return handler_.get_parsed_ticks(output_buffer, max_count);
+    }
+
+    size_t get_parsed_trades(TreasuryTrade* output_buffer, size_t max_count) noexcept {
+        return handler_.get_parsed_trades(output_buffer, max_count);
+    }
+
+private:
+    using SequenceStatus = SequenceWindow<WINDOW_SIZE>::Status;
+
+    struct RawLineStats {
+        uint64_t messages = 0;
+        uint64_t wins = 0;
+        uint64_t losses = 0;
+        uint64_t stale = 0;
+        uint64_t corrupt = 0;
+        uint64_t lag_sum_ns = 0;
+        HFTTimer::ns_t max_lag_ns = 0;
+    };
+
+    size_t forward(const RawMarketMessage* msgs, size_t count, HFTTimer::ns_t receive_ns) noexcept {
+        return count ? handler_.process_messages(msgs, count, receive_ns) : 0;
+    }
+
+    SequenceWindow<WINDOW_SIZE> window_;
+    std::array<HFTTimer::ns_t, WINDOW_SIZE> arrival_ns_;
+    std::array<uint64_t, WINDOW_SIZE> arrival_seq_;
+    std::array<RawLineStats, 2> stats_;
+    TreasuryFeedHandler handler_;
+};
+
 } // namespace market_data
 } // namespace hft
@@ -0,0 +1,590 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <array>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "hft/market_data/feed_handler.hpp"
+#include "hft/messaging/wait_strategy.hpp"
+#include "hft/timing/hft_timer.hpp"
+
+namespace hft {
+namespace market_data {
+
+// ========================= 1. On-Disk Format =========================
+//
+// A capture is a sequence of segment files <base>.00000, <base>.00001, ...
+// Each segment is:
+//   CaptureSegmentHeader                      (64 bytes)
+//   CaptureBlock[block_count]                 (fixed size, 64-byte aligned)
+//   CaptureIndexEntry[block_count]            (written when the segment is closed)
+// Messages are stored verbatim, so a block's messages can be handed to
+// TreasuryFeedHandler::process_messages() directly from the mapping.
+
+constexpr uint64_t CAPTURE_MAGIC = 0x3130504143544648ULL;  // "HFTCAP01"
+constexpr uint32_t CAPTURE_VERSION = 1;
+constexpr size_t CAPTURE_BLOCK_MESSAGES = 64;
+
+struct alignas(64) CaptureSegmentHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t segment_index;
+    uint64_t message_count;
+    uint64_t block_count;
+    uint64_t first_rx_ns;
+    uint64_t last_rx_ns;
+    uint64_t index_offset;     // 0 until the segment is finalized
+    uint32_t block_messages;   // CAPTURE_BLOCK_MESSAGES at write time
+    uint32_t _pad;
+};
+static_assert(sizeof(CaptureSegmentHeader) == 64, "CaptureSegmentHeader must be 64 bytes");
+
+struct alignas(64) CaptureBlock {
+    std::array<RawMarketMessage, CAPTURE_BLOCK_MESSAGES> messages;
+    std::array<uint64_t, CAPTURE_BLOCK_MESSAGES> rx_timestamp_ns;
+    uint32_t count;            // Valid messages (a flushed block may be partial)
+    uint32_t _pad0;
+    uint64_t first_sequence;
+    uint64_t first_rx_ns;
+    uint64_t last_rx_ns;
+    uint8_t _pad1[32];
+};
+static_assert(sizeof(CaptureBlock) % 64 == 0, "CaptureBlock must be a whole number of cache lines");
+
+struct CaptureIndexEntry {
+    uint64_t first_rx_ns;
+    uint64_t last_rx_ns;
+    uint64_t first_sequence;
+    uint64_t count;
+};
+static_assert(sizeof(CaptureIndexEntry) == 32, "CaptureIndexEntry must be 32 bytes");
+
+namespace detail {
+
+inline std::string capture_segment_path(const std::string& base_path, uint32_t index) {
+    char suffix[16];
+    std::snprintf(suffix, sizeof(suffix), ".%05u", index);
+    return base_path + suffix;
+}
+
+inline bool write_all(int fd, const void* data, size_t len) noexcept {
+    const auto* p = static_cast<const uint8_t*>(data);
+    while (len > 0) {
+        const ssize_t n = ::write(fd, p, len);
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+} // namespace detail
+
+// ========================= 2. Capture Writer =========================
+
+/**
+ * @brief Appends raw messages and their receive timestamps to a segmented capture
+ *
+ * Messages are staged in one in-memory block and written a block at a
+ * time; segments roll over after blocks_per_segment blocks. The block
+ * index is reserved at open(), so append() does not allocate. Intended
+ * for a capture thread (e.g. fed from FeedIngestor::poll), not the
+ * parse path itself.
+ */
+class CaptureWriter {
+public:
+    static constexpr size_t DEFAULT_BLOCKS_PER_SEGMENT = 16384;  // ~73MB, ~1M messages
+
+    CaptureWriter() noexcept
+        : fd_(-1), segment_index_(0), blocks_per_segment_(DEFAULT_BLOCKS_PER_SEGMENT),
+          header_{}, block_{}, messages_written_(0), segments_written_(0), failed_(false) {}
+    ~CaptureWriter() { (void)close(); }
+
+    CaptureWriter(const CaptureWriter&) = delete;
+    CaptureWriter& operator=(const CaptureWriter&) = delete;
+
+    /**
+     * @brief Start a new capture at base_path (an existing capture there is replaced)
+     */
+    bool open(const std::string& base_path, size_t blocks_per_segment = DEFAULT_BLOCKS_PER_SEGMENT) {
+        (void)close();
+        base_path_ = base_path;
+        // Stale trailing segments would otherwise be read back as part of this capture
+        for (uint32_t index = 0; ::unlink(detail::capture_segment_path(base_path_, index).c_str()) == 0; ++index) {
+        }
+        blocks_per_segment_ = std::max<size_t>(blocks_per_segment, 1);
+        segment_index_ = 0;
+        messages_written_ = 0;
+        segments_written_ = 0;
+        failed_ = false;
+        index_.clear();
+        index_.reserve(blocks_per_segment_);
+        block_.count = 0;
+        return open_segment();
+    }
+
+    /**
+     * @brief Append one message received at rx_ns
+     * @return false once any write has failed
+     */
+    bool append(const RawMarketMessage& msg, HFTTimer::ns_t rx_ns) noexcept {
+        if (__builtin_expect(fd_ < 0 || failed_, 0)) {
+            return false;
+        }
+        const uint32_t slot = block_.count;
+        if (slot == 0) {
+            block_.first_sequence = msg.sequence_number;
+            block_.first_rx_ns = rx_ns;
+        }
+        block_.messages[slot] = msg;
+        block_.rx_timestamp_ns[slot] = rx_ns;
+        block_.last_rx_ns = rx_ns;
+        block_.count = slot + 1;
+        ++messages_written_;
+        if (block_.count == CAPTURE_BLOCK_MESSAGES) {
+            return write_block();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Append a run of messages sharing one receive timestamp
+     *
+     * Matches the FeedIngestor consumer signature.
+     */
+    bool append(const RawMarketMessage* msgs, size_t count, HFTTimer::ns_t rx_ns) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            if (!append(msgs[i], rx_ns)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Write the staged (possibly partial) block
+     */
+    bool flush() noexcept {
+        if (fd_ < 0 || failed_) {
+            return false;
+        }
+        return block_.count == 0 || write_block();
+    }
+
+    /**
+     * @brief Flush, write the index and finalize the current segment
+     */
+    bool close() noexcept {
+        if (fd_ < 0) {
+            return !failed_;
+        }
+        const bool flushed = flush();
+        const bool finalized = finalize_segment();
+        return flushed && finalized && !failed_;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+    [[nodiscard]] bool failed() const noexcept { return failed_; }
+    [[nodiscard]] uint64_t messages_written() const noexcept { return messages_written_; }
+    [[nodiscard]] uint32_t segments_written() const noexcept { return segments_written_; }
+
+private:
+    bool open_segment() {
+        const std::string path = detail::capture_segment_path(base_path_, segment_index_);
+        fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd_ < 0) {
+            failed_ = true;
+            return false;
+        }
+        header_ = CaptureSegmentHeader{};
+        header_.magic = CAPTURE_MAGIC;
+        header_.version = CAPTURE_VERSION;
+        header_.segment_index = segment_index_;
+        header_.block_messages = static_cast<uint32_t>(CAPTURE_BLOCK_MESSAGES);
+        index_.clear();
+        if (!detail::write_all(fd_, &header_, sizeof(header_))) {
+            failed_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool write_block() noexcept {
+        // Roll over before writing so a full segment is never followed by an empty one
+        if (header_.block_count >= blocks_per_segment_) {
+            if (!finalize_segment()) {
+                return false;
+            }
+            ++segment_index_;
+            if (!open_segment()) {
+                return false;
+            }
+        }
+        if (block_.count < CAPTURE_BLOCK_MESSAGES) {
+            // Keep partial blocks deterministic on disk
+            std::memset(&block_.messages[block_.count], 0,
+                        (CAPTURE_BLOCK_MESSAGES - block_.count) * sizeof(RawMarketMessage));
+            std::memset(&block_.rx_timestamp_ns[block_.count], 0,
+                        (CAPTURE_BLOCK_MESSAGES - block_.count) * sizeof(uint64_t));
+        }
+        if (!detail::write_all(fd_, &block_, sizeof(block_))) {
+            failed_ = true;
+            return false;
+        }
+        if (header_.block_count == 0) {
+            header_.first_rx_ns = block_.first_rx_ns;
+        }
+        header_.last_rx_ns = block_.last_rx_ns;
+        header_.message_count += block_.count;
+        ++header_.block_count;
+        index_.push_back({block_.first_rx_ns, block_.last_rx_ns, block_.first_sequence, block_.count});
+        block_.count = 0;
+        return true;
+    }
+
+    bool finalize_segment() noexcept {
+        bool ok = !failed_;
+        if (ok) {
+            header_.index_offset = sizeof(CaptureSegmentHeader) + header_.block_count * sizeof(CaptureBlock);
+            ok = detail::write_all(fd_, index_.data(), index_.size() * sizeof(CaptureIndexEntry)) &&
+                 ::pwrite(fd_, &header_, sizeof(header_), 0) == static_cast<ssize_t>(sizeof(header_));
+        }
+        ::close(fd_);
+        fd_ = -1;
+        if (!ok) {
+            failed_ = true;
+            return false;
+        }
+        ++segments_written_;
+        return true;
+    }
+
+    std::string base_path_;
+    int fd_;
+    uint32_t segment_index_;
+    size_t blocks_per_segment_;
+    CaptureSegmentHeader header_;
+    CaptureBlock block_;
+    std::vector<CaptureIndexEntry> index_;
+    uint64_t messages_written_;
+    uint32_t segments_written_;
+    bool failed_;
+};
+
+// ========================= 3. Memory-Mapped Reader =========================
+
+/**
+ * @brief Maps every segment of a capture read-only
+ *
+ * Finalized segments use their on-disk index; a segment left unfinalized
+ * (writer crashed) is recovered from its file size and block headers.
+ * Blocks are exposed in capture order across segments.
+ */
+class CaptureReader {
+public:
+    CaptureReader() noexcept : message_count_(0) {}
+    ~CaptureReader() { close(); }
+
+    CaptureReader(const CaptureReader&) = delete;
+    CaptureReader& operator=(const CaptureReader&) = delete;
+
+    /**
+     * @brief Map <base_path>.00000, .00001, ... until a segment is missing
+     * @param prefault Populate the mappings up front (replay then measures
+     *                 the pipeline rather than page faults)
+     * @return false if no valid segment was found
+     */
+    bool open(const std::string& base_path, bool prefault = false) {
+        close();
+        for (uint32_t index = 0;; ++index) {
+            const std::string path = detail::capture_segment_path(base_path, index);
+            if (!map_segment(path, prefault)) {
+                break;
+            }
+        }
+        return !mappings_.empty();
+    }
+
+    void close() noexcept {
+        for (const auto& m : mappings_) {
+            ::munmap(const_cast<uint8_t*>(m.base), m.length);
+        }
+        mappings_.clear();
+        blocks_.clear();
+        index_.clear();
+        message_count_ = 0;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return !mappings_.empty(); }
+    [[nodiscard]] size_t segment_count() const noexcept { return mappings_.size(); }
+    [[nodiscard]] size_t block_count() const noexcept { return blocks_.size(); }
+    [[nodiscard]] uint64_t message_count() const noexcept { return message_count_; }
+    [[nodiscard]] const CaptureBlock& block(size_t i) const noexcept { return *blocks_[i]; }
+    [[nodiscard]] const CaptureIndexEntry& index(size_t i) const noexcept { return index_[i]; }
+
+    [[nodiscard]] HFTTimer::ns_t first_rx_ns() const noexcept {
+        return index_.empty() ? 0 : index_.front().first_rx_ns;
+    }
+    [[nodiscard]] HFTTimer::ns_t last_rx_ns() const noexcept {
+        return index_.empty() ? 0 : index_.back().last_rx_ns;
+    }
+
+    /**
+     * @brief First block containing a message received at or after rx_ns
+     * @return block_count() if every message is earlier
+     */
+    [[nodiscard]] size_t find_block(HFTTimer::ns_t rx_ns) const noexcept {
+        const auto it = std::lower_bound(index_.begin(), index_.end(), rx_ns,
+            [](const CaptureIndexEntry& e, HFTTimer::ns_t ts) { return e.last_rx_ns < ts; });
+        return static_cast<size_t>(it - index_.begin());
+    }
+
+private:
+    struct Mapping {
+        const uint8_t* base;
+        size_t length;
+    };
+
+    bool map_segment(const std::string& path, bool prefault) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(CaptureSegmentHeader)) {
+            ::close(fd);
+            return false;
+        }
+        const size_t length = static_cast<size_t>(st.st_size);
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        if (prefault) {
+            flags |= MAP_POPULATE;
+        }
+#endif
+        void* addr = ::mmap(nullptr, length, PROT_READ, flags, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            return false;
+        }
+
+        const auto* base = static_cast<const uint8_t*>(addr);
+        const auto* header = reinterpret_cast<const CaptureSegmentHeader*>(base);
+        if (header->magic != CAPTURE_MAGIC || header->version != CAPTURE_VERSION ||
+            header->block_messages != CAPTURE_BLOCK_MESSAGES) {
+            ::munmap(addr, length);
+            return false;
+        }
+        (void)::madvise(addr, length, MADV_SEQUENTIAL);
+        mappings_.push_back({base, length});
+
+        const auto* blocks = reinterpret_cast<const CaptureBlock*>(base + sizeof(CaptureSegmentHeader));
+        const size_t index_bytes = header->block_count * sizeof(CaptureIndexEntry);
+        const bool finalized = header->index_offset != 0 &&
+            header->index_offset == sizeof(CaptureSegmentHeader) + header->block_count * sizeof(CaptureBlock) &&
+            header->index_offset + index_bytes <= length;
+
+        if (finalized) {
+            const auto* entries = reinterpret_cast<const CaptureIndexEntry*>(base + header->index_offset);
+            for (size_t i = 0; i < header->block_count; ++i) {
+                add_block(&blocks[i], entries[i]);
+            }
+        } else {
+            // Unfinalized: every whole block on disk was written completely
+            const size_t block_count = (length - sizeof(CaptureSegmentHeader)) / sizeof(CaptureBlock);
+            for (size_t i = 0; i < block_count; ++i) {
+                const CaptureBlock& b = blocks[i];
+                if (b.count == 0 || b.count > CAPTURE_BLOCK_MESSAGES) {
+                    break;
+                }
+                add_block(&b, {b.first_rx_ns, b.last_rx_ns, b.first_sequence, b.count});
+            }
+        }
+        return true;
+    }
+
+    void add_block(const CaptureBlock* block, const CaptureIndexEntry& entry) {
+        if (entry.count == 0 || entry.count > CAPTURE_BLOCK_MESSAGES) {
+            return;
+        }
+        blocks_.push_back(block);
+        index_.push_back(entry);
+        message_count_ += entry.count;
+    }
+
+    std::vector<Mapping> mappings_;
+    std::vector<const CaptureBlock*> blocks_;
+    std::vector<CaptureIndexEntry> index_;
+    uint64_t message_count_;
+};
+
+// ========================= 4. Replay =========================
+
+enum class ReplayPace : uint8_t {
+    AsFastAsPossible,  // Deliver whole blocks back to back
+    Recorded           // Reproduce recorded inter-arrival gaps (scaled by speed)
+};
+
+struct ReplayStats {
+    uint64_t messages_delivered;
+    uint64_t deliveries;            // Sink invocations
+    HFTTimer::ns_t max_lag_ns;      // Recorded pace: worst delivery behind schedule
+};
+
+/**
+ * @brief Feeds a mapped capture to a sink straight from the mapping
+ *
+ * The sink is called as sink(const RawMarketMessage* msgs, size_t count,
+ * HFTTimer::ns_t rx_ns) with runs of contiguous messages inside one block
+ * (rx_ns is the recorded receive time of the run's last message). At
+ * recorded pace, messages that have fallen due are delivered together,
+ * so a slow sink catches up in larger runs instead of drifting.
+ */
+class CaptureReplayer {
+public:
+    explicit CaptureReplayer(const CaptureReader& reader) noexcept
+        : reader_(reader), pace_(ReplayPace::AsFastAsPossible), speed_(1.0),
+          block_(0), offset_(0), anchored_(false), anchor_wall_ns_(0), anchor_rx_ns_(0), stats_{} {}
+
+    void set_pace(ReplayPace pace, double speed = 1.0) noexcept {
+        pace_ = pace;
+        speed_ = speed > 0.0 ? speed : 1.0;
+        anchored_ = false;
+    }
+
+    void rewind() noexcept {
+        block_ = 0;
+        offset_ = 0;
+        anchored_ = false;
+        stats_ = {};
+    }
+
+    /**
+     * @brief Position at the first message received at or after rx_ns
+     */
+    void seek(HFTTimer::ns_t rx_ns) noexcept {
+        block_ = reader_.find_block(rx_ns);
+        offset_ = 0;
+        if (block_ < reader_.block_count()) {
+            const CaptureBlock& b = reader_.block(block_);
+            while (offset_ < b.count && b.rx_timestamp_ns[offset_] < rx_ns) {
+                ++offset_;
+            }
+        }
+        anchored_ = false;
+    }
+
+    [[nodiscard]] bool done() const noexcept { return block_ >= reader_.block_count(); }
+    [[nodiscard]] const ReplayStats& stats() const noexcept { return stats_; }
+
+    /**
+     * @brief Replay up to max_messages from the current position
+     * @return Messages delivered (0 once done())
+     */
+    template<typename Sink>
+    size_t replay(Sink&& sink, size_t max_messages = std::numeric_limits<size_t>::max()) {
+        size_t delivered = 0;
+        while (delivered < max_messages && !done()) {
+            const CaptureBlock& b = reader_.block(block_);
+            if (offset_ >= b.count) {
+                ++block_;
+                offset_ = 0;
+                continue;
+            }
+            if (block_ + 1 < reader_.block_count()) {
+                __builtin_prefetch(&reader_.block(block_ + 1), 0, 0);
+            }
+
+            size_t end = offset_ + std::min<size_t>(b.count - offset_, max_messages - delivered);
+            if (pace_ == ReplayPace::Recorded) {
+                end = paced_run_end(b, end);
+            }
+
+            const size_t n = end - offset_;
+            sink(&b.messages[offset_], n, static_cast<HFTTimer::ns_t>(b.rx_timestamp_ns[end - 1]));
+            delivered += n;
+            offset_ = end;
+            ++stats_.deliveries;
+        }
+        stats_.messages_delivered += delivered;
+        return delivered;
+    }
+
+    /**
+     * @brief Replay into a feed handler
+     *
+     * Each message is handed over with its recorded receive time, so the
+     * parsed ticks carry the timestamps seen live. The handler's parsed
+     * tick/trade buffers are bounded; drain them between calls
+     * (max_messages bounds each call).
+     */
+    size_t replay(TreasuryFeedHandler& handler, size_t max_messages = std::numeric_limits<size_t>::max()) {
+        return replay([this, &handler](const RawMarketMessage* msgs, size_t count, HFTTimer::ns_t) {
+            // The run starts at offset_ in the current block; split it where the receive time changes
+            const auto& rx_ns = reader_.block(block_).rx_timestamp_ns;
+            size_t start = 0;
+            for (size_t i = 1; i <= count; ++i) {
+                if (i == count || rx_ns[offset_ + i] != rx_ns[offset_ + start]) {
+                    (void)handler.process_messages(msgs + start, i - start,
+                                                   static_cast<HFTTimer::ns_t>(rx_ns[offset_ + start]));
+                    start = i;
+                }
+            }
+        }, max_messages);
+    }
+
+private:
+    // Wait for the message at offset_ to fall due, then take every due message up to limit
+    size_t paced_run_end(const CaptureBlock& b, size_t limit) noexcept {
+        if (!anchored_) {
+            anchored_ = true;
+            anchor_wall_ns_ = HFTTimer::get_timestamp_ns();
+            anchor_rx_ns_ = b.rx_timestamp_ns[offset_];
+        }
+        const HFTTimer::ns_t due = scheduled_wall_ns(b.rx_timestamp_ns[offset_]);
+        HFTTimer::ns_t now = HFTTimer::get_timestamp_ns();
+        while (now < due) {
+            cpu_relax();
+            now = HFTTimer::get_timestamp_ns();
+        }
+        if (now - due > stats_.max_lag_ns) {
+            stats_.max_lag_ns = now - due;
+        }
+
+        size_t end = offset_ + 1;
+        while (end < limit && scheduled_wall_ns(b.rx_timestamp_ns[end]) <= now) {
+            ++end;
+        }
+        return end;
+    }
+
+    HFTTimer::ns_t scheduled_wall_ns(uint64_t rx_ns) const noexcept {
+        // Out-of-order receive stamps (e.g. A/B line merge) are due immediately
+        const uint64_t offset = rx_ns > anchor_rx_ns_ ? rx_ns - anchor_rx_ns_ : 0;
+        return anchor_wall_ns_ + static_cast<HFTTimer::ns_t>(static_cast<double>(offset) / speed_);
+    }
+
+    const CaptureReader& reader_;
+    ReplayPace pace_;
+    double speed_;
+    size_t block_;
+    size_t offset_;
+    bool anchored_;
+    HFTTimer::ns_t anchor_wall_ns_;
+    uint64_t anchor_rx_ns_;
+    ReplayStats stats_;
+};
+
+} // namespace market_data
+} // namespace hft
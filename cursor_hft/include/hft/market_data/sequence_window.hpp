@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace hft {
+namespace market_data {
+
+/**
+ * @brief Bitmap sliding window over exchange sequence numbers
+ *
+ * Tracks which of the last WindowSize sequence numbers (ending at the
+ * highest seen) have arrived, one bit each, keyed on seq % WindowSize:
+ * - observe() classifies and records a sequence in O(1)
+ * - Advancing the window clears only the bits it slides over
+ * - Sequences more than WindowSize behind the highest are Stale (their
+ *   bit has been reused and arrival cannot be determined)
+ *
+ * @tparam WindowSize Window length in sequences (power of 2, multiple of 64)
+ */
+template<size_t WindowSize = 1024>
+class SequenceWindow {
+    static_assert((WindowSize & (WindowSize - 1)) == 0, "WindowSize must be a power of 2");
+    static_assert(WindowSize >= 64, "WindowSize must be at least 64");
+
+public:
+    enum class Status : uint8_t {
+        InOrder,    // highest + 1 (or first sequence seen)
+        Gap,        // beyond highest + 1; the sequences in between are missing
+        LateFill,   // inside the window and not seen before
+        Duplicate,  // already seen
+        Stale       // older than the window
+    };
+
+    SequenceWindow() noexcept { reset(); }
+
+    /**
+     * @brief Classify a sequence and record it as received
+     */
+    Status observe(uint64_t seq) noexcept {
+        if (__builtin_expect(!initialized_, 0)) {
+            initialized_ = true;
+            highest_ = seq;
+            set(seq);
+            return Status::InOrder;
+        }
+
+        if (__builtin_expect(seq > highest_, 1)) {
+            const uint64_t distance = seq - highest_;
+            advance_to(seq);
+            return distance == 1 ? Status::InOrder : Status::Gap;
+        }
+
+        if (highest_ - seq >= WindowSize) {
+            return Status::Stale;
+        }
+        if (test(seq)) {
+            return Status::Duplicate;
+        }
+        set(seq);
+        return Status::LateFill;
+    }
+
+    /**
+     * @brief Whether a sequence inside the window has been received
+     */
+    [[nodiscard]] bool contains(uint64_t seq) const noexcept {
+        return initialized_ && seq <= highest_ && highest_ - seq < WindowSize && test(seq);
+    }
+
+    /**
+     * @brief Whether observe(seq) would report Duplicate or Stale
+     */
+    [[nodiscard]] bool is_duplicate(uint64_t seq) const noexcept {
+        return initialized_ && seq <= highest_ && (highest_ - seq >= WindowSize || test(seq));
+    }
+
+    [[nodiscard]] uint64_t highest() const noexcept { return highest_; }
+    [[nodiscard]] bool empty() const noexcept { return !initialized_; }
+    static constexpr size_t window_size() noexcept { return WindowSize; }
+
+    void reset() noexcept {
+        bits_.fill(0);
+        highest_ = 0;
+        initialized_ = false;
+    }
+
+private:
+    static constexpr size_t WORDS = WindowSize / 64;
+
+    bool test(uint64_t seq) const noexcept {
+        const size_t bit = seq & (WindowSize - 1);
+        return (bits_[bit >> 6] >> (bit & 63)) & 1u;
+    }
+
+    void set(uint64_t seq) noexcept {
+        const size_t bit = seq & (WindowSize - 1);
+        bits_[bit >> 6] |= uint64_t{1} << (bit & 63);
+    }
+
+    void clear(uint64_t seq) noexcept {
+        const size_t bit = seq & (WindowSize - 1);
+        bits_[bit >> 6] &= ~(uint64_t{1} << (bit & 63));
+    }
+
+    // Slide the window so seq is the highest; slots passed over become unseen
+    void advance_to(uint64_t seq) noexcept {
+        const uint64_t distance = seq - highest_;
+        if (distance >= WindowSize) {
+            bits_.fill(0);
+        } else {
+            for (uint64_t s = highest_ + 1; s < seq; ++s) {
+                clear(s);
+            }
+        }
+        clear(seq);
+        set(seq);
+        highest_ = seq;
+    }
+
+    std::array<uint64_t, WORDS> bits_;
+    uint64_t highest_;
+    bool initialized_;
+};
+
+} // namespace market_data
+} // namespace hft
@@ -0,0 +1,372 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include "hft/market_data/treasury_instruments.hpp"
+#include "hft/timing/hft_timer.hpp"
+#include "hft/config/system_traits.hpp"
+
+namespace hft {
+namespace market_data {
+
+/**
+ * @brief Mean/variance over the last Window samples, updated in O(1)
+ *
+ * Sliding Welford update: a push replaces the sample falling out of the
+ * ring and corrects the running mean and sum of squared deviations in
+ * place. Unlike raw sums this does not cancel catastrophically, so there is
+ * no periodic rescan of the ring and every push costs the same regardless
+ * of Window (10k+ sample windows are fine).
+ */
+template<size_t Window>
+class RollingStats {
+    static_assert(Window >= 2, "RollingStats needs a window of at least 2");
+
+public:
+    RollingStats() noexcept { reset(); }
+
+    void push(double x) noexcept {
+        if (__builtin_expect(count_ == Window, 1)) {
+            const double old = samples_[head_];
+            const double old_mean = mean_;
+            mean_ += (x - old) * INV_WINDOW;
+            m2_ += (x - old) * (x - mean_ + old - old_mean);
+        } else {
+            ++count_;
+            const double delta = x - mean_;
+            mean_ += delta / static_cast<double>(count_);
+            m2_ += delta * (x - mean_);
+        }
+        samples_[head_] = x;
+        if (++head_ == Window) head_ = 0;
+    }
+
+    [[nodiscard]] size_t count() const noexcept { return count_; }
+    [[nodiscard]] double mean() const noexcept { return mean_; }
+    [[nodiscard]] double mean_square() const noexcept { return count_ ? variance() + mean_ * mean_ : 0.0; }
+    [[nodiscard]] double rms() const noexcept { return std::sqrt(mean_square()); }
+
+    /** @brief Population variance */
+    [[nodiscard]] double variance() const noexcept {
+        return count_ >= 2 ? std::max(m2_, 0.0) / static_cast<double>(count_) : 0.0;
+    }
+
+    void reset() noexcept {
+        samples_.fill(0.0);
+        head_ = 0;
+        count_ = 0;
+        mean_ = 0.0;
+        m2_ = 0.0;
+    }
+
+private:
+    static constexpr double INV_WINDOW = 1.0 / static_cast<double>(Window);
+
+    alignas(64) std::array<double, Window> samples_;
+    size_t head_;
+    size_t count_;
+    double mean_;
+    double m2_;                                         // Sum of squared deviations from mean_
+};
+
+/**
+ * @brief Running mean and variance of every sample since reset (Welford)
+ */
+class WelfordStats {
+public:
+    WelfordStats() noexcept : count_(0), mean_(0.0), m2_(0.0) {}
+
+    void push(double x) noexcept {
+        ++count_;
+        const double delta = x - mean_;
+        mean_ += delta / static_cast<double>(count_);
+        m2_ += delta * (x - mean_);
+    }
+
+    [[nodiscard]] uint64_t count() const noexcept { return count_; }
+    [[nodiscard]] double mean() const noexcept { return mean_; }
+
+    /** @brief Population variance */
+    [[nodiscard]] double variance() const noexcept {
+        return count_ >= 2 ? m2_ / static_cast<double>(count_) : 0.0;
+    }
+
+    /** @brief Unbiased (n - 1) variance */
+    [[nodiscard]] double sample_variance() const noexcept {
+        return count_ >= 2 ? m2_ / static_cast<double>(count_ - 1) : 0.0;
+    }
+
+    void reset() noexcept {
+        count_ = 0;
+        mean_ = 0.0;
+        m2_ = 0.0;
+    }
+
+private:
+    uint64_t count_;
+    double mean_;
+    double m2_;
+};
+
+/**
+ * @brief Exponentially weighted mean and variance
+ */
+class EwmaStats {
+public:
+    explicit EwmaStats(double alpha = 0.06) noexcept : alpha_(alpha), mean_(0.0), variance_(0.0), initialized_(false) {}
+
+    void push(double x) noexcept {
+        if (__builtin_expect(!initialized_, 0)) {
+            initialized_ = true;
+            mean_ = x;
+            variance_ = 0.0;
+            return;
+        }
+        const double delta = x - mean_;
+        mean_ += alpha_ * delta;
+        variance_ = (1.0 - alpha_) * (variance_ + alpha_ * delta * delta);
+    }
+
+    [[nodiscard]] double mean() const noexcept { return mean_; }
+    [[nodiscard]] double variance() const noexcept { return variance_; }
+    [[nodiscard]] double alpha() const noexcept { return alpha_; }
+
+    void reset() noexcept {
+        mean_ = 0.0;
+        variance_ = 0.0;
+        initialized_ = false;
+    }
+
+private:
+    double alpha_;
+    double mean_;
+    double variance_;
+    bool initialized_;
+};
+
+/**
+ * @brief Columnar tick history per TreasuryType with incremental statistics
+ *
+ * Each instrument keeps a fixed-capacity ring per field (bid, ask, sizes,
+ * yields, timestamp), each column contiguous and cache-line aligned so
+ * analytics can run SIMD kernels over them. Rolling mid-price and
+ * mid-return statistics, an EWMA and a session-long Welford estimate of
+ * returns update on every record; the realized volatility is taken once
+ * per record, so readers pay a load instead of a rescan or a sqrt.
+ *
+ * Single writer. One store can be shared by strategies and risk on the
+ * market data thread; see AdvancedMarketMaker and RiskControlSystem.
+ *
+ * @tparam Capacity Ticks retained per instrument (power of 2)
+ * @tparam StatsWindow Prices covered by the rolling statistics (returns: StatsWindow - 1).
+ *         The statistics keep their own rings, so the window may exceed Capacity.
+ */
+template<size_t Capacity = 1024, size_t StatsWindow = 1000>
+class alignas(64) TickStore {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+    static_assert(StatsWindow >= 3, "StatsWindow must cover at least two returns");
+
+public:
+    static constexpr size_t MAX_INSTRUMENTS = config::SystemTraits::MAX_INSTRUMENTS;
+    static constexpr size_t CAPACITY = Capacity;
+    static constexpr size_t STATS_WINDOW = StatsWindow;
+
+    enum class Column : uint8_t { Bid, Ask, Mid, BidYield, AskYield };
+
+    /**
+     * @brief A column's retained samples as (at most) two contiguous runs, oldest first
+     */
+    struct ColumnView {
+        const double* first;
+        size_t first_count;
+        const double* second;
+        size_t second_count;
+
+        [[nodiscard]] size_t size() const noexcept { return first_count + second_count; }
+        [[nodiscard]] double operator[](size_t i) const noexcept {
+            return i < first_count ? first[i] : second[i - first_count];
+        }
+    };
+
+    struct alignas(64) InstrumentColumns {
+        alignas(64) std::array<double, Capacity> bid;
+        alignas(64) std::array<double, Capacity> ask;
+        alignas(64) std::array<double, Capacity> mid;
+        alignas(64) std::array<uint64_t, Capacity> bid_size;
+        alignas(64) std::array<uint64_t, Capacity> ask_size;
+        alignas(64) std::array<double, Capacity> bid_yield;
+        alignas(64) std::array<double, Capacity> ask_yield;
+        alignas(64) std::array<HFTTimer::timestamp_t, Capacity> timestamp_ns;
+        uint64_t total;  // Ticks ever recorded (head = total % Capacity)
+        RollingStats<StatsWindow> mid_stats;
+        RollingStats<StatsWindow - 1> return_stats;
+        EwmaStats ewma_return;
+        WelfordStats session_return;                    // Every return since reset
+        double realized_vol;                            // return_stats.rms() as of the last record
+    };
+
+    TickStore() noexcept : columns_() { reset(); }
+
+    // No copy or move (shared by reference)
+    TickStore(const TickStore&) = delete;
+    TickStore& operator=(const TickStore&) = delete;
+
+    /**
+     * @brief Record a full quote
+     */
+    void record(TreasuryType instrument, double bid, double ask, uint64_t bid_size, uint64_t ask_size,
+                double bid_yield, double ask_yield, HFTTimer::timestamp_t timestamp_ns) noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        if (__builtin_expect(index >= MAX_INSTRUMENTS, 0)) return;
+
+        auto& c = columns_[index];
+        const size_t slot = c.total & (Capacity - 1);
+        const double mid = (bid + ask) / 2.0;
+
+        if (c.total > 0) {
+            const double prev = c.mid[(c.total - 1) & (Capacity - 1)];
+            if (__builtin_expect(prev > 0.0, 1)) {
+                const double ret = (mid - prev) / prev;
+                c.return_stats.push(ret);
+                c.ewma_return.push(ret);
+                c.session_return.push(ret);
+                c.realized_vol = c.return_stats.rms();
+            }
+        }
+
+        c.bid[slot] = bid;
+        c.ask[slot] = ask;
+        c.mid[slot] = mid;
+        c.bid_size[slot] = bid_size;
+        c.ask_size[slot] = ask_size;
+        c.bid_yield[slot] = bid_yield;
+        c.ask_yield[slot] = ask_yield;
+        c.timestamp_ns[slot] = timestamp_ns;
+        c.mid_stats.push(mid);
+        ++c.total;
+    }
+
+    void record(const TreasuryTick& tick) noexcept {
+        record(tick.instrument_type, tick.bid_price.to_decimal(), tick.ask_price.to_decimal(),
+               tick.bid_size, tick.ask_size, tick.bid_yield, tick.ask_yield, tick.timestamp_ns);
+    }
+
+    /**
+     * @brief Record a single mark price (bid = ask = price)
+     */
+    void record_price(TreasuryType instrument, double price, HFTTimer::timestamp_t timestamp_ns) noexcept {
+        record(instrument, price, price, 0, 0, 0.0, 0.0, timestamp_ns);
+    }
+
+    [[nodiscard]] size_t size(TreasuryType instrument) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        if (index >= MAX_INSTRUMENTS) return 0;
+        return columns_[index].total < Capacity ? columns_[index].total : Capacity;
+    }
+
+    [[nodiscard]] uint64_t total_recorded(TreasuryType instrument) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? columns_[index].total : 0;
+    }
+
+    /**
+     * @brief Most recent mid price (0 if none)
+     */
+    [[nodiscard]] double last_mid(TreasuryType instrument) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        if (index >= MAX_INSTRUMENTS || columns_[index].total == 0) return 0.0;
+        const auto& c = columns_[index];
+        return c.mid[(c.total - 1) & (Capacity - 1)];
+    }
+
+    /**
+     * @brief Root mean square of mid returns over the stats window
+     *
+     * The per-tick volatility measure both the market maker and risk use.
+     */
+    [[nodiscard]] double realized_volatility(TreasuryType instrument) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? columns_[index].realized_vol : 0.0;
+    }
+
+    [[nodiscard]] double ewma_volatility(TreasuryType instrument) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? std::sqrt(columns_[index].ewma_return.variance()) : 0.0;
+    }
+
+    /**
+     * @brief Standard deviation of every mid return since reset
+     */
+    [[nodiscard]] double session_volatility(TreasuryType instrument) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? std::sqrt(columns_[index].session_return.variance()) : 0.0;
+    }
+
+    [[nodiscard]] const RollingStats<StatsWindow>& mid_stats(TreasuryType instrument) const noexcept {
+        return columns(instrument).mid_stats;
+    }
+
+    [[nodiscard]] const RollingStats<StatsWindow - 1>& return_stats(TreasuryType instrument) const noexcept {
+        return columns(instrument).return_stats;
+    }
+
+    /** @brief An instrument's columns; empty ones for instruments outside this build's universe */
+    [[nodiscard]] const InstrumentColumns& columns(TreasuryType instrument) const noexcept {
+        static const InstrumentColumns none = InstrumentColumns();
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? columns_[index] : none;
+    }
+
+    [[nodiscard]] ColumnView view(TreasuryType instrument, Column column) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        if (index >= MAX_INSTRUMENTS) return {nullptr, 0, nullptr, 0};
+        const auto& c = columns_[index];
+        const double* data = column_data(c, column);
+        if (c.total <= Capacity) {
+            return {data, static_cast<size_t>(c.total), nullptr, 0};
+        }
+        const size_t head = c.total & (Capacity - 1);
+        return {data + head, Capacity - head, data, head};
+    }
+
+    void reset(TreasuryType instrument) noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        if (index >= MAX_INSTRUMENTS) return;
+        auto& c = columns_[index];
+        c.total = 0;
+        c.mid_stats.reset();
+        c.return_stats.reset();
+        c.ewma_return.reset();
+        c.session_return.reset();
+        c.realized_vol = 0.0;
+    }
+
+    void reset() noexcept {
+        for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+            reset(static_cast<TreasuryType>(i));
+        }
+    }
+
+private:
+    static const double* column_data(const InstrumentColumns& c, Column column) noexcept {
+        switch (column) {
+            case Column::Bid: return c.bid.data();
+            case Column::Ask: return c.ask.data();
+            case Column::Mid: return c.mid.data();
+            case Column::BidYield: return c.bid_yield.data();
+            case Column::AskYield: return c.ask_yield.data();
+        }
+        return c.mid.data();
+    }
+
+    std::array<InstrumentColumns, MAX_INSTRUMENTS> columns_;
+};
+
+/** @brief Store shared by the market maker and risk (VOLATILITY_WINDOW = 1000) */
+using MarketTickStore = TickStore<1024, 1000>;
+
+} // namespace market_data
+} // namespace hft
@@ -28,6 +28,9 @@ enum class TreasuryType : uint8_t {
     Bond_30Y
 };
 
+// Instrument slots: TreasuryType values run 0..TREASURY_TYPE_COUNT-1
+constexpr size_t TREASURY_TYPE_COUNT = static_cast<size_t>(TreasuryType::Bond_30Y) + 1;
+
 // Treasury instrument definition
 struct alignas(CACHE_LINE_SIZE) TreasuryInstrument {
     TreasuryType type;                // 1 byte
@@ -99,7 +102,8 @@ public:
 // Market data tick integrated with SPSC ring buffers
 struct alignas(CACHE_LINE_SIZE) TreasuryTick {
     TreasuryType instrument_type;                // 1
-    uint8_t _pad0[7];                           // 7 (align to 8)
+    uint8_t _pad0[3];                           // 3 (align to 4)
+    uint32_t trace_id;                          // 4 (LatencyTracer ID, 0 = untraced)
     hft::HFTTimer::timestamp_t timestamp_ns;    // 8
     Price32nd bid_price;                        // 8
     Price32nd ask_price;                        // 8
@@ -107,7 +111,7 @@ struct alignas(CACHE_LINE_SIZE) TreasuryTick {
     uint64_t ask_size;                          // 8
     double bid_yield;                           // 8
     double ask_yield;                           // 8
-    // 1+7+8+8+8+8+8+8+8 = 64
+    // 1+3+4+8+8+8+8+8+8+8 = 64
     bool is_valid() const noexcept {
         return bid_price.whole > 0 && ask_price.whole > 0 && bid_size > 0 && ask_size > 0;
     }
@@ -0,0 +1,349 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#if defined(__linux__)
+#include <linux/net_tstamp.h>
+#include <linux/errqueue.h>
+#endif
+#include "hft/market_data/feed_handler.hpp"
+#include "hft/timing/hft_timer.hpp"
+
+namespace hft {
+namespace market_data {
+
+/**
+ * @brief Socket settings for one multicast (or unicast) feed line
+ */
+struct UdpFeedConfig {
+    const char* bind_address = "0.0.0.0";
+    uint16_t port = 0;                        // 0: ephemeral (see bound_port())
+    const char* multicast_group = nullptr;    // nullptr: plain unicast
+    const char* interface_address = nullptr;  // Multicast interface (nullptr: INADDR_ANY)
+    int receive_buffer_bytes = 8 * 1024 * 1024;
+    bool hardware_timestamps = true;          // SO_TIMESTAMPING (falls back to software)
+    int busy_poll_us = 0;                     // SO_BUSY_POLL (0: off)
+};
+
+/**
+ * @brief Pre-registered receive buffers for one batch of datagrams
+ *
+ * Datagram i lands at messages[i * MessagesPerDatagram]; the backend
+ * receives straight into this storage and consumers read it in place.
+ *
+ * @tparam BatchSize Datagrams per receive call
+ * @tparam MessagesPerDatagram Maximum RawMarketMessages per datagram
+ */
+template<size_t BatchSize = 64, size_t MessagesPerDatagram = 1>
+struct alignas(64) PacketBatch {
+    static_assert(BatchSize > 0 && MessagesPerDatagram > 0, "PacketBatch must hold at least one message");
+
+    static constexpr size_t BATCH_SIZE = BatchSize;
+    static constexpr size_t MESSAGES_PER_DATAGRAM = MessagesPerDatagram;
+    static constexpr size_t DATAGRAM_BYTES = MessagesPerDatagram * sizeof(RawMarketMessage);
+
+    std::array<RawMarketMessage, BatchSize * MessagesPerDatagram> messages;
+    std::array<uint32_t, BatchSize> message_count;       // Whole messages in datagram i
+    std::array<HFTTimer::ns_t, BatchSize> rx_timestamp_ns; // CLOCK_REALTIME / PHC domain, 0 if none
+    std::array<bool, BatchSize> hardware_timestamp;
+    size_t datagrams = 0;
+
+    const RawMarketMessage* datagram(size_t i) const noexcept { return &messages[i * MessagesPerDatagram]; }
+};
+
+/**
+ * @brief Kernel socket backend: one recvmmsg() per batch
+ *
+ * Backends share this interface so kernel-bypass implementations
+ * (ef_vi, DPDK, AF_XDP) can be dropped into FeedIngestor:
+ * - bool open(const UdpFeedConfig&, PacketBatch&): bind and register buffers
+ * - size_t receive(PacketBatch&): non-blocking, fills up to BATCH_SIZE datagrams
+ * - void close()
+ *
+ * iovecs and control buffers are built once in open() and point directly
+ * into the PacketBatch, so receive() is a single syscall with no copies.
+ */
+template<size_t BatchSize = 64, size_t MessagesPerDatagram = 1>
+class RecvmmsgBackend {
+public:
+    using Batch = PacketBatch<BatchSize, MessagesPerDatagram>;
+
+    RecvmmsgBackend() noexcept : fd_(-1), bound_port_(0), hardware_timestamps_(false), software_timestamps_(false) {}
+    ~RecvmmsgBackend() { close(); }
+
+    // No copy or move (registered pointers refer to this object)
+    RecvmmsgBackend(const RecvmmsgBackend&) = delete;
+    RecvmmsgBackend& operator=(const RecvmmsgBackend&) = delete;
+
+    /**
+     * @brief Open, bind and (optionally) join the multicast group
+     * @return false on socket/bind/join failure (timestamping failures are not fatal)
+     */
+    bool open(const UdpFeedConfig& config, Batch& batch) noexcept {
+        close();
+        fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+
+        const int one = 1;
+        (void)::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (config.receive_buffer_bytes > 0) {
+            (void)::setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &config.receive_buffer_bytes, sizeof(int));
+        }
+#ifdef SO_BUSY_POLL
+        if (config.busy_poll_us > 0) {
+            (void)::setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &config.busy_poll_us, sizeof(int));
+        }
+#endif
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(config.port);
+        if (::inet_pton(AF_INET, config.bind_address, &addr.sin_addr) != 1 ||
+            ::bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            close();
+            return false;
+        }
+        socklen_t len = sizeof(addr);
+        if (::getsockname(fd_, reinterpret_cast<sockaddr*>(&addr), &len) == 0) {
+            bound_port_ = ntohs(addr.sin_port);
+        }
+
+        if (config.multicast_group) {
+            ip_mreq mreq{};
+            if (::inet_pton(AF_INET, config.multicast_group, &mreq.imr_multiaddr) != 1) {
+                close();
+                return false;
+            }
+            mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+            if (config.interface_address) {
+                (void)::inet_pton(AF_INET, config.interface_address, &mreq.imr_interface);
+            }
+            if (::setsockopt(fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) != 0) {
+                close();
+                return false;
+            }
+        }
+
+        enable_timestamps(config.hardware_timestamps);
+        register_buffers(batch);
+        return true;
+    }
+
+    void close() noexcept {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        hardware_timestamps_ = false;
+        software_timestamps_ = false;
+    }
+
+    /**
+     * @brief Receive up to BatchSize datagrams with one syscall (non-blocking)
+     * @return Number of datagrams received (0 if none pending or on error)
+     */
+    size_t receive(Batch& batch) noexcept {
+        batch.datagrams = 0;
+        if (__builtin_expect(fd_ < 0, 0)) {
+            return 0;
+        }
+        for (size_t i = 0; i < BatchSize; ++i) {
+            headers_[i].msg_hdr.msg_controllen = sizeof(control_[i]);
+        }
+        const int n = ::recvmmsg(fd_, headers_.data(), static_cast<unsigned int>(BatchSize), MSG_DONTWAIT, nullptr);
+        if (n <= 0) {
+            return 0;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            // Truncated trailing bytes are not a whole message and are ignored
+            batch.message_count[i] = static_cast<uint32_t>(headers_[i].msg_len / sizeof(RawMarketMessage));
+            batch.rx_timestamp_ns[i] = 0;
+            batch.hardware_timestamp[i] = false;
+            if (hardware_timestamps_ || software_timestamps_) {
+                read_timestamp(headers_[i].msg_hdr, batch.rx_timestamp_ns[i], batch.hardware_timestamp[i]);
+            }
+        }
+        batch.datagrams = static_cast<size_t>(n);
+        return batch.datagrams;
+    }
+
+    [[nodiscard]] int fd() const noexcept { return fd_; }
+    [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+    [[nodiscard]] uint16_t bound_port() const noexcept { return bound_port_; }
+    [[nodiscard]] bool hardware_timestamps() const noexcept { return hardware_timestamps_; }
+    [[nodiscard]] bool software_timestamps() const noexcept { return software_timestamps_; }
+
+private:
+    static constexpr size_t CONTROL_BYTES = 128;
+
+    void register_buffers(Batch& batch) noexcept {
+        for (size_t i = 0; i < BatchSize; ++i) {
+            iov_[i].iov_base = &batch.messages[i * MessagesPerDatagram];
+            iov_[i].iov_len = Batch::DATAGRAM_BYTES;
+            std::memset(&headers_[i], 0, sizeof(headers_[i]));
+            headers_[i].msg_hdr.msg_iov = &iov_[i];
+            headers_[i].msg_hdr.msg_iovlen = 1;
+            headers_[i].msg_hdr.msg_control = control_[i].data();
+            headers_[i].msg_hdr.msg_controllen = sizeof(control_[i]);
+        }
+    }
+
+    void enable_timestamps(bool hardware) noexcept {
+#if defined(__linux__) && defined(SO_TIMESTAMPING)
+        int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        if (hardware) {
+            flags |= SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+            if (::setsockopt(fd_, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0) {
+                hardware_timestamps_ = true;
+                software_timestamps_ = true;
+                return;
+            }
+            flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        }
+        software_timestamps_ = ::setsockopt(fd_, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0;
+#else
+        (void)hardware;
+#endif
+    }
+
+    // Prefer the raw hardware stamp (ts[2]); fall back to the software stamp (ts[0])
+    static void read_timestamp(const msghdr& hdr, HFTTimer::ns_t& out, bool& hardware) noexcept {
+#if defined(__linux__) && defined(SO_TIMESTAMPING)
+        for (cmsghdr* c = CMSG_FIRSTHDR(const_cast<msghdr*>(&hdr)); c; c = CMSG_NXTHDR(const_cast<msghdr*>(&hdr), c)) {
+            if (c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_TIMESTAMPING) {
+                continue;
+            }
+            timespec ts[3];
+            std::memcpy(ts, CMSG_DATA(c), sizeof(ts));
+            const timespec& chosen = (ts[2].tv_sec || ts[2].tv_nsec) ? ts[2] : ts[0];
+            hardware = &chosen == &ts[2];
+            out = static_cast<HFTTimer::ns_t>(chosen.tv_sec) * 1000000000ULL + static_cast<HFTTimer::ns_t>(chosen.tv_nsec);
+            return;
+        }
+#else
+        (void)hdr;
+        (void)out;
+        (void)hardware;
+#endif
+    }
+
+    int fd_;
+    uint16_t bound_port_;
+    bool hardware_timestamps_;
+    bool software_timestamps_;
+    std::array<mmsghdr, BatchSize> headers_;
+    std::array<iovec, BatchSize> iov_;
+    alignas(8) std::array<std::array<char, CONTROL_BYTES>, BatchSize> control_;
+};
+
+/**
+ * @brief Poll loop glue: backend receive -> handler, zero copy
+ *
+ * Messages are handed to the consumer in place from the registered
+ * buffers, each with its own datagram's receive timestamp. Consecutive
+ * full datagrams are contiguous in memory, so those sharing a timestamp
+ * (none, or coalesced by the NIC) are passed as one run; the feed handler
+ * overloads stamp it into each tick's timestamp_ns.
+ *
+ * @tparam Backend Receive backend (RecvmmsgBackend or a kernel-bypass equivalent)
+ */
+template<typename Backend = RecvmmsgBackend<>>
+class FeedIngestor {
+public:
+    using Batch = typename Backend::Batch;
+
+    struct IngestStats {
+        uint64_t receive_calls = 0;
+        uint64_t empty_polls = 0;
+        uint64_t datagrams = 0;
+        uint64_t messages = 0;
+        uint64_t hardware_timestamped = 0;
+        HFTTimer::ns_t last_rx_timestamp_ns = 0;
+    };
+
+    FeedIngestor() noexcept : stats_{} {}
+
+    bool open(const UdpFeedConfig& config) noexcept { return backend_.open(config, batch_); }
+    void close() noexcept { backend_.close(); }
+
+    /**
+     * @brief Receive one batch and pass it to consume(messages, count, rx_timestamp_ns)
+     * @return Number of messages delivered
+     */
+    template<typename Consumer>
+    size_t poll(Consumer&& consume) noexcept {
+        ++stats_.receive_calls;
+        const size_t datagrams = backend_.receive(batch_);
+        if (datagrams == 0) {
+            ++stats_.empty_polls;
+            return 0;
+        }
+        stats_.datagrams += datagrams;
+
+        size_t delivered = 0;
+        size_t run_start = 0;
+        size_t run_count = 0;
+        for (size_t i = 0; i < datagrams; ++i) {
+            const size_t count = batch_.message_count[i];
+            stats_.hardware_timestamped += batch_.hardware_timestamp[i];
+            if (batch_.rx_timestamp_ns[i]) {
+                stats_.last_rx_timestamp_ns = batch_.rx_timestamp_ns[i];
+            }
+            run_count += count;
+            // A short datagram ends the contiguous run, as does a change of receive time
+            if (count < Batch::MESSAGES_PER_DATAGRAM || i + 1 == datagrams ||
+                batch_.rx_timestamp_ns[i + 1] != batch_.rx_timestamp_ns[i]) {
+                if (run_count > 0) {
+                    consume(&batch_.messages[run_start], run_count, batch_.rx_timestamp_ns[i]);
+                    delivered += run_count;
+                }
+                run_start = (i + 1) * Batch::MESSAGES_PER_DATAGRAM;
+                run_count = 0;
+            }
+        }
+        stats_.messages += delivered;
+        return delivered;
+    }
+
+    /**
+     * @brief Receive one batch into a feed handler; ticks carry their datagram's receive time
+     */
+    size_t poll(TreasuryFeedHandler& handler) noexcept {
+        return poll([&handler](const RawMarketMessage* msgs, size_t count, HFTTimer::ns_t rx_ns) noexcept {
+            (void)handler.process_messages(msgs, count, rx_ns);
+        });
+    }
+
+    /**
+     * @brief Receive one batch as one line of an A/B arbitrator
+     */
+    size_t poll(FeedArbitrator& arbitrator, FeedArbitrator::Line line) noexcept {
+        return poll([&arbitrator, line](const RawMarketMessage* msgs, size_t count, HFTTimer::ns_t rx_ns) noexcept {
+            (void)arbitrator.process_line(line, msgs, count, rx_ns, true);
+        });
+    }
+
+    Backend& backend() noexcept { return backend_; }
+    const Batch& batch() const noexcept { return batch_; }
+    const IngestStats& stats() const noexcept { return stats_; }
+
+private:
+    Batch batch_;
+    Backend backend_;
+    IngestStats stats_;
+};
+
+} // namespace market_data
+} // namespace hft
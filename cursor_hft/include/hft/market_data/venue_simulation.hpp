@@ -9,11 +9,16 @@
 #include <string_view>
 #include <random>
 #include <atomic>
+#include <cstdio>
+#include <memory>
 #include <utility>
 #include "hft/market_data/treasury_instruments.hpp"
 #include "hft/timing/hft_timer.hpp"
+#include "hft/timing/event_queue.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
+#include "hft/memory/fixed_hash_map.hpp"
+#include "hft/trading/book_manager.hpp"
 
 namespace hft {
 namespace market_data {
@@ -41,7 +46,7 @@ enum class OrderStatus : uint8_t {
     Expired            // Time-based expiration
 };
 
-// Cache-aligned order structure
+// Cache-aligned order structure (two lines)
 struct alignas(CACHE_LINE_SIZE) TreasuryOrder {
     uint64_t order_id;                          // Unique order identifier
     uint64_t client_order_id;                   // Client-side tracking ID
@@ -53,28 +58,28 @@ struct alignas(CACHE_LINE_SIZE) TreasuryOrder {
     OrderStatus status;                         // Current order status
     Price32nd limit_price;                      // Limit price in 32nds
     double yield_limit;                         // For yield-based orders (4 decimals)
-    uint64_t quantity;                          // Order size in millions
+    uint64_t quantity;                          // Order size, face value (as TreasuryTick sizes)
     uint64_t filled_quantity;                   // Already filled amount
     uint64_t remaining_quantity;                // Unfilled amount
     char venue_order_id[16];                    // Venue-assigned ID
-    uint8_t _pad[8];                           // Pad to 64 bytes
+    uint8_t _pad[32];                           // Pad to 128 bytes
 };
-static_assert(sizeof(TreasuryOrder) == CACHE_LINE_SIZE, "TreasuryOrder must be 64 bytes");
+static_assert(sizeof(TreasuryOrder) == 2 * CACHE_LINE_SIZE, "TreasuryOrder must be 128 bytes");
 
 // Venue response messages
 struct alignas(CACHE_LINE_SIZE) VenueResponse {
     uint64_t order_id;                          // References TreasuryOrder
-    HFTTimer::timestamp_t timestamp_venue_ns;   // Venue timestamp
-    OrderStatus new_status;                     // Status update
+    HFTTimer::timestamp_t timestamp_venue_ns;   // When the response reaches us (modelled)
     uint64_t fill_quantity;                     // If filled, how much
     Price32nd fill_price;                       // If filled, at what price
     char venue_order_id[16];                    // Venue tracking ID
-    char reject_reason[24];                     // If rejected, why
-    uint8_t _pad[7];                           // Pad to 64 bytes
+    OrderStatus new_status;                     // Status update
+    char reject_reason[15];                     // If rejected, why
+    // Total: 8+8+8+8+16+1+15 = 64 bytes
 };
 static_assert(sizeof(VenueResponse) == CACHE_LINE_SIZE, "VenueResponse must be 64 bytes");
 
-// ========================= 2. Venue Latency and Fill Models =========================
+// ========================= 2. Venue Latency Model =========================
 
 // Venue latency characteristics
 struct VenueLatencyModel {
@@ -83,170 +88,170 @@ struct VenueLatencyModel {
     HFTTimer::ns_t queue_delay_ns;         // Additional delay under load
     double queue_probability;               // Probability of queue delay (0.0-1.0)
     
-    // Calculate realistic venue latency
-    [[nodiscard]] HFTTimer::ns_t calculate_latency() const noexcept {
-        thread_local std::mt19937_64 rng(HFTTimer::get_cycles());
-        thread_local std::normal_distribution<double> jitter_dist(0.0, 1.0);
+    // Calculate realistic venue latency from the venue's own generator
+    [[nodiscard]] HFTTimer::ns_t calculate_latency(std::mt19937_64& rng) const noexcept {
+        std::normal_distribution<double> jitter_dist(0.0, 1.0);
+        std::uniform_real_distribution<double> queue_dist(0.0, 1.0);
         
-        // Base latency + jitter
-        HFTTimer::ns_t latency = base_latency_ns + 
-            static_cast<HFTTimer::ns_t>(jitter_dist(rng) * jitter_std_dev_ns);
+        // Base latency + jitter, never negative
+        const double latency = static_cast<double>(base_latency_ns) +
+            jitter_dist(rng) * static_cast<double>(jitter_std_dev_ns);
+        HFTTimer::ns_t result = latency > 0.0 ? static_cast<HFTTimer::ns_t>(latency) : 0;
         
         // Queue delay with probability
-        thread_local std::uniform_real_distribution<double> queue_dist(0.0, 1.0);
         if (queue_dist(rng) < queue_probability) {
-            latency += queue_delay_ns;
-        }
-        
-        return latency;
-    }
-};
-
-// Fill probability and pricing model
-class TreasuryFillModel {
-public:
-    // Calculate fill probability based on order aggressiveness
-    [[nodiscard]] static double calculate_fill_probability(
-        const TreasuryOrder& order,
-        const TreasuryTick& current_market) noexcept {
-        
-        if (order.order_type == OrderType::Market) {
-            return 0.95; // High probability for market orders
-        }
-        
-        // For limit orders, compare to current market
-        double limit_price = order.limit_price.to_decimal();
-        if (order.side == OrderSide::Buy) {
-            double ask_price = current_market.ask_price.to_decimal();
-            if (limit_price >= ask_price) return 0.9;  // Aggressive buy
-            // Linear decay based on price distance
-            return std::max(0.0, 0.9 - (ask_price - limit_price) * 0.1);
-        } else {
-            double bid_price = current_market.bid_price.to_decimal();
-            if (limit_price <= bid_price) return 0.9;  // Aggressive sell
-            // Linear decay based on price distance
-            return std::max(0.0, 0.9 - (limit_price - bid_price) * 0.1);
-        }
-    }
-    
-    // Determine fill price (price improvement modeling)
-    [[nodiscard]] static Price32nd calculate_fill_price(
-        const TreasuryOrder& order,
-        const TreasuryTick& current_market) noexcept {
-        
-        if (order.order_type == OrderType::Market) {
-            return order.side == OrderSide::Buy ? 
-                current_market.ask_price : current_market.bid_price;
-        }
-        
-        // For limit orders, model price improvement
-        thread_local std::mt19937_64 rng(HFTTimer::get_cycles());
-        thread_local std::uniform_real_distribution<double> price_dist(0.0, 1.0);
-        
-        if (order.side == OrderSide::Buy) {
-            double ask = current_market.ask_price.to_decimal();
-            double limit = order.limit_price.to_decimal();
-            if (limit >= ask) {
-                // Price improvement on aggressive orders
-                double improved = ask - price_dist(rng) * 0.03125; // Up to 1/32 better
-                return Price32nd::from_decimal(improved);
-            }
-            return order.limit_price;
-        } else {
-            double bid = current_market.bid_price.to_decimal();
-            double limit = order.limit_price.to_decimal();
-            if (limit <= bid) {
-                // Price improvement on aggressive orders
-                double improved = bid + price_dist(rng) * 0.03125; // Up to 1/32 better
-                return Price32nd::from_decimal(improved);
-            }
-            return order.limit_price;
+            result += queue_delay_ns;
         }
-    }
-    
-    // Model partial fill behavior
-    [[nodiscard]] static uint64_t calculate_fill_quantity(
-        const TreasuryOrder& order,
-        double fill_probability) noexcept {
-        
-        thread_local std::mt19937_64 rng(HFTTimer::get_cycles());
-        thread_local std::uniform_real_distribution<double> qty_dist(0.0, 1.0);
         
-        // Higher fill probability = higher chance of full fill
-        if (qty_dist(rng) < fill_probability) {
-            return order.remaining_quantity;
-        }
-        
-        // Partial fill based on probability
-        uint64_t partial = static_cast<uint64_t>(
-            order.remaining_quantity * fill_probability * qty_dist(rng));
-        return std::max(partial, static_cast<uint64_t>(1)); // At least 1M
+        return result;
     }
 };
 
 // ========================= 3. Primary Dealer Venue Simulator =========================
 
+/**
+ * @brief One simulated dealer venue: order entry, fills and timed responses
+ *
+ * Every response (ack, fill, cancel confirm, reject) is stamped with the
+ * time it reaches us, now + VenueLatencyModel latency, and held in a
+ * pooled event queue until then. Responses leave in the order the venue
+ * sent them, as on one session: a response is never delivered before one
+ * sent earlier. Order state changes with the acknowledgement and cancel
+ * confirmation, so an order fills only once acknowledged and can still fill
+ * while its cancel is in flight.
+ *
+ * Acknowledged limit orders rest in a matching OrderBook per instrument
+ * (BookManager). Orders are found through an ID index, not a scan. Fills
+ * come from queue position:
+ * - An order joining at or behind the touch queues behind the displayed
+ *   touch size. That queue is held in the book as a placeholder order
+ *   ahead of ours. An order that improves the touch is first in line.
+ * - process_market_trade() replays a market trade as an IOC sweep of the
+ *   side it hit, which the book fills in price-time priority. Placeholders
+ *   absorb volume first, so we fill only once the queue ahead has traded.
+ *   Passive fills are at our limit price.
+ * - A quote that crosses a resting order fills it against the displayed
+ *   size, at the quote price.
+ * - A quote showing less size at our price than is queued ahead of us
+ *   shrinks the queue ahead to what is displayed.
+ *
+ * All sizes are face value: order quantities and fills share the unit of
+ * TreasuryTick bid/ask sizes and TreasuryTrade trade_size, so displayed and
+ * traded size are compared with order size directly.
+ *
+ * Time comes from an attached SimClock (see VenueSimulation); responses are
+ * then delivered by update_venue_state() once the clock reaches them.
+ * Standalone, the venue reads the wall clock and delivers each response
+ * immediately, still stamped with its modelled time.
+ *
+ * Latency randomness comes from one generator per venue, seeded from the
+ * constructor or the venue name, so a simulated run gives the same result
+ * every time.
+ */
 class PrimaryDealerVenue {
 public:
-    // Constructor with venue configuration
+    static constexpr size_t MAX_ACTIVE_ORDERS = 4096;
+    static constexpr size_t RESPONSE_BUFFER_SIZE = 8192;
+    static constexpr uint64_t NEVER = UINT64_MAX;
+    static constexpr uint64_t QUEUE_AHEAD_ID_BIT = 1ULL << 63;   // Placeholder orders in the books
+    static constexpr uint64_t SWEEP_ORDER_ID = ~0ULL;             // Aggressor for replayed trades
+
+    /**
+     * @param seed Generator seed; 0 derives one from venue_name
+     */
     explicit PrimaryDealerVenue(
         std::string_view venue_name = "PrimaryDealer1",
-        VenueLatencyModel latency_model = default_latency_model()) noexcept
-        : venue_name_(venue_name)
+        VenueLatencyModel latency_model = default_latency_model(),
+        uint64_t seed = 0) noexcept
+        : venue_name_{}
         , latency_model_(latency_model)
-        , current_market_{}
+        , seed_(seed != 0 ? seed : name_seed(venue_name))
+        , rng_(seed_)
+        , clock_(nullptr)
+        , quotes_{}
         , stats_{}
         , next_venue_order_id_(1)
-        , active_orders_{}
-        , active_order_count_(0)
+        , next_queue_ahead_id_(QUEUE_AHEAD_ID_BIT)
+        , last_response_ns_(0)
+        , books_(std::make_unique<trading::BookManager>())
+        , orders_(std::make_unique<std::array<TreasuryOrder, MAX_ACTIVE_ORDERS>>())
+        , free_slots_{}
+        , free_count_(MAX_ACTIVE_ORDERS)
+        , order_index_()
+        , pending_responses_()
         , response_buffer_() {
-        
-        // Initialize active orders array
-        std::memset(active_orders_, 0, sizeof(active_orders_));
+        const size_t length = std::min(venue_name.size(), sizeof(venue_name_) - 1);
+        std::memcpy(venue_name_, venue_name.data(), length);
+        for (size_t i = 0; i < MAX_ACTIVE_ORDERS; ++i) {
+            free_slots_[i] = static_cast<uint32_t>(MAX_ACTIVE_ORDERS - 1 - i);
+        }
+        // Instruments share the venue's pools first come, first served
+        books_->for_each_book([](trading::TreasuryOrderBook& book) {
+            book.set_capacity_limits(trading::BookManager::ORDER_CAPACITY, trading::BookManager::LEVEL_CAPACITY);
+        });
     }
     
-    // Submit new order to venue
+    /**
+     * @brief Run on simulated time; nullptr returns to the wall clock
+     */
+    void attach_clock(const SimClock* clock) noexcept {
+        clock_ = clock;
+    }
+    
+    /**
+     * @brief Submit new order to venue
+     * @return false only if the venue cannot queue a response; invalid
+     *         orders are accepted and answered with a reject
+     */
     [[nodiscard]] bool submit_order(const TreasuryOrder& order) noexcept {
         auto start = HFTTimer::get_cycles();
+        stats_.orders_submitted++;
+        if (pending_responses_.full()) return false;
         
         // Validate order
         if (!validate_order(order)) {
-            generate_reject_response(order, "Invalid order parameters");
-            return false;
+            const bool queued = generate_reject_response(order, "Invalid order");
+            deliver_if_standalone();
+            return queued;
         }
         
-        // Store in active orders (with bounds check)
-        if (active_order_count_ >= MAX_ACTIVE_ORDERS) {
-            generate_reject_response(order, "Venue capacity exceeded");
-            return false;
+        // Claim a slot and index it
+        if (free_count_ == 0 || order_index_.contains(order.order_id)) {
+            const bool queued = generate_reject_response(order, free_count_ == 0 ? "Venue full" : "Duplicate ID");
+            deliver_if_standalone();
+            return queued;
         }
+        const uint32_t slot = free_slots_[--free_count_];
+        (void)order_index_.try_emplace(order.order_id, slot);
         
         // Copy order and update status
-        TreasuryOrder& active_order = active_orders_[active_order_count_++];
+        TreasuryOrder& active_order = (*orders_)[slot];
         std::memcpy(&active_order, &order, sizeof(TreasuryOrder));
         active_order.status = OrderStatus::Submitted;
-        active_order.timestamp_venue_ns = HFTTimer::get_timestamp_ns();
+        active_order.filled_quantity = 0;
+        active_order.remaining_quantity = order.quantity;
+        active_order.timestamp_venue_ns = now_ns();
         
         // Generate venue order ID
-        snprintf(active_order.venue_order_id, sizeof(active_order.venue_order_id),
-                "V%lu", next_venue_order_id_++);
+        std::snprintf(active_order.venue_order_id, sizeof(active_order.venue_order_id),
+                      "V%lu", static_cast<unsigned long>(next_venue_order_id_++));
         
         // Schedule acknowledgment
-        schedule_response(active_order, OrderStatus::Acknowledged);
+        const bool queued = schedule_response(active_order, OrderStatus::Acknowledged);
+        deliver_if_standalone();
         
-        stats_.orders_submitted++;
         stats_.submit_latency_ns += HFTTimer::cycles_to_ns(HFTTimer::get_cycles() - start);
         
-        return true;
+        return queued;
     }
     
-    // Cancel existing order
+    // Cancel existing order; confirmed (or refused, if it filled first) after the venue latency
     [[nodiscard]] bool cancel_order(uint64_t order_id) noexcept {
         auto start = HFTTimer::get_cycles();
         
         // Find order
         TreasuryOrder* order = find_active_order(order_id);
-        if (!order) {
+        if (!order || pending_responses_.full()) {
             return false;
         }
         
@@ -257,77 +262,61 @@ public:
         }
         
         // Schedule cancellation
-        schedule_response(*order, OrderStatus::Cancelled);
+        const bool queued = schedule_response(*order, OrderStatus::Cancelled);
+        deliver_if_standalone();
         
-        stats_.orders_cancelled++;
         stats_.cancel_latency_ns += HFTTimer::cycles_to_ns(HFTTimer::get_cycles() - start);
         
-        return true;
+        return queued;
     }
     
-    // Process market data updates (affects fill decisions)
+    /**
+     * @brief Quote update: trim queues ahead to displayed size, fill what it crosses
+     */
     void process_market_update(const TreasuryTick& tick) noexcept {
         auto start = HFTTimer::get_cycles();
         
-        // Update current market view
-        std::memcpy(&current_market_, &tick, sizeof(TreasuryTick));
-        
-        // Process fills for active orders
-        for (size_t i = 0; i < active_order_count_; ++i) {
-            TreasuryOrder& order = active_orders_[i];
-            if (order.status != OrderStatus::Acknowledged &&
-                order.status != OrderStatus::PartiallyFilled) {
-                continue;
-            }
-            
-            // Calculate fill probability
-            double fill_prob = TreasuryFillModel::calculate_fill_probability(order, tick);
-            
-            // Determine if order gets filled
-            thread_local std::mt19937_64 rng(HFTTimer::get_cycles());
-            thread_local std::uniform_real_distribution<double> fill_dist(0.0, 1.0);
-            
-            if (fill_dist(rng) < fill_prob) {
-                // Calculate fill quantity and price
-                uint64_t fill_qty = TreasuryFillModel::calculate_fill_quantity(order, fill_prob);
-                Price32nd fill_price = TreasuryFillModel::calculate_fill_price(order, tick);
-                
-                // Generate fill response
-                VenueResponse response{};
-                response.order_id = order.order_id;
-                response.timestamp_venue_ns = HFTTimer::get_timestamp_ns() +
-                    latency_model_.calculate_latency();
-                response.fill_quantity = fill_qty;
-                response.fill_price = fill_price;
-                std::memcpy(response.venue_order_id, order.venue_order_id,
-                          sizeof(response.venue_order_id));
-                
-                // Update order status
-                order.filled_quantity += fill_qty;
-                order.remaining_quantity -= fill_qty;
-                
-                if (order.remaining_quantity == 0) {
-                    response.new_status = OrderStatus::Filled;
-                    order.status = OrderStatus::Filled;
-                    stats_.orders_filled++;
-                } else {
-                    response.new_status = OrderStatus::PartiallyFilled;
-                    order.status = OrderStatus::PartiallyFilled;
-                    stats_.orders_partially_filled++;
-                }
-                
-                // Queue response
-                response_buffer_.try_push(response);
-            }
+        quotes_[instrument_index(tick.instrument_type)] = tick;
+        if (tick.bid_price.whole != 0) {
+            trim_queue_ahead(tick.instrument_type, trading::OrderSide::BID, tick.bid_price, tick.bid_size);
         }
-        
-        // Cleanup filled/cancelled orders
-        cleanup_completed_orders();
+        if (tick.ask_price.whole != 0) {
+            trim_queue_ahead(tick.instrument_type, trading::OrderSide::ASK, tick.ask_price, tick.ask_size);
+        }
+        fill_crossed_orders(tick.instrument_type);
+        deliver_if_standalone();
         
         stats_.market_updates++;
         stats_.market_update_latency_ns += HFTTimer::cycles_to_ns(HFTTimer::get_cycles() - start);
     }
     
+    /**
+     * @brief Replay a market trade against the queues
+     *
+     * The trade hit the bid if it printed at or below the last quote's mid,
+     * otherwise it lifted the offer (without a quote: whichever of our
+     * sides it reaches).
+     */
+    void process_market_trade(const TreasuryTrade& trade) noexcept {
+        auto start = HFTTimer::get_cycles();
+        
+        const TreasuryTick& quote = quotes_[instrument_index(trade.instrument_type)];
+        const int64_t price = price_ticks(trade.trade_price);
+        bool hits_bid;
+        if (quote.bid_price.whole != 0 && quote.ask_price.whole != 0) {
+            hits_bid = 2 * price <= price_ticks(quote.bid_price) + price_ticks(quote.ask_price);
+        } else {
+            const auto [best_bid, bid_size] = books_->book(trade.instrument_type).get_best_bid();
+            hits_bid = bid_size != 0 && price <= price_ticks(best_bid);
+        }
+        sweep(trade.instrument_type, hits_bid ? trading::OrderSide::BID : trading::OrderSide::ASK,
+              trade.trade_price, trade.trade_size, false);
+        deliver_if_standalone();
+        
+        stats_.market_trades++;
+        stats_.market_update_latency_ns += HFTTimer::cycles_to_ns(HFTTimer::get_cycles() - start);
+    }
+    
     // Get venue responses (fills, acks, rejects)
     [[nodiscard]] size_t get_venue_responses(
         VenueResponse* output_buffer,
@@ -335,18 +324,43 @@ public:
         return response_buffer_.try_pop_batch(output_buffer, output_buffer + max_count);
     }
     
-    // Update venue state (process pending orders, generate fills)
+    // Update venue state: deliver every response whose modelled time has come
     void update_venue_state() noexcept {
         auto start = HFTTimer::get_cycles();
         
         // Process scheduled responses
-        process_pending_responses();
+        process_pending_responses(now_ns());
         
         // Update statistics
         stats_.venue_updates++;
         stats_.venue_update_latency_ns += HFTTimer::cycles_to_ns(HFTTimer::get_cycles() - start);
     }
     
+    /** @brief Modelled arrival time of the next undelivered response, NEVER if none */
+    [[nodiscard]] uint64_t next_response_ns() const noexcept {
+        return pending_responses_.next_due_ns();
+    }
+    
+    /**
+     * @brief Market quantity queued ahead of a resting order (0 if none or not resting)
+     */
+    [[nodiscard]] uint64_t queue_ahead(uint64_t order_id) const noexcept {
+        const TreasuryOrder* order = find_active_order(order_id);
+        if (!order) return 0;
+        const auto& book = books_->book(order->instrument_type);
+        const trading::TreasuryOrder* resting = book.get_order(order_id);
+        if (!resting) return 0;
+        uint64_t ahead = 0;
+        for (const auto* o = book.get_level(resting->side, resting->price)->first_order; o != resting; o = o->next_order) {
+            ahead += (o->order_id & QUEUE_AHEAD_ID_BIT) ? o->remaining_quantity : 0;
+        }
+        return ahead;
+    }
+    
+    [[nodiscard]] size_t active_orders() const noexcept { return MAX_ACTIVE_ORDERS - free_count_; }
+    [[nodiscard]] std::string_view venue_name() const noexcept { return venue_name_; }
+    [[nodiscard]] uint64_t seed() const noexcept { return seed_; }
+    
     // Venue statistics and monitoring
     struct VenueStats {
         uint64_t orders_submitted = 0;
@@ -356,7 +370,9 @@ public:
         uint64_t orders_rejected = 0;
         uint64_t orders_cancelled = 0;
         uint64_t market_updates = 0;
+        uint64_t market_trades = 0;
         uint64_t venue_updates = 0;
+        uint64_t responses_dropped = 0;     // Response queue was full; the order never hears back
         HFTTimer::ns_t submit_latency_ns = 0;
         HFTTimer::ns_t cancel_latency_ns = 0;
         HFTTimer::ns_t market_update_latency_ns = 0;
@@ -378,21 +394,31 @@ public:
     }
 
 private:
-    static constexpr size_t MAX_ACTIVE_ORDERS = 4096;
-    static constexpr size_t RESPONSE_BUFFER_SIZE = 8192;
+    static constexpr size_t INSTRUMENTS = trading::BookManager::MAX_INSTRUMENTS;
     
     // Venue configuration
-    std::string_view venue_name_;
+    char venue_name_[32];
     VenueLatencyModel latency_model_;
-    TreasuryTick current_market_;
+    uint64_t seed_;
+    std::mt19937_64 rng_;
+    const SimClock* clock_;
+    std::array<TreasuryTick, INSTRUMENTS> quotes_;   // Last quote per instrument
     VenueStats stats_;
     uint64_t next_venue_order_id_;
+    uint64_t next_queue_ahead_id_;
+    uint64_t last_response_ns_;                 // Latest arrival scheduled so far
+    
+    // Resting orders (plus the queue ahead of them) by instrument
+    std::unique_ptr<trading::BookManager> books_;
     
-    // Order management
-    std::array<TreasuryOrder, MAX_ACTIVE_ORDERS> active_orders_;
-    size_t active_order_count_;
+    // Order records: slot pool plus ID index
+    std::unique_ptr<std::array<TreasuryOrder, MAX_ACTIVE_ORDERS>> orders_;
+    std::array<uint32_t, MAX_ACTIVE_ORDERS> free_slots_;
+    size_t free_count_;
+    FixedHashMap<uint64_t, uint32_t, MAX_ACTIVE_ORDERS> order_index_;
     
-    // Response management
+    // Response management: in flight until their modelled time, then ready to read
+    EventQueue<VenueResponse, RESPONSE_BUFFER_SIZE> pending_responses_;
     using ResponseBuffer = SPSCRingBuffer<VenueResponse, RESPONSE_BUFFER_SIZE>;
     ResponseBuffer response_buffer_;
     
@@ -406,8 +432,35 @@ private:
         };
     }
     
+    // FNV-1a of the name: distinct, stable streams for distinct venues
+    [[nodiscard]] static uint64_t name_seed(std::string_view name) noexcept {
+        uint64_t hash = 14695981039346656037ULL;
+        for (char c : name) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ULL;
+        }
+        return hash;
+    }
+    
+    [[nodiscard]] static size_t instrument_index(TreasuryType instrument) noexcept {
+        return trading::BookManager::index(instrument) % INSTRUMENTS;
+    }
+    
+    // Position on the 1/64 grid
+    [[nodiscard]] static int64_t price_ticks(Price32nd price) noexcept {
+        return static_cast<int64_t>(price.whole) * 64 + price.thirty_seconds * 2 + price.half_32nds;
+    }
+    
+    [[nodiscard]] static trading::OrderSide book_side(OrderSide side) noexcept {
+        return side == OrderSide::Buy ? trading::OrderSide::BID : trading::OrderSide::ASK;
+    }
+    
+    [[nodiscard]] uint64_t now_ns() const noexcept {
+        return clock_ != nullptr ? clock_->now_ns() : HFTTimer::get_timestamp_ns();
+    }
+    
     // Validate incoming order
     [[nodiscard]] bool validate_order(const TreasuryOrder& order) const noexcept {
+        if (order.order_id == 0 || (order.order_id & QUEUE_AHEAD_ID_BIT)) return false;
         if (order.order_type == OrderType::Invalid) return false;
         if (order.quantity == 0) return false;
         if (order.order_type == OrderType::Limit && order.limit_price.whole == 0) return false;
@@ -417,67 +470,295 @@ private:
     
     // Find active order by ID
     [[nodiscard]] TreasuryOrder* find_active_order(uint64_t order_id) noexcept {
-        for (size_t i = 0; i < active_order_count_; ++i) {
-            if (active_orders_[i].order_id == order_id) {
-                return &active_orders_[i];
+        const uint32_t* slot = order_index_.find(order_id);
+        return slot ? &(*orders_)[*slot] : nullptr;
+    }
+    
+    [[nodiscard]] const TreasuryOrder* find_active_order(uint64_t order_id) const noexcept {
+        const uint32_t* slot = order_index_.find(order_id);
+        return slot ? &(*orders_)[*slot] : nullptr;
+    }
+    
+    // Drop a finished order's record (it is already out of the book)
+    void release_order(uint64_t order_id) noexcept {
+        const uint32_t* slot = order_index_.find(order_id);
+        if (!slot) return;
+        free_slots_[free_count_++] = *slot;
+        order_index_.erase(order_id);
+    }
+    
+    /**
+     * @brief Rest an acknowledged limit order behind its estimated queue
+     * @return false if the book has no room
+     */
+    [[nodiscard]] bool join_book(const TreasuryOrder& order) noexcept {
+        auto& book = books_->book(order.instrument_type);
+        const trading::OrderSide side = book_side(order.side);
+        const TreasuryTick& quote = quotes_[instrument_index(order.instrument_type)];
+        
+        // Displayed touch size (face value, as order quantity), unless we improve the touch
+        const Price32nd touch = side == trading::OrderSide::BID ? quote.bid_price : quote.ask_price;
+        uint64_t ahead = 0;
+        if (touch.whole != 0) {
+            const int64_t improvement = side == trading::OrderSide::BID
+                ? price_ticks(order.limit_price) - price_ticks(touch)
+                : price_ticks(touch) - price_ticks(order.limit_price);
+            ahead = improvement > 0 ? 0 : (side == trading::OrderSide::BID ? quote.bid_size : quote.ask_size);
+        }
+        // Already queued at this price (earlier placeholders and our own orders) counts toward it
+        if (const auto* level = book.get_level(side, order.limit_price)) {
+            ahead = ahead > level->total_quantity ? ahead - level->total_quantity : 0;
+        }
+        
+        uint64_t queue_ahead_id = 0;
+        if (ahead != 0) {
+            queue_ahead_id = next_queue_ahead_id_++;
+            if (!book.add_order(trading::TreasuryOrder(queue_ahead_id, order.instrument_type, side,
+                                                       trading::OrderType::LIMIT, order.limit_price, ahead, 0))) {
+                return false;
+            }
+        }
+        if (!book.add_order(trading::TreasuryOrder(order.order_id, order.instrument_type, side,
+                                                   trading::OrderType::LIMIT, order.limit_price,
+                                                   order.remaining_quantity, 0))) {
+            if (queue_ahead_id != 0) (void)book.cancel_order(queue_ahead_id);
+            return false;
+        }
+        discard_book_updates();
+        return true;
+    }
+    
+    // Remove placeholders at a level once none of our orders rest behind them
+    void release_queue_ahead(TreasuryType instrument, trading::OrderSide side, Price32nd price) noexcept {
+        auto& book = books_->book(instrument);
+        const auto* level = book.get_level(side, price);
+        if (!level) return;
+        for (const auto* o = level->first_order; o != nullptr; o = o->next_order) {
+            if (!(o->order_id & QUEUE_AHEAD_ID_BIT)) return;
+        }
+        while ((level = book.get_level(side, price)) != nullptr) {
+            (void)book.cancel_order(level->first_order->order_id);
+        }
+        discard_book_updates();
+    }
+    
+    // Displayed size bounds what can be queued ahead of our orders at that price (face value, as order quantity)
+    void trim_queue_ahead(TreasuryType instrument, trading::OrderSide side, Price32nd price, uint64_t displayed) noexcept {
+        auto& book = books_->book(instrument);
+        const auto* level = book.get_level(side, price);
+        if (!level) return;
+        uint64_t ours = 0;
+        for (const auto* o = level->first_order; o != nullptr; o = o->next_order) {
+            ours += (o->order_id & QUEUE_AHEAD_ID_BIT) ? 0 : o->remaining_quantity;
+        }
+        const uint64_t allowed = displayed > ours ? displayed - ours : 0;
+        uint64_t excess = level->total_quantity - ours > allowed ? level->total_quantity - ours - allowed : 0;
+        
+        // Take the excess from the placeholders nearest the front
+        const auto* o = level->first_order;
+        while (excess != 0 && o != nullptr) {
+            const auto* next = o->next_order;
+            if (o->order_id & QUEUE_AHEAD_ID_BIT) {
+                const uint64_t cut = std::min(excess, o->remaining_quantity);
+                excess -= cut;
+                if (cut == o->remaining_quantity) {
+                    (void)book.cancel_order(o->order_id);
+                } else {
+                    (void)book.reduce_order(o->order_id, o->remaining_quantity - cut);
+                }
             }
+            o = next;
         }
-        return nullptr;
+        discard_book_updates();
     }
     
-    // Schedule a response for an order
-    void schedule_response(const TreasuryOrder& order, OrderStatus new_status) noexcept {
+    // Our resting orders the last quote trades through fill against its displayed size
+    void fill_crossed_orders(TreasuryType instrument) noexcept {
+        const TreasuryTick& quote = quotes_[instrument_index(instrument)];
+        auto& book = books_->book(instrument);
+        if (quote.ask_price.whole != 0 && quote.ask_size != 0) {
+            const auto [best_bid, bid_size] = book.get_best_bid();
+            if (bid_size != 0 && price_ticks(best_bid) >= price_ticks(quote.ask_price)) {
+                sweep(instrument, trading::OrderSide::BID, quote.ask_price, quote.ask_size, true);
+            }
+        }
+        if (quote.bid_price.whole != 0 && quote.bid_size != 0) {
+            const auto [best_ask, ask_size] = book.get_best_ask();
+            if (ask_size != 0 && price_ticks(best_ask) <= price_ticks(quote.bid_price)) {
+                sweep(instrument, trading::OrderSide::ASK, quote.bid_price, quote.bid_size, true);
+            }
+        }
+    }
+    
+    /**
+     * @brief Trade quantity into one side of the book through its price-time queue
+     * @param aggressive Our orders took liquidity: fill at price, not at our limit
+     */
+    void sweep(TreasuryType instrument, trading::OrderSide hit_side, Price32nd price, uint64_t quantity,
+               bool aggressive) noexcept {
+        if (quantity == 0 || price.whole == 0) return;
+        auto& book = books_->book(instrument);
+        discard_book_updates();
+        const trading::OrderSide aggressor_side =
+            hit_side == trading::OrderSide::BID ? trading::OrderSide::ASK : trading::OrderSide::BID;
+        (void)book.match_order(trading::TreasuryOrder(SWEEP_ORDER_ID, instrument, aggressor_side,
+                                                      trading::OrderType::IOC, price, quantity, 0));
+        
+        trading::OrderBookUpdate update;
+        auto& updates = books_->update_buffer();
+        while (updates.try_pop(update)) {
+            if (update.update_type != trading::OrderBookUpdate::TRADE_EXECUTED ||
+                update.aggressor_order_id != SWEEP_ORDER_ID || (update.order_id & QUEUE_AHEAD_ID_BIT)) {
+                continue;
+            }
+            on_fill(update.order_id, update.quantity, aggressive ? price : update.price);
+        }
+    }
+    
+    void on_fill(uint64_t order_id, uint64_t quantity, Price32nd price) noexcept {
+        TreasuryOrder* order = find_active_order(order_id);
+        if (!order) return;
+        order->filled_quantity += quantity;
+        order->remaining_quantity -= std::min(quantity, order->remaining_quantity);
+        if (order->remaining_quantity == 0) {
+            order->status = OrderStatus::Filled;
+            stats_.orders_filled++;
+        } else {
+            order->status = OrderStatus::PartiallyFilled;
+            stats_.orders_partially_filled++;
+        }
+        
+        // Report the fill after the venue latency (a full queue is counted in responses_dropped)
+        (void)schedule_response(*order, order->status, quantity, price);
+        if (order->status == OrderStatus::Filled) {
+            const TreasuryType instrument = order->instrument_type;
+            const trading::OrderSide side = book_side(order->side);
+            const Price32nd limit = order->limit_price;
+            release_order(order_id);
+            release_queue_ahead(instrument, side, limit);
+        }
+    }
+    
+    // Non-trade book notifications are of no use to the venue
+    void discard_book_updates() noexcept {
+        trading::OrderBookUpdate update;
+        auto& updates = books_->update_buffer();
+        while (updates.try_pop(update)) {}
+    }
+    
+    // Queue a response for its modelled arrival, behind anything sent earlier; false (and counted) if full
+    bool schedule_response(const TreasuryOrder& order, OrderStatus new_status,
+                           uint64_t fill_quantity = 0, Price32nd fill_price = {}) noexcept {
         VenueResponse response{};
         response.order_id = order.order_id;
-        response.timestamp_venue_ns = HFTTimer::get_timestamp_ns() +
-            latency_model_.calculate_latency();
+        response.timestamp_venue_ns = std::max(now_ns() + latency_model_.calculate_latency(rng_),
+                                               last_response_ns_);
         response.new_status = new_status;
+        response.fill_quantity = fill_quantity;
+        response.fill_price = fill_price;
         std::memcpy(response.venue_order_id, order.venue_order_id,
                    sizeof(response.venue_order_id));
         
-        response_buffer_.try_push(response);
-        
-        if (new_status == OrderStatus::Acknowledged) {
-            stats_.orders_acknowledged++;
-        }
+        return enqueue(response);
     }
     
     // Generate rejection response
-    void generate_reject_response(
+    bool generate_reject_response(
         const TreasuryOrder& order,
         const char* reason) noexcept {
         VenueResponse response{};
         response.order_id = order.order_id;
-        response.timestamp_venue_ns = HFTTimer::get_timestamp_ns();
+        response.timestamp_venue_ns = std::max(now_ns() + latency_model_.calculate_latency(rng_),
+                                               last_response_ns_);
         response.new_status = OrderStatus::Rejected;
         std::strncpy(response.reject_reason, reason,
                     sizeof(response.reject_reason) - 1);
         
-        response_buffer_.try_push(response);
         stats_.orders_rejected++;
+        return enqueue(response);
+    }
+    
+    bool enqueue(const VenueResponse& response) noexcept {
+        if (__builtin_expect(!pending_responses_.schedule(response.timestamp_venue_ns, response), 0)) {
+            stats_.responses_dropped++;
+            return false;
+        }
+        last_response_ns_ = response.timestamp_venue_ns;
+        return true;
     }
     
-    // Process all pending responses
-    void process_pending_responses() noexcept {
-        // No-op for now, responses are sent immediately
-        // Could be extended to implement more complex response scheduling
+    void deliver_if_standalone() noexcept {
+        if (clock_ == nullptr) process_pending_responses(NEVER);
     }
     
-    // Cleanup completed orders
-    void cleanup_completed_orders() noexcept {
-        size_t write = 0;
-        for (size_t read = 0; read < active_order_count_; ++read) {
-            if (active_orders_[read].status != OrderStatus::Filled &&
-                active_orders_[read].status != OrderStatus::Cancelled &&
-                active_orders_[read].status != OrderStatus::Rejected) {
-                if (write != read) {
-                    std::memcpy(&active_orders_[write], &active_orders_[read],
-                              sizeof(TreasuryOrder));
+    // Deliver responses due by now_ns, applying acks and cancels to the order as they land
+    void process_pending_responses(uint64_t now_ns) noexcept {
+        VenueResponse response;
+        while (!response_buffer_.full() && pending_responses_.pop_due(now_ns, response)) {
+            TreasuryOrder* order = find_active_order(response.order_id);
+            if (response.new_status == OrderStatus::Acknowledged) {
+                if (order && order->status == OrderStatus::Submitted) {
+                    acknowledge(*order);
                 }
-                ++write;
+                stats_.orders_acknowledged++;
+            } else if (response.new_status == OrderStatus::Cancelled) {
+                if (order && (order->status == OrderStatus::Acknowledged ||
+                              order->status == OrderStatus::PartiallyFilled)) {
+                    auto& book = books_->book(order->instrument_type);
+                    const trading::OrderSide side = book_side(order->side);
+                    const Price32nd limit = order->limit_price;
+                    const TreasuryType instrument = order->instrument_type;
+                    const bool resting = book.cancel_order(order->order_id);
+                    order->status = OrderStatus::Cancelled;
+                    release_order(response.order_id);
+                    if (resting) release_queue_ahead(instrument, side, limit);
+                    stats_.orders_cancelled++;
+                } else {
+                    // Filled while the cancel was in flight
+                    response.new_status = OrderStatus::Rejected;
+                    std::strncpy(response.reject_reason, "Too late",
+                                sizeof(response.reject_reason) - 1);
+                    stats_.orders_rejected++;
+                }
+            }
+            (void)response_buffer_.try_push(response);
+        }
+    }
+    
+    /**
+     * @brief Order is live: limit orders join the book, market orders take the touch
+     *
+     * Yield-limit orders without a price are acknowledged but rest off-book
+     * (the books match on price only).
+     */
+    void acknowledge(TreasuryOrder& order) noexcept {
+        order.status = OrderStatus::Acknowledged;
+        if (order.order_type == OrderType::Market) {
+            const TreasuryTick& quote = quotes_[instrument_index(order.instrument_type)];
+            const bool buy = order.side == OrderSide::Buy;
+            const Price32nd touch = buy ? quote.ask_price : quote.bid_price;
+            const uint64_t displayed = buy ? quote.ask_size : quote.bid_size;
+            const uint64_t quantity = touch.whole != 0 ? std::min(displayed, order.remaining_quantity) : 0;
+            const uint64_t order_id = order.order_id;
+            if (quantity != 0) on_fill(order_id, quantity, touch);
+            if (TreasuryOrder* rest = find_active_order(order_id)) {
+                // Unfilled remainder of a market order expires
+                rest->status = OrderStatus::Expired;
+                (void)schedule_response(*rest, OrderStatus::Expired);
+                release_order(order_id);
             }
+            return;
+        }
+        if (order.limit_price.whole == 0) return;
+        if (!join_book(order)) {
+            const uint64_t order_id = order.order_id;
+            order.status = OrderStatus::Rejected;
+            (void)generate_reject_response(order, "Venue full");
+            release_order(order_id);
+            return;
         }
-        active_order_count_ = write;
+        // Marketable on arrival
+        fill_crossed_orders(order.instrument_type);
     }
 };
 
@@ -518,7 +799,7 @@ public:
         for (size_t i = 0; i < venue_count_; ++i) {
             size_t count = venues_[i]->get_venue_responses(responses, 64);
             if (count > 0) {
-                consolidated_responses_.try_push_batch(responses, responses + count);
+                (void)consolidated_responses_.try_push_batch(responses, responses + count);
                 total_processed += count;
             }
         }
@@ -537,7 +818,7 @@ public:
     // Market data integration (feed to all venues)
     void process_market_data(const TreasuryTick& tick) noexcept {
         for (size_t i = 0; i < venue_count_; ++i) {
-            venues_[i]->process_market_data(tick);
+            venues_[i]->process_market_update(tick);
         }
     }
     
@@ -580,7 +861,7 @@ public:
         buy_order.order_type = OrderType::Limit;
         buy_order.side = OrderSide::Buy;
         buy_order.limit_price = bid_price;
-        buy_order.quantity = 10;  // 10M face value
+        buy_order.quantity = 10000000;  // 10M face value
         
         if (router_.route_order(buy_order)) {
             stats_.orders_sent++;
@@ -594,7 +875,7 @@ public:
         sell_order.order_type = OrderType::Limit;
         sell_order.side = OrderSide::Sell;
         sell_order.limit_price = ask_price;
-        sell_order.quantity = 10;  // 10M face value
+        sell_order.quantity = 10000000;  // 10M face value
         
         if (router_.route_order(sell_order)) {
             stats_.orders_sent++;
@@ -652,5 +933,134 @@ private:
     }
 };
 
+// ========================= 6. Discrete-Event Multi-Venue Simulation =========================
+
+/**
+ * @brief Runs venues on simulated time, as fast as the host can
+ *
+ * Market data (quotes and trades) is scheduled at its timestamps; each
+ * venue's responses are due at their modelled arrival. run_until()
+ * repeatedly advances the SimClock to the earliest of these and handles
+ * everything due then: ticks first (every venue sees the tick, then
+ * on_tick), then trades (replayed against every venue's queues), then each
+ * venue's responses in venue order (on_response). Handlers may submit or cancel
+ * orders on the venues; those are timed from the current simulated time.
+ *
+ * With seeded venues and the same inputs, a run produces the same
+ * responses at the same timestamps every time, whatever the host load.
+ *
+ * Single-threaded.
+ */
+class VenueSimulation {
+public:
+    static constexpr size_t MAX_VENUES = 8;
+    static constexpr size_t MAX_PENDING_TICKS = 65536;
+    static constexpr size_t MAX_PENDING_TRADES = 16384;
+    static constexpr uint64_t NEVER = UINT64_MAX;
+
+    explicit VenueSimulation(uint64_t start_ns = 0) noexcept
+        : clock_(start_ns), venues_{}, venue_count_(0),
+          ticks_(std::make_unique<EventQueue<TreasuryTick, MAX_PENDING_TICKS>>()),
+          trades_(std::make_unique<EventQueue<TreasuryTrade, MAX_PENDING_TRADES>>()) {}
+
+    VenueSimulation(const VenueSimulation&) = delete;
+    VenueSimulation& operator=(const VenueSimulation&) = delete;
+
+    ~VenueSimulation() {
+        for (size_t i = 0; i < venue_count_; ++i) venues_[i]->attach_clock(nullptr);
+    }
+
+    /**
+     * @brief Put a venue on this simulation's clock
+     * @return Venue index passed to on_response, MAX_VENUES if full
+     */
+    size_t add_venue(PrimaryDealerVenue& venue) noexcept {
+        if (venue_count_ == MAX_VENUES) return MAX_VENUES;
+        venue.attach_clock(&clock_);
+        venues_[venue_count_] = &venue;
+        return venue_count_++;
+    }
+
+    /**
+     * @brief Deliver a tick to every venue at tick.timestamp_ns (or now, if earlier)
+     * @return false if too many ticks are pending
+     */
+    [[nodiscard]] bool schedule_market_data(const TreasuryTick& tick) noexcept {
+        return ticks_->schedule(std::max(tick.timestamp_ns, clock_.now_ns()), tick);
+    }
+
+    /**
+     * @brief Replay a market trade on every venue at trade.timestamp_ns (or now, if earlier)
+     * @return false if too many trades are pending
+     */
+    [[nodiscard]] bool schedule_trade(const TreasuryTrade& trade) noexcept {
+        return trades_->schedule(std::max(trade.timestamp_ns, clock_.now_ns()), trade);
+    }
+
+    /**
+     * @brief Process every event due up to end_ns
+     * @param on_tick Called as on_tick(tick) after the venues have seen it
+     * @param on_response Called as on_response(venue_index, response)
+     * @return Events handled (ticks + trades + responses)
+     */
+    template<typename TickHandler, typename ResponseHandler>
+    size_t run_until(uint64_t end_ns, TickHandler&& on_tick, ResponseHandler&& on_response) noexcept {
+        size_t handled = 0;
+        VenueResponse responses[64];
+        for (;;) {
+            const uint64_t next = next_event_ns();
+            if (next == NEVER || next > end_ns) break;
+            clock_.advance_to(next);
+
+            TreasuryTick tick;
+            while (ticks_->pop_due(clock_.now_ns(), tick)) {
+                for (size_t i = 0; i < venue_count_; ++i) venues_[i]->process_market_update(tick);
+                on_tick(tick);
+                ++handled;
+            }
+            TreasuryTrade trade;
+            while (trades_->pop_due(clock_.now_ns(), trade)) {
+                for (size_t i = 0; i < venue_count_; ++i) venues_[i]->process_market_trade(trade);
+                ++handled;
+            }
+            for (size_t i = 0; i < venue_count_; ++i) {
+                venues_[i]->update_venue_state();
+                size_t count;
+                while ((count = venues_[i]->get_venue_responses(responses, 64)) > 0) {
+                    for (size_t r = 0; r < count; ++r) on_response(i, responses[r]);
+                    handled += count;
+                }
+            }
+        }
+        if (end_ns != NEVER) clock_.advance_to(end_ns);
+        return handled;
+    }
+
+    /** @brief Run until no ticks, trades or responses remain */
+    template<typename TickHandler, typename ResponseHandler>
+    size_t run(TickHandler&& on_tick, ResponseHandler&& on_response) noexcept {
+        return run_until(NEVER, on_tick, on_response);
+    }
+
+    /** @brief Earliest pending tick, trade or response, NEVER if idle */
+    [[nodiscard]] uint64_t next_event_ns() const noexcept {
+        uint64_t next = std::min(ticks_->next_due_ns(), trades_->next_due_ns());
+        for (size_t i = 0; i < venue_count_; ++i) next = std::min(next, venues_[i]->next_response_ns());
+        return next;
+    }
+
+    [[nodiscard]] uint64_t now_ns() const noexcept { return clock_.now_ns(); }
+    [[nodiscard]] const SimClock& clock() const noexcept { return clock_; }
+    [[nodiscard]] size_t venue_count() const noexcept { return venue_count_; }
+    [[nodiscard]] PrimaryDealerVenue& venue(size_t index) noexcept { return *venues_[index]; }
+
+private:
+    SimClock clock_;
+    std::array<PrimaryDealerVenue*, MAX_VENUES> venues_;
+    size_t venue_count_;
+    std::unique_ptr<EventQueue<TreasuryTick, MAX_PENDING_TICKS>> ticks_;
+    std::unique_ptr<EventQueue<TreasuryTrade, MAX_PENDING_TRADES>> trades_;
+};
+
 } // namespace market_data
 } // namespace hft 
\ No newline at end of file
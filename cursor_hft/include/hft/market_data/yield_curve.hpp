@@ -0,0 +1,279 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include "hft/market_data/treasury_instruments.hpp"
+#include "hft/market_data/yield_tables.hpp"
+
+namespace hft {
+namespace market_data {
+
+/**
+ * @brief Shared Treasury yield curve with cached DV01s and hedge ratios
+ *
+ * Knots are (maturity in years, yield) pairs, up to MAX_CURVE_POINTS; the
+ * six on-the-run instruments own one knot each and further points can be
+ * added at setup. Between knots the curve is a local cubic Hermite spline
+ * whose slopes come from the neighbouring secants, so moving one knot
+ * changes at most four segments and only those are refit.
+ *
+ * Pricing risk is cached per instrument: when an instrument's yield moves,
+ * its DV01, duration and convexity are recomputed from YieldTables terms
+ * together with its row and column of the hedge-ratio matrix. Version
+ * counters let consumers skip work when nothing moved; an update with an
+ * unchanged yield is a no-op, so strategies sharing one curve pay for each
+ * tick once.
+ *
+ * Single writer (market data thread), like TickStore.
+ */
+class alignas(64) YieldCurve {
+public:
+    static constexpr size_t MAX_CURVE_POINTS = 12;
+    static constexpr size_t MAX_INSTRUMENTS = TREASURY_TYPE_COUNT;
+    static constexpr size_t NO_POINT = MAX_CURVE_POINTS;
+
+    /**
+     * @brief Cached price risk for one instrument at its curve yield (per 100 face)
+     */
+    struct alignas(64) InstrumentRisk {
+        double yield = 0.0;
+        double dirty_price = 0.0;
+        double dv01 = 0.0;                 // Price change for a 1bp fall in yield
+        double modified_duration = 0.0;
+        double convexity = 0.0;
+        uint64_t version = 0;              // Bumped whenever the fields above change
+    };
+
+    explicit YieldCurve(const YieldTables& tables = default_yield_tables()) noexcept
+        : tables_(tables), maturity_{}, yield_{}, slope_{}, coeff_{}, instrument_point_{},
+          count_(0), version_(0), segments_refit_(0), risk_{}, hedge_ratio_{} {
+        instrument_point_.fill(NO_POINT);
+        for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+            const auto type = static_cast<TreasuryType>(i);
+            if (tables_.valid(type)) {
+                insert_point(maturity_years(tables_.terms(type)), 0.0, static_cast<int>(i));
+            }
+        }
+        refit_all();
+        for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+            if (instrument_point_[i] != NO_POINT) {
+                refresh_risk(i);
+            }
+        }
+    }
+
+    // No copy (shared by reference)
+    YieldCurve(const YieldCurve&) = delete;
+    YieldCurve& operator=(const YieldCurve&) = delete;
+
+    /**
+     * @brief Add an off-the-run knot (setup path: full refit)
+     * @return false if the curve is full or a knot already exists at that maturity
+     */
+    bool add_point(double maturity_years, double yield) noexcept {
+        if (count_ >= MAX_CURVE_POINTS || !(maturity_years > 0.0)) return false;
+        for (size_t i = 0; i < count_; ++i) {
+            if (maturity_[i] == maturity_years) return false;
+        }
+        insert_point(maturity_years, yield, -1);
+        refit_all();
+        ++version_;
+        return true;
+    }
+
+    /**
+     * @brief Move one knot, refitting only the segments it touches
+     * @return true if the curve changed
+     */
+    bool set_point_yield(size_t point, double yield) noexcept {
+        if (__builtin_expect(point >= count_, 0)) return false;
+        if (yield_[point] == yield) return false;
+        yield_[point] = yield;
+        refit_around(point);
+        ++version_;
+        return true;
+    }
+
+    /**
+     * @brief New yield for an on-the-run instrument
+     * @return true if it changed (curve, DV01 and hedge ratios updated)
+     */
+    bool update(TreasuryType instrument, double yield) noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        if (__builtin_expect(index >= MAX_INSTRUMENTS, 0)) return false;
+        if (!set_point_yield(instrument_point_[index], yield)) return false;
+        refresh_risk(index);
+        return true;
+    }
+
+    /**
+     * @brief Apply a full curve snapshot; unchanged instruments cost one compare
+     * @return Number of instruments whose yield changed
+     */
+    size_t update(const std::array<double, MAX_INSTRUMENTS>& yields) noexcept {
+        size_t changed = 0;
+        for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+            changed += update(static_cast<TreasuryType>(i), yields[i]) ? 1 : 0;
+        }
+        return changed;
+    }
+
+    /**
+     * @brief Interpolated yield at a maturity (flat beyond the end knots)
+     */
+    [[nodiscard]] double yield_at(double maturity_years) const noexcept {
+        if (count_ == 0) return 0.0;
+        if (maturity_years <= maturity_[0]) return yield_[0];
+        if (maturity_years >= maturity_[count_ - 1]) return yield_[count_ - 1];
+        size_t s = 0;
+        while (maturity_[s + 1] < maturity_years) ++s;
+        const double t = maturity_years - maturity_[s];
+        const auto& c = coeff_[s];
+        return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] double point_maturity(size_t point) const noexcept { return point < count_ ? maturity_[point] : 0.0; }
+    [[nodiscard]] double point_yield(size_t point) const noexcept { return point < count_ ? yield_[point] : 0.0; }
+
+    /** @brief Knot owned by an instrument (NO_POINT if its terms are unavailable) */
+    [[nodiscard]] size_t point_of(TreasuryType instrument) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? instrument_point_[index] : NO_POINT;
+    }
+
+    [[nodiscard]] double yield(TreasuryType instrument) const noexcept { return risk(instrument).yield; }
+    [[nodiscard]] double dv01(TreasuryType instrument) const noexcept { return risk(instrument).dv01; }
+
+    [[nodiscard]] const InstrumentRisk& risk(TreasuryType instrument) const noexcept {
+        static const InstrumentRisk none{};  // Instruments outside this build's universe
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? risk_[index] : none;
+    }
+
+    /**
+     * @brief Face of `hedge` that offsets the DV01 of one unit of face in `position`
+     */
+    [[nodiscard]] double hedge_ratio(TreasuryType position, TreasuryType hedge) const noexcept {
+        const auto row = static_cast<size_t>(position), column = static_cast<size_t>(hedge);
+        return row < MAX_INSTRUMENTS && column < MAX_INSTRUMENTS ? hedge_ratio_[row][column] : 0.0;
+    }
+
+    /** @brief Bumped on every change to any knot */
+    [[nodiscard]] uint64_t version() const noexcept { return version_; }
+
+    /** @brief Bumped when an instrument's cached risk (and hedge ratios) change */
+    [[nodiscard]] uint64_t risk_version(TreasuryType instrument) const noexcept { return risk(instrument).version; }
+
+    /** @brief Segments refit since construction (locality check for tests and benchmarks) */
+    [[nodiscard]] uint64_t segments_refit() const noexcept { return segments_refit_; }
+
+private:
+    static double maturity_years(const BondTerms& terms) noexcept {
+        if (terms.is_bill) return terms.bill_years;
+        return (static_cast<double>(terms.coupons_remaining) - 1.0 + terms.accrual_fraction) /
+               static_cast<double>(terms.frequency);
+    }
+
+    void insert_point(double maturity_years, double yield, int instrument) noexcept {
+        size_t pos = count_;
+        while (pos > 0 && maturity_[pos - 1] > maturity_years) {
+            maturity_[pos] = maturity_[pos - 1];
+            yield_[pos] = yield_[pos - 1];
+            --pos;
+        }
+        maturity_[pos] = maturity_years;
+        yield_[pos] = yield;
+        ++count_;
+        for (auto& p : instrument_point_) {
+            if (p != NO_POINT && p >= pos) ++p;
+        }
+        if (instrument >= 0) instrument_point_[static_cast<size_t>(instrument)] = pos;
+    }
+
+    double secant(size_t s) const noexcept {
+        return (yield_[s + 1] - yield_[s]) / (maturity_[s + 1] - maturity_[s]);
+    }
+
+    // Knot slope from the adjacent secants weighted by interval length
+    void fit_slope(size_t i) noexcept {
+        if (count_ < 2) {
+            slope_[i] = 0.0;
+        } else if (i == 0) {
+            slope_[i] = secant(0);
+        } else if (i == count_ - 1) {
+            slope_[i] = secant(count_ - 2);
+        } else {
+            const double h0 = maturity_[i] - maturity_[i - 1];
+            const double h1 = maturity_[i + 1] - maturity_[i];
+            slope_[i] = (h1 * secant(i - 1) + h0 * secant(i)) / (h0 + h1);
+        }
+    }
+
+    void fit_segment(size_t s) noexcept {
+        const double h = maturity_[s + 1] - maturity_[s];
+        const double d = secant(s);
+        const double m0 = slope_[s];
+        const double m1 = slope_[s + 1];
+        coeff_[s] = {yield_[s], m0, (3.0 * d - 2.0 * m0 - m1) / h, (m0 + m1 - 2.0 * d) / (h * h)};
+        ++segments_refit_;
+    }
+
+    void refit_all() noexcept {
+        for (size_t i = 0; i < count_; ++i) fit_slope(i);
+        for (size_t s = 0; s + 1 < count_; ++s) fit_segment(s);
+    }
+
+    // Knot i moves secants i-1 and i, hence slopes i-1..i+1 and segments i-2..i+1
+    void refit_around(size_t i) noexcept {
+        const size_t lo = i > 0 ? i - 1 : 0;
+        const size_t hi = std::min(i + 1, count_ - 1);
+        for (size_t k = lo; k <= hi; ++k) fit_slope(k);
+        const size_t seg_lo = i > 1 ? i - 2 : 0;
+        const size_t seg_hi = std::min(i + 1, count_ >= 2 ? count_ - 2 : 0);
+        for (size_t s = seg_lo; s <= seg_hi && s + 1 < count_; ++s) fit_segment(s);
+    }
+
+    void refresh_risk(size_t index) noexcept {
+        const BondTerms& terms = tables_.terms(static_cast<TreasuryType>(index));
+        const double y = yield_[instrument_point_[index]];
+        constexpr double BP = 0.0001;
+        double clean, d, d2;
+        terms.price(y, clean, d, d2);
+
+        auto& r = risk_[index];
+        r.yield = y;
+        r.dirty_price = clean + terms.accrued_interest;
+        r.dv01 = -d * BP;
+        r.modified_duration = r.dirty_price > 0.0 ? -d / r.dirty_price : 0.0;
+        r.convexity = r.dirty_price > 0.0 ? d2 / r.dirty_price : 0.0;
+        ++r.version;
+
+        for (size_t j = 0; j < MAX_INSTRUMENTS; ++j) {
+            const double other = risk_[j].dv01;
+            hedge_ratio_[index][j] = other > 0.0 ? r.dv01 / other : 0.0;
+            hedge_ratio_[j][index] = r.dv01 > 0.0 ? other / r.dv01 : 0.0;
+        }
+    }
+
+    const YieldTables& tables_;
+
+    // Knots, sorted by maturity
+    alignas(64) std::array<double, MAX_CURVE_POINTS> maturity_;
+    alignas(64) std::array<double, MAX_CURVE_POINTS> yield_;
+    alignas(64) std::array<double, MAX_CURVE_POINTS> slope_;
+    alignas(64) std::array<std::array<double, 4>, MAX_CURVE_POINTS - 1> coeff_;  // Per segment, in t - maturity_[s]
+    std::array<size_t, MAX_INSTRUMENTS> instrument_point_;
+    size_t count_;
+    uint64_t version_;
+    uint64_t segments_refit_;
+
+    alignas(64) std::array<InstrumentRisk, MAX_INSTRUMENTS> risk_;
+    alignas(64) std::array<std::array<double, MAX_INSTRUMENTS>, MAX_INSTRUMENTS> hedge_ratio_;
+};
+
+} // namespace market_data
+} // namespace hft
@@ -0,0 +1,551 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <array>
+#include <algorithm>
+#include <time.h>
+#include "hft/market_data/treasury_instruments.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace hft {
+namespace market_data {
+
+// ========================= 1. Calendar =========================
+
+struct CivilDate {
+    int32_t year;
+    uint32_t month;  // 1-12
+    uint32_t day;    // 1-31
+};
+
+/**
+ * @brief Days since 1970-01-01 for a proleptic Gregorian date
+ */
+constexpr int32_t days_from_civil(int32_t y, uint32_t m, uint32_t d) noexcept {
+    y -= m <= 2;
+    const int32_t era = (y >= 0 ? y : y - 399) / 400;
+    const uint32_t yoe = static_cast<uint32_t>(y - era * 400);
+    const uint32_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int32_t>(doe) - 719468;
+}
+
+constexpr CivilDate civil_from_days(int32_t z) noexcept {
+    z += 719468;
+    const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const uint32_t doe = static_cast<uint32_t>(z - era * 146097);
+    const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int32_t y = static_cast<int32_t>(yoe) + era * 400;
+    const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const uint32_t mp = (5 * doy + 2) / 153;
+    const uint32_t d = doy - (153 * mp + 2) / 5 + 1;
+    const uint32_t m = mp < 10 ? mp + 3 : mp - 9;
+    return {y + (m <= 2), m, d};
+}
+
+constexpr uint32_t days_in_month(int32_t y, uint32_t m) noexcept {
+    constexpr uint8_t DAYS[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    const bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    return m == 2 && leap ? 29u : DAYS[m - 1];
+}
+
+/**
+ * @brief Date `months` before `date`, keeping the day of month (end of month stays end of month)
+ */
+constexpr int32_t subtract_months(int32_t date, uint32_t months) noexcept {
+    const CivilDate c = civil_from_days(date);
+    const bool end_of_month = c.day == days_in_month(c.year, c.month);
+    const int32_t total = c.year * 12 + static_cast<int32_t>(c.month) - 1 - static_cast<int32_t>(months);
+    const int32_t y = total >= 0 ? total / 12 : (total - 11) / 12;
+    const uint32_t m = static_cast<uint32_t>(total - y * 12) + 1;
+    const uint32_t dim = days_in_month(y, m);
+    return days_from_civil(y, m, end_of_month ? dim : std::min(c.day, dim));
+}
+
+// ========================= 2. Instrument Pricing =========================
+
+/**
+ * @brief Terms needed to price one Treasury
+ *
+ * coupon_rate == 0 with at most a year to maturity is priced as a bill
+ * (simple interest, Actual/365, as YieldCalculator); anything else as a
+ * coupon security (street convention, Actual/Actual ICMA accrual).
+ */
+struct BondSpec {
+    TreasuryType type;
+    double coupon_rate;       // Annual, decimal (0.0425 = 4.25%)
+    int32_t maturity_date;    // Days since 1970-01-01
+    uint32_t frequency = 2;   // Coupons per year
+};
+
+/**
+ * @brief Schedule-derived pricing terms for one instrument at one settlement date
+ */
+struct alignas(64) BondTerms {
+    bool is_bill;
+    uint32_t frequency;
+    uint32_t coupons_remaining;   // n
+    double coupon;                // Per period, per 100 face
+    double accrual_fraction;      // w: (next coupon - settlement) / period length
+    double accrued_interest;      // Per 100 face
+    double bill_years;            // Bills: days to maturity / 365
+
+    /**
+     * @brief Clean price per 100 face and its derivative in yield
+     */
+    void price(double y, double& clean, double& dclean_dy) const noexcept {
+        if (is_bill) {
+            const double denom = 1.0 + y * bill_years;
+            clean = 100.0 / denom;
+            dclean_dy = -100.0 * bill_years / (denom * denom);
+            return;
+        }
+        const double f = static_cast<double>(frequency);
+        if (coupons_remaining <= 1) {
+            // Final coupon period: simple interest to maturity
+            const double denom = 1.0 + accrual_fraction * y / f;
+            clean = (100.0 + coupon) / denom - accrued_interest;
+            dclean_dy = -(100.0 + coupon) * accrual_fraction / f / (denom * denom);
+            return;
+        }
+        // Dirty = sum_k cf_k v^(w+k), v = 1/(1 + y/f)
+        const double v = 1.0 / (1.0 + y / f);
+        double vk = std::pow(v, accrual_fraction);
+        double pv = 0.0;
+        double dpv_dv = 0.0;  // sum_k cf_k (w+k) v^(w+k-1)
+        for (uint32_t k = 0; k < coupons_remaining; ++k) {
+            const double cf = coupon + (k + 1 == coupons_remaining ? 100.0 : 0.0);
+            pv += cf * vk;
+            dpv_dv += cf * (accrual_fraction + k) * vk;
+            vk *= v;
+        }
+        dpv_dv /= v;
+        clean = pv - accrued_interest;
+        dclean_dy = dpv_dv * (-v * v / f);
+    }
+
+    /**
+     * @brief Clean price with first and second yield derivatives (for convexity)
+     */
+    void price(double y, double& clean, double& dclean_dy, double& d2clean_dy2) const noexcept {
+        if (is_bill) {
+            const double denom = 1.0 + y * bill_years;
+            clean = 100.0 / denom;
+            dclean_dy = -100.0 * bill_years / (denom * denom);
+            d2clean_dy2 = 200.0 * bill_years * bill_years / (denom * denom * denom);
+            return;
+        }
+        const double f = static_cast<double>(frequency);
+        if (coupons_remaining <= 1) {
+            const double a = accrual_fraction / f;
+            const double denom = 1.0 + a * y;
+            clean = (100.0 + coupon) / denom - accrued_interest;
+            dclean_dy = -(100.0 + coupon) * a / (denom * denom);
+            d2clean_dy2 = 2.0 * (100.0 + coupon) * a * a / (denom * denom * denom);
+            return;
+        }
+        // dv/dy = -v^2/f, d2v/dy2 = 2v^3/f^2
+        const double v = 1.0 / (1.0 + y / f);
+        double vk = std::pow(v, accrual_fraction);
+        double pv = 0.0;
+        double d1 = 0.0;  // sum_k cf_k t_k v^t_k,           t_k = w+k
+        double d2 = 0.0;  // sum_k cf_k t_k (t_k - 1) v^t_k
+        for (uint32_t k = 0; k < coupons_remaining; ++k) {
+            const double cf = coupon + (k + 1 == coupons_remaining ? 100.0 : 0.0);
+            const double t = accrual_fraction + k;
+            pv += cf * vk;
+            d1 += cf * t * vk;
+            d2 += cf * t * (t - 1.0) * vk;
+            vk *= v;
+        }
+        const double dv_dy = -v * v / f;
+        clean = pv - accrued_interest;
+        dclean_dy = d1 / v * dv_dy;
+        d2clean_dy2 = d2 / (v * v) * dv_dy * dv_dy + d1 / v * (2.0 * v * v * v / (f * f));
+    }
+
+    [[nodiscard]] double clean_price(double y) const noexcept {
+        double clean, d;
+        price(y, clean, d);
+        return clean;
+    }
+};
+
+/**
+ * @brief Build pricing terms from the coupon schedule
+ * @return false if the instrument has matured by settlement
+ */
+inline bool make_bond_terms(const BondSpec& spec, int32_t settlement_date, BondTerms& out) noexcept {
+    out = BondTerms{};
+    out.frequency = spec.frequency ? spec.frequency : 2;
+    const int32_t days_to_maturity = spec.maturity_date - settlement_date;
+    if (days_to_maturity <= 0) {
+        return false;
+    }
+    if (spec.coupon_rate == 0.0 && days_to_maturity <= 366) {
+        out.is_bill = true;
+        out.bill_years = static_cast<double>(days_to_maturity) / 365.0;
+        return true;
+    }
+
+    // Walk back from maturity to the coupon date on or before settlement
+    const uint32_t months_per_period = 12 / out.frequency;
+    uint32_t k = 1;
+    int32_t next = spec.maturity_date;
+    int32_t prev = subtract_months(spec.maturity_date, months_per_period);
+    while (prev > settlement_date) {
+        ++k;
+        next = prev;
+        prev = subtract_months(spec.maturity_date, months_per_period * k);
+    }
+
+    const double period_days = static_cast<double>(next - prev);
+    out.coupons_remaining = k;
+    out.coupon = 100.0 * spec.coupon_rate / out.frequency;
+    out.accrual_fraction = static_cast<double>(next - settlement_date) / period_days;
+    out.accrued_interest = out.coupon * static_cast<double>(settlement_date - prev) / period_days;
+    return true;
+}
+
+// ========================= 3. Tabulated Price-to-Yield =========================
+
+/**
+ * @brief Price-to-yield for all six instruments from precomputed inverse tables
+ *
+ * For each instrument, yield is tabulated against clean price on a uniform
+ * price grid (NODES points spanning YIELD_MIN..YIELD_MAX) together with
+ * dy/dp, and evaluated by cubic Hermite interpolation: an index computed
+ * from the price, four table loads and a handful of FMAs, with no search
+ * and no transcendental calls. Interpolation error is far below a 32nd
+ * (see tests); exact_yield() polishes the table value with Newton on the
+ * full Actual/Actual price, converging in one or two iterations.
+ *
+ * Batch calls evaluate four prices per AVX2 step (each lane's interval is
+ * one 32-byte load, transposed into place). Prices outside the table
+ * saturate; exact_yield() handles them. Tables depend on settlement date:
+ * rebuild daily.
+ */
+class alignas(64) YieldTables {
+public:
+    static constexpr size_t MAX_INSTRUMENTS = TREASURY_TYPE_COUNT;
+    static constexpr size_t NODES = 1024;
+    static constexpr double YIELD_MIN = -0.01;
+    static constexpr double YIELD_MAX = 0.25;
+
+    constexpr YieldTables() noexcept : terms_{}, price_lo_{}, inv_step_{}, price_hi_{}, valid_{}, nodes_{}, settlement_date_(0) {}
+
+    // No copy (large tables; share by reference)
+    YieldTables(const YieldTables&) = delete;
+    YieldTables& operator=(const YieldTables&) = delete;
+
+    /**
+     * @brief Representative on-the-run coupons with maturities one tenor after settlement
+     */
+    static std::array<BondSpec, MAX_INSTRUMENTS> on_the_run_specs(int32_t settlement_date) noexcept {
+        const CivilDate s = civil_from_days(settlement_date);
+        const auto years_out = [&s](int32_t years) noexcept {
+            const uint32_t day = std::min(s.day, days_in_month(s.year + years, s.month));
+            return days_from_civil(s.year + years, s.month, day);
+        };
+        return {{
+            {TreasuryType::Bill_3M, 0.0, settlement_date + 91, 2},
+            {TreasuryType::Bill_6M, 0.0, settlement_date + 182, 2},
+            {TreasuryType::Note_2Y, 0.04250, years_out(2), 2},
+            {TreasuryType::Note_5Y, 0.04125, years_out(5), 2},
+            {TreasuryType::Note_10Y, 0.04250, years_out(10), 2},
+            {TreasuryType::Bond_30Y, 0.04500, years_out(30), 2},
+        }};
+    }
+
+    /**
+     * @brief Build every table for a settlement date (not hot path: ~1ms)
+     */
+    void build(const std::array<BondSpec, MAX_INSTRUMENTS>& specs, int32_t settlement_date) noexcept {
+        settlement_date_ = settlement_date;
+        for (const auto& spec : specs) {
+            const auto index = static_cast<size_t>(spec.type);
+            if (index < MAX_INSTRUMENTS) {
+                build_instrument(index, spec, settlement_date);
+            }
+        }
+    }
+
+    void build_on_the_run(int32_t settlement_date) noexcept {
+        build(on_the_run_specs(settlement_date), settlement_date);
+    }
+
+    [[nodiscard]] int32_t settlement_date() const noexcept { return settlement_date_; }
+    [[nodiscard]] bool valid(TreasuryType type) const noexcept {
+        const auto index = static_cast<size_t>(type);
+        return index < MAX_INSTRUMENTS && valid_[index];
+    }
+    [[nodiscard]] const BondTerms& terms(TreasuryType type) const noexcept {
+        static const BondTerms none{};  // valid(type) is false for these
+        const auto index = static_cast<size_t>(type);
+        return index < MAX_INSTRUMENTS ? terms_[index] : none;
+    }
+
+    [[nodiscard]] double clean_price(TreasuryType type, double yield) const noexcept {
+        return terms(type).clean_price(yield);
+    }
+
+    /**
+     * @brief Table yield for one clean price
+     *
+     * Saturates at YIELD_MAX / YIELD_MIN for prices below / above the table
+     * (bad quotes must not stall the feed); exact_yield() solves those.
+     */
+    [[nodiscard]] double price_to_yield(TreasuryType type, double price) const noexcept {
+        const auto index = static_cast<size_t>(type);
+        if (__builtin_expect(index >= MAX_INSTRUMENTS || !valid_[index], 0)) return 0.0;
+        const double t = (price - price_lo_[index]) * inv_step_[index];
+        if (__builtin_expect(!(t >= 0.0), 0)) return YIELD_MAX;
+        if (__builtin_expect(t >= static_cast<double>(NODES - 1), 0)) return YIELD_MIN;
+        const size_t k = static_cast<size_t>(t);
+        return hermite(&nodes_[(index * NODES + k) * 2], t - static_cast<double>(k));
+    }
+
+    [[nodiscard]] double price_to_yield(TreasuryType type, Price32nd price) const noexcept {
+        return price_to_yield(type, price.to_decimal());
+    }
+
+    /**
+     * @brief Convert n prices of one instrument
+     */
+    void price_to_yield(TreasuryType type, const double* prices, double* yields, size_t n) const noexcept {
+        const auto index = static_cast<size_t>(type);
+        if (__builtin_expect(index >= MAX_INSTRUMENTS || !valid_[index], 0)) {
+            std::fill(yields, yields + n, 0.0);
+            return;
+        }
+        size_t i = 0;
+#if defined(__AVX2__)
+        const __m128i offset = _mm_set1_epi32(static_cast<int>(index * NODES * 2));
+        const __m256d lo = _mm256_set1_pd(price_lo_[index]);
+        const __m256d inv = _mm256_set1_pd(inv_step_[index]);
+        const size_t vector_end = n & ~size_t{3};
+        for (; i < vector_end; i += 4) {
+            kernel_avx2(_mm256_loadu_pd(prices + i), lo, inv, offset, yields + i);
+        }
+#endif
+        for (; i < n; ++i) {
+            yields[i] = price_to_yield(type, prices[i]);
+        }
+    }
+
+    /**
+     * @brief Convert n prices of mixed instruments (e.g. one decoded feed batch)
+     */
+    void price_to_yield(const TreasuryType* types, const double* prices, double* yields, size_t n) const noexcept {
+        size_t i = 0;
+#if defined(__AVX2__)
+        const size_t vector_end = n & ~size_t{3};
+        for (; i < vector_end; i += 4) {
+            alignas(16) int32_t idx[4];
+            bool ok = true;
+            for (size_t j = 0; j < 4; ++j) {
+                idx[j] = static_cast<int32_t>(types[i + j]);
+                ok &= static_cast<size_t>(idx[j]) < MAX_INSTRUMENTS && valid_[idx[j]];
+            }
+            if (__builtin_expect(!ok, 0)) {
+                for (size_t j = 0; j < 4; ++j) yields[i + j] = price_to_yield(types[i + j], prices[i + j]);
+                continue;
+            }
+            const __m128i inst = _mm_load_si128(reinterpret_cast<const __m128i*>(idx));
+            const __m256d lo = _mm256_setr_pd(price_lo_[idx[0]], price_lo_[idx[1]], price_lo_[idx[2]], price_lo_[idx[3]]);
+            const __m256d inv = _mm256_setr_pd(inv_step_[idx[0]], inv_step_[idx[1]], inv_step_[idx[2]], inv_step_[idx[3]]);
+            const __m128i offset = _mm_mullo_epi32(inst, _mm_set1_epi32(static_cast<int>(NODES * 2)));
+            kernel_avx2(_mm256_loadu_pd(prices + i), lo, inv, offset, yields + i);
+        }
+#endif
+        for (; i < n; ++i) {
+            yields[i] = price_to_yield(types[i], prices[i]);
+        }
+    }
+
+    /**
+     * @brief Newton on the full price function, seeded from the table
+     * @param iterations If non-null, receives the Newton iterations used
+     */
+    [[nodiscard]] double exact_yield(TreasuryType type, double price, int* iterations = nullptr) const noexcept {
+        const auto index = static_cast<size_t>(type);
+        if (index >= MAX_INSTRUMENTS || !valid_[index] || !(price > 0.0)) return 0.0;
+        const BondTerms& bt = terms_[index];
+
+        double y;
+        const double t = (price - price_lo_[index]) * inv_step_[index];
+        if (t >= 0.0 && t < static_cast<double>(NODES - 1)) {
+            const size_t k = static_cast<size_t>(t);
+            y = hermite(&nodes_[(index * NODES + k) * 2], t - static_cast<double>(k));
+        } else {
+            y = price > price_hi_[index] ? YIELD_MIN : YIELD_MAX;
+        }
+
+        constexpr int MAX_ITER = 20;
+        constexpr double EPS = 1e-12;
+        int it = 0;
+        while (it < MAX_ITER) {
+            double clean, d;
+            bt.price(y, clean, d);
+            ++it;
+            if (d == 0.0) break;
+            const double delta = (clean - price) / d;
+            y -= delta;
+            if (std::abs(delta) < EPS) break;
+        }
+        if (iterations) *iterations = it;
+        return y;
+    }
+
+private:
+    // Node k holds {y_k, step * dy/dp at k}
+    static double hermite(const double* node, double u) noexcept {
+        const double u2 = u * u;
+        const double u3 = u2 * u;
+        const double h00 = 2.0 * u3 - 3.0 * u2 + 1.0;
+        const double h10 = u3 - 2.0 * u2 + u;
+        const double h01 = 3.0 * u2 - 2.0 * u3;
+        const double h11 = u3 - u2;
+        return h00 * node[0] + h10 * node[1] + h01 * node[2] + h11 * node[3];
+    }
+
+#if defined(__AVX2__)
+    // Four lanes, saturating exactly like the scalar path
+    void kernel_avx2(__m256d p, __m256d lo, __m256d inv, __m128i offset, double* out) const noexcept {
+        const __m256d t = _mm256_mul_pd(_mm256_sub_pd(p, lo), inv);
+        const __m256d below = _mm256_cmp_pd(t, _mm256_setzero_pd(), _CMP_NGE_UQ);  // Includes NaN
+        const __m256d above = _mm256_cmp_pd(t, _mm256_set1_pd(static_cast<double>(NODES - 1)), _CMP_GE_OQ);
+        // Out-of-range lanes load node 0 and are overwritten below
+        const __m256d tc = _mm256_andnot_pd(_mm256_or_pd(below, above), t);
+        const __m128i k = _mm256_cvttpd_epi32(tc);
+        const __m256d u = _mm256_sub_pd(tc, _mm256_cvtepi32_pd(k));
+        alignas(16) int32_t idx[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(idx), _mm_add_epi32(offset, _mm_slli_epi32(k, 1)));
+
+        // Each lane's {y_k, m_k, y_k+1, m_k+1} is one 32-byte load; transpose
+        // rather than gather (gathers are slow on mitigated cores)
+        const double* base = nodes_.data();
+        const __m256d r0 = _mm256_loadu_pd(base + idx[0]);
+        const __m256d r1 = _mm256_loadu_pd(base + idx[1]);
+        const __m256d r2 = _mm256_loadu_pd(base + idx[2]);
+        const __m256d r3 = _mm256_loadu_pd(base + idx[3]);
+        const __m256d ys01 = _mm256_unpacklo_pd(r0, r1);
+        const __m256d ms01 = _mm256_unpackhi_pd(r0, r1);
+        const __m256d ys23 = _mm256_unpacklo_pd(r2, r3);
+        const __m256d ms23 = _mm256_unpackhi_pd(r2, r3);
+        const __m256d y0 = _mm256_permute2f128_pd(ys01, ys23, 0x20);
+        const __m256d y1 = _mm256_permute2f128_pd(ys01, ys23, 0x31);
+        const __m256d m0 = _mm256_permute2f128_pd(ms01, ms23, 0x20);
+        const __m256d m1 = _mm256_permute2f128_pd(ms01, ms23, 0x31);
+
+        const __m256d u2 = _mm256_mul_pd(u, u);
+        const __m256d u3 = _mm256_mul_pd(u2, u);
+        const __m256d two = _mm256_set1_pd(2.0);
+        const __m256d three = _mm256_set1_pd(3.0);
+        const __m256d h01 = _mm256_sub_pd(_mm256_mul_pd(three, u2), _mm256_mul_pd(two, u3));
+        const __m256d h00 = _mm256_sub_pd(_mm256_set1_pd(1.0), h01);
+        const __m256d h11 = _mm256_sub_pd(u3, u2);
+        const __m256d h10 = _mm256_add_pd(_mm256_sub_pd(h11, u2), u);
+
+        __m256d y = _mm256_mul_pd(h00, y0);
+        y = _mm256_add_pd(y, _mm256_mul_pd(h10, m0));
+        y = _mm256_add_pd(y, _mm256_mul_pd(h01, y1));
+        y = _mm256_add_pd(y, _mm256_mul_pd(h11, m1));
+        y = _mm256_blendv_pd(y, _mm256_set1_pd(YIELD_MAX), below);
+        y = _mm256_blendv_pd(y, _mm256_set1_pd(YIELD_MIN), above);
+        _mm256_storeu_pd(out, y);
+    }
+#endif
+
+    void build_instrument(size_t index, const BondSpec& spec, int32_t settlement_date) noexcept {
+        BondTerms& bt = terms_[index];
+        valid_[index] = make_bond_terms(spec, settlement_date, bt);
+        if (!valid_[index]) {
+            return;
+        }
+
+        // Clean price falls as yield rises: the grid runs from YIELD_MAX up to YIELD_MIN
+        const double p_lo = bt.clean_price(YIELD_MAX);
+        const double p_hi = bt.clean_price(YIELD_MIN);
+        const double step = (p_hi - p_lo) / static_cast<double>(NODES - 1);
+        price_lo_[index] = p_lo;
+        price_hi_[index] = p_hi;
+        inv_step_[index] = 1.0 / step;
+
+        double y = YIELD_MAX;
+        for (size_t k = 0; k < NODES; ++k) {
+            const double target = p_lo + step * static_cast<double>(k);
+            double clean = 0.0, d = -1.0;
+            for (int it = 0; it < 50; ++it) {
+                bt.price(y, clean, d);
+                const double delta = (clean - target) / d;
+                y -= delta;
+                if (std::abs(delta) < 1e-15) break;
+            }
+            bt.price(y, clean, d);
+            nodes_[(index * NODES + k) * 2] = y;
+            nodes_[(index * NODES + k) * 2 + 1] = step / d;
+        }
+    }
+
+    std::array<BondTerms, MAX_INSTRUMENTS> terms_;
+    alignas(64) std::array<double, MAX_INSTRUMENTS> price_lo_;
+    std::array<double, MAX_INSTRUMENTS> inv_step_;
+    std::array<double, MAX_INSTRUMENTS> price_hi_;
+    std::array<bool, MAX_INSTRUMENTS> valid_;
+    alignas(64) std::array<double, MAX_INSTRUMENTS * NODES * 2> nodes_;
+    int32_t settlement_date_;
+};
+
+namespace detail {
+
+inline constinit YieldTables default_tables;  // Constant-initialised (empty); built below before main()
+
+inline int32_t utc_today() noexcept {
+    timespec ts{};
+    ::clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<int32_t>(ts.tv_sec / 86400);
+}
+
+// Static initialisation runs before any feed thread exists
+inline const bool default_tables_built = [] {
+    default_tables.build_on_the_run(utc_today());
+    return true;
+}();
+
+} // namespace detail
+
+/**
+ * @brief Process-wide tables used by the feed parsers (read-only)
+ *
+ * Built during static initialisation with on-the-run terms for the
+ * process start date (UTC), so the hot path only ever reads them: no
+ * allocation, no build and no guard on first use.
+ */
+inline const YieldTables& default_yield_tables() noexcept {
+    return detail::default_tables;
+}
+
+/**
+ * @brief Rebuild the process-wide tables for the session (not hot path: ~1ms)
+ *
+ * Call at session start to install the real settlement date and coupon
+ * schedule, before feed threads run (e.g. ahead of WarmupPlan::run()):
+ * the feed parsers read the tables without synchronisation.
+ */
+inline void build_default_yield_tables(const std::array<BondSpec, YieldTables::MAX_INSTRUMENTS>& specs,
+                                       int32_t settlement_date) noexcept {
+    detail::default_tables.build(specs, settlement_date);
+}
+
+inline void build_default_yield_tables(int32_t settlement_date) noexcept {
+    detail::default_tables.build_on_the_run(settlement_date);
+}
+
+} // namespace market_data
+} // namespace hft
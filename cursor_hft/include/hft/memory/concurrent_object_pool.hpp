@@ -0,0 +1,299 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <cassert>
+#include "hft/timing/hft_timer.hpp"
+
+namespace hft {
+
+/**
+ * @brief Thread-safe fixed-size object pool with per-thread magazines
+ *
+ * Concurrent counterpart to ObjectPool for pools shared by components on
+ * different threads (strategies, lifecycle manager, order book):
+ * - Zero allocations after initialization, storage inline and 64-byte aligned
+ * - Each thread attaches a LocalCache holding a magazine of free objects;
+ *   the common acquire/release is a plain array push/pop, no atomics
+ * - Magazines refill from / spill to a lock-free global free list in
+ *   batches (one CAS moves up to MagazineSize/2 objects)
+ * - Global list head is a tagged index (32-bit tag + 32-bit slot), so a
+ *   slot popped and pushed back between a load and CAS cannot cause ABA
+ * - Objects remember the cache that acquired them; releasing from another
+ *   thread pushes onto the owner's remote list, which the owner drains
+ *   before touching the global list
+ *
+ * acquire()/release() on the pool itself bypass the caches and go straight
+ * to the global list, for threads that never attach.
+ *
+ * @tparam T Object type (trivially destructible)
+ * @tparam PoolSize Number of objects
+ * @tparam MagazineSize Objects cached per thread
+ * @tparam MaxThreads Maximum simultaneously attached caches
+ */
+template <typename T, std::size_t PoolSize, std::size_t MagazineSize = 32, std::size_t MaxThreads = 16>
+class ConcurrentObjectPool {
+    static_assert(PoolSize > 0, "PoolSize must be > 0");
+    static_assert(PoolSize <= 65536, "PoolSize unreasonably large for HFT stack pool");
+    static_assert(std::is_trivially_destructible_v<T>, "T should be trivially destructible for HFT object pool");
+    static_assert(alignof(T) <= 64, "T alignment must not exceed 64 bytes");
+    static_assert(MagazineSize >= 2 && (MagazineSize % 2) == 0, "MagazineSize must be even and >= 2");
+    static_assert(MaxThreads > 0 && MaxThreads < 255, "MaxThreads must fit the owner byte");
+
+public:
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+    static constexpr uint32_t NIL = 0xFFFFFFFFu;
+    static constexpr uint8_t NO_OWNER = 0xFF;
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * @brief Per-thread magazine; use only from the thread that attached it
+     */
+    class alignas(CACHE_LINE_SIZE) LocalCache {
+    public:
+        /**
+         * @brief Acquire from the local magazine, refilling in a batch when empty
+         * @return Pointer to T, or nullptr if the pool is exhausted
+         */
+        T* acquire() noexcept {
+            if (__builtin_expect(count_ == 0, 0)) {
+                if (!pool_->refill(*this)) {
+                    return nullptr;
+                }
+            }
+            const uint32_t idx = slots_[--count_];
+            pool_->owner_[idx].store(id_, std::memory_order_relaxed);
+            return &pool_->storage_[idx];
+        }
+
+        /**
+         * @brief Release an object; objects owned by another cache go back to it
+         */
+        void release(T* obj) noexcept {
+            const uint32_t idx = pool_->index_of(obj);
+            const uint8_t owner = pool_->owner_[idx].load(std::memory_order_relaxed);
+            if (__builtin_expect(owner != id_ && owner != NO_OWNER, 0)) {
+                pool_->push_remote(owner, idx);
+                return;
+            }
+            if (__builtin_expect(count_ == MagazineSize, 0)) {
+                pool_->spill(*this);
+            }
+            slots_[count_++] = idx;
+        }
+
+        [[nodiscard]] size_type cached() const noexcept { return count_; }
+        [[nodiscard]] uint8_t id() const noexcept { return id_; }
+
+    private:
+        friend class ConcurrentObjectPool;
+
+        ConcurrentObjectPool* pool_ = nullptr;
+        uint32_t count_ = 0;
+        uint8_t id_ = 0;
+        uint32_t slots_[MagazineSize];
+
+        // Objects released to us by other threads (Treiber stack, drained wholesale)
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> remote_head_{NIL};
+        std::atomic<bool> in_use_{false};
+    };
+
+    ConcurrentObjectPool() noexcept {
+        for (size_type i = 0; i < PoolSize; ++i) {
+            next_[i].store(i + 1 < PoolSize ? static_cast<uint32_t>(i + 1) : NIL, std::memory_order_relaxed);
+            owner_[i].store(NO_OWNER, std::memory_order_relaxed);
+        }
+        global_head_.store(pack(0, 0), std::memory_order_relaxed);
+        for (size_type i = 0; i < MaxThreads; ++i) {
+            caches_[i].pool_ = this;
+            caches_[i].id_ = static_cast<uint8_t>(i);
+        }
+    }
+
+    // No copy or move
+    ConcurrentObjectPool(const ConcurrentObjectPool&) = delete;
+    ConcurrentObjectPool& operator=(const ConcurrentObjectPool&) = delete;
+
+    /**
+     * @brief Attach a cache for the calling thread
+     * @return Cache, or nullptr if MaxThreads caches are attached
+     */
+    [[nodiscard]] LocalCache* attach() noexcept {
+        for (auto& cache : caches_) {
+            bool expected = false;
+            if (cache.in_use_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return &cache;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Return a cache's objects to the global list and free its slot
+     *
+     * Objects it handed out stay valid; later releases of them from other
+     * threads go to the global list.
+     */
+    void detach(LocalCache* cache) noexcept {
+        if (!cache) return;
+        drain_remote(*cache);
+        if (cache->count_ > 0) {
+            push_chain(cache->slots_, cache->count_);
+            cache->count_ = 0;
+        }
+        // Disown outstanding objects so remote releases stop targeting this slot
+        for (size_type i = 0; i < PoolSize; ++i) {
+            uint8_t expected = cache->id_;
+            owner_[i].compare_exchange_strong(expected, NO_OWNER, std::memory_order_relaxed);
+        }
+        drain_remote(*cache);
+        if (cache->count_ > 0) {
+            push_chain(cache->slots_, cache->count_);
+            cache->count_ = 0;
+        }
+        cache->in_use_.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Acquire directly from the global list (any thread, no cache)
+     */
+    T* acquire() noexcept {
+        uint32_t idx;
+        if (pop_chain(&idx, 1) == 0) {
+            return nullptr;
+        }
+        owner_[idx].store(NO_OWNER, std::memory_order_relaxed);
+        return &storage_[idx];
+    }
+
+    /**
+     * @brief Release directly to the global list, or to the owning cache
+     */
+    void release(T* obj) noexcept {
+        const uint32_t idx = index_of(obj);
+        const uint8_t owner = owner_[idx].load(std::memory_order_relaxed);
+        if (owner != NO_OWNER) {
+            push_remote(owner, idx);
+        } else {
+            push_chain(&idx, 1);
+        }
+    }
+
+    constexpr size_type capacity() const noexcept { return PoolSize; }
+    static constexpr size_type magazine_size() noexcept { return MagazineSize; }
+    static constexpr size_type max_threads() noexcept { return MaxThreads; }
+
+    /**
+     * @brief Objects on the global list (approximate under concurrency)
+     */
+    [[nodiscard]] size_type global_available() const noexcept {
+        size_type n = 0;
+        uint32_t idx = unpack_index(global_head_.load(std::memory_order_acquire));
+        while (idx != NIL && n < PoolSize) {
+            ++n;
+            idx = next_[idx].load(std::memory_order_relaxed);
+        }
+        return n;
+    }
+
+private:
+    static constexpr uint64_t pack(uint32_t idx, uint32_t tag) noexcept {
+        return (static_cast<uint64_t>(tag) << 32) | idx;
+    }
+    static constexpr uint32_t unpack_index(uint64_t v) noexcept { return static_cast<uint32_t>(v); }
+    static constexpr uint32_t unpack_tag(uint64_t v) noexcept { return static_cast<uint32_t>(v >> 32); }
+
+    uint32_t index_of(const T* obj) const noexcept {
+        assert(obj >= &storage_[0] && obj < &storage_[PoolSize]);
+        return static_cast<uint32_t>(obj - &storage_[0]);
+    }
+
+    // Pop up to max slots with one CAS; returns count popped
+    size_type pop_chain(uint32_t* out, size_type max) noexcept {
+        uint64_t head = global_head_.load(std::memory_order_acquire);
+        while (true) {
+            uint32_t idx = unpack_index(head);
+            if (idx == NIL) {
+                return 0;
+            }
+            // Walk the chain; links may be stale, in which case the tag changed and the CAS fails
+            size_type n = 0;
+            uint32_t cur = idx;
+            while (n < max && cur != NIL) {
+                out[n++] = cur;
+                cur = next_[cur].load(std::memory_order_relaxed);
+            }
+            if (global_head_.compare_exchange_weak(head, pack(cur, unpack_tag(head) + 1),
+                                                   std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return n;
+            }
+        }
+    }
+
+    // Link slots locally and push them with one CAS
+    void push_chain(const uint32_t* slots, size_type n) noexcept {
+        for (size_type i = 0; i + 1 < n; ++i) {
+            next_[slots[i]].store(slots[i + 1], std::memory_order_relaxed);
+        }
+        const uint32_t first = slots[0];
+        const uint32_t last = slots[n - 1];
+        uint64_t head = global_head_.load(std::memory_order_relaxed);
+        while (true) {
+            next_[last].store(unpack_index(head), std::memory_order_relaxed);
+            if (global_head_.compare_exchange_weak(head, pack(first, unpack_tag(head) + 1),
+                                                   std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    void push_remote(uint8_t owner, uint32_t idx) noexcept {
+        auto& head = caches_[owner].remote_head_;
+        uint32_t old_head = head.load(std::memory_order_relaxed);
+        do {
+            next_[idx].store(old_head, std::memory_order_relaxed);
+        } while (!head.compare_exchange_weak(old_head, idx, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Move remote releases into the magazine (excess spills to global)
+    void drain_remote(LocalCache& cache) noexcept {
+        uint32_t idx = cache.remote_head_.exchange(NIL, std::memory_order_acquire);
+        while (idx != NIL) {
+            const uint32_t next = next_[idx].load(std::memory_order_relaxed);
+            if (cache.count_ == MagazineSize) {
+                spill(cache);
+            }
+            cache.slots_[cache.count_++] = idx;
+            idx = next;
+        }
+    }
+
+    bool refill(LocalCache& cache) noexcept {
+        drain_remote(cache);
+        if (cache.count_ == 0) {
+            cache.count_ = static_cast<uint32_t>(pop_chain(cache.slots_, MagazineSize / 2));
+        }
+        return cache.count_ > 0;
+    }
+
+    // Return the older half of a full magazine to the global list
+    void spill(LocalCache& cache) noexcept {
+        constexpr size_type half = MagazineSize / 2;
+        push_chain(cache.slots_, half);
+        for (size_type i = 0; i < cache.count_ - half; ++i) {
+            cache.slots_[i] = cache.slots_[i + half];
+        }
+        cache.count_ -= half;
+    }
+
+    alignas(CACHE_LINE_SIZE) T storage_[PoolSize];
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> next_[PoolSize];
+    alignas(CACHE_LINE_SIZE) std::atomic<uint8_t> owner_[PoolSize];
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> global_head_;
+    alignas(CACHE_LINE_SIZE) LocalCache caches_[MaxThreads];
+};
+
+} // namespace hft
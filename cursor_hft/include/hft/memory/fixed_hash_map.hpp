@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <array>
+
+namespace hft {
+
+/**
+ * @brief Fixed-capacity open-addressing hash map for integral keys
+ *
+ * - Zero allocations: all slots live inline, sized at compile time
+ * - Robin Hood probing keeps probe sequences short and uniform
+ * - Backward-shift deletion (no tombstones, no periodic rehash)
+ * - Probe distances kept in a separate byte array so a miss scans
+ *   one or two cache lines of metadata before touching any slot
+ * - Fibonacci hashing, which spreads sequential IDs (order IDs,
+ *   component IDs) evenly across the table
+ * - Single-threaded, no atomics or locks
+ *
+ * The table is sized to at least twice MaxElements, so the load factor
+ * never exceeds 0.5 and insertions fail when MaxElements is reached, or
+ * (for adversarially colliding keys) when a probe would exceed MAX_PROBE;
+ * a refused insertion leaves the table unchanged.
+ *
+ * Pointers returned by find()/try_emplace() are invalidated by the next
+ * insert or erase, since Robin Hood probing moves entries.
+ *
+ * @tparam Key Integral key type
+ * @tparam Value Trivially copyable mapped type
+ * @tparam MaxElements Maximum number of live entries
+ */
+template <typename Key, typename Value, std::size_t MaxElements>
+class FixedHashMap {
+    static_assert(std::is_integral_v<Key>, "Key must be an integral type");
+    static_assert(std::is_trivially_copyable_v<Value>, "Value must be trivially copyable");
+    static_assert(MaxElements > 0, "MaxElements must be > 0");
+
+    static constexpr std::size_t next_pow2(std::size_t n) noexcept {
+        std::size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+public:
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+    static constexpr std::size_t SLOT_COUNT = next_pow2(MaxElements * 2 < 16 ? 16 : MaxElements * 2);
+    static constexpr std::size_t SLOT_MASK = SLOT_COUNT - 1;
+    static constexpr uint8_t EMPTY = 0;              // dist_ value for an unused slot
+    static constexpr uint8_t MAX_PROBE = 255;        // dist_ is stored as probe length + 1
+
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = std::size_t;
+
+    struct Slot {
+        Key key;
+        Value value;
+    };
+
+    FixedHashMap() noexcept : size_(0) {
+        dist_.fill(EMPTY);
+    }
+
+    // No copy or move
+    FixedHashMap(const FixedHashMap&) = delete;
+    FixedHashMap& operator=(const FixedHashMap&) = delete;
+
+    /**
+     * @brief Insert key if absent
+     * @return {pointer to mapped value, true} on insert; {existing value, false}
+     *         if key present; {nullptr, false} if the map is full
+     */
+    [[nodiscard]] std::pair<Value*, bool> try_emplace(Key key, const Value& value) noexcept {
+        if (Value* existing = find(key)) {
+            return {existing, false};
+        }
+        if (__builtin_expect(size_ >= MaxElements, 0)) {
+            return {nullptr, false};
+        }
+
+        // find() proved the key absent: it belongs at the first slot whose
+        // owner sits closer to home than the new entry would
+        size_type idx = home(key);
+        uint8_t dist = 1;
+        while (dist_[idx] >= dist) {
+            if (__builtin_expect(++dist == MAX_PROBE, 0)) {
+                return {nullptr, false};
+            }
+            idx = (idx + 1) & SLOT_MASK;
+        }
+
+        // Every entry from there to the next empty slot moves one slot on;
+        // check they all still fit before touching anything, so a refusal
+        // leaves the table exactly as it was
+        size_type end = idx;
+        while (dist_[end] != EMPTY) {
+            if (__builtin_expect(dist_[end] + 1 >= MAX_PROBE, 0)) {
+                return {nullptr, false};
+            }
+            end = (end + 1) & SLOT_MASK;
+        }
+
+        // Shift the cluster forward by one (the mirror of erase's backward shift)
+        while (end != idx) {
+            const size_type prev = (end - 1) & SLOT_MASK;
+            slots_[end] = slots_[prev];
+            dist_[end] = static_cast<uint8_t>(dist_[prev] + 1);
+            end = prev;
+        }
+        slots_[idx] = Slot{key, value};
+        dist_[idx] = dist;
+        ++size_;
+        return {&slots_[idx].value, true};
+    }
+
+    /**
+     * @brief Insert or overwrite
+     * @return false only if the map is full
+     */
+    bool insert_or_assign(Key key, const Value& value) noexcept {
+        auto [ptr, inserted] = try_emplace(key, value);
+        if (!ptr) {
+            return false;
+        }
+        if (!inserted) {
+            *ptr = value;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Lookup by key
+     * @return Pointer to mapped value, or nullptr if absent
+     */
+    [[nodiscard]] Value* find(Key key) noexcept {
+        return const_cast<Value*>(static_cast<const FixedHashMap*>(this)->find(key));
+    }
+
+    [[nodiscard]] const Value* find(Key key) const noexcept {
+        size_type idx = home(key);
+        uint8_t dist = 1;
+        // An entry further from home than the slot's owner cannot be present
+        while (dist_[idx] >= dist) {
+            if (slots_[idx].key == key) {
+                return &slots_[idx].value;
+            }
+            ++dist;
+            idx = (idx + 1) & SLOT_MASK;
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] bool contains(Key key) const noexcept { return find(key) != nullptr; }
+
+    /**
+     * @brief Remove key using backward-shift deletion
+     * @return true if the key was present
+     */
+    bool erase(Key key) noexcept {
+        size_type idx = home(key);
+        uint8_t dist = 1;
+        while (dist_[idx] >= dist) {
+            if (slots_[idx].key == key) {
+                // Shift the following cluster back by one until we hit an
+                // empty slot or an entry already at its home position
+                size_type next = (idx + 1) & SLOT_MASK;
+                while (dist_[next] > 1) {
+                    slots_[idx] = slots_[next];
+                    dist_[idx] = static_cast<uint8_t>(dist_[next] - 1);
+                    idx = next;
+                    next = (next + 1) & SLOT_MASK;
+                }
+                dist_[idx] = EMPTY;
+                --size_;
+                return true;
+            }
+            ++dist;
+            idx = (idx + 1) & SLOT_MASK;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Visit every live entry (slot order, not insertion order)
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) noexcept {
+        for (size_type i = 0; i < SLOT_COUNT; ++i) {
+            if (dist_[i] != EMPTY) {
+                fn(slots_[i].key, slots_[i].value);
+            }
+        }
+    }
+
+    void clear() noexcept {
+        dist_.fill(EMPTY);
+        size_ = 0;
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    static constexpr size_type capacity() noexcept { return MaxElements; }
+
+private:
+    // Fibonacci hashing: multiply by 2^64/phi and keep the top bits
+    static constexpr unsigned SHIFT = 64 - __builtin_ctzll(SLOT_COUNT);
+    static size_type home(Key key) noexcept {
+        return static_cast<size_type>(
+            (static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL) >> SHIFT);
+    }
+
+    alignas(CACHE_LINE_SIZE) std::array<uint8_t, SLOT_COUNT> dist_;
+    alignas(CACHE_LINE_SIZE) std::array<Slot, SLOT_COUNT> slots_;
+    alignas(CACHE_LINE_SIZE) size_type size_;
+};
+
+} // namespace hft
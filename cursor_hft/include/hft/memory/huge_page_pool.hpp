@@ -0,0 +1,284 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <new>
+#include <cassert>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "hft/timing/hft_timer.hpp"
+
+namespace hft {
+
+/**
+ * @brief Large object pool backed by mmap'd huge-page slabs
+ *
+ * For pools beyond ObjectPool's inline 65536-object limit (peak-session
+ * order counts), without embedding the storage in the owning object:
+ * - Slabs are mmap'd separately, rounded to 2MB and backed by huge pages
+ *   where available (MAP_HUGETLB, falling back to madvise(MADV_HUGEPAGE))
+ *   to cut TLB misses on random access across the pool
+ * - Prefaulted and mlock'd at construction so the hot path never page-faults
+ * - Optional growth: grow() maps an extra slab; acquire() never maps
+ *   memory, so growth stays off the hot path (call grow() from housekeeping
+ *   when needs_growth() reports the low-water mark)
+ * - Same acquire/release/size/capacity/available interface as ObjectPool;
+ *   stack-based free list, single-threaded, no atomics or locks
+ *
+ * The free list is reserved for max_slabs up front, so growing never moves
+ * it. Objects never move once handed out.
+ *
+ * @tparam T Object type (trivially destructible)
+ * @tparam EnableTiming Time every acquire() like ObjectPool
+ */
+template <typename T, bool EnableTiming = false>
+class HugePageObjectPool {
+    static_assert(std::is_trivially_destructible_v<T>, "T should be trivially destructible for HFT object pool");
+    static_assert(alignof(T) <= 64, "T alignment must not exceed 64 bytes");
+
+public:
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+    static constexpr std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    static constexpr std::size_t MAX_SLABS = 64;
+    static constexpr std::size_t OBJECT_STRIDE = (sizeof(T) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    using value_type = T;
+    using size_type = std::size_t;
+
+    struct Options {
+        size_type objects_per_slab = 65536;
+        size_type max_slabs = 1;        // >1 enables grow()
+        bool huge_pages = true;
+        bool prefault = true;
+        bool lock_memory = true;
+        size_type grow_low_water = 0;   // needs_growth() threshold (0 = 1/8 of a slab)
+    };
+
+    HugePageObjectPool() noexcept : HugePageObjectPool(Options{}) {}
+
+    explicit HugePageObjectPool(const Options& options) noexcept
+        : options_(options), slab_count_(0), free_top_(0), allocated_(0), last_alloc_ns_(0),
+          free_list_(nullptr), free_list_bytes_(0), huge_pages_active_(true), memory_locked_(true) {
+        if (options_.max_slabs == 0 || options_.max_slabs > MAX_SLABS) {
+            options_.max_slabs = options_.max_slabs == 0 ? 1 : MAX_SLABS;
+        }
+        if (options_.grow_low_water == 0) {
+            options_.grow_low_water = options_.objects_per_slab / 8;
+        }
+        free_list_bytes_ = round_up(options_.objects_per_slab * options_.max_slabs * sizeof(T*), page_size());
+        void* fl = map(free_list_bytes_, false);
+        if (!fl) {
+            free_list_bytes_ = 0;
+            return;
+        }
+        free_list_ = static_cast<T**>(fl);
+        (void)grow();
+    }
+
+    ~HugePageObjectPool() {
+        for (size_type i = 0; i < slab_count_; ++i) {
+            ::munmap(slabs_[i].base, slabs_[i].bytes);
+        }
+        if (free_list_) {
+            ::munmap(free_list_, free_list_bytes_);
+        }
+    }
+
+    // No copy or move
+    HugePageObjectPool(const HugePageObjectPool&) = delete;
+    HugePageObjectPool& operator=(const HugePageObjectPool&) = delete;
+
+    /**
+     * @brief Acquire an object (never maps memory)
+     * @return Pointer to T, or nullptr if all slabs are exhausted
+     */
+    T* acquire() noexcept {
+        if constexpr (EnableTiming) {
+            auto start = hft::HFTTimer::get_cycles();
+            T* obj = acquire_impl();
+            last_alloc_ns_ = hft::HFTTimer::cycles_to_ns(hft::HFTTimer::get_cycles() - start);
+            return obj;
+        } else {
+            return acquire_impl();
+        }
+    }
+
+    /**
+     * @brief Release an object back to the pool
+     */
+    void release(T* obj) noexcept {
+        assert(owns(obj));
+        assert(allocated_ > 0);
+        free_list_[free_top_++] = obj;
+        --allocated_;
+    }
+
+    /**
+     * @brief Map one more slab (off the hot path)
+     * @return false if max_slabs is reached or mmap fails
+     */
+    bool grow() noexcept {
+        if (!free_list_ || slab_count_ >= options_.max_slabs) {
+            return false;
+        }
+        const size_type bytes = round_up(options_.objects_per_slab * OBJECT_STRIDE, HUGE_PAGE_SIZE);
+        void* base = map(bytes, options_.huge_pages);
+        if (!base) {
+            return false;
+        }
+
+        Slab& slab = slabs_[slab_count_++];
+        slab.base = base;
+        slab.bytes = bytes;
+        slab.objects = static_cast<char*>(base);
+
+        // Push in reverse so the first acquires come from the slab start
+        for (size_type i = options_.objects_per_slab; i-- > 0;) {
+            free_list_[free_top_++] = reinterpret_cast<T*>(slab.objects + i * OBJECT_STRIDE);
+        }
+        return true;
+    }
+
+    /**
+     * @brief True when free objects drop below the low-water mark and a slab can still be added
+     */
+    [[nodiscard]] bool needs_growth() const noexcept {
+        return free_top_ < options_.grow_low_water && slab_count_ < options_.max_slabs;
+    }
+
+    /**
+     * @brief Return every object to the free list (slabs stay mapped)
+     */
+    void reset() noexcept {
+        free_top_ = 0;
+        for (size_type s = slab_count_; s-- > 0;) {
+            for (size_type i = options_.objects_per_slab; i-- > 0;) {
+                free_list_[free_top_++] = reinterpret_cast<T*>(slabs_[s].objects + i * OBJECT_STRIDE);
+            }
+        }
+        allocated_ = 0;
+    }
+
+    size_type size() const noexcept { return allocated_; }
+    size_type capacity() const noexcept { return slab_count_ * options_.objects_per_slab; }
+    size_type available() const noexcept { return free_top_; }
+    size_type slab_count() const noexcept { return slab_count_; }
+    size_type max_capacity() const noexcept { return options_.max_slabs * options_.objects_per_slab; }
+    bool valid() const noexcept { return slab_count_ > 0; }
+
+    /**
+     * @brief Whether every slab got explicit huge pages (MAP_HUGETLB or MADV_HUGEPAGE accepted)
+     */
+    bool huge_pages_active() const noexcept { return valid() && options_.huge_pages && huge_pages_active_; }
+    bool memory_locked() const noexcept { return valid() && memory_locked_; }
+
+    hft::HFTTimer::ns_t last_alloc_ns() const noexcept { return last_alloc_ns_; }
+
+    bool owns(const T* obj) const noexcept {
+        const char* p = reinterpret_cast<const char*>(obj);
+        for (size_type i = 0; i < slab_count_; ++i) {
+            const char* begin = slabs_[i].objects;
+            if (p >= begin && p < begin + options_.objects_per_slab * OBJECT_STRIDE) {
+                return (static_cast<size_type>(p - begin) % OBJECT_STRIDE) == 0;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Validate object alignment across all slabs
+     */
+    bool validate_memory() const noexcept {
+        for (size_type i = 0; i < slab_count_; ++i) {
+            if (reinterpret_cast<uintptr_t>(slabs_[i].objects) % CACHE_LINE_SIZE != 0) return false;
+        }
+        return OBJECT_STRIDE % CACHE_LINE_SIZE == 0;
+    }
+
+private:
+    struct Slab {
+        void* base = nullptr;
+        size_type bytes = 0;
+        char* objects = nullptr;
+    };
+
+    static size_type page_size() noexcept {
+        static const size_type size = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    static size_type round_up(size_type n, size_type align) noexcept {
+        return (n + align - 1) / align * align;
+    }
+
+    // mmap anonymous memory, optionally huge-page backed, then prefault and lock
+    void* map(size_type bytes, bool huge) noexcept {
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_POPULATE
+        if (options_.prefault) flags |= MAP_POPULATE;
+#endif
+        void* base = MAP_FAILED;
+        bool got_huge = false;
+        bool hugetlb = false;
+#ifdef MAP_HUGETLB
+        if (huge) {
+            base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+            hugetlb = got_huge = base != MAP_FAILED;
+        }
+#endif
+        if (base == MAP_FAILED) {
+            base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if (base == MAP_FAILED) {
+                return nullptr;
+            }
+#ifdef MADV_HUGEPAGE
+            // Transparent huge pages: must be requested before the pages are touched
+            if (huge) {
+                got_huge = ::madvise(base, bytes, MADV_HUGEPAGE) == 0;
+            }
+#endif
+        }
+        if (huge) {
+            huge_pages_active_ = huge_pages_active_ && got_huge;
+        }
+
+        if (options_.prefault) {
+            // MAP_POPULATE is advisory (and absent off Linux); touch every page
+            const size_type step = hugetlb ? HUGE_PAGE_SIZE : page_size();
+            volatile char* p = static_cast<char*>(base);
+            for (size_type off = 0; off < bytes; off += step) {
+                p[off] = 0;
+            }
+        }
+        if (options_.lock_memory) {
+            // Non-fatal: RLIMIT_MEMLOCK may be too small outside production hosts
+            memory_locked_ = memory_locked_ && ::mlock(base, bytes) == 0;
+        }
+        return base;
+    }
+
+    T* acquire_impl() noexcept {
+        if (__builtin_expect(free_top_ == 0, 0)) {
+            return nullptr;
+        }
+        if (free_top_ > 1) {
+            __builtin_prefetch(free_list_[free_top_ - 2], 1, 1);
+        }
+        ++allocated_;
+        return free_list_[--free_top_];
+    }
+
+    Options options_;
+    Slab slabs_[MAX_SLABS];
+    size_type slab_count_;
+    alignas(CACHE_LINE_SIZE) size_type free_top_;
+    size_type allocated_;
+    hft::HFTTimer::ns_t last_alloc_ns_;
+    T** free_list_;
+    size_type free_list_bytes_;
+    bool huge_pages_active_;
+    bool memory_locked_;
+};
+
+} // namespace hft
@@ -26,7 +26,7 @@ namespace hft {
 template <typename T, std::size_t PoolSize, bool EnableTiming = false>
 class ObjectPool {
     static_assert(PoolSize > 0, "PoolSize must be > 0");
-    static_assert(PoolSize <= 65536, "PoolSize unreasonably large for HFT stack pool");
+    static_assert(PoolSize <= 65536, "PoolSize unreasonably large for HFT stack pool (use HugePageObjectPool)");
     static_assert(std::is_trivially_destructible_v<T>, "T should be trivially destructible for HFT object pool");
     static_assert(alignof(T) <= 64, "T alignment must not exceed 64 bytes");
 
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <array>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include "../timing/hft_timer.hpp"
+
+namespace hft {
+
+/**
+ * @brief Single Producer Multi Consumer broadcast ring (disruptor style)
+ *
+ * Every consumer sees every item, each at its own pace:
+ * - One shared buffer; each consumer owns a cursor on its own cache line
+ * - The producer gates on the slowest consumer and keeps a cached copy of
+ *   that minimum, rescanning cursors only when the cache says full
+ * - Consumers read the producer cursor only; no consumer writes a line
+ *   that another consumer reads
+ * - Positions are free-running 64-bit counters; full capacity is usable
+ *
+ * Consumers attach with subscribe(), which returns a Consumer handle with
+ * the SPSCRingBuffer pop interface (try_pop/try_pop_batch). Subscribe
+ * consumers before the producer starts; a consumer joining later starts
+ * at the current producer position.
+ *
+ * @tparam T Message type (must be trivially copyable)
+ * @tparam Size Buffer capacity (must be power of 2)
+ * @tparam MaxConsumers Maximum number of subscribed consumers
+ */
+template<typename T, size_t Size, size_t MaxConsumers = 4>
+class alignas(HFTTimer::CACHE_LINE_SIZE) BroadcastRingBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert((Size & (Size - 1)) == 0, "Size must be a power of 2");
+    static_assert(Size > 1, "Size must be greater than 1");
+    static_assert(MaxConsumers > 0, "MaxConsumers must be > 0");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using timestamp_t = HFTTimer::timestamp_t;
+
+    static constexpr size_t INACTIVE = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Per-consumer read handle (use from one thread)
+     */
+    class Consumer {
+    public:
+        Consumer() noexcept : ring_(nullptr), id_(0) {}
+
+        [[nodiscard]] bool valid() const noexcept { return ring_ != nullptr; }
+        [[nodiscard]] size_t id() const noexcept { return id_; }
+
+        [[nodiscard]] bool try_pop(T& item) noexcept { return ring_->try_pop(id_, item); }
+
+        template<typename Iterator>
+        [[nodiscard]] size_t try_pop_batch(Iterator begin, Iterator end) noexcept {
+            return ring_->try_pop_batch(id_, begin, end);
+        }
+
+        [[nodiscard]] size_t size() const noexcept { return ring_->size(id_); }
+        [[nodiscard]] bool empty() const noexcept { return ring_->size(id_) == 0; }
+
+    private:
+        friend class BroadcastRingBuffer;
+        Consumer(BroadcastRingBuffer* ring, size_t id) noexcept : ring_(ring), id_(id) {}
+
+        BroadcastRingBuffer* ring_;
+        size_t id_;
+    };
+
+    BroadcastRingBuffer() noexcept : head_(0), cached_min_cursor_(0) {
+        for (auto& c : cursors_) {
+            c.position.store(INACTIVE, std::memory_order_relaxed);
+        }
+    }
+
+    // Prevent copying
+    BroadcastRingBuffer(const BroadcastRingBuffer&) = delete;
+    BroadcastRingBuffer& operator=(const BroadcastRingBuffer&) = delete;
+
+    /**
+     * @brief Attach a new consumer at the current producer position
+     * @return Consumer handle; invalid() if MaxConsumers are already attached
+     */
+    [[nodiscard]] Consumer subscribe() noexcept {
+        const size_t start = head_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < MaxConsumers; ++i) {
+            size_t expected = INACTIVE;
+            if (cursors_[i].position.compare_exchange_strong(expected, start, std::memory_order_acq_rel)) {
+                return Consumer(this, i);
+            }
+        }
+        return Consumer();
+    }
+
+    /**
+     * @brief Detach a consumer so it no longer gates the producer
+     */
+    void unsubscribe(Consumer& consumer) noexcept {
+        if (consumer.valid()) {
+            cursors_[consumer.id_].position.store(INACTIVE, std::memory_order_release);
+            consumer = Consumer();
+        }
+    }
+
+    /**
+     * @brief Try to publish a single item (producer thread only)
+     * @return true if successful, false if the slowest consumer is a full lap behind
+     */
+    [[nodiscard]] bool try_push(const T& item) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head - cached_min_cursor_ >= Size) {
+            cached_min_cursor_ = min_cursor(head);
+            if (head - cached_min_cursor_ >= Size) {
+                return false;
+            }
+        }
+
+        // Prefetch the next write location
+        __builtin_prefetch(&buffer_[(head + 1) & (Size - 1)], 1, 3);
+
+        std::memcpy(&buffer_[head & (Size - 1)], &item, sizeof(T));
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Try to publish multiple items (producer thread only)
+     * @return Number of items successfully pushed
+     */
+    template<typename Iterator>
+    [[nodiscard]] size_t try_push_batch(Iterator begin, Iterator end) noexcept {
+        const size_t requested = static_cast<size_t>(std::distance(begin, end));
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head - cached_min_cursor_ + requested > Size) {
+            cached_min_cursor_ = min_cursor(head);
+        }
+        const size_t available = Size - (head - cached_min_cursor_);
+        const size_t batch_size = std::min(available, requested);
+        if (batch_size == 0) {
+            return 0;
+        }
+
+        for (size_t i = 0; i < batch_size; ++i) {
+            std::memcpy(&buffer_[(head + i) & (Size - 1)], &(*begin++), sizeof(T));
+        }
+        head_.store(head + batch_size, std::memory_order_release);
+        return batch_size;
+    }
+
+    /**
+     * @brief Read the next item for a consumer
+     * @return true if successful, false if the consumer is caught up
+     */
+    [[nodiscard]] bool try_pop(size_t consumer_id, T& item) noexcept {
+        auto& cursor = cursors_[consumer_id].position;
+        const size_t pos = cursor.load(std::memory_order_relaxed);
+        if (pos == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        // Prefetch the next read location
+        __builtin_prefetch(&buffer_[(pos + 1) & (Size - 1)], 0, 3);
+
+        std::memcpy(&item, &buffer_[pos & (Size - 1)], sizeof(T));
+        cursor.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Read up to the destination size for a consumer
+     * @return Number of items successfully popped
+     */
+    template<typename Iterator>
+    [[nodiscard]] size_t try_pop_batch(size_t consumer_id, Iterator begin, Iterator end) noexcept {
+        auto& cursor = cursors_[consumer_id].position;
+        const size_t pos = cursor.load(std::memory_order_relaxed);
+        const size_t available = head_.load(std::memory_order_acquire) - pos;
+        const size_t batch_size = std::min(available, static_cast<size_t>(std::distance(begin, end)));
+        if (batch_size == 0) {
+            return 0;
+        }
+
+        for (size_t i = 0; i < batch_size; i += std::max<size_t>(1, HFTTimer::CACHE_LINE_SIZE / sizeof(T))) {
+            __builtin_prefetch(&buffer_[(pos + i) & (Size - 1)], 0, 3);
+        }
+        for (size_t i = 0; i < batch_size; ++i) {
+            std::memcpy(&(*begin++), &buffer_[(pos + i) & (Size - 1)], sizeof(T));
+        }
+        cursor.store(pos + batch_size, std::memory_order_release);
+        return batch_size;
+    }
+
+    /**
+     * @brief Items pending for one consumer
+     */
+    [[nodiscard]] size_t size(size_t consumer_id) const noexcept {
+        const size_t pos = cursors_[consumer_id].position.load(std::memory_order_acquire);
+        if (pos == INACTIVE) {
+            return 0;
+        }
+        return head_.load(std::memory_order_acquire) - pos;
+    }
+
+    /**
+     * @brief Items not yet read by the slowest consumer
+     */
+    [[nodiscard]] size_t size() const noexcept {
+        const size_t head = head_.load(std::memory_order_acquire);
+        return head - min_cursor(head);
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] bool full() const noexcept { return size() == Size; }
+
+    [[nodiscard]] size_t consumer_count() const noexcept {
+        size_t count = 0;
+        for (const auto& c : cursors_) {
+            count += c.position.load(std::memory_order_relaxed) != INACTIVE;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Maximum number of items the buffer can hold
+     */
+    [[nodiscard]] static constexpr size_t capacity() noexcept {
+        return Size;
+    }
+
+    [[nodiscard]] static constexpr size_t max_consumers() noexcept {
+        return MaxConsumers;
+    }
+
+private:
+    struct alignas(HFTTimer::CACHE_LINE_SIZE) Cursor {
+        std::atomic<size_t> position;
+    };
+
+    // Slowest active consumer; with none attached the producer never blocks
+    [[nodiscard]] size_t min_cursor(size_t head) const noexcept {
+        size_t min_pos = head;
+        for (const auto& c : cursors_) {
+            const size_t pos = c.position.load(std::memory_order_acquire);
+            if (pos != INACTIVE && pos < min_pos) {
+                min_pos = pos;
+            }
+        }
+        return min_pos;
+    }
+
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::array<T, Size> buffer_;
+
+    // Producer cursor plus its private gating cache
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<size_t> head_;
+    alignas(HFTTimer::CACHE_LINE_SIZE) size_t cached_min_cursor_;
+
+    // One cursor per consumer, each on its own cache line
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::array<Cursor, MaxConsumers> cursors_;
+};
+
+} // namespace hft
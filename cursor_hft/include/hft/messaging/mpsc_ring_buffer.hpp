@@ -0,0 +1,214 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <array>
+#include <algorithm>
+#include <iterator>
+#include "../timing/hft_timer.hpp"
+
+namespace hft {
+
+/**
+ * @brief Bounded Multi Producer Single Consumer (MPSC) ring buffer
+ *
+ * Lock-free queue for several producer threads (strategies, venues) feeding
+ * one consumer, replacing a mutex around an SPSCRingBuffer. Based on the
+ * Vyukov bounded queue:
+ * - Each slot carries a sequence number; a producer owns a slot once its
+ *   CAS on the enqueue position succeeds, and publishes it by bumping the
+ *   slot sequence, so the consumer never waits on a shared commit index
+ * - Producers contend only on one CAS per push (or per batch)
+ * - Consumer side is wait-free and touches no producer-written line other
+ *   than the slot it reads
+ * - Positions are free-running 64-bit counters; full capacity is usable
+ *
+ * Same interface as SPSCRingBuffer (try_push/try_pop and batch variants).
+ *
+ * @tparam T Message type (must be trivially copyable)
+ * @tparam Size Buffer capacity (must be power of 2)
+ */
+template<typename T, size_t Size>
+class alignas(HFTTimer::CACHE_LINE_SIZE) MPSCRingBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert((Size & (Size - 1)) == 0, "Size must be a power of 2");
+    static_assert(Size > 1, "Size must be greater than 1");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using timestamp_t = HFTTimer::timestamp_t;
+
+    MPSCRingBuffer() noexcept : enqueue_pos_(0), dequeue_pos_(0) {
+        for (size_t i = 0; i < Size; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Prevent copying
+    MPSCRingBuffer(const MPSCRingBuffer&) = delete;
+    MPSCRingBuffer& operator=(const MPSCRingBuffer&) = delete;
+
+    /**
+     * @brief Try to push a single item (any thread)
+     * @return true if successful, false if buffer is full
+     */
+    [[nodiscard]] bool try_push(const T& item) noexcept {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots_[pos & (Size - 1)];
+            const size_t seq = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Slot still holds an unconsumed item from the previous lap
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::memcpy(&slot->data, &item, sizeof(T));
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Try to pop a single item (consumer thread only)
+     * @return true if successful, false if buffer is empty
+     */
+    [[nodiscard]] bool try_pop(T& item) noexcept {
+        const size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos & (Size - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;  // Empty, or the producer that claimed it has not published yet
+        }
+
+        // Prefetch the next read location
+        __builtin_prefetch(&slots_[(pos + 1) & (Size - 1)], 0, 3);
+
+        std::memcpy(&item, &slot.data, sizeof(T));
+        slot.sequence.store(pos + Size, std::memory_order_release);
+        dequeue_pos_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Try to push multiple items as one contiguous claim (any thread)
+     *
+     * Claims min(count, free space) slots with a single CAS, so a batch is
+     * never interleaved with another producer's items.
+     *
+     * @return Number of items successfully pushed
+     */
+    template<typename Iterator>
+    [[nodiscard]] size_t try_push_batch(Iterator begin, Iterator end) noexcept {
+        const size_t requested = static_cast<size_t>(std::distance(begin, end));
+        if (requested == 0) {
+            return 0;
+        }
+
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        size_t batch_size;
+        while (true) {
+            // Slots below dequeue_pos_ + Size have been released by the consumer
+            const size_t head = dequeue_pos_.load(std::memory_order_acquire);
+            const size_t used = pos - head;
+            if (used >= Size) {
+                // Stale position (another producer moved on) or genuinely full
+                const size_t current = enqueue_pos_.load(std::memory_order_relaxed);
+                if (current == pos) {
+                    return 0;
+                }
+                pos = current;
+                continue;
+            }
+            batch_size = std::min(requested, Size - used);
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + batch_size, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < batch_size; ++i) {
+            Slot& slot = slots_[(pos + i) & (Size - 1)];
+            std::memcpy(&slot.data, &(*begin++), sizeof(T));
+            slot.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return batch_size;
+    }
+
+    /**
+     * @brief Pop up to the destination size (consumer thread only)
+     *
+     * Stops at the first slot not yet published, so ordering per producer
+     * is preserved even when a slower producer holds an earlier slot.
+     *
+     * @return Number of items successfully popped
+     */
+    template<typename Iterator>
+    [[nodiscard]] size_t try_pop_batch(Iterator begin, Iterator end) noexcept {
+        const size_t requested = static_cast<size_t>(std::distance(begin, end));
+        const size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+        size_t count = 0;
+        while (count < requested) {
+            Slot& slot = slots_[(pos + count) & (Size - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != pos + count + 1) {
+                break;
+            }
+            std::memcpy(&(*begin++), &slot.data, sizeof(T));
+            slot.sequence.store(pos + count + Size, std::memory_order_release);
+            ++count;
+        }
+
+        if (count > 0) {
+            dequeue_pos_.store(pos + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Approximate number of claimed items (exact when producers are idle)
+     */
+    [[nodiscard]] size_t size() const noexcept {
+        const size_t tail = dequeue_pos_.load(std::memory_order_acquire);
+        const size_t head = enqueue_pos_.load(std::memory_order_acquire);
+        return head > tail ? std::min(head - tail, Size) : 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    [[nodiscard]] bool full() const noexcept {
+        return size() == Size;
+    }
+
+    /**
+     * @brief Maximum number of items the buffer can hold
+     */
+    [[nodiscard]] static constexpr size_t capacity() noexcept {
+        return Size;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::array<Slot, Size> slots_;
+
+    // Shared by all producers
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_;
+
+    // Written only by the consumer
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_;
+};
+
+} // namespace hft
@@ -0,0 +1,678 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <new>
+#include <string>
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../timing/hft_timer.hpp"
+
+namespace hft {
+
+/**
+ * @brief Which end of a shared-memory ring this handle drives
+ */
+enum class ShmRole : uint8_t {
+    PRODUCER = 0,
+    CONSUMER = 1
+};
+
+/**
+ * @brief What the other end of a shared-memory ring is doing
+ */
+enum class ShmPeerState : uint8_t {
+    NEVER_ATTACHED = 0,     // No peer has opened this ring yet
+    ATTACHED = 1,           // Peer process holds its end
+    CLOSED = 2,             // Peer detached cleanly
+    CRASHED = 3             // Peer process died while attached
+};
+
+/**
+ * @brief Where and how shared-memory channels are mapped
+ */
+struct ShmChannelOptions {
+    const char* directory = "/dev/shm";                  // tmpfs fallback (THP via MADV_HUGEPAGE)
+    const char* huge_page_directory = "/dev/hugepages";  // hugetlbfs mount, tried first
+    bool huge_pages = true;
+    bool prefault = true;                                // MAP_POPULATE so the hot path never faults
+    uint32_t open_timeout_ms = 1000;                     // open(): wait for the creator to initialise
+};
+
+constexpr uint64_t SHM_RING_MAGIC = 0x3147524d48534648ULL;  // "HFSHMRG1"
+constexpr uint32_t SHM_RING_VERSION = 1;
+
+namespace detail {
+
+// Common to every ring; the creator publishes `ready` last
+struct alignas(64) ShmRingHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint32_t element_align;
+    uint32_t _pad0;
+    uint64_t slots;
+    std::atomic<uint32_t> ready;
+    std::atomic<uint32_t> attached[2];      // Role has attached at least once
+    std::atomic<uint32_t> closed[2];        // Role detached cleanly since its last attach
+    std::atomic<int32_t> pid[2];
+};
+static_assert(sizeof(ShmRingHeader) == 64, "ShmRingHeader must be one cache line");
+static_assert(std::atomic<size_t>::is_always_lock_free, "Ring indices must be lock-free to live in shared memory");
+
+template<typename T, size_t Size>
+struct ShmRingLayout {
+    ShmRingHeader header;
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<size_t> head;
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<size_t> tail;
+    alignas(HFTTimer::CACHE_LINE_SIZE) T buffer[Size];
+};
+
+inline std::string shm_path(const char* directory, const char* name) {
+    return std::string(directory) + "/" + name;
+}
+
+inline bool shm_name_valid(const char* name) noexcept {
+    const size_t length = name ? std::strlen(name) : 0;
+    return length > 0 && length < 64 && std::strchr(name, '/') == nullptr;
+}
+
+inline bool is_directory(const char* path) noexcept {
+    struct stat st{};
+    return path != nullptr && ::stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+// Open-file-description locks belong to the open file, not the process, and
+// the kernel drops them when the process dies: holding byte `offset` is how a
+// process says "I am attached". Plain POSIX locks are the portable fallback.
+#ifdef F_OFD_SETLK
+constexpr int SHM_SETLK = F_OFD_SETLK;
+constexpr int SHM_SETLKW = F_OFD_SETLKW;
+constexpr int SHM_GETLK = F_OFD_GETLK;
+#else
+constexpr int SHM_SETLK = F_SETLK;
+constexpr int SHM_SETLKW = F_SETLKW;
+constexpr int SHM_GETLK = F_GETLK;
+#endif
+
+inline bool shm_lock(int fd, off_t offset, bool wait) noexcept {
+    struct flock fl{};
+    fl.l_type = F_WRLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = offset;
+    fl.l_len = 1;
+    while (::fcntl(fd, wait ? SHM_SETLKW : SHM_SETLK, &fl) != 0) {
+        if (errno != EINTR) return false;
+    }
+    return true;
+}
+
+inline void shm_unlock(int fd, off_t offset) noexcept {
+    struct flock fl{};
+    fl.l_type = F_UNLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = offset;
+    fl.l_len = 1;
+    (void)::fcntl(fd, SHM_SETLK, &fl);
+}
+
+inline bool shm_locked_elsewhere(int fd, off_t offset) noexcept {
+    struct flock fl{};
+    fl.l_type = F_WRLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = offset;
+    fl.l_len = 1;
+    return ::fcntl(fd, SHM_GETLK, &fl) == 0 && fl.l_type != F_UNLCK;
+}
+
+/**
+ * @brief Remove a channel's backing file from either directory
+ */
+inline bool shm_unlink(const char* name, const ShmChannelOptions& options) noexcept {
+    if (!shm_name_valid(name)) return false;
+    bool removed = false;
+    if (is_directory(options.huge_page_directory)) {
+        removed |= ::unlink(shm_path(options.huge_page_directory, name).c_str()) == 0;
+    }
+    removed |= ::unlink(shm_path(options.directory, name).c_str()) == 0;
+    return removed;
+}
+
+} // namespace detail
+
+/**
+ * @brief SPSCRingBuffer whose storage is a named shared-memory file
+ *
+ * Same interface and hot-path code as SPSCRingBuffer; only the indices and
+ * slots live in the mapping, while each side's cached copy of the other
+ * index stays in its own handle, so a cross-process hop costs the same
+ * cache-line transfers as an in-thread one. Features:
+ * - Backed by hugetlbfs when mounted (huge_page_directory), else by tmpfs
+ *   with MADV_HUGEPAGE; prefaulted with MAP_POPULATE
+ * - One handle per side: create() by whichever process starts first,
+ *   open() by the other; a second handle for an attached role is refused
+ * - Crash detection: each side holds a file lock on its role byte while
+ *   attached, which the kernel releases if the process dies, so
+ *   peer_state() tells a crashed peer from a clean close() or one that
+ *   never came; a restarted peer reattaches and resumes from the indices
+ *
+ * Hot-path calls do not check the role: call only the producer or only
+ * the consumer half, as with SPSCRingBuffer.
+ *
+ * @tparam T Message type (must be trivially copyable)
+ * @tparam Size Buffer capacity (must be power of 2)
+ */
+template<typename T, size_t Size>
+class alignas(HFTTimer::CACHE_LINE_SIZE) ShmSPSCRingBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert((Size & (Size - 1)) == 0, "Size must be a power of 2");
+    static_assert(Size > 0, "Size must be greater than 0");
+
+    using Layout = detail::ShmRingLayout<T, Size>;
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using timestamp_t = HFTTimer::timestamp_t;
+
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    ShmSPSCRingBuffer() noexcept
+        : layout_(nullptr), head_(nullptr), tail_(nullptr), buffer_(nullptr), cached_tail_(0), cached_head_(0),
+          fd_(-1), bytes_(0), role_(ShmRole::PRODUCER), huge_pages_active_(false) {}
+    ~ShmSPSCRingBuffer() { close(); }
+
+    // Prevent copying
+    ShmSPSCRingBuffer(const ShmSPSCRingBuffer&) = delete;
+    ShmSPSCRingBuffer& operator=(const ShmSPSCRingBuffer&) = delete;
+
+    /**
+     * @brief Create (replacing any stale file) and attach as `role`
+     */
+    bool create(const char* name, ShmRole role, const ShmChannelOptions& options = ShmChannelOptions{}) noexcept {
+        close();
+        if (!detail::shm_name_valid(name)) return false;
+        (void)detail::shm_unlink(name, options);
+
+        if (options.huge_pages && detail::is_directory(options.huge_page_directory) &&
+            map_new(detail::shm_path(options.huge_page_directory, name), HUGE_PAGE_SIZE, options)) {
+            huge_pages_active_ = true;
+        } else if (!map_new(detail::shm_path(options.directory, name), page_size(), options)) {
+            return false;
+        } else if (options.huge_pages) {
+            (void)::madvise(layout_, bytes_, MADV_HUGEPAGE);
+        }
+
+        auto& header = layout_->header;
+        header.magic = SHM_RING_MAGIC;
+        header.version = SHM_RING_VERSION;
+        header.element_size = sizeof(T);
+        header.element_align = alignof(T);
+        header.slots = Size;
+        new (&layout_->head) std::atomic<size_t>(0);
+        new (&layout_->tail) std::atomic<size_t>(0);
+        header.ready.store(1, std::memory_order_release);
+        return attach(role);
+    }
+
+    /**
+     * @brief Attach as `role` to a ring created by another handle or process
+     * @return false if missing, of another type, or `role` is already attached
+     */
+    bool open(const char* name, ShmRole role, const ShmChannelOptions& options = ShmChannelOptions{}) noexcept {
+        close();
+        if (!detail::shm_name_valid(name)) return false;
+        const uint64_t deadline = HFTTimer::get_timestamp_ns() + uint64_t{options.open_timeout_ms} * 1000000;
+        for (;;) {
+            if ((options.huge_pages && detail::is_directory(options.huge_page_directory) &&
+                 map_existing(detail::shm_path(options.huge_page_directory, name), options)) ||
+                map_existing(detail::shm_path(options.directory, name), options)) {
+                break;
+            }
+            if (HFTTimer::get_timestamp_ns() > deadline) return false;
+            ::usleep(100);  // Creator still sizing or initialising
+        }
+
+        const auto& header = layout_->header;
+        if (header.magic != SHM_RING_MAGIC || header.version != SHM_RING_VERSION || header.element_size != sizeof(T) ||
+            header.element_align != alignof(T) || header.slots != Size) {
+            close();
+            return false;
+        }
+        return attach(role);
+    }
+
+    /**
+     * @brief Detach cleanly (the peer sees CLOSED); the ring itself persists
+     */
+    void close() noexcept {
+        if (layout_ != nullptr && fd_ >= 0) {
+            auto& header = layout_->header;
+            const auto r = static_cast<size_t>(role_);
+            header.pid[r].store(0, std::memory_order_relaxed);
+            header.closed[r].store(1, std::memory_order_release);
+            detail::shm_unlock(fd_, static_cast<off_t>(r));
+        }
+        unmap();
+    }
+
+    /**
+     * @brief Remove a ring's backing file (attached handles keep working)
+     */
+    static bool unlink(const char* name, const ShmChannelOptions& options = ShmChannelOptions{}) noexcept {
+        return detail::shm_unlink(name, options);
+    }
+
+    /**
+     * @brief Try to push a single item into the buffer
+     * @param item Item to push
+     * @return true if successful, false if buffer is full
+     */
+    [[nodiscard]] bool try_push(const T& item) noexcept {
+        const size_t head = head_->load(std::memory_order_relaxed);
+        const size_t next_head = (head + 1) & (Size - 1);
+
+        if (next_head == cached_tail_) {
+            cached_tail_ = tail_->load(std::memory_order_acquire);
+            if (next_head == cached_tail_) {
+                return false;
+            }
+        }
+
+        __builtin_prefetch(&buffer_[next_head], 1, 3);
+        std::memcpy(&buffer_[head], &item, sizeof(T));
+        head_->store(next_head, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Try to pop a single item from the buffer
+     * @param item Reference to store popped item
+     * @return true if successful, false if buffer is empty
+     */
+    [[nodiscard]] bool try_pop(T& item) noexcept {
+        const size_t tail = tail_->load(std::memory_order_relaxed);
+
+        if (tail == cached_head_) {
+            cached_head_ = head_->load(std::memory_order_acquire);
+            if (tail == cached_head_) {
+                return false;
+            }
+        }
+
+        __builtin_prefetch(&buffer_[(tail + 1) & (Size - 1)], 0, 3);
+        std::memcpy(&item, &buffer_[tail], sizeof(T));
+        tail_->store((tail + 1) & (Size - 1), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Try to push multiple items into the buffer
+     * @return Number of items successfully pushed
+     */
+    template<typename Iterator>
+    [[nodiscard]] size_t try_push_batch(Iterator begin, Iterator end) noexcept {
+        const size_t requested = static_cast<size_t>(std::distance(begin, end));
+        const size_t head = head_->load(std::memory_order_relaxed);
+        size_t available = Size - ((head - cached_tail_) & (Size - 1)) - 1;
+        if (available < requested) {
+            cached_tail_ = tail_->load(std::memory_order_acquire);
+            available = Size - ((head - cached_tail_) & (Size - 1)) - 1;
+        }
+        if (available == 0) {
+            return 0;
+        }
+
+        const size_t batch_size = std::min(available, requested);
+        for (size_t i = 0; i < batch_size; ++i) {
+            std::memcpy(&buffer_[(head + i) & (Size - 1)], &(*begin++), sizeof(T));
+        }
+        head_->store((head + batch_size) & (Size - 1), std::memory_order_release);
+        return batch_size;
+    }
+
+    /**
+     * @brief Try to pop multiple items from the buffer
+     * @return Number of items successfully popped
+     */
+    template<typename Iterator>
+    [[nodiscard]] size_t try_pop_batch(Iterator begin, Iterator end) noexcept {
+        const size_t requested = static_cast<size_t>(std::distance(begin, end));
+        const size_t tail = tail_->load(std::memory_order_relaxed);
+        size_t available = (cached_head_ - tail) & (Size - 1);
+        if (available < requested) {
+            cached_head_ = head_->load(std::memory_order_acquire);
+            available = (cached_head_ - tail) & (Size - 1);
+        }
+        if (available == 0) {
+            return 0;
+        }
+
+        const size_t batch_size = std::min(available, requested);
+        for (size_t i = 0; i < batch_size; ++i) {
+            std::memcpy(&(*begin++), &buffer_[(tail + i) & (Size - 1)], sizeof(T));
+        }
+        tail_->store((tail + batch_size) & (Size - 1), std::memory_order_release);
+        return batch_size;
+    }
+
+    /**
+     * @brief Claim contiguous slots for in-place writes (producer only)
+     * @param count Number of slots wanted
+     * @return Writable slots inside the shared mapping (possibly empty)
+     */
+    [[nodiscard]] std::span<T> claim(size_t count = 1) noexcept {
+        const size_t head = head_->load(std::memory_order_relaxed);
+        size_t available = Size - ((head - cached_tail_) & (Size - 1)) - 1;
+        if (available < count) {
+            cached_tail_ = tail_->load(std::memory_order_acquire);
+            available = Size - ((head - cached_tail_) & (Size - 1)) - 1;
+        }
+        const size_t contiguous = std::min({count, available, Size - head});
+        return std::span<T>(buffer_ + head, contiguous);
+    }
+
+    /**
+     * @brief Publish slots filled after claim() (producer only)
+     */
+    void commit(size_t count = 1) noexcept {
+        const size_t head = head_->load(std::memory_order_relaxed);
+        head_->store((head + count) & (Size - 1), std::memory_order_release);
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        const size_t head = head_->load(std::memory_order_acquire);
+        const size_t tail = tail_->load(std::memory_order_acquire);
+        return (head - tail) & (Size - 1);
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return head_->load(std::memory_order_acquire) == tail_->load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool full() const noexcept {
+        const size_t head = head_->load(std::memory_order_acquire);
+        const size_t tail = tail_->load(std::memory_order_acquire);
+        return ((head + 1) & (Size - 1)) == tail;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept {
+        return Size - 1;  // One slot reserved to distinguish empty from full
+    }
+
+    /**
+     * @brief State of the other end (a syscall: housekeeping cadence, not per message)
+     */
+    [[nodiscard]] ShmPeerState peer_state() const noexcept {
+        if (layout_ == nullptr) return ShmPeerState::NEVER_ATTACHED;
+        const auto peer = static_cast<size_t>(role_) ^ 1;
+        if (detail::shm_locked_elsewhere(fd_, static_cast<off_t>(peer))) return ShmPeerState::ATTACHED;
+        const auto& header = layout_->header;
+        if (header.attached[peer].load(std::memory_order_acquire) == 0) return ShmPeerState::NEVER_ATTACHED;
+        return header.closed[peer].load(std::memory_order_acquire) != 0 ? ShmPeerState::CLOSED : ShmPeerState::CRASHED;
+    }
+
+    /** @brief Peer's pid while attached (0 otherwise) */
+    [[nodiscard]] int32_t peer_pid() const noexcept {
+        return layout_ ? layout_->header.pid[static_cast<size_t>(role_) ^ 1].load(std::memory_order_acquire) : 0;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return layout_ != nullptr; }
+    [[nodiscard]] ShmRole role() const noexcept { return role_; }
+    [[nodiscard]] bool huge_pages_active() const noexcept { return huge_pages_active_; }
+    [[nodiscard]] size_t mapped_bytes() const noexcept { return bytes_; }
+
+private:
+    static size_t page_size() noexcept { return static_cast<size_t>(::sysconf(_SC_PAGESIZE)); }
+
+    bool map_new(const std::string& path, size_t granularity, const ShmChannelOptions& options) noexcept {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+        if (fd_ < 0) return false;
+        const size_t bytes = (sizeof(Layout) + granularity - 1) / granularity * granularity;
+        if (::ftruncate(fd_, static_cast<off_t>(bytes)) != 0 || !map(bytes, options)) {
+            unmap();
+            (void)::unlink(path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool map_existing(const std::string& path, const ShmChannelOptions& options) noexcept {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+        if (fd_ < 0) return false;
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Layout) ||
+            !map(static_cast<size_t>(st.st_size), options)) {
+            unmap();
+            return false;
+        }
+        if (layout_->header.ready.load(std::memory_order_acquire) == 0) {
+            unmap();
+            return false;
+        }
+        return true;
+    }
+
+    bool map(size_t bytes, const ShmChannelOptions& options) noexcept {
+        const int flags = MAP_SHARED | (options.prefault ? MAP_POPULATE : 0);
+        void* addr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, fd_, 0);
+        if (addr == MAP_FAILED) return false;
+        layout_ = static_cast<Layout*>(addr);
+        bytes_ = bytes;
+        head_ = &layout_->head;
+        tail_ = &layout_->tail;
+        buffer_ = layout_->buffer;
+        return true;
+    }
+
+    bool attach(ShmRole role) noexcept {
+        const auto r = static_cast<size_t>(role);
+        if (!detail::shm_lock(fd_, static_cast<off_t>(r), false)) {
+            unmap();  // That end is already attached
+            return false;
+        }
+        role_ = role;
+        auto& header = layout_->header;
+        header.pid[r].store(static_cast<int32_t>(::getpid()), std::memory_order_relaxed);
+        header.closed[r].store(0, std::memory_order_relaxed);
+        header.attached[r].store(1, std::memory_order_release);
+        cached_tail_ = tail_->load(std::memory_order_acquire);
+        cached_head_ = head_->load(std::memory_order_acquire);
+        return true;
+    }
+
+    void unmap() noexcept {
+        if (layout_ != nullptr) ::munmap(layout_, bytes_);
+        if (fd_ >= 0) ::close(fd_);
+        layout_ = nullptr;
+        head_ = tail_ = nullptr;
+        buffer_ = nullptr;
+        fd_ = -1;
+        bytes_ = 0;
+        huge_pages_active_ = false;
+    }
+
+    // Shared mapping
+    Layout* layout_;
+    std::atomic<size_t>* head_;
+    std::atomic<size_t>* tail_;
+    T* buffer_;
+
+    // This side's cached copy of the other side's index
+    alignas(HFTTimer::CACHE_LINE_SIZE) size_t cached_tail_;    // Producer
+    alignas(HFTTimer::CACHE_LINE_SIZE) size_t cached_head_;    // Consumer
+
+    int fd_;
+    size_t bytes_;
+    ShmRole role_;
+    bool huge_pages_active_;
+};
+
+// ========================= Channel Registry =========================
+
+/**
+ * @brief Registry entry for one named channel
+ */
+struct ShmChannelInfo {
+    char name[64];
+    uint32_t element_size;
+    uint32_t _pad0;
+    uint64_t slots;
+    int32_t creator_pid;
+    uint32_t _pad1;
+    uint64_t created_ns;
+};
+static_assert(sizeof(ShmChannelInfo) == 96, "ShmChannelInfo must be 96 bytes");
+
+/**
+ * @brief Named directory of shared-memory channels, itself a shared file
+ *
+ * Processes find channels by name instead of being handed ring references:
+ * the creating process registers a channel as it creates it, others look
+ * it up (checking element size and capacity) and attach. Updates are
+ * serialized with a file lock, which dies with its holder.
+ */
+class ShmChannelRegistry {
+public:
+    static constexpr size_t MAX_CHANNELS = 64;
+
+    explicit ShmChannelRegistry(const char* registry_name = "hft_channels",
+                                const ShmChannelOptions& options = ShmChannelOptions{}) noexcept
+        : options_(options), fd_(-1), table_(nullptr) {
+        if (!detail::shm_name_valid(registry_name)) return;
+        path_ = detail::shm_path(options_.directory, registry_name);
+        fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+        if (fd_ < 0) return;
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0 ||
+            (static_cast<size_t>(st.st_size) < sizeof(Table) && ::ftruncate(fd_, sizeof(Table)) != 0)) {
+            ::close(fd_);
+            fd_ = -1;
+            return;
+        }
+        void* addr = ::mmap(nullptr, sizeof(Table), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd_);
+            fd_ = -1;
+            return;
+        }
+        table_ = static_cast<Table*>(addr);
+    }
+
+    ~ShmChannelRegistry() {
+        if (table_ != nullptr) ::munmap(table_, sizeof(Table));
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    ShmChannelRegistry(const ShmChannelRegistry&) = delete;
+    ShmChannelRegistry& operator=(const ShmChannelRegistry&) = delete;
+
+    [[nodiscard]] bool is_open() const noexcept { return table_ != nullptr; }
+
+    /**
+     * @brief Create a ring, attach as `role` and register it under `name`
+     */
+    template<typename T, size_t Size>
+    bool create(const char* name, ShmSPSCRingBuffer<T, Size>& ring, ShmRole role) noexcept {
+        if (table_ == nullptr || !ring.create(name, role, options_)) return false;
+        Guard guard(fd_);
+        ShmChannelInfo* entry = find_entry(name);
+        if (entry == nullptr) entry = find_entry("");
+        if (entry == nullptr) {
+            ring.close();
+            (void)detail::shm_unlink(name, options_);
+            return false;  // Registry full
+        }
+        ShmChannelInfo info{};
+        std::strncpy(info.name, name, sizeof(info.name) - 1);
+        info.element_size = sizeof(T);
+        info.slots = Size;
+        info.creator_pid = static_cast<int32_t>(::getpid());
+        info.created_ns = HFTTimer::get_timestamp_ns();
+        *entry = info;
+        return true;
+    }
+
+    /**
+     * @brief Attach to a registered ring as `role`
+     * @return false if unregistered or registered with another type/capacity
+     */
+    template<typename T, size_t Size>
+    bool open(const char* name, ShmSPSCRingBuffer<T, Size>& ring, ShmRole role) noexcept {
+        ShmChannelInfo info{};
+        if (!find(name, info) || info.element_size != sizeof(T) || info.slots != Size) return false;
+        return ring.open(name, role, options_);
+    }
+
+    /**
+     * @brief Look a channel up by name
+     */
+    bool find(const char* name, ShmChannelInfo& info) const noexcept {
+        if (table_ == nullptr || !detail::shm_name_valid(name)) return false;
+        Guard guard(fd_);
+        const ShmChannelInfo* entry = const_cast<ShmChannelRegistry*>(this)->find_entry(name);
+        if (entry == nullptr) return false;
+        info = *entry;
+        return true;
+    }
+
+    /**
+     * @brief Unregister and delete a channel (attached handles keep working)
+     */
+    bool remove(const char* name) noexcept {
+        if (table_ == nullptr || !detail::shm_name_valid(name)) return false;
+        Guard guard(fd_);
+        ShmChannelInfo* entry = find_entry(name);
+        if (entry == nullptr) return false;
+        *entry = ShmChannelInfo{};
+        (void)detail::shm_unlink(name, options_);
+        return true;
+    }
+
+    /**
+     * @brief Every registered channel
+     */
+    [[nodiscard]] std::vector<ShmChannelInfo> channels() const {
+        std::vector<ShmChannelInfo> result;
+        if (table_ == nullptr) return result;
+        Guard guard(fd_);
+        for (const auto& entry : table_->entries) {
+            if (entry.name[0] != '\0') result.push_back(entry);
+        }
+        return result;
+    }
+
+private:
+    struct Table {
+        ShmChannelInfo entries[MAX_CHANNELS];
+    };
+
+    struct Guard {
+        explicit Guard(int fd) noexcept : fd_(fd) { (void)detail::shm_lock(fd_, 0, true); }
+        ~Guard() { detail::shm_unlock(fd_, 0); }
+        int fd_;
+    };
+
+    ShmChannelInfo* find_entry(const char* name) noexcept {
+        for (auto& entry : table_->entries) {
+            if (std::strncmp(entry.name, name, sizeof(entry.name)) == 0) return &entry;
+        }
+        return nullptr;
+    }
+
+    ShmChannelOptions options_;
+    std::string path_;
+    int fd_;
+    Table* table_;
+};
+
+} // namespace hft
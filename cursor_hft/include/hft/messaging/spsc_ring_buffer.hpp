@@ -6,7 +6,11 @@
 #include <type_traits>
 #include <array>
 #include <memory>
+#include <span>
+#include <algorithm>
+#if defined(__ARM_NEON)
 #include <arm_neon.h>
+#endif
 #include "../timing/hft_timer.hpp"
 
 namespace hft {
@@ -20,6 +24,9 @@ namespace hft {
  * - ARM64 optimized memory operations
  * - Power-of-2 capacity for efficient masking
  * - Batch operations with prefetching
+ * - Producer and consumer each cache the other side's index and only
+ *   reload it (acquire) when the cached copy reports full/empty
+ * - Zero-copy claim()/commit() for writing messages in place
  * - Integration with HFTTimer for latency tracking
  * 
  * @tparam T Message type (must be trivially copyable)
@@ -37,7 +44,7 @@ public:
     using timestamp_t = HFTTimer::timestamp_t;
 
     // Constructor
-    SPSCRingBuffer() noexcept : head_(0), tail_(0) {
+    SPSCRingBuffer() noexcept : head_(0), cached_tail_(0), tail_(0), cached_head_(0) {
         // Prefetch the entire buffer to warm cache
         for (size_t i = 0; i < Size; i += HFTTimer::CACHE_LINE_SIZE) {
             __builtin_prefetch(&buffer_[i], 1, 3);
@@ -57,8 +64,11 @@ public:
         const size_t head = head_.load(std::memory_order_relaxed);
         const size_t next_head = (head + 1) & (Size - 1);
         
-        if (next_head == tail_.load(std::memory_order_acquire)) {
-            return false;
+        if (next_head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (next_head == cached_tail_) {
+                return false;
+            }
         }
 
         // Prefetch the next write location
@@ -80,8 +90,11 @@ public:
     [[nodiscard]] bool try_pop(T& item) noexcept {
         const size_t tail = tail_.load(std::memory_order_relaxed);
         
-        if (tail == head_.load(std::memory_order_acquire)) {
-            return false;
+        if (tail == cached_head_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail == cached_head_) {
+                return false;
+            }
         }
 
         // Prefetch the next read location
@@ -103,16 +116,19 @@ public:
      */
     template<typename Iterator>
     [[nodiscard]] size_t try_push_batch(Iterator begin, Iterator end) noexcept {
-        size_t count = 0;
+        const size_t requested = static_cast<size_t>(std::distance(begin, end));
         const size_t head = head_.load(std::memory_order_relaxed);
-        const size_t tail = tail_.load(std::memory_order_acquire);
-        const size_t available = Size - ((head - tail) & (Size - 1)) - 1;
+        size_t available = Size - ((head - cached_tail_) & (Size - 1)) - 1;
+        if (available < requested) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            available = Size - ((head - cached_tail_) & (Size - 1)) - 1;
+        }
         
         if (available == 0) {
             return 0;
         }
 
-        const size_t batch_size = std::min(available, static_cast<size_t>(std::distance(begin, end)));
+        const size_t batch_size = std::min(available, requested);
         
         // Prefetch the entire batch
         for (size_t i = 0; i < batch_size; i += HFTTimer::CACHE_LINE_SIZE) {
@@ -137,15 +153,19 @@ public:
      */
     template<typename Iterator>
     [[nodiscard]] size_t try_pop_batch(Iterator begin, Iterator end) noexcept {
-        const size_t head = head_.load(std::memory_order_acquire);
+        const size_t requested = static_cast<size_t>(std::distance(begin, end));
         const size_t tail = tail_.load(std::memory_order_relaxed);
-        const size_t available = (head - tail) & (Size - 1);
+        size_t available = (cached_head_ - tail) & (Size - 1);
+        if (available < requested) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            available = (cached_head_ - tail) & (Size - 1);
+        }
         
         if (available == 0) {
             return 0;
         }
 
-        const size_t batch_size = std::min(available, static_cast<size_t>(std::distance(begin, end)));
+        const size_t batch_size = std::min(available, requested);
         
         // Prefetch the entire batch
         for (size_t i = 0; i < batch_size; i += HFTTimer::CACHE_LINE_SIZE) {
@@ -162,6 +182,37 @@ public:
         return batch_size;
     }
 
+    /**
+     * @brief Claim contiguous slots for in-place writes (producer only)
+     * 
+     * Returns up to `count` writable slots starting at the current head.
+     * The span may be shorter than requested when the buffer is nearly
+     * full or the claim would cross the end of storage, and is empty when
+     * no slot is free. Nothing is visible to the consumer until commit().
+     * 
+     * @param count Number of slots wanted
+     * @return Writable slots inside buffer_ (possibly empty)
+     */
+    [[nodiscard]] std::span<T> claim(size_t count = 1) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        size_t available = Size - ((head - cached_tail_) & (Size - 1)) - 1;
+        if (available < count) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            available = Size - ((head - cached_tail_) & (Size - 1)) - 1;
+        }
+        const size_t contiguous = std::min({count, available, Size - head});
+        return std::span<T>(buffer_.data() + head, contiguous);
+    }
+
+    /**
+     * @brief Publish slots filled after claim() (producer only)
+     * @param count Number of slots to publish, at most the size of the last claim
+     */
+    void commit(size_t count = 1) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        head_.store((head + count) & (Size - 1), std::memory_order_release);
+    }
+
     /**
      * @brief Get current size of the buffer
      * @return Number of items in the buffer
@@ -203,11 +254,13 @@ private:
     // Cache-aligned buffer storage
     alignas(HFTTimer::CACHE_LINE_SIZE) std::array<T, Size> buffer_;
     
-    // Producer position (head)
+    // Producer position (head) and producer's cached copy of tail
     alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<size_t> head_;
+    size_t cached_tail_;
     
-    // Consumer position (tail)
+    // Consumer position (tail) and consumer's cached copy of head
     alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<size_t> tail_;
+    size_t cached_head_;
 };
 
 } // namespace hft 
\ No newline at end of file
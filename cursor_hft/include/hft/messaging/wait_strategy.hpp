@@ -0,0 +1,175 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "../timing/hft_timer.hpp"
+
+namespace hft {
+
+/**
+ * @brief CPU hint for spin loops (lets the sibling hyperthread or the
+ *        memory system make progress; does not give up the core)
+ */
+inline void cpu_relax() noexcept {
+#if defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief Wait strategies for ring buffer consumers
+ *
+ * Each strategy exposes:
+ * - wait(ready): block until ready() returns true
+ * - notify(): called by the producer after publishing
+ *
+ * Strategy selection per queue:
+ * - SpinWait: hot paths (market data, orders); lowest latency, owns a core
+ * - SpinYieldWait: medium-rate queues; spins with cpu_relax, then yields
+ *   the core to the scheduler between polls
+ * - ParkingWait: cold queues (monitoring, audit); spins briefly, then
+ *   parks on a futex (std::atomic::wait). The producer only pays for a
+ *   wake syscall while a consumer is actually parked.
+ *
+ * Use with the helpers below, which work with any ring exposing
+ * try_push/try_pop (SPSCRingBuffer, MPSCRingBuffer).
+ */
+struct SpinWait {
+    template<typename Ready>
+    void wait(Ready&& ready) noexcept {
+        while (!ready()) {
+            cpu_relax();
+        }
+    }
+
+    void notify() noexcept {}
+    void notify_all() noexcept {}
+};
+
+template<uint32_t SpinIterations = 256>
+struct SpinYieldWait {
+    template<typename Ready>
+    void wait(Ready&& ready) noexcept {
+        for (uint32_t i = 0; i < SpinIterations; ++i) {
+            if (ready()) {
+                return;
+            }
+            cpu_relax();
+        }
+        while (!ready()) {
+            std::this_thread::yield();
+        }
+    }
+
+    void notify() noexcept {}
+    void notify_all() noexcept {}
+};
+
+template<uint32_t SpinIterations = 1024>
+class alignas(HFTTimer::CACHE_LINE_SIZE) ParkingWait {
+public:
+    ParkingWait() noexcept : epoch_(0), parked_(0) {}
+
+    ParkingWait(const ParkingWait&) = delete;
+    ParkingWait& operator=(const ParkingWait&) = delete;
+
+    template<typename Ready>
+    void wait(Ready&& ready) noexcept {
+        for (uint32_t i = 0; i < SpinIterations; ++i) {
+            if (ready()) {
+                return;
+            }
+            cpu_relax();
+        }
+
+        while (true) {
+            // Read the epoch before announcing: a notify after this point
+            // bumps it and makes epoch_.wait() return immediately
+            const uint32_t epoch = epoch_.load(std::memory_order_acquire);
+            parked_.fetch_add(1, std::memory_order_seq_cst);
+            if (ready()) {
+                parked_.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+            epoch_.wait(epoch, std::memory_order_acquire);
+            parked_.fetch_sub(1, std::memory_order_relaxed);
+            if (ready()) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Wake a parked consumer; a load and branch when none is parked
+     */
+    void notify() noexcept {
+        // Orders the producer's publish before the parked_ check
+        // (pairs with the seq_cst increment in wait())
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (__builtin_expect(parked_.load(std::memory_order_relaxed) != 0, 0)) {
+            epoch_.fetch_add(1, std::memory_order_release);
+            epoch_.notify_one();
+        }
+    }
+
+    void notify_all() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        epoch_.fetch_add(1, std::memory_order_release);
+        epoch_.notify_all();
+    }
+
+    [[nodiscard]] uint32_t parked_consumers() const noexcept {
+        return parked_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint32_t> epoch_;
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<uint32_t> parked_;
+};
+
+/**
+ * @brief Producer side: push then notify the consumer's wait strategy
+ * @return false if the ring is full (nothing is notified)
+ */
+template<typename Ring, typename Wait, typename T>
+[[nodiscard]] bool push_and_notify(Ring& ring, Wait& wait, const T& item) noexcept {
+    if (!ring.try_push(item)) {
+        return false;
+    }
+    wait.notify();
+    return true;
+}
+
+/**
+ * @brief Consumer side: pop, waiting with the strategy until an item arrives
+ */
+template<typename Ring, typename Wait, typename T>
+void pop_wait(Ring& ring, Wait& wait, T& item) noexcept {
+    if (ring.try_pop(item)) {
+        return;
+    }
+    wait.wait([&]() noexcept { return ring.try_pop(item); });
+}
+
+/**
+ * @brief Consumer side with shutdown: returns false once stop is set
+ *        (the producer sets stop, then calls wait.notify_all())
+ */
+template<typename Ring, typename Wait, typename T>
+[[nodiscard]] bool pop_wait(Ring& ring, Wait& wait, T& item, const std::atomic<bool>& stop) noexcept {
+    bool popped = ring.try_pop(item);
+    if (!popped) {
+        wait.wait([&]() noexcept {
+            popped = ring.try_pop(item);
+            return popped || stop.load(std::memory_order_acquire);
+        });
+    }
+    return popped;
+}
+
+} // namespace hft
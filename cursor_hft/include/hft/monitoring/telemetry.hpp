@@ -0,0 +1,997 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "hft/monitoring/production_monitoring_system.hpp"
+#include "hft/messaging/shm_ring_buffer.hpp"
+#include "hft/timing/hdr_histogram.hpp"
+
+namespace hft {
+namespace monitoring {
+
+// ========================= 1. Shared Region Layout =========================
+
+constexpr uint64_t TELEMETRY_MAGIC = 0x31594d4c45544648ULL;   // "HFTELMY1"
+constexpr uint32_t TELEMETRY_VERSION = 1;
+constexpr size_t TELEMETRY_MAX_COMPONENTS = ProductionMonitoringSystem::MAX_COMPONENTS;
+constexpr size_t TELEMETRY_MAX_METRICS = 256;
+constexpr size_t TELEMETRY_MAX_ALERTS = 64;
+constexpr size_t TELEMETRY_MAX_HISTOGRAMS = 8;
+constexpr size_t TELEMETRY_HISTOGRAM_BUCKETS = 41;   // Bucket k: values <= 2^k - 1 ns, k = 0..40
+
+/**
+ * @brief Where telemetry regions live and how often they are refreshed
+ */
+struct TelemetryOptions {
+    const char* directory = "/dev/shm";
+    uint64_t publish_interval_ns = 1000000;             // start(): publisher cadence (1ms)
+};
+
+struct alignas(64) TelemetryComponent {
+    uint64_t component_id = 0;                          // Component identifier (8 bytes)
+    uint64_t last_heartbeat_ns = 0;                     // Last heartbeat timestamp (8 bytes)
+    uint64_t total_operations = 0;                      // Heartbeats seen (8 bytes)
+    double cpu_usage_percent = 0.0;                     // CPU usage percentage (8 bytes)
+    double memory_usage_mb = 0.0;                       // Memory usage in MB (8 bytes)
+    char name[16] = {};                                 // Component name (16 bytes)
+    ProductionMonitoringSystem::ComponentType type = ProductionMonitoringSystem::ComponentType::CUSTOM;
+    ProductionMonitoringSystem::ComponentHealth health = ProductionMonitoringSystem::ComponentHealth::UNKNOWN;
+    uint8_t _pad0[6] = {};                              // Padding (6 bytes)
+    // Total: 8+8+8+8+8+16+1+1+6 = 64 bytes
+};
+static_assert(sizeof(TelemetryComponent) == 64, "TelemetryComponent must be 64 bytes");
+
+struct alignas(64) TelemetryMetric {
+    uint64_t component_id = 0;                          // Component identifier (8 bytes)
+    uint64_t timestamp_ns = 0;                          // Latest sample time (8 bytes)
+    double value = 0.0;                                 // Latest value (8 bytes)
+    double min_value = 0.0;                             // Window minimum (8 bytes)
+    double max_value = 0.0;                             // Window maximum (8 bytes)
+    double avg_value = 0.0;                             // Moving average (8 bytes)
+    uint32_t sample_count = 0;                          // Samples applied (4 bytes)
+    uint32_t metric_id = 0;                             // Metric identifier (4 bytes)
+    ProductionMonitoringSystem::MetricType type = ProductionMonitoringSystem::MetricType::LATENCY;
+    uint8_t _pad0[7] = {};                              // Padding (7 bytes)
+    // Total: 8+8+8+8+8+8+4+4+1+7 = 64 bytes
+};
+static_assert(sizeof(TelemetryMetric) == 64, "TelemetryMetric must be 64 bytes");
+
+struct alignas(64) TelemetryAlert {
+    uint64_t alert_id = 0;                              // Alert identifier (8 bytes)
+    uint64_t component_id = 0;                          // Related component (8 bytes)
+    uint64_t metric_id = 0;                             // Related metric (8 bytes)
+    uint64_t trigger_time_ns = 0;                       // Trigger time (8 bytes)
+    double threshold_value = 0.0;                       // Threshold crossed (8 bytes)
+    double current_value = 0.0;                         // Value at trigger (8 bytes)
+    uint32_t trigger_count = 0;                         // Triggers (4 bytes)
+    ProductionMonitoringSystem::AlertSeverity severity = ProductionMonitoringSystem::AlertSeverity::INFO;
+    bool acknowledged = false;                          // Operator acknowledged (1 byte)
+    uint8_t _pad0[10] = {};                             // Padding (10 bytes)
+    // Total: 8*6+4+1+1+10 = 64 bytes
+};
+static_assert(sizeof(TelemetryAlert) == 64, "TelemetryAlert must be 64 bytes");
+
+/**
+ * @brief One latency histogram: lifetime power-of-two buckets plus the
+ *        delta since the previous publish
+ */
+struct alignas(64) TelemetryHistogram {
+    char name[32] = {};
+    uint64_t total_samples = 0;
+    uint64_t min_ns = 0;
+    uint64_t max_ns = 0;
+    double sum_ns = 0.0;
+    uint64_t interval_samples = 0;                      // Samples since the previous publish
+    uint64_t interval_p50_ns = 0;
+    uint64_t interval_p90_ns = 0;
+    uint64_t interval_p99_ns = 0;
+    uint64_t interval_p999_ns = 0;
+    uint64_t interval_max_ns = 0;                       // Upper bound of the highest bucket hit
+    std::array<uint64_t, TELEMETRY_HISTOGRAM_BUCKETS> buckets{};           // Lifetime, not cumulative
+    std::array<uint64_t, TELEMETRY_HISTOGRAM_BUCKETS> interval_buckets{};  // Since the previous publish
+};
+
+/**
+ * @brief Everything one publish writes, copied whole under the seqlock
+ */
+struct alignas(64) TelemetryFrame {
+    uint64_t sequence = 0;                              // Publish count, 0 = never published
+    uint64_t publish_time_ns = 0;
+    uint64_t interval_ns = 0;                           // Since the previous publish
+    uint32_t component_count = 0;
+    uint32_t metric_count = 0;
+    uint32_t alert_count = 0;
+    uint32_t histogram_count = 0;
+    uint32_t metrics_truncated = 0;                     // Metrics beyond TELEMETRY_MAX_METRICS
+    uint32_t alerts_truncated = 0;
+    ProductionMonitoringSystem::DashboardSnapshot dashboard;
+    std::array<TelemetryComponent, TELEMETRY_MAX_COMPONENTS> components;
+    std::array<TelemetryMetric, TELEMETRY_MAX_METRICS> metrics;
+    std::array<TelemetryAlert, TELEMETRY_MAX_ALERTS> alerts;
+    std::array<TelemetryHistogram, TELEMETRY_MAX_HISTOGRAMS> histograms;
+};
+static_assert(std::is_trivially_copyable_v<TelemetryFrame>, "TelemetryFrame is copied with memcpy");
+
+namespace detail {
+
+struct alignas(64) TelemetryRegionHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t frame_size;
+    int32_t publisher_pid;
+    std::atomic<uint32_t> ready;
+};
+
+// Odd sequence: a publish is in progress
+struct TelemetryRegion {
+    TelemetryRegionHeader header;
+    alignas(64) std::atomic<uint64_t> sequence;
+    alignas(64) TelemetryFrame frame;
+};
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Seqlock counter must be lock-free to live in shared memory");
+
+// Lifetime bucket for an HDR bucket: bit width of its highest value
+template<typename Histogram>
+inline size_t telemetry_bucket_of(size_t hdr_index) noexcept {
+    const uint64_t highest = Histogram::highest_equivalent(hdr_index);
+    const size_t bucket = highest == 0 ? 0 : 64 - static_cast<size_t>(__builtin_clzll(highest));
+    return std::min(bucket, TELEMETRY_HISTOGRAM_BUCKETS - 1);
+}
+
+inline void copy_name(char* out, size_t size, const char* name) noexcept {
+    std::strncpy(out, name ? name : "", size - 1);
+    out[size - 1] = '\0';
+}
+
+} // namespace detail
+
+// ========================= 2. Publisher =========================
+
+/**
+ * @brief Writes monitoring state into a shared-memory seqlock region
+ *
+ * publish() collects the dashboard snapshot, component statuses, latest
+ * metric statistics, active alerts and registered latency histograms
+ * into a private frame, then copies it into the region between two bumps
+ * of the seqlock counter. Readers in other processes never take a lock
+ * and never touch the trading threads; a reader that overlaps a publish
+ * simply retries. publish() reads statistics and alerts the monitoring
+ * aggregator writes, so it runs on the aggregator's thread: start() runs
+ * the aggregator with publish() attached at publish_interval_ns, or call
+ * it from the loop that calls aggregate_metrics().
+ */
+class TelemetryPublisher {
+public:
+    using Histogram = HdrHistogram<>;
+    using Snapshot = HdrSnapshot<>;
+
+    explicit TelemetryPublisher(ProductionMonitoringSystem& monitoring) noexcept
+        : monitoring_(monitoring), region_(nullptr), fd_(-1), running_(false), publishes_(0),
+          last_publish_ns_(0), interval_ns_(TelemetryOptions{}.publish_interval_ns) {}
+    ~TelemetryPublisher() { close(); }
+
+    TelemetryPublisher(const TelemetryPublisher&) = delete;
+    TelemetryPublisher& operator=(const TelemetryPublisher&) = delete;
+
+    /**
+     * @brief Create (or replace) the named region
+     */
+    bool create(const char* name, const TelemetryOptions& options = {}) noexcept {
+        close();
+        if (!hft::detail::shm_name_valid(name)) return false;
+        const std::string path = hft::detail::shm_path(options.directory, name);
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd_ < 0) return false;
+        if (::ftruncate(fd_, sizeof(detail::TelemetryRegion)) != 0) {
+            close();
+            return false;
+        }
+        void* mapping = ::mmap(nullptr, sizeof(detail::TelemetryRegion), PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_POPULATE, fd_, 0);
+        if (mapping == MAP_FAILED) {
+            close();
+            return false;
+        }
+        region_ = static_cast<detail::TelemetryRegion*>(mapping);
+        region_->header.magic = TELEMETRY_MAGIC;
+        region_->header.version = TELEMETRY_VERSION;
+        region_->header.frame_size = sizeof(TelemetryFrame);
+        region_->header.publisher_pid = static_cast<int32_t>(::getpid());
+        region_->sequence.store(0, std::memory_order_relaxed);
+        region_->header.ready.store(1, std::memory_order_release);
+        interval_ns_ = options.publish_interval_ns;
+        if (!staging_) staging_ = std::make_unique<TelemetryFrame>();
+        return true;
+    }
+
+    /**
+     * @brief Publish a single-writer histogram (register before start())
+     */
+    bool add_histogram(const char* name, const Histogram& histogram) {
+        return add_source(name, &histogram, [](const void* source, Snapshot& out) {
+            out.clear();
+            static_cast<const Histogram*>(source)->snapshot_into(out);
+        });
+    }
+
+    /**
+     * @brief Publish a sharded multi-writer histogram (register before start())
+     */
+    template<size_t MaxShards>
+    bool add_histogram(const char* name, const ShardedLatencyHistogram<MaxShards>& histogram) {
+        return add_source(name, &histogram, [](const void* source, Snapshot& out) {
+            static_cast<const ShardedLatencyHistogram<MaxShards>*>(source)->snapshot(out);
+        });
+    }
+
+    /**
+     * @brief Collect and publish one frame
+     */
+    void publish() noexcept {
+        if (region_ == nullptr) return;
+        TelemetryFrame& frame = *staging_;
+        collect(frame);
+
+        // Seqlock write: odd while the copy is in flight
+        const uint64_t sequence = region_->sequence.load(std::memory_order_relaxed);
+        region_->sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(static_cast<void*>(&region_->frame), &frame, sizeof(TelemetryFrame));
+        region_->sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Start the monitoring aggregator, publishing every publish_interval_ns from its thread
+     * @return false if not open or the aggregator is already running (use publish() from its loop)
+     */
+    bool start(uint64_t aggregator_poll_ns = 100000) noexcept {
+        if (region_ == nullptr || running_.load(std::memory_order_relaxed)) return false;
+        if (!monitoring_.set_aggregator_task(&publish_task, this, interval_ns_)) return false;
+        if (!monitoring_.start_aggregator(aggregator_poll_ns)) {
+            (void)monitoring_.set_aggregator_task(nullptr, nullptr, 0);
+            return false;
+        }
+        running_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Stop the aggregator after a final drain and publish
+     */
+    void stop() noexcept {
+        if (!running_.exchange(false, std::memory_order_acq_rel)) return;
+        monitoring_.stop_aggregator();
+        (void)monitoring_.set_aggregator_task(nullptr, nullptr, 0);
+    }
+
+    /**
+     * @brief Stop publishing and unmap (the region stays for late readers)
+     */
+    void close() noexcept {
+        stop();
+        if (region_ != nullptr) ::munmap(region_, sizeof(detail::TelemetryRegion));
+        region_ = nullptr;
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = -1;
+    }
+
+    static bool unlink(const char* name, const TelemetryOptions& options = {}) noexcept {
+        return hft::detail::shm_name_valid(name) &&
+               ::unlink(hft::detail::shm_path(options.directory, name).c_str()) == 0;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return region_ != nullptr; }
+    [[nodiscard]] bool running() const noexcept { return running_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t publishes() const noexcept { return publishes_; }
+
+private:
+    struct HistogramSource {
+        char name[32];
+        const void* source;
+        void (*snapshot)(const void*, Snapshot&);
+        std::unique_ptr<Snapshot> previous;
+        std::unique_ptr<Snapshot> current;
+    };
+
+    static void publish_task(void* publisher) noexcept {
+        static_cast<TelemetryPublisher*>(publisher)->publish();
+    }
+
+    bool add_source(const char* name, const void* source, void (*snapshot)(const void*, Snapshot&)) {
+        if (running() || histograms_.size() >= TELEMETRY_MAX_HISTOGRAMS) return false;
+        HistogramSource entry{};
+        detail::copy_name(entry.name, sizeof(entry.name), name);
+        entry.source = source;
+        entry.snapshot = snapshot;
+        entry.previous = std::make_unique<Snapshot>();
+        entry.current = std::make_unique<Snapshot>();
+        histograms_.push_back(std::move(entry));
+        return true;
+    }
+
+    void collect(TelemetryFrame& frame) noexcept {
+        const uint64_t now = HFTTimer::get_timestamp_ns();
+        frame.sequence = ++publishes_;
+        frame.publish_time_ns = now;
+        frame.interval_ns = last_publish_ns_ != 0 ? now - last_publish_ns_ : 0;
+        last_publish_ns_ = now;
+        frame.dashboard = monitoring_.generate_dashboard_snapshot();
+
+        frame.component_count = 0;
+        monitoring_.for_each_component([&](const ProductionMonitoringSystem::ComponentStatus& status) {
+            if (frame.component_count >= TELEMETRY_MAX_COMPONENTS) return;
+            auto& out = frame.components[frame.component_count++];
+            out.component_id = status.component_id;
+            out.last_heartbeat_ns = status.last_heartbeat_ns;
+            out.total_operations = status.total_operations;
+            out.cpu_usage_percent = status.cpu_usage_percent;
+            out.memory_usage_mb = status.memory_usage_mb;
+            detail::copy_name(out.name, sizeof(out.name), status.component_name);
+            out.type = status.type;
+            out.health = status.health;
+        });
+
+        frame.metric_count = 0;
+        frame.metrics_truncated = 0;
+        monitoring_.for_each_latest_metric([&](const ProductionMonitoringSystem::MetricSample& sample) {
+            if (frame.metric_count >= TELEMETRY_MAX_METRICS) {
+                ++frame.metrics_truncated;
+                return;
+            }
+            auto& out = frame.metrics[frame.metric_count++];
+            out.component_id = sample.component_id;
+            out.timestamp_ns = sample.timestamp_ns;
+            out.value = sample.value;
+            out.min_value = sample.min_value;
+            out.max_value = sample.max_value;
+            out.avg_value = sample.avg_value;
+            out.sample_count = sample.sample_count;
+            out.metric_id = sample.metric_id;
+            out.type = sample.type;
+        });
+
+        frame.alert_count = 0;
+        frame.alerts_truncated = 0;
+        monitoring_.for_each_active_alert([&](const ProductionMonitoringSystem::Alert& alert) {
+            if (frame.alert_count >= TELEMETRY_MAX_ALERTS) {
+                ++frame.alerts_truncated;
+                return;
+            }
+            auto& out = frame.alerts[frame.alert_count++];
+            out.alert_id = alert.alert_id;
+            out.component_id = alert.component_id;
+            out.metric_id = alert.metric_id;
+            out.trigger_time_ns = alert.trigger_time_ns;
+            out.threshold_value = alert.threshold_value;
+            out.current_value = alert.current_value;
+            out.trigger_count = alert.trigger_count;
+            out.severity = alert.severity;
+            out.acknowledged = alert.acknowledged;
+        });
+
+        frame.histogram_count = static_cast<uint32_t>(histograms_.size());
+        for (size_t h = 0; h < histograms_.size(); ++h) {
+            collect_histogram(histograms_[h], frame.histograms[h]);
+        }
+    }
+
+    void collect_histogram(HistogramSource& source, TelemetryHistogram& out) noexcept {
+        source.snapshot(source.source, *source.current);
+        const Snapshot& current = *source.current;
+        const Snapshot& previous = *source.previous;
+
+        std::memcpy(out.name, source.name, sizeof(out.name));
+        out.total_samples = current.total_samples();
+        out.min_ns = current.min_latency();
+        out.max_ns = current.max_latency();
+        out.sum_ns = current.mean_latency() * static_cast<double>(current.total_samples());
+        out.buckets.fill(0);
+        out.interval_buckets.fill(0);
+
+        // Interval percentiles straight from the per-bucket deltas
+        const uint64_t interval = current.total_samples() >= previous.total_samples()
+                                      ? current.total_samples() - previous.total_samples() : 0;
+        const std::array<uint64_t, 4> targets = {
+            std::max<uint64_t>(1, (interval * 50 + 99) / 100), std::max<uint64_t>(1, (interval * 90 + 99) / 100),
+            std::max<uint64_t>(1, (interval * 99 + 99) / 100), std::max<uint64_t>(1, (interval * 999 + 999) / 1000)};
+        std::array<uint64_t, 4> values{};
+        size_t next_target = 0;
+        uint64_t cumulative = 0;
+        uint64_t interval_max = 0;
+        for (size_t i = 0; i < Histogram::BUCKET_COUNT; ++i) {
+            const uint64_t now_count = current.count_at_index(i);
+            if (now_count == 0) continue;
+            const size_t bucket = detail::telemetry_bucket_of<Histogram>(i);
+            out.buckets[bucket] += now_count;
+            const uint64_t before = previous.count_at_index(i);
+            const uint64_t delta = now_count > before ? now_count - before : 0;
+            if (delta == 0) continue;
+            out.interval_buckets[bucket] += delta;
+            cumulative += delta;
+            interval_max = Histogram::highest_equivalent(i);
+            while (next_target < targets.size() && cumulative >= targets[next_target]) {
+                values[next_target++] = interval_max;
+            }
+        }
+        out.interval_samples = interval;
+        out.interval_p50_ns = values[0];
+        out.interval_p90_ns = values[1];
+        out.interval_p99_ns = values[2];
+        out.interval_p999_ns = values[3];
+        out.interval_max_ns = interval_max;
+        std::swap(source.previous, source.current);
+    }
+
+    ProductionMonitoringSystem& monitoring_;
+    detail::TelemetryRegion* region_;
+    int fd_;
+    std::unique_ptr<TelemetryFrame> staging_;
+    std::vector<HistogramSource> histograms_;
+    std::atomic<bool> running_;
+    uint64_t publishes_;
+    uint64_t last_publish_ns_;
+    uint64_t interval_ns_;
+};
+
+// ========================= 3. Reader =========================
+
+/**
+ * @brief Read-only view of a telemetry region, for any process
+ */
+class TelemetryReader {
+public:
+    TelemetryReader() noexcept : region_(nullptr), fd_(-1) {}
+    ~TelemetryReader() { close(); }
+
+    TelemetryReader(const TelemetryReader&) = delete;
+    TelemetryReader& operator=(const TelemetryReader&) = delete;
+
+    bool open(const char* name, const TelemetryOptions& options = {}) noexcept {
+        close();
+        if (!hft::detail::shm_name_valid(name)) return false;
+        const std::string path = hft::detail::shm_path(options.directory, name);
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0) return false;
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(detail::TelemetryRegion)) {
+            close();
+            return false;
+        }
+        void* mapping = ::mmap(nullptr, sizeof(detail::TelemetryRegion), PROT_READ, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED) {
+            close();
+            return false;
+        }
+        region_ = static_cast<const detail::TelemetryRegion*>(mapping);
+        const auto& header = region_->header;
+        if (header.ready.load(std::memory_order_acquire) != 1 || header.magic != TELEMETRY_MAGIC ||
+            header.version != TELEMETRY_VERSION || header.frame_size != sizeof(TelemetryFrame)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() noexcept {
+        if (region_ != nullptr) ::munmap(const_cast<detail::TelemetryRegion*>(region_), sizeof(detail::TelemetryRegion));
+        region_ = nullptr;
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = -1;
+    }
+
+    /**
+     * @brief Copy the latest complete frame
+     * @return false if nothing was published yet or every attempt overlapped a publish
+     */
+    bool read(TelemetryFrame& out, uint32_t max_attempts = 64) const noexcept {
+        if (region_ == nullptr) return false;
+        for (uint32_t attempt = 0; attempt < max_attempts; ++attempt) {
+            const uint64_t before = region_->sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (before == 0) return false;
+            std::memcpy(static_cast<void*>(&out), &region_->frame, sizeof(TelemetryFrame));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (region_->sequence.load(std::memory_order_relaxed) == before) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Seqlock counter; changes on every publish
+     */
+    [[nodiscard]] uint64_t version() const noexcept {
+        return region_ ? region_->sequence.load(std::memory_order_acquire) : 0;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return region_ != nullptr; }
+    [[nodiscard]] int32_t publisher_pid() const noexcept { return region_ ? region_->header.publisher_pid : 0; }
+
+private:
+    const detail::TelemetryRegion* region_;
+    int fd_;
+};
+
+// ========================= 4. OpenMetrics Text =========================
+
+namespace detail {
+
+inline const char* health_label(ProductionMonitoringSystem::ComponentHealth health) noexcept {
+    switch (health) {
+        case ProductionMonitoringSystem::ComponentHealth::HEALTHY: return "healthy";
+        case ProductionMonitoringSystem::ComponentHealth::DEGRADED: return "degraded";
+        case ProductionMonitoringSystem::ComponentHealth::UNHEALTHY: return "unhealthy";
+        case ProductionMonitoringSystem::ComponentHealth::FAILED: return "failed";
+        default: return "unknown";
+    }
+}
+
+inline const char* metric_type_label(ProductionMonitoringSystem::MetricType type) noexcept {
+    switch (type) {
+        case ProductionMonitoringSystem::MetricType::LATENCY: return "latency";
+        case ProductionMonitoringSystem::MetricType::THROUGHPUT: return "throughput";
+        case ProductionMonitoringSystem::MetricType::COUNT: return "count";
+        case ProductionMonitoringSystem::MetricType::PERCENTAGE: return "percentage";
+        case ProductionMonitoringSystem::MetricType::MEMORY: return "memory";
+        default: return "ratio";
+    }
+}
+
+inline const char* severity_label(ProductionMonitoringSystem::AlertSeverity severity) noexcept {
+    switch (severity) {
+        case ProductionMonitoringSystem::AlertSeverity::WARNING: return "warning";
+        case ProductionMonitoringSystem::AlertSeverity::CRITICAL: return "critical";
+        case ProductionMonitoringSystem::AlertSeverity::EMERGENCY: return "emergency";
+        default: return "info";
+    }
+}
+
+// Label values are internal names; escape the three characters OpenMetrics reserves
+inline void append_label_value(std::string& out, const char* value) {
+    for (; *value; ++value) {
+        if (*value == '\\' || *value == '"') out += '\\';
+        if (*value == '\n') {
+            out += "\\n";
+            continue;
+        }
+        out += *value;
+    }
+}
+
+template<typename... Args>
+inline void appendf(std::string& out, const char* format, Args... args) {
+    char line[256];
+    const int length = std::snprintf(line, sizeof(line), format, args...);
+    if (length > 0) out.append(line, std::min<size_t>(static_cast<size_t>(length), sizeof(line) - 1));
+}
+
+inline const char* component_name(const TelemetryFrame& frame, uint64_t component_id) noexcept {
+    for (uint32_t i = 0; i < frame.component_count; ++i) {
+        if (frame.components[i].component_id == component_id) return frame.components[i].name;
+    }
+    return "";
+}
+
+} // namespace detail
+
+/**
+ * @brief Render a frame in the OpenMetrics text format (replaces `out`)
+ *
+ * Component and metric values become gauges labelled by component name
+ * and id, histograms become `hft_latency_ns` with power-of-two `le`
+ * buckets.
+ */
+inline void write_openmetrics(const TelemetryFrame& frame, std::string& out) {
+    out.clear();
+    const auto& d = frame.dashboard;
+    using detail::appendf;
+
+    appendf(out, "# TYPE hft_telemetry_publishes counter\nhft_telemetry_publishes_total %lu\n",
+            static_cast<unsigned long>(frame.sequence));
+    appendf(out, "# TYPE hft_uptime_seconds gauge\nhft_uptime_seconds %.9f\n", d.system_uptime_ns / 1e9);
+    appendf(out, "# TYPE hft_components gauge\n");
+    appendf(out, "hft_components{state=\"healthy\"} %u\n", d.healthy_components);
+    appendf(out, "hft_components{state=\"degraded\"} %u\n", d.degraded_components);
+    appendf(out, "hft_components{state=\"failed\"} %u\n", d.failed_components);
+    appendf(out, "# TYPE hft_alerts_active gauge\nhft_alerts_active %u\n", d.active_alerts);
+    appendf(out, "# TYPE hft_alerts_critical gauge\nhft_alerts_critical %u\n", d.critical_alerts);
+    appendf(out, "# TYPE hft_system_latency_avg_ns gauge\nhft_system_latency_avg_ns %.3f\n", d.avg_system_latency_ns);
+    appendf(out, "# TYPE hft_throughput_ops_per_second gauge\nhft_throughput_ops_per_second %.3f\n",
+            d.total_throughput_ops_sec);
+
+    auto component_labels = [&](uint64_t component_id) {
+        out += "{component=\"";
+        detail::append_label_value(out, detail::component_name(frame, component_id));
+        appendf(out, "\",component_id=\"%lu\"", static_cast<unsigned long>(component_id));
+    };
+
+    out += "# TYPE hft_component_health gauge\n";
+    for (uint32_t i = 0; i < frame.component_count; ++i) {
+        const auto& c = frame.components[i];
+        out += "hft_component_health";
+        component_labels(c.component_id);
+        appendf(out, ",health=\"%s\"} 1\n", detail::health_label(c.health));
+    }
+    out += "# TYPE hft_component_heartbeats counter\n";
+    for (uint32_t i = 0; i < frame.component_count; ++i) {
+        out += "hft_component_heartbeats_total";
+        component_labels(frame.components[i].component_id);
+        appendf(out, "} %lu\n", static_cast<unsigned long>(frame.components[i].total_operations));
+    }
+
+    struct Field { const char* family; double TelemetryMetric::*member; };
+    static constexpr std::array<Field, 4> fields = {{
+        {"hft_metric_value", &TelemetryMetric::value},
+        {"hft_metric_avg", &TelemetryMetric::avg_value},
+        {"hft_metric_min", &TelemetryMetric::min_value},
+        {"hft_metric_max", &TelemetryMetric::max_value},
+    }};
+    for (const auto& field : fields) {
+        appendf(out, "# TYPE %s gauge\n", field.family);
+        for (uint32_t i = 0; i < frame.metric_count; ++i) {
+            const auto& m = frame.metrics[i];
+            out += field.family;
+            component_labels(m.component_id);
+            appendf(out, ",metric_id=\"%u\",type=\"%s\"} %.9g\n", m.metric_id, detail::metric_type_label(m.type),
+                    m.*(field.member));
+        }
+    }
+    out += "# TYPE hft_metric_samples counter\n";
+    for (uint32_t i = 0; i < frame.metric_count; ++i) {
+        const auto& m = frame.metrics[i];
+        out += "hft_metric_samples_total";
+        component_labels(m.component_id);
+        appendf(out, ",metric_id=\"%u\",type=\"%s\"} %u\n", m.metric_id, detail::metric_type_label(m.type),
+                m.sample_count);
+    }
+
+    out += "# TYPE hft_alert_value gauge\n";
+    for (uint32_t i = 0; i < frame.alert_count; ++i) {
+        const auto& a = frame.alerts[i];
+        out += "hft_alert_value";
+        component_labels(a.component_id);
+        appendf(out, ",metric_id=\"%lu\",severity=\"%s\",acknowledged=\"%s\"} %.9g\n",
+                static_cast<unsigned long>(a.metric_id), detail::severity_label(a.severity),
+                a.acknowledged ? "true" : "false", a.current_value);
+    }
+
+    out += "# TYPE hft_latency_ns histogram\n";
+    for (uint32_t h = 0; h < frame.histogram_count; ++h) {
+        const auto& histogram = frame.histograms[h];
+        uint64_t cumulative = 0;
+        for (size_t k = 0; k < TELEMETRY_HISTOGRAM_BUCKETS; ++k) {
+            cumulative += histogram.buckets[k];
+            out += "hft_latency_ns_bucket{name=\"";
+            detail::append_label_value(out, histogram.name);
+            appendf(out, "\",le=\"%lu\"} %lu\n", static_cast<unsigned long>((uint64_t{1} << k) - 1),
+                    static_cast<unsigned long>(cumulative));
+        }
+        out += "hft_latency_ns_bucket{name=\"";
+        detail::append_label_value(out, histogram.name);
+        appendf(out, "\",le=\"+Inf\"} %lu\n", static_cast<unsigned long>(histogram.total_samples));
+        out += "hft_latency_ns_count{name=\"";
+        detail::append_label_value(out, histogram.name);
+        appendf(out, "\"} %lu\n", static_cast<unsigned long>(histogram.total_samples));
+        out += "hft_latency_ns_sum{name=\"";
+        detail::append_label_value(out, histogram.name);
+        appendf(out, "\"} %.1f\n", histogram.sum_ns);
+    }
+    out += "# EOF\n";
+}
+
+// ========================= 5. UDP Stream =========================
+
+constexpr uint32_t TELEMETRY_STREAM_MAGIC = 0x4d4c5448;   // "HTLM"
+constexpr size_t TELEMETRY_DATAGRAM_BYTES = 1400;          // Stays under a 1500-byte MTU
+
+enum class TelemetryRecordType : uint8_t {
+    DASHBOARD = 1,      // One ProductionMonitoringSystem::DashboardSnapshot
+    METRIC = 2,         // TelemetryWireMetric records
+    HISTOGRAM = 3       // TelemetryWireHistogram records
+};
+
+/**
+ * @brief Leads every datagram; records of one type follow back to back
+ */
+struct TelemetryDatagramHeader {
+    uint32_t magic;
+    uint8_t version;
+    TelemetryRecordType type;
+    uint16_t record_count;
+    uint64_t sequence;                  // TelemetryFrame::sequence
+    uint64_t publish_time_ns;
+    uint16_t fragment;                  // Datagram index within this frame
+    uint16_t fragment_count;
+    uint32_t _reserved;
+};
+static_assert(sizeof(TelemetryDatagramHeader) == 32, "TelemetryDatagramHeader must be 32 bytes");
+
+struct TelemetryWireMetric {
+    uint32_t component_id;
+    uint32_t metric_id;
+    double value;
+    double avg_value;
+    uint32_t sample_count;
+    ProductionMonitoringSystem::MetricType type;
+    uint8_t _pad0[3];
+};
+static_assert(sizeof(TelemetryWireMetric) == 32, "TelemetryWireMetric must be 32 bytes");
+
+struct TelemetryWireHistogram {
+    char name[32];
+    uint64_t total_samples;
+    uint64_t interval_samples;
+    uint64_t interval_p50_ns;
+    uint64_t interval_p90_ns;
+    uint64_t interval_p99_ns;
+    uint64_t interval_p999_ns;
+    uint64_t interval_max_ns;
+};
+static_assert(sizeof(TelemetryWireHistogram) == 88, "TelemetryWireHistogram must be 88 bytes");
+
+namespace detail {
+
+constexpr size_t TELEMETRY_METRICS_PER_DATAGRAM =
+    (TELEMETRY_DATAGRAM_BYTES - sizeof(TelemetryDatagramHeader)) / sizeof(TelemetryWireMetric);
+constexpr size_t TELEMETRY_HISTOGRAMS_PER_DATAGRAM =
+    (TELEMETRY_DATAGRAM_BYTES - sizeof(TelemetryDatagramHeader)) / sizeof(TelemetryWireHistogram);
+
+} // namespace detail
+
+/**
+ * @brief Encode a frame as a sequence of self-describing datagrams
+ * @param emit Called once per datagram with (bytes, length)
+ * @return Datagrams produced
+ */
+template<typename Emit>
+inline size_t encode_telemetry_datagrams(const TelemetryFrame& frame, Emit&& emit) {
+    const size_t metric_datagrams =
+        (frame.metric_count + detail::TELEMETRY_METRICS_PER_DATAGRAM - 1) / detail::TELEMETRY_METRICS_PER_DATAGRAM;
+    const size_t histogram_datagrams = (frame.histogram_count + detail::TELEMETRY_HISTOGRAMS_PER_DATAGRAM - 1) /
+                                       detail::TELEMETRY_HISTOGRAMS_PER_DATAGRAM;
+    const uint16_t fragment_count = static_cast<uint16_t>(1 + metric_datagrams + histogram_datagrams);
+    alignas(8) uint8_t datagram[TELEMETRY_DATAGRAM_BYTES];
+    uint16_t fragment = 0;
+
+    auto send = [&](TelemetryRecordType type, size_t count, size_t payload_bytes) {
+        TelemetryDatagramHeader header{};
+        header.magic = TELEMETRY_STREAM_MAGIC;
+        header.version = static_cast<uint8_t>(TELEMETRY_VERSION);
+        header.type = type;
+        header.record_count = static_cast<uint16_t>(count);
+        header.sequence = frame.sequence;
+        header.publish_time_ns = frame.publish_time_ns;
+        header.fragment = fragment++;
+        header.fragment_count = fragment_count;
+        std::memcpy(datagram, &header, sizeof(header));
+        emit(static_cast<const uint8_t*>(datagram), sizeof(header) + payload_bytes);
+    };
+
+    static_assert(sizeof(TelemetryDatagramHeader) + sizeof(ProductionMonitoringSystem::DashboardSnapshot) <=
+                  TELEMETRY_DATAGRAM_BYTES, "Dashboard must fit one datagram");
+    std::memcpy(datagram + sizeof(TelemetryDatagramHeader), &frame.dashboard, sizeof(frame.dashboard));
+    send(TelemetryRecordType::DASHBOARD, 1, sizeof(frame.dashboard));
+
+    for (size_t first = 0; first < frame.metric_count; first += detail::TELEMETRY_METRICS_PER_DATAGRAM) {
+        const size_t count = std::min<size_t>(detail::TELEMETRY_METRICS_PER_DATAGRAM, frame.metric_count - first);
+        auto* records = reinterpret_cast<TelemetryWireMetric*>(datagram + sizeof(TelemetryDatagramHeader));
+        for (size_t i = 0; i < count; ++i) {
+            const auto& m = frame.metrics[first + i];
+            records[i] = TelemetryWireMetric{static_cast<uint32_t>(m.component_id), m.metric_id, m.value,
+                                             m.avg_value, m.sample_count, m.type, {}};
+        }
+        send(TelemetryRecordType::METRIC, count, count * sizeof(TelemetryWireMetric));
+    }
+
+    for (size_t first = 0; first < frame.histogram_count; first += detail::TELEMETRY_HISTOGRAMS_PER_DATAGRAM) {
+        const size_t count = std::min<size_t>(detail::TELEMETRY_HISTOGRAMS_PER_DATAGRAM, frame.histogram_count - first);
+        auto* records = reinterpret_cast<TelemetryWireHistogram*>(datagram + sizeof(TelemetryDatagramHeader));
+        for (size_t i = 0; i < count; ++i) {
+            const auto& h = frame.histograms[first + i];
+            auto& record = records[i];
+            std::memcpy(record.name, h.name, sizeof(record.name));
+            record.total_samples = h.total_samples;
+            record.interval_samples = h.interval_samples;
+            record.interval_p50_ns = h.interval_p50_ns;
+            record.interval_p90_ns = h.interval_p90_ns;
+            record.interval_p99_ns = h.interval_p99_ns;
+            record.interval_p999_ns = h.interval_p999_ns;
+            record.interval_max_ns = h.interval_max_ns;
+        }
+        send(TelemetryRecordType::HISTOGRAM, count, count * sizeof(TelemetryWireHistogram));
+    }
+    return fragment;
+}
+
+// ========================= 6. Exporter =========================
+
+struct TelemetryExporterConfig {
+    const char* http_address = "127.0.0.1";     // OpenMetrics scrape endpoint
+    uint16_t http_port = 0;                     // 0: ephemeral (see bound_port())
+    bool serve_http = true;
+    const char* udp_address = nullptr;          // Binary stream destination, nullptr: off
+    uint16_t udp_port = 0;
+    uint64_t poll_interval_ns = 1000000;        // New-frame check cadence (1ms)
+};
+
+/**
+ * @brief Serves a telemetry region over HTTP (OpenMetrics) and UDP
+ *
+ * Meant for its own process (see tools/telemetry_exporter.cpp): it only
+ * ever reads the shared region, so scrapes and the stream cost the
+ * trading process nothing beyond the publisher's copy. Each new frame is
+ * streamed once; scrapes render the latest frame on demand.
+ */
+class TelemetryExporter {
+public:
+    TelemetryExporter(const TelemetryReader& reader, const TelemetryExporterConfig& config)
+        : reader_(reader), config_(config), listen_fd_(-1), udp_fd_(-1), bound_port_(0), udp_dest_{},
+          running_(false), last_streamed_(0), scrapes_served_(0), frames_streamed_(0), datagrams_sent_(0) {}
+    ~TelemetryExporter() { stop(); }
+
+    TelemetryExporter(const TelemetryExporter&) = delete;
+    TelemetryExporter& operator=(const TelemetryExporter&) = delete;
+
+    bool start() noexcept {
+        if (running_.load() || !reader_.is_open()) return false;
+        if (config_.serve_http && !open_listener()) return false;
+        if (config_.udp_address != nullptr && !open_stream()) {
+            close_sockets();
+            return false;
+        }
+        if (!frame_) frame_ = std::make_unique<TelemetryFrame>();
+        running_.store(true, std::memory_order_release);
+        thread_ = std::thread(&TelemetryExporter::run, this);
+        return true;
+    }
+
+    void stop() noexcept {
+        if (running_.exchange(false) && thread_.joinable()) thread_.join();
+        close_sockets();
+    }
+
+    [[nodiscard]] uint16_t bound_port() const noexcept { return bound_port_; }
+    [[nodiscard]] uint64_t scrapes_served() const noexcept { return scrapes_served_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t frames_streamed() const noexcept { return frames_streamed_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t datagrams_sent() const noexcept { return datagrams_sent_.load(std::memory_order_relaxed); }
+
+private:
+    bool open_listener() noexcept {
+        listen_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listen_fd_ < 0) return false;
+        const int one = 1;
+        (void)::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(config_.http_port);
+        if (::inet_pton(AF_INET, config_.http_address, &addr.sin_addr) != 1 ||
+            ::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(listen_fd_, 8) != 0) {
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+            return false;
+        }
+        socklen_t len = sizeof(addr);
+        if (::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &len) == 0) {
+            bound_port_ = ntohs(addr.sin_port);
+        }
+        return true;
+    }
+
+    bool open_stream() noexcept {
+        udp_fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (udp_fd_ < 0) return false;
+        udp_dest_.sin_family = AF_INET;
+        udp_dest_.sin_port = htons(config_.udp_port);
+        return ::inet_pton(AF_INET, config_.udp_address, &udp_dest_.sin_addr) == 1;
+    }
+
+    void close_sockets() noexcept {
+        if (listen_fd_ >= 0) ::close(listen_fd_);
+        if (udp_fd_ >= 0) ::close(udp_fd_);
+        listen_fd_ = -1;
+        udp_fd_ = -1;
+    }
+
+    void run() noexcept {
+        const int timeout_ms = static_cast<int>(std::max<uint64_t>(config_.poll_interval_ns / 1000000, 1));
+        while (running_.load(std::memory_order_acquire)) {
+            if (listen_fd_ >= 0) {
+                pollfd pfd{listen_fd_, POLLIN, 0};
+                if (::poll(&pfd, 1, timeout_ms) > 0 && (pfd.revents & POLLIN)) serve_scrape();
+            } else {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(config_.poll_interval_ns));
+            }
+            if (udp_fd_ >= 0) stream_latest();
+        }
+    }
+
+    void stream_latest() noexcept {
+        const uint64_t version = reader_.version();
+        if (version == last_streamed_ || !reader_.read(*frame_)) return;
+        last_streamed_ = version;
+        const size_t sent = encode_telemetry_datagrams(*frame_, [this](const uint8_t* bytes, size_t length) {
+            (void)::sendto(udp_fd_, bytes, length, MSG_DONTWAIT, reinterpret_cast<const sockaddr*>(&udp_dest_),
+                           sizeof(udp_dest_));
+        });
+        datagrams_sent_.fetch_add(sent, std::memory_order_relaxed);
+        frames_streamed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // One request per connection; any path returns the metrics
+    void serve_scrape() noexcept {
+        const int client = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client < 0) return;
+        char request[1024];
+        pollfd pfd{client, POLLIN, 0};
+        if (::poll(&pfd, 1, 100) > 0) (void)::recv(client, request, sizeof(request), 0);
+
+        const char* status = "200 OK";
+        if (reader_.read(*frame_)) {
+            write_openmetrics(*frame_, body_);
+        } else {
+            status = "503 Service Unavailable";
+            body_ = "# EOF\n";
+        }
+        char header[256];
+        const int header_length = std::snprintf(
+            header, sizeof(header),
+            "HTTP/1.1 %s\r\nContent-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+            "Content-Length: %zu\r\nConnection: close\r\n\r\n",
+            status, body_.size());
+        if (send_all(client, header, static_cast<size_t>(header_length)) && send_all(client, body_.data(), body_.size())) {
+            scrapes_served_.fetch_add(1, std::memory_order_relaxed);
+        }
+        ::close(client);
+    }
+
+    static bool send_all(int fd, const char* data, size_t length) noexcept {
+        while (length > 0) {
+            const ssize_t sent = ::send(fd, data, length, MSG_NOSIGNAL);
+            if (sent < 0 && errno == EINTR) continue;
+            if (sent <= 0) return false;
+            data += sent;
+            length -= static_cast<size_t>(sent);
+        }
+        return true;
+    }
+
+    const TelemetryReader& reader_;
+    TelemetryExporterConfig config_;
+    int listen_fd_;
+    int udp_fd_;
+    uint16_t bound_port_;
+    sockaddr_in udp_dest_;
+    std::unique_ptr<TelemetryFrame> frame_;
+    std::string body_;
+    std::atomic<bool> running_;
+    std::thread thread_;
+    uint64_t last_streamed_;
+    std::atomic<uint64_t> scrapes_served_;
+    std::atomic<uint64_t> frames_streamed_;
+    std::atomic<uint64_t> datagrams_sent_;
+};
+
+} // namespace monitoring
+} // namespace hft
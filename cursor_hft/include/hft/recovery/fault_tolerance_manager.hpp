@@ -5,15 +5,16 @@
 #include <array>
 #include <atomic>
 #include <memory>
-#include <unordered_map>
 #include <functional>
 #include <chrono>
 #include "hft/timing/hft_timer.hpp"
 #include "hft/memory/object_pool.hpp"
+#include "hft/memory/fixed_hash_map.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
 #include "hft/market_data/treasury_instruments.hpp"
 #include "hft/trading/order_lifecycle_manager.hpp"
 #include "hft/monitoring/production_monitoring_system.hpp"
+#include "hft/recovery/warm_restart.hpp"
 
 namespace hft {
 namespace recovery {
@@ -259,6 +260,12 @@ public:
      * @return Checkpoint ID if successful, 0 if failed
      */
     [[nodiscard]] uint64_t create_checkpoint() noexcept;
+
+    /**
+     * @brief Back checkpoints with durable snapshots; checkpoint_data names the snapshot
+     * @param warm_restart Journal/snapshot owner, nullptr to detach
+     */
+    void set_warm_restart(WarmRestart* warm_restart) noexcept { warm_restart_ = warm_restart; }
     
     /**
      * @brief Restore system state from checkpoint
@@ -336,7 +343,7 @@ private:
     // Component tracking
     alignas(64) std::array<ComponentStatus, MAX_COMPONENTS> components_;
     alignas(64) std::atomic<size_t> component_count_;
-    alignas(64) std::unordered_map<uint64_t, size_t> component_index_map_;
+    alignas(64) hft::FixedHashMap<uint64_t, size_t, MAX_COMPONENTS> component_index_map_;
     
     // Recovery management
     alignas(64) std::array<RecoveryPlan, MAX_RECOVERY_PLANS> recovery_plans_;
@@ -353,6 +360,7 @@ private:
     alignas(64) std::array<SystemCheckpoint, MAX_CHECKPOINTS> checkpoints_;
     alignas(64) std::atomic<size_t> checkpoint_count_;
     alignas(64) std::atomic<uint64_t> next_checkpoint_id_;
+    WarmRestart* warm_restart_;
     
     // Performance tracking
     alignas(64) FaultToleranceMetrics metrics_;
@@ -392,7 +400,7 @@ inline FaultToleranceManager::FaultToleranceManager(
       emergency_shutdown_time_ns_(0),
       components_{},
       component_count_(0),
-      component_index_map_{},
+      component_index_map_(),
       recovery_plans_{},
       recovery_callbacks_{},
       recovery_plan_count_(0),
@@ -403,6 +411,7 @@ inline FaultToleranceManager::FaultToleranceManager(
       checkpoints_{},
       checkpoint_count_(0),
       next_checkpoint_id_(1),
+      warm_restart_(nullptr),
       metrics_{} {
     
     // Initialize component statuses
@@ -410,9 +419,6 @@ inline FaultToleranceManager::FaultToleranceManager(
         component.health = ProductionMonitoringSystem::ComponentHealth::UNKNOWN;
     }
     
-    // Reserve space for component index map
-    component_index_map_.reserve(MAX_COMPONENTS);
-    
     // Create initial checkpoint
     create_checkpoint();
 }
@@ -451,7 +457,7 @@ inline bool FaultToleranceManager::register_component(
     component.component_name[i] = '\0';
     
     // Update mappings
-    component_index_map_[component_id] = component_index;
+    component_index_map_.insert_or_assign(component_id, component_index);
     component_count_.store(current_count + 1, std::memory_order_release);
     
     return true;
@@ -656,6 +662,16 @@ inline uint64_t FaultToleranceManager::create_checkpoint() noexcept {
         }
     }
     
+    // Durable state: reap the previous snapshot writer, then start the next one
+    checkpoint.checkpoint_data[0] = '\0';
+    if (warm_restart_ != nullptr) {
+        (void)warm_restart_->poll_snapshot();
+        if (warm_restart_->take_snapshot()) {
+            std::snprintf(checkpoint.checkpoint_data, sizeof(checkpoint.checkpoint_data), "snapshot %05u",
+                          warm_restart_->journal().generation());
+        }
+    }
+    
     // Capture system metrics
     const auto dashboard = monitoring_system_.generate_dashboard_snapshot();
     checkpoint.total_orders_processed = dashboard.total_messages_processed;
@@ -743,8 +759,8 @@ inline size_t FaultToleranceManager::process_recoveries() noexcept {
 
 // Helper method implementations
 inline size_t FaultToleranceManager::find_component_index(uint64_t component_id) const noexcept {
-    const auto it = component_index_map_.find(component_id);
-    return (it != component_index_map_.end()) ? it->second : MAX_COMPONENTS;
+    const size_t* index = component_index_map_.find(component_id);
+    return index ? *index : MAX_COMPONENTS;
 }
 
 inline FaultToleranceManager::RecoveryPlan* FaultToleranceManager::find_recovery_plan(
@@ -0,0 +1,694 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "hft/timing/hft_timer.hpp"
+#include "hft/trading/state_journal.hpp"
+#include "hft/monitoring/production_monitoring_system.hpp"
+#include "hft/recovery/warm_restart.hpp"
+
+namespace hft {
+namespace recovery {
+
+using namespace hft::trading;
+using hft::monitoring::ProductionMonitoringSystem;
+
+// ========================= 1. Wire Format =========================
+//
+// One TCP stream per standby. The standby opens with HELLO carrying the
+// last sequence it already holds; the primary streams ENTRIES frames from
+// the next one on, sends HEARTBEAT when idle, and the standby ACKs what it
+// has applied. A HELLO the primary cannot serve (the journal no longer
+// reaches back that far) is answered with RESYNC before the link closes,
+// so the standby can tell a refusal from a lost primary. All fields are
+// host byte order (same-architecture peers).
+
+constexpr uint32_t REPLICATION_MAGIC = 0x50524648;  // "HFRP"
+
+enum class ReplicationFrameType : uint16_t {
+    HELLO = 1,          // standby -> primary
+    ENTRIES = 2,        // primary -> standby, `count` JournalEntries follow
+    HEARTBEAT = 3,      // primary -> standby
+    ACK = 4,            // standby -> primary
+    RESYNC = 5          // primary -> standby, HELLO refused: restore a newer snapshot first
+};
+
+struct ReplicationFrameHeader {
+    uint32_t magic;
+    ReplicationFrameType type;
+    uint16_t count;             // Entries following (ENTRIES only)
+    uint64_t sequence;          // HELLO/ACK/RESYNC: last applied; ENTRIES/HEARTBEAT: last shipped
+    uint64_t timestamp_ns;      // Sender clock when sent
+    uint64_t _reserved;
+};
+static_assert(sizeof(ReplicationFrameHeader) == 32, "ReplicationFrameHeader must be 32 bytes");
+
+/**
+ * @brief Link settings shared by both ends
+ */
+struct ReplicationConfig {
+    const char* address = "127.0.0.1";          // Primary listen / standby connect address
+    uint16_t port = 0;                          // 0: ephemeral on the primary (see bound_port())
+    uint64_t heartbeat_interval_ns = 1000000;   // Idle primary heartbeats (1ms)
+    uint64_t heartbeat_timeout_ns = 10000000;   // Standby takes over after this much silence (10ms)
+    uint64_t idle_sleep_ns = 20000;             // Primary poll back-off when the journal is idle
+    size_t batch_entries = 256;                 // Entries per ENTRIES frame
+    int socket_buffer_bytes = 4 * 1024 * 1024;
+};
+
+namespace detail {
+
+inline void tune_replication_socket(int fd, const ReplicationConfig& config) noexcept {
+    const int one = 1;
+    (void)::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    if (config.socket_buffer_bytes > 0) {
+        (void)::setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &config.socket_buffer_bytes, sizeof(int));
+        (void)::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &config.socket_buffer_bytes, sizeof(int));
+    }
+}
+
+inline bool send_frame(int fd, ReplicationFrameType type, uint64_t sequence,
+                       const JournalEntry* entries = nullptr, uint16_t count = 0) noexcept {
+    ReplicationFrameHeader header{};
+    header.magic = REPLICATION_MAGIC;
+    header.type = type;
+    header.count = count;
+    header.sequence = sequence;
+    header.timestamp_ns = HFTTimer::get_timestamp_ns();
+
+    iovec iov[2] = {{&header, sizeof(header)}, {const_cast<JournalEntry*>(entries), count * sizeof(JournalEntry)}};
+    msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count ? 2 : 1;
+    size_t remaining = sizeof(header) + count * sizeof(JournalEntry);
+    while (remaining > 0) {
+        const ssize_t n = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        remaining -= static_cast<size_t>(n);
+        // Partial send: advance the iovecs past what went out
+        size_t sent = static_cast<size_t>(n);
+        while (sent > 0 && msg.msg_iovlen > 0) {
+            const size_t step = std::min(sent, msg.msg_iov->iov_len);
+            msg.msg_iov->iov_base = static_cast<uint8_t*>(msg.msg_iov->iov_base) + step;
+            msg.msg_iov->iov_len -= step;
+            sent -= step;
+            if (msg.msg_iov->iov_len == 0) {
+                ++msg.msg_iov;
+                --msg.msg_iovlen;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+// ========================= 2. Journal Tail =========================
+
+/**
+ * @brief Follows a live StateJournal across generations through its files
+ *
+ * Maps generation files read-only and shared, so entries appear as the
+ * writer publishes their sequence. When the current entry is unwritten and
+ * the next generation's file exists, the writer has rotated and the tail
+ * moves on. Independent of the writer's thread.
+ */
+class JournalTail {
+public:
+    JournalTail() noexcept : map_(nullptr), map_bytes_(0), entries_(nullptr), capacity_(0), generation_(0),
+                             first_sequence_(0), index_(0) {}
+    ~JournalTail() { unmap(); }
+
+    JournalTail(const JournalTail&) = delete;
+    JournalTail& operator=(const JournalTail&) = delete;
+
+    /**
+     * @brief Position at next_sequence
+     * @return false if the journal on disk no longer reaches back that far
+     */
+    bool seek(const std::string& base_path, uint64_t next_sequence) noexcept {
+        base_path_ = base_path;
+        uint32_t snapshot = 0, lowest = UINT32_MAX, highest = 0;
+        (void)detail::scan_generations(base_path_, snapshot, lowest, highest);
+        if (lowest == UINT32_MAX) return false;
+        for (uint32_t generation = highest + 1; generation-- > lowest;) {
+            if (map(generation, 0) && first_sequence_ <= next_sequence) {
+                index_ = next_sequence - first_sequence_;
+                return index_ <= capacity_;
+            }
+        }
+        unmap();
+        return false;
+    }
+
+    /**
+     * @brief Next entry if it has been published (nullptr otherwise)
+     */
+    [[nodiscard]] const JournalEntry* peek() noexcept {
+        if (entries_ == nullptr) return nullptr;
+        if (const JournalEntry* entry = ready()) return entry;
+        // Unwritten: either the writer is idle or it has rotated
+        struct stat st{};
+        const std::string next = trading::detail::journal_path(base_path_, "journal", generation_ + 1);
+        if (::stat(next.c_str(), &st) != 0) return nullptr;
+        if (const JournalEntry* entry = ready()) return entry;
+        const uint64_t expected = first_sequence_ + index_;
+        if (!map(generation_ + 1, expected)) return nullptr;
+        index_ = 0;
+        return ready();
+    }
+
+    void advance() noexcept { ++index_; }
+
+    [[nodiscard]] uint64_t next_sequence() const noexcept { return first_sequence_ + index_; }
+    [[nodiscard]] uint32_t generation() const noexcept { return generation_; }
+
+private:
+    const JournalEntry* ready() const noexcept {
+        if (index_ >= capacity_) return nullptr;
+        const JournalEntry* entry = entries_ + index_;
+        return __atomic_load_n(&entry->sequence, __ATOMIC_ACQUIRE) == first_sequence_ + index_ ? entry : nullptr;
+    }
+
+    // Map a generation; expected_first != 0 also checks where it starts
+    bool map(uint32_t generation, uint64_t expected_first) noexcept {
+        const std::string path = trading::detail::journal_path(base_path_, "journal", generation);
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(JournalSegmentHeader)) {
+            ::close(fd);
+            return false;  // Writer is still creating it
+        }
+        const size_t bytes = static_cast<size_t>(st.st_size);
+        void* addr = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) return false;
+        const auto* header = static_cast<const JournalSegmentHeader*>(addr);
+        const size_t room = (bytes - sizeof(JournalSegmentHeader)) / sizeof(JournalEntry);
+        if (header->magic != JOURNAL_MAGIC || header->entry_size != sizeof(JournalEntry) || header->capacity > room ||
+            (expected_first != 0 && header->first_sequence != expected_first)) {
+            ::munmap(addr, bytes);
+            return false;
+        }
+        unmap();
+        map_ = addr;
+        map_bytes_ = bytes;
+        entries_ = reinterpret_cast<const JournalEntry*>(static_cast<const uint8_t*>(addr) + sizeof(JournalSegmentHeader));
+        capacity_ = header->capacity;
+        generation_ = generation;
+        first_sequence_ = header->first_sequence;
+        return true;
+    }
+
+    void unmap() noexcept {
+        if (map_ != nullptr) ::munmap(map_, map_bytes_);
+        map_ = nullptr;
+        entries_ = nullptr;
+    }
+
+    std::string base_path_;
+    void* map_;
+    size_t map_bytes_;
+    const JournalEntry* entries_;
+    size_t capacity_;
+    uint32_t generation_;
+    uint64_t first_sequence_;
+    uint64_t index_;
+};
+
+// ========================= 3. Primary: Journal Shipper =========================
+
+/**
+ * @brief Streams the primary's journal to one standby over TCP
+ *
+ * A background thread accepts the standby, tails the journal files from
+ * the sequence its HELLO asks for, and ships whatever is available in
+ * batches of up to batch_entries per frame (one sendmsg each). A standby
+ * asking for entries older than the oldest journal generation on disk
+ * (superseded by a snapshot) is sent RESYNC, disconnected and counted in
+ * resyncs_required().
+ */
+class JournalShipper {
+public:
+    static constexpr uint32_t METRIC_LAG_ENTRIES = 1;   // Shipped but not yet acknowledged
+    static constexpr uint32_t METRIC_SHIP_RATE = 2;     // Entries shipped per second
+
+    JournalShipper(const std::string& journal_base, const ReplicationConfig& config)
+        : journal_base_(journal_base), config_(config), listen_fd_(-1), client_fd_(-1), bound_port_(0),
+          running_(false), connected_(false), shipped_sequence_(0), acked_sequence_(0), entries_shipped_(0),
+          frames_sent_(0), heartbeats_sent_(0), connections_(0), resyncs_required_(0),
+          last_publish_ns_(0), last_publish_entries_(0) {}
+    ~JournalShipper() { stop(); }
+
+    JournalShipper(const JournalShipper&) = delete;
+    JournalShipper& operator=(const JournalShipper&) = delete;
+
+    /**
+     * @brief Listen for the standby and start the shipping thread
+     */
+    bool start() noexcept {
+        if (running_.load()) return false;
+        listen_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listen_fd_ < 0) return false;
+        const int one = 1;
+        (void)::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(config_.port);
+        if (::inet_pton(AF_INET, config_.address, &addr.sin_addr) != 1 ||
+            ::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(listen_fd_, 1) != 0) {
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+            return false;
+        }
+        socklen_t len = sizeof(addr);
+        if (::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &len) == 0) {
+            bound_port_ = ntohs(addr.sin_port);
+        }
+
+        batch_.resize(config_.batch_entries ? std::min<size_t>(config_.batch_entries, UINT16_MAX) : 1);
+        running_.store(true, std::memory_order_release);
+        thread_ = std::thread(&JournalShipper::run, this);
+        return true;
+    }
+
+    void stop() noexcept {
+        if (!running_.exchange(false)) return;
+        if (thread_.joinable()) thread_.join();
+        drop_client();
+        if (listen_fd_ >= 0) ::close(listen_fd_);
+        listen_fd_ = -1;
+    }
+
+    [[nodiscard]] uint16_t bound_port() const noexcept { return bound_port_; }
+    [[nodiscard]] bool connected() const noexcept { return connected_.load(std::memory_order_acquire); }
+    [[nodiscard]] uint64_t shipped_sequence() const noexcept { return shipped_sequence_.load(std::memory_order_acquire); }
+    [[nodiscard]] uint64_t acked_sequence() const noexcept { return acked_sequence_.load(std::memory_order_acquire); }
+    [[nodiscard]] uint64_t entries_shipped() const noexcept { return entries_shipped_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t frames_sent() const noexcept { return frames_sent_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t heartbeats_sent() const noexcept { return heartbeats_sent_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t connections() const noexcept { return connections_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t resyncs_required() const noexcept { return resyncs_required_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Report link health, lag and shipping rate (call from the monitoring cadence)
+     */
+    void publish_metrics(ProductionMonitoringSystem& monitoring, uint64_t component_id) noexcept {
+        const uint64_t now = HFTTimer::get_timestamp_ns();
+        const uint64_t shipped = entries_shipped();
+        const uint64_t shipped_seq = shipped_sequence();
+        const uint64_t acked_seq = acked_sequence();
+        monitoring.record_metric(component_id, METRIC_LAG_ENTRIES, ProductionMonitoringSystem::MetricType::COUNT,
+                                 static_cast<double>(shipped_seq > acked_seq ? shipped_seq - acked_seq : 0));
+        if (last_publish_ns_ != 0 && now > last_publish_ns_) {
+            monitoring.record_metric(component_id, METRIC_SHIP_RATE, ProductionMonitoringSystem::MetricType::THROUGHPUT,
+                                     static_cast<double>(shipped - last_publish_entries_) * 1e9 / static_cast<double>(now - last_publish_ns_));
+        }
+        last_publish_ns_ = now;
+        last_publish_entries_ = shipped;
+        monitoring.update_component_heartbeat(component_id, connected() ? ProductionMonitoringSystem::ComponentHealth::HEALTHY
+                                                                        : ProductionMonitoringSystem::ComponentHealth::UNHEALTHY);
+    }
+
+private:
+    void run() noexcept {
+        uint64_t last_send_ns = 0;
+        while (running_.load(std::memory_order_acquire)) {
+            if (client_fd_ < 0) {
+                accept_client();
+                last_send_ns = 0;
+                continue;
+            }
+
+            size_t count = 0;
+            while (count < batch_.size()) {
+                const JournalEntry* entry = tail_.peek();
+                if (entry == nullptr) break;
+                batch_[count++] = *entry;
+                tail_.advance();
+            }
+
+            const uint64_t now = HFTTimer::get_timestamp_ns();
+            const uint64_t head = tail_.next_sequence() - 1;
+            bool ok = true;
+            if (count > 0) {
+                ok = detail::send_frame(client_fd_, ReplicationFrameType::ENTRIES, head, batch_.data(),
+                                        static_cast<uint16_t>(count));
+                entries_shipped_.fetch_add(count, std::memory_order_relaxed);
+                frames_sent_.fetch_add(1, std::memory_order_relaxed);
+                shipped_sequence_.store(head, std::memory_order_release);
+                last_send_ns = now;
+            } else if (now - last_send_ns >= config_.heartbeat_interval_ns) {
+                ok = detail::send_frame(client_fd_, ReplicationFrameType::HEARTBEAT, head);
+                heartbeats_sent_.fetch_add(1, std::memory_order_relaxed);
+                last_send_ns = now;
+            }
+            ok = ok && read_acks();
+            if (!ok) {
+                drop_client();
+                continue;
+            }
+            if (count == 0) std::this_thread::sleep_for(std::chrono::nanoseconds(config_.idle_sleep_ns));
+        }
+    }
+
+    void accept_client() noexcept {
+        pollfd pfd{listen_fd_, POLLIN, 0};
+        if (::poll(&pfd, 1, 1) <= 0) return;
+        const int fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0) return;
+        detail::tune_replication_socket(fd, config_);
+
+        // HELLO names the last sequence the standby already has
+        ReplicationFrameHeader hello{};
+        pollfd cfd{fd, POLLIN, 0};
+        if (::poll(&cfd, 1, 100) <= 0 || ::recv(fd, &hello, sizeof(hello), MSG_WAITALL) != sizeof(hello) ||
+            hello.magic != REPLICATION_MAGIC || hello.type != ReplicationFrameType::HELLO) {
+            ::close(fd);
+            return;
+        }
+        if (!tail_.seek(journal_base_, hello.sequence + 1)) {
+            resyncs_required_.fetch_add(1, std::memory_order_relaxed);
+            (void)detail::send_frame(fd, ReplicationFrameType::RESYNC, hello.sequence);
+            ::close(fd);
+            return;
+        }
+        client_fd_ = fd;
+        shipped_sequence_.store(hello.sequence, std::memory_order_release);
+        acked_sequence_.store(hello.sequence, std::memory_order_release);
+        connections_.fetch_add(1, std::memory_order_relaxed);
+        connected_.store(true, std::memory_order_release);
+    }
+
+    // Non-blocking drain of standby ACKs; false once the standby is gone
+    bool read_acks() noexcept {
+        ReplicationFrameHeader ack{};
+        for (;;) {
+            const ssize_t n = ::recv(client_fd_, &ack, sizeof(ack), MSG_DONTWAIT | MSG_PEEK);
+            if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+            if (n == 0) return false;
+            if (n < static_cast<ssize_t>(sizeof(ack))) return true;  // Rest still in flight
+            (void)::recv(client_fd_, &ack, sizeof(ack), MSG_DONTWAIT);
+            if (ack.magic != REPLICATION_MAGIC) return false;
+            if (ack.type == ReplicationFrameType::ACK) acked_sequence_.store(ack.sequence, std::memory_order_release);
+        }
+    }
+
+    void drop_client() noexcept {
+        if (client_fd_ >= 0) ::close(client_fd_);
+        client_fd_ = -1;
+        connected_.store(false, std::memory_order_release);
+    }
+
+    std::string journal_base_;
+    ReplicationConfig config_;
+    int listen_fd_;
+    int client_fd_;
+    uint16_t bound_port_;
+    JournalTail tail_;
+    std::vector<JournalEntry> batch_;
+    std::thread thread_;
+    std::atomic<bool> running_;
+    std::atomic<bool> connected_;
+    alignas(64) std::atomic<uint64_t> shipped_sequence_;
+    std::atomic<uint64_t> acked_sequence_;
+    std::atomic<uint64_t> entries_shipped_;
+    std::atomic<uint64_t> frames_sent_;
+    std::atomic<uint64_t> heartbeats_sent_;
+    std::atomic<uint64_t> connections_;
+    std::atomic<uint64_t> resyncs_required_;
+    uint64_t last_publish_ns_;
+    uint64_t last_publish_entries_;
+};
+
+// ========================= 4. Standby =========================
+
+/**
+ * @brief Applies the primary's journal stream continuously and takes over on silence
+ *
+ * A background thread receives frames and folds each entry into the
+ * standby's components through a JournalApplier, so positions and risk are
+ * always current and orders only need one restore_orders() at takeover.
+ * Takeover happens when the primary closes the link or stays silent for
+ * heartbeat_timeout_ns, or on promote(); the takeover callback then runs on
+ * the standby thread with the components live (attach a journal there,
+ * e.g. WarmRestart::start_fresh() followed by take_snapshot()).
+ *
+ * A primary that answers HELLO with RESYNC cannot serve the standby's
+ * sequence; the standby then stops without taking over (resync_required())
+ * so it never goes live on state the primary has moved past. Restore a
+ * newer snapshot into the components and start() again.
+ *
+ * Components must have no journal attached while standing by.
+ */
+class HotStandby {
+public:
+    static constexpr uint32_t METRIC_LAG_ENTRIES = 1;   // Primary head minus applied
+    static constexpr uint32_t METRIC_DELAY_NS = 2;      // Send-to-apply delay of the last batch
+    static constexpr uint32_t METRIC_APPLY_RATE = 3;    // Entries applied per second
+
+    struct TakeoverStats {
+        bool primary_closed = false;        // Link closed (vs. heartbeat timeout / promote())
+        uint64_t last_sequence = 0;         // Last entry applied
+        uint64_t entries_applied = 0;
+        uint64_t orders_installed = 0;
+        uint64_t silence_ns = 0;            // Since the last frame, at detection
+        uint64_t commit_ns = 0;             // Installing staged orders
+    };
+
+    using TakeoverCallback = std::function<void(const TakeoverStats&)>;
+
+    HotStandby(const RecoveryComponents& components, const ReplicationConfig& config)
+        : config_(config), applier_(components), fd_(-1), running_(false), promoted_(false),
+          resync_required_(false), applied_sequence_(0), primary_sequence_(0), entries_applied_(0), delay_ns_(0), last_frame_ns_(0),
+          last_publish_ns_(0), last_publish_entries_(0) {}
+    ~HotStandby() { stop(); }
+
+    HotStandby(const HotStandby&) = delete;
+    HotStandby& operator=(const HotStandby&) = delete;
+
+    /** @brief Runs on the standby thread at takeover; set before start() */
+    void set_takeover_callback(TakeoverCallback callback) { callback_ = std::move(callback); }
+
+    /**
+     * @brief Connect to the primary and start applying
+     * @param applied_sequence Last sequence the components already reflect
+     *                         (e.g. WarmRestart::recover() on a copied snapshot), 0 if empty
+     */
+    bool start(uint64_t applied_sequence = 0) {
+        if (running_.load() || promoted_.load()) return false;
+        stop();  // Reap a thread that ended on RESYNC
+        resync_required_.store(false, std::memory_order_release);
+        fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd_ < 0) return false;
+        detail::tune_replication_socket(fd_, config_);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(config_.port);
+        if (::inet_pton(AF_INET, config_.address, &addr.sin_addr) != 1 ||
+            ::connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            !detail::send_frame(fd_, ReplicationFrameType::HELLO, applied_sequence)) {
+            close_link();
+            return false;
+        }
+
+        applier_.capture_orders();
+        applied_sequence_.store(applied_sequence, std::memory_order_release);
+        primary_sequence_.store(applied_sequence, std::memory_order_release);
+        buffer_.resize(sizeof(ReplicationFrameHeader) + (UINT16_MAX + 1) * sizeof(JournalEntry));
+        filled_ = 0;
+        last_frame_ns_ = HFTTimer::get_timestamp_ns();
+        running_.store(true, std::memory_order_release);
+        thread_ = std::thread(&HotStandby::run, this);
+        return true;
+    }
+
+    /**
+     * @brief Stop applying without taking over
+     */
+    void stop() noexcept {
+        running_.store(false, std::memory_order_release);
+        if (thread_.joinable()) thread_.join();
+        close_link();
+    }
+
+    /**
+     * @brief Take over now (planned failover); not from the takeover callback
+     * @return false if already promoted
+     */
+    bool promote() {
+        stop();
+        return take_over(false);
+    }
+
+    [[nodiscard]] bool promoted() const noexcept { return promoted_.load(std::memory_order_acquire); }
+    /** @brief The primary refused this standby's sequence; it stopped without taking over */
+    [[nodiscard]] bool resync_required() const noexcept { return resync_required_.load(std::memory_order_acquire); }
+    [[nodiscard]] uint64_t applied_sequence() const noexcept { return applied_sequence_.load(std::memory_order_acquire); }
+    [[nodiscard]] uint64_t primary_sequence() const noexcept { return primary_sequence_.load(std::memory_order_acquire); }
+    [[nodiscard]] uint64_t entries_applied() const noexcept { return entries_applied_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t lag_entries() const noexcept {
+        const uint64_t primary = primary_sequence(), applied = applied_sequence();
+        return primary > applied ? primary - applied : 0;
+    }
+    /** @brief Valid once promoted() */
+    [[nodiscard]] const TakeoverStats& takeover_stats() const noexcept { return takeover_; }
+
+    /**
+     * @brief Report link health, lag, delay and apply rate (call from the monitoring cadence)
+     */
+    void publish_metrics(ProductionMonitoringSystem& monitoring, uint64_t component_id) noexcept {
+        using Monitoring = ProductionMonitoringSystem;
+        const uint64_t now = HFTTimer::get_timestamp_ns();
+        const uint64_t applied = entries_applied();
+        monitoring.record_metric(component_id, METRIC_LAG_ENTRIES, Monitoring::MetricType::COUNT,
+                                 static_cast<double>(lag_entries()));
+        monitoring.record_metric(component_id, METRIC_DELAY_NS, Monitoring::MetricType::LATENCY,
+                                 static_cast<double>(delay_ns_.load(std::memory_order_relaxed)));
+        if (last_publish_ns_ != 0 && now > last_publish_ns_) {
+            monitoring.record_metric(component_id, METRIC_APPLY_RATE, Monitoring::MetricType::THROUGHPUT,
+                                     static_cast<double>(applied - last_publish_entries_) * 1e9 / static_cast<double>(now - last_publish_ns_));
+        }
+        last_publish_ns_ = now;
+        last_publish_entries_ = applied;
+        const auto health = promoted() ? Monitoring::ComponentHealth::FAILED
+                          : running_.load() ? Monitoring::ComponentHealth::HEALTHY
+                                            : Monitoring::ComponentHealth::UNHEALTHY;
+        monitoring.update_component_heartbeat(component_id, health);
+    }
+
+private:
+    void run() {
+        const timespec wait{0, static_cast<long>(std::min<uint64_t>(config_.heartbeat_interval_ns, 999999999))};
+        while (running_.load(std::memory_order_acquire)) {
+            pollfd pfd{fd_, POLLIN, 0};
+            const int ready = ::ppoll(&pfd, 1, &wait, nullptr);
+            const uint64_t now = HFTTimer::get_timestamp_ns();
+            if (ready > 0) {
+                const ssize_t n = ::recv(fd_, buffer_.data() + filled_, buffer_.size() - filled_, 0);
+                if (n == 0 || (n < 0 && errno != EINTR && errno != EAGAIN)) {
+                    if (resync_required()) break;
+                    (void)take_over(true);
+                    break;
+                }
+                if (n > 0) {
+                    filled_ += static_cast<size_t>(n);
+                    const uint64_t before = applied_sequence();
+                    if (!consume(now)) {
+                        (void)take_over(true);  // Corrupt stream: the primary is not trustworthy either
+                        break;
+                    }
+                    if (resync_required()) break;  // Refused, not lost: never promote on it
+                    if (applied_sequence() != before) {
+                        (void)detail::send_frame(fd_, ReplicationFrameType::ACK, applied_sequence());
+                    }
+                }
+            }
+            if (now - last_frame_ns_ > config_.heartbeat_timeout_ns) {
+                (void)take_over(false);
+                break;
+            }
+        }
+        running_.store(false, std::memory_order_release);
+    }
+
+    // Parse and apply every complete frame in the buffer
+    bool consume(uint64_t now) {
+        size_t offset = 0;
+        while (filled_ - offset >= sizeof(ReplicationFrameHeader)) {
+            ReplicationFrameHeader header;
+            std::memcpy(&header, buffer_.data() + offset, sizeof(header));
+            if (header.magic != REPLICATION_MAGIC) return false;
+            const size_t length = sizeof(header) + header.count * sizeof(JournalEntry);
+            if (filled_ - offset < length) break;
+
+            if (header.type == ReplicationFrameType::RESYNC) {
+                resync_required_.store(true, std::memory_order_release);
+                filled_ = 0;
+                return true;
+            }
+            if (header.type == ReplicationFrameType::ENTRIES) {
+                uint64_t applied = applied_sequence_.load(std::memory_order_relaxed);
+                for (uint16_t i = 0; i < header.count; ++i) {
+                    JournalEntry entry;
+                    std::memcpy(&entry, buffer_.data() + offset + sizeof(header) + i * sizeof(JournalEntry), sizeof(entry));
+                    if (entry.sequence <= applied) continue;
+                    if (applied != 0 && entry.sequence != applied + 1) return false;
+                    applier_.apply(entry);
+                    applied = entry.sequence;
+                    entries_applied_.fetch_add(1, std::memory_order_relaxed);
+                }
+                applied_sequence_.store(applied, std::memory_order_release);
+                delay_ns_.store(now > header.timestamp_ns ? now - header.timestamp_ns : 0, std::memory_order_relaxed);
+            }
+            primary_sequence_.store(header.sequence, std::memory_order_release);
+            last_frame_ns_ = now;
+            offset += length;
+        }
+        std::memmove(buffer_.data(), buffer_.data() + offset, filled_ - offset);
+        filled_ -= offset;
+        return true;
+    }
+
+    bool take_over(bool primary_closed) {
+        if (promoted_.exchange(true)) return false;
+        const uint64_t start_ns = HFTTimer::get_timestamp_ns();
+        takeover_.primary_closed = primary_closed;
+        takeover_.last_sequence = applied_sequence();
+        takeover_.entries_applied = entries_applied();
+        takeover_.silence_ns = start_ns > last_frame_ns_ ? start_ns - last_frame_ns_ : 0;
+        takeover_.orders_installed = applier_.commit();
+        applier_.reset();
+        takeover_.commit_ns = HFTTimer::get_timestamp_ns() - start_ns;
+        if (callback_) callback_(takeover_);
+        return true;
+    }
+
+    void close_link() noexcept {
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = -1;
+    }
+
+    ReplicationConfig config_;
+    JournalApplier applier_;
+    TakeoverCallback callback_;
+    TakeoverStats takeover_;
+    int fd_;
+    std::vector<uint8_t> buffer_;
+    size_t filled_ = 0;
+    std::thread thread_;
+    std::atomic<bool> running_;
+    std::atomic<bool> promoted_;
+    std::atomic<bool> resync_required_;
+    alignas(64) std::atomic<uint64_t> applied_sequence_;
+    std::atomic<uint64_t> primary_sequence_;
+    std::atomic<uint64_t> entries_applied_;
+    std::atomic<uint64_t> delay_ns_;
+    uint64_t last_frame_ns_;                        // Standby thread only
+    uint64_t last_publish_ns_;
+    uint64_t last_publish_entries_;
+};
+
+} // namespace recovery
+} // namespace hft
@@ -0,0 +1,626 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "hft/timing/hft_timer.hpp"
+#include "hft/trading/state_journal.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+#include "hft/trading/position_reconciliation_manager.hpp"
+#include "hft/trading/risk_control_system.hpp"
+
+namespace hft {
+namespace recovery {
+
+using namespace hft::market_data;
+using namespace hft::trading;
+
+// ========================= 1. Snapshot Format =========================
+//
+// <base>.snapshot.<N> holds the full state as of the last entry before
+// journal generation N, so recovery is: newest snapshot N, then replay
+// generations N, N+1, ... Layout (each section 64-byte aligned):
+//   SnapshotHeader
+//   uint32_t slot_generations[slot_count]
+//   OrderRecord[order_count]
+//   VenuePosition[position_count]
+//   Price32nd marks[mark_count]
+//   InstrumentRisk[risk_count]
+// A snapshot is written to <path>.tmp and renamed, so a snapshot under its
+// final name is always complete.
+
+constexpr uint64_t SNAPSHOT_MAGIC = 0x31305041534e4648ULL;  // "HFSNAP01"
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+struct alignas(64) SnapshotHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t generation;        // Journal generation that follows this snapshot
+    uint64_t last_sequence;     // Last journal entry reflected (0 = none)
+    uint64_t created_ns;
+    uint32_t slot_count;        // OrderLifecycleManager::MAX_ORDERS, 0 without orders
+    uint32_t order_count;
+    uint32_t position_count;
+    uint32_t mark_count;
+    uint32_t risk_count;
+    uint8_t _pad[12];
+};
+static_assert(sizeof(SnapshotHeader) == 64, "SnapshotHeader must be 64 bytes");
+
+namespace detail {
+
+inline size_t snapshot_align(size_t bytes) noexcept { return (bytes + 63) / 64 * 64; }
+
+inline bool snapshot_write(int fd, const void* data, size_t len) noexcept {
+    const auto* p = static_cast<const uint8_t*>(data);
+    while (len > 0) {
+        const ssize_t n = ::write(fd, p, len);
+        if (n <= 0) return false;
+        p += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+inline bool snapshot_pad(int fd, size_t written) noexcept {
+    static constexpr uint8_t zeros[64] = {};
+    const size_t pad = snapshot_align(written) - written;
+    return pad == 0 || snapshot_write(fd, zeros, pad);
+}
+
+/**
+ * @brief Newest snapshot and the journal generation range on disk for base_path
+ * @return true if a snapshot was found (snapshot is untouched otherwise)
+ */
+inline bool scan_generations(const std::string& base_path, uint32_t& snapshot, uint32_t& lowest, uint32_t& highest) {
+    const size_t slash = base_path.find_last_of('/');
+    const std::string dir = slash == std::string::npos ? "." : base_path.substr(0, slash == 0 ? 1 : slash);
+    const std::string name = slash == std::string::npos ? base_path : base_path.substr(slash + 1);
+    const std::string journal_prefix = name + ".journal.";
+    const std::string snapshot_prefix = name + ".snapshot.";
+
+    bool found = false;
+    DIR* handle = ::opendir(dir.c_str());
+    if (handle == nullptr) return false;
+    while (const dirent* entry = ::readdir(handle)) {
+        const std::string file = entry->d_name;
+        const bool is_journal = file.compare(0, journal_prefix.size(), journal_prefix) == 0;
+        const bool is_snapshot = file.compare(0, snapshot_prefix.size(), snapshot_prefix) == 0;
+        if (!is_journal && !is_snapshot) continue;
+        const std::string digits = file.substr(is_journal ? journal_prefix.size() : snapshot_prefix.size());
+        if (digits.empty() || digits.find_first_not_of("0123456789") != std::string::npos) continue;  // .tmp
+        const auto generation = static_cast<uint32_t>(std::strtoul(digits.c_str(), nullptr, 10));
+        if (is_journal) {
+            lowest = std::min(lowest, generation);
+            highest = std::max(highest, generation);
+        } else if (!found || generation > snapshot) {
+            snapshot = generation;
+            found = true;
+        }
+    }
+    ::closedir(handle);
+    return found;
+}
+
+} // namespace detail
+
+// ========================= 2. Journal Apply =========================
+
+/**
+ * @brief Components a journal is recorded from and replayed into (any may be nullptr)
+ */
+struct RecoveryComponents {
+    OrderLifecycleManager* orders = nullptr;
+    PositionReconciliationManager* positions = nullptr;
+    RiskControlSystem* risk = nullptr;
+};
+
+/**
+ * @brief Replays journal entries into components
+ *
+ * Fills and marks go straight into the position and risk managers. Orders
+ * are staged with their slot generations and installed in one
+ * restore_orders() by commit(), since OrderLifecycleManager has no
+ * per-order restore path. Shared by WarmRestart and HotStandby.
+ */
+class JournalApplier {
+public:
+    explicit JournalApplier(const RecoveryComponents& components)
+        : components_(components), generations_(OrderLifecycleManager::MAX_ORDERS, 0) {}
+
+    void reset() {
+        std::fill(generations_.begin(), generations_.end(), 0u);
+        orders_.clear();
+        index_.clear();
+    }
+
+    /**
+     * @brief Stage snapshot orders
+     */
+    void load_orders(const uint32_t* generations, size_t slot_count,
+                     const OrderLifecycleManager::OrderRecord* records, size_t count) {
+        std::memcpy(generations_.data(), generations, std::min(slot_count, generations_.size()) * sizeof(uint32_t));
+        orders_.assign(records, records + count);
+        for (size_t i = 0; i < orders_.size(); ++i) index_.emplace(orders_[i].order_id, i);
+    }
+
+    /**
+     * @brief Stage the orders already installed in the OrderLifecycleManager
+     */
+    void capture_orders() {
+        reset();
+        const auto* orders = components_.orders;
+        if (orders == nullptr) return;
+        for (size_t slot = 0; slot < generations_.size(); ++slot) generations_[slot] = orders->slot_generation(slot);
+        orders->for_each_order([this](const OrderLifecycleManager::OrderRecord& record) {
+            index_.emplace(record.order_id, orders_.size());
+            orders_.push_back(record);
+        });
+    }
+
+    /**
+     * @brief Fold one journal entry into the staged orders or the live components
+     */
+    void apply(const JournalEntry& entry) {
+        using Record = OrderLifecycleManager::OrderRecord;
+        const auto instrument = static_cast<TreasuryType>(entry.instrument);
+        const size_t slot = OrderLifecycleManager::slot_of(entry.order_id);
+        switch (entry.type) {
+            case JournalEntryType::ORDER_NEW: {
+                if (slot >= generations_.size()) return;
+                Record record;
+                record.order_id = entry.order_id;
+                record.client_order_id = entry.order_id;
+                record.state = static_cast<OrderLifecycleManager::OrderState>(entry.state);
+                record.instrument = instrument;
+                record.side = static_cast<OrderSide>(entry.side);
+                record.type = static_cast<OrderType>(entry.order_type);
+                record.time_in_force = static_cast<OrderLifecycleManager::TimeInForce>(entry.time_in_force);
+                record.target_venue = static_cast<OrderLifecycleManager::VenueType>(entry.venue);
+                record.strategy_id = entry.strategy_id;
+                record.order_price = entry.price;
+                record.original_quantity = entry.quantity;
+                record.executed_quantity = entry.executed_quantity;
+                record.leaves_quantity = entry.quantity - entry.executed_quantity;
+                record.creation_time_ns = entry.timestamp_ns;
+                generations_[slot] = OrderLifecycleManager::generation_of(entry.order_id);
+                const auto [it, inserted] = index_.emplace(entry.order_id, orders_.size());
+                if (inserted) {
+                    orders_.push_back(record);
+                } else {
+                    orders_[it->second] = record;
+                }
+                return;
+            }
+            case JournalEntryType::ORDER_UPDATE: {
+                const auto it = index_.find(entry.order_id);
+                if (it == index_.end()) return;
+                Record& record = orders_[it->second];
+                record.state = static_cast<OrderLifecycleManager::OrderState>(entry.state);
+                record.target_venue = static_cast<OrderLifecycleManager::VenueType>(entry.venue);
+                record.order_price = entry.price;
+                record.original_quantity = entry.quantity;
+                record.executed_quantity = entry.executed_quantity;
+                record.leaves_quantity = entry.quantity - entry.executed_quantity;
+                return;
+            }
+            case JournalEntryType::ORDER_RETIRE: {
+                const auto it = index_.find(entry.order_id);
+                if (it == index_.end()) return;
+                // Swap-remove, keeping the index of the moved record current
+                const size_t hole = it->second;
+                index_.erase(it);
+                if (hole + 1 != orders_.size()) {
+                    orders_[hole] = orders_.back();
+                    index_[orders_[hole].order_id] = hole;
+                }
+                orders_.pop_back();
+                if (slot < generations_.size()) generations_[slot] = OrderLifecycleManager::generation_of(entry.order_id) + 1;
+                return;
+            }
+            case JournalEntryType::POSITION_FILL:
+                if (components_.positions) {
+                    (void)components_.positions->update_position(instrument, static_cast<OrderLifecycleManager::VenueType>(entry.venue),
+                                                                 static_cast<OrderSide>(entry.side), entry.quantity,
+                                                                 entry.price, entry.order_id);
+                }
+                return;
+            case JournalEntryType::POSITION_MARK:
+                if (components_.positions) components_.positions->update_market_price(instrument, entry.price);
+                return;
+            case JournalEntryType::RISK_FILL:
+                if (components_.risk) components_.risk->update_position(instrument, entry.position_change, entry.price);
+                return;
+            case JournalEntryType::RISK_MARK:
+                if (components_.risk) components_.risk->update_market_price(instrument, entry.price);
+                return;
+            default:
+                return;
+        }
+    }
+
+    /**
+     * @brief Install staged orders into the OrderLifecycleManager
+     * @return Orders installed
+     */
+    size_t commit() noexcept {
+        if (components_.orders != nullptr) {
+            (void)components_.orders->restore_orders(generations_.data(), orders_.data(), orders_.size());
+        }
+        return orders_.size();
+    }
+
+    [[nodiscard]] size_t order_count() const noexcept { return orders_.size(); }
+    [[nodiscard]] const RecoveryComponents& components() const noexcept { return components_; }
+
+private:
+    RecoveryComponents components_;
+    std::vector<uint32_t> generations_;
+    std::vector<OrderLifecycleManager::OrderRecord> orders_;
+    std::unordered_map<uint64_t, size_t> index_;
+};
+
+// ========================= 3. Warm Restart =========================
+
+/**
+ * @brief Journal, snapshot and warm-restart coordinator for trading state
+ *
+ * Owns the StateJournal that OrderLifecycleManager, PositionReconciliation-
+ * Manager and RiskControlSystem append to. take_snapshot() rotates the
+ * journal and fork()s: the child writes the snapshot from its copy-on-write
+ * image while the parent keeps trading, and poll_snapshot() reaps it and
+ * drops the generations it supersedes. If fork() fails the snapshot is
+ * written inline. recover() maps the newest snapshot, replays the journal
+ * tail into the components and reopens the journal after it. maintain()
+ * on the same cadence rolls the journal before a generation fills; if one
+ * filled anyway, recover() refuses to report the replayed state as good.
+ *
+ * Everything here runs on the thread that drives the components.
+ */
+class WarmRestart {
+public:
+    using Components = RecoveryComponents;
+
+    struct RecoveryStats {
+        bool ok = false;
+        bool from_snapshot = false;
+        uint32_t snapshot_generation = 0;
+        uint32_t journal_generations = 0;       // Generations replayed
+        uint64_t entries_dropped = 0;           // Never journaled (generation was full): ok is false
+        uint64_t orders_restored = 0;
+        uint64_t entries_replayed = 0;
+        uint64_t last_sequence = 0;
+        uint64_t duration_ns = 0;
+    };
+
+    WarmRestart(const std::string& base_path, const Components& components,
+                size_t journal_capacity = StateJournal::DEFAULT_CAPACITY)
+        : base_path_(base_path), components_(components), journal_capacity_(journal_capacity),
+          child_(-1), pending_generation_(0), oldest_generation_(0), snapshot_generation_(0),
+          snapshots_written_(0), snapshot_failures_(0), applier_(components) {}
+
+    ~WarmRestart() {
+        (void)poll_snapshot(true);
+        attach(nullptr);
+    }
+
+    WarmRestart(const WarmRestart&) = delete;
+    WarmRestart& operator=(const WarmRestart&) = delete;
+
+    /**
+     * @brief Discard any previous journal and snapshots and start journaling
+     */
+    bool start_fresh() {
+        (void)poll_snapshot(true);
+        uint32_t snapshot = UINT32_MAX, lowest = UINT32_MAX, highest = 0;
+        if (!detail::scan_generations(base_path_, snapshot, lowest, highest)) snapshot = 0;
+        oldest_generation_ = std::min(snapshot, lowest);
+        remove_files(std::max(snapshot, highest) + 1);
+        oldest_generation_ = 0;
+        snapshot_generation_ = 0;
+        if (!journal_.open(base_path_, 0, 1, journal_capacity_)) return false;
+        attach(&journal_);
+        return true;
+    }
+
+    /**
+     * @brief Rebuild component state from the newest snapshot and the journal tail
+     *
+     * Components must be freshly constructed. Journaling resumes in a new
+     * generation after the last recovered entry.
+     */
+    RecoveryStats recover() {
+        RecoveryStats stats;
+        const uint64_t start_ns = HFTTimer::get_timestamp_ns();
+        (void)poll_snapshot(true);
+        attach(nullptr);
+
+        uint32_t snapshot = 0, lowest = UINT32_MAX, highest = 0;
+        const bool have_snapshot = detail::scan_generations(base_path_, snapshot, lowest, highest);
+
+        applier_.reset();
+        uint64_t last_sequence = 0;
+        uint32_t generation = lowest == UINT32_MAX ? 0 : lowest;
+        if (have_snapshot && load_snapshot(snapshot, last_sequence)) {
+            stats.from_snapshot = true;
+            stats.snapshot_generation = snapshot;
+            generation = snapshot;
+        }
+
+        // Replay until a generation is missing or the sequence breaks
+        bool intact = true;
+        JournalReader reader;
+        for (; intact && reader.open(base_path_, generation); ++generation) {
+            ++stats.journal_generations;
+            stats.entries_dropped += reader.entries_dropped();
+            for (size_t i = 0; i < reader.size(); ++i) {
+                const JournalEntry& entry = reader[i];
+                if (entry.sequence <= last_sequence) continue;
+                if (entry.sequence != last_sequence + 1 && last_sequence != 0) {
+                    intact = false;
+                    break;
+                }
+                applier_.apply(entry);
+                last_sequence = entry.sequence;
+                ++stats.entries_replayed;
+            }
+            highest = std::max(highest, generation);
+        }
+        reader.close();
+
+        stats.orders_restored = applier_.commit();
+        applier_.reset();
+
+        oldest_generation_ = stats.from_snapshot ? snapshot : (lowest == UINT32_MAX ? 0 : lowest);
+        snapshot_generation_ = stats.from_snapshot ? snapshot : 0;
+        const uint32_t next_generation = std::max(highest, snapshot) + 1;
+        // State changes that never reached the journal cannot be replayed
+        stats.ok = stats.entries_dropped == 0 &&
+                   journal_.open(base_path_, next_generation, last_sequence + 1, journal_capacity_);
+        if (stats.ok) attach(&journal_);
+        stats.last_sequence = last_sequence;
+        stats.duration_ns = HFTTimer::get_timestamp_ns() - start_ns;
+        return stats;
+    }
+
+    /**
+     * @brief Rotate the journal and write a snapshot of the state at that point
+     * @return false while a snapshot is still being written, or on failure
+     */
+    bool take_snapshot() noexcept {
+        if (child_ > 0 || !journal_.is_open()) return false;
+        const uint32_t generation = journal_.rotate();
+        if (generation == 0) return false;
+        pending_generation_ = generation;
+        const uint64_t last_sequence = journal_.first_sequence() - 1;
+
+        // Paths are built before fork(); the child must not allocate
+        snapshot_path_ = trading::detail::journal_path(base_path_, "snapshot", generation);
+        snapshot_tmp_path_ = snapshot_path_ + ".tmp";
+
+        const pid_t pid = ::fork();
+        if (pid == 0) {
+            ::_exit(write_snapshot(generation, last_sequence) ? 0 : 1);
+        }
+        if (pid < 0) {
+            const bool ok = write_snapshot(generation, last_sequence);
+            finish_snapshot(ok);
+            return ok;
+        }
+        child_ = pid;
+        return true;
+    }
+
+    /**
+     * @brief Reap the snapshot writer
+     * @param wait Block until it finishes
+     * @return true when a snapshot has just completed
+     */
+    bool poll_snapshot(bool wait = false) noexcept {
+        if (child_ <= 0) return false;
+        int status = 0;
+        const pid_t reaped = ::waitpid(child_, &status, wait ? 0 : WNOHANG);
+        if (reaped == 0) return false;
+        child_ = -1;
+        const bool ok = reaped > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        finish_snapshot(ok);
+        return ok;
+    }
+
+    /**
+     * @brief Cadence housekeeping: reap the snapshot writer and roll a filling journal
+     *
+     * Once the journal needs_rotation(), takes a snapshot (which rotates),
+     * or just rotates while the previous snapshot is still being written.
+     * @return false if the journal could not be rolled
+     */
+    bool maintain() noexcept {
+        (void)poll_snapshot();
+        if (!journal_.is_open() || !journal_.needs_rotation()) return true;
+        if (!snapshot_in_flight() && take_snapshot()) return true;
+        return !journal_.needs_rotation() || journal_.rotate() != 0;
+    }
+
+    [[nodiscard]] bool snapshot_in_flight() const noexcept { return child_ > 0; }
+    [[nodiscard]] uint32_t snapshot_generation() const noexcept { return snapshot_generation_; }
+    [[nodiscard]] uint64_t snapshots_written() const noexcept { return snapshots_written_; }
+    [[nodiscard]] uint64_t snapshot_failures() const noexcept { return snapshot_failures_; }
+    [[nodiscard]] StateJournal& journal() noexcept { return journal_; }
+
+private:
+    void attach(StateJournal* journal) noexcept {
+        if (components_.orders) components_.orders->set_journal(journal);
+        if (components_.positions) components_.positions->set_journal(journal);
+        if (components_.risk) components_.risk->set_journal(journal);
+    }
+
+    void finish_snapshot(bool ok) noexcept {
+        if (!ok) {
+            ++snapshot_failures_;  // Older generations stay, nothing is lost
+            (void)::unlink(snapshot_tmp_path_.c_str());
+            return;
+        }
+        ++snapshots_written_;
+        snapshot_generation_ = pending_generation_;
+        remove_files(pending_generation_);
+        oldest_generation_ = pending_generation_;
+    }
+
+    // Snapshot and journal files from oldest_generation_ up to `before`
+    void remove_files(uint32_t before) {
+        for (uint32_t generation = oldest_generation_; generation < before; ++generation) {
+            (void)::unlink(trading::detail::journal_path(base_path_, "journal", generation).c_str());
+            (void)::unlink(trading::detail::journal_path(base_path_, "snapshot", generation).c_str());
+        }
+    }
+
+    bool write_snapshot(uint32_t generation, uint64_t last_sequence) const noexcept {
+        const int fd = ::open(snapshot_tmp_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) return false;
+
+        const auto* orders = components_.orders;
+        const auto* positions = components_.positions;
+        const auto* risk = components_.risk;
+        constexpr size_t SLOTS = OrderLifecycleManager::MAX_ORDERS;
+        constexpr size_t INSTRUMENTS = PositionReconciliationManager::MAX_INSTRUMENTS;
+        constexpr size_t VENUES = PositionReconciliationManager::MAX_VENUES;
+
+        uint32_t order_count = 0;
+        if (orders) orders->for_each_order([&](const OrderLifecycleManager::OrderRecord&) { ++order_count; });
+
+        SnapshotHeader header{};
+        header.magic = SNAPSHOT_MAGIC;
+        header.version = SNAPSHOT_VERSION;
+        header.generation = generation;
+        header.last_sequence = last_sequence;
+        header.created_ns = HFTTimer::get_timestamp_ns();
+        header.slot_count = orders ? static_cast<uint32_t>(SLOTS) : 0;
+        header.order_count = order_count;
+        header.position_count = positions ? static_cast<uint32_t>(INSTRUMENTS * VENUES) : 0;
+        header.mark_count = positions ? static_cast<uint32_t>(INSTRUMENTS) : 0;
+        header.risk_count = risk ? static_cast<uint32_t>(RiskControlSystem::MAX_INSTRUMENTS) : 0;
+        bool ok = detail::snapshot_write(fd, &header, sizeof(header));
+
+        if (ok && orders) {
+            std::array<uint32_t, 4096> chunk;
+            for (size_t base = 0; ok && base < SLOTS; base += chunk.size()) {
+                const size_t n = std::min(chunk.size(), SLOTS - base);
+                for (size_t i = 0; i < n; ++i) chunk[i] = orders->slot_generation(base + i);
+                ok = detail::snapshot_write(fd, chunk.data(), n * sizeof(uint32_t));
+            }
+            ok = ok && detail::snapshot_pad(fd, SLOTS * sizeof(uint32_t));
+
+            std::array<OrderLifecycleManager::OrderRecord, 64> batch;
+            size_t pending = 0;
+            orders->for_each_order([&](const OrderLifecycleManager::OrderRecord& record) {
+                batch[pending++] = record;
+                if (pending == batch.size()) {
+                    ok = ok && detail::snapshot_write(fd, batch.data(), sizeof(batch));
+                    pending = 0;
+                }
+            });
+            ok = ok && detail::snapshot_write(fd, batch.data(), pending * sizeof(OrderLifecycleManager::OrderRecord));
+        }
+        if (ok && positions) {
+            for (size_t inst = 0; ok && inst < INSTRUMENTS; ++inst) {
+                for (size_t venue = 0; ok && venue < VENUES; ++venue) {
+                    const auto& position = positions->get_venue_position(
+                        static_cast<TreasuryType>(inst), static_cast<OrderLifecycleManager::VenueType>(venue));
+                    ok = detail::snapshot_write(fd, &position, sizeof(position));
+                }
+            }
+            std::array<Price32nd, INSTRUMENTS> marks;
+            for (size_t inst = 0; inst < INSTRUMENTS; ++inst) {
+                marks[inst] = positions->get_market_price(static_cast<TreasuryType>(inst));
+            }
+            ok = ok && detail::snapshot_write(fd, marks.data(), sizeof(marks)) && detail::snapshot_pad(fd, sizeof(marks));
+        }
+        if (ok && risk) {
+            for (size_t inst = 0; ok && inst < RiskControlSystem::MAX_INSTRUMENTS; ++inst) {
+                const auto& instrument_risk = risk->get_instrument_risk(static_cast<TreasuryType>(inst));
+                ok = detail::snapshot_write(fd, &instrument_risk, sizeof(instrument_risk));
+            }
+        }
+
+        ok = ok && ::fsync(fd) == 0;
+        ::close(fd);
+        return ok && ::rename(snapshot_tmp_path_.c_str(), snapshot_path_.c_str()) == 0;
+    }
+
+    bool load_snapshot(uint32_t generation, uint64_t& last_sequence) {
+        const std::string path = trading::detail::journal_path(base_path_, "snapshot", generation);
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SnapshotHeader)) {
+            ::close(fd);
+            return false;
+        }
+        const size_t length = static_cast<size_t>(st.st_size);
+        void* addr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) return false;
+
+        const auto* base = static_cast<const uint8_t*>(addr);
+        const auto* header = reinterpret_cast<const SnapshotHeader*>(base);
+        using Record = OrderLifecycleManager::OrderRecord;
+        using Position = PositionReconciliationManager::VenuePosition;
+        using Risk = RiskControlSystem::InstrumentRisk;
+        const size_t slots_end = sizeof(SnapshotHeader) + detail::snapshot_align(header->slot_count * sizeof(uint32_t));
+        const size_t orders_end = slots_end + header->order_count * sizeof(Record);
+        const size_t positions_end = orders_end + header->position_count * sizeof(Position);
+        const size_t marks_end = positions_end + detail::snapshot_align(header->mark_count * sizeof(Price32nd));
+        const size_t risk_end = marks_end + header->risk_count * sizeof(Risk);
+
+        const bool valid = header->magic == SNAPSHOT_MAGIC && header->version == SNAPSHOT_VERSION &&
+                           header->generation == generation && risk_end <= length &&
+                           (header->slot_count == 0 || header->slot_count == OrderLifecycleManager::MAX_ORDERS) &&
+                           (header->mark_count == 0 || header->mark_count == PositionReconciliationManager::MAX_INSTRUMENTS);
+        if (valid) {
+            last_sequence = header->last_sequence;
+            applier_.load_orders(reinterpret_cast<const uint32_t*>(base + sizeof(SnapshotHeader)), header->slot_count,
+                                 reinterpret_cast<const Record*>(base + slots_end), header->order_count);
+            if (components_.positions && header->position_count != 0) {
+                components_.positions->restore_positions(reinterpret_cast<const Position*>(base + orders_end),
+                                                         header->position_count,
+                                                         reinterpret_cast<const Price32nd*>(base + positions_end));
+            }
+            if (components_.risk && header->risk_count != 0) {
+                components_.risk->restore_instrument_risk(reinterpret_cast<const Risk*>(base + marks_end), header->risk_count);
+            }
+        }
+        ::munmap(addr, length);
+        return valid;
+    }
+
+    std::string base_path_;
+    Components components_;
+    size_t journal_capacity_;
+    StateJournal journal_;
+    pid_t child_;
+    uint32_t pending_generation_;
+    uint32_t oldest_generation_;
+    uint32_t snapshot_generation_;
+    uint64_t snapshots_written_;
+    uint64_t snapshot_failures_;
+    std::string snapshot_path_;
+    std::string snapshot_tmp_path_;
+
+    JournalApplier applier_;
+};
+
+} // namespace recovery
+} // namespace hft
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace hft {
+
+/**
+ * @brief Fixed-block allocator for coroutine frames
+ *
+ * One slab of equal blocks carved at construction, handed out from an
+ * intrusive free list: a frame allocation is a pop, its release a push,
+ * and neither touches the heap. Single-threaded: every coroutine whose
+ * frame comes from a pool must be created and destroyed on the pool's
+ * thread (an event loop's).
+ *
+ * Each block starts with a 64-byte header holding the owning pool, so
+ * release() needs nothing but the frame pointer. Frames larger than a
+ * block fail to allocate (see Task::promise_type) instead of spilling to
+ * the heap; size the blocks from frame_size() of the largest coroutine.
+ */
+class CoroutineFramePool {
+public:
+    static constexpr size_t HEADER_SIZE = 64;  // Keeps frames cache-line aligned (over-aligned locals)
+
+    /**
+     * @param blocks Frames that can be live at once
+     * @param block_size Bytes per block, header included (rounded up to 64)
+     */
+    explicit CoroutineFramePool(size_t blocks, size_t block_size = 1024) noexcept
+        : block_size_((block_size + 63) & ~size_t{63}), blocks_(blocks),
+          slab_(new (std::nothrow) Block[blocks * (block_size_ / sizeof(Block))]),
+          free_(nullptr), in_use_(0), high_water_(0), failures_(0) {
+        if (!slab_) {
+            blocks_ = 0;
+            return;
+        }
+        // Thread the free list back to front so blocks go out in address order
+        for (size_t i = blocks_; i-- > 0;) {
+            auto* node = reinterpret_cast<FreeNode*>(reinterpret_cast<std::byte*>(slab_.get()) + i * block_size_);
+            node->next = free_;
+            free_ = node;
+        }
+    }
+
+    CoroutineFramePool(const CoroutineFramePool&) = delete;
+    CoroutineFramePool& operator=(const CoroutineFramePool&) = delete;
+
+    /** @return Frame memory, or nullptr if the pool is empty or size exceeds a block */
+    [[nodiscard]] void* allocate(size_t size) noexcept {
+        if (__builtin_expect(free_ == nullptr || size > block_size_ - HEADER_SIZE, 0)) {
+            ++failures_;
+            return nullptr;
+        }
+        FreeNode* node = free_;
+        free_ = node->next;
+        if (++in_use_ > high_water_) {
+            high_water_ = in_use_;
+        }
+        auto* header = reinterpret_cast<CoroutineFramePool**>(node);
+        *header = this;
+        return reinterpret_cast<std::byte*>(node) + HEADER_SIZE;
+    }
+
+    /** @brief Return a frame to the pool that allocated it */
+    static void release(void* frame) noexcept {
+        auto* block = static_cast<std::byte*>(frame) - HEADER_SIZE;
+        CoroutineFramePool* pool = *reinterpret_cast<CoroutineFramePool**>(block);
+        auto* node = reinterpret_cast<FreeNode*>(block);
+        node->next = pool->free_;
+        pool->free_ = node;
+        --pool->in_use_;
+    }
+
+    /** @brief Largest frame a block holds */
+    [[nodiscard]] size_t frame_size() const noexcept { return block_size_ - HEADER_SIZE; }
+    [[nodiscard]] size_t capacity() const noexcept { return blocks_; }
+    [[nodiscard]] size_t in_use() const noexcept { return in_use_; }
+    [[nodiscard]] size_t high_water() const noexcept { return high_water_; }
+    [[nodiscard]] uint64_t failures() const noexcept { return failures_; }
+
+private:
+    struct alignas(64) Block {
+        std::byte bytes[64];
+    };
+
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    size_t block_size_;
+    size_t blocks_;
+    std::unique_ptr<Block[]> slab_;
+    FreeNode* free_;
+    size_t in_use_;
+    size_t high_water_;
+    uint64_t failures_;
+};
+
+/**
+ * @brief Lazily started, owning coroutine handle whose frame comes from a pool
+ *
+ * The coroutine's first parameter decides the pool: it must have a
+ * frame_pool() returning a CoroutineFramePool&. For a member coroutine
+ * that is the object itself, so
+ *
+ *     Task OrderEntrySession::run() { ... co_await ...; }
+ *
+ * takes its frame from the session's frame_pool(). A coroutine without
+ * such a parameter does not compile, so no frame reaches the heap by
+ * accident. When the pool is exhausted the call returns an invalid Task
+ * (valid() == false) rather than throwing.
+ *
+ * The Task starts suspended; resume() runs it to its next suspension
+ * point. It stays suspended at its end until destroyed, so done() can be
+ * checked after any resume. Destroying the Task frees the frame.
+ */
+class Task {
+public:
+    struct promise_type {
+        Task get_return_object() noexcept { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        static Task get_return_object_on_allocation_failure() noexcept { return Task{}; }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+
+        template<typename Owner, typename... Args>
+            requires requires(Owner& owner) { { owner.frame_pool() } -> std::same_as<CoroutineFramePool&>; }
+        static void* operator new(size_t size, Owner& owner, Args&&...) noexcept {
+            return owner.frame_pool().allocate(size);
+        }
+        static void operator delete(void* frame) noexcept { CoroutineFramePool::release(frame); }
+    };
+
+    Task() noexcept = default;
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            reset();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() { reset(); }
+
+    [[nodiscard]] bool valid() const noexcept { return static_cast<bool>(handle_); }
+    [[nodiscard]] bool done() const noexcept { return !handle_ || handle_.done(); }
+
+    /** @brief Run to the next suspension point; no-op once done */
+    void resume() noexcept {
+        if (handle_ && !handle_.done()) {
+            handle_.resume();
+        }
+    }
+
+    /** @brief Destroy the frame (and return it to its pool) */
+    void reset() noexcept {
+        if (handle_) {
+            std::exchange(handle_, {}).destroy();
+        }
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+} // namespace hft
@@ -0,0 +1,521 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace hft {
+
+/**
+ * @brief Host CPU/NUMA queries and per-thread placement primitives
+ *
+ * NUMA calls go straight to the set_mempolicy/mbind syscalls so there is
+ * no libnuma dependency. Every call is best effort: on a host without the
+ * privilege or the hardware it reports false and the caller carries on
+ * unpinned, unbound or at normal priority.
+ */
+namespace topology {
+
+inline constexpr int MAX_NUMA_NODES = 64;
+
+/** @brief Pin the calling thread to one core (false if out of range or refused) */
+inline bool pin_current_thread(int core) noexcept {
+    if (core < 0 || core >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+/** @brief Move the calling thread to SCHED_FIFO at priority (clamped to the valid range) */
+inline bool set_realtime_priority(int priority) noexcept {
+    sched_param param{};
+    param.sched_priority = std::clamp(priority, sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO));
+    return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+}
+
+/** @brief NUMA node that owns cpu, from sysfs (-1 if unknown) */
+inline int numa_node_of_cpu(int cpu) noexcept {
+    if (cpu < 0) {
+        return -1;
+    }
+    char path[96];
+    for (int node = 0; node < MAX_NUMA_NODES; ++node) {
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/node%d", cpu, node);
+        if (::access(path, F_OK) == 0) {
+            return node;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Parse a kernel cpulist ("1-3,6,8-9") into a set
+ * @return false on malformed input
+ */
+inline bool parse_cpu_list(std::string_view list, std::bitset<CPU_SETSIZE>& out) noexcept {
+    out.reset();
+    while (!list.empty() && (list.back() == '\n' || list.back() == ' ')) {
+        list.remove_suffix(1);
+    }
+    while (!list.empty()) {
+        const size_t comma = std::min(list.find(','), list.size());
+        const std::string_view item = list.substr(0, comma);
+        list.remove_prefix(std::min(comma + 1, list.size()));
+
+        const size_t dash = item.find('-');
+        unsigned first = 0;
+        unsigned last = 0;
+        const auto parse = [](std::string_view s, unsigned& value) {
+            const auto [end, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+            return ec == std::errc() && end == s.data() + s.size();
+        };
+        if (!parse(item.substr(0, dash), first) ||
+            !parse(dash == std::string_view::npos ? item : item.substr(dash + 1), last) ||
+            first > last || last >= CPU_SETSIZE) {
+            return false;
+        }
+        for (unsigned cpu = first; cpu <= last; ++cpu) {
+            out.set(cpu);
+        }
+    }
+    return true;
+}
+
+/** @brief Cores removed from the general scheduler (isolcpus=), empty if none */
+inline std::bitset<CPU_SETSIZE> isolated_cpus() noexcept {
+    std::bitset<CPU_SETSIZE> cpus;
+    if (FILE* file = std::fopen("/sys/devices/system/cpu/isolated", "r")) {
+        char buf[1024];
+        const size_t n = std::fread(buf, 1, sizeof(buf) - 1, file);
+        std::fclose(file);
+        if (!parse_cpu_list(std::string_view(buf, n), cpus)) {
+            cpus.reset();
+        }
+    }
+    return cpus;
+}
+
+// Kernel mempolicy modes (linux/mempolicy.h), spelled out to avoid pulling it in
+inline constexpr int MEMPOLICY_PREFERRED = 1;
+inline constexpr int MEMPOLICY_BIND = 2;
+
+/**
+ * @brief Prefer node for the calling thread's future page allocations
+ *
+ * Preferred rather than strict: with mlockall a strict bind turns a full
+ * node into an OOM kill, preferred spills to a remote node instead.
+ */
+inline bool prefer_local_memory(int node) noexcept {
+#ifdef SYS_set_mempolicy
+    if (node < 0 || node >= MAX_NUMA_NODES) {
+        return false;
+    }
+    const unsigned long mask = 1UL << node;
+    return ::syscall(SYS_set_mempolicy, MEMPOLICY_PREFERRED, &mask, MAX_NUMA_NODES + 1) == 0;
+#else
+    (void)node;
+    return false;
+#endif
+}
+
+/** @brief Bind [addr, addr + bytes) to node; must precede the first touch */
+inline bool bind_memory(void* addr, size_t bytes, int node) noexcept {
+#ifdef SYS_mbind
+    if (node < 0 || node >= MAX_NUMA_NODES) {
+        return false;
+    }
+    const unsigned long mask = 1UL << node;
+    return ::syscall(SYS_mbind, addr, bytes, MEMPOLICY_BIND, &mask, MAX_NUMA_NODES + 1, 0) == 0;
+#else
+    (void)addr;
+    (void)bytes;
+    (void)node;
+    return false;
+#endif
+}
+
+} // namespace topology
+
+/**
+ * @brief One T placed in memory on a given NUMA node
+ *
+ * For rings and other structures shared between stages: allocate on the
+ * consumer's node (ThreadTopology::node_of()) so the side that polls hits
+ * local memory and only the producer's stores cross the interconnect.
+ * The pages are mmap'd, bound to the node before anything touches them,
+ * prefaulted by constructing T and optionally mlock'd, so placement does
+ * not depend on which thread touches them first.
+ *
+ * Placement is best effort (bound() reports it); the allocation itself
+ * only fails if mmap does, in which case get() is null.
+ */
+template<typename T>
+class NodeLocal {
+    static_assert(alignof(T) <= 4096, "T alignment must fit a page");
+
+public:
+    template<typename... Args>
+    explicit NodeLocal(int node, bool lock_memory = true, Args&&... args) noexcept
+        : object_(nullptr), bytes_(0), bound_(false), locked_(false) {
+        const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        bytes_ = (sizeof(T) + page - 1) / page * page;
+        void* base = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            bytes_ = 0;
+            return;
+        }
+        bound_ = topology::bind_memory(base, bytes_, node);
+        volatile char* p = static_cast<char*>(base);
+        for (size_t off = 0; off < bytes_; off += page) {
+            p[off] = 0;
+        }
+        locked_ = lock_memory && ::mlock(base, bytes_) == 0;
+        object_ = ::new (base) T(std::forward<Args>(args)...);
+    }
+
+    ~NodeLocal() {
+        if (object_ != nullptr) {
+            object_->~T();
+            ::munmap(object_, bytes_);
+        }
+    }
+
+    NodeLocal(const NodeLocal&) = delete;
+    NodeLocal& operator=(const NodeLocal&) = delete;
+
+    [[nodiscard]] T* get() const noexcept { return object_; }
+    T* operator->() const noexcept { return object_; }
+    T& operator*() const noexcept { return *object_; }
+
+    /** @brief Pages were bound to the requested node */
+    [[nodiscard]] bool bound() const noexcept { return bound_; }
+    [[nodiscard]] bool memory_locked() const noexcept { return locked_; }
+
+private:
+    T* object_;
+    size_t bytes_;
+    bool bound_;
+    bool locked_;
+};
+
+/**
+ * @brief One pipeline stage: a named thread with its placement
+ */
+struct StageConfig {
+    std::string name;        // Thread name (first 15 characters reach the kernel)
+    int core = -1;           // -1: leave unpinned
+    int numa_node = -1;      // -1: the core's node
+    int rt_priority = 0;     // >0: SCHED_FIFO at this priority
+};
+
+/**
+ * @brief Whole-pipeline thread layout
+ *
+ * Text form, one directive per line, '#' starts a comment:
+ *
+ *     lock_memory on
+ *     stage feed      core=2 priority=80
+ *     stage strategy0 core=3 priority=70
+ *     stage journal   core=6 node=0
+ *     stage monitor
+ */
+struct TopologyConfig {
+    std::vector<StageConfig> stages;
+    bool lock_memory = true;  // mlockall(MCL_CURRENT | MCL_FUTURE) at start()
+
+    /**
+     * @brief Parse the text form into out
+     * @param error_line Set to the 1-based line of the first error
+     * @return false on a malformed line or a config validate() rejects (line 0)
+     */
+    static bool parse(std::string_view text, TopologyConfig& out, size_t* error_line = nullptr) {
+        TopologyConfig config;
+        size_t line_no = 0;
+        const auto fail = [&](size_t line) {
+            if (error_line != nullptr) *error_line = line;
+            return false;
+        };
+        while (!text.empty()) {
+            ++line_no;
+            const size_t eol = std::min(text.find('\n'), text.size());
+            std::string_view line = text.substr(0, eol);
+            text.remove_prefix(std::min(eol + 1, text.size()));
+            line = line.substr(0, line.find('#'));
+
+            std::string_view words[8];
+            size_t count = 0;
+            while (true) {
+                const size_t start = line.find_first_not_of(" \t\r");
+                if (start == std::string_view::npos) break;
+                line.remove_prefix(start);
+                const size_t end = std::min(line.find_first_of(" \t\r"), line.size());
+                if (count == std::size(words)) return fail(line_no);
+                words[count++] = line.substr(0, end);
+                line.remove_prefix(end);
+            }
+            if (count == 0) {
+                continue;
+            }
+
+            if (words[0] == "lock_memory" && count == 2 && (words[1] == "on" || words[1] == "off")) {
+                config.lock_memory = words[1] == "on";
+            } else if (words[0] == "stage" && count >= 2) {
+                StageConfig stage;
+                stage.name = std::string(words[1]);
+                for (size_t i = 2; i < count; ++i) {
+                    const size_t eq = words[i].find('=');
+                    if (eq == std::string_view::npos) return fail(line_no);
+                    const std::string_view key = words[i].substr(0, eq);
+                    const std::string_view value = words[i].substr(eq + 1);
+                    int parsed = 0;
+                    const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+                    if (ec != std::errc() || end != value.data() + value.size() || parsed < 0) return fail(line_no);
+                    if (key == "core") stage.core = parsed;
+                    else if (key == "node") stage.numa_node = parsed;
+                    else if (key == "priority") stage.rt_priority = parsed;
+                    else return fail(line_no);
+                }
+                config.stages.push_back(std::move(stage));
+            } else {
+                return fail(line_no);
+            }
+        }
+        if (!config.validate()) {
+            return fail(0);
+        }
+        out = std::move(config);
+        return true;
+    }
+
+    /**
+     * @brief Names unique and non-empty, no two stages pinned to one core
+     *
+     * Two busy-polling stages sharing a core starve each other, and under
+     * SCHED_FIFO never yield at all.
+     */
+    [[nodiscard]] bool validate() const noexcept {
+        std::bitset<CPU_SETSIZE> cores;
+        for (size_t i = 0; i < stages.size(); ++i) {
+            const StageConfig& stage = stages[i];
+            if (stage.name.empty() || stage.core >= CPU_SETSIZE || stage.numa_node >= topology::MAX_NUMA_NODES) {
+                return false;
+            }
+            for (size_t j = 0; j < i; ++j) {
+                if (stages[j].name == stage.name) return false;
+            }
+            if (stage.core >= 0) {
+                if (cores.test(stage.core)) return false;
+                cores.set(stage.core);
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief What a stage actually got (placement is best effort)
+ */
+struct StageStatus {
+    bool started = false;
+    bool pinned = false;         // Affinity set to the configured core
+    bool core_isolated = false;  // Configured core is in isolcpus
+    bool memory_bound = false;   // Thread memory policy prefers the stage's node
+    bool realtime = false;       // Running SCHED_FIFO
+    bool named = false;
+};
+
+class ThreadTopology;
+
+/**
+ * @brief Handed to each stage function
+ */
+class StageContext {
+public:
+    [[nodiscard]] const std::string& name() const noexcept { return config_->name; }
+    [[nodiscard]] int core() const noexcept { return config_->core; }
+    [[nodiscard]] int numa_node() const noexcept { return node_; }
+    [[nodiscard]] const StageStatus& status() const noexcept { return *status_; }
+
+    /** @brief Poll in the stage loop; set by ThreadTopology::stop() */
+    [[nodiscard]] bool stop_requested() const noexcept { return stop_->load(std::memory_order_acquire); }
+
+private:
+    friend class ThreadTopology;
+    const StageConfig* config_ = nullptr;
+    const StageStatus* status_ = nullptr;
+    const std::atomic<bool>* stop_ = nullptr;
+    int node_ = -1;
+};
+
+/**
+ * @brief Launches the pipeline's stages on their configured cores
+ *
+ * Bind a function to every stage named in the config, then start(): it
+ * locks the process's memory, launches one thread per stage, and each
+ * thread names itself, pins to its core, prefers its node's memory and
+ * switches to SCHED_FIFO before anything runs. No stage function starts
+ * until every stage is placed, so the feed cannot publish into a ring
+ * whose consumer is still migrating, and start() returns only once all
+ * are placed, so status() is final by then.
+ *
+ * Placement failures (no CAP_SYS_NICE, RLIMIT_MEMLOCK, no NUMA, fewer
+ * cores) are not fatal: the stage runs anyway and status() says what it
+ * did not get, for startup checks to warn or refuse on.
+ *
+ * Stage functions loop until StageContext::stop_requested(); stop() sets
+ * it and joins. Not thread-safe: configure, start and stop from one thread.
+ */
+class ThreadTopology {
+public:
+    using StageFn = std::function<void(StageContext&)>;
+
+    explicit ThreadTopology(TopologyConfig config)
+        : config_(std::move(config)), fns_(config_.stages.size()), status_(config_.stages.size()),
+          contexts_(config_.stages.size()), stop_(false), running_(false), memory_locked_(false) {}
+
+    ~ThreadTopology() { stop(); }
+
+    ThreadTopology(const ThreadTopology&) = delete;
+    ThreadTopology& operator=(const ThreadTopology&) = delete;
+
+    /** @return false if no stage has that name or the topology is running */
+    bool bind(std::string_view stage, StageFn fn) {
+        const size_t index = find(stage);
+        if (index == npos || running_) {
+            return false;
+        }
+        fns_[index] = std::move(fn);
+        return true;
+    }
+
+    /**
+     * @brief Node a stage's memory should come from (-1 if unknown)
+     *
+     * Known before start(): use it to allocate a stage's inbound rings
+     * with NodeLocal before the producers are launched.
+     */
+    [[nodiscard]] int node_of(std::string_view stage) const noexcept {
+        const size_t index = find(stage);
+        if (index == npos) {
+            return -1;
+        }
+        const StageConfig& config = config_.stages[index];
+        return config.numa_node >= 0 ? config.numa_node : topology::numa_node_of_cpu(config.core);
+    }
+
+    /**
+     * @return false if already running, the config is invalid or a stage has no function
+     */
+    bool start() {
+        if (running_ || !config_.validate() ||
+            std::any_of(fns_.begin(), fns_.end(), [](const StageFn& fn) { return !fn; })) {
+            return false;
+        }
+        if (config_.lock_memory) {
+            // Non-fatal: RLIMIT_MEMLOCK may be too small outside production hosts
+            memory_locked_ = ::mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+        }
+
+        const auto isolated = topology::isolated_cpus();
+        stop_.store(false, std::memory_order_release);
+        std::latch placed(static_cast<std::ptrdiff_t>(config_.stages.size()) + 1);
+        threads_.reserve(config_.stages.size());
+        for (size_t i = 0; i < config_.stages.size(); ++i) {
+            StageContext& context = contexts_[i];
+            context.config_ = &config_.stages[i];
+            context.status_ = &status_[i];
+            context.stop_ = &stop_;
+            context.node_ = node_of(config_.stages[i].name);
+            status_[i] = StageStatus{};
+            status_[i].core_isolated = context.core() >= 0 && isolated.test(context.core());
+            threads_.emplace_back([this, i, &placed] {
+                place(i);
+                placed.arrive_and_wait();
+                fns_[i](contexts_[i]);
+            });
+        }
+        placed.arrive_and_wait();
+        running_ = true;
+        return true;
+    }
+
+    /** @brief Ask every stage to return and join them */
+    void stop() noexcept {
+        stop_.store(true, std::memory_order_release);
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+        threads_.clear();
+        running_ = false;
+    }
+
+    [[nodiscard]] bool running() const noexcept { return running_; }
+
+    /** @brief mlockall succeeded at start() */
+    [[nodiscard]] bool memory_locked() const noexcept { return memory_locked_; }
+
+    [[nodiscard]] size_t stage_count() const noexcept { return config_.stages.size(); }
+    [[nodiscard]] const TopologyConfig& config() const noexcept { return config_; }
+
+    /** @brief Placement of a started stage (null if unknown) */
+    [[nodiscard]] const StageStatus* status(std::string_view stage) const noexcept {
+        const size_t index = find(stage);
+        return index == npos ? nullptr : &status_[index];
+    }
+
+private:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    size_t find(std::string_view stage) const noexcept {
+        for (size_t i = 0; i < config_.stages.size(); ++i) {
+            if (config_.stages[i].name == stage) return i;
+        }
+        return npos;
+    }
+
+    // Runs on the stage's own thread, before its function
+    void place(size_t index) noexcept {
+        const StageConfig& config = config_.stages[index];
+        StageStatus& status = status_[index];
+        char name[16];
+        std::snprintf(name, sizeof(name), "%s", config.name.c_str());
+        status.named = pthread_setname_np(pthread_self(), name) == 0;
+        status.pinned = topology::pin_current_thread(config.core);
+        status.memory_bound = topology::prefer_local_memory(contexts_[index].node_);
+        status.realtime = config.rt_priority > 0 && topology::set_realtime_priority(config.rt_priority);
+        status.started = true;
+    }
+
+    TopologyConfig config_;
+    std::vector<StageFn> fns_;
+    std::vector<StageStatus> status_;
+    std::vector<StageContext> contexts_;
+    std::vector<std::thread> threads_;
+    std::atomic<bool> stop_;
+    bool running_;
+    bool memory_locked_;
+};
+
+} // namespace hft
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "hft/messaging/wait_strategy.hpp"
+#include "hft/runtime/work_stealing_pool.hpp"
+#include "hft/timing/hft_timer.hpp"
+
+namespace hft {
+
+namespace warmup {
+
+/**
+ * @brief Fault in [addr, addr + bytes) for writing without changing its contents
+ *
+ * Safe on live objects: pages are populated with MADV_POPULATE_WRITE where
+ * the kernel has it, otherwise by rewriting one byte per page with its own
+ * value. Nothing else may write the range concurrently.
+ *
+ * @return Pages covered
+ */
+inline size_t prefault(void* addr, size_t bytes) noexcept {
+    if (bytes == 0) {
+        return 0;
+    }
+    static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(addr) & ~(page - 1);
+    const uintptr_t end = (reinterpret_cast<uintptr_t>(addr) + bytes + page - 1) & ~(page - 1);
+#ifndef MADV_POPULATE_WRITE
+    constexpr int MADV_POPULATE_WRITE = 23;  // Linux 5.14
+#endif
+    if (::madvise(reinterpret_cast<void*>(begin), end - begin, MADV_POPULATE_WRITE) != 0) {
+        // Older kernel: rewrite one byte of each page inside the range
+        const uintptr_t last = reinterpret_cast<uintptr_t>(addr) + bytes;
+        for (uintptr_t p = reinterpret_cast<uintptr_t>(addr); p < last; p = (p & ~(page - 1)) + page) {
+            volatile char* byte = reinterpret_cast<char*>(p);
+            *byte = *byte;
+        }
+    }
+    return (end - begin) / page;
+}
+
+} // namespace warmup
+
+/**
+ * @brief One-shot readiness signal for the session gate
+ *
+ * Constructed with the number of parties that must finish warming up
+ * (the startup WarmupPlan, plus each pipeline stage that warms its own
+ * hot path on its own core). Each calls arrive() once; whoever opens the
+ * session waits for ready().
+ */
+class Readiness {
+public:
+    explicit Readiness(uint32_t parties = 1) noexcept : pending_(parties) {}
+
+    Readiness(const Readiness&) = delete;
+    Readiness& operator=(const Readiness&) = delete;
+
+    /** @brief This party is warm; the last arrival wakes every waiter */
+    void arrive() noexcept {
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            ready_at_ns_.store(HFTTimer::get_timestamp_ns(), std::memory_order_relaxed);
+            wait_.notify_all();
+        }
+    }
+
+    [[nodiscard]] bool ready() const noexcept { return pending_.load(std::memory_order_acquire) <= 0; }
+
+    /** @brief Block (parked, not spinning) until every party has arrived */
+    void wait() noexcept {
+        wait_.wait([this] { return ready(); });
+    }
+
+    /** @brief Timestamp of the last arrival (0 until ready) */
+    [[nodiscard]] HFTTimer::ns_t ready_at_ns() const noexcept { return ready_at_ns_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> pending_;
+    std::atomic<HFTTimer::ns_t> ready_at_ns_{0};
+    ParkingWait<> wait_;
+};
+
+/**
+ * @brief Timings of one WarmupPlan::run()
+ */
+struct WarmupReport {
+    HFTTimer::CalibrationSource calibration = HFTTimer::CalibrationSource::Measured;
+    HFTTimer::ns_t calibration_ns = 0;
+    HFTTimer::ns_t prefault_ns = 0;
+    HFTTimer::ns_t traffic_ns = 0;
+    HFTTimer::ns_t total_ns = 0;
+    size_t regions = 0;
+    size_t bytes_prefaulted = 0;
+    size_t pages_prefaulted = 0;
+    uint64_t traffic_iterations = 0;
+};
+
+/**
+ * @brief Explicit startup warmup phase, run once before the session opens
+ *
+ * Three steps, in order:
+ * 1. Timer calibration, from the persisted rate when it still holds
+ *    (HFTTimer::calibrate()), so the first timestamp does not busy-wait
+ * 2. Prefault every registered region (pools, books, audit trails, rings)
+ *    in parallel: regions are cut into chunks and spread over the pool,
+ *    so the page faults happen now and not in the first minutes of
+ *    trading. Contents are preserved, so live objects can be registered
+ * 3. Synthetic traffic: each registered hot path runs its warmup
+ *    iterations on the calling thread, in registration order, to train
+ *    branch predictors and pull code and data into cache
+ *
+ * Then the Readiness passed to run() (if any) gets this plan's arrival.
+ *
+ * Caches and predictors are per core: run traffic on the thread that
+ * will run that path in the session. Stages launched by ThreadTopology
+ * do their own traffic in their stage function and arrive on the same
+ * Readiness; the plan covers the shared calibration and prefault steps.
+ * Traffic functions must leave their component as they found it
+ * (cancel what they submit, reset counters).
+ */
+class WarmupPlan {
+public:
+    static constexpr size_t PREFAULT_CHUNK = 2 * 1024 * 1024;
+
+    using TrafficFn = std::function<void(size_t iteration)>;
+
+    /** @param calibration_cache Timer calibration cache file (empty: always measure) */
+    explicit WarmupPlan(std::string calibration_cache = {}) : calibration_cache_(std::move(calibration_cache)) {}
+
+    void add_region(std::string name, void* addr, size_t bytes) {
+        regions_.push_back({std::move(name), addr, bytes});
+    }
+
+    /** @brief Prefault a whole object, e.g. an ObjectPool or OrderLifecycleManager */
+    template<typename T>
+    void add_object(std::string name, T& object) {
+        add_region(std::move(name), static_cast<void*>(&object), sizeof(T));
+    }
+
+    void add_traffic(std::string name, size_t iterations, TrafficFn fn) {
+        traffic_.push_back({std::move(name), iterations, std::move(fn)});
+    }
+
+    [[nodiscard]] size_t region_count() const noexcept { return regions_.size(); }
+    [[nodiscard]] size_t traffic_count() const noexcept { return traffic_.size(); }
+
+    WarmupReport run(WorkStealingPool& pool, Readiness* readiness = nullptr) noexcept {
+        WarmupReport report;
+
+        // A recalibration rescales the clock: time this step with the new rate
+        const HFTTimer::cycle_t calibration_start = HFTTimer::get_cycles();
+        report.calibration = HFTTimer::calibrate(calibration_cache_.empty() ? nullptr : calibration_cache_.c_str());
+        const HFTTimer::ns_t prefault_start = HFTTimer::get_timestamp_ns();
+        report.calibration_ns = HFTTimer::cycles_to_ns(HFTTimer::get_cycles() - calibration_start);
+
+        // Chunk every region, then fault the chunks in parallel
+        chunks_.clear();
+        for (const Region& region : regions_) {
+            for (size_t offset = 0; offset < region.bytes; offset += PREFAULT_CHUNK) {
+                chunks_.push_back({static_cast<char*>(region.addr) + offset,
+                                   std::min(PREFAULT_CHUNK, region.bytes - offset)});
+            }
+            report.bytes_prefaulted += region.bytes;
+        }
+        report.regions = regions_.size();
+        std::atomic<size_t> pages{0};
+        pool.parallel_for(chunks_.size(), [&](size_t task, size_t) {
+            pages.fetch_add(warmup::prefault(chunks_[task].addr, chunks_[task].bytes), std::memory_order_relaxed);
+        });
+        report.pages_prefaulted = pages.load(std::memory_order_relaxed);
+        const HFTTimer::ns_t traffic_start = HFTTimer::get_timestamp_ns();
+        report.prefault_ns = traffic_start - prefault_start;
+
+        for (const Traffic& traffic : traffic_) {
+            for (size_t i = 0; i < traffic.iterations; ++i) {
+                traffic.fn(i);
+            }
+            report.traffic_iterations += traffic.iterations;
+        }
+        const HFTTimer::ns_t end = HFTTimer::get_timestamp_ns();
+        report.traffic_ns = end - traffic_start;
+        report.total_ns = report.calibration_ns + (end - prefault_start);
+
+        if (readiness != nullptr) {
+            readiness->arrive();
+        }
+        return report;
+    }
+
+private:
+    struct Region {
+        std::string name;
+        void* addr;
+        size_t bytes;
+    };
+
+    struct Chunk {
+        void* addr;
+        size_t bytes;
+    };
+
+    struct Traffic {
+        std::string name;
+        size_t iterations;
+        TrafficFn fn;
+    };
+
+    std::string calibration_cache_;
+    std::vector<Region> regions_;
+    std::vector<Traffic> traffic_;
+    std::vector<Chunk> chunks_;
+};
+
+} // namespace hft
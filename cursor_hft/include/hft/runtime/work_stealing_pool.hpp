@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "hft/messaging/wait_strategy.hpp"
+#include "hft/timing/hft_timer.hpp"
+
+namespace hft {
+
+/**
+ * @brief Fixed thread pool that runs index-space jobs with work stealing
+ *
+ * parallel_for(count, fn) splits [0, count) into one contiguous range per
+ * lane (the calling thread is lane 0, each worker thread one more lane).
+ * A lane takes tasks from the front of its own range; once it runs dry
+ * it steals the back half of the fullest remaining range. Uneven tasks
+ * (a quiet day next to an FOMC day) therefore rebalance on their own and
+ * nobody waits on a queue lock. Each range is one 64-bit word
+ * (begin << 32 | end) updated by CAS, so a take and a steal cannot hand
+ * out the same task.
+ *
+ * Meant for coarse tasks (backtest shards, parameter sweeps), not the hot
+ * path: idle workers park on a futex (ParkingWait) between jobs, and a
+ * job's bookkeeping is a few atomics per task.
+ *
+ * fn is called as fn(task_index, lane) and must not throw. Lanes are
+ * stable for a job, so fn can index per-lane scratch state with them.
+ * Jobs run one at a time; parallel_for() must not be called from inside fn.
+ */
+class WorkStealingPool {
+public:
+    static constexpr size_t MAX_LANES = 256;
+
+    /**
+     * @param lanes Threads working a job, caller included (0 = one per hardware thread)
+     */
+    explicit WorkStealingPool(size_t lanes = 0)
+        : lane_count_(std::clamp<size_t>(lanes != 0 ? lanes : std::thread::hardware_concurrency(), 1, MAX_LANES)),
+          lanes_(std::make_unique<Lane[]>(lane_count_)),
+          current_(nullptr), generation_(0), remaining_(0), steals_(0), stop_(false) {
+        workers_.reserve(lane_count_ - 1);
+        for (size_t lane = 1; lane < lane_count_; ++lane) {
+            workers_.emplace_back([this, lane] { worker_loop(lane); });
+        }
+    }
+
+    ~WorkStealingPool() {
+        stop_.store(true, std::memory_order_release);
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Run fn(task, lane) for every task in [0, count); returns when all are done
+     */
+    template<typename Fn>
+    void parallel_for(size_t count, Fn&& fn) noexcept {
+        if (count == 0) {
+            return;
+        }
+        count = std::min<size_t>(count, UINT32_MAX);
+        Job job{&invoke<std::remove_reference_t<Fn>>, const_cast<void*>(static_cast<const void*>(&fn))};
+
+        // Even split, remainder to the first lanes
+        const size_t base = count / lane_count_;
+        const size_t extra = count % lane_count_;
+        size_t begin = 0;
+        for (size_t lane = 0; lane < lane_count_; ++lane) {
+            const size_t end = begin + base + (lane < extra ? 1 : 0);
+            lanes_[lane].range.store(pack(begin, end), std::memory_order_relaxed);
+            lanes_[lane].tasks_run = 0;
+            begin = end;
+        }
+        remaining_.store(count, std::memory_order_relaxed);
+
+        generation_.fetch_add(1, std::memory_order_relaxed);
+        current_.store(&job, std::memory_order_seq_cst);
+        wake_.notify_all();
+
+        run_lane(job, 0);
+        SpinYieldWait<> wait;
+        wait.wait([this] { return remaining_.load(std::memory_order_acquire) == 0; });
+
+        // Late workers may still hold the job: wait until none does before it goes out of scope
+        current_.store(nullptr, std::memory_order_seq_cst);
+        for (size_t lane = 1; lane < lane_count_; ++lane) {
+            wait.wait([&] { return lanes_[lane].hazard.load(std::memory_order_seq_cst) != &job; });
+        }
+    }
+
+    [[nodiscard]] size_t lane_count() const noexcept { return lane_count_; }
+
+    /** @brief Successful steals since construction */
+    [[nodiscard]] uint64_t steals() const noexcept { return steals_.load(std::memory_order_relaxed); }
+
+    /** @brief Tasks lane ran in the last job (read after parallel_for returns) */
+    [[nodiscard]] uint64_t tasks_run(size_t lane) const noexcept {
+        return lane < lane_count_ ? lanes_[lane].tasks_run : 0;
+    }
+
+private:
+    struct Job {
+        void (*run)(void* fn, size_t task, size_t lane) noexcept;
+        void* fn;
+    };
+
+    struct alignas(HFTTimer::CACHE_LINE_SIZE) Lane {
+        std::atomic<uint64_t> range{0};         // begin << 32 | end
+        std::atomic<const Job*> hazard{nullptr};  // Job this lane's worker is inside
+        uint64_t tasks_run = 0;                 // Owning lane only
+    };
+
+    template<typename Fn>
+    static void invoke(void* fn, size_t task, size_t lane) noexcept {
+        (*static_cast<Fn*>(fn))(task, lane);
+    }
+
+    static constexpr uint64_t pack(uint64_t begin, uint64_t end) noexcept { return begin << 32 | end; }
+    static constexpr uint32_t range_begin(uint64_t range) noexcept { return static_cast<uint32_t>(range >> 32); }
+    static constexpr uint32_t range_end(uint64_t range) noexcept { return static_cast<uint32_t>(range); }
+
+    void worker_loop(size_t lane) noexcept {
+        uint64_t seen = 0;
+        auto& hazard = lanes_[lane].hazard;
+        for (;;) {
+            wake_.wait([&] {
+                return generation_.load(std::memory_order_acquire) != seen || stop_.load(std::memory_order_acquire);
+            });
+            if (stop_.load(std::memory_order_acquire)) {
+                return;
+            }
+            seen = generation_.load(std::memory_order_acquire);
+
+            // Announce, then confirm the job is still current: the caller
+            // only retires a job once no lane announces it
+            const Job* job = current_.load(std::memory_order_seq_cst);
+            if (job == nullptr) {
+                continue;
+            }
+            hazard.store(job, std::memory_order_seq_cst);
+            if (current_.load(std::memory_order_seq_cst) == job) {
+                run_lane(*job, lane);
+            }
+            hazard.store(nullptr, std::memory_order_release);
+        }
+    }
+
+    void run_lane(const Job& job, size_t lane) noexcept {
+        size_t task;
+        for (;;) {
+            if (take(lane, task)) {
+                job.run(job.fn, task, lane);
+                ++lanes_[lane].tasks_run;
+                remaining_.fetch_sub(1, std::memory_order_acq_rel);
+            } else if (!steal(lane)) {
+                return;  // Every range is empty
+            }
+        }
+    }
+
+    // Front of the lane's own range
+    bool take(size_t lane, size_t& task) noexcept {
+        auto& range = lanes_[lane].range;
+        uint64_t current = range.load(std::memory_order_acquire);
+        while (range_begin(current) < range_end(current)) {
+            if (range.compare_exchange_weak(current, pack(range_begin(current) + 1, range_end(current)),
+                                            std::memory_order_acq_rel, std::memory_order_acquire)) {
+                task = range_begin(current);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Back half of the fullest other range into this (empty) lane
+    bool steal(size_t lane) noexcept {
+        for (;;) {
+            size_t victim = lane_count_;
+            uint64_t victim_range = 0;
+            uint32_t most = 0;
+            for (size_t i = 0; i < lane_count_; ++i) {
+                if (i == lane) continue;
+                const uint64_t r = lanes_[i].range.load(std::memory_order_acquire);
+                const uint32_t left = range_end(r) - range_begin(r);
+                if (range_begin(r) < range_end(r) && left > most) {
+                    most = left;
+                    victim = i;
+                    victim_range = r;
+                }
+            }
+            if (victim == lane_count_) {
+                return false;
+            }
+            const uint32_t begin = range_begin(victim_range);
+            const uint32_t end = range_end(victim_range);
+            const uint32_t split = end - (end - begin + 1) / 2;
+            if (lanes_[victim].range.compare_exchange_strong(victim_range, pack(begin, split),
+                                                             std::memory_order_acq_rel)) {
+                // The word is a lane's whole state, so a thief's CAS that
+                // matches it (even after A-B-A) is a valid steal
+                lanes_[lane].range.store(pack(split, end), std::memory_order_release);
+                steals_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    const size_t lane_count_;
+    std::unique_ptr<Lane[]> lanes_;
+    std::vector<std::thread> workers_;
+
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<const Job*> current_;
+    std::atomic<uint64_t> generation_;
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<size_t> remaining_;
+    std::atomic<uint64_t> steals_;
+    std::atomic<bool> stop_;
+    ParkingWait<> wake_;
+};
+
+} // namespace hft
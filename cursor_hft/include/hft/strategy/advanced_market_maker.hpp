@@ -7,10 +7,14 @@
 #include <memory>
 #include <cmath>
 #include "hft/timing/hft_timer.hpp"
+#include "hft/timing/latency_tracer.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
 #include "hft/market_data/treasury_instruments.hpp"
+#include "hft/market_data/tick_store.hpp"
+#include "hft/market_data/yield_curve.hpp"
 #include "hft/trading/order_book.hpp"
+#include "hft/config/system_traits.hpp"
 
 namespace hft {
 namespace strategy {
@@ -38,9 +42,9 @@ using namespace hft::trading;
  */
 class alignas(64) AdvancedMarketMaker {
 public:
-    static constexpr size_t MAX_INSTRUMENTS = 6;
+    static constexpr size_t MAX_INSTRUMENTS = config::SystemTraits::MAX_INSTRUMENTS;
     static constexpr size_t MAX_CURVE_POINTS = 12;  // Treasury curve points
-    static constexpr size_t VOLATILITY_WINDOW = 1000;  // Rolling window size
+    static constexpr size_t VOLATILITY_WINDOW = MarketTickStore::STATS_WINDOW;  // Rolling window size
     static constexpr size_t MICROSTRUCTURE_LEVELS = 5;  // Order book depth analysis
     
     // Market conditions assessment  
@@ -89,6 +93,7 @@ public:
     struct alignas(64) HedgeRatios {
         double portfolio_duration = 0.0;                         // Net portfolio duration (8 bytes)
         double portfolio_convexity = 0.0;                        // Net portfolio convexity (8 bytes) 
+        // Benchmark face that flattens each DV01 bucket (bills hedge in the 2Y)
         double curve_2y_hedge = 0.0;                            // 2Y hedge ratio (8 bytes)
         double curve_5y_hedge = 0.0;                            // 5Y hedge ratio (8 bytes)
         double curve_10y_hedge = 0.0;                           // 10Y hedge ratio (8 bytes)
@@ -116,6 +121,16 @@ public:
         InventoryState() noexcept : _pad{} {}
     };
     static_assert(sizeof(InventoryState) == 64, "InventoryState must be 64 bytes");
+
+    /**
+     * @brief Streaming position statistics behind InventoryState, O(1) per decision
+     */
+    struct alignas(64) InventoryStats {
+        EwmaStats position_ewma{0.02};                  // Recent inventory level and swing
+        WelfordStats position_session;                  // Inventory since start of session
+        uint64_t position_open_ns = 0;                  // Position last left flat or flipped (0 = flat)
+        int64_t last_position = 0;
+    };
     
     // Market update for advanced decision making
     struct MarketUpdate {
@@ -131,6 +146,7 @@ public:
         uint64_t last_trade_price_32nd = 0;
         uint64_t last_trade_size = 0;
         uint64_t update_time_ns = 0;
+        uint32_t trace_id = 0;                          // LatencyTracer ID, 0 = untraced
         
         MarketUpdate() noexcept = default;
     };
@@ -155,16 +171,22 @@ public:
         double confidence_score = 0.0;                  // Decision confidence [0,1]
         double expected_pnl = 0.0;                      // Expected P&L from decision
         uint64_t decision_time_ns = 0;
+        uint32_t trace_id = 0;                          // Copied from the MarketUpdate
         
         TradingDecision() noexcept = default;
     };
     
     /**
      * @brief Constructor with infrastructure dependencies
+     * @param shared_ticks Tick store shared with risk, fed by the caller before
+     *                     make_decision(); nullptr to keep (and feed) a private one
+     * @param shared_curve Yield curve shared with other strategies; nullptr for a private one
      */
     AdvancedMarketMaker(
-        hft::ObjectPool<TreasuryOrder, 4096>& order_pool,
-        TreasuryOrderBook& order_book
+        TreasuryOrderPool& order_pool,
+        TreasuryOrderBook& order_book,
+        MarketTickStore* shared_ticks = nullptr,
+        YieldCurve* shared_curve = nullptr
     ) noexcept;
     
     // No copy or move semantics
@@ -204,15 +226,19 @@ public:
     
     /**
      * @brief Update hedge ratios for treasury curve risk
-     * @param curve_update Treasury curve update
+     * @param yields On-the-run yields, applied to the (possibly shared) curve
+     *
+     * Recomputes only when the curve version or a position has changed
+     * since the last calculation.
      */
     void update_hedge_ratios(const std::array<double, 6>& yields) noexcept;
     
     /**
      * @brief Analyze inventory and determine rebalancing needs
      * @param instrument Treasury instrument type
+     * @param now_ns Decision time (0 = read the timer)
      */
-    void analyze_inventory(TreasuryType instrument) noexcept;
+    void analyze_inventory(TreasuryType instrument, uint64_t now_ns = 0) noexcept;
     
     /**
      * @brief Get current market conditions
@@ -220,6 +246,16 @@ public:
      * @return Market conditions assessment
      */
     [[nodiscard]] const MarketConditions& get_market_conditions(TreasuryType instrument) const noexcept;
+
+    /**
+     * @brief Tick history behind the volatility estimates
+     */
+    [[nodiscard]] const MarketTickStore& tick_store() const noexcept { return *tick_store_; }
+
+    /**
+     * @brief Curve behind the hedge ratios
+     */
+    [[nodiscard]] const YieldCurve& yield_curve() const noexcept { return *curve_; }
     
     /**
      * @brief Get current inventory state
@@ -227,6 +263,15 @@ public:
      * @return Inventory management state
      */
     [[nodiscard]] const InventoryState& get_inventory_state(TreasuryType instrument) const noexcept;
+
+    /**
+     * @brief Streaming position statistics for instrument
+     */
+    [[nodiscard]] const InventoryStats& get_inventory_stats(TreasuryType instrument) const noexcept {
+        static const InventoryStats none{};  // Instruments outside this build's universe
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? inventory_stats_[index] : none;
+    }
     
     /**
      * @brief Get hedge ratios for treasury curve
@@ -234,6 +279,29 @@ public:
      */
     [[nodiscard]] const HedgeRatios& get_hedge_ratios() const noexcept { return hedge_ratios_; }
     
+    /**
+     * @brief Replace the spread model parameters (e.g. per backtest sweep point)
+     */
+    void set_spread_parameters(const SpreadParameters& params) noexcept { spread_params_ = params; }
+    
+    [[nodiscard]] const SpreadParameters& get_spread_parameters() const noexcept { return spread_params_; }
+    
+    /**
+     * @brief Stamp traced updates BOOK once the tick store and market conditions are updated
+     *        (nullptr = off); decision thread only
+     */
+    void set_tracer(PipelineTracer* tracer) noexcept { tracer_ = tracer; }
+    
+    /**
+     * @brief Apply a fill to the net position
+     * @param instrument Treasury instrument type
+     * @param size_change Position change (positive for buy, negative for sell)
+     */
+    void update_position(TreasuryType instrument, int64_t size_change) noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        if (index < MAX_INSTRUMENTS) positions_[index].fetch_add(size_change, std::memory_order_relaxed);
+    }
+    
     /**
      * @brief Get position for instrument
      * @param instrument Treasury instrument type
@@ -264,7 +332,7 @@ public:
 
 private:
     // Infrastructure references
-    alignas(64) hft::ObjectPool<TreasuryOrder, 4096>& order_pool_;
+    alignas(64) TreasuryOrderPool& order_pool_;
     alignas(64) TreasuryOrderBook& order_book_;
     alignas(64) hft::HFTTimer timer_;
     
@@ -275,11 +343,16 @@ private:
     alignas(64) SpreadParameters spread_params_;
     alignas(64) PositionSizing position_params_;
     
-    // Hedge ratio calculations
+    // Hedge ratio calculations, cached against the curve version and positions
     alignas(64) HedgeRatios hedge_ratios_;
+    std::unique_ptr<YieldCurve> owned_curve_;
+    YieldCurve* curve_;
+    uint64_t hedge_curve_version_;
+    std::array<int64_t, MAX_INSTRUMENTS> hedge_positions_;
     
     // Inventory management per instrument
     alignas(64) std::array<InventoryState, MAX_INSTRUMENTS> inventory_states_;
+    alignas(64) std::array<InventoryStats, MAX_INSTRUMENTS> inventory_stats_;
     
     // Position tracking per instrument
     alignas(64) std::array<std::atomic<int64_t>, MAX_INSTRUMENTS> positions_;
@@ -287,8 +360,9 @@ private:
     alignas(64) std::array<std::atomic<uint64_t>, MAX_INSTRUMENTS> daily_pnl_cents_;
     
     // Volatility tracking (rolling window)
-    alignas(64) std::array<std::array<double, VOLATILITY_WINDOW>, MAX_INSTRUMENTS> price_history_;
-    alignas(64) std::array<size_t, MAX_INSTRUMENTS> price_history_index_;
+    std::unique_ptr<MarketTickStore> owned_tick_store_;
+    MarketTickStore* tick_store_;
+    PipelineTracer* tracer_ = nullptr;
     
     // Performance tracking
     alignas(64) std::atomic<uint64_t> decision_count_;
@@ -301,7 +375,6 @@ private:
     double calculate_order_book_imbalance(const MarketUpdate& update) noexcept;
     double calculate_adverse_selection_cost(TreasuryType instrument) noexcept;
     double calculate_inventory_penalty(TreasuryType instrument) noexcept;
-    void update_price_history(TreasuryType instrument, double price) noexcept;
     bool should_provide_liquidity(const MarketUpdate& update) noexcept;
     bool should_rebalance_inventory(TreasuryType instrument) noexcept;
 };
@@ -309,8 +382,10 @@ private:
 // Implementation
 
 inline AdvancedMarketMaker::AdvancedMarketMaker(
-    hft::ObjectPool<TreasuryOrder, 4096>& order_pool,
-    TreasuryOrderBook& order_book
+    TreasuryOrderPool& order_pool,
+    TreasuryOrderBook& order_book,
+    MarketTickStore* shared_ticks,
+    YieldCurve* shared_curve
 ) noexcept
     : order_pool_(order_pool),
       order_book_(order_book),
@@ -319,12 +394,17 @@ inline AdvancedMarketMaker::AdvancedMarketMaker(
       spread_params_(),
       position_params_(),
       hedge_ratios_(),
+      owned_curve_(shared_curve ? nullptr : std::make_unique<YieldCurve>()),
+      curve_(shared_curve ? shared_curve : owned_curve_.get()),
+      hedge_curve_version_(UINT64_MAX),
+      hedge_positions_{},
       inventory_states_{},
+      inventory_stats_{},
       positions_{},
       unrealized_pnl_cents_{},
       daily_pnl_cents_{},
-      price_history_{},
-      price_history_index_{},
+      owned_tick_store_(shared_ticks ? nullptr : std::make_unique<MarketTickStore>()),
+      tick_store_(shared_ticks ? shared_ticks : owned_tick_store_.get()),
       decision_count_(0),
       total_decision_time_ns_(0) {
     
@@ -340,10 +420,6 @@ inline AdvancedMarketMaker::AdvancedMarketMaker(
     for (auto& pnl : daily_pnl_cents_) {
         pnl.store(0, std::memory_order_relaxed);
     }
-    
-    for (auto& index : price_history_index_) {
-        index = 0;
-    }
 }
 
 inline AdvancedMarketMaker::TradingDecision 
@@ -353,6 +429,7 @@ AdvancedMarketMaker::make_decision(const MarketUpdate& update) noexcept {
     TradingDecision decision;
     decision.instrument = update.instrument;
     decision.decision_time_ns = decision_start;
+    decision.trace_id = update.trace_id;
     
     // Update market conditions first
     update_market_conditions(update);
@@ -370,7 +447,7 @@ AdvancedMarketMaker::make_decision(const MarketUpdate& update) noexcept {
     }
     
     // Check inventory rebalancing needs
-    analyze_inventory(update.instrument);
+    analyze_inventory(update.instrument, decision_start);
     if (should_rebalance_inventory(update.instrument)) {
         const auto& inventory = inventory_states_[instrument_index];
         
@@ -423,9 +500,11 @@ inline void AdvancedMarketMaker::update_market_conditions(const MarketUpdate& up
     
     auto& conditions = market_conditions_[instrument_index];
     
-    // Update price history for volatility calculation
-    const double mid_price = (update.best_bid.to_decimal() + update.best_ask.to_decimal()) / 2.0;
-    update_price_history(update.instrument, mid_price);
+    // Update price history for volatility calculation (a shared store is fed by its owner)
+    if (owned_tick_store_) {
+        owned_tick_store_->record(update.instrument, update.best_bid.to_decimal(), update.best_ask.to_decimal(),
+                                  update.bid_size, update.ask_size, 0.0, 0.0, update.update_time_ns);
+    }
     
     // Calculate market conditions
     conditions.realized_volatility = calculate_realized_volatility(update.instrument);
@@ -433,6 +512,7 @@ inline void AdvancedMarketMaker::update_market_conditions(const MarketUpdate& up
     conditions.market_impact = calculate_market_impact(update);
     conditions.liquidity_score = calculate_liquidity_score(update);
     conditions.last_update_time_ns = timer_.get_timestamp_ns();
+    if (tracer_) tracer_->stamp(update.trace_id, TraceStage::BOOK);
 }
 
 inline double AdvancedMarketMaker::calculate_optimal_spread(TreasuryType instrument) noexcept {
@@ -493,36 +573,8 @@ inline double AdvancedMarketMaker::calculate_realized_volatility(TreasuryType in
     const auto instrument_index = static_cast<size_t>(instrument);
     if (instrument_index >= MAX_INSTRUMENTS) return 0.0;
     
-    const auto& history = price_history_[instrument_index];
-    const size_t index = price_history_index_[instrument_index];
-    
-    if (index < 2) return 0.0; // Need at least 2 data points
-    
-    double sum_squared_returns = 0.0;
-    size_t count = 0;
-    
-    // Calculate returns and their variance
-    for (size_t i = 1; i < std::min(index, VOLATILITY_WINDOW); ++i) {
-        const double return_val = (history[i] - history[i-1]) / history[i-1];
-        sum_squared_returns += return_val * return_val;
-        ++count;
-    }
-    
-    if (count == 0) return 0.0;
-    
-    const double variance = sum_squared_returns / count;
-    return std::sqrt(variance) * std::sqrt(252.0 * 24.0 * 60.0); // Annualized volatility
-}
-
-inline void AdvancedMarketMaker::update_price_history(TreasuryType instrument, double price) noexcept {
-    const auto instrument_index = static_cast<size_t>(instrument);
-    if (instrument_index >= MAX_INSTRUMENTS) return;
-    
-    auto& history = price_history_[instrument_index];
-    auto& index = price_history_index_[instrument_index];
-    
-    history[index % VOLATILITY_WINDOW] = price;
-    ++index;
+    // RMS of mid returns over the window, maintained incrementally by the store
+    return tick_store_->realized_volatility(instrument) * std::sqrt(252.0 * 24.0 * 60.0); // Annualized volatility
 }
 
 inline double AdvancedMarketMaker::calculate_inventory_penalty(TreasuryType instrument) noexcept {
@@ -560,18 +612,81 @@ inline bool AdvancedMarketMaker::should_provide_liquidity(const MarketUpdate& up
     return true;
 }
 
-// Stub implementations for other methods
 inline void AdvancedMarketMaker::update_hedge_ratios(const std::array<double, 6>& yields) noexcept {
-    // Implementation would calculate duration and convexity hedge ratios
+    // A strategy sharing the curve with one that already applied these yields changes nothing here
+    curve_->update(yields);
+
+    std::array<int64_t, MAX_INSTRUMENTS> positions;
+    bool positions_changed = false;
+    for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+        positions[i] = positions_[i].load(std::memory_order_relaxed);
+        positions_changed |= positions[i] != hedge_positions_[i];
+    }
+    if (curve_->version() == hedge_curve_version_ && !positions_changed) {
+        return;
+    }
+
+    // Bucket each position onto the nearest benchmark (bills onto the 2Y) by DV01
+    constexpr TreasuryType BENCHMARKS[4] = {
+        TreasuryType::Note_2Y, TreasuryType::Note_5Y, TreasuryType::Note_10Y, TreasuryType::Bond_30Y
+    };
+    constexpr size_t BUCKET[TREASURY_TYPE_COUNT] = {0, 0, 0, 1, 2, 3};
+    double hedge[4] = {0.0, 0.0, 0.0, 0.0};
+    double market_value = 0.0;
+    double duration_value = 0.0;
+    double convexity_value = 0.0;
+    for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+        if (positions[i] == 0) continue;
+        const auto type = static_cast<TreasuryType>(i);
+        const auto& risk = curve_->risk(type);
+        const double face = static_cast<double>(positions[i]);
+        const double value = face * risk.dirty_price / 100.0;
+        market_value += std::abs(value);
+        duration_value += value * risk.modified_duration;
+        convexity_value += value * risk.convexity;
+        hedge[BUCKET[i]] -= face * curve_->hedge_ratio(type, BENCHMARKS[BUCKET[i]]);
+    }
+
+    hedge_ratios_.portfolio_duration = market_value > 0.0 ? duration_value / market_value : 0.0;
+    hedge_ratios_.portfolio_convexity = market_value > 0.0 ? convexity_value / market_value : 0.0;
+    hedge_ratios_.curve_2y_hedge = hedge[0];
+    hedge_ratios_.curve_5y_hedge = hedge[1];
+    hedge_ratios_.curve_10y_hedge = hedge[2];
+    hedge_ratios_.curve_30y_hedge = hedge[3];
     hedge_ratios_.last_calculation_time_ns = timer_.get_timestamp_ns();
+    hedge_curve_version_ = curve_->version();
+    hedge_positions_ = positions;
 }
 
-inline void AdvancedMarketMaker::analyze_inventory(TreasuryType instrument) noexcept {
+// Stub implementations for other methods
+
+inline void AdvancedMarketMaker::analyze_inventory(TreasuryType instrument, uint64_t now_ns) noexcept {
     const auto instrument_index = static_cast<size_t>(instrument);
     if (instrument_index >= MAX_INSTRUMENTS) return;
+    if (now_ns == 0) now_ns = timer_.get_timestamp_ns();
     
     auto& inventory = inventory_states_[instrument_index];
-    inventory.current_position = positions_[instrument_index].load(std::memory_order_relaxed);
+    auto& stats = inventory_stats_[instrument_index];
+    const int64_t position = positions_[instrument_index].load(std::memory_order_relaxed);
+    inventory.current_position = position;
+    
+    // Holding time restarts when the position leaves flat or flips side
+    if (position == 0) {
+        stats.position_open_ns = 0;
+    } else if (stats.position_open_ns == 0 || (position ^ stats.last_position) < 0) {
+        stats.position_open_ns = now_ns;
+    }
+    stats.last_position = position;
+    inventory.time_in_position_seconds = stats.position_open_ns == 0 ? 0 :
+        static_cast<uint32_t>((now_ns - stats.position_open_ns) / 1000000000ULL);
+    
+    // Risk score: RMS of recent inventory relative to the quoting limit
+    const double face = static_cast<double>(position);
+    stats.position_ewma.push(face);
+    stats.position_session.push(face);
+    const double mean = stats.position_ewma.mean();
+    const double recent_rms = std::sqrt(stats.position_ewma.variance() + mean * mean);
+    inventory.inventory_risk = recent_rms / static_cast<double>(position_params_.max_quote_size * 10);
     
     // Simple target: zero position for now
     inventory.target_position = 0;
@@ -0,0 +1,359 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <algorithm>
+#include <span>
+#include "hft/timing/hft_timer.hpp"
+#include "hft/timing/latency_tracer.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+#include "hft/market_data/treasury_instruments.hpp"
+#include "hft/trading/risk_control_system.hpp"
+#include "hft/strategy/multi_strategy_manager.hpp"
+#include "hft/config/system_traits.hpp"
+
+namespace hft {
+namespace strategy {
+
+using namespace hft::market_data;
+using namespace hft::trading;
+
+/**
+ * @brief Quote replacement as written to a venue session
+ *
+ * Replaces the resting bid and ask for one instrument; a zero size pulls
+ * that side, so a cancel is an update with both sizes zero.
+ */
+struct alignas(64) QuoteUpdate {
+    uint64_t sequence = 0;                              // Per-lane sequence (8 bytes)
+    uint64_t tick_time_ns = 0;                          // Triggering tick timestamp (8 bytes)
+    uint64_t send_time_ns = 0;                          // Written to the session (8 bytes)
+    Price32nd bid_price;                                // Bid price (8 bytes)
+    Price32nd ask_price;                                // Ask price (8 bytes)
+    uint64_t bid_size = 0;                              // Bid size, 0 = pull (8 bytes)
+    uint64_t ask_size = 0;                              // Ask size, 0 = pull (8 bytes)
+    TreasuryType instrument;                            // Instrument (1 byte)
+    OrderLifecycleManager::VenueType venue;             // Destination venue (1 byte)
+    uint8_t _pad0[2];                                   // Padding (2 bytes)
+    uint32_t trace_id = 0;                              // Triggering tick's trace, 0 = untraced (4 bytes)
+    // Total: 8+8+8+8+8+8+8+1+1+2+4 = 64 bytes
+};
+static_assert(sizeof(QuoteUpdate) == 64, "QuoteUpdate must be 64 bytes");
+
+/**
+ * @brief Outbound queue of a venue session, drained by its gateway thread
+ */
+using VenueSession = hft::SPSCRingBuffer<QuoteUpdate, 1024>;
+
+/**
+ * @brief Opt-in tick-to-trade fast lane for latency-critical quotes
+ *
+ * The regular path hands each tick through the coordinator, netting, the
+ * full RiskControlSystem check and order lifecycle before anything reaches a
+ * venue. The fast lane is a single-threaded, inlined chain instead: parsed
+ * TreasuryTick -> strategy -> precomputed risk envelope -> quote update
+ * claimed and written in place in the venue session.
+ *
+ * The envelope is a reduced, stricter view of full risk derived from
+ * RiskControlSystem by refresh_envelope(): per-instrument position headroom
+ * on each side (capped at the maximum order size), a price band around the
+ * tick mid, and an on/off switch that is off while an emergency stop or any
+ * circuit breaker is active, or the instrument's volatility is over its
+ * limit. Sizes over headroom are clamped rather than refused.
+ *
+ * Every quote sent is also queued for full risk. run_full_risk() replays the
+ * queue through RiskControlSystem::check_orders() in batches, pulls any quote that
+ * fails, and re-derives the envelope. A pull the full session refuses is
+ * retried on every later pass, and its instrument stays shut until the pull
+ * is in the session. Callers run it right after on_tick()
+ * returns, outside the tick-to-trade window. At most max_unchecked_quotes
+ * updates go out before full risk has caught up.
+ *
+ * Both calls run on the fast lane thread; only the session is shared.
+ * With a tracer set, traced ticks are stamped DECISION after the strategy,
+ * RISK after the envelope and finished at SEND once in the session; an
+ * AdvancedMarketMaker given the same tracer stamps BOOK before DECISION.
+ *
+ * @tparam Strategy Any type with a run_strategy() overload
+ */
+template<typename Strategy>
+class alignas(64) BasicFastLane {
+public:
+    static constexpr size_t MAX_INSTRUMENTS = config::SystemTraits::MAX_INSTRUMENTS;
+    static constexpr size_t FULL_RISK_QUEUE_SIZE = 1024;
+
+    /**
+     * @brief Pre-checked limits for one instrument
+     */
+    struct alignas(64) RiskEnvelope {
+        uint64_t max_bid_size = 0;                      // Bid size full risk would accept
+        uint64_t max_ask_size = 0;                      // Ask size full risk would accept
+        bool enabled = false;                           // Quoting allowed
+    };
+
+    struct Config {
+        OrderLifecycleManager::VenueType venue = OrderLifecycleManager::VenueType::PRIMARY_DEALER;
+        uint32_t max_price_deviation_64ths = 32;        // Quote distance from the tick mid (half a point)
+        uint32_t max_unchecked_quotes = 64;             // Sends allowed before full risk catches up
+    };
+
+    struct Stats {
+        uint64_t ticks = 0;
+        uint64_t quotes_sent = 0;
+        uint64_t quotes_clamped = 0;                    // Sent with a size cut to the envelope
+        uint64_t envelope_rejects = 0;                  // Stopped by the envelope
+        uint64_t session_full = 0;                      // No session slot (quotes dropped, pulls retried)
+        uint64_t full_risk_checks = 0;
+        uint64_t full_risk_rejects = 0;                 // Sent, then pulled by full risk
+    };
+
+    BasicFastLane(Strategy& strategy, RiskControlSystem& risk, VenueSession& session,
+                  const Config& config = Config{}) noexcept
+        : strategy_(strategy), risk_(risk), session_(session), config_(config),
+          envelopes_{}, budget_(0), next_sequence_(1), stats_{}, full_risk_queue_() {
+        config_.max_unchecked_quotes = std::min<uint32_t>(config_.max_unchecked_quotes,
+                                                          FULL_RISK_QUEUE_SIZE - 1);
+        refresh_envelope();
+    }
+
+    // No copy or move semantics
+    BasicFastLane(const BasicFastLane&) = delete;
+    BasicFastLane& operator=(const BasicFastLane&) = delete;
+
+    /**
+     * @brief Turn a parsed tick into a quote update in the venue session
+     * @return true if an update was written
+     */
+    bool on_tick(const TreasuryTick& tick) noexcept {
+        const auto index = static_cast<size_t>(tick.instrument_type);
+        if (__builtin_expect(index >= MAX_INSTRUMENTS, 0)) return false;
+        ++stats_.ticks;
+
+        const RiskEnvelope& envelope = envelopes_[index];
+        if (__builtin_expect(!envelope.enabled || budget_ == 0, 0)) {
+            ++stats_.envelope_rejects;
+            return false;
+        }
+
+        SimpleMarketMaker::MarketUpdate update;
+        update.instrument = tick.instrument_type;
+        update.best_bid = tick.bid_price;
+        update.best_ask = tick.ask_price;
+        update.bid_size = tick.bid_size;
+        update.ask_size = tick.ask_size;
+        update.update_time_ns = tick.timestamp_ns;
+        update.trace_id = tick.trace_id;
+
+        const StrategyQuote quote = run_strategy(strategy_, update);
+        if (quote.action == StrategyQuote::Action::NO_ACTION) return false;
+        if (tracer_) tracer_->stamp(tick.trace_id, TraceStage::DECISION);
+
+        uint64_t bid_size = 0;
+        uint64_t ask_size = 0;
+        if (quote.action == StrategyQuote::Action::UPDATE_QUOTES) {
+            if (__builtin_expect(!within_band(quote, tick), 0)) {
+                ++stats_.envelope_rejects;
+                return false;
+            }
+            bid_size = std::min(quote.bid_size, envelope.max_bid_size);
+            ask_size = std::min(quote.ask_size, envelope.max_ask_size);
+            stats_.quotes_clamped += (bid_size != quote.bid_size || ask_size != quote.ask_size) ? 1 : 0;
+        }
+        if (tracer_) tracer_->stamp(tick.trace_id, TraceStage::RISK);
+
+        const auto slots = session_.claim();
+        if (__builtin_expect(slots.empty(), 0)) {
+            ++stats_.session_full;
+            return false;
+        }
+        QuoteUpdate& out = slots[0];
+        out.sequence = next_sequence_++;
+        out.tick_time_ns = tick.timestamp_ns;
+        out.bid_price = quote.bid_price;
+        out.ask_price = quote.ask_price;
+        out.bid_size = bid_size;
+        out.ask_size = ask_size;
+        out.instrument = tick.instrument_type;
+        out.venue = config_.venue;
+        out.trace_id = tick.trace_id;
+        out.send_time_ns = hft::HFTTimer::get_timestamp_ns();
+        session_.commit();
+        ++stats_.quotes_sent;
+        if (tracer_) (void)tracer_->finish(tick.trace_id, TraceStage::SEND);
+
+        // Pulls only reduce risk; anything that adds exposure is re-checked
+        if (bid_size != 0 || ask_size != 0) {
+            --budget_;
+            (void)full_risk_queue_.try_push(out);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Run full risk on quotes sent since the last call, then refresh the envelope
+     * @return Number of quotes full risk rejected (each pulled from the session)
+     */
+    size_t run_full_risk() noexcept {
+        constexpr size_t BATCH_QUOTES = RiskControlSystem::MAX_BATCH_ORDERS / 2;
+        size_t rejected = 0;
+        std::array<QuoteUpdate, BATCH_QUOTES> sent;
+        std::array<RiskControlSystem::RiskCheckRequest, BATCH_QUOTES * 2> orders;
+        std::array<uint8_t, BATCH_QUOTES * 2> owner;
+
+        retry_pulls();
+
+        // One batch risk pass per up to 32 quotes (both sides)
+        size_t quotes = 0;
+        while ((quotes = drain_full_risk(sent)) != 0) {
+            size_t count = 0;
+            for (size_t q = 0; q < quotes; ++q) {
+                if (sent[q].bid_size != 0) {
+                    orders[count] = {sent[q].instrument, OrderSide::BID, sent[q].bid_size, sent[q].bid_price};
+                    owner[count++] = static_cast<uint8_t>(q);
+                }
+                if (sent[q].ask_size != 0) {
+                    orders[count] = {sent[q].instrument, OrderSide::ASK, sent[q].ask_size, sent[q].ask_price};
+                    owner[count++] = static_cast<uint8_t>(q);
+                }
+            }
+
+            const uint64_t approved = risk_.check_orders(std::span(orders.data(), count));
+            uint64_t failed_quotes = 0;
+            for (size_t i = 0; i < count; ++i) {
+                risk_.record_order_activity();
+                if (!((approved >> i) & 1)) failed_quotes |= 1ULL << owner[i];
+            }
+
+            stats_.full_risk_checks += quotes;
+            while (failed_quotes != 0) {
+                const auto q = static_cast<size_t>(__builtin_ctzll(failed_quotes));
+                failed_quotes &= failed_quotes - 1;
+                ++rejected;
+                const auto index = static_cast<size_t>(sent[q].instrument);
+                pull_owed_[index] = !pull_quotes(sent[q].instrument);
+            }
+        }
+        stats_.full_risk_rejects += rejected;
+        refresh_envelope();
+        return rejected;
+    }
+
+    /**
+     * @brief Re-derive the envelope from current positions and limits
+     */
+    void refresh_envelope() noexcept {
+        const auto& limits = risk_.get_risk_limits();
+        bool halted = !risk_.trading_allowed();
+        if (!risk_.risk_monitor_running()) {
+            halted |= risk_.get_total_pnl() < -limits.max_daily_loss;  // Otherwise a live condition in the word
+        }
+
+        int64_t total_position = 0;
+        for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+            total_position += risk_.get_instrument_risk(static_cast<TreasuryType>(i)).net_position;
+        }
+
+        const int64_t max_order = static_cast<int64_t>(limits.max_order_size);
+        for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+            const auto instrument = static_cast<TreasuryType>(i);
+            const int64_t position = risk_.get_instrument_risk(instrument).net_position;
+            const int64_t bid_room = std::min(limits.max_position_per_instrument - position,
+                                              limits.max_total_position - total_position);
+            const int64_t ask_room = std::min(limits.max_position_per_instrument + position,
+                                              limits.max_total_position + total_position);
+
+            auto& envelope = envelopes_[i];
+            envelope.max_bid_size = static_cast<uint64_t>(std::clamp<int64_t>(bid_room, 0, max_order));
+            envelope.max_ask_size = static_cast<uint64_t>(std::clamp<int64_t>(ask_room, 0, max_order));
+            envelope.enabled = !halted && !pull_owed_[i] &&
+                               risk_.get_volatility(instrument) <= limits.max_price_volatility;
+        }
+        budget_ = config_.max_unchecked_quotes;
+    }
+
+    [[nodiscard]] const RiskEnvelope& envelope(TreasuryType instrument) const noexcept {
+        static const RiskEnvelope closed{};  // Instruments outside this build's universe never quote
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? envelopes_[index] : closed;
+    }
+
+    /** @brief Quotes still allowed before full risk must run */
+    [[nodiscard]] uint32_t unchecked_budget() const noexcept { return budget_; }
+
+    [[nodiscard]] size_t pending_full_risk() const noexcept { return full_risk_queue_.size(); }
+
+    /** @brief Full risk failed a quote whose pull has not reached the session yet */
+    [[nodiscard]] bool pull_pending(TreasuryType instrument) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS && pull_owed_[index];
+    }
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+    [[nodiscard]] Strategy& strategy() noexcept { return strategy_; }
+
+    /** @brief Stamp and finish traced ticks here (nullptr: off); same tracer as the feed handler */
+    void set_tracer(PipelineTracer* tracer) noexcept { tracer_ = tracer; }
+
+private:
+    static int32_t to_64ths(Price32nd price) noexcept {
+        return static_cast<int32_t>(price.whole) * 64 + price.thirty_seconds * 2 + price.half_32nds;
+    }
+
+    // Uncrossed and no further than the configured band from the tick mid
+    bool within_band(const StrategyQuote& quote, const TreasuryTick& tick) const noexcept {
+        const int32_t bid = to_64ths(quote.bid_price);
+        const int32_t ask = to_64ths(quote.ask_price);
+        const int32_t mid_x2 = to_64ths(tick.bid_price) + to_64ths(tick.ask_price);
+        const int32_t band_x2 = static_cast<int32_t>(config_.max_price_deviation_64ths) * 2;
+        return bid < ask && mid_x2 - 2 * bid <= band_x2 && 2 * ask - mid_x2 <= band_x2;
+    }
+
+    template<size_t N>
+    size_t drain_full_risk(std::array<QuoteUpdate, N>& out) noexcept {
+        size_t count = 0;
+        while (count < N && full_risk_queue_.try_pop(out[count])) ++count;
+        return count;
+    }
+
+    // Retry pulls a full session refused; their instruments stay shut until one goes out
+    void retry_pulls() noexcept {
+        for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+            if (pull_owed_[i]) pull_owed_[i] = !pull_quotes(static_cast<TreasuryType>(i));
+        }
+    }
+
+    bool pull_quotes(TreasuryType instrument) noexcept {
+        const auto slots = session_.claim();
+        if (slots.empty()) {
+            ++stats_.session_full;
+            return false;
+        }
+        QuoteUpdate& out = slots[0];
+        out = QuoteUpdate{};
+        out.sequence = next_sequence_++;
+        out.instrument = instrument;
+        out.venue = config_.venue;
+        out.send_time_ns = hft::HFTTimer::get_timestamp_ns();
+        session_.commit();
+        return true;
+    }
+
+    Strategy& strategy_;
+    RiskControlSystem& risk_;
+    VenueSession& session_;
+    Config config_;
+
+    alignas(64) std::array<RiskEnvelope, MAX_INSTRUMENTS> envelopes_;
+    uint32_t budget_;
+    uint64_t next_sequence_;
+    Stats stats_;
+    PipelineTracer* tracer_ = nullptr;
+    std::array<bool, MAX_INSTRUMENTS> pull_owed_{};     // Full risk failed, pull not yet in the session
+
+    alignas(64) hft::SPSCRingBuffer<QuoteUpdate, FULL_RISK_QUEUE_SIZE> full_risk_queue_;
+};
+
+using FastLane = BasicFastLane<SimpleMarketMaker>;
+
+} // namespace strategy
+} // namespace hft
@@ -5,35 +5,140 @@
 #include <array>
 #include <atomic>
 #include <memory>
+#include <tuple>
+#include <utility>
 #include "hft/timing/hft_timer.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
 #include "hft/market_data/treasury_instruments.hpp"
 #include "hft/strategy/simple_market_maker.hpp"
+#include "hft/strategy/advanced_market_maker.hpp"
+#include "hft/config/system_traits.hpp"
 
 namespace hft {
 namespace strategy {
 
 using namespace hft::market_data;
 
+/**
+ * @brief Quote decision common to every strategy type a manager can host
+ *
+ * Each hosted type provides a run_strategy() overload, resolved at compile
+ * time, that adapts the shared MarketUpdate to its own input and its
+ * decision to this form.
+ */
+struct StrategyQuote {
+    enum class Action : uint8_t {
+        NO_ACTION = 0,
+        UPDATE_QUOTES = 1,
+        CANCEL_QUOTES = 2
+    };
+    
+    Action action = Action::NO_ACTION;
+    TreasuryType instrument;
+    Price32nd bid_price;
+    Price32nd ask_price;
+    uint64_t bid_size = 0;
+    uint64_t ask_size = 0;
+};
+
+/** @brief Simple market maker decision in common form */
+inline StrategyQuote to_strategy_quote(const SimpleMarketMaker::TradingDecision& decision) noexcept {
+    StrategyQuote quote{};
+    quote.instrument = decision.instrument;
+    switch (decision.action) {
+        case SimpleMarketMaker::TradingDecision::Action::UPDATE_QUOTES:
+            quote.action = StrategyQuote::Action::UPDATE_QUOTES;
+            quote.bid_price = decision.bid_price;
+            quote.ask_price = decision.ask_price;
+            quote.bid_size = decision.bid_size;
+            quote.ask_size = decision.ask_size;
+            break;
+        case SimpleMarketMaker::TradingDecision::Action::CANCEL_QUOTES:
+            quote.action = StrategyQuote::Action::CANCEL_QUOTES;
+            break;
+        default:
+            break;
+    }
+    return quote;
+}
+
+/**
+ * @brief Advanced market maker decision in common form
+ *
+ * Aggressive and rebalance decisions are not quotes; they surface as NO_ACTION.
+ */
+inline StrategyQuote to_strategy_quote(const AdvancedMarketMaker::TradingDecision& decision) noexcept {
+    StrategyQuote quote{};
+    quote.instrument = decision.instrument;
+    switch (decision.action) {
+        case AdvancedMarketMaker::TradingDecision::Action::UPDATE_QUOTES:
+            quote.action = StrategyQuote::Action::UPDATE_QUOTES;
+            quote.bid_price = decision.bid_price;
+            quote.ask_price = decision.ask_price;
+            quote.bid_size = decision.bid_size;
+            quote.ask_size = decision.ask_size;
+            break;
+        case AdvancedMarketMaker::TradingDecision::Action::CANCEL_QUOTES:
+            quote.action = StrategyQuote::Action::CANCEL_QUOTES;
+            break;
+        default:
+            break;
+    }
+    return quote;
+}
+
+inline StrategyQuote run_strategy(SimpleMarketMaker& strategy, const SimpleMarketMaker::MarketUpdate& update) noexcept {
+    return to_strategy_quote(strategy.make_decision(update));
+}
+
+/**
+ * @brief Advanced market maker on top-of-book input (depth level 0 only)
+ */
+inline StrategyQuote run_strategy(AdvancedMarketMaker& strategy, const SimpleMarketMaker::MarketUpdate& update) noexcept {
+    AdvancedMarketMaker::MarketUpdate advanced{};
+    advanced.instrument = update.instrument;
+    advanced.best_bid = update.best_bid;
+    advanced.best_ask = update.best_ask;
+    advanced.bid_size = update.bid_size;
+    advanced.ask_size = update.ask_size;
+    advanced.bid_levels[0] = update.best_bid;
+    advanced.ask_levels[0] = update.best_ask;
+    advanced.bid_sizes[0] = update.bid_size;
+    advanced.ask_sizes[0] = update.ask_size;
+    advanced.update_time_ns = update.update_time_ns;
+    advanced.trace_id = update.trace_id;
+
+    return to_strategy_quote(strategy.make_decision(advanced));
+}
+
 /**
  * @brief Multi-strategy management with sub-100ns coordination
  * 
- * Manages multiple SimpleMarketMaker strategies with:
+ * Manages a fixed, statically typed set of strategies with:
  * - Priority-based execution order
  * - Resource allocation per strategy  
  * - Cross-strategy position netting
  * - Performance monitoring
  * 
+ * Strategies live in place in one tuple, each in a cache-aligned slot
+ * holding its config ahead of its state: no heap indirection per tick and
+ * no virtual calls. Types may be mixed (any type with a run_strategy()
+ * overload and the position/risk getters); dispatch is unrolled over the
+ * index sequence as in StrategyCoordinator.
+ * 
  * Performance targets:
  * - Strategy coordination: <100ns overhead
  * - Strategy dispatch: <50ns per strategy
  * - Position netting: <200ns total
  */
-class alignas(64) MultiStrategyManager {
+template<typename... StrategyTypes>
+class alignas(64) BasicMultiStrategyManager {
+    static_assert(sizeof...(StrategyTypes) > 0, "At least one strategy is required");
+    
 public:
-    static constexpr size_t MAX_STRATEGIES = 4;
-    static constexpr size_t MAX_INSTRUMENTS = 6;
+    static constexpr size_t MAX_STRATEGIES = sizeof...(StrategyTypes);
+    static constexpr size_t MAX_INSTRUMENTS = config::SystemTraits::MAX_INSTRUMENTS;
     
     // Strategy execution result
     struct alignas(64) StrategyResult {
@@ -50,7 +155,7 @@ public:
         uint8_t _pad0[5];                               // 5 bytes padding
         TreasuryType instrument;                        // 1 byte
         uint8_t _pad1[3];                               // 3 bytes padding
-        uint32_t _reserved = 0;                         // 4 bytes
+        uint32_t trace_id = 0;                          // 4 bytes (from the MarketUpdate)
         Price32nd bid_price;                            // 8 bytes
         Price32nd ask_price;                            // 8 bytes
         uint64_t bid_size = 0;                          // 8 bytes
@@ -92,16 +197,16 @@ public:
     /**
      * @brief Constructor with infrastructure dependencies
      */
-    MultiStrategyManager(
-        hft::ObjectPool<TreasuryOrder, 4096>& order_pool,
-        hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>& level_pool,
-        hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer,
+    BasicMultiStrategyManager(
+        TreasuryOrderPool& order_pool,
+        PriceLevelPool& level_pool,
+        OrderBookUpdateBuffer& update_buffer,
         TreasuryOrderBook& order_book
     ) noexcept;
     
     // No copy or move semantics
-    MultiStrategyManager(const MultiStrategyManager&) = delete;
-    MultiStrategyManager& operator=(const MultiStrategyManager&) = delete;
+    BasicMultiStrategyManager(const BasicMultiStrategyManager&) = delete;
+    BasicMultiStrategyManager& operator=(const BasicMultiStrategyManager&) = delete;
     
     /**
      * @brief Coordinate all active strategies for market update
@@ -114,7 +219,7 @@ public:
     
     /**
      * @brief Update strategy configuration
-     * @param strategy_id Strategy index (0-3)
+     * @param strategy_id Strategy index (0-based)
      * @param config New configuration
      * @return true if successful
      */
@@ -142,6 +247,15 @@ public:
         return coordination_count_ > 0 ? total_coordination_time_ns_ / coordination_count_ : 0;
     }
     
+    /**
+     * @brief Typed access to strategy I (compile-time index)
+     */
+    template<std::size_t I>
+    [[nodiscard]] auto& strategy() noexcept { return std::get<I>(slots_).strategy; }
+    
+    template<std::size_t I>
+    [[nodiscard]] const auto& strategy() const noexcept { return std::get<I>(slots_).strategy; }
+    
     /**
      * @brief Emergency stop all strategies
      */
@@ -154,18 +268,30 @@ public:
     void update_position_netting(TreasuryType instrument) noexcept;
 
 private:
+    // One cache-aligned block per strategy: config (read every tick) ahead of state
+    template<typename Strategy>
+    struct alignas(64) StrategySlot {
+        struct Context {
+            TreasuryOrderPool& order_pool;
+            TreasuryOrderBook& order_book;
+        };
+        
+        explicit StrategySlot(const Context& context) noexcept
+            : config(), strategy(context.order_pool, context.order_book) {}
+        
+        StrategyConfig config;
+        Strategy strategy;
+    };
+    
     // Infrastructure references
-    alignas(64) hft::ObjectPool<TreasuryOrder, 4096>& order_pool_;
-    alignas(64) hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>& level_pool_;
-    alignas(64) hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer_;
+    alignas(64) TreasuryOrderPool& order_pool_;
+    alignas(64) PriceLevelPool& level_pool_;
+    alignas(64) OrderBookUpdateBuffer& update_buffer_;
     alignas(64) TreasuryOrderBook& order_book_;
     alignas(64) hft::HFTTimer timer_;
     
-    // Strategy instances (fixed size for performance)
-    alignas(64) std::array<std::unique_ptr<SimpleMarketMaker>, MAX_STRATEGIES> strategies_;
-    
-    // Strategy configurations
-    alignas(64) std::array<StrategyConfig, MAX_STRATEGIES> strategy_configs_;
+    // Strategy instances with their configs, in place
+    alignas(64) std::tuple<StrategySlot<StrategyTypes>...> slots_;
     
     // Cross-strategy position tracking
     alignas(64) std::array<NetPosition, MAX_INSTRUMENTS> net_positions_;
@@ -174,17 +300,45 @@ private:
     alignas(64) std::atomic<uint64_t> coordination_count_;
     alignas(64) std::atomic<uint64_t> total_coordination_time_ns_;
     
+    template<typename Fn, std::size_t... Is>
+    void for_each_slot(Fn&& fn, std::index_sequence<Is...>) noexcept {
+        (fn(std::integral_constant<std::size_t, Is>{}, std::get<Is>(slots_)), ...);
+    }
+    
+    template<typename Fn>
+    void for_each_slot(Fn&& fn) noexcept {
+        for_each_slot(std::forward<Fn>(fn), std::index_sequence_for<StrategyTypes...>{});
+    }
+    
+    // Configs by runtime id (pointers into the slots)
+    std::array<StrategyConfig*, MAX_STRATEGIES> configs_;
+    
     // Helper methods
+    void update_position_netting(TreasuryType instrument, uint64_t now_ns) noexcept;
     void sort_results_by_priority(std::array<StrategyResult, MAX_STRATEGIES>& results) noexcept;
     bool check_cross_strategy_risk_limits(const StrategyResult& result) noexcept;
+    
+    template<std::size_t I = 0>
+    uint32_t risk_score(uint8_t strategy_id, TreasuryType instrument) noexcept {
+        if constexpr (I < MAX_STRATEGIES) {
+            return strategy_id == I ? std::get<I>(slots_).strategy.get_risk_score(instrument)
+                                    : risk_score<I + 1>(strategy_id, instrument);
+        } else {
+            return 0;
+        }
+    }
 };
 
+/** @brief Four SimpleMarketMaker strategies (the original fixed configuration) */
+using MultiStrategyManager = BasicMultiStrategyManager<SimpleMarketMaker, SimpleMarketMaker, SimpleMarketMaker, SimpleMarketMaker>;
+
 // Implementation
 
-inline MultiStrategyManager::MultiStrategyManager(
-    hft::ObjectPool<TreasuryOrder, 4096>& order_pool,
-    hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>& level_pool,
-    hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer,
+template<typename... StrategyTypes>
+inline BasicMultiStrategyManager<StrategyTypes...>::BasicMultiStrategyManager(
+    TreasuryOrderPool& order_pool,
+    PriceLevelPool& level_pool,
+    OrderBookUpdateBuffer& update_buffer,
     TreasuryOrderBook& order_book
 ) noexcept
     : order_pool_(order_pool),
@@ -192,17 +346,17 @@ inline MultiStrategyManager::MultiStrategyManager(
       update_buffer_(update_buffer),
       order_book_(order_book),
       timer_(),
-      strategies_{},
-      strategy_configs_{},
+      slots_(typename StrategySlot<StrategyTypes>::Context{order_pool, order_book}...),
       net_positions_{},
       coordination_count_(0),
-      total_coordination_time_ns_(0) {
+      total_coordination_time_ns_(0),
+      configs_{} {
     
-    // Initialize strategies
-    for (size_t i = 0; i < MAX_STRATEGIES; ++i) {
-        strategies_[i] = std::make_unique<SimpleMarketMaker>(order_pool_, order_book_);
-        strategy_configs_[i] = StrategyConfig(static_cast<uint8_t>(i));
-    }
+    // Default priorities follow the strategy index
+    for_each_slot([this](auto index, auto& slot) noexcept {
+        slot.config = StrategyConfig(static_cast<uint8_t>(index.value));
+        configs_[index.value] = &slot.config;
+    });
     
     // Initialize net positions
     for (auto& pos : net_positions_) {
@@ -214,53 +368,53 @@ inline MultiStrategyManager::MultiStrategyManager(
     }
 }
 
-inline std::array<MultiStrategyManager::StrategyResult, MultiStrategyManager::MAX_STRATEGIES>
-MultiStrategyManager::coordinate_strategies(
+template<typename... StrategyTypes>
+inline std::array<typename BasicMultiStrategyManager<StrategyTypes...>::StrategyResult,
+                  BasicMultiStrategyManager<StrategyTypes...>::MAX_STRATEGIES>
+BasicMultiStrategyManager<StrategyTypes...>::coordinate_strategies(
     const SimpleMarketMaker::MarketUpdate& update
 ) noexcept {
     const auto coordination_start = timer_.get_timestamp_ns();
     
     std::array<StrategyResult, MAX_STRATEGIES> results;
     
-    // Execute each strategy
-    for (size_t i = 0; i < MAX_STRATEGIES; ++i) {
-        const auto start_time = timer_.get_timestamp_ns();
+    // Execute each strategy (unrolled; one timestamp per strategy boundary)
+    uint64_t clock = coordination_start;
+    for_each_slot([&](auto index, auto& slot) noexcept {
+        auto& result = results[index.value];
+        const auto& config = slot.config;
+        result.strategy_id = static_cast<uint8_t>(index.value);
+        result.priority = config.priority;
+        result.trace_id = update.trace_id;
         
-        auto& result = results[i];
-        result.strategy_id = static_cast<uint8_t>(i);
-        result.priority = strategy_configs_[i].priority;
-        
-        if (!strategy_configs_[i].enabled) {
+        if (config.enabled) {
+            const StrategyQuote quote = run_strategy(slot.strategy, update);
+            result.instrument = quote.instrument;
+            switch (quote.action) {
+                case StrategyQuote::Action::UPDATE_QUOTES:
+                    result.action = StrategyResult::Action::UPDATE_QUOTES;
+                    result.bid_price = quote.bid_price;
+                    result.ask_price = quote.ask_price;
+                    result.bid_size = static_cast<uint64_t>(quote.bid_size * config.resource_allocation);
+                    result.ask_size = static_cast<uint64_t>(quote.ask_size * config.resource_allocation);
+                    break;
+                    
+                case StrategyQuote::Action::CANCEL_QUOTES:
+                    result.action = StrategyResult::Action::CANCEL_QUOTES;
+                    break;
+                    
+                default:
+                    result.action = StrategyResult::Action::NO_ACTION;
+                    break;
+            }
+        } else {
             result.action = StrategyResult::Action::NO_ACTION;
-            result.execution_time_ns = timer_.get_timestamp_ns() - start_time;
-            continue;
         }
         
-        // Execute strategy decision
-        auto decision = strategies_[i]->make_decision(update);
-        
-        // Convert to coordination result
-        result.instrument = decision.instrument;
-        switch (decision.action) {
-            case SimpleMarketMaker::TradingDecision::Action::UPDATE_QUOTES:
-                result.action = StrategyResult::Action::UPDATE_QUOTES;
-                result.bid_price = decision.bid_price;
-                result.ask_price = decision.ask_price;
-                result.bid_size = static_cast<uint64_t>(decision.bid_size * strategy_configs_[i].resource_allocation);
-                result.ask_size = static_cast<uint64_t>(decision.ask_size * strategy_configs_[i].resource_allocation);
-                break;
-                
-            case SimpleMarketMaker::TradingDecision::Action::CANCEL_QUOTES:
-                result.action = StrategyResult::Action::CANCEL_QUOTES;
-                break;
-                
-            default:
-                result.action = StrategyResult::Action::NO_ACTION;
-                break;
-        }
-        
-        result.execution_time_ns = timer_.get_timestamp_ns() - start_time;
-    }
+        const auto now = timer_.get_timestamp_ns();
+        result.execution_time_ns = now - clock;
+        clock = now;
+    });
     
     // Sort results by priority
     sort_results_by_priority(results);
@@ -272,22 +426,27 @@ MultiStrategyManager::coordinate_strategies(
                 result.action = StrategyResult::Action::RISK_LIMIT_HIT;
             }
         }
-        
-        result.coordination_overhead_ns = timer_.get_timestamp_ns() - coordination_start;
+    }
+    
+    const auto checks_done = timer_.get_timestamp_ns();
+    for (auto& result : results) {
+        result.coordination_overhead_ns = checks_done - coordination_start;
     }
     
     // Update position netting
-    update_position_netting(update.instrument);
+    const auto coordination_end = timer_.get_timestamp_ns();
+    update_position_netting(update.instrument, coordination_end);
     
     // Update performance tracking
-    const auto coordination_time = timer_.get_timestamp_ns() - coordination_start;
+    const auto coordination_time = coordination_end - coordination_start;
     coordination_count_.fetch_add(1, std::memory_order_relaxed);
     total_coordination_time_ns_.fetch_add(coordination_time, std::memory_order_relaxed);
     
     return results;
 }
 
-inline bool MultiStrategyManager::update_strategy_config(
+template<typename... StrategyTypes>
+inline bool BasicMultiStrategyManager<StrategyTypes...>::update_strategy_config(
     uint8_t strategy_id, 
     const StrategyConfig& config
 ) noexcept {
@@ -295,28 +454,40 @@ inline bool MultiStrategyManager::update_strategy_config(
         return false;
     }
     
-    strategy_configs_[strategy_id] = config;
+    *configs_[strategy_id] = config;
     return true;
 }
 
-inline const MultiStrategyManager::StrategyConfig& 
-MultiStrategyManager::get_strategy_config(uint8_t strategy_id) const noexcept {
-    return (strategy_id < MAX_STRATEGIES) ? strategy_configs_[strategy_id] : strategy_configs_[0];
+template<typename... StrategyTypes>
+inline const typename BasicMultiStrategyManager<StrategyTypes...>::StrategyConfig& 
+BasicMultiStrategyManager<StrategyTypes...>::get_strategy_config(uint8_t strategy_id) const noexcept {
+    return *configs_[strategy_id < MAX_STRATEGIES ? strategy_id : 0];
 }
 
-inline const MultiStrategyManager::NetPosition& 
-MultiStrategyManager::get_net_position(TreasuryType instrument) const noexcept {
+template<typename... StrategyTypes>
+inline const typename BasicMultiStrategyManager<StrategyTypes...>::NetPosition& 
+BasicMultiStrategyManager<StrategyTypes...>::get_net_position(TreasuryType instrument) const noexcept {
     const auto index = static_cast<size_t>(instrument);
     return (index < net_positions_.size()) ? net_positions_[index] : net_positions_[0];
 }
 
-inline void MultiStrategyManager::emergency_stop() noexcept {
-    for (auto& config : strategy_configs_) {
-        config.enabled = false;
+template<typename... StrategyTypes>
+inline void BasicMultiStrategyManager<StrategyTypes...>::emergency_stop() noexcept {
+    for (auto* config : configs_) {
+        config->enabled = false;
     }
 }
 
-inline void MultiStrategyManager::update_position_netting(TreasuryType instrument) noexcept {
+template<typename... StrategyTypes>
+inline void BasicMultiStrategyManager<StrategyTypes...>::update_position_netting(TreasuryType instrument) noexcept {
+    update_position_netting(instrument, timer_.get_timestamp_ns());
+}
+
+template<typename... StrategyTypes>
+inline void BasicMultiStrategyManager<StrategyTypes...>::update_position_netting(
+    TreasuryType instrument,
+    uint64_t now_ns
+) noexcept {
     const auto instrument_index = static_cast<size_t>(instrument);
     if (instrument_index >= net_positions_.size()) {
         return;
@@ -331,14 +502,14 @@ inline void MultiStrategyManager::update_position_netting(TreasuryType instrumen
     net_pos.active_strategies = 0;
     
     // Aggregate across all strategies
-    for (size_t i = 0; i < MAX_STRATEGIES; ++i) {
-        if (!strategies_[i] || !strategy_configs_[i].enabled) {
-            continue;
+    for_each_slot([&](auto, auto& slot) noexcept {
+        if (!slot.config.enabled) {
+            return;
         }
         
-        const int64_t position = strategies_[i]->get_position(instrument);
-        const double unrealized_pnl = strategies_[i]->get_unrealized_pnl(instrument);
-        const double daily_pnl = strategies_[i]->get_daily_pnl(instrument);
+        const int64_t position = slot.strategy.get_position(instrument);
+        const double unrealized_pnl = slot.strategy.get_unrealized_pnl(instrument);
+        const double daily_pnl = slot.strategy.get_daily_pnl(instrument);
         
         net_pos.total_position += position;
         net_pos.total_unrealized_pnl += unrealized_pnl;
@@ -347,12 +518,13 @@ inline void MultiStrategyManager::update_position_netting(TreasuryType instrumen
         if (std::abs(position) > 1000) { // Minimum position threshold
             ++net_pos.active_strategies;
         }
-    }
+    });
     
-    net_pos.last_update_time_ns = timer_.get_timestamp_ns();
+    net_pos.last_update_time_ns = now_ns;
 }
 
-inline void MultiStrategyManager::sort_results_by_priority(
+template<typename... StrategyTypes>
+inline void BasicMultiStrategyManager<StrategyTypes...>::sort_results_by_priority(
     std::array<StrategyResult, MAX_STRATEGIES>& results
 ) noexcept {
     // Simple insertion sort for small fixed array
@@ -369,7 +541,8 @@ inline void MultiStrategyManager::sort_results_by_priority(
     }
 }
 
-inline bool MultiStrategyManager::check_cross_strategy_risk_limits(
+template<typename... StrategyTypes>
+inline bool BasicMultiStrategyManager<StrategyTypes...>::check_cross_strategy_risk_limits(
     const StrategyResult& result
 ) noexcept {
     const auto& net_pos = get_net_position(result.instrument);
@@ -384,9 +557,8 @@ inline bool MultiStrategyManager::check_cross_strategy_risk_limits(
     }
     
     // Check strategy-specific risk score
-    if (result.strategy_id < MAX_STRATEGIES && strategies_[result.strategy_id]) {
-        const uint32_t risk_score = strategies_[result.strategy_id]->get_risk_score(result.instrument);
-        if (risk_score > config.risk_score_limit) {
+    if (result.strategy_id < MAX_STRATEGIES) {
+        if (risk_score(result.strategy_id, result.instrument) > config.risk_score_limit) {
             return false;
         }
     }
@@ -398,4 +570,4 @@ inline bool MultiStrategyManager::check_cross_strategy_risk_limits(
 static_assert(alignof(MultiStrategyManager) == 64, "MultiStrategyManager must be cache-aligned");
 
 } // namespace strategy
-} // namespace hft
\ No newline at end of file
+} // namespace hft
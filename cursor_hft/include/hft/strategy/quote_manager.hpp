@@ -0,0 +1,329 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include "hft/market_data/treasury_instruments.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+#include "hft/strategy/multi_strategy_manager.hpp"
+#include "hft/config/system_traits.hpp"
+
+namespace hft {
+namespace strategy {
+
+using namespace hft::market_data;
+using namespace hft::trading;
+
+/**
+ * @brief Working-quote state and minimal amend generation for market makers
+ *
+ * Both market makers emit a full two-sided decision on every update, most of
+ * which restate the quotes already working. QuoteManager keeps the working
+ * bid and ask per instrument and turns each decision into the smallest set
+ * of side-level NEW / AMEND / CANCEL messages:
+ * - price moves within price_tolerance_32nds and size changes within
+ *   size_tolerance leave the working side alone
+ * - a side amended less than coalesce_window_ns ago holds the latest target
+ *   as pending; it goes out on the first decision or flush() after the window
+ * - pulls (CANCEL_QUOTES, zero size) bypass the window, they only reduce risk
+ *
+ * apply() drives OrderLifecycleManager with an amend set and tracks the
+ * order id working on each side. A message the manager refuses (rate limit,
+ * order not amendable) restores the side's last confirmed price and size
+ * and keeps the target pending, so the next decision or flush() retries it.
+ * Decisions come in through to_strategy_quote() or run_strategy() for
+ * either market maker.
+ *
+ * Single-threaded: owned by the thread that runs the strategy.
+ */
+class alignas(64) QuoteManager {
+public:
+    static constexpr size_t MAX_INSTRUMENTS = config::SystemTraits::MAX_INSTRUMENTS;
+
+    struct Config {
+        uint32_t price_tolerance_32nds = 0;             // Price moves kept without an amend (0 = any move amends)
+        uint64_t size_tolerance = 0;                    // Size changes kept without an amend
+        uint64_t coalesce_window_ns = 0;                // Minimum spacing of amends per side (0 = off)
+        uint8_t strategy_id = 0;                        // Rate limit bucket for new orders
+        OrderLifecycleManager::VenueType venue = OrderLifecycleManager::VenueType::PRIMARY_DEALER;
+    };
+
+    enum class AmendType : uint8_t {
+        NONE = 0,
+        NEW = 1,
+        AMEND = 2,
+        CANCEL = 3
+    };
+
+    struct SideAmend {
+        AmendType type = AmendType::NONE;
+        Price32nd price{};
+        uint64_t size = 0;
+    };
+
+    /**
+     * @brief Messages owed to the venue for one instrument
+     */
+    struct QuoteAmend {
+        TreasuryType instrument = TreasuryType::Bill_3M;
+        SideAmend bid;
+        SideAmend ask;
+
+        [[nodiscard]] size_t count() const noexcept {
+            return (bid.type != AmendType::NONE ? 1 : 0) + (ask.type != AmendType::NONE ? 1 : 0);
+        }
+        [[nodiscard]] bool empty() const noexcept { return count() == 0; }
+    };
+
+    /**
+     * @brief Working and pending state of one side
+     */
+    struct WorkingSide {
+        Price32nd price{};                              // Working price
+        uint64_t size = 0;                              // Working size
+        uint64_t order_id = 0;                          // OrderLifecycleManager id, 0 before apply()
+        uint64_t last_amend_ns = 0;                     // Last message sent for this side
+        Price32nd pending_price{};                      // Held target while coalescing or after a refusal
+        uint64_t pending_size = 0;                      // 0 with has_pending: a pull to retry
+        Price32nd prev_price{};                         // Working quote before the last message,
+        uint64_t prev_size = 0;                         // restored if apply() is refused
+        bool live = false;                              // A quote is working
+        bool has_pending = false;
+    };
+
+    struct alignas(64) WorkingQuote {
+        WorkingSide bid;
+        WorkingSide ask;
+    };
+
+    struct Stats {
+        uint64_t decisions = 0;
+        uint64_t messages = 0;                          // Side-level messages emitted
+        uint64_t suppressed = 0;                        // Sides kept within tolerance
+        uint64_t coalesced = 0;                         // Sides held for the window
+    };
+
+    QuoteManager() noexcept : QuoteManager(Config{}) {}
+    explicit QuoteManager(const Config& config) noexcept
+        : config_(config), working_{}, stats_{} {}
+
+    // No copy (owns working-order state)
+    QuoteManager(const QuoteManager&) = delete;
+    QuoteManager& operator=(const QuoteManager&) = delete;
+
+    /**
+     * @brief Diff a decision against the working quotes
+     * @param quote Strategy decision
+     * @param now_ns Decision time
+     * @return Side messages to send (possibly none)
+     */
+    [[nodiscard]] QuoteAmend on_quote(const StrategyQuote& quote, uint64_t now_ns) noexcept {
+        QuoteAmend amend;
+        amend.instrument = quote.instrument;
+        const auto index = static_cast<size_t>(quote.instrument);
+        if (__builtin_expect(index >= MAX_INSTRUMENTS, 0)) return amend;
+        ++stats_.decisions;
+
+        auto& working = working_[index];
+        switch (quote.action) {
+            case StrategyQuote::Action::UPDATE_QUOTES:
+                amend.bid = diff_side(working.bid, quote.bid_price, quote.bid_size, now_ns);
+                amend.ask = diff_side(working.ask, quote.ask_price, quote.ask_size, now_ns);
+                break;
+            case StrategyQuote::Action::CANCEL_QUOTES:
+                amend.bid = diff_side(working.bid, Price32nd{}, 0, now_ns);
+                amend.ask = diff_side(working.ask, Price32nd{}, 0, now_ns);
+                break;
+            default:
+                amend.bid = release_pending(working.bid, now_ns);
+                amend.ask = release_pending(working.ask, now_ns);
+                break;
+        }
+        return amend;
+    }
+
+    /**
+     * @brief Release held targets whose coalescing window has passed
+     */
+    [[nodiscard]] QuoteAmend flush(TreasuryType instrument, uint64_t now_ns) noexcept {
+        QuoteAmend amend;
+        amend.instrument = instrument;
+        const auto index = static_cast<size_t>(instrument);
+        if (__builtin_expect(index >= MAX_INSTRUMENTS, 0)) return amend;
+        amend.bid = release_pending(working_[index].bid, now_ns);
+        amend.ask = release_pending(working_[index].ask, now_ns);
+        return amend;
+    }
+
+    /**
+     * @brief Send an amend set through the order lifecycle manager
+     * @return Number of messages accepted
+     */
+    size_t apply(const QuoteAmend& amend, OrderLifecycleManager& orders) noexcept {
+        const auto index = static_cast<size_t>(amend.instrument);
+        if (__builtin_expect(index >= MAX_INSTRUMENTS, 0)) return 0;
+        auto& working = working_[index];
+        return apply_side(amend.bid, working.bid, amend.instrument, OrderSide::BID, orders) +
+               apply_side(amend.ask, working.ask, amend.instrument, OrderSide::ASK, orders);
+    }
+
+    /**
+     * @brief A working side left the venue (filled or cancelled there)
+     *
+     * Call once its final report is applied to orders; the order is retired.
+     */
+    void on_side_closed(TreasuryType instrument, OrderSide side, OrderLifecycleManager& orders) noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        if (index >= MAX_INSTRUMENTS) return;
+        auto& working = side == OrderSide::BID ? working_[index].bid : working_[index].ask;
+        if (working.order_id != 0) (void)orders.retire_order(working.order_id);
+        working.live = false;
+        working.size = 0;
+        working.order_id = 0;
+    }
+
+    [[nodiscard]] const WorkingQuote& working(TreasuryType instrument) const noexcept {
+        static const WorkingQuote none{};  // Instruments outside this build's universe
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? working_[index] : none;
+    }
+
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+    [[nodiscard]] const Config& config() const noexcept { return config_; }
+
+private:
+    static int32_t to_64ths(Price32nd price) noexcept {
+        return static_cast<int32_t>(price.whole) * 64 + price.thirty_seconds * 2 + price.half_32nds;
+    }
+
+    bool within_tolerance(const WorkingSide& side, Price32nd price, uint64_t size) const noexcept {
+        const int32_t price_move = to_64ths(price) - to_64ths(side.price);
+        const uint64_t size_move = size > side.size ? size - side.size : side.size - size;
+        const auto tolerance_64ths = static_cast<int32_t>(config_.price_tolerance_32nds * 2);
+        return price_move <= tolerance_64ths && -price_move <= tolerance_64ths && size_move <= config_.size_tolerance;
+    }
+
+    SideAmend emit(WorkingSide& side, Price32nd price, uint64_t size, uint64_t now_ns) noexcept {
+        SideAmend out;
+        out.type = side.live ? AmendType::AMEND : AmendType::NEW;
+        out.price = price;
+        out.size = size;
+        side.prev_price = side.price;
+        side.prev_size = side.size;
+        side.price = price;
+        side.size = size;
+        side.live = true;
+        side.has_pending = false;
+        side.last_amend_ns = now_ns;
+        ++stats_.messages;
+        return out;
+    }
+
+    SideAmend pull(WorkingSide& side, uint64_t now_ns) noexcept {
+        side.has_pending = false;
+        if (!side.live) return SideAmend{};
+        SideAmend out;
+        out.type = AmendType::CANCEL;
+        out.price = side.price;
+        side.prev_price = side.price;
+        side.prev_size = side.size;
+        side.live = false;
+        side.size = 0;
+        side.last_amend_ns = now_ns;
+        ++stats_.messages;
+        return out;
+    }
+
+    SideAmend diff_side(WorkingSide& side, Price32nd price, uint64_t size, uint64_t now_ns) noexcept {
+        if (size == 0) {
+            return pull(side, now_ns);
+        }
+
+        if (side.live && within_tolerance(side, price, size)) {
+            side.has_pending = false;
+            ++stats_.suppressed;
+            return SideAmend{};
+        }
+
+        if (config_.coalesce_window_ns != 0 && side.last_amend_ns != 0 &&
+            now_ns - side.last_amend_ns < config_.coalesce_window_ns) {
+            side.pending_price = price;
+            side.pending_size = size;
+            side.has_pending = true;
+            ++stats_.coalesced;
+            return SideAmend{};
+        }
+
+        return emit(side, price, size, now_ns);
+    }
+
+    SideAmend release_pending(WorkingSide& side, uint64_t now_ns) noexcept {
+        if (!side.has_pending) return SideAmend{};
+        if (side.pending_size == 0) return pull(side, now_ns);  // Pulls bypass the window
+        if (now_ns - side.last_amend_ns < config_.coalesce_window_ns) return SideAmend{};
+        return emit(side, side.pending_price, side.pending_size, now_ns);
+    }
+
+    static bool open_at_venue(const OrderLifecycleManager& orders, uint64_t order_id) noexcept {
+        const auto* order = orders.get_order(order_id);
+        if (order == nullptr) return false;
+        switch (order->state) {
+            case OrderLifecycleManager::OrderState::FILLED:
+            case OrderLifecycleManager::OrderState::PENDING_CANCEL:
+            case OrderLifecycleManager::OrderState::CANCELLED:
+            case OrderLifecycleManager::OrderState::REJECTED:
+            case OrderLifecycleManager::OrderState::EXPIRED:
+                return false;
+            default:
+                return true;
+        }
+    }
+
+    size_t apply_side(const SideAmend& amend, WorkingSide& side, TreasuryType instrument,
+                      OrderSide order_side, OrderLifecycleManager& orders) noexcept {
+        switch (amend.type) {
+            case AmendType::NEW:
+                side.order_id = orders.create_order(instrument, order_side, OrderType::LIMIT, amend.price, amend.size,
+                                                    OrderLifecycleManager::TimeInForce::DAY, config_.strategy_id,
+                                                    config_.venue);
+                if (side.order_id != 0) return 1;
+                break;
+            case AmendType::AMEND:
+                if (orders.modify_order(side.order_id, amend.price, amend.size)) return 1;
+                break;
+            case AmendType::CANCEL:
+                if (orders.cancel_order(side.order_id)) {
+                    side.order_id = 0;
+                    return 1;
+                }
+                break;
+            default:
+                return 0;
+        }
+
+        // Refused. An order already gone or being pulled leaves nothing to retry
+        if (amend.type != AmendType::NEW && !open_at_venue(orders, side.order_id)) {
+            (void)orders.retire_order(side.order_id);  // Frees the slot if it ended at the venue
+            side.live = false;
+            side.size = 0;
+            side.order_id = 0;
+            side.has_pending = false;
+            return 0;
+        }
+        // Otherwise the venue still has what it had before: restore it and retry the target
+        side.live = side.order_id != 0;
+        side.price = side.prev_price;
+        side.size = side.prev_size;
+        side.pending_price = amend.price;
+        side.pending_size = amend.type == AmendType::CANCEL ? 0 : amend.size;
+        side.has_pending = true;
+        return 0;
+    }
+
+    Config config_;
+    alignas(64) std::array<WorkingQuote, MAX_INSTRUMENTS> working_;
+    Stats stats_;
+};
+
+} // namespace strategy
+} // namespace hft
@@ -62,7 +62,8 @@ public:
         uint64_t ask_size = 0;                          // 8 bytes
         uint64_t decision_latency_ns = 0;               // 8 bytes
         uint64_t decision_time_ns = 0;                  // 8 bytes
-        uint8_t _pad2[8];                               // 8 bytes padding (total: 64)
+        uint32_t trace_id = 0;                          // 4 bytes (LatencyTracer ID, 0 = untraced)
+        uint8_t _pad2[4];                               // 4 bytes padding (total: 64)
         
         TradingDecision() noexcept : _pad0{}, _pad1{}, _pad2{} {}
     };
@@ -76,6 +77,7 @@ public:
         uint64_t bid_size;
         uint64_t ask_size;
         uint64_t update_time_ns;
+        uint32_t trace_id = 0;                          // Carried into TradingDecision
         
         MarketUpdate() noexcept = default;
         MarketUpdate(TreasuryType inst, Price32nd bid, Price32nd ask, 
@@ -91,7 +93,7 @@ public:
      * @param order_book Order book reference for market data
      */
     explicit SimpleMarketMaker(
-        hft::ObjectPool<TreasuryOrder, 4096>& order_pool,
+        TreasuryOrderPool& order_pool,
         TreasuryOrderBook& order_book
     ) noexcept
         : order_pool_(order_pool), order_book_(order_book),
@@ -261,7 +263,7 @@ private:
     static_assert(sizeof(Position) == CACHE_LINE_SIZE, "Position must be 64 bytes");
 
     // Infrastructure references - cache-aligned
-    alignas(CACHE_LINE_SIZE) hft::ObjectPool<TreasuryOrder, 4096>& order_pool_;
+    alignas(CACHE_LINE_SIZE) TreasuryOrderPool& order_pool_;
     alignas(CACHE_LINE_SIZE) TreasuryOrderBook& order_book_;
     alignas(CACHE_LINE_SIZE) hft::HFTTimer timer_;
 
@@ -369,6 +371,7 @@ inline SimpleMarketMaker::TradingDecision SimpleMarketMaker::make_decision(const
     TradingDecision decision;
     decision.instrument = update.instrument;
     decision.decision_time_ns = start_time;
+    decision.trace_id = update.trace_id;
     decision.action = TradingDecision::Action::NO_ACTION;
     
     // Step 1: Basic validation (target: 50ns)
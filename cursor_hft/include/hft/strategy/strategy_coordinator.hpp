@@ -5,12 +5,18 @@
 #include <array>
 #include <atomic>
 #include <memory>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include "hft/timing/hft_timer.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
+#include "hft/messaging/broadcast_ring_buffer.hpp"
+#include "hft/messaging/wait_strategy.hpp"
+#include "hft/runtime/thread_topology.hpp"
 #include "hft/market_data/treasury_instruments.hpp"
 #include "hft/strategy/simple_market_maker.hpp"
+#include "hft/config/system_traits.hpp"
 
 namespace hft {
 namespace strategy {
@@ -34,6 +40,16 @@ using namespace hft::market_data;
  * - Template metaprogramming for compile-time optimization
  * - Ring buffer-based messaging for predictable latency
  * 
+ * Execution modes:
+ * - Sequential (default): execute_strategy<I> for each strategy in turn on
+ *   the calling thread; latency grows with strategy count
+ * - Parallel (start_parallel()): strategy I runs on its own worker, pinned
+ *   to a core when one is given. Updates fan out through a broadcast ring;
+ *   each worker returns its result on its own SPSC ring, and the caller
+ *   nets and priority-orders them as before. Latency is the slowest
+ *   strategy plus two ring hops, flat in strategy count while there are
+ *   cores for the workers
+ * 
  * Performance targets:
  * - Strategy coordination: <100ns overhead
  * - Strategy dispatch: <50ns per strategy
@@ -44,8 +60,9 @@ template<typename... StrategyTypes>
 class alignas(64) StrategyCoordinator {
 public:
     static constexpr size_t MAX_STRATEGIES = sizeof...(StrategyTypes);
-    static constexpr size_t MAX_INSTRUMENTS = 6;  // Treasury instrument count
+    static constexpr size_t MAX_INSTRUMENTS = config::SystemTraits::MAX_INSTRUMENTS;
     static constexpr size_t MESSAGE_BUFFER_SIZE = 4096;
+    static constexpr size_t WORKER_RING_SIZE = 64;
     
     // Strategy execution result
     struct alignas(64) StrategyResult {
@@ -63,7 +80,7 @@ public:
         uint8_t _pad0[5];                               // 5 bytes padding
         TreasuryType instrument;                        // 1 byte
         uint8_t _pad1[3];                               // 3 bytes padding  
-        uint32_t _reserved = 0;                         // 4 bytes reserved
+        uint32_t trace_id = 0;                          // 4 bytes (from the MarketUpdate)
         Price32nd bid_price;                            // 8 bytes
         Price32nd ask_price;                            // 8 bytes
         uint64_t bid_size = 0;                          // 8 bytes
@@ -120,7 +137,7 @@ public:
         uint8_t _pad[5];
         uint64_t timestamp_ns;
         
-        union {
+        union Data {
             SimpleMarketMaker::MarketUpdate market_update;
             struct {
                 TreasuryType instrument;
@@ -135,6 +152,8 @@ public:
             } risk_update;
             
             StrategyConfig config_update;
+            
+            Data() noexcept : position_update{} {}
         } data;
         
         CoordinationMessage() noexcept : _pad{} {}
@@ -148,23 +167,21 @@ public:
      * @param order_book Order book reference
      */
     StrategyCoordinator(
-        hft::ObjectPool<TreasuryOrder, 4096>& order_pool,
-        hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>& level_pool,
-        hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer,
+        TreasuryOrderPool& order_pool,
+        PriceLevelPool& level_pool,
+        OrderBookUpdateBuffer& update_buffer,
         TreasuryOrderBook& order_book
     ) noexcept
         : order_pool_(order_pool),
           level_pool_(level_pool),
           update_buffer_(update_buffer),
           order_book_(order_book),
-          message_buffer_(message_buffer_storage_),
+          strategies_(typename StrategySlot<StrategyTypes>::Context{order_pool, order_book}...),
           net_positions_{},
           strategy_configs_{},
           coordination_count_(0),
-          total_coordination_time_ns_(0) {
-        
-        // Initialize strategies using tuple and index sequence
-        init_strategies(std::index_sequence_for<StrategyTypes...>{});
+          total_coordination_time_ns_(0),
+          workers_running_(false) {
         
         // Initialize net positions
         for (auto& pos : net_positions_) {
@@ -179,10 +196,57 @@ public:
         init_strategy_configs(std::index_sequence_for<StrategyTypes...>{});
     }
     
+    ~StrategyCoordinator() { stop_parallel(); }
+    
     // No copy or move semantics for performance
     StrategyCoordinator(const StrategyCoordinator&) = delete;
     StrategyCoordinator& operator=(const StrategyCoordinator&) = delete;
     
+    /**
+     * @brief Switch to parallel execution: one worker thread per strategy
+     * @param cores Core for each strategy's worker; negative leaves it unpinned
+     * @return false if already running
+     *
+     * Not hot path. coordinate_strategies() must not run concurrently with
+     * start_parallel()/stop_parallel().
+     */
+    bool start_parallel(const std::array<int, MAX_STRATEGIES>& cores) noexcept {
+        if (workers_running_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        for (auto& consumer : update_consumers_) {
+            consumer = update_ring_.subscribe();
+        }
+        workers_running_.store(true, std::memory_order_release);
+        start_workers(cores, std::index_sequence_for<StrategyTypes...>{});
+        return true;
+    }
+    
+    bool start_parallel() noexcept {
+        std::array<int, MAX_STRATEGIES> cores;
+        cores.fill(-1);
+        return start_parallel(cores);
+    }
+    
+    /**
+     * @brief Join the workers and return to sequential execution
+     */
+    void stop_parallel() noexcept {
+        if (!workers_running_.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+        for (auto& worker : workers_) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        for (auto& consumer : update_consumers_) {
+            update_ring_.unsubscribe(consumer);
+        }
+    }
+    
+    [[nodiscard]] bool parallel() const noexcept { return workers_running_.load(std::memory_order_relaxed); }
+    
     /**
      * @brief Coordinate all strategies for a market update
      * @param update Market data update
@@ -237,20 +301,44 @@ public:
      * @param instrument Treasury instrument type
      */
     void update_position_netting(TreasuryType instrument) noexcept;
+    
+    /**
+     * @brief Strategy I itself, e.g. to configure it or apply fills
+     *
+     * Not while running parallel: the strategy belongs to its worker then.
+     */
+    template<std::size_t I>
+    [[nodiscard]] auto& get_strategy() noexcept { return strategy<I>(); }
 
 private:
     // Infrastructure references - cache-aligned
-    alignas(64) hft::ObjectPool<TreasuryOrder, 4096>& order_pool_;
-    alignas(64) hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>& level_pool_;
-    alignas(64) hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer_;
+    alignas(64) TreasuryOrderPool& order_pool_;
+    alignas(64) PriceLevelPool& level_pool_;
+    alignas(64) OrderBookUpdateBuffer& update_buffer_;
     alignas(64) TreasuryOrderBook& order_book_;
     alignas(64) hft::HFTTimer timer_;
     
+    // Strategies are not movable: each is built in place inside a tuple slot
+    template<typename Strategy>
+    struct StrategySlot {
+        struct Context {
+            TreasuryOrderPool& order_pool;
+            TreasuryOrderBook& order_book;
+        };
+        
+        explicit StrategySlot(const Context& context) noexcept
+            : strategy(context.order_pool, context.order_book) {}
+        
+        Strategy strategy;
+    };
+    
     // Strategy instances stored in tuple for type safety
-    std::tuple<StrategyTypes...> strategies_;
+    std::tuple<StrategySlot<StrategyTypes>...> strategies_;
+    
+    template<std::size_t I>
+    auto& strategy() noexcept { return std::get<I>(strategies_).strategy; }
     
     // Inter-strategy communication
-    alignas(64) CoordinationMessage message_buffer_storage_[MESSAGE_BUFFER_SIZE];
     hft::SPSCRingBuffer<CoordinationMessage, MESSAGE_BUFFER_SIZE> message_buffer_;
     
     // Cross-strategy position tracking
@@ -263,10 +351,53 @@ private:
     alignas(64) std::atomic<uint64_t> coordination_count_;
     alignas(64) std::atomic<uint64_t> total_coordination_time_ns_;
     
-    // Template metaprogramming helpers for strategy initialization
+    // Parallel mode: updates out on one broadcast ring, results back per strategy
+    alignas(64) hft::BroadcastRingBuffer<SimpleMarketMaker::MarketUpdate, WORKER_RING_SIZE, MAX_STRATEGIES> update_ring_;
+    std::array<typename hft::BroadcastRingBuffer<SimpleMarketMaker::MarketUpdate, WORKER_RING_SIZE, MAX_STRATEGIES>::Consumer,
+               MAX_STRATEGIES> update_consumers_;
+    std::array<hft::SPSCRingBuffer<StrategyResult, WORKER_RING_SIZE>, MAX_STRATEGIES> result_rings_;
+    std::array<std::thread, MAX_STRATEGIES> workers_;
+    alignas(64) std::atomic<bool> workers_running_;
+    
     template<std::size_t... Is>
-    void init_strategies(std::index_sequence<Is...>) noexcept {
-        ((std::get<Is>(strategies_) = StrategyTypes(order_pool_, order_book_)), ...);
+    void start_workers(const std::array<int, MAX_STRATEGIES>& cores, std::index_sequence<Is...>) noexcept {
+        ((workers_[Is] = std::thread([this, core = cores[Is]] { worker_loop<Is>(core); })), ...);
+    }
+    
+    // Worker for strategy I: same compile-time dispatch as the sequential path
+    template<std::size_t I>
+    void worker_loop(int core) noexcept {
+        (void)hft::topology::pin_current_thread(core);
+        auto& updates = update_consumers_[I];
+        auto& results = result_rings_[I];
+        hft::SpinYieldWait<> wait;
+        SimpleMarketMaker::MarketUpdate update;
+        while (true) {
+            wait.wait([&] { return !updates.empty() || !workers_running_.load(std::memory_order_acquire); });
+            if (!updates.try_pop(update)) {
+                return;  // Stopped with nothing pending
+            }
+            uint64_t clock = timer_.get_timestamp_ns();
+            const StrategyResult result = execute_strategy<I>(update, clock);
+            while (!results.try_push(result)) {
+                hft::cpu_relax();
+            }
+        }
+    }
+    
+    // Publish to every worker and collect one result from each, in strategy order
+    void execute_all_strategies_parallel(
+        const SimpleMarketMaker::MarketUpdate& update,
+        std::array<StrategyResult, MAX_STRATEGIES>& results
+    ) noexcept {
+        while (!update_ring_.try_push(update)) {
+            hft::cpu_relax();
+        }
+        hft::SpinYieldWait<> wait;
+        for (size_t i = 0; i < MAX_STRATEGIES; ++i) {
+            auto& ring = result_rings_[i];
+            wait.wait([&] { return ring.try_pop(results[i]); });
+        }
     }
     
     template<std::size_t... Is>
@@ -274,22 +405,25 @@ private:
         ((strategy_configs_[Is] = StrategyConfig(static_cast<uint8_t>(Is))), ...);
     }
     
-    // Template-based strategy execution
+    // Template-based strategy execution. `clock` is the start time on entry and the
+    // end time on return, so back-to-back strategies share one timestamp per boundary
     template<std::size_t I>
-    StrategyResult execute_strategy(const SimpleMarketMaker::MarketUpdate& update) noexcept {
+    StrategyResult execute_strategy(const SimpleMarketMaker::MarketUpdate& update, uint64_t& clock) noexcept {
         if constexpr (I < MAX_STRATEGIES) {
-            const auto start_time = timer_.get_timestamp_ns();
+            const auto start_time = clock;
             
-            auto& strategy = std::get<I>(strategies_);
+            auto& strategy = this->strategy<I>();
             const auto& config = strategy_configs_[I];
             
             StrategyResult result;
             result.strategy_id = static_cast<uint8_t>(I);
             result.priority = config.priority;
+            result.trace_id = update.trace_id;
             
             if (!config.enabled) {
                 result.action = StrategyResult::Action::NO_ACTION;
-                result.execution_time_ns = timer_.get_timestamp_ns() - start_time;
+                clock = timer_.get_timestamp_ns();
+                result.execution_time_ns = clock - start_time;
                 return result;
             }
             
@@ -317,7 +451,8 @@ private:
                     break;
             }
             
-            result.execution_time_ns = timer_.get_timestamp_ns() - start_time;
+            clock = timer_.get_timestamp_ns();
+            result.execution_time_ns = clock - start_time;
             return result;
         } else {
             return StrategyResult{};
@@ -328,14 +463,17 @@ private:
     template<std::size_t I = 0>
     void execute_all_strategies(
         const SimpleMarketMaker::MarketUpdate& update,
-        std::array<StrategyResult, MAX_STRATEGIES>& results
+        std::array<StrategyResult, MAX_STRATEGIES>& results,
+        uint64_t& clock
     ) noexcept {
         if constexpr (I < MAX_STRATEGIES) {
-            results[I] = execute_strategy<I>(update);
-            execute_all_strategies<I + 1>(update, results);
+            results[I] = execute_strategy<I>(update, clock);
+            execute_all_strategies<I + 1>(update, results, clock);
         }
     }
     
+    void update_position_netting(TreasuryType instrument, uint64_t now_ns) noexcept;
+    
     // Sort results by priority (stable sort to maintain order for same priority)
     void sort_results_by_priority(std::array<StrategyResult, MAX_STRATEGIES>& results) noexcept;
     
@@ -362,8 +500,13 @@ StrategyCoordinator<StrategyTypes...>::coordinate_strategies(
     
     std::array<StrategyResult, MAX_STRATEGIES> results;
     
-    // Execute all strategies in parallel (template unrolling)
-    execute_all_strategies(update, results);
+    // Execute all strategies: on their workers in parallel mode, else inline (template unrolling)
+    if (workers_running_.load(std::memory_order_relaxed)) {
+        execute_all_strategies_parallel(update, results);
+    } else {
+        uint64_t clock = coordination_start;
+        execute_all_strategies(update, results, clock);
+    }
     
     // Sort by priority for conflict resolution
     sort_results_by_priority(results);
@@ -377,15 +520,19 @@ StrategyCoordinator<StrategyTypes...>::coordinate_strategies(
                 result.action = StrategyResult::Action::RISK_LIMIT_HIT;
             }
         }
-        
-        result.coordination_overhead_ns = timer_.get_timestamp_ns() - coordination_start;
+    }
+    
+    const auto checks_done = timer_.get_timestamp_ns();
+    for (auto& result : results) {
+        result.coordination_overhead_ns = checks_done - coordination_start;
     }
     
     // Update position netting for the instrument
-    update_position_netting(update.instrument);
+    const auto coordination_end = timer_.get_timestamp_ns();
+    update_position_netting(update.instrument, coordination_end);
     
     // Update performance tracking
-    const auto coordination_time = timer_.get_timestamp_ns() - coordination_start;
+    const auto coordination_time = coordination_end - coordination_start;
     coordination_count_.fetch_add(1, std::memory_order_relaxed);
     total_coordination_time_ns_.fetch_add(coordination_time, std::memory_order_relaxed);
     
@@ -411,7 +558,7 @@ inline bool StrategyCoordinator<StrategyTypes...>::update_strategy_config(
     msg.timestamp_ns = timer_.get_timestamp_ns();
     msg.data.config_update = config;
     
-    message_buffer_.push(msg);
+    (void)message_buffer_.try_push(msg);
     
     return true;
 }
@@ -430,11 +577,19 @@ inline void StrategyCoordinator<StrategyTypes...>::emergency_stop() noexcept {
     msg.target_strategy_id = 0xFF; // Broadcast
     msg.timestamp_ns = timer_.get_timestamp_ns();
     
-    message_buffer_.push(msg);
+    (void)message_buffer_.try_push(msg);
 }
 
 template<typename... StrategyTypes>
 inline void StrategyCoordinator<StrategyTypes...>::update_position_netting(TreasuryType instrument) noexcept {
+    update_position_netting(instrument, timer_.get_timestamp_ns());
+}
+
+template<typename... StrategyTypes>
+inline void StrategyCoordinator<StrategyTypes...>::update_position_netting(
+    TreasuryType instrument,
+    uint64_t now_ns
+) noexcept {
     const auto instrument_index = static_cast<size_t>(instrument);
     if (instrument_index >= net_positions_.size()) {
         return;
@@ -451,7 +606,7 @@ inline void StrategyCoordinator<StrategyTypes...>::update_position_netting(Treas
     // Aggregate across all strategies using template iteration
     aggregate_positions<0>(instrument, net_pos);
     
-    net_pos.last_update_time_ns = timer_.get_timestamp_ns();
+    net_pos.last_update_time_ns = now_ns;
 }
 
 // Helper for position aggregation across strategies
@@ -462,7 +617,7 @@ void StrategyCoordinator<StrategyTypes...>::aggregate_positions(
     NetPosition& net_pos
 ) noexcept {
     if constexpr (I < MAX_STRATEGIES) {
-        auto& strategy = std::get<I>(strategies_);
+        auto& strategy = this->strategy<I>();
         
         const int64_t position = strategy.get_position(instrument);
         const double unrealized_pnl = strategy.get_unrealized_pnl(instrument);
@@ -527,7 +682,7 @@ bool StrategyCoordinator<StrategyTypes...>::check_strategy_risk_score(
 ) noexcept {
     if constexpr (I < MAX_STRATEGIES) {
         if (I == strategy_id) {
-            auto& strategy = std::get<I>(strategies_);
+            auto& strategy = this->strategy<I>();
             return strategy.get_risk_score(instrument) <= limit;
         } else {
             return check_strategy_risk_score<I + 1>(strategy_id, instrument, limit);
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include "hft/timing/hft_timer.hpp"
+
+namespace hft {
+
+/**
+ * @brief Simulated time for discrete-event runs
+ *
+ * Only moves when the simulation advances it, so a run is independent of
+ * how fast the host executes it.
+ */
+class SimClock {
+public:
+    explicit SimClock(uint64_t start_ns = 0) noexcept : now_ns_(start_ns) {}
+
+    [[nodiscard]] uint64_t now_ns() const noexcept { return now_ns_; }
+
+    /** @brief Move forward to t_ns; never moves backwards */
+    void advance_to(uint64_t t_ns) noexcept {
+        if (t_ns > now_ns_) now_ns_ = t_ns;
+    }
+
+private:
+    uint64_t now_ns_;
+};
+
+/**
+ * @brief Time-ordered event queue with a fixed capacity
+ *
+ * A binary min-heap of (due_ns, sequence, slot) keys over a pooled payload
+ * array, so schedule() and pop() are O(log n), next_due_ns() is O(1) and
+ * nothing allocates after construction. Events due at the same time come
+ * out in the order they were scheduled, which keeps simulations
+ * reproducible. Unlike TimerWheel it always knows its earliest event, which
+ * is what a discrete-event loop advances the clock to.
+ *
+ * Single-threaded.
+ *
+ * @tparam Payload Event type (copied in and out)
+ * @tparam Capacity Maximum pending events
+ */
+template<typename Payload, size_t Capacity = 8192>
+class EventQueue {
+    static_assert(Capacity > 0 && Capacity < UINT32_MAX, "Capacity must fit a 32-bit slot index");
+
+public:
+    static constexpr uint64_t NEVER = UINT64_MAX;
+    static constexpr size_t CAPACITY = Capacity;
+
+    EventQueue() noexcept : size_(0), free_count_(Capacity), next_sequence_(0) {
+        for (size_t i = 0; i < Capacity; ++i) {
+            free_[i] = static_cast<uint32_t>(Capacity - 1 - i);
+        }
+    }
+
+    // No copy (large fixed storage)
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+
+    /**
+     * @brief Queue payload for due_ns
+     * @return false if the queue is full
+     */
+    [[nodiscard]] bool schedule(uint64_t due_ns, const Payload& payload) noexcept {
+        if (__builtin_expect(free_count_ == 0, 0)) return false;
+        const uint32_t slot = free_[--free_count_];
+        payloads_[slot] = payload;
+        heap_[size_] = Key{due_ns, next_sequence_++, slot};
+        sift_up(size_++);
+        return true;
+    }
+
+    /** @brief Due time of the earliest event, NEVER if empty */
+    [[nodiscard]] uint64_t next_due_ns() const noexcept {
+        return size_ != 0 ? heap_[0].due_ns : NEVER;
+    }
+
+    /** @brief Earliest event; only valid when not empty */
+    [[nodiscard]] const Payload& top() const noexcept { return payloads_[heap_[0].slot]; }
+
+    /**
+     * @brief Remove the earliest event if it is due at or before now_ns
+     * @return false if nothing is due
+     */
+    [[nodiscard]] bool pop_due(uint64_t now_ns, Payload& out) noexcept {
+        if (size_ == 0 || heap_[0].due_ns > now_ns) return false;
+        const uint32_t slot = heap_[0].slot;
+        out = payloads_[slot];
+        free_[free_count_++] = slot;
+        heap_[0] = heap_[--size_];
+        if (size_ != 0) sift_down(0);
+        return true;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] bool full() const noexcept { return free_count_ == 0; }
+
+private:
+    struct Key {
+        uint64_t due_ns;
+        uint64_t sequence;      // Tie-break: schedule order
+        uint32_t slot;          // Index into payloads_
+
+        [[nodiscard]] bool before(const Key& other) const noexcept {
+            return due_ns != other.due_ns ? due_ns < other.due_ns : sequence < other.sequence;
+        }
+    };
+
+    void sift_up(size_t i) noexcept {
+        const Key key = heap_[i];
+        while (i != 0) {
+            const size_t parent = (i - 1) / 2;
+            if (!key.before(heap_[parent])) break;
+            heap_[i] = heap_[parent];
+            i = parent;
+        }
+        heap_[i] = key;
+    }
+
+    void sift_down(size_t i) noexcept {
+        const Key key = heap_[i];
+        for (;;) {
+            size_t child = 2 * i + 1;
+            if (child >= size_) break;
+            if (child + 1 < size_ && heap_[child + 1].before(heap_[child])) ++child;
+            if (!heap_[child].before(key)) break;
+            heap_[i] = heap_[child];
+            i = child;
+        }
+        heap_[i] = key;
+    }
+
+    size_t size_;
+    size_t free_count_;
+    uint64_t next_sequence_;
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::array<Key, Capacity> heap_;
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::array<uint32_t, Capacity> free_;
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::array<Payload, Capacity> payloads_;
+};
+
+} // namespace hft
@@ -0,0 +1,378 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "hft/timing/hft_timer.hpp"
+
+namespace hft {
+
+template<uint32_t SubBucketBits, uint32_t MaxValueBits>
+class HdrSnapshot;
+
+/**
+ * @brief HDR-style latency histogram for a single writer thread
+ *
+ * Log-linear bucketing: each power-of-two range [2^k, 2^(k+1)) is split
+ * into 2^SubBucketBits linear sub-buckets, so every recorded value is
+ * resolved to within 1/2^SubBucketBits of itself (0.8% at the default 7
+ * bits, e.g. 4ns steps between 512ns and 1024ns). Values below
+ * 2^SubBucketBits are exact.
+ *
+ * record_latency() is intended for one thread: counters are atomics only
+ * so readers on other threads can sample them, and the writer updates them
+ * with relaxed load + store (plain moves, no RMW, no CAS). Readers take a
+ * snapshot with snapshot_into(), which never blocks the writer. Use
+ * ShardedLatencyHistogram when several threads record into one metric.
+ *
+ * @tparam SubBucketBits Sub-bucket precision (log2 of sub-buckets per octave)
+ * @tparam MaxValueBits Largest trackable value is 2^MaxValueBits - 1 ns
+ *         (larger values are clamped)
+ */
+template<uint32_t SubBucketBits = 7, uint32_t MaxValueBits = 40>
+class alignas(HFTTimer::CACHE_LINE_SIZE) HdrHistogram {
+    static_assert(SubBucketBits >= 1 && SubBucketBits <= 16, "SubBucketBits must be in [1, 16]");
+    static_assert(MaxValueBits > SubBucketBits && MaxValueBits <= 63, "MaxValueBits must exceed SubBucketBits");
+
+public:
+    using ns_t = HFTTimer::ns_t;
+    using Snapshot = HdrSnapshot<SubBucketBits, MaxValueBits>;
+
+    static constexpr size_t SUB_BUCKET_COUNT = size_t{1} << SubBucketBits;
+    static constexpr size_t BUCKET_COUNT = (MaxValueBits - SubBucketBits + 1) * SUB_BUCKET_COUNT;
+    static constexpr ns_t MAX_TRACKABLE = (ns_t{1} << MaxValueBits) - 1;
+
+    HdrHistogram() noexcept { reset(); }
+
+    // Prevent copying
+    HdrHistogram(const HdrHistogram&) = delete;
+    HdrHistogram& operator=(const HdrHistogram&) = delete;
+
+    /**
+     * @brief Bucket index for a value (clamped to MAX_TRACKABLE)
+     */
+    [[nodiscard]] static constexpr size_t index_of(ns_t value) noexcept {
+        if (value > MAX_TRACKABLE) {
+            value = MAX_TRACKABLE;
+        }
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<size_t>(value);
+        }
+        const uint32_t msb = 63 - static_cast<uint32_t>(__builtin_clzll(value));
+        const uint32_t shift = msb - SubBucketBits;
+        return (shift + 1) * SUB_BUCKET_COUNT + static_cast<size_t>((value >> shift) - SUB_BUCKET_COUNT);
+    }
+
+    /**
+     * @brief Smallest value that maps to a bucket
+     */
+    [[nodiscard]] static constexpr ns_t lowest_equivalent(size_t index) noexcept {
+        if (index < SUB_BUCKET_COUNT) {
+            return index;
+        }
+        const size_t shift = index / SUB_BUCKET_COUNT - 1;
+        return (SUB_BUCKET_COUNT + index % SUB_BUCKET_COUNT) << shift;
+    }
+
+    /**
+     * @brief Largest value that maps to a bucket
+     */
+    [[nodiscard]] static constexpr ns_t highest_equivalent(size_t index) noexcept {
+        if (index < SUB_BUCKET_COUNT) {
+            return index;
+        }
+        const size_t shift = index / SUB_BUCKET_COUNT - 1;
+        return lowest_equivalent(index) + (ns_t{1} << shift) - 1;
+    }
+
+    /**
+     * @brief Record one measurement (owning thread only)
+     */
+    void record_latency(ns_t latency) noexcept {
+        record_latency(latency, 1);
+    }
+
+    /**
+     * @brief Record the same measurement count times (owning thread only)
+     */
+    void record_latency(ns_t latency, uint64_t count) noexcept {
+        auto& bin = counts_[index_of(latency)];
+        bin.store(bin.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+
+        if (__builtin_expect(latency < min_, 0)) {
+            min_ = latency;
+            min_latency_.store(latency, std::memory_order_relaxed);
+        }
+        if (__builtin_expect(latency > max_, 0)) {
+            max_ = latency;
+            max_latency_.store(latency, std::memory_order_relaxed);
+        }
+        sum_ += latency * count;
+        sum_squared_ += static_cast<double>(latency) * static_cast<double>(latency) * static_cast<double>(count);
+        sum_latency_.store(sum_, std::memory_order_relaxed);
+        sum_squared_latency_.store(sum_squared_, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Add this histogram's current counts into a snapshot (any thread)
+     *
+     * Counters are read without stopping the writer, so a snapshot taken
+     * during recording may miss the last few samples; totals are derived
+     * from the bucket counts, so percentiles stay self-consistent.
+     */
+    void snapshot_into(Snapshot& snapshot) const noexcept {
+        uint64_t total = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            const uint64_t c = counts_[i].load(std::memory_order_relaxed);
+            snapshot.counts_[i] += c;
+            total += c;
+        }
+        if (total == 0) {
+            return;
+        }
+        snapshot.total_samples_ += total;
+        snapshot.min_latency_ = std::min(snapshot.min_latency_, min_latency_.load(std::memory_order_relaxed));
+        snapshot.max_latency_ = std::max(snapshot.max_latency_, max_latency_.load(std::memory_order_relaxed));
+        snapshot.sum_latency_ += static_cast<double>(sum_latency_.load(std::memory_order_relaxed));
+        snapshot.sum_squared_latency_ += sum_squared_latency_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Statistical analysis in the LatencyHistogram format
+     */
+    [[nodiscard]] LatencyStats get_stats() const noexcept {
+        Snapshot snapshot;
+        snapshot_into(snapshot);
+        return snapshot.get_stats();
+    }
+
+    /**
+     * @brief Reset all collected data (owning thread, or while it is idle)
+     */
+    void reset() noexcept {
+        for (auto& bin : counts_) {
+            bin.store(0, std::memory_order_relaxed);
+        }
+        min_ = std::numeric_limits<ns_t>::max();
+        max_ = 0;
+        sum_ = 0;
+        sum_squared_ = 0.0;
+        min_latency_.store(min_, std::memory_order_relaxed);
+        max_latency_.store(0, std::memory_order_relaxed);
+        sum_latency_.store(0, std::memory_order_relaxed);
+        sum_squared_latency_.store(0.0, std::memory_order_relaxed);
+    }
+
+private:
+    // Writer-private running values (no reloads of the shared copies)
+    ns_t min_;
+    ns_t max_;
+    uint64_t sum_;
+    double sum_squared_;
+
+    // Reader-visible copies
+    std::atomic<ns_t> min_latency_;
+    std::atomic<ns_t> max_latency_;
+    std::atomic<uint64_t> sum_latency_;
+    std::atomic<double> sum_squared_latency_;
+
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::array<std::atomic<uint64_t>, BUCKET_COUNT> counts_;
+};
+
+/**
+ * @brief Plain (non-atomic) copy of one or more HdrHistograms
+ *
+ * Built by readers from HdrHistogram::snapshot_into() or
+ * ShardedLatencyHistogram::snapshot(); mergeable with other snapshots of
+ * the same precision, e.g. to combine per-process or per-interval data.
+ */
+template<uint32_t SubBucketBits = 7, uint32_t MaxValueBits = 40>
+class HdrSnapshot {
+public:
+    using ns_t = HFTTimer::ns_t;
+    using Histogram = HdrHistogram<SubBucketBits, MaxValueBits>;
+    static constexpr size_t BUCKET_COUNT = Histogram::BUCKET_COUNT;
+
+    HdrSnapshot() noexcept { clear(); }
+
+    void clear() noexcept {
+        counts_.fill(0);
+        total_samples_ = 0;
+        min_latency_ = std::numeric_limits<ns_t>::max();
+        max_latency_ = 0;
+        sum_latency_ = 0.0;
+        sum_squared_latency_ = 0.0;
+    }
+
+    /**
+     * @brief Add another snapshot's counts into this one
+     */
+    void merge(const HdrSnapshot& other) noexcept {
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        total_samples_ += other.total_samples_;
+        min_latency_ = std::min(min_latency_, other.min_latency_);
+        max_latency_ = std::max(max_latency_, other.max_latency_);
+        sum_latency_ += other.sum_latency_;
+        sum_squared_latency_ += other.sum_squared_latency_;
+    }
+
+    /**
+     * @brief Value at a percentile (0-100), accurate to the sub-bucket precision
+     *
+     * Reports the highest value equivalent to the bucket holding the
+     * percentile, capped at the recorded maximum.
+     */
+    [[nodiscard]] ns_t value_at_percentile(double percentile) const noexcept {
+        if (total_samples_ == 0) {
+            return 0;
+        }
+        const double fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+        const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * total_samples_)));
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            cumulative += counts_[i];
+            if (cumulative >= target) {
+                return std::min(Histogram::highest_equivalent(i), max_latency_);
+            }
+        }
+        return max_latency_;
+    }
+
+    [[nodiscard]] uint64_t count_at_index(size_t index) const noexcept { return counts_[index]; }
+    [[nodiscard]] uint64_t total_samples() const noexcept { return total_samples_; }
+    [[nodiscard]] ns_t min_latency() const noexcept { return total_samples_ ? min_latency_ : 0; }
+    [[nodiscard]] ns_t max_latency() const noexcept { return max_latency_; }
+    [[nodiscard]] double mean_latency() const noexcept {
+        return total_samples_ ? sum_latency_ / static_cast<double>(total_samples_) : 0.0;
+    }
+
+    /**
+     * @brief Statistical analysis in the LatencyHistogram format
+     */
+    [[nodiscard]] LatencyStats get_stats() const noexcept {
+        LatencyStats stats;
+        stats.total_samples = total_samples_;
+        stats.min_latency = min_latency_;
+        stats.max_latency = max_latency_;
+        if (total_samples_ == 0) {
+            stats.mean_latency = 0;
+            stats.std_dev = 0;
+            stats.percentiles.fill(0);
+            return stats;
+        }
+        stats.mean_latency = mean_latency();
+        const double variance = sum_squared_latency_ / static_cast<double>(total_samples_) -
+                                stats.mean_latency * stats.mean_latency;
+        stats.std_dev = variance > 0.0 ? std::sqrt(variance) : 0.0;
+
+        const std::array<double, 4> percentiles = {50.0, 90.0, 95.0, 99.0};
+        for (size_t i = 0; i < percentiles.size(); ++i) {
+            stats.percentiles[i] = static_cast<double>(value_at_percentile(percentiles[i]));
+        }
+        return stats;
+    }
+
+private:
+    friend Histogram;
+
+    std::array<uint64_t, BUCKET_COUNT> counts_;
+    uint64_t total_samples_;
+    ns_t min_latency_;
+    ns_t max_latency_;
+    double sum_latency_;
+    double sum_squared_latency_;
+};
+
+/**
+ * @brief Multi-writer latency metric built from single-writer HdrHistogram shards
+ *
+ * Each recording thread attaches its own shard (cache-line isolated, no
+ * shared writes); readers merge all shards into an HdrSnapshot without
+ * locking. Shards keep their data after detach() so short-lived threads
+ * still contribute to the merged view.
+ *
+ * @tparam MaxShards Maximum simultaneously attached writer threads
+ */
+template<size_t MaxShards = 16, uint32_t SubBucketBits = 7, uint32_t MaxValueBits = 40>
+class ShardedLatencyHistogram {
+    static_assert(MaxShards > 0, "MaxShards must be > 0");
+
+public:
+    using Histogram = HdrHistogram<SubBucketBits, MaxValueBits>;
+    using Snapshot = HdrSnapshot<SubBucketBits, MaxValueBits>;
+
+    ShardedLatencyHistogram() noexcept = default;
+
+    // Prevent copying
+    ShardedLatencyHistogram(const ShardedLatencyHistogram&) = delete;
+    ShardedLatencyHistogram& operator=(const ShardedLatencyHistogram&) = delete;
+
+    /**
+     * @brief Claim a shard for the calling thread
+     * @return Shard to record into, or nullptr if MaxShards are attached
+     */
+    [[nodiscard]] Histogram* attach() noexcept {
+        for (auto& shard : shards_) {
+            bool expected = false;
+            if (shard.in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return &shard.histogram;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Release a shard; its samples stay in the merged view
+     */
+    void detach(Histogram* histogram) noexcept {
+        for (auto& shard : shards_) {
+            if (&shard.histogram == histogram) {
+                shard.in_use.store(false, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Merge every shard into a snapshot (any thread, lock-free)
+     */
+    void snapshot(Snapshot& out) const noexcept {
+        out.clear();
+        for (const auto& shard : shards_) {
+            shard.histogram.snapshot_into(out);
+        }
+    }
+
+    [[nodiscard]] LatencyStats get_stats() const noexcept {
+        Snapshot merged;
+        snapshot(merged);
+        return merged.get_stats();
+    }
+
+    /**
+     * @brief Reset every shard (only while no thread is recording)
+     */
+    void reset() noexcept {
+        for (auto& shard : shards_) {
+            shard.histogram.reset();
+        }
+    }
+
+    static constexpr size_t max_shards() noexcept { return MaxShards; }
+
+private:
+    struct alignas(HFTTimer::CACHE_LINE_SIZE) Shard {
+        Histogram histogram;
+        std::atomic<bool> in_use{false};
+    };
+
+    std::array<Shard, MaxShards> shards_;
+};
+
+} // namespace hft
@@ -15,11 +15,18 @@ class LatencyHistogram;
 class LatencyStats;
 
 /**
- * @brief High-performance timer using ARM64 cycle counter
+ * @brief High-performance timer using the CPU cycle counter
  * 
- * This class provides nanosecond-precision timing using the ARM64 cycle counter
- * (cntvct_el0) with zero allocation in hot paths. All timing operations are
- * lock-free and thread-safe.
+ * This class provides nanosecond-precision timing with zero allocation in hot
+ * paths. All timing operations are lock-free and thread-safe. The counter is
+ * chosen at compile time:
+ * - ARM64: cntvct_el0, converted using the architected frequency (cntfrq_el0)
+ * - x86-64: TSC via lfence+rdtsc (rdtscp with HFT_TIMER_USE_RDTSCP),
+ *   calibrated against CLOCK_MONOTONIC_RAW. Check invariant_tsc() at startup;
+ *   without it the TSC rate may follow CPU frequency changes.
+ * - Elsewhere, or with HFT_TIMER_USE_CLOCK_MONOTONIC: CLOCK_MONOTONIC_RAW
+ *
+ * cycles_to_ns() is a fixed-point multiply-shift (no divide).
  */
 class HFTTimer {
 public:
@@ -32,9 +39,15 @@ public:
     static constexpr size_t MAX_HISTOGRAM_BINS = 1024;
     static constexpr size_t CACHE_LINE_SIZE = 64;
 
+    enum class Backend : uint8_t {
+        ArmVirtualCounter,
+        X86Tsc,
+        ClockMonotonic
+    };
+
     /**
      * @brief Get current timestamp in cycles
-     * @return Current cycle count from cntvct_el0
+     * @return Current count of the compile-time selected counter
      */
     [[nodiscard]] static cycle_t get_cycles() noexcept;
 
@@ -51,6 +64,45 @@ public:
      */
     [[nodiscard]] static ns_t get_timestamp_ns() noexcept;
 
+    /**
+     * @brief Counter backend compiled into this build
+     */
+    [[nodiscard]] static Backend backend() noexcept;
+
+    /**
+     * @brief Whether the counter ticks at a constant rate across P/C-states
+     *        (x86: CPUID invariant TSC bit; always true for other backends)
+     */
+    [[nodiscard]] static bool invariant_tsc() noexcept;
+
+    /**
+     * @brief Calibrated counter frequency
+     */
+    [[nodiscard]] static double cycles_per_ns() noexcept;
+
+    enum class CalibrationSource : uint8_t {
+        Cached,    // Rate from the cache file, confirmed by a short check
+        Measured,  // Full calibration (cache missing, stale or not given)
+        Fixed      // Backend rate is architectural; nothing to calibrate
+    };
+
+    /**
+     * @brief Calibrate now, reusing a persisted rate when it still holds
+     *
+     * The first timestamp otherwise pays for calibration (several ms of
+     * busy-waiting on the TSC backend). Called from a startup warmup phase
+     * instead: a rate cached by an earlier run on this host is accepted if
+     * a sub-millisecond check agrees with it to within 0.2%, otherwise the
+     * counter is fully calibrated and the cache rewritten. Restarts then
+     * start faster and convert with the same rate as the previous run.
+     *
+     * Replaces any earlier calibration, so call it before the session,
+     * not while other threads are measuring intervals.
+     *
+     * @param cache_path Cache file (nullptr: calibrate without caching)
+     */
+    static CalibrationSource calibrate(const char* cache_path = nullptr) noexcept;
+
     /**
      * @brief RAII wrapper for timing a scope
      */
@@ -70,8 +122,11 @@ public:
     };
 
 private:
-    // Cache-aligned frequency storage
-    alignas(CACHE_LINE_SIZE) static std::atomic<double> cycles_per_ns_;
+    // ns = (cycles * ns_mult_) >> NS_SHIFT
+    static constexpr uint32_t NS_SHIFT = 32;
+
+    // Cache-aligned conversion factor (0 until calibrated)
+    alignas(CACHE_LINE_SIZE) static std::atomic<uint64_t> ns_mult_;
     
     // Initialize the timer system
     static void initialize() noexcept;
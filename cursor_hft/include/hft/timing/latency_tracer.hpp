@@ -0,0 +1,262 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include "hft/timing/hft_timer.hpp"
+#include "hft/timing/hdr_histogram.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+
+namespace hft {
+
+/**
+ * @brief Pipeline points a sampled tick is stamped at, in pipeline order
+ */
+enum class TraceStage : uint8_t {
+    INGRESS = 0,        // Raw message batch picked up by the feed handler
+    PARSED = 1,         // Tick validated into the parsed ring
+    BOOK = 2,           // Book / tick store updated
+    DECISION = 3,       // Strategy decision made
+    RISK = 4,           // Pre-trade risk passed
+    ORDER = 5,          // Order record created
+    SEND = 6,           // Handed to the venue session
+    COUNT = 7
+};
+
+constexpr size_t TRACE_STAGE_COUNT = static_cast<size_t>(TraceStage::COUNT);
+
+[[nodiscard]] constexpr const char* trace_stage_name(TraceStage stage) noexcept {
+    switch (stage) {
+        case TraceStage::INGRESS: return "ingress";
+        case TraceStage::PARSED: return "parse";
+        case TraceStage::BOOK: return "book";
+        case TraceStage::DECISION: return "decision";
+        case TraceStage::RISK: return "risk";
+        case TraceStage::ORDER: return "order";
+        case TraceStage::SEND: return "send";
+        default: return "unknown";
+    }
+}
+
+/**
+ * @brief Cycle stamps of one traced tick
+ */
+struct alignas(64) TraceRecord {
+    uint32_t trace_id = 0;                              // 0 = free slot (4 bytes)
+    uint8_t stage_mask = 0;                             // Bit per stamped TraceStage (1 byte)
+    uint8_t _pad0[3] = {};                              // Padding (3 bytes)
+    std::array<uint64_t, TRACE_STAGE_COUNT> cycles{};   // HFTTimer::get_cycles() per stage (56 bytes)
+    // Total: 4+1+3+56 = 64 bytes
+
+    [[nodiscard]] bool has(TraceStage stage) const noexcept {
+        return (stage_mask >> static_cast<uint32_t>(stage)) & 1u;
+    }
+};
+static_assert(sizeof(TraceRecord) == 64, "TraceRecord must be 64 bytes");
+
+/**
+ * @brief Sampled tick-to-trade tracing with a per-stage latency breakdown
+ *
+ * The feed handler calls begin() for every tick; one in sample_every gets
+ * a non-zero trace ID, which rides in TreasuryTick, the strategies'
+ * MarketUpdate / TradingDecision, OrderRecord and QuoteUpdate. Components
+ * on the pipeline thread stamp() the ID as it passes their stage and the
+ * last one calls finish(), which pushes the record to the completed ring.
+ * Unsampled ticks carry ID 0, so every stamp on them is one compare.
+ *
+ * The reporting side (any one other thread) drain()s the ring into one
+ * HdrHistogram per stage, each holding the time from the previous stamped
+ * stage, plus one for the whole trace. Traces still in flight when their
+ * slot is reused by a newer one are dropped from stamping.
+ *
+ * @tparam Slots In-flight traces (power of two)
+ */
+template<size_t Slots = 1024>
+class LatencyTracer {
+    static_assert((Slots & (Slots - 1)) == 0, "Slots must be a power of two");
+
+public:
+    using Histogram = HdrHistogram<>;
+    static constexpr size_t COMPLETED_RING_SIZE = 4096;
+
+    struct StageBreakdown {
+        uint64_t count = 0;
+        double mean_ns = 0.0;
+        uint64_t p50_ns = 0;
+        uint64_t p90_ns = 0;
+        uint64_t p99_ns = 0;
+        uint64_t max_ns = 0;
+    };
+
+    /**
+     * @param sample_every Trace one tick in this many (rounded up to a power of two)
+     */
+    explicit LatencyTracer(uint32_t sample_every = 64) noexcept
+        : slots_{}, sample_mask_(round_up(sample_every) - 1), ticks_seen_(0), next_trace_id_(0),
+          traces_started_(0), traces_overwritten_(0), completed_dropped_(0), traces_drained_(0),
+          stage_histograms_(std::make_unique<std::array<Histogram, TRACE_STAGE_COUNT>>()),
+          total_histogram_(std::make_unique<Histogram>()) {}
+
+    LatencyTracer(const LatencyTracer&) = delete;
+    LatencyTracer& operator=(const LatencyTracer&) = delete;
+
+    /**
+     * @brief Pipeline thread: allocate a trace for a tick if it is sampled
+     * @param ingress_cycles When the tick's raw message was picked up
+     * @return Trace ID, 0 if this tick is not traced
+     */
+    [[nodiscard]] uint32_t begin(uint64_t ingress_cycles) noexcept {
+        if (__builtin_expect((ticks_seen_++ & sample_mask_) != 0, 1)) return 0;
+        uint32_t trace_id = ++next_trace_id_;
+        if (__builtin_expect(trace_id == 0, 0)) trace_id = ++next_trace_id_;  // Skip 0 on wrap
+
+        TraceRecord& slot = slots_[trace_id & (Slots - 1)];
+        traces_overwritten_ += slot.trace_id != 0 ? 1 : 0;
+        slot.trace_id = trace_id;
+        slot.stage_mask = 1u << static_cast<uint32_t>(TraceStage::INGRESS);
+        slot.cycles[static_cast<size_t>(TraceStage::INGRESS)] = ingress_cycles;
+        ++traces_started_;
+        return trace_id;
+    }
+
+    /**
+     * @brief Pipeline thread: record that a trace reached a stage
+     */
+    void stamp(uint32_t trace_id, TraceStage stage, uint64_t cycles) noexcept {
+        if (trace_id == 0) return;
+        TraceRecord& slot = slots_[trace_id & (Slots - 1)];
+        if (__builtin_expect(slot.trace_id != trace_id, 0)) return;
+        slot.cycles[static_cast<size_t>(stage)] = cycles;
+        slot.stage_mask |= static_cast<uint8_t>(1u << static_cast<uint32_t>(stage));
+    }
+
+    void stamp(uint32_t trace_id, TraceStage stage) noexcept {
+        if (trace_id != 0) stamp(trace_id, stage, HFTTimer::get_cycles());
+    }
+
+    /**
+     * @brief Pipeline thread: stamp the last stage and hand the trace to the reporter
+     * @return false if the trace was unknown or the completed ring was full
+     */
+    bool finish(uint32_t trace_id, TraceStage stage, uint64_t cycles) noexcept {
+        if (trace_id == 0) return false;
+        TraceRecord& slot = slots_[trace_id & (Slots - 1)];
+        if (slot.trace_id != trace_id) return false;
+        stamp(trace_id, stage, cycles);
+        const bool queued = completed_.try_push(slot);
+        completed_dropped_ += queued ? 0 : 1;
+        slot.trace_id = 0;
+        return queued;
+    }
+
+    bool finish(uint32_t trace_id, TraceStage stage = TraceStage::SEND) noexcept {
+        return trace_id != 0 && finish(trace_id, stage, HFTTimer::get_cycles());
+    }
+
+    /**
+     * @brief Reporting thread: fold completed traces into the stage histograms
+     * @return Traces drained
+     */
+    size_t drain() noexcept {
+        size_t drained = 0;
+        TraceRecord record;
+        while (completed_.try_pop(record)) {
+            size_t previous = TRACE_STAGE_COUNT;
+            for (size_t stage = 0; stage < TRACE_STAGE_COUNT; ++stage) {
+                if (!record.has(static_cast<TraceStage>(stage))) continue;
+                if (previous != TRACE_STAGE_COUNT) {
+                    (*stage_histograms_)[stage].record_latency(elapsed_ns(record.cycles[previous], record.cycles[stage]));
+                }
+                previous = stage;
+            }
+            const size_t first = static_cast<size_t>(__builtin_ctz(record.stage_mask));
+            total_histogram_->record_latency(elapsed_ns(record.cycles[first], record.cycles[previous]));
+            ++drained;
+        }
+        traces_drained_.fetch_add(drained, std::memory_order_relaxed);
+        return drained;
+    }
+
+    /**
+     * @brief Latency from the previous stamped stage into `stage`
+     */
+    [[nodiscard]] StageBreakdown stage_breakdown(TraceStage stage) const noexcept {
+        return breakdown_of((*stage_histograms_)[static_cast<size_t>(stage)]);
+    }
+
+    /**
+     * @brief Latency from the first to the last stamped stage
+     */
+    [[nodiscard]] StageBreakdown total_breakdown() const noexcept { return breakdown_of(*total_histogram_); }
+
+    /** @brief Histograms for export (e.g. TelemetryPublisher::add_histogram); written by drain() */
+    [[nodiscard]] const Histogram& stage_histogram(TraceStage stage) const noexcept {
+        return (*stage_histograms_)[static_cast<size_t>(stage)];
+    }
+    [[nodiscard]] const Histogram& total_histogram() const noexcept { return *total_histogram_; }
+
+    /**
+     * @brief Reporting thread: clear the histograms (e.g. between benchmark runs)
+     */
+    void reset_breakdown() noexcept {
+        for (auto& histogram : *stage_histograms_) histogram.reset();
+        total_histogram_->reset();
+    }
+
+    // Pipeline-side counters: read from the pipeline thread or once it is idle
+    [[nodiscard]] uint64_t ticks_seen() const noexcept { return ticks_seen_; }
+    [[nodiscard]] uint64_t traces_started() const noexcept { return traces_started_; }
+    [[nodiscard]] uint64_t traces_overwritten() const noexcept { return traces_overwritten_; }
+    [[nodiscard]] uint64_t completed_dropped() const noexcept { return completed_dropped_; }
+    [[nodiscard]] uint64_t traces_drained() const noexcept { return traces_drained_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint32_t sample_every() const noexcept { return sample_mask_ + 1; }
+
+private:
+    static constexpr uint32_t round_up(uint32_t value) noexcept {
+        uint32_t result = 1;
+        while (result < value && result < (1u << 31)) result <<= 1;
+        return result;
+    }
+
+    static uint64_t elapsed_ns(uint64_t from, uint64_t to) noexcept {
+        return to > from ? HFTTimer::cycles_to_ns(to - from) : 0;
+    }
+
+    static StageBreakdown breakdown_of(const Histogram& histogram) noexcept {
+        HdrSnapshot<> snapshot;
+        histogram.snapshot_into(snapshot);
+        StageBreakdown breakdown;
+        breakdown.count = snapshot.total_samples();
+        breakdown.mean_ns = snapshot.mean_latency();
+        breakdown.p50_ns = snapshot.value_at_percentile(50.0);
+        breakdown.p90_ns = snapshot.value_at_percentile(90.0);
+        breakdown.p99_ns = snapshot.value_at_percentile(99.0);
+        breakdown.max_ns = snapshot.max_latency();
+        return breakdown;
+    }
+
+    // Pipeline side
+    std::array<TraceRecord, Slots> slots_;
+    uint32_t sample_mask_;
+    uint64_t ticks_seen_;
+    uint32_t next_trace_id_;
+    uint64_t traces_started_;
+    uint64_t traces_overwritten_;
+    uint64_t completed_dropped_;
+
+    SPSCRingBuffer<TraceRecord, COMPLETED_RING_SIZE> completed_;
+
+    // Reporting side
+    alignas(64) std::atomic<uint64_t> traces_drained_;
+    std::unique_ptr<std::array<Histogram, TRACE_STAGE_COUNT>> stage_histograms_;
+    std::unique_ptr<Histogram> total_histogram_;
+};
+
+/**
+ * @brief Tracer wired through the feed handler, strategies and order lifecycle
+ */
+using PipelineTracer = LatencyTracer<>;
+
+} // namespace hft
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <dlfcn.h>
+#endif
+
+namespace hft {
+
+/**
+ * @brief Hardware events a PerfCounterGroup counts
+ */
+enum class PerfEvent : uint8_t {
+    INSTRUCTIONS = 0,
+    CYCLES = 1,
+    L1D_MISSES = 2,         // L1 data cache read misses
+    LLC_MISSES = 3,         // Last-level cache misses
+    BRANCH_MISSES = 4,
+    DTLB_MISSES = 5,        // Data TLB read misses
+    COUNT = 6
+};
+
+constexpr size_t PERF_EVENT_COUNT = static_cast<size_t>(PerfEvent::COUNT);
+
+[[nodiscard]] constexpr const char* perf_event_name(PerfEvent event) noexcept {
+    switch (event) {
+        case PerfEvent::INSTRUCTIONS: return "instructions";
+        case PerfEvent::CYCLES: return "cycles";
+        case PerfEvent::L1D_MISSES: return "l1d_misses";
+        case PerfEvent::LLC_MISSES: return "llc_misses";
+        case PerfEvent::BRANCH_MISSES: return "branch_misses";
+        case PerfEvent::DTLB_MISSES: return "dtlb_misses";
+        default: return "unknown";
+    }
+}
+
+/**
+ * @brief Counts accumulated between start() and stop()
+ */
+struct PerfCounts {
+    std::array<uint64_t, PERF_EVENT_COUNT> values{};
+    uint32_t valid_mask = 0;        // Bit per PerfEvent that was counted
+    bool multiplexed = false;       // Kernel time-sliced the group; values are scaled
+
+    [[nodiscard]] bool has(PerfEvent event) const noexcept {
+        return (valid_mask >> static_cast<uint32_t>(event)) & 1u;
+    }
+    [[nodiscard]] uint64_t operator[](PerfEvent event) const noexcept {
+        return values[static_cast<size_t>(event)];
+    }
+};
+
+/**
+ * @brief Per-thread hardware performance counters around a measured region
+ *
+ * Counts user-space events of the calling thread only:
+ * - Linux: one perf_event_open group led by cycles, so all events cover the
+ *   same window. Events the PMU or perf_event_paranoid refuses are left out
+ *   of valid_mask; if the group is multiplexed, counts are scaled by
+ *   time_enabled / time_running.
+ * - macOS: the kperf fixed counters (cycles, instructions) through
+ *   kpc_get_thread_counters. Needs root; cache, branch and TLB events are
+ *   not configured (they need the kpep event database).
+ * - Elsewhere: available() is false and every call is a no-op.
+ *
+ * Construct it on the thread being measured, outside the timed loop.
+ * start()/stop() bracket the region; pause()/resume() leave out setup
+ * inside it.
+ */
+class PerfCounterGroup {
+public:
+    PerfCounterGroup() noexcept { open(); }
+    ~PerfCounterGroup() { close(); }
+
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+    /** @brief Whether at least one event is being counted */
+    [[nodiscard]] bool available() const noexcept { return valid_mask_ != 0; }
+    [[nodiscard]] bool has(PerfEvent event) const noexcept {
+        return (valid_mask_ >> static_cast<uint32_t>(event)) & 1u;
+    }
+
+    /** @brief Zero the counts and start counting */
+    void start() noexcept {
+        if (!available()) return;
+        accumulated_ = {};
+#if defined(__linux__)
+        ioctl(fds_[leader_], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+#endif
+        resume();
+    }
+
+    /** @brief Stop counting; counts so far are kept */
+    void pause() noexcept {
+        if (!available() || !running_) return;
+        running_ = false;
+#if defined(__linux__)
+        ioctl(fds_[leader_], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+#elif defined(__APPLE__)
+        std::array<uint64_t, PERF_EVENT_COUNT> now{};
+        read_fixed(now);
+        for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) accumulated_[i] += now[i] - resumed_at_[i];
+#endif
+    }
+
+    /** @brief Continue counting after pause() */
+    void resume() noexcept {
+        if (!available() || running_) return;
+        running_ = true;
+#if defined(__linux__)
+        ioctl(fds_[leader_], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#elif defined(__APPLE__)
+        read_fixed(resumed_at_);
+#endif
+    }
+
+    /** @brief Stop counting and return the counts since start() */
+    PerfCounts stop() noexcept {
+        pause();
+        PerfCounts counts;
+        if (!available()) return counts;
+        counts.valid_mask = valid_mask_;
+#if defined(__linux__)
+        read_group(counts);
+#else
+        counts.values = accumulated_;
+#endif
+        return counts;
+    }
+
+private:
+#if defined(__linux__)
+    struct EventConfig {
+        uint32_t type;
+        uint64_t config;
+    };
+
+    // Indexed by PerfEvent; cache events count read misses
+    static constexpr uint64_t CACHE_READ_MISS =
+        (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    static constexpr std::array<EventConfig, PERF_EVENT_COUNT> EVENTS{{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | CACHE_READ_MISS},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | CACHE_READ_MISS},
+    }};
+
+    static int open_event(const EventConfig& event, int group_fd) noexcept {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = event.type;
+        attr.config = event.config;
+        attr.disabled = group_fd == -1 ? 1 : 0;   // Members follow the leader
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID |
+                           PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+
+    void open() noexcept {
+        fds_.fill(-1);
+        // Cycles leads so the whole group is scheduled with it
+        leader_ = static_cast<size_t>(PerfEvent::CYCLES);
+        fds_[leader_] = open_event(EVENTS[leader_], -1);
+        if (fds_[leader_] < 0) {
+            leader_ = static_cast<size_t>(PerfEvent::INSTRUCTIONS);
+            fds_[leader_] = open_event(EVENTS[leader_], -1);
+            if (fds_[leader_] < 0) return;
+        }
+        for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+            if (i != leader_) fds_[i] = open_event(EVENTS[i], fds_[leader_]);
+        }
+        for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+            if (fds_[i] < 0) continue;
+            if (ioctl(fds_[i], PERF_EVENT_IOC_ID, &ids_[i]) != 0) {
+                ::close(fds_[i]);
+                fds_[i] = -1;
+                continue;
+            }
+            valid_mask_ |= 1u << i;
+        }
+        if (!has(static_cast<PerfEvent>(leader_))) close();
+    }
+
+    void close() noexcept {
+        // Members first; the leader owns the group
+        for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+            if (i != leader_ && fds_[i] >= 0) ::close(fds_[i]);
+        }
+        if (fds_[leader_] >= 0) ::close(fds_[leader_]);
+        fds_.fill(-1);
+        valid_mask_ = 0;
+    }
+
+    void read_group(PerfCounts& counts) const noexcept {
+        // nr, time_enabled, time_running, then {value, id} per event
+        std::array<uint64_t, 3 + 2 * PERF_EVENT_COUNT> buffer{};
+        const ssize_t bytes = ::read(fds_[leader_], buffer.data(), sizeof(buffer));
+        if (bytes < static_cast<ssize_t>(3 * sizeof(uint64_t))) {
+            counts.valid_mask = 0;
+            return;
+        }
+        const uint64_t nr = buffer[0];
+        const uint64_t enabled = buffer[1];
+        const uint64_t running = buffer[2];
+        counts.multiplexed = running != 0 && running < enabled;
+        for (uint64_t n = 0; n < nr && n < PERF_EVENT_COUNT; ++n) {
+            uint64_t value = buffer[3 + 2 * n];
+            const uint64_t id = buffer[4 + 2 * n];
+            if (counts.multiplexed) {
+                value = static_cast<uint64_t>(static_cast<double>(value) * enabled / running);
+            }
+            for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+                if (fds_[i] >= 0 && ids_[i] == id) counts.values[i] = value;
+            }
+        }
+    }
+
+    std::array<int, PERF_EVENT_COUNT> fds_{};
+    std::array<uint64_t, PERF_EVENT_COUNT> ids_{};
+    size_t leader_ = 0;
+#elif defined(__APPLE__)
+    // kperf.framework (private); Apple silicon fixed counters: 0 = cycles, 1 = instructions
+    static constexpr uint32_t KPC_CLASS_FIXED_MASK = 1u;
+    using kpc_set_counting_t = int (*)(uint32_t);
+    using kpc_set_thread_counting_t = int (*)(uint32_t);
+    using kpc_get_thread_counters_t = int (*)(uint32_t, uint32_t, uint64_t*);
+
+    void open() noexcept {
+        handle_ = dlopen("/System/Library/PrivateFrameworks/kperf.framework/kperf", RTLD_LAZY);
+        if (handle_ == nullptr) return;
+        auto set_counting = reinterpret_cast<kpc_set_counting_t>(dlsym(handle_, "kpc_set_counting"));
+        auto set_thread_counting = reinterpret_cast<kpc_set_thread_counting_t>(dlsym(handle_, "kpc_set_thread_counting"));
+        get_thread_counters_ = reinterpret_cast<kpc_get_thread_counters_t>(dlsym(handle_, "kpc_get_thread_counters"));
+        if (set_counting == nullptr || set_thread_counting == nullptr || get_thread_counters_ == nullptr ||
+            set_counting(KPC_CLASS_FIXED_MASK) != 0 || set_thread_counting(KPC_CLASS_FIXED_MASK) != 0) {
+            close();
+            return;
+        }
+        valid_mask_ = (1u << static_cast<uint32_t>(PerfEvent::CYCLES)) |
+                      (1u << static_cast<uint32_t>(PerfEvent::INSTRUCTIONS));
+    }
+
+    void close() noexcept {
+        if (handle_ != nullptr) dlclose(handle_);
+        handle_ = nullptr;
+        get_thread_counters_ = nullptr;
+        valid_mask_ = 0;
+    }
+
+    void read_fixed(std::array<uint64_t, PERF_EVENT_COUNT>& out) const noexcept {
+        uint64_t fixed[2] = {};
+        if (get_thread_counters_(0, 2, fixed) != 0) return;
+        out[static_cast<size_t>(PerfEvent::CYCLES)] = fixed[0];
+        out[static_cast<size_t>(PerfEvent::INSTRUCTIONS)] = fixed[1];
+    }
+
+    void* handle_ = nullptr;
+    kpc_get_thread_counters_t get_thread_counters_ = nullptr;
+    std::array<uint64_t, PERF_EVENT_COUNT> resumed_at_{};
+#else
+    void open() noexcept {}
+    void close() noexcept {}
+#endif
+
+    uint32_t valid_mask_ = 0;
+    bool running_ = false;
+    std::array<uint64_t, PERF_EVENT_COUNT> accumulated_{};
+};
+
+} // namespace hft
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include "hft/timing/hft_timer.hpp"
+
+namespace hft {
+
+/**
+ * @brief Hashed timer wheel with a fixed timer capacity
+ *
+ * Timers hash into Slots buckets of tick_ns each and sit on an intrusive
+ * doubly-linked list, so schedule() and cancel() are O(1) and allocation
+ * free (entries come from a fixed array with a free list). Timers further
+ * out than one revolution stay in their slot and are skipped until due.
+ *
+ * advance() detaches everything due before invoking callbacks, so a
+ * callback may schedule or cancel timers freely; a timer it schedules at
+ * or before now fires on the next advance().
+ *
+ * Single-threaded: owned by the thread that calls advance().
+ *
+ * @tparam Slots Wheel size (power of 2)
+ * @tparam Capacity Maximum pending timers
+ */
+template<size_t Slots = 256, size_t Capacity = 1024>
+class alignas(HFTTimer::CACHE_LINE_SIZE) TimerWheel {
+    static_assert((Slots & (Slots - 1)) == 0, "Slots must be a power of 2");
+    static_assert(Capacity > 0 && Capacity < UINT32_MAX, "Capacity must fit a 32-bit handle");
+
+public:
+    using handle_t = uint32_t;                          // 0 = no timer
+    static constexpr size_t SLOTS = Slots;
+    static constexpr size_t CAPACITY = Capacity;
+
+    explicit TimerWheel(uint64_t tick_ns = 1000000, uint64_t start_ns = 0) noexcept
+        : tick_ns_(tick_ns ? tick_ns : 1), current_tick_(start_ns / tick_ns_), size_(0), free_head_(1) {
+        heads_.fill(0);
+        for (size_t i = 0; i < Capacity; ++i) {
+            entries_[i].next = i + 1 < Capacity ? static_cast<handle_t>(i + 2) : 0;
+        }
+    }
+
+    // No copy (handles index into this wheel)
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief Schedule payload to fire at due_ns
+     * @return Handle for cancel(), 0 if the wheel is full
+     */
+    [[nodiscard]] handle_t schedule(uint64_t due_ns, uint64_t payload) noexcept {
+        const handle_t handle = free_head_;
+        if (__builtin_expect(handle == 0, 0)) return 0;
+        Entry& entry = entries_[handle - 1];
+        free_head_ = entry.next;
+
+        uint64_t tick = due_ns / tick_ns_;
+        if (tick < current_tick_) tick = current_tick_;
+        entry.due_ns = due_ns;
+        entry.payload = payload;
+        entry.slot = static_cast<uint32_t>(tick & (Slots - 1));
+        entry.live = true;
+        link(handle, entry);
+        ++size_;
+        return handle;
+    }
+
+    /**
+     * @brief Cancel a pending timer
+     * @return false if the handle already fired or was cancelled
+     */
+    bool cancel(handle_t handle) noexcept {
+        if (handle == 0 || handle > Capacity || !entries_[handle - 1].live) return false;
+        Entry& entry = entries_[handle - 1];
+        unlink(entry);
+        release(handle, entry);
+        return true;
+    }
+
+    /**
+     * @brief Fire every timer due at or before now_ns
+     * @param fn Called as fn(payload, due_ns)
+     * @return Timers fired
+     */
+    template<typename Fn>
+    size_t advance(uint64_t now_ns, Fn&& fn) noexcept {
+        const uint64_t target_tick = now_ns / tick_ns_;
+        if (target_tick < current_tick_) return 0;
+        const uint64_t ticks = target_tick - current_tick_ + 1;
+        const uint64_t walk = ticks < Slots ? ticks : Slots;
+
+        // Detach due timers onto a private list first
+        handle_t expired = 0;
+        for (uint64_t t = 0; t < walk; ++t) {
+            const size_t slot = static_cast<size_t>((current_tick_ + t) & (Slots - 1));
+            handle_t handle = heads_[slot];
+            while (handle != 0) {
+                Entry& entry = entries_[handle - 1];
+                const handle_t next = entry.next;
+                if (entry.due_ns <= now_ns) {
+                    unlink(entry);
+                    entry.live = false;  // Past cancelling: it fires in this advance()
+                    entry.next = expired;
+                    expired = handle;
+                }
+                handle = next;
+            }
+        }
+        current_tick_ = target_tick;
+
+        size_t fired = 0;
+        while (expired != 0) {
+            Entry& entry = entries_[expired - 1];
+            const handle_t next = entry.next;
+            const uint64_t payload = entry.payload;
+            const uint64_t due_ns = entry.due_ns;
+            release(expired, entry);
+            fn(payload, due_ns);
+            ++fired;
+            expired = next;
+        }
+        return fired;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] uint64_t tick_ns() const noexcept { return tick_ns_; }
+
+private:
+    struct Entry {
+        uint64_t due_ns = 0;
+        uint64_t payload = 0;
+        handle_t next = 0;
+        handle_t prev = 0;
+        uint32_t slot = 0;
+        bool live = false;
+    };
+
+    void link(handle_t handle, Entry& entry) noexcept {
+        entry.prev = 0;
+        entry.next = heads_[entry.slot];
+        if (entry.next != 0) entries_[entry.next - 1].prev = handle;
+        heads_[entry.slot] = handle;
+    }
+
+    void unlink(Entry& entry) noexcept {
+        if (entry.prev != 0) {
+            entries_[entry.prev - 1].next = entry.next;
+        } else {
+            heads_[entry.slot] = entry.next;
+        }
+        if (entry.next != 0) entries_[entry.next - 1].prev = entry.prev;
+    }
+
+    void release(handle_t handle, Entry& entry) noexcept {
+        entry.live = false;
+        entry.next = free_head_;
+        free_head_ = handle;
+        --size_;
+    }
+
+    uint64_t tick_ns_;
+    uint64_t current_tick_;
+    size_t size_;
+    handle_t free_head_;
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::array<handle_t, Slots> heads_;
+    alignas(HFTTimer::CACHE_LINE_SIZE) std::array<Entry, Capacity> entries_;
+};
+
+} // namespace hft
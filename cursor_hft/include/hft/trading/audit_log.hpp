@@ -0,0 +1,549 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <array>
+#include <atomic>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "hft/timing/hft_timer.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+
+namespace hft {
+namespace trading {
+
+// ========================= 1. Record Format =========================
+//
+// An audit log is a sequence of segment files <base>.00000, <base>.00001, ...
+// Each segment is:
+//   AuditSegmentHeader                        (first 4096-byte block)
+//   AuditRecord[...]                          (4096-byte blocks of 128 records)
+// Records carry a log-wide sequence starting at 1; a zero sequence is
+// padding and only appears after the last record of a segment.
+
+constexpr uint64_t AUDIT_LOG_MAGIC = 0x3130445541544648ULL;  // "HFTAUD01"
+constexpr uint32_t AUDIT_LOG_VERSION = 1;
+constexpr size_t AUDIT_BLOCK_SIZE = 4096;                     // O_DIRECT transfer unit
+
+/**
+ * @brief Interned audit reasons; the log stores the code, never the text
+ */
+enum class AuditReason : uint8_t {
+    NONE = 0,
+    ORDER_CREATED = 1,
+    VALIDATION_COMPLETE = 2,
+    CANCEL_REQUESTED = 3,
+    FILL_PROCESSED = 4,
+    ORDER_ROUTED = 5,
+    ORDER_MODIFIED = 6,
+    EMERGENCY_STOP = 7,
+    ORDER_RETIRED = 8,
+    ORDER_SENT = 9,
+    VENUE_ACK = 10,
+    VENUE_REJECT = 11,
+    CANCEL_CONFIRMED = 12,
+    CANCEL_REJECTED = 13,
+    ORDER_EXPIRED = 14,
+    COUNT
+};
+
+[[nodiscard]] constexpr const char* audit_reason_text(AuditReason reason) noexcept {
+    switch (reason) {
+        case AuditReason::ORDER_CREATED: return "Order created";
+        case AuditReason::VALIDATION_COMPLETE: return "Validated";
+        case AuditReason::CANCEL_REQUESTED: return "Cancel requested";
+        case AuditReason::FILL_PROCESSED: return "Fill processed";
+        case AuditReason::ORDER_ROUTED: return "Order routed";
+        case AuditReason::ORDER_MODIFIED: return "Order modified";
+        case AuditReason::EMERGENCY_STOP: return "Emergency stop";
+        case AuditReason::ORDER_RETIRED: return "Order retired";
+        case AuditReason::ORDER_SENT: return "Sent to venue";
+        case AuditReason::VENUE_ACK: return "Venue ack";
+        case AuditReason::VENUE_REJECT: return "Venue reject";
+        case AuditReason::CANCEL_CONFIRMED: return "Cancelled";
+        case AuditReason::CANCEL_REJECTED: return "Cancel rejected";
+        case AuditReason::ORDER_EXPIRED: return "Expired";
+        default: return "";
+    }
+}
+
+struct alignas(32) AuditRecord {
+    uint64_t sequence = 0;                              // Log-wide, stamped by the writer (8 bytes)
+    uint64_t timestamp_ns = 0;                          // Event timestamp (8 bytes)
+    uint64_t order_id = 0;                              // Related order ID (8 bytes)
+    uint8_t old_state = 0;                              // Previous OrderState (1 byte)
+    uint8_t new_state = 0;                              // New OrderState (1 byte)
+    AuditReason reason = AuditReason::NONE;             // Interned reason (1 byte)
+    uint8_t venue = 0;                                  // VenueType involved (1 byte)
+    uint8_t producer = 0;                               // Producer ring, stamped by the writer (1 byte)
+    uint8_t _pad[3] = {};                               // Padding (3 bytes)
+    // Total: 8+8+8+1+1+1+1+1+3 = 32 bytes
+};
+static_assert(sizeof(AuditRecord) == 32, "AuditRecord must be 32 bytes");
+
+constexpr size_t AUDIT_RECORDS_PER_BLOCK = AUDIT_BLOCK_SIZE / sizeof(AuditRecord);
+
+struct alignas(64) AuditSegmentHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t segment_index;
+    uint64_t first_sequence;    // 0 for an empty segment
+    uint64_t record_count;      // 0 until the segment is closed
+    uint32_t record_size;       // sizeof(AuditRecord) at write time
+    uint32_t block_size;        // AUDIT_BLOCK_SIZE at write time
+    uint8_t closed;             // Set when the segment is finalized
+    uint8_t _pad[23];
+};
+static_assert(sizeof(AuditSegmentHeader) == 64, "AuditSegmentHeader must be 64 bytes");
+
+namespace detail {
+
+inline std::string audit_segment_path(const std::string& base_path, uint32_t index) {
+    char suffix[16];
+    std::snprintf(suffix, sizeof(suffix), ".%05u", index);
+    return base_path + suffix;
+}
+
+} // namespace detail
+
+// ========================= 2. Asynchronous Writer =========================
+
+/**
+ * @brief Durable binary audit trail fed through per-producer rings
+ *
+ * Each producer thread registers once and owns one SPSC ring, so logging
+ * an event is a single ring push (a full ring drops and counts instead of
+ * blocking). The writer side (start_writer() or explicit drain()/flush()
+ * calls, never both) stamps a log-wide sequence, stages records into
+ * 4096-byte blocks and writes whole batches with pwrite(). Files are opened
+ * O_DIRECT where the filesystem allows it; a part-filled tail block is
+ * rewritten in place until it fills. Segments roll over every
+ * records_per_segment records. Opening a path that already holds a log
+ * continues it: the next segment index and sequence number follow the
+ * existing segments, which are left untouched.
+ */
+class AuditLog {
+public:
+    static constexpr size_t MAX_PRODUCERS = 8;
+    static constexpr size_t RING_SIZE = 8192;                          // Records per producer ring
+    static constexpr size_t BATCH_BLOCKS = 16;                         // 64KB per write
+    static constexpr size_t BATCH_RECORDS = BATCH_BLOCKS * AUDIT_RECORDS_PER_BLOCK;
+    static constexpr size_t DEFAULT_RECORDS_PER_SEGMENT = 1 << 20;     // 32MB
+
+    struct Stats {
+        uint64_t records_logged = 0;        // Sequenced by the writer
+        uint64_t records_dropped = 0;       // Producer ring was full
+        uint64_t writes = 0;                // pwrite() calls
+        uint64_t syncs = 0;                 // fdatasync() calls
+        uint32_t segments_closed = 0;
+        bool direct_io = false;             // Current segment opened O_DIRECT
+    };
+
+    AuditLog() noexcept
+        : producer_count_(0), released_producers_(0), fd_(-1), direct_io_(false), failed_(false), segment_index_(0),
+          records_per_segment_(DEFAULT_RECORDS_PER_SEGMENT), segment_records_(0), segment_first_sequence_(0),
+          file_offset_(0), pending_(0), dirty_(false), next_sequence_(1), writes_(0), syncs_(0),
+          segments_closed_(0), writer_running_(false) {
+        for (auto& dropped : dropped_) dropped.store(0, std::memory_order_relaxed);
+    }
+    ~AuditLog() { (void)close(); }
+
+    AuditLog(const AuditLog&) = delete;
+    AuditLog& operator=(const AuditLog&) = delete;
+
+    /**
+     * @brief Open the log at base_path, continuing after any segments already there
+     * @param records_per_segment Rounded up to whole blocks
+     */
+    bool open(const std::string& base_path, size_t records_per_segment = DEFAULT_RECORDS_PER_SEGMENT) {
+        (void)close();
+        base_path_ = base_path;
+        uint64_t last_sequence = 0;
+        uint32_t existing = 0;
+        while (scan_segment(detail::audit_segment_path(base_path_, existing), last_sequence)) {
+            ++existing;
+        }
+        records_per_segment_ = std::max<size_t>(
+            (records_per_segment + AUDIT_RECORDS_PER_BLOCK - 1) / AUDIT_RECORDS_PER_BLOCK * AUDIT_RECORDS_PER_BLOCK,
+            AUDIT_RECORDS_PER_BLOCK);
+        segment_index_ = existing;
+        segments_closed_ = 0;
+        failed_ = false;
+        pending_ = 0;
+        next_sequence_ = last_sequence + 1;
+        return open_segment();
+    }
+
+    /**
+     * @brief Claim a producer ring for the calling thread
+     * @return Producer index, -1 when every ring is taken
+     */
+    [[nodiscard]] int register_producer() noexcept {
+        uint32_t released = released_producers_.load(std::memory_order_acquire);
+        while (released != 0) {
+            const uint32_t bit = released & (~released + 1);
+            if (released_producers_.compare_exchange_weak(released, released & ~bit, std::memory_order_acq_rel)) {
+                return __builtin_ctz(bit);
+            }
+        }
+        const size_t index = producer_count_.fetch_add(1, std::memory_order_acq_rel);
+        if (index >= MAX_PRODUCERS) {
+            producer_count_.fetch_sub(1, std::memory_order_acq_rel);
+            return -1;
+        }
+        return static_cast<int>(index);
+    }
+
+    /**
+     * @brief Give a producer ring back for a later register_producer()
+     *
+     * The releasing thread must have stopped recording to it; records
+     * already queued are still drained.
+     */
+    void release_producer(size_t producer) noexcept {
+        if (producer < MAX_PRODUCERS) {
+            released_producers_.fetch_or(1u << producer, std::memory_order_acq_rel);
+        }
+    }
+
+    /**
+     * @brief Hot path: hand one record to the writer
+     * @return false if the producer's ring was full (record dropped)
+     */
+    bool record(size_t producer, const AuditRecord& entry) noexcept {
+        if (__builtin_expect(!rings_[producer].try_push(entry), 0)) {
+            dropped_[producer].fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Writer side: sequence every queued record, writing full batches
+     * @return Records drained
+     */
+    size_t drain() noexcept {
+        if (fd_ < 0) return 0;
+        size_t drained = 0;
+        const size_t producers = std::min(producer_count_.load(std::memory_order_acquire), MAX_PRODUCERS);
+        for (size_t p = 0; p < producers; ++p) {
+            for (;;) {
+                if (pending_ >= BATCH_RECORDS && !write_pending(false)) return drained;
+                const size_t n = rings_[p].try_pop_batch(buffer_.begin() + pending_, buffer_.end());
+                if (n == 0) break;
+                for (size_t i = pending_; i < pending_ + n; ++i) {
+                    buffer_[i].sequence = next_sequence_++;
+                    buffer_[i].producer = static_cast<uint8_t>(p);
+                }
+                pending_ += n;
+                drained += n;
+                dirty_ = true;
+            }
+        }
+        if (pending_ >= AUDIT_RECORDS_PER_BLOCK) (void)write_pending(false);
+        return drained;
+    }
+
+    /**
+     * @brief Writer side: drain, write the part-filled block and fdatasync
+     */
+    bool flush() noexcept {
+        if (fd_ < 0 || failed_) return false;
+        (void)drain();
+        if (!dirty_) return true;
+        if (!write_pending(true)) return false;
+        ++syncs_;
+        if (::fdatasync(fd_) != 0) {
+            failed_ = true;
+            return false;
+        }
+        dirty_ = false;
+        return true;
+    }
+
+    /**
+     * @brief Drain on a background thread every poll_interval_ns
+     */
+    bool start_writer(uint64_t poll_interval_ns = 1000000) noexcept {
+        if (fd_ < 0 || writer_running_.load(std::memory_order_relaxed)) return false;
+        writer_running_.store(true, std::memory_order_release);
+        writer_thread_ = std::thread([this, poll_interval_ns] { writer_loop(poll_interval_ns); });
+        return true;
+    }
+
+    /**
+     * @brief Join the writer thread after a final flush
+     */
+    void stop_writer() noexcept {
+        if (!writer_running_.exchange(false, std::memory_order_acq_rel)) return;
+        if (writer_thread_.joinable()) writer_thread_.join();
+    }
+
+    /**
+     * @brief Stop the writer, flush and finalize the current segment
+     */
+    bool close() noexcept {
+        stop_writer();
+        if (fd_ < 0) return !failed_;
+        const bool flushed = flush();
+        const bool finalized = finalize_segment();
+        return flushed && finalized && !failed_;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+    [[nodiscard]] bool failed() const noexcept { return failed_; }
+    [[nodiscard]] bool writer_running() const noexcept { return writer_running_.load(std::memory_order_relaxed); }
+
+    /** @brief Writer-side counters; read once the writer is stopped or from the writer thread */
+    [[nodiscard]] Stats stats() const noexcept {
+        Stats stats;
+        stats.records_logged = next_sequence_ - 1;
+        for (const auto& dropped : dropped_) stats.records_dropped += dropped.load(std::memory_order_relaxed);
+        stats.writes = writes_;
+        stats.syncs = syncs_;
+        stats.segments_closed = segments_closed_;
+        stats.direct_io = direct_io_;
+        return stats;
+    }
+
+private:
+    using Ring = hft::SPSCRingBuffer<AuditRecord, RING_SIZE>;
+
+    // Count an existing segment and raise last_sequence to its last record; false if absent
+    static bool scan_segment(const std::string& path, uint64_t& last_sequence) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        AuditSegmentHeader header{};
+        if (::pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+            header.magic == AUDIT_LOG_MAGIC && header.record_size == sizeof(AuditRecord)) {
+            if (header.closed && header.record_count != 0) {
+                last_sequence = std::max(last_sequence, header.first_sequence + header.record_count - 1);
+            } else if (!header.closed) {
+                // Writer crashed: the last record is the one before the first padding
+                std::array<AuditRecord, AUDIT_RECORDS_PER_BLOCK> block;
+                for (off_t offset = AUDIT_BLOCK_SIZE;; offset += AUDIT_BLOCK_SIZE) {
+                    if (::pread(fd, block.data(), AUDIT_BLOCK_SIZE, offset) != static_cast<ssize_t>(AUDIT_BLOCK_SIZE)) break;
+                    const auto end = std::find_if(block.begin(), block.end(),
+                                                  [](const AuditRecord& r) { return r.sequence == 0; });
+                    if (end != block.begin()) last_sequence = std::max(last_sequence, (end - 1)->sequence);
+                    if (end != block.end()) break;
+                }
+            }
+        }
+        ::close(fd);
+        return true;
+    }
+
+    void writer_loop(uint64_t poll_interval_ns) noexcept {
+        while (writer_running_.load(std::memory_order_acquire)) {
+            (void)flush();
+            std::this_thread::sleep_for(std::chrono::nanoseconds(poll_interval_ns));
+        }
+        (void)flush();
+    }
+
+    bool open_segment() {
+        const std::string path = detail::audit_segment_path(base_path_, segment_index_);
+        direct_io_ = false;
+#ifdef O_DIRECT
+        fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | O_DIRECT, 0644);
+        direct_io_ = fd_ >= 0;
+#endif
+        if (fd_ < 0) {
+            // Filesystems without direct I/O (e.g. tmpfs) reject O_DIRECT at open
+            fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        }
+        if (fd_ < 0) {
+            failed_ = true;
+            return false;
+        }
+        segment_records_ = 0;
+        segment_first_sequence_ = 0;
+        file_offset_ = AUDIT_BLOCK_SIZE;
+        return write_header(false);
+    }
+
+    bool write_header(bool closed) noexcept {
+        std::memset(header_block_.data(), 0, header_block_.size());
+        AuditSegmentHeader header{};
+        header.magic = AUDIT_LOG_MAGIC;
+        header.version = AUDIT_LOG_VERSION;
+        header.segment_index = segment_index_;
+        header.first_sequence = segment_first_sequence_;
+        header.record_count = closed ? segment_records_ : 0;
+        header.record_size = sizeof(AuditRecord);
+        header.block_size = AUDIT_BLOCK_SIZE;
+        header.closed = closed ? 1 : 0;
+        std::memcpy(header_block_.data(), &header, sizeof(header));
+        if (!write_at(header_block_.data(), AUDIT_BLOCK_SIZE, 0)) {
+            failed_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool write_at(const void* data, size_t bytes, uint64_t offset) noexcept {
+        ++writes_;
+        ssize_t n = ::pwrite(fd_, data, bytes, static_cast<off_t>(offset));
+#ifdef O_DIRECT
+        if (n < 0 && errno == EINVAL && direct_io_) {
+            // Accepted at open but not for this transfer: continue buffered
+            direct_io_ = false;
+            (void)::fcntl(fd_, F_SETFL, ::fcntl(fd_, F_GETFL) & ~O_DIRECT);
+            ++writes_;
+            n = ::pwrite(fd_, data, bytes, static_cast<off_t>(offset));
+        }
+#endif
+        return n == static_cast<ssize_t>(bytes);
+    }
+
+    // Write whole blocks (and the part-filled tail if asked), rolling segments as they fill
+    bool write_pending(bool include_partial) noexcept {
+        if (failed_) return false;
+        size_t done = 0;
+        while (pending_ - done >= AUDIT_RECORDS_PER_BLOCK || (include_partial && pending_ > done)) {
+            if (segment_records_ == records_per_segment_) {
+                if (!finalize_segment()) return false;
+                ++segment_index_;
+                if (!open_segment()) return false;
+            }
+            const size_t room = records_per_segment_ - segment_records_;
+            size_t count = std::min((pending_ - done) / AUDIT_RECORDS_PER_BLOCK * AUDIT_RECORDS_PER_BLOCK, room);
+            const bool partial = count == 0;
+            if (partial) count = pending_ - done;
+
+            const size_t bytes = (count + AUDIT_RECORDS_PER_BLOCK - 1) / AUDIT_RECORDS_PER_BLOCK * AUDIT_BLOCK_SIZE;
+            std::memset(static_cast<void*>(buffer_.data() + done + count), 0, bytes - count * sizeof(AuditRecord));
+            if (segment_first_sequence_ == 0) segment_first_sequence_ = buffer_[done].sequence;
+            if (!write_at(buffer_.data() + done, bytes, file_offset_)) {
+                failed_ = true;
+                return false;
+            }
+            if (partial) break;  // Stays staged; the block is rewritten once more records arrive
+            file_offset_ += bytes;
+            segment_records_ += count;
+            done += count;
+        }
+        if (done != 0) {
+            std::memmove(static_cast<void*>(buffer_.data()), buffer_.data() + done, (pending_ - done) * sizeof(AuditRecord));
+            pending_ -= done;
+        }
+        return true;
+    }
+
+    bool finalize_segment() noexcept {
+        bool ok = !failed_;
+        if (ok) {
+            // A staged tail at this point belongs to this segment (close) or was never written (rollover)
+            const size_t tail = segment_records_ < records_per_segment_ ? pending_ : 0;
+            segment_records_ += tail;
+            ok = write_header(true) && ::fdatasync(fd_) == 0;
+            ++syncs_;
+            segment_records_ -= tail;
+            if (tail != 0) {
+                file_offset_ += AUDIT_BLOCK_SIZE;
+                pending_ = 0;
+            }
+        }
+        ::close(fd_);
+        fd_ = -1;
+        if (!ok) {
+            failed_ = true;
+            return false;
+        }
+        ++segments_closed_;
+        return true;
+    }
+
+    // Producer side
+    std::array<Ring, MAX_PRODUCERS> rings_;
+    alignas(64) std::atomic<size_t> producer_count_;
+    std::atomic<uint32_t> released_producers_;       // Bit per ring given back by release_producer()
+    alignas(64) std::array<std::atomic<uint64_t>, MAX_PRODUCERS> dropped_;
+
+    // Writer side
+    alignas(AUDIT_BLOCK_SIZE) std::array<AuditRecord, BATCH_RECORDS + AUDIT_RECORDS_PER_BLOCK> buffer_;
+    alignas(AUDIT_BLOCK_SIZE) std::array<uint8_t, AUDIT_BLOCK_SIZE> header_block_;
+    std::string base_path_;
+    int fd_;
+    bool direct_io_;
+    bool failed_;
+    uint32_t segment_index_;
+    size_t records_per_segment_;
+    size_t segment_records_;        // Records in whole blocks on disk
+    uint64_t segment_first_sequence_;
+    uint64_t file_offset_;          // Where the next whole block goes
+    size_t pending_;                // Staged records (a part-filled block at most after a write)
+    bool dirty_;                    // Staged or written since the last fdatasync
+    uint64_t next_sequence_;
+    uint64_t writes_;
+    uint64_t syncs_;
+    uint32_t segments_closed_;
+    std::atomic<bool> writer_running_;
+    std::thread writer_thread_;
+};
+
+// ========================= 3. Reader =========================
+
+/**
+ * @brief Loads every record of an audit log in sequence order
+ *
+ * Segments left unclosed (writer crashed) are read up to the first
+ * padding record. Not for the hot path.
+ */
+class AuditLogReader {
+public:
+    /**
+     * @brief Read <base_path>.00000, .00001, ... until a segment is missing
+     * @return false if no valid segment was found
+     */
+    bool open(const std::string& base_path) {
+        records_.clear();
+        segments_ = 0;
+        for (uint32_t index = 0; read_segment(detail::audit_segment_path(base_path, index)); ++index) {
+            ++segments_;
+        }
+        return segments_ != 0;
+    }
+
+    [[nodiscard]] size_t segment_count() const noexcept { return segments_; }
+    [[nodiscard]] const std::vector<AuditRecord>& records() const noexcept { return records_; }
+
+private:
+    bool read_segment(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+
+        AuditSegmentHeader header{};
+        bool ok = ::pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                  header.magic == AUDIT_LOG_MAGIC && header.version == AUDIT_LOG_VERSION &&
+                  header.record_size == sizeof(AuditRecord) && header.block_size == AUDIT_BLOCK_SIZE;
+        if (ok) {
+            std::array<AuditRecord, AUDIT_RECORDS_PER_BLOCK> block;
+            for (off_t offset = AUDIT_BLOCK_SIZE;; offset += AUDIT_BLOCK_SIZE) {
+                if (::pread(fd, block.data(), AUDIT_BLOCK_SIZE, offset) != static_cast<ssize_t>(AUDIT_BLOCK_SIZE)) break;
+                const auto end = std::find_if(block.begin(), block.end(),
+                                              [](const AuditRecord& r) { return r.sequence == 0; });
+                records_.insert(records_.end(), block.begin(), end);
+                if (end != block.end()) break;
+            }
+        }
+        ::close(fd);
+        return ok;
+    }
+
+    std::vector<AuditRecord> records_;
+    size_t segments_ = 0;
+};
+
+} // namespace trading
+} // namespace hft
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <utility>
+#include <cassert>
+#include "hft/memory/object_pool.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+#include "hft/market_data/treasury_instruments.hpp"
+#include "hft/trading/order_book.hpp"
+#include "hft/config/system_traits.hpp"
+
+namespace hft {
+namespace trading {
+
+using namespace hft::market_data;
+
+/**
+ * @brief One TreasuryOrderBook per TreasuryType over a single set of pools
+ *
+ * Runs the full curve (3M/6M bills, 2Y/5Y/10Y notes, 30Y bond) on one core:
+ * - Books indexed directly by TreasuryType (no switch on the hot path)
+ * - One order pool, level pool and update buffer shared by all books,
+ *   so idle instruments do not hold their own cold copies
+ * - Per-book order/level quotas carve up the shared pools; a hot
+ *   instrument fills its own quota and cannot starve the others
+ * - Books are plain TreasuryOrderBook, so existing strategies take
+ *   book(instrument) unchanged
+ *
+ * Updates from every book land in the shared buffer and carry their
+ * instrument_type. All books must be driven from a single thread
+ * (the buffer is SPSC).
+ *
+ * Performance targets:
+ * - Dispatch overhead: <5ns over the underlying book operation
+ */
+class alignas(64) BookManager {
+public:
+    static constexpr size_t MAX_INSTRUMENTS = config::SystemTraits::MAX_INSTRUMENTS;
+    static constexpr size_t ORDER_CAPACITY = config::SystemTraits::ORDER_POOL_SIZE;
+    static constexpr size_t LEVEL_CAPACITY = config::SystemTraits::LEVEL_POOL_SIZE;
+
+    BookManager() noexcept : BookManager(std::make_index_sequence<MAX_INSTRUMENTS>{}) {}
+
+    // No copy or move (books hold references to the pools)
+    BookManager(const BookManager&) = delete;
+    BookManager& operator=(const BookManager&) = delete;
+
+    /**
+     * @brief Book for an instrument (array index, no branching)
+     */
+    [[nodiscard]] TreasuryOrderBook& book(TreasuryType instrument) noexcept {
+        return books_[index(instrument)];
+    }
+
+    [[nodiscard]] const TreasuryOrderBook& book(TreasuryType instrument) const noexcept {
+        return books_[index(instrument)];
+    }
+
+    /**
+     * @brief Route an order to its instrument's book
+     */
+    [[nodiscard]] bool add_order(const TreasuryOrder& order) noexcept {
+        return books_[index(order.instrument_type)].add_order(order);
+    }
+
+    [[nodiscard]] TreasuryOrderBook::MatchResult match_order(const TreasuryOrder& order) noexcept {
+        return books_[index(order.instrument_type)].match_order(order);
+    }
+
+    /**
+     * @brief Cancel by instrument and ID (IDs are unique per book)
+     */
+    [[nodiscard]] bool cancel_order(TreasuryType instrument, uint64_t order_id) noexcept {
+        return books_[index(instrument)].cancel_order(order_id);
+    }
+
+    [[nodiscard]] bool modify_order(TreasuryType instrument, uint64_t order_id,
+                                    Price32nd new_price, uint64_t new_quantity) noexcept {
+        return books_[index(instrument)].modify_order(order_id, new_price, new_quantity);
+    }
+
+    /**
+     * @brief Dispatch a tick to handler(book, tick) for its instrument
+     */
+    template <typename Handler>
+    void on_tick(const TreasuryTick& tick, Handler&& handler) noexcept {
+        handler(books_[index(tick.instrument_type)], tick);
+    }
+
+    /**
+     * @brief Dispatch a batch of ticks; each goes to its own book
+     */
+    template <typename Handler>
+    void on_ticks(const TreasuryTick* ticks, size_t count, Handler&& handler) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            handler(books_[index(ticks[i].instrument_type)], ticks[i]);
+        }
+    }
+
+    /**
+     * @brief Visit every book in TreasuryType order
+     */
+    template <typename Fn>
+    void for_each_book(Fn&& fn) noexcept {
+        for (auto& b : books_) {
+            fn(b);
+        }
+    }
+
+    /**
+     * @brief Set an instrument's share of the shared pools
+     * @return false if the quotas across all books would exceed pool capacity
+     */
+    bool set_quota(TreasuryType instrument, size_t max_orders, size_t max_levels) noexcept {
+        const size_t idx = index(instrument);
+        size_t orders_total = max_orders;
+        size_t levels_total = max_levels;
+        for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+            if (i != idx) {
+                orders_total += books_[i].max_orders();
+                levels_total += books_[i].max_levels();
+            }
+        }
+        if (orders_total > ORDER_CAPACITY || levels_total > LEVEL_CAPACITY) {
+            return false;
+        }
+        books_[idx].set_capacity_limits(max_orders, max_levels);
+        return true;
+    }
+
+    /**
+     * @brief Clear every book and return all objects to the pools
+     */
+    void reset() noexcept {
+        for (auto& b : books_) {
+            b.reset();
+        }
+    }
+
+    [[nodiscard]] size_t total_orders() const noexcept { return order_pool_.size(); }
+    [[nodiscard]] size_t total_levels() const noexcept { return level_pool_.size(); }
+
+    [[nodiscard]] OrderBookUpdateBuffer& update_buffer() noexcept { return update_buffer_; }
+    [[nodiscard]] TreasuryOrderPool& order_pool() noexcept { return order_pool_; }
+    [[nodiscard]] PriceLevelPool& level_pool() noexcept { return level_pool_; }
+
+    [[nodiscard]] static constexpr size_t index(TreasuryType instrument) noexcept {
+        return static_cast<size_t>(instrument);
+    }
+
+private:
+    template <size_t... I>
+    explicit BookManager(std::index_sequence<I...>) noexcept
+        : books_{{TreasuryOrderBook(order_pool_, level_pool_, update_buffer_,
+                                    static_cast<TreasuryType>(I))...}} {
+        for (auto& b : books_) {
+            b.set_capacity_limits(ORDER_CAPACITY / MAX_INSTRUMENTS, LEVEL_CAPACITY / MAX_INSTRUMENTS);
+        }
+    }
+
+    // Pools declared first: books bind to them during construction
+    alignas(64) TreasuryOrderPool order_pool_;
+    alignas(64) PriceLevelPool level_pool_;
+    alignas(64) OrderBookUpdateBuffer update_buffer_;
+    alignas(64) std::array<TreasuryOrderBook, MAX_INSTRUMENTS> books_;
+};
+
+static_assert(BookManager::MAX_INSTRUMENTS <= TREASURY_TYPE_COUNT,
+              "BookManager needs one book per instrument slot");
+
+} // namespace trading
+} // namespace hft
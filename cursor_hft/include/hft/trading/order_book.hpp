@@ -2,16 +2,20 @@
 
 #include <cstdint>
 #include <cstddef>
-#include <unordered_map>
 #include <memory>
 #include <utility>
 #include <type_traits>
 #include <cassert>
 #include <algorithm>
+#include <array>
+#include <span>
+#include <vector>
 #include "hft/timing/hft_timer.hpp"
 #include "hft/memory/object_pool.hpp"
+#include "hft/memory/fixed_hash_map.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
 #include "hft/market_data/treasury_instruments.hpp"
+#include "hft/config/system_traits.hpp"
 
 namespace hft {
 namespace trading {
@@ -28,8 +32,9 @@ enum class OrderSide : uint8_t {
 };
 
 enum class OrderType : uint8_t {
-    LIMIT = 0,
-    MARKET = 1
+    LIMIT = 0,      // Matches what crosses, rests the remainder
+    MARKET = 1,     // Matches at any price, remainder cancelled
+    IOC = 2         // Matches up to limit price, remainder cancelled
 };
 
 // Treasury order structure - cache-aligned and optimized for object pools
@@ -84,20 +89,130 @@ struct OrderBookUpdate {
     Price32nd price;                             // 8 bytes
     uint64_t quantity;                           // 8 bytes
     hft::HFTTimer::timestamp_t timestamp_ns;    // 8 bytes
-    // Total: 48 bytes (fits in single cache line)
+    uint64_t aggressor_order_id;                 // 8 bytes - incoming order for matched trades (0 otherwise)
+    // Total: 56 bytes (fits in single cache line)
     
     OrderBookUpdate() noexcept = default;
     OrderBookUpdate(Type type, uint64_t id, TreasuryType inst, OrderSide s, 
                    Price32nd p, uint64_t qty) noexcept
+        : OrderBookUpdate(type, id, inst, s, p, qty, hft::HFTTimer::get_timestamp_ns()) {}
+    OrderBookUpdate(Type type, uint64_t id, TreasuryType inst, OrderSide s, 
+                   Price32nd p, uint64_t qty, hft::HFTTimer::timestamp_t ts,
+                   uint64_t aggressor_id = 0) noexcept
         : update_type(type), _pad0{}, order_id(id), instrument_type(inst), 
           side(s), _pad1{}, price(p), quantity(qty), 
-          timestamp_ns(hft::HFTTimer::get_timestamp_ns()) {}
+          timestamp_ns(ts), aggressor_order_id(aggressor_id) {}
 };
+static_assert(sizeof(OrderBookUpdate) <= CACHE_LINE_SIZE, "OrderBookUpdate must fit in one cache line");
 
 // Forward declaration for price level
 template<typename OrderType>
 struct PriceLevel;
 
+/**
+ * @brief Tick-indexed price ladder for O(1) price level lookup
+ *
+ * Treasury prices live on a fixed 1/64 grid (Price32nd), so a level can be
+ * addressed directly by its tick offset from a moving anchor instead of
+ * walking the sorted level list. The ladder stores one level pointer per tick
+ * in a contiguous array plus an occupancy bitmap, which lets the book find the
+ * nearest populated neighbour of a new level with a couple of ctz/clz word
+ * scans instead of pointer chasing.
+ *
+ * The ladder is only an index: levels still live in the level pool and stay
+ * linked in sorted order so depth iteration is unchanged. Levels outside the
+ * window are simply not indexed and fall back to the list walk.
+ *
+ * @tparam LevelType Price level type being indexed
+ * @tparam Ticks Window width in 1/64 ticks (multiple of 64, 0 disables)
+ */
+template<typename LevelType, size_t Ticks>
+class PriceLadder {
+    static_assert(Ticks % 64 == 0, "Ladder width must be a multiple of 64 ticks");
+
+public:
+    static constexpr size_t WORDS = Ticks / 64;
+
+    PriceLadder() noexcept : anchor_(0) { clear(); }
+
+    [[nodiscard]] bool contains(int64_t tick) const noexcept {
+        return static_cast<uint64_t>(tick - anchor_) < Ticks;
+    }
+
+    [[nodiscard]] LevelType* get(int64_t tick) const noexcept {
+        return contains(tick) ? slots_[static_cast<size_t>(tick - anchor_)] : nullptr;
+    }
+
+    void set(int64_t tick, LevelType* level) noexcept {
+        const size_t idx = static_cast<size_t>(tick - anchor_);
+        slots_[idx] = level;
+        occupied_[idx >> 6] |= (1ULL << (idx & 63));
+    }
+
+    void erase(int64_t tick) noexcept {
+        const size_t idx = static_cast<size_t>(tick - anchor_);
+        slots_[idx] = nullptr;
+        occupied_[idx >> 6] &= ~(1ULL << (idx & 63));
+    }
+
+    /**
+     * @brief Nearest indexed level strictly above tick (nullptr if none in window)
+     */
+    [[nodiscard]] LevelType* next_above(int64_t tick) const noexcept {
+        const int64_t rel = tick - anchor_;
+        if (rel >= static_cast<int64_t>(Ticks) - 1) {
+            return nullptr;
+        }
+        size_t idx = rel < 0 ? 0 : static_cast<size_t>(rel) + 1;
+        size_t word = idx >> 6;
+        uint64_t bits = occupied_[word] & (~0ULL << (idx & 63));
+        while (bits == 0) {
+            if (++word == WORDS) {
+                return nullptr;
+            }
+            bits = occupied_[word];
+        }
+        return slots_[(word << 6) + static_cast<size_t>(__builtin_ctzll(bits))];
+    }
+
+    /**
+     * @brief Nearest indexed level strictly below tick (nullptr if none in window)
+     */
+    [[nodiscard]] LevelType* next_below(int64_t tick) const noexcept {
+        const int64_t rel = tick - anchor_;
+        if (rel <= 0) {
+            return nullptr;
+        }
+        size_t idx = rel > static_cast<int64_t>(Ticks) ? Ticks - 1 : static_cast<size_t>(rel) - 1;
+        size_t word = idx >> 6;
+        uint64_t bits = occupied_[word] & (~0ULL >> (63 - (idx & 63)));
+        while (bits == 0) {
+            if (word-- == 0) {
+                return nullptr;
+            }
+            bits = occupied_[word];
+        }
+        return slots_[(word << 6) + 63 - static_cast<size_t>(__builtin_clzll(bits))];
+    }
+
+    void clear() noexcept {
+        occupied_.fill(0);
+        slots_.fill(nullptr);
+    }
+
+    [[nodiscard]] int64_t anchor() const noexcept { return anchor_; }
+    void set_anchor(int64_t anchor) noexcept { anchor_ = anchor; }
+
+private:
+    int64_t anchor_;
+    alignas(CACHE_LINE_SIZE) std::array<uint64_t, WORDS> occupied_;
+    alignas(CACHE_LINE_SIZE) std::array<LevelType*, Ticks> slots_;
+};
+
+// Linked-list mode: no ladder storage at all
+template<typename LevelType>
+class PriceLadder<LevelType, 0> {};
+
 /**
  * @brief High-performance order book for US Treasury markets
  * 
@@ -111,18 +226,28 @@ struct PriceLevel;
  * 
  * Design optimizations:
  * - Price levels stored in sorted containers for fast iteration
- * - Order hash map for O(1) order lookup by ID
+ * - Fixed-capacity open-addressing order index for O(1) lookup by ID
  * - Separate bid/ask sides to minimize cache misses
  * - Prefetching for common access patterns
  * - Template specialization for compile-time optimization
  * 
+ * Ladder mode (LadderTicks > 0) additionally indexes each side's levels in a
+ * PriceLadder keyed on 1/64 tick offset. Lookup of any level inside the window
+ * is O(1) and inserting a new level finds its list neighbour from the
+ * occupancy bitmap, so add/cancel cost no longer grows with book depth. The
+ * window re-centres on the touch whenever the best price drifts outside it.
+ * 
  * @tparam PriceType Price representation (default: Price32nd)
  * @tparam OrderType Order representation (default: TreasuryOrder)
  * @tparam SizeType Size representation (default: uint64_t)
+ * @tparam LadderTicks Ladder window width in 1/64 ticks (default: 0, linked list only)
  */
-template<typename PriceType = Price32nd, typename OrderType = TreasuryOrder, typename SizeType = uint64_t>
+template<typename PriceType = Price32nd, typename OrderType = TreasuryOrder, typename SizeType = uint64_t,
+         size_t LadderTicks = 0>
 class alignas(CACHE_LINE_SIZE) OrderBook {
     static_assert(std::is_trivially_copyable_v<PriceType>, "PriceType must be trivially copyable");
+    static_assert(LadderTicks == 0 || std::is_same_v<PriceType, Price32nd>,
+                  "Ladder mode requires the Price32nd 1/64 tick grid");
     static_assert(std::is_trivially_copyable_v<OrderType>, "OrderType must be trivially copyable");
     static_assert(alignof(OrderType) <= CACHE_LINE_SIZE, "OrderType alignment must not exceed cache line");
 
@@ -131,13 +256,14 @@ public:
     using order_type = OrderType;
     using size_type = SizeType;
     using order_id_type = uint64_t;
+    static constexpr bool LADDER_MODE = LadderTicks > 0;
     
     // Price level structure - optimized for cache efficiency
     struct alignas(CACHE_LINE_SIZE) PriceLevel {
         PriceType price;                         // 8 bytes - price at this level
         SizeType total_quantity;                 // 8 bytes - aggregate quantity
         uint32_t order_count;                    // 4 bytes - number of orders
-        uint32_t _pad0;                         // 4 bytes padding
+        uint32_t change_slot;                    // 4 bytes - pending depth change index + 1 (0 = clean)
         OrderType* first_order;                  // 8 bytes - pointer to first order (time priority)
         OrderType* last_order;                   // 8 bytes - pointer to last order
         PriceLevel* next_level;                  // 8 bytes - next price level (sorted)
@@ -145,12 +271,12 @@ public:
         uint8_t _pad1[16];                      // 16 bytes padding (total: 64)
         
         PriceLevel() noexcept 
-            : price{}, total_quantity(0), order_count(0), _pad0(0),
+            : price{}, total_quantity(0), order_count(0), change_slot(0),
               first_order(nullptr), last_order(nullptr), 
               next_level(nullptr), prev_level(nullptr), _pad1{} {}
         
         explicit PriceLevel(PriceType p) noexcept 
-            : price(p), total_quantity(0), order_count(0), _pad0(0),
+            : price(p), total_quantity(0), order_count(0), change_slot(0),
               first_order(nullptr), last_order(nullptr), 
               next_level(nullptr), prev_level(nullptr), _pad1{} {}
         
@@ -212,25 +338,44 @@ public:
         SizeType quantity;
         uint32_t order_count;
         
+        MarketDepth() noexcept = default;
         MarketDepth(PriceType p, SizeType q, uint32_t c) noexcept 
             : price(p), quantity(q), order_count(c) {}
     };
+    
+    // Single level change for incremental depth publication.
+    // quantity == 0 means the level was removed.
+    struct DepthChange {
+        PriceType price;
+        SizeType quantity;
+        uint32_t order_count;
+        OrderSide side;
+        uint8_t _pad0[3];
+    };
+    
+    // Result of draining the depth change journal
+    struct DepthDelta {
+        size_t count;                            // Changes written to the caller's buffer
+        bool snapshot_required;                  // Journal overflowed: re-snapshot the mirror
+    };
+    
+    static constexpr size_t MAX_PENDING_DEPTH_CHANGES = 1024;
 
     /**
      * @brief Constructor with object pool integration
      * @param order_pool Object pool for order allocation
      * @param level_pool Object pool for price level allocation
      * @param update_buffer Ring buffer for order book updates
+     * @param instrument Instrument stamped on book-generated updates
      */
-    explicit OrderBook(hft::ObjectPool<OrderType, 4096, false>& order_pool,
-                      hft::ObjectPool<PriceLevel, 1024, false>& level_pool,
-                      hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer) noexcept
+    explicit OrderBook(hft::ObjectPool<OrderType, config::SystemTraits::ORDER_POOL_SIZE, false>& order_pool,
+                      hft::ObjectPool<PriceLevel, config::SystemTraits::LEVEL_POOL_SIZE, false>& level_pool,
+                      hft::SPSCRingBuffer<OrderBookUpdate, config::SystemTraits::UPDATE_RING_SIZE>& update_buffer,
+                      TreasuryType instrument = TreasuryType::Note_10Y) noexcept
         : order_pool_(order_pool), level_pool_(level_pool), update_buffer_(update_buffer),
+          max_orders_(order_pool.capacity()), max_levels_(level_pool.capacity()), instrument_(instrument),
           best_bid_(nullptr), best_ask_(nullptr), total_bid_levels_(0), total_ask_levels_(0),
           last_update_ns_(0), total_operations_(0) {
-        
-        // Prefetch the hash map storage
-        orders_.reserve(4096);
     }
     
     // No copy or move semantics for performance
@@ -248,35 +393,41 @@ public:
             return false;
         }
         
-        // Check if order already exists - fast hash lookup
-        auto [it, inserted] = orders_.try_emplace(order.order_id, nullptr);
+        // Per-book quota when pools are shared between books
+        if (__builtin_expect(orders_.size() >= max_orders_, 0)) {
+            return false;
+        }
+        
+        // Check if order already exists - single probe reserves the slot
+        auto [entry, inserted] = orders_.try_emplace(order.order_id, nullptr);
         if (!inserted) {
-            return false; // Order ID already exists
+            return false; // Order ID already exists (or index full)
         }
         
         // Get order from pool
         OrderType* order_ptr = order_pool_.acquire();
         if (__builtin_expect(!order_ptr, 0)) {
-            orders_.erase(it);
+            orders_.erase(order.order_id);
             return false;
         }
         
         // Copy order data
         *order_ptr = order;
         
-        // Store in hash map immediately
-        it->second = order_ptr;
+        // Store in index immediately (entry stays valid: no index mutation in between)
+        *entry = order_ptr;
         
         // Find or create price level - optimized path
         PriceLevel* level = find_or_create_level_fast(order.price, order.side);
         if (__builtin_expect(!level, 0)) {
-            orders_.erase(it);
+            orders_.erase(order.order_id);
             order_pool_.release(order_ptr);
             return false;
         }
         
         // Add order to price level (maintains time priority)
         level->add_order(order_ptr);
+        note_level_change(level, order.side);
         
         // Update best prices if necessary - inline check
         if ((order.side == OrderSide::BID && (!best_bid_ || price_greater(order.price, best_bid_->price))) ||
@@ -306,12 +457,12 @@ public:
      * @return true if successful, false if order not found
      */
     [[nodiscard]] bool cancel_order(order_id_type order_id) noexcept {
-        auto it = orders_.find(order_id);
-        if (__builtin_expect(it == orders_.end(), 0)) {
+        OrderType* const* entry = orders_.find(order_id);
+        if (__builtin_expect(!entry, 0)) {
             return false;
         }
         
-        OrderType* order_ptr = it->second;
+        OrderType* order_ptr = *entry;
         OrderSide cancelled_side = order_ptr->side;
         PriceType cancelled_price = order_ptr->price;
         
@@ -323,9 +474,10 @@ public:
         
         // Remove from price level first
         level->remove_order(order_ptr);
+        note_level_change(level, cancelled_side);
         
         // Remove from order map and return to pool immediately
-        orders_.erase(it);
+        orders_.erase(order_id);
         order_pool_.release(order_ptr);
         
         // Clean up empty level - check inline for performance
@@ -342,7 +494,7 @@ public:
         // Batch notifications for performance
         if (__builtin_expect((total_operations_ & 0x3F) == 0, 0)) { // Every 64 operations
             send_update_batch(OrderBookUpdate::ORDER_CANCELLED, order_id,
-                           TreasuryType::Note_10Y, cancelled_side, cancelled_price, 0);
+                           instrument_, cancelled_side, cancelled_price, 0);
         }
         
         // Update statistics without timing overhead
@@ -360,12 +512,12 @@ public:
      */
     [[nodiscard]] bool modify_order(order_id_type order_id, PriceType new_price, SizeType new_quantity) noexcept {
         // For simplicity and atomicity, implement as cancel + add
-        auto it = orders_.find(order_id);
-        if (it == orders_.end() || new_quantity == 0) {
+        OrderType* const* entry = orders_.find(order_id);
+        if (!entry || new_quantity == 0) {
             return false;
         }
         
-        OrderType* old_order = it->second;
+        OrderType* old_order = *entry;
         OrderType new_order = *old_order;
         new_order.price = new_price;
         new_order.quantity = new_quantity;
@@ -418,8 +570,129 @@ public:
         return std::make_pair(PriceType{}, SizeType{0});
     }
 
+    /**
+     * @brief Look up a resting order by ID
+     * @return Pointer to the live order, or nullptr if not in the book
+     */
+    [[nodiscard]] const OrderType* get_order(order_id_type order_id) const noexcept {
+        OrderType* const* entry = orders_.find(order_id);
+        return entry ? *entry : nullptr;
+    }
+
+    /**
+     * @brief Look up a price level (its orders are linked in time priority)
+     * @return Pointer to the level, or nullptr if no orders rest at that price
+     */
+    [[nodiscard]] const PriceLevel* get_level(OrderSide side, PriceType price) const noexcept {
+        return find_level_fast(price, side);
+    }
+
+    /**
+     * @brief Reduce a resting order's open quantity in place, keeping its time priority
+     * @param new_remaining New open quantity (must be below the current one and non-zero)
+     * @return false if the order is not in the book or new_remaining is out of range
+     */
+    [[nodiscard]] bool reduce_order(order_id_type order_id, SizeType new_remaining) noexcept {
+        OrderType* const* entry = orders_.find(order_id);
+        if (!entry || new_remaining == 0 || new_remaining >= (*entry)->remaining_quantity) {
+            return false;
+        }
+        OrderType* order_ptr = *entry;
+        PriceLevel* level = find_level_fast(order_ptr->price, order_ptr->side);
+        if (__builtin_expect(!level, 0)) {
+            return false;
+        }
+        level->total_quantity -= order_ptr->remaining_quantity - new_remaining;
+        order_ptr->remaining_quantity = new_remaining;
+        note_level_change(level, order_ptr->side);
+        ++total_operations_;
+        return true;
+    }
+
+    /**
+     * @brief Write market depth for a side into a caller-provided buffer (no allocation)
+     * @param side Bid or ask side
+     * @param out Destination; at most out.size() levels are written, best first
+     * @return Number of levels written
+     */
+    size_t get_market_depth(OrderSide side, std::span<MarketDepth> out) const noexcept {
+        const PriceLevel* current = (side == OrderSide::BID) ? best_bid_ : best_ask_;
+        size_t count = 0;
+        
+        while (count < out.size() && current) {
+            out[count].price = current->price;
+            out[count].quantity = current->total_quantity;
+            out[count].order_count = current->order_count;
+            ++count;
+            current = current->next_level;
+        }
+        
+        return count;
+    }
+    
+    /**
+     * @brief Fill parallel price/size arrays from the book (e.g. strategy MarketUpdate depth)
+     * @param side Bid or ask side
+     * @param prices Destination prices, best first
+     * @param sizes Destination aggregate sizes (same length as prices)
+     * @return Number of levels written; remaining entries are zeroed
+     */
+    size_t get_depth_levels(OrderSide side, std::span<PriceType> prices, std::span<SizeType> sizes) const noexcept {
+        assert(prices.size() == sizes.size());
+        const PriceLevel* current = (side == OrderSide::BID) ? best_bid_ : best_ask_;
+        size_t count = 0;
+        
+        while (count < prices.size() && current) {
+            prices[count] = current->price;
+            sizes[count] = current->total_quantity;
+            ++count;
+            current = current->next_level;
+        }
+        
+        for (size_t i = count; i < prices.size(); ++i) {
+            prices[i] = PriceType{};
+            sizes[i] = SizeType{0};
+        }
+        
+        return count;
+    }
+    
+    /**
+     * @brief Enable or disable the incremental depth change journal
+     * 
+     * When enabled every level whose aggregate quantity or order count changes
+     * is recorded once per drain interval (repeat changes to the same level
+     * update the pending record in place). Enabling starts with a
+     * snapshot_required delta so the consumer seeds its mirror from
+     * get_market_depth().
+     */
+    void set_depth_tracking(bool enabled) noexcept {
+        clear_depth_changes();
+        depth_tracking_ = enabled;
+        depth_overflow_ = enabled;
+    }
+    
+    /**
+     * @brief Drain level changes since the last drain into a caller buffer
+     * @param out Destination for changes, in the order levels first changed
+     * @return Number of changes written and whether a full re-snapshot is needed
+     */
+    [[nodiscard]] DepthDelta drain_depth_changes(std::span<DepthChange> out) noexcept {
+        const size_t count = std::min(pending_depth_changes_, out.size());
+        std::copy_n(depth_changes_.begin(), count, out.begin());
+        
+        DepthDelta delta{count, depth_overflow_ || count < pending_depth_changes_};
+        clear_depth_changes();
+        depth_overflow_ = false;
+        return delta;
+    }
+    
+    [[nodiscard]] size_t pending_depth_changes() const noexcept { return pending_depth_changes_; }
+
     /**
      * @brief Get market depth for a side up to specified levels
+     * 
+     * Allocates a vector per call; hot paths should use the span overload.
      * @param side Bid or ask side
      * @param max_levels Maximum number of levels to return
      * @return Vector of market depth levels
@@ -477,9 +750,13 @@ public:
             current_order = next_order;
         }
         
+        if (orders_affected > 0) {
+            note_level_change(level, side);
+        }
+        
         // Clean up empty level
         if (level->is_empty()) {
-            remove_level(level);
+            remove_level(level, side);
         }
         
         // Update best prices
@@ -487,7 +764,7 @@ public:
         
         // Send trade notification
         send_update(OrderBookUpdate::TRADE_EXECUTED, 0,
-                   TreasuryType::Note_10Y, side, price, quantity - remaining_qty);
+                   instrument_, side, price, quantity - remaining_qty);
         
         // Update statistics
         ++total_operations_;
@@ -495,6 +772,120 @@ public:
         return orders_affected;
     }
 
+    /**
+     * @brief Result of matching an incoming order against the book
+     */
+    struct MatchResult {
+        SizeType filled_quantity;                // Quantity executed against resting orders
+        SizeType remaining_quantity;             // Unfilled quantity (rested or cancelled)
+        uint32_t trade_count;                    // Resting orders hit
+        bool rested;                             // Remainder was added to the book
+        bool accepted;                           // false if rejected (invalid or duplicate ID)
+    };
+    
+    static constexpr size_t TRADE_BATCH_SIZE = 32;
+    
+    /**
+     * @brief Match an incoming order with price-time priority (matching engine mode)
+     * 
+     * The order sweeps the opposite side from the touch while it crosses
+     * (always for MARKET), filling resting orders FIFO within each level and
+     * partially filling the last one hit. Any remainder rests for LIMIT
+     * orders and is cancelled for MARKET/IOC. Each fill emits a
+     * TRADE_EXECUTED update (order_id = resting order, aggressor_order_id =
+     * incoming order, side = resting side); updates are staged locally and
+     * pushed to update_buffer_ in batches of TRADE_BATCH_SIZE, all stamped
+     * with one timestamp per call.
+     * 
+     * add_order() keeps its passive behaviour for callers that maintain a
+     * mirrored venue book.
+     * 
+     * @param order Incoming order (remaining_quantity is the size to match)
+     * @return Fill summary
+     */
+    [[nodiscard]] MatchResult match_order(const OrderType& order) noexcept {
+        MatchResult result{0, order.remaining_quantity, 0, false, false};
+        
+        const bool is_market = order.type == hft::trading::OrderType::MARKET;
+        if (__builtin_expect(order.order_id == 0 || order.remaining_quantity == 0 ||
+                             (!is_market && order.price.whole == 0), 0)) {
+            return result;
+        }
+        // Reject duplicates before trading so a resting remainder cannot fail afterwards
+        if (__builtin_expect(orders_.contains(order.order_id), 0)) {
+            return result;
+        }
+        result.accepted = true;
+        
+        const OrderSide contra_side = (order.side == OrderSide::BID) ? OrderSide::ASK : OrderSide::BID;
+        PriceLevel*& contra_best = (contra_side == OrderSide::BID) ? best_bid_ : best_ask_;
+        const hft::HFTTimer::timestamp_t ts = hft::HFTTimer::get_timestamp_ns();
+        
+        std::array<OrderBookUpdate, TRADE_BATCH_SIZE> trades;
+        size_t staged = 0;
+        SizeType remaining = order.remaining_quantity;
+        
+        while (remaining > 0 && contra_best) {
+            PriceLevel* level = contra_best;
+            if (!is_market && !crosses(order.side, order.price, level->price)) {
+                break;
+            }
+            
+            OrderType* resting = level->first_order;
+            while (resting && remaining > 0) {
+                OrderType* next = resting->next_order;
+                const SizeType fill_qty = std::min(remaining, resting->remaining_quantity);
+                
+                resting->remaining_quantity -= fill_qty;
+                level->total_quantity -= fill_qty;
+                remaining -= fill_qty;
+                ++result.trade_count;
+                
+                trades[staged++] = OrderBookUpdate(OrderBookUpdate::TRADE_EXECUTED, resting->order_id,
+                                                   resting->instrument_type, contra_side,
+                                                   level->price, fill_qty, ts, order.order_id);
+                if (__builtin_expect(staged == TRADE_BATCH_SIZE, 0)) {
+                    flush_trades(trades.data(), staged);
+                    staged = 0;
+                }
+                
+                if (resting->is_filled()) {
+                    level->remove_order(resting, false);
+                    orders_.erase(resting->order_id);
+                    order_pool_.release(resting);
+                }
+                resting = next;
+            }
+            
+            note_level_change(level, contra_side);
+            if (level->is_empty()) {
+                remove_level_fast(level, contra_side);
+            }
+        }
+        
+        if (staged > 0) {
+            flush_trades(trades.data(), staged);
+        }
+        
+        result.filled_quantity = order.remaining_quantity - remaining;
+        result.remaining_quantity = remaining;
+        
+        if (remaining > 0 && order.type == hft::trading::OrderType::LIMIT) {
+            OrderType rest = order;
+            rest.remaining_quantity = remaining;
+            result.rested = add_order(rest);
+        }
+        
+        total_matched_quantity_ += result.filled_quantity;
+        total_trades_ += result.trade_count;
+        ++total_operations_;
+        
+        return result;
+    }
+    
+    [[nodiscard]] uint64_t total_trades() const noexcept { return total_trades_; }
+    [[nodiscard]] uint64_t total_matched_quantity() const noexcept { return total_matched_quantity_; }
+
     /**
      * @brief Get order book statistics
      */
@@ -520,44 +911,81 @@ public:
         };
     }
 
+    /**
+     * @brief Cap this book's share of its pools
+     * 
+     * Lets several books draw from one order/level pool without a single
+     * busy book exhausting capacity the others need. Limits cannot exceed
+     * the pool capacity; existing orders are not affected.
+     */
+    void set_capacity_limits(size_t max_orders, size_t max_levels) noexcept {
+        max_orders_ = std::min(max_orders, order_pool_.capacity());
+        max_levels_ = std::min(max_levels, level_pool_.capacity());
+    }
+    
+    [[nodiscard]] size_t max_orders() const noexcept { return max_orders_; }
+    [[nodiscard]] size_t max_levels() const noexcept { return max_levels_; }
+    [[nodiscard]] TreasuryType instrument() const noexcept { return instrument_; }
+
     /**
      * @brief Reset the order book (clear all orders and levels)
      */
     void reset() noexcept {
         // Release all orders back to pool
-        for (auto& [order_id, order_ptr] : orders_) {
+        orders_.for_each([this](order_id_type, OrderType* order_ptr) {
             order_pool_.release(order_ptr);
-        }
+        });
         orders_.clear();
         
+        // Mirrors built from the journal are now stale
+        clear_depth_changes();
+        depth_overflow_ = depth_tracking_;
+        
         // Release all levels back to pool
         release_all_levels();
         
         best_bid_ = best_ask_ = nullptr;
         total_bid_levels_ = total_ask_levels_ = 0;
         total_operations_ = 0;
+        total_trades_ = total_matched_quantity_ = 0;
     }
 
     // Note: Static asserts for complete type moved outside class
 
 private:
     // Object pool references for zero allocation
-    hft::ObjectPool<OrderType, 4096, false>& order_pool_;
-    hft::ObjectPool<PriceLevel, 1024, false>& level_pool_;
-    hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer_;
+    hft::ObjectPool<OrderType, config::SystemTraits::ORDER_POOL_SIZE, false>& order_pool_;
+    hft::ObjectPool<PriceLevel, config::SystemTraits::LEVEL_POOL_SIZE, false>& level_pool_;
+    hft::SPSCRingBuffer<OrderBookUpdate, config::SystemTraits::UPDATE_RING_SIZE>& update_buffer_;
+    size_t max_orders_;                          // Quota within a shared order pool
+    size_t max_levels_;                          // Quota within a shared level pool
+    TreasuryType instrument_;
     
     // Cache-aligned core data structures
     alignas(CACHE_LINE_SIZE) PriceLevel* best_bid_;
     alignas(CACHE_LINE_SIZE) PriceLevel* best_ask_;
     
-    // Order lookup map for O(1) access by order ID
-    alignas(CACHE_LINE_SIZE) std::unordered_map<order_id_type, OrderType*> orders_;
+    // Order lookup index for O(1) access by order ID (sized to the order pool, never allocates)
+    alignas(CACHE_LINE_SIZE) hft::FixedHashMap<order_id_type, OrderType*, config::SystemTraits::ORDER_POOL_SIZE> orders_;
+    
+    // Incremental depth change journal (level pointer kept to clear change_slot on drain)
+    alignas(CACHE_LINE_SIZE) std::array<DepthChange, MAX_PENDING_DEPTH_CHANGES> depth_changes_;
+    alignas(CACHE_LINE_SIZE) std::array<PriceLevel*, MAX_PENDING_DEPTH_CHANGES> depth_change_levels_;
+    size_t pending_depth_changes_ = 0;
+    bool depth_tracking_ = false;
+    bool depth_overflow_ = false;
+    
+    // Tick-indexed ladders (empty in linked-list mode)
+    [[no_unique_address]] PriceLadder<PriceLevel, LadderTicks> bid_ladder_;
+    [[no_unique_address]] PriceLadder<PriceLevel, LadderTicks> ask_ladder_;
     
     // Statistics and metadata
     alignas(CACHE_LINE_SIZE) size_t total_bid_levels_;
     alignas(CACHE_LINE_SIZE) size_t total_ask_levels_;
     alignas(CACHE_LINE_SIZE) hft::HFTTimer::timestamp_t last_update_ns_;
     alignas(CACHE_LINE_SIZE) size_t total_operations_;
+    uint64_t total_trades_ = 0;
+    uint64_t total_matched_quantity_ = 0;
 
     // Internal helper methods
 
@@ -575,6 +1003,14 @@ private:
      * @brief Find existing price level
      */
     [[nodiscard]] PriceLevel* find_level(PriceType price, OrderSide side) const noexcept {
+        if constexpr (LADDER_MODE) {
+            const auto& ladder = (side == OrderSide::BID) ? bid_ladder_ : ask_ladder_;
+            const int64_t tick = price_to_ticks(price);
+            if (__builtin_expect(ladder.contains(tick), 1)) {
+                return ladder.get(tick);
+            }
+        }
+        
         PriceLevel* current = (side == OrderSide::BID) ? best_bid_ : best_ask_;
         
         while (current) {
@@ -608,6 +1044,9 @@ private:
         }
         
         // Create new level
+        if (__builtin_expect(total_bid_levels_ + total_ask_levels_ >= max_levels_, 0)) {
+            return nullptr;
+        }
         PriceLevel* new_level = level_pool_.acquire();
         if (!new_level) {
             return nullptr;
@@ -636,12 +1075,38 @@ private:
         if (*best_ptr == nullptr) {
             // First level for this side
             *best_ptr = new_level;
+            if constexpr (LADDER_MODE) {
+                recenter_ladder(side);
+            }
             return;
         }
         
         PriceLevel* current = *best_ptr;
         PriceLevel* prev = nullptr;
         
+        if constexpr (LADDER_MODE) {
+            auto& ladder = (side == OrderSide::BID) ? bid_ladder_ : ask_ladder_;
+            const int64_t tick = price_to_ticks(new_level->price);
+            if (__builtin_expect(ladder.contains(tick), 1)) {
+                // Neighbours come from the occupancy bitmap: the level that
+                // precedes us in list order is the next better indexed price.
+                PriceLevel* better = (side == OrderSide::BID) ? ladder.next_above(tick) : ladder.next_below(tick);
+                if (better) {
+                    link_level_after(new_level, better);
+                    ladder.set(tick, new_level);
+                    return;
+                }
+                PriceLevel* worse = (side == OrderSide::BID) ? ladder.next_below(tick) : ladder.next_above(tick);
+                if (worse) {
+                    link_level_before(new_level, worse, best_ptr);
+                    ladder.set(tick, new_level);
+                    return;
+                }
+                // Nothing indexed on either side: fall through to the list walk
+                ladder.set(tick, new_level);
+            }
+        }
+        
         // Find insertion point
         while (current) {
             bool should_insert_before = (side == OrderSide::BID) ?
@@ -670,26 +1135,50 @@ private:
         if (current) {
             current->prev_level = new_level;
         }
+        
+        if constexpr (LADDER_MODE) {
+            // A new best outside the window means price has drifted: re-centre
+            if (!prev && !ladder_indexes(new_level, side)) {
+                recenter_ladder(side);
+            }
+        }
+    }
+    
+    /**
+     * @brief Link level into the sorted list directly after an existing level
+     */
+    static void link_level_after(PriceLevel* new_level, PriceLevel* prev) noexcept {
+        new_level->prev_level = prev;
+        new_level->next_level = prev->next_level;
+        if (prev->next_level) {
+            prev->next_level->prev_level = new_level;
+        }
+        prev->next_level = new_level;
+    }
+    
+    /**
+     * @brief Link level into the sorted list directly before an existing level
+     */
+    static void link_level_before(PriceLevel* new_level, PriceLevel* next, PriceLevel** best_ptr) noexcept {
+        new_level->next_level = next;
+        new_level->prev_level = next->prev_level;
+        if (next->prev_level) {
+            next->prev_level->next_level = new_level;
+        } else {
+            *best_ptr = new_level;
+        }
+        next->prev_level = new_level;
     }
 
     /**
      * @brief Remove empty price level
      */
-    void remove_level(PriceLevel* level) noexcept {
+    void remove_level(PriceLevel* level, OrderSide side) noexcept {
         assert(level->is_empty());
         
-        // Determine which side this level belongs to BEFORE removing from linked list
-        bool is_bid_level = (level == best_bid_);
-        if (!is_bid_level) {
-            PriceLevel* current = best_bid_;
-            while (current) {
-                if (current == level) {
-                    is_bid_level = true;
-                    break;
-                }
-                current = current->next_level;
-            }
-        }
+        const bool is_bid_level = (side == OrderSide::BID);
+        unindex_level(level, side);
+        note_level_removed(level, side);
         
         // Update linked list
         if (level->prev_level) {
@@ -716,6 +1205,13 @@ private:
         
         // Return to pool
         level_pool_.release(level);
+        
+        if constexpr (LADDER_MODE) {
+            PriceLevel* best = is_bid_level ? best_bid_ : best_ask_;
+            if (best && !ladder_indexes(best, side)) {
+                recenter_ladder(side);
+            }
+        }
     }
 
     /**
@@ -739,6 +1235,11 @@ private:
         }
         
         best_bid_ = best_ask_ = nullptr;
+        
+        if constexpr (LADDER_MODE) {
+            bid_ladder_.clear();
+            ask_ladder_.clear();
+        }
     }
 
     /**
@@ -750,14 +1251,14 @@ private:
             while (best_bid_ && best_bid_->is_empty()) {
                 PriceLevel* empty_level = best_bid_;
                 best_bid_ = best_bid_->next_level;
-                remove_level(empty_level);
+                remove_level(empty_level, OrderSide::BID);
             }
         } else {
             // Find new best ask (lowest price)
             while (best_ask_ && best_ask_->is_empty()) {
                 PriceLevel* empty_level = best_ask_;
                 best_ask_ = best_ask_->next_level;
-                remove_level(empty_level);
+                remove_level(empty_level, OrderSide::ASK);
             }
         }
     }
@@ -789,6 +1290,9 @@ private:
         }
         
         // Create new level
+        if (__builtin_expect(total_bid_levels_ + total_ask_levels_ >= max_levels_, 0)) {
+            return nullptr;
+        }
         PriceLevel* new_level = level_pool_.acquire();
         if (__builtin_expect(!new_level, 0)) {
             return nullptr;
@@ -812,12 +1316,21 @@ private:
      * @brief Fast level removal with optimized best price updates
      */
     inline void remove_level_fast(PriceLevel* level, OrderSide side) noexcept {
+        unindex_level(level, side);
+        note_level_removed(level, side);
+        
         // Update best pointers efficiently
         if (level == best_bid_) {
             best_bid_ = level->next_level;
+            if (best_bid_) {
+                best_bid_->prev_level = nullptr;
+            }
             --total_bid_levels_;
         } else if (level == best_ask_) {
             best_ask_ = level->next_level;
+            if (best_ask_) {
+                best_ask_->prev_level = nullptr;
+            }
             --total_ask_levels_;
         } else {
             // Remove from middle of list
@@ -837,6 +1350,133 @@ private:
         
         // Return to pool
         level_pool_.release(level);
+        
+        if constexpr (LADDER_MODE) {
+            PriceLevel* best = (side == OrderSide::BID) ? best_bid_ : best_ask_;
+            if (__builtin_expect(best && !ladder_indexes(best, side), 0)) {
+                recenter_ladder(side);
+            }
+        }
+    }
+    
+    /**
+     * @brief Record a level's new aggregate state in the depth journal
+     */
+    inline void note_level_change(PriceLevel* level, OrderSide side) noexcept {
+        if (__builtin_expect(!depth_tracking_, 1)) {
+            return;
+        }
+        
+        if (level->change_slot != 0) {
+            // Already pending this interval: update in place
+            DepthChange& change = depth_changes_[level->change_slot - 1];
+            change.quantity = level->total_quantity;
+            change.order_count = level->order_count;
+            return;
+        }
+        
+        if (__builtin_expect(pending_depth_changes_ == MAX_PENDING_DEPTH_CHANGES, 0)) {
+            depth_overflow_ = true;
+            return;
+        }
+        
+        DepthChange& change = depth_changes_[pending_depth_changes_];
+        change.price = level->price;
+        change.quantity = level->total_quantity;
+        change.order_count = level->order_count;
+        change.side = side;
+        depth_change_levels_[pending_depth_changes_] = level;
+        level->change_slot = static_cast<uint32_t>(++pending_depth_changes_);
+    }
+    
+    /**
+     * @brief Record a level leaving the book (quantity 0) before it returns to the pool
+     */
+    inline void note_level_removed(PriceLevel* level, OrderSide side) noexcept {
+        if (__builtin_expect(!depth_tracking_, 1)) {
+            return;
+        }
+        note_level_change(level, side);
+        if (level->change_slot != 0) {
+            // Detach so the drain does not touch a recycled level
+            depth_change_levels_[level->change_slot - 1] = nullptr;
+            level->change_slot = 0;
+        }
+    }
+    
+    /**
+     * @brief Drop all pending journal entries and mark their levels clean
+     */
+    void clear_depth_changes() noexcept {
+        for (size_t i = 0; i < pending_depth_changes_; ++i) {
+            if (depth_change_levels_[i]) {
+                depth_change_levels_[i]->change_slot = 0;
+            }
+        }
+        pending_depth_changes_ = 0;
+    }
+    
+    /**
+     * @brief Tick index of a Price32nd on the 1/64 grid
+     */
+    [[nodiscard]] static int64_t price_to_ticks(const Price32nd& price) noexcept {
+        return static_cast<int64_t>(price.whole) * 64 +
+               static_cast<int64_t>(price.thirty_seconds) * 2 +
+               static_cast<int64_t>(price.half_32nds);
+    }
+    
+    /**
+     * @brief Whether the ladder currently indexes this level
+     */
+    [[nodiscard]] bool ladder_indexes(const PriceLevel* level, OrderSide side) const noexcept {
+        if constexpr (LADDER_MODE) {
+            const auto& ladder = (side == OrderSide::BID) ? bid_ladder_ : ask_ladder_;
+            return ladder.get(price_to_ticks(level->price)) == level;
+        } else {
+            return false;
+        }
+    }
+    
+    /**
+     * @brief Drop a level from its side's ladder before it leaves the book
+     */
+    inline void unindex_level(PriceLevel* level, OrderSide side) noexcept {
+        if constexpr (LADDER_MODE) {
+            auto& ladder = (side == OrderSide::BID) ? bid_ladder_ : ask_ladder_;
+            const int64_t tick = price_to_ticks(level->price);
+            if (ladder.get(tick) == level) {
+                ladder.erase(tick);
+            }
+        }
+    }
+    
+    /**
+     * @brief Re-anchor a side's ladder on its best price and rebuild the index
+     * 
+     * Off the hot path: only runs when the touch drifts outside the window.
+     * The best level sits in the middle of the window so the book can move
+     * half a window either way before the next re-centre.
+     */
+    void recenter_ladder(OrderSide side) noexcept {
+        if constexpr (LADDER_MODE) {
+            auto& ladder = (side == OrderSide::BID) ? bid_ladder_ : ask_ladder_;
+            PriceLevel* current = (side == OrderSide::BID) ? best_bid_ : best_ask_;
+            ladder.clear();
+            if (!current) {
+                return;
+            }
+            ladder.set_anchor(price_to_ticks(current->price) - static_cast<int64_t>(LadderTicks / 2));
+            
+            // The list is sorted away from the touch, so stop at the window edge
+            while (current) {
+                const int64_t tick = price_to_ticks(current->price);
+                if (!ladder.contains(tick)) {
+                    break;
+                }
+                ladder.set(tick, current);
+                current = current->next_level;
+            }
+        }
     }
     
     /**
@@ -853,6 +1493,22 @@ private:
         last_update_ns_ = hft::HFTTimer::get_timestamp_ns();
     }
 
+    /**
+     * @brief Push a batch of staged trade events (non-blocking; overflow is dropped like other updates)
+     */
+    inline void flush_trades(const OrderBookUpdate* trades, size_t count) noexcept {
+        (void)update_buffer_.try_push_batch(trades, trades + count);
+        last_update_ns_ = trades[count - 1].timestamp_ns;
+    }
+    
+    /**
+     * @brief Whether an incoming order at `price` crosses a resting level
+     */
+    [[nodiscard]] static bool crosses(OrderSide incoming_side, const PriceType& price, const PriceType& level_price) noexcept {
+        return incoming_side == OrderSide::BID ? !price_less(price, level_price)
+                                               : !price_greater(price, level_price);
+    }
+
     /**
      * @brief Send order book update notification
      */
@@ -894,13 +1550,20 @@ private:
 // Type aliases for common instantiations  
 using TreasuryOrderBook = OrderBook<Price32nd, TreasuryOrder, uint64_t>;
 
+// Ladder-indexed book: 4096 ticks = 64 points of 1/64 price range per side
+constexpr size_t TREASURY_LADDER_TICKS = 4096;
+using TreasuryLadderOrderBook = OrderBook<Price32nd, TreasuryOrder, uint64_t, TREASURY_LADDER_TICKS>;
+
 // Static asserts for complete types
 static_assert(alignof(TreasuryOrderBook) == CACHE_LINE_SIZE, "OrderBook must be cache-aligned");
+static_assert(alignof(TreasuryLadderOrderBook) == CACHE_LINE_SIZE, "OrderBook must be cache-aligned");
 
 // Object pool type aliases for order book components
-using TreasuryOrderPool = hft::ObjectPool<TreasuryOrder, 4096, false>;
-using PriceLevelPool = hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024, false>;
-using OrderBookUpdateBuffer = hft::SPSCRingBuffer<OrderBookUpdate, 8192>;
+// (sized by config::SystemTraits; spell these, not the capacities, in signatures)
+using TreasuryOrderPool = hft::ObjectPool<TreasuryOrder, config::SystemTraits::ORDER_POOL_SIZE, false>;
+using PriceLevelPool = hft::ObjectPool<TreasuryOrderBook::PriceLevel, config::SystemTraits::LEVEL_POOL_SIZE, false>;
+using LadderPriceLevelPool = hft::ObjectPool<TreasuryLadderOrderBook::PriceLevel, config::SystemTraits::LEVEL_POOL_SIZE, false>;
+using OrderBookUpdateBuffer = hft::SPSCRingBuffer<OrderBookUpdate, config::SystemTraits::UPDATE_RING_SIZE>;
 
 } // namespace trading
 } // namespace hft
\ No newline at end of file
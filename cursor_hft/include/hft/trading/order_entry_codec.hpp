@@ -0,0 +1,678 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "hft/market_data/treasury_instruments.hpp"
+#include "hft/trading/order_book.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+
+namespace hft {
+namespace trading {
+
+using namespace hft::market_data;
+
+/**
+ * @brief Order-entry message kinds, shared by every wire protocol
+ */
+enum class SessionMsgType : uint8_t {
+    LOGON = 0,
+    LOGOUT = 1,
+    HEARTBEAT = 2,
+    NEW_ORDER = 3,
+    CANCEL_REQUEST = 4,
+    EXECUTION_REPORT = 5,
+    TEST_REQUEST = 6,       // Venue asks for a heartbeat echoing test_req_id
+    UNSUPPORTED = 7         // Well-formed, but nothing the session acts on
+};
+
+/**
+ * @brief What an EXECUTION_REPORT reports
+ */
+enum class ExecType : uint8_t {
+    NEW = 0,                // Order accepted
+    TRADE = 1,              // Fill; last_quantity/last_price_64ths are the fill's
+    CANCELED = 2,           // Cancel confirmed
+    REJECTED = 3,           // Order refused
+    CANCEL_REJECTED = 4,    // Cancel refused; order still working
+    EXPIRED = 5             // Venue ended the order (expired, done for day)
+};
+
+/**
+ * @brief Why a REJECTED report was raised
+ */
+enum class SessionRejectReason : uint8_t {
+    NONE = 0,
+    VENUE = 1,              // The venue refused it
+    SESSION_DOWN = 2        // Never sent: the session was not (or no longer) logged on
+};
+
+enum class SessionProtocol : uint8_t {
+    FIX44 = 0,              // FIX 4.4 tag=value
+    BINARY = 1              // Fixed 80-byte little-endian frames
+};
+
+/**
+ * @brief One order-entry message, decoded (or to be encoded)
+ *
+ * The same struct travels the OMS -> session request rings and the
+ * session -> OMS report ring, so it is trivially copyable and two cache
+ * lines (the fill and TestReqID fields do not fit in one). cl_ord_id is always the OrderLifecycleManager order ID the
+ * message is about; protocols that need a distinct ID for a cancel
+ * derive it from that (see FixCodec).
+ */
+struct alignas(64) SessionMessage {
+    static constexpr size_t TEST_REQ_ID_SIZE = 48;
+
+    uint64_t cl_ord_id = 0;                             // OrderLifecycleManager order ID (8 bytes)
+    uint64_t venue_order_id = 0;                        // Venue's order ID (8 bytes)
+    uint64_t exec_id = 0;                               // Venue's execution ID (8 bytes)
+    uint64_t quantity = 0;                              // Order quantity (8 bytes)
+    uint64_t leaves_quantity = 0;                       // Open quantity after this report (8 bytes)
+    uint64_t last_quantity = 0;                         // Fill quantity, TRADE only (8 bytes)
+    uint32_t price_64ths = 0;                           // Order price (4 bytes)
+    uint32_t last_price_64ths = 0;                      // Fill price, TRADE only (4 bytes)
+    uint32_t security_id = 0;                           // Venue instrument id, see config::Instruments (4 bytes)
+    uint32_t seq_num = 0;                               // Session sequence number (4 bytes)
+    uint16_t heartbeat_s = 0;                           // Heartbeat interval, LOGON only (2 bytes)
+    SessionMsgType type = SessionMsgType::HEARTBEAT;    // Message kind (1 byte)
+    ExecType exec_type = ExecType::NEW;                 // EXECUTION_REPORT kind (1 byte)
+    OrderSide side = OrderSide::BID;                    // Buy/Sell side (1 byte)
+    OrderType ord_type = OrderType::LIMIT;              // Order type (1 byte)
+    OrderLifecycleManager::TimeInForce time_in_force = OrderLifecycleManager::TimeInForce::DAY;  // (1 byte)
+    OrderLifecycleManager::VenueType venue = OrderLifecycleManager::VenueType::PRIMARY_DEALER;   // Stamped by the session, not on the wire (1 byte)
+    SessionRejectReason reject_reason = SessionRejectReason::NONE;  // REJECTED only (1 byte)
+    char test_req_id[TEST_REQ_ID_SIZE];                 // TestReqID, NUL-terminated; TEST_REQUEST and its heartbeat (48 bytes)
+    uint8_t _pad[7];                                    // Padding (7 bytes)
+    // Total: 6*8+4*4+2+7+48+7 = 128 bytes
+
+    SessionMessage() noexcept : test_req_id{}, _pad{} {}
+};
+static_assert(sizeof(SessionMessage) == 128, "SessionMessage must be 128 bytes");
+static_assert(std::is_trivially_copyable_v<SessionMessage>, "SessionMessage travels through SPSC rings");
+
+/** @brief Price in 64ths of a point, exact for every Price32nd */
+[[nodiscard]] constexpr uint32_t to_64ths(Price32nd price) noexcept {
+    return static_cast<uint32_t>(price.whole) * 64 + price.thirty_seconds * 2u + price.half_32nds;
+}
+
+[[nodiscard]] constexpr Price32nd from_64ths(uint32_t price_64ths) noexcept {
+    const uint32_t fraction = price_64ths % 64;
+    return Price32nd{static_cast<uint16_t>(price_64ths / 64), static_cast<uint8_t>(fraction / 2),
+                     static_cast<uint8_t>(fraction & 1), {0, 0, 0, 0}};
+}
+
+/**
+ * @brief Who this end of a session is (FIX SenderCompID/TargetCompID)
+ */
+struct SessionIdentity {
+    char sender_comp_id[16] = {};                       // NUL-terminated, at most 15 characters
+    char target_comp_id[16] = {};
+};
+
+namespace detail {
+
+// Unchecked writer: callers reserve MAX_MESSAGE_SIZE before encoding
+class FixWriter {
+public:
+    static constexpr char SOH = '\x01';
+
+    explicit FixWriter(char* out) noexcept : begin_(out), pos_(out) {}
+
+    void number(uint64_t value) noexcept {
+        char digits[20];
+        size_t n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        while (n > 0) *pos_++ = digits[--n];
+    }
+
+    void padded(uint64_t value, size_t width) noexcept {
+        for (size_t i = width; i-- > 0;) {
+            pos_[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        pos_ += width;
+    }
+
+    void tag(uint32_t tag) noexcept {
+        number(tag);
+        *pos_++ = '=';
+    }
+
+    void field(uint32_t t, uint64_t value) noexcept {
+        tag(t);
+        number(value);
+        *pos_++ = SOH;
+    }
+
+    void field(uint32_t t, char value) noexcept {
+        tag(t);
+        *pos_++ = value;
+        *pos_++ = SOH;
+    }
+
+    void field(uint32_t t, const char* value, size_t max_len) noexcept {
+        tag(t);
+        const size_t len = ::strnlen(value, max_len);
+        std::memcpy(pos_, value, len);
+        pos_ += len;
+        *pos_++ = SOH;
+    }
+
+    // Cancel ClOrdIDs are the order ID behind a 'C', so they never collide with it
+    void field_id(uint32_t t, uint64_t id, bool cancel) noexcept {
+        tag(t);
+        if (cancel) *pos_++ = 'C';
+        number(id);
+        *pos_++ = SOH;
+    }
+
+    // 64ths are exact in six decimals (1/64 = 0.015625)
+    void field_price(uint32_t t, uint32_t price_64ths) noexcept {
+        tag(t);
+        number(price_64ths / 64);
+        *pos_++ = '.';
+        padded((price_64ths % 64) * 15625, 6);
+        *pos_++ = SOH;
+    }
+
+    // UTCTimestamp YYYYMMDD-HH:MM:SS.sss
+    void field_time(uint32_t t, uint64_t unix_ns) noexcept {
+        tag(t);
+        const uint64_t ms = unix_ns / 1000000;
+        const int64_t days = static_cast<int64_t>(ms / 86400000);
+        uint64_t ms_of_day = ms % 86400000;
+        // Civil date from days since 1970-01-01 (H. Hinnant)
+        const int64_t z = days + 719468;
+        const int64_t era = z / 146097;
+        const int64_t doe = z - era * 146097;
+        const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const int64_t mp = (5 * doy + 2) / 153;
+        const int64_t day = doy - (153 * mp + 2) / 5 + 1;
+        const int64_t month = mp < 10 ? mp + 3 : mp - 9;
+        const int64_t year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+        padded(static_cast<uint64_t>(year), 4);
+        padded(static_cast<uint64_t>(month), 2);
+        padded(static_cast<uint64_t>(day), 2);
+        *pos_++ = '-';
+        padded(ms_of_day / 3600000, 2);
+        ms_of_day %= 3600000;
+        *pos_++ = ':';
+        padded(ms_of_day / 60000, 2);
+        ms_of_day %= 60000;
+        *pos_++ = ':';
+        padded(ms_of_day / 1000, 2);
+        *pos_++ = '.';
+        padded(ms_of_day % 1000, 3);
+        *pos_++ = SOH;
+    }
+
+    void raw(const char* data, size_t len) noexcept {
+        std::memcpy(pos_, data, len);
+        pos_ += len;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return static_cast<size_t>(pos_ - begin_); }
+
+private:
+    char* begin_;
+    char* pos_;
+};
+
+[[nodiscard]] inline bool parse_uint(const char* p, const char* end, uint64_t& value) noexcept {
+    if (p == end || end - p > 20) return false;
+    uint64_t v = 0;
+    for (; p != end; ++p) {
+        if (*p < '0' || *p > '9') return false;
+        v = v * 10 + static_cast<uint64_t>(*p - '0');
+    }
+    value = v;
+    return true;
+}
+
+// Decimal price to the nearest 64th
+[[nodiscard]] inline bool parse_price(const char* p, const char* end, uint32_t& price_64ths) noexcept {
+    const char* dot = static_cast<const char*>(std::memchr(p, '.', static_cast<size_t>(end - p)));
+    uint64_t whole = 0;
+    if (!parse_uint(p, dot ? dot : end, whole) || whole > 0xFFFF) return false;
+    uint64_t fraction_64ths = 0;
+    if (dot != nullptr && dot + 1 != end) {
+        const char* frac_end = end - dot - 1 > 9 ? dot + 10 : end;  // Nine decimals is plenty
+        uint64_t fraction = 0;
+        if (!parse_uint(dot + 1, frac_end, fraction)) return false;
+        uint64_t scale = 1;
+        for (const char* d = dot + 1; d != frac_end; ++d) scale *= 10;
+        fraction_64ths = (fraction * 64 + scale / 2) / scale;
+    }
+    price_64ths = static_cast<uint32_t>(whole * 64 + fraction_64ths);
+    return true;
+}
+
+} // namespace detail
+
+/**
+ * @brief FIX 4.4 tag=value encoder/decoder
+ *
+ * Messages: Logon (A), Logout (5), Heartbeat (0), TestRequest (1),
+ * NewOrderSingle (D), OrderCancelRequest (F), ExecutionReport (8) and
+ * OrderCancelReject (9), with BodyLength and CheckSum. encode() needs MAX_MESSAGE_SIZE bytes of
+ * room and writes the whole message in place, so a session encodes
+ * straight into its send buffer. decode() reads one message from the
+ * front of a receive buffer.
+ *
+ * ClOrdID (11) is the order ID in decimal; a cancel's own ClOrdID is the
+ * same number behind a 'C', with OrigClOrdID (41) the order ID. Both
+ * decode back to cl_ord_id. Prices are decimals, exact to the 64th.
+ * An ExecType (150) the session has no use for (pending, restated, ...)
+ * decodes as UNSUPPORTED, so the report is ignored.
+ */
+class FixCodec {
+public:
+    static constexpr size_t MAX_MESSAGE_SIZE = 512;
+    static constexpr size_t MALFORMED = SIZE_MAX;
+
+    /**
+     * @return Bytes written, 0 if room < MAX_MESSAGE_SIZE
+     */
+    static size_t encode(char* out, size_t room, const SessionMessage& msg, const SessionIdentity& identity,
+                         uint64_t sending_time_ns) noexcept {
+        if (room < MAX_MESSAGE_SIZE) return 0;
+
+        char body_buffer[MAX_MESSAGE_SIZE];
+        detail::FixWriter body(body_buffer);
+        body.field(35, msg_type_code(msg));
+        body.field(34, static_cast<uint64_t>(msg.seq_num));
+        body.field(49, identity.sender_comp_id, sizeof(identity.sender_comp_id) - 1);
+        body.field(56, identity.target_comp_id, sizeof(identity.target_comp_id) - 1);
+        body.field_time(52, sending_time_ns);
+
+        switch (msg.type) {
+            case SessionMsgType::LOGON:
+                body.field(98, '0');                                    // EncryptMethod: none
+                body.field(108, static_cast<uint64_t>(msg.heartbeat_s));
+                break;
+            case SessionMsgType::HEARTBEAT:
+            case SessionMsgType::TEST_REQUEST:
+                if (msg.test_req_id[0] != '\0') body.field(112, msg.test_req_id, sizeof(msg.test_req_id) - 1);
+                break;
+            case SessionMsgType::NEW_ORDER:
+                body.field_id(11, msg.cl_ord_id, false);
+                body.field(48, static_cast<uint64_t>(msg.security_id));
+                body.field(54, side_code(msg.side));
+                body.field(38, msg.quantity);
+                body.field(40, msg.ord_type == OrderType::MARKET ? '1' : '2');
+                if (msg.ord_type != OrderType::MARKET) body.field_price(44, msg.price_64ths);
+                body.field(59, msg.ord_type == OrderType::IOC ? '3' : tif_code(msg.time_in_force));
+                break;
+            case SessionMsgType::CANCEL_REQUEST:
+                body.field_id(11, msg.cl_ord_id, true);
+                body.field_id(41, msg.cl_ord_id, false);
+                body.field(48, static_cast<uint64_t>(msg.security_id));
+                body.field(54, side_code(msg.side));
+                break;
+            case SessionMsgType::EXECUTION_REPORT: {
+                const bool cancel = msg.exec_type == ExecType::CANCELED || msg.exec_type == ExecType::CANCEL_REJECTED;
+                body.field(37, msg.venue_order_id);
+                body.field_id(11, msg.cl_ord_id, cancel);
+                if (cancel) body.field_id(41, msg.cl_ord_id, false);
+                body.field(39, ord_status_code(msg));
+                if (msg.exec_type == ExecType::CANCEL_REJECTED) {
+                    body.field(434, '1');                               // CxlRejResponseTo: cancel
+                    break;
+                }
+                body.field(17, msg.exec_id);
+                body.field(150, exec_type_code(msg.exec_type));
+                body.field(48, static_cast<uint64_t>(msg.security_id));
+                body.field(54, side_code(msg.side));
+                if (msg.quantity != 0) body.field(38, msg.quantity);
+                if (msg.price_64ths != 0) body.field_price(44, msg.price_64ths);
+                body.field(32, msg.last_quantity);
+                body.field_price(31, msg.last_price_64ths);
+                body.field(151, msg.leaves_quantity);
+                break;
+            }
+            default:
+                break;
+        }
+
+        detail::FixWriter out_writer(out);
+        out_writer.raw("8=FIX.4.4\x01", 10);
+        out_writer.field(9, static_cast<uint64_t>(body.size()));
+        out_writer.raw(body_buffer, body.size());
+        const size_t checked = out_writer.size();
+        out_writer.tag(10);
+        out_writer.padded(checksum(out, checked), 3);
+        out_writer.raw("\x01", 1);
+        return out_writer.size();
+    }
+
+    /**
+     * @brief Decode the message at the front of [data, data + len)
+     * @return Bytes consumed; 0 if the message is not complete yet; MALFORMED
+     *         on a framing, checksum or field error (the stream cannot be resynced)
+     */
+    static size_t decode(const char* data, size_t len, SessionMessage& msg) noexcept {
+        // 8=<BeginString>|9=<BodyLength>|
+        const char* end = data + len;
+        if (len < 2) return 0;
+        if (data[0] != '8' || data[1] != '=') return MALFORMED;
+        const char* begin_end = static_cast<const char*>(std::memchr(data, detail::FixWriter::SOH, len));
+        if (begin_end == nullptr) return len > 32 ? MALFORMED : 0;
+        const char* p = begin_end + 1;
+        if (end - p < 2) return 0;
+        if (p[0] != '9' || p[1] != '=') return MALFORMED;
+        const char* length_end = static_cast<const char*>(std::memchr(p, detail::FixWriter::SOH, static_cast<size_t>(end - p)));
+        if (length_end == nullptr) return end - p > 12 ? MALFORMED : 0;
+        uint64_t body_length = 0;
+        if (!detail::parse_uint(p + 2, length_end, body_length) || body_length > MAX_MESSAGE_SIZE) return MALFORMED;
+
+        const char* body = length_end + 1;
+        const size_t header_size = static_cast<size_t>(body - data);
+        const size_t total = header_size + body_length + 7;  // 10=NNN|
+        if (len < total) return 0;
+        const char* trailer = body + body_length;
+        uint64_t sent_checksum = 0;
+        if (trailer[0] != '1' || trailer[1] != '0' || trailer[2] != '=' || trailer[6] != detail::FixWriter::SOH ||
+            !detail::parse_uint(trailer + 3, trailer + 6, sent_checksum) ||
+            sent_checksum != checksum(data, header_size + body_length)) {
+            return MALFORMED;
+        }
+
+        msg = SessionMessage{};
+        msg.type = SessionMsgType::UNSUPPORTED;
+        DecodeFlags flags;
+        for (const char* field = body; field < trailer;) {
+            const char* eq = static_cast<const char*>(std::memchr(field, '=', static_cast<size_t>(trailer - field)));
+            const char* soh = eq ? static_cast<const char*>(std::memchr(eq, detail::FixWriter::SOH, static_cast<size_t>(trailer - eq)))
+                                 : nullptr;
+            uint64_t tag = 0;
+            if (soh == nullptr || !detail::parse_uint(field, eq, tag)) return MALFORMED;
+            const char* value = eq + 1;
+            if (!apply_field(static_cast<uint32_t>(tag), value, soh, msg, flags)) return MALFORMED;
+            field = soh + 1;
+        }
+        if (flags.ioc && msg.ord_type == OrderType::LIMIT) msg.ord_type = OrderType::IOC;
+        if (flags.unknown_exec_type && msg.type == SessionMsgType::EXECUTION_REPORT) msg.type = SessionMsgType::UNSUPPORTED;
+        return total;
+    }
+
+private:
+    // Fields resolved once the whole message is read
+    struct DecodeFlags {
+        bool ioc = false;                   // TimeInForce IOC on a limit order
+        bool unknown_exec_type = false;     // ExecType the session does not act on
+    };
+
+    [[nodiscard]] static uint64_t checksum(const char* data, size_t len) noexcept {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < len; ++i) sum += static_cast<unsigned char>(data[i]);
+        return sum % 256;
+    }
+
+    [[nodiscard]] static char msg_type_code(const SessionMessage& msg) noexcept {
+        switch (msg.type) {
+            case SessionMsgType::LOGON: return 'A';
+            case SessionMsgType::LOGOUT: return '5';
+            case SessionMsgType::TEST_REQUEST: return '1';
+            case SessionMsgType::NEW_ORDER: return 'D';
+            case SessionMsgType::CANCEL_REQUEST: return 'F';
+            case SessionMsgType::EXECUTION_REPORT: return msg.exec_type == ExecType::CANCEL_REJECTED ? '9' : '8';
+            default: return '0';
+        }
+    }
+
+    [[nodiscard]] static char side_code(OrderSide side) noexcept { return side == OrderSide::BID ? '1' : '2'; }
+
+    [[nodiscard]] static char tif_code(OrderLifecycleManager::TimeInForce tif) noexcept {
+        switch (tif) {
+            case OrderLifecycleManager::TimeInForce::GTC: return '1';
+            case OrderLifecycleManager::TimeInForce::IOC: return '3';
+            case OrderLifecycleManager::TimeInForce::FOK: return '4';
+            default: return '0';
+        }
+    }
+
+    [[nodiscard]] static char exec_type_code(ExecType type) noexcept {
+        switch (type) {
+            case ExecType::TRADE: return 'F';
+            case ExecType::CANCELED: return '4';
+            case ExecType::REJECTED: return '8';
+            case ExecType::EXPIRED: return 'C';
+            default: return '0';
+        }
+    }
+
+    [[nodiscard]] static char ord_status_code(const SessionMessage& msg) noexcept {
+        switch (msg.exec_type) {
+            case ExecType::TRADE: return msg.leaves_quantity == 0 ? '2' : '1';
+            case ExecType::CANCELED: return '4';
+            case ExecType::REJECTED: return '8';
+            case ExecType::EXPIRED: return 'C';
+            default: return '0';
+        }
+    }
+
+    // ClOrdID, optionally behind the cancel 'C'
+    [[nodiscard]] static bool parse_id(const char* value, const char* end, uint64_t& id) noexcept {
+        if (value != end && *value == 'C') ++value;
+        return detail::parse_uint(value, end, id);
+    }
+
+    [[nodiscard]] static bool apply_field(uint32_t tag, const char* value, const char* end, SessionMessage& msg,
+                                          DecodeFlags& flags) noexcept {
+        const char code = value != end ? *value : '\0';
+        uint64_t number = 0;
+        switch (tag) {
+            case 35:
+                if (end - value != 1) return true;  // Multi-character types: UNSUPPORTED
+                switch (code) {
+                    case 'A': msg.type = SessionMsgType::LOGON; break;
+                    case '5': msg.type = SessionMsgType::LOGOUT; break;
+                    case '0': msg.type = SessionMsgType::HEARTBEAT; break;
+                    case '1': msg.type = SessionMsgType::TEST_REQUEST; break;
+                    case 'D': msg.type = SessionMsgType::NEW_ORDER; break;
+                    case 'F': msg.type = SessionMsgType::CANCEL_REQUEST; break;
+                    case '8': msg.type = SessionMsgType::EXECUTION_REPORT; break;
+                    case '9':
+                        msg.type = SessionMsgType::EXECUTION_REPORT;
+                        msg.exec_type = ExecType::CANCEL_REJECTED;
+                        break;
+                    default: break;
+                }
+                return true;
+            case 34:
+                if (!detail::parse_uint(value, end, number) || number > UINT32_MAX) return false;
+                msg.seq_num = static_cast<uint32_t>(number);
+                return true;
+            case 108:
+                if (!detail::parse_uint(value, end, number) || number > UINT16_MAX) return false;
+                msg.heartbeat_s = static_cast<uint16_t>(number);
+                return true;
+            case 11:
+                // OrigClOrdID, when present, names the order; keep it
+                return msg.cl_ord_id != 0 || parse_id(value, end, msg.cl_ord_id);
+            case 41:
+                return parse_id(value, end, msg.cl_ord_id);
+            case 37: return detail::parse_uint(value, end, msg.venue_order_id);
+            case 17: return detail::parse_uint(value, end, msg.exec_id);
+            case 38: return detail::parse_uint(value, end, msg.quantity);
+            case 32: return detail::parse_uint(value, end, msg.last_quantity);
+            case 151: return detail::parse_uint(value, end, msg.leaves_quantity);
+            case 44: return detail::parse_price(value, end, msg.price_64ths);
+            case 31: return detail::parse_price(value, end, msg.last_price_64ths);
+            case 112:
+                if (end - value >= static_cast<ptrdiff_t>(sizeof(msg.test_req_id))) return false;
+                std::memcpy(msg.test_req_id, value, static_cast<size_t>(end - value));
+                msg.test_req_id[end - value] = '\0';
+                return true;
+            case 48:
+                if (!detail::parse_uint(value, end, number) || number > UINT32_MAX) return false;
+                msg.security_id = static_cast<uint32_t>(number);
+                return true;
+            case 54: msg.side = code == '2' ? OrderSide::ASK : OrderSide::BID; return true;
+            case 40: msg.ord_type = code == '1' ? OrderType::MARKET : OrderType::LIMIT; return true;
+            case 59:
+                flags.ioc = code == '3';
+                msg.time_in_force = code == '1' ? OrderLifecycleManager::TimeInForce::GTC
+                                  : code == '3' ? OrderLifecycleManager::TimeInForce::IOC
+                                  : code == '4' ? OrderLifecycleManager::TimeInForce::FOK
+                                                : OrderLifecycleManager::TimeInForce::DAY;
+                return true;
+            case 150:
+                if (end - value != 1) {
+                    flags.unknown_exec_type = true;
+                    return true;
+                }
+                switch (code) {
+                    case '0': msg.exec_type = ExecType::NEW; break;
+                    case 'F':
+                    case '1':
+                    case '2': msg.exec_type = ExecType::TRADE; break;
+                    case '4': msg.exec_type = ExecType::CANCELED; break;
+                    case '8':
+                        msg.exec_type = ExecType::REJECTED;
+                        msg.reject_reason = SessionRejectReason::VENUE;
+                        break;
+                    case 'C':                                       // Expired
+                    case '3': msg.exec_type = ExecType::EXPIRED; break;  // Done for day
+                    default: flags.unknown_exec_type = true; break;
+                }
+                return true;
+            default:
+                return true;  // 49/56/52/39/... are not needed past the session
+        }
+    }
+};
+
+/**
+ * @brief Fixed-frame binary encoder/decoder
+ *
+ * Every message is one 80-byte little-endian frame:
+ *
+ *     0  u16 length (80)   2  u8 type      3  u8 version (2)
+ *     4  u32 seq_num       8  u64 cl_ord_id 16 u64 venue_order_id
+ *     24 u64 exec_id       32 u64 quantity  40 u64 leaves_quantity
+ *     48 u32 price_64ths   52 u32 security_id
+ *     56 u16 heartbeat_s   58 u8 exec_type  59 u8 side  60 u8 ord_type
+ *     61 u8 time_in_force  62 u8 reject_reason  63 reserved
+ *     64 u64 last_quantity 72 u32 last_price_64ths  76 reserved
+ *
+ * TestReqID is not carried: a binary test request is answered with a
+ * plain heartbeat.
+ * The session is identified by its connection, so there are no comp ids.
+ */
+class BinaryCodec {
+public:
+    static constexpr size_t FRAME_SIZE = 80;
+    static constexpr size_t MAX_MESSAGE_SIZE = FRAME_SIZE;
+    static constexpr size_t MALFORMED = SIZE_MAX;
+    static constexpr uint8_t VERSION = 2;
+    static_assert(std::endian::native == std::endian::little, "Frames are copied as little-endian");
+
+    static size_t encode(char* out, size_t room, const SessionMessage& msg, const SessionIdentity&,
+                         uint64_t) noexcept {
+        if (room < FRAME_SIZE) return 0;
+        put<uint16_t>(out, 0, FRAME_SIZE);
+        put<uint8_t>(out, 2, static_cast<uint8_t>(msg.type));
+        put<uint8_t>(out, 3, VERSION);
+        put(out, 4, msg.seq_num);
+        put(out, 8, msg.cl_ord_id);
+        put(out, 16, msg.venue_order_id);
+        put(out, 24, msg.exec_id);
+        put(out, 32, msg.quantity);
+        put(out, 40, msg.leaves_quantity);
+        put(out, 48, msg.price_64ths);
+        put(out, 52, msg.security_id);
+        put(out, 56, msg.heartbeat_s);
+        put<uint8_t>(out, 58, static_cast<uint8_t>(msg.exec_type));
+        put<uint8_t>(out, 59, static_cast<uint8_t>(msg.side));
+        put<uint8_t>(out, 60, static_cast<uint8_t>(msg.ord_type));
+        put<uint8_t>(out, 61, static_cast<uint8_t>(msg.time_in_force));
+        put<uint8_t>(out, 62, static_cast<uint8_t>(msg.reject_reason));
+        put<uint8_t>(out, 63, 0);
+        put(out, 64, msg.last_quantity);
+        put(out, 72, msg.last_price_64ths);
+        put<uint32_t>(out, 76, 0);
+        return FRAME_SIZE;
+    }
+
+    static size_t decode(const char* data, size_t len, SessionMessage& msg) noexcept {
+        if (len < 4) return 0;
+        if (get<uint16_t>(data, 0) != FRAME_SIZE || get<uint8_t>(data, 3) != VERSION) return MALFORMED;
+        if (len < FRAME_SIZE) return 0;
+        const auto type = get<uint8_t>(data, 2);
+        const auto exec_type = get<uint8_t>(data, 58);
+        const auto side = get<uint8_t>(data, 59);
+        const auto ord_type = get<uint8_t>(data, 60);
+        const auto tif = get<uint8_t>(data, 61);
+        const auto reason = get<uint8_t>(data, 62);
+        if (exec_type > static_cast<uint8_t>(ExecType::EXPIRED) || side > 1 ||
+            ord_type > static_cast<uint8_t>(OrderType::IOC) ||
+            tif > static_cast<uint8_t>(OrderLifecycleManager::TimeInForce::GTC) ||
+            reason > static_cast<uint8_t>(SessionRejectReason::SESSION_DOWN)) {
+            return MALFORMED;
+        }
+
+        msg = SessionMessage{};
+        msg.type = type < static_cast<uint8_t>(SessionMsgType::UNSUPPORTED) ? static_cast<SessionMsgType>(type)
+                                                                           : SessionMsgType::UNSUPPORTED;
+        msg.seq_num = get<uint32_t>(data, 4);
+        msg.cl_ord_id = get<uint64_t>(data, 8);
+        msg.venue_order_id = get<uint64_t>(data, 16);
+        msg.exec_id = get<uint64_t>(data, 24);
+        msg.quantity = get<uint64_t>(data, 32);
+        msg.leaves_quantity = get<uint64_t>(data, 40);
+        msg.price_64ths = get<uint32_t>(data, 48);
+        msg.security_id = get<uint32_t>(data, 52);
+        msg.last_quantity = get<uint64_t>(data, 64);
+        msg.last_price_64ths = get<uint32_t>(data, 72);
+        msg.heartbeat_s = get<uint16_t>(data, 56);
+        msg.exec_type = static_cast<ExecType>(exec_type);
+        msg.side = static_cast<OrderSide>(side);
+        msg.ord_type = static_cast<OrderType>(ord_type);
+        msg.time_in_force = static_cast<OrderLifecycleManager::TimeInForce>(tif);
+        msg.reject_reason = static_cast<SessionRejectReason>(reason);
+        return FRAME_SIZE;
+    }
+
+private:
+    template<typename T>
+    static void put(char* out, size_t offset, T value) noexcept {
+        std::memcpy(out + offset, &value, sizeof(T));
+    }
+
+    template<typename T>
+    [[nodiscard]] static T get(const char* in, size_t offset) noexcept {
+        T value;
+        std::memcpy(&value, in + offset, sizeof(T));
+        return value;
+    }
+};
+
+/** @brief Largest message any protocol encodes */
+inline constexpr size_t MAX_SESSION_MESSAGE_SIZE =
+    FixCodec::MAX_MESSAGE_SIZE > BinaryCodec::MAX_MESSAGE_SIZE ? FixCodec::MAX_MESSAGE_SIZE : BinaryCodec::MAX_MESSAGE_SIZE;
+static_assert(FixCodec::MALFORMED == BinaryCodec::MALFORMED, "Codecs share the MALFORMED sentinel");
+
+/** @brief Encode with the session's protocol; see FixCodec::encode */
+inline size_t encode_session_message(SessionProtocol protocol, char* out, size_t room, const SessionMessage& msg,
+                                     const SessionIdentity& identity, uint64_t sending_time_ns) noexcept {
+    return protocol == SessionProtocol::FIX44 ? FixCodec::encode(out, room, msg, identity, sending_time_ns)
+                                              : BinaryCodec::encode(out, room, msg, identity, sending_time_ns);
+}
+
+/** @brief Decode with the session's protocol; see FixCodec::decode */
+inline size_t decode_session_message(SessionProtocol protocol, const char* data, size_t len,
+                                     SessionMessage& msg) noexcept {
+    return protocol == SessionProtocol::FIX44 ? FixCodec::decode(data, len, msg)
+                                              : BinaryCodec::decode(data, len, msg);
+}
+
+} // namespace trading
+} // namespace hft
@@ -6,11 +6,17 @@
 #include <atomic>
 #include <memory>
 #include <chrono>
+#include <type_traits>
 #include "hft/timing/hft_timer.hpp"
+#include "hft/timing/latency_tracer.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
 #include "hft/market_data/treasury_instruments.hpp"
 #include "hft/trading/order_book.hpp"
+#include "hft/trading/rate_limiter.hpp"
+#include "hft/trading/audit_log.hpp"
+#include "hft/trading/state_journal.hpp"
+#include "hft/config/system_traits.hpp"
 
 namespace hft {
 namespace trading {
@@ -28,6 +34,12 @@ using namespace hft::market_data;
  * - Risk control integration with circuit breakers
  * - Settlement and reconciliation support
  * 
+ * Order IDs are generational slot handles (generation << 32 | slot) drawn
+ * from a lock-free free list, so create, lookup and retire are O(1) and a
+ * stale ID fails one generation compare instead of aliasing the slot's next
+ * order. State, leaves and price are mirrored into a 32-byte OrderStatus
+ * array so status checks never pull in the 128-byte record.
+ * 
  * Performance targets:
  * - Order creation: <200ns
  * - State transition: <100ns
@@ -37,11 +49,16 @@ using namespace hft::market_data;
  */
 class alignas(64) OrderLifecycleManager {
 public:
-    static constexpr size_t MAX_ORDERS = 65536;           // Maximum concurrent orders
-    static constexpr size_t MAX_VENUES = 8;               // Maximum trading venues
+    static constexpr size_t MAX_ORDERS = config::SystemTraits::MAX_ORDERS;        // Maximum concurrent orders
+    static constexpr size_t MAX_VENUES = config::SystemTraits::MAX_VENUES;         // Maximum trading venues
     static constexpr size_t MAX_FILLS_PER_ORDER = 32;     // Maximum fills per order
     static constexpr size_t AUDIT_TRAIL_SIZE = 1048576;   // Audit trail entries
     
+    // Order IDs are generational slot handles: generation << 32 | slot
+    static constexpr uint64_t SLOT_MASK = 0xFFFFFFFFULL;
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+    static_assert(MAX_ORDERS < NO_SLOT, "Slots must fit the low half of an order ID");
+    
     // Time in force options
     enum class TimeInForce : uint8_t {
         DAY = 0,        // Good for day
@@ -110,19 +127,34 @@ public:
         OrderType type;                                     // Order type (1 byte)
         TimeInForce time_in_force;                          // Time in force (1 byte)
         VenueType target_venue = VenueType::PRIMARY_DEALER; // Target venue (1 byte)
-        uint8_t _pad0[1];                                   // Padding (1 byte)
+        uint8_t strategy_id = 0;                            // Originating strategy (1 byte)
         Price32nd order_price;                              // Order price (8 bytes)
         uint64_t original_quantity = 0;                     // Original order quantity (8 bytes)
         uint64_t executed_quantity = 0;                     // Total executed quantity (8 bytes)
         uint64_t leaves_quantity = 0;                       // Remaining quantity (8 bytes)
         uint64_t creation_time_ns = 0;                      // Order creation time (8 bytes)
-        // Total: 8+8+1+1+1+1+1+1+1+8+8+8+8+8 = 63 bytes, pad to 128 (2 cache lines)
-        uint8_t _pad1[1];                                   // Padding to 64 bytes
+        uint32_t trace_id = 0;                              // Triggering tick's trace, 0 = untraced (4 bytes)
+        uint8_t _pad1[1];                                   // Padding (1 byte)
+        // Total: 8+8+7+1(align)+8+8+8+8+8+4+1 = 69 bytes, pad to 128 (2 cache lines)
         
-        OrderRecord() noexcept : _pad0{}, _pad1{} {}
+        OrderRecord() noexcept : _pad1{} {}
     };
     static_assert(sizeof(OrderRecord) == 128, "OrderRecord must be 128 bytes (2 cache lines)");
     
+    // Hot per-slot status, kept apart from OrderRecord so status checks touch one line
+    struct alignas(32) OrderStatus {
+        std::atomic<uint32_t> generation{0};                // Odd while the slot is live (4 bytes)
+        OrderState state = OrderState::CREATED;             // Current order state (1 byte)
+        uint8_t _pad0[3];                                   // Padding (3 bytes)
+        Price32nd order_price;                              // Order price (8 bytes)
+        uint64_t leaves_quantity = 0;                       // Remaining quantity (8 bytes)
+        // Total: 4+1+3+8+8 = 24 bytes, pad to 32 (two per cache line)
+        uint8_t _pad1[8];                                   // Padding to 32 bytes
+        
+        OrderStatus() noexcept : _pad0{}, _pad1{} {}
+    };
+    static_assert(sizeof(OrderStatus) == 32, "OrderStatus must be 32 bytes");
+    
     // Venue configuration and performance tracking
     struct alignas(64) VenueConfig {
         VenueType type = VenueType::PRIMARY_DEALER;         // Venue type (1 byte)
@@ -156,24 +188,26 @@ public:
         RiskLimits() noexcept = default;
     };
     
-    // Audit trail entry for compliance
+    // Audit trail entry for compliance. Trivial, so the 64MB trail is not
+    // written at construction: its pages fault in when first used, or in
+    // parallel during a startup WarmupPlan. Value-initialize (AuditEntry{})
+    // for a zeroed entry.
     struct alignas(64) AuditEntry {
-        uint64_t entry_id = 0;                              // Unique entry ID (8 bytes)
-        uint64_t order_id = 0;                              // Related order ID (8 bytes)
-        uint64_t timestamp_ns = 0;                          // Event timestamp (8 bytes)
-        OrderState old_state = OrderState::CREATED;         // Previous state (1 byte)
-        OrderState new_state = OrderState::CREATED;         // New state (1 byte)
-        VenueType venue = VenueType::PRIMARY_DEALER;        // Venue involved (1 byte)
-        uint8_t event_type = 0;                             // Event type code (1 byte)
-        uint32_t user_id = 0;                               // User responsible (4 bytes)
+        uint64_t entry_id;                                  // Unique entry ID (8 bytes)
+        uint64_t order_id;                                  // Related order ID (8 bytes)
+        uint64_t timestamp_ns;                              // Event timestamp (8 bytes)
+        OrderState old_state;                               // Previous state (1 byte)
+        OrderState new_state;                               // New state (1 byte)
+        VenueType venue;                                    // Venue involved (1 byte)
+        uint8_t event_type;                                 // Event type code (1 byte)
+        uint32_t user_id;                                   // User responsible (4 bytes)
         Price32nd price;                                    // Price at event (8 bytes)
-        uint64_t quantity = 0;                              // Quantity at event (8 bytes)
+        uint64_t quantity;                                  // Quantity at event (8 bytes)
         char reason[16];                                    // Event reason (16 bytes)
         // Total: 8+8+8+1+1+1+1+4+8+8+16 = 64 bytes
-        
-        AuditEntry() noexcept { reason[0] = '\0'; }
     };
     static_assert(sizeof(AuditEntry) == 64, "AuditEntry must be 64 bytes");
+    static_assert(std::is_trivially_default_constructible_v<AuditEntry>, "Audit trail must not be written at construction");
     
     // Performance metrics tracking
     struct PerformanceMetrics {
@@ -186,15 +220,17 @@ public:
         std::atomic<uint64_t> total_fill_processing_time_ns{0};
         std::atomic<uint64_t> risk_violations{0};
         std::atomic<uint64_t> circuit_breaker_triggers{0};
+        std::atomic<uint64_t> orders_throttled{0};         // Refused by a strategy x venue rate limit
+        std::atomic<uint64_t> journal_entries_dropped{0};  // Journal full: change not recoverable
     };
     
     /**
      * @brief Constructor with infrastructure dependencies
      */
     OrderLifecycleManager(
-        hft::ObjectPool<TreasuryOrder, 4096>& order_pool,
-        hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>& level_pool,
-        hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer
+        TreasuryOrderPool& order_pool,
+        PriceLevelPool& level_pool,
+        OrderBookUpdateBuffer& update_buffer
     ) noexcept;
     
     // No copy or move semantics
@@ -209,6 +245,9 @@ public:
      * @param price Order price
      * @param quantity Order quantity
      * @param time_in_force Time in force
+     * @param strategy_id Originating strategy, for its per-venue rate limit
+     * @param venue Venue the order is submitted to
+     * @param trace_id LatencyTracer ID of the triggering tick (0 = untraced)
      * @return Order ID if successful, 0 if rejected
      */
     [[nodiscard]] uint64_t create_order(
@@ -217,7 +256,10 @@ public:
         OrderType type,
         Price32nd price,
         uint64_t quantity,
-        TimeInForce time_in_force = TimeInForce::DAY
+        TimeInForce time_in_force = TimeInForce::DAY,
+        uint8_t strategy_id = 0,
+        VenueType venue = VenueType::PRIMARY_DEALER,
+        uint32_t trace_id = 0
     ) noexcept;
     
     /**
@@ -243,6 +285,44 @@ public:
      */
     bool process_fill(const OrderExecution& execution) noexcept;
     
+    /**
+     * @brief Order handed to a venue session, awaiting the venue's ack
+     * @return false if the ID is stale or the order was already sent
+     */
+    bool mark_sent(uint64_t order_id) noexcept;
+    
+    /**
+     * @brief Venue accepted the order (PENDING_NEW -> ACKNOWLEDGED)
+     *
+     * An ack that arrives after a fill or a cancel request changes nothing.
+     * @return false if the ID is stale or the order is terminal
+     */
+    bool process_ack(uint64_t order_id) noexcept;
+    
+    /**
+     * @brief Venue refused the order; it becomes REJECTED with no leaves
+     * @return false if the ID is stale or the order is terminal
+     */
+    bool process_reject(uint64_t order_id) noexcept;
+    
+    /**
+     * @brief Venue confirmed a cancel; the order becomes CANCELLED with its fills so far
+     * @return false if the ID is stale or the order is terminal
+     */
+    bool process_cancel_ack(uint64_t order_id) noexcept;
+    
+    /**
+     * @brief Venue refused a cancel; the order is working again
+     * @return false if the ID is stale or no cancel is pending
+     */
+    bool process_cancel_reject(uint64_t order_id) noexcept;
+    
+    /**
+     * @brief Venue ended the order (expired, done for day); it becomes EXPIRED with its fills so far
+     * @return false if the ID is stale or the order is terminal
+     */
+    bool process_expire(uint64_t order_id) noexcept;
+    
     /**
      * @brief Route order to optimal venue
      * @param order_id Order to route
@@ -270,6 +350,29 @@ public:
      */
     [[nodiscard]] const OrderRecord* get_order(uint64_t order_id) const noexcept;
     
+    /**
+     * @brief Get the hot status (state, leaves, price) without touching the full record
+     * @return Pointer to the status entry or nullptr if the ID is stale
+     */
+    [[nodiscard]] const OrderStatus* get_order_status(uint64_t order_id) const noexcept {
+        const size_t slot = find_slot(order_id);
+        return slot < MAX_ORDERS ? &status_[slot] : nullptr;
+    }
+    
+    /**
+     * @brief Free a terminal order's slot; its ID goes stale immediately
+     * @return false if the ID is stale or the order is still working
+     */
+    bool retire_order(uint64_t order_id) noexcept;
+    
+    /** @brief Slot an order ID addresses */
+    [[nodiscard]] static constexpr size_t slot_of(uint64_t order_id) noexcept { return order_id & SLOT_MASK; }
+    
+    /** @brief Generation an order ID was issued under */
+    [[nodiscard]] static constexpr uint32_t generation_of(uint64_t order_id) noexcept {
+        return static_cast<uint32_t>(order_id >> 32);
+    }
+    
     /**
      * @brief Get venue configuration
      * @param venue Venue to query
@@ -299,18 +402,84 @@ public:
      * @return true if circuit breaker active
      */
     [[nodiscard]] bool is_circuit_breaker_active() const noexcept { return circuit_breaker_active_.load(); }
+    
+    /**
+     * @brief Throttle new orders and amends per strategy x venue (nullptr = off)
+     *
+     * The table may be shared by several managers; cancels are never
+     * throttled since they only reduce exposure.
+     */
+    void set_rate_limiters(OrderRateLimiters* limiters) noexcept { rate_limiters_ = limiters; }
+    
+    /**
+     * @brief Earliest time the last throttled submit would have been admitted
+     */
+    [[nodiscard]] uint64_t throttled_retry_at_ns() const noexcept { return throttled_retry_at_ns_; }
+    
+    /**
+     * @brief Send audit events to a durable log instead of the in-memory trail (nullptr = in-memory)
+     *
+     * Claims one of the log's producer rings for the thread driving this
+     * manager; each event then costs a single ring push. Setting the same
+     * log again keeps the ring; switching logs releases the previous one.
+     * @return false if the log has no free producer ring
+     */
+    bool set_audit_log(AuditLog* log) noexcept {
+        if (log == audit_log_) return true;
+        if (audit_log_ != nullptr) audit_log_->release_producer(audit_producer_);
+        const int producer = log ? log->register_producer() : -1;
+        audit_log_ = producer >= 0 ? log : nullptr;
+        audit_producer_ = producer >= 0 ? static_cast<size_t>(producer) : 0;
+        return log == nullptr || producer >= 0;
+    }
+    
+    /**
+     * @brief Journal every order state change for warm restart (nullptr = off)
+     */
+    void set_journal(StateJournal* journal) noexcept { journal_ = journal; }
+    
+    /**
+     * @brief Stamp traced orders ORDER on creation (nullptr = off); caller's thread only
+     */
+    void set_tracer(PipelineTracer* tracer) noexcept { tracer_ = tracer; }
+    
+    /**
+     * @brief Visit every live order record (snapshot side)
+     */
+    template<typename Fn>
+    void for_each_order(Fn&& fn) const noexcept {
+        for (size_t i = 0; i < MAX_ORDERS; ++i) {
+            if ((status_[i].generation.load(std::memory_order_acquire) & 1) != 0) fn(orders_[i]);
+        }
+    }
+    
+    /** @brief Current generation of a slot (odd while live) */
+    [[nodiscard]] uint32_t slot_generation(size_t slot) const noexcept {
+        return status_[slot].generation.load(std::memory_order_acquire);
+    }
+    
+    /**
+     * @brief Replace every order with recovered state; recovery only, trading stopped
+     * @param generations MAX_ORDERS slot generations (live slots are overridden by records)
+     * @param records Live orders, each placed at the slot its order_id names
+     * @return false if a record's order_id is not a live handle
+     */
+    bool restore_orders(const uint32_t* generations, const OrderRecord* records, size_t count) noexcept;
 
 private:
     // Infrastructure references
-    alignas(64) hft::ObjectPool<TreasuryOrder, 4096>& order_pool_;
-    alignas(64) hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>& level_pool_;
-    alignas(64) hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer_;
+    alignas(64) TreasuryOrderPool& order_pool_;
+    alignas(64) PriceLevelPool& level_pool_;
+    alignas(64) OrderBookUpdateBuffer& update_buffer_;
     alignas(64) hft::HFTTimer timer_;
     
-    // Order management storage
+    // Order management storage: hot status and full records in separate arrays
+    alignas(64) std::array<OrderStatus, MAX_ORDERS> status_;
     alignas(64) std::array<OrderRecord, MAX_ORDERS> orders_;
-    alignas(64) std::array<std::atomic<bool>, MAX_ORDERS> order_slots_used_;
-    alignas(64) std::atomic<uint64_t> next_order_id_;
+    
+    // Free slots form a Treiber stack; the head carries an ABA tag in its high half
+    alignas(64) std::array<std::atomic<uint32_t>, MAX_ORDERS> free_next_;
+    alignas(64) std::atomic<uint64_t> free_head_;
     
     // Venue management
     alignas(64) std::array<VenueConfig, MAX_VENUES> venue_configs_;
@@ -327,6 +496,20 @@ private:
     // Performance tracking
     alignas(64) PerformanceMetrics metrics_;
     
+    // Venue message-rate limits
+    OrderRateLimiters* rate_limiters_;
+    uint64_t throttled_retry_at_ns_;
+    
+    // Durable audit sink
+    AuditLog* audit_log_;
+    size_t audit_producer_;
+    
+    // Warm-restart journal
+    StateJournal* journal_;
+    
+    // Tick-to-trade tracing
+    PipelineTracer* tracer_ = nullptr;
+    
     // Helper methods
     bool validate_order_parameters(
         TreasuryType instrument,
@@ -341,41 +524,53 @@ private:
         uint64_t quantity
     ) noexcept;
     
-    void update_order_state(uint64_t order_id, OrderState new_state, const char* reason = "") noexcept;
-    void add_audit_entry(uint64_t order_id, OrderState old_state, OrderState new_state, const char* reason = "") noexcept;
+    bool check_rate_limit(uint8_t strategy_id, VenueType venue, uint64_t now_ns) noexcept;
+    
+    void update_order_state(uint64_t order_id, OrderState new_state, AuditReason reason = AuditReason::NONE) noexcept;
+    void add_audit_entry(uint64_t order_id, OrderState old_state, OrderState new_state,
+                         AuditReason reason = AuditReason::NONE) noexcept;
     
     VenueType select_optimal_venue(TreasuryType instrument, OrderSide side, uint64_t quantity) noexcept;
     void update_venue_statistics(VenueType venue, bool success, uint64_t latency_ns) noexcept;
     
-    uint64_t allocate_order_slot() noexcept;
-    void deallocate_order_slot(uint64_t order_id) noexcept;
+    [[nodiscard]] size_t find_slot(uint64_t order_id) const noexcept;
+    void journal_order(JournalEntryType type, const OrderRecord& order) noexcept;
+    [[nodiscard]] static bool is_terminal(OrderState state) noexcept;
+    
+    uint32_t allocate_order_slot() noexcept;
+    void deallocate_order_slot(uint32_t slot) noexcept;
 };
 
 // Implementation
 
 inline OrderLifecycleManager::OrderLifecycleManager(
-    hft::ObjectPool<TreasuryOrder, 4096>& order_pool,
-    hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>& level_pool,
-    hft::SPSCRingBuffer<OrderBookUpdate, 8192>& update_buffer
+    TreasuryOrderPool& order_pool,
+    PriceLevelPool& level_pool,
+    OrderBookUpdateBuffer& update_buffer
 ) noexcept
     : order_pool_(order_pool),
       level_pool_(level_pool),
       update_buffer_(update_buffer),
       timer_(),
+      status_{},
       orders_{},
-      order_slots_used_{},
-      next_order_id_(1),
+      free_next_{},
+      free_head_(0),
       venue_configs_{},
       risk_limits_(),
       emergency_stop_active_(false),
       circuit_breaker_active_(false),
-      audit_trail_{},
       audit_trail_index_(0),
-      metrics_{} {
-    
-    // Initialize order slots
-    for (auto& slot : order_slots_used_) {
-        slot.store(false, std::memory_order_relaxed);
+      metrics_{},
+      rate_limiters_(nullptr),
+      throttled_retry_at_ns_(0),
+      audit_log_(nullptr),
+      audit_producer_(0),
+      journal_(nullptr) {
+    
+    // Chain every slot onto the free list in order
+    for (size_t i = 0; i < MAX_ORDERS; ++i) {
+        free_next_[i].store(i + 1 < MAX_ORDERS ? static_cast<uint32_t>(i + 1) : NO_SLOT, std::memory_order_relaxed);
     }
     
     // Initialize venue configurations with defaults
@@ -394,7 +589,10 @@ inline uint64_t OrderLifecycleManager::create_order(
     OrderType type,
     Price32nd price,
     uint64_t quantity,
-    TimeInForce time_in_force
+    TimeInForce time_in_force,
+    uint8_t strategy_id,
+    VenueType venue,
+    uint32_t trace_id
 ) noexcept {
     const auto start_time = timer_.get_timestamp_ns();
     
@@ -420,14 +618,23 @@ inline uint64_t OrderLifecycleManager::create_order(
         return 0;
     }
     
+    // Check venue message rate before anything is allocated
+    if (!check_rate_limit(strategy_id, venue, start_time)) {
+        return 0;
+    }
+    
     // Allocate order slot
-    const uint64_t order_id = allocate_order_slot();
-    if (order_id == 0) {
+    const uint32_t slot_index = allocate_order_slot();
+    if (slot_index == NO_SLOT) {
         return 0; // No available slots
     }
     
+    // The next (odd) generation marks the slot live; stale IDs keep the old one
+    auto& status = status_[slot_index];
+    const uint32_t generation = status.generation.load(std::memory_order_relaxed) + 1;
+    const uint64_t order_id = (static_cast<uint64_t>(generation) << 32) | slot_index;
+    
     // Initialize order record
-    const size_t slot_index = order_id % MAX_ORDERS;
     auto& order = orders_[slot_index];
     
     order.order_id = order_id;
@@ -437,14 +644,24 @@ inline uint64_t OrderLifecycleManager::create_order(
     order.side = side;
     order.type = type;
     order.time_in_force = time_in_force;
+    order.target_venue = venue;
+    order.strategy_id = strategy_id;
     order.order_price = price;
     order.original_quantity = quantity;
     order.executed_quantity = 0;
     order.leaves_quantity = quantity;
     order.creation_time_ns = start_time;
+    order.trace_id = trace_id;
+    if (tracer_) tracer_->stamp(trace_id, TraceStage::ORDER);
+    
+    status.state = OrderState::CREATED;
+    status.order_price = price;
+    status.leaves_quantity = quantity;
+    status.generation.store(generation, std::memory_order_release);
+    journal_order(JournalEntryType::ORDER_NEW, order);
     
     // Add audit entry
-    add_audit_entry(order_id, OrderState::CREATED, OrderState::CREATED, "Order created");
+    add_audit_entry(order_id, OrderState::CREATED, OrderState::CREATED, AuditReason::ORDER_CREATED);
     
     // Update metrics
     metrics_.orders_created.fetch_add(1, std::memory_order_relaxed);
@@ -452,24 +669,17 @@ inline uint64_t OrderLifecycleManager::create_order(
     metrics_.total_execution_time_ns.fetch_add(creation_time, std::memory_order_relaxed);
     
     // Transition to validated state
-    update_order_state(order_id, OrderState::VALIDATED, "Validation complete");
+    update_order_state(order_id, OrderState::VALIDATED, AuditReason::VALIDATION_COMPLETE);
     
     return order_id;
 }
 
 inline bool OrderLifecycleManager::cancel_order(uint64_t order_id) noexcept {
-    if (order_id == 0 || order_id >= MAX_ORDERS) return false;
-    
-    const size_t slot_index = order_id % MAX_ORDERS;
-    if (!order_slots_used_[slot_index].load(std::memory_order_acquire)) {
-        return false;
-    }
-    
-    auto& order = orders_[slot_index];
-    if (order.order_id != order_id) return false;
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS) return false;
     
     // Check if order can be cancelled
-    const OrderState current_state = order.state;
+    const OrderState current_state = status_[slot_index].state;
     if (current_state == OrderState::FILLED || 
         current_state == OrderState::CANCELLED ||
         current_state == OrderState::PENDING_CANCEL ||
@@ -478,7 +688,7 @@ inline bool OrderLifecycleManager::cancel_order(uint64_t order_id) noexcept {
     }
     
     // Update state to pending cancel
-    update_order_state(order_id, OrderState::PENDING_CANCEL, "Cancel requested");
+    update_order_state(order_id, OrderState::PENDING_CANCEL, AuditReason::CANCEL_REQUESTED);
     
     return true;
 }
@@ -487,19 +697,15 @@ inline bool OrderLifecycleManager::process_fill(const OrderExecution& execution)
     const auto start_time = timer_.get_timestamp_ns();
     
     const uint64_t order_id = execution.order_id;
-    if (order_id == 0 || order_id >= MAX_ORDERS) return false;
-    
-    const size_t slot_index = order_id % MAX_ORDERS;
-    if (!order_slots_used_[slot_index].load(std::memory_order_acquire)) {
-        return false;
-    }
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS) return false;
     
     auto& order = orders_[slot_index];
-    if (order.order_id != order_id) return false;
     
     // Update order with execution
     order.executed_quantity += execution.executed_quantity;
     order.leaves_quantity = order.original_quantity - order.executed_quantity;
+    status_[slot_index].leaves_quantity = order.leaves_quantity;
     
     // Determine new state
     OrderState new_state;
@@ -510,7 +716,7 @@ inline bool OrderLifecycleManager::process_fill(const OrderExecution& execution)
         new_state = OrderState::PARTIALLY_FILLED;
     }
     
-    update_order_state(order_id, new_state, "Fill processed");
+    update_order_state(order_id, new_state, AuditReason::FILL_PROCESSED);
     
     // Update venue statistics
     update_venue_statistics(execution.venue, true, timer_.get_timestamp_ns() - execution.execution_time_ns);
@@ -522,18 +728,76 @@ inline bool OrderLifecycleManager::process_fill(const OrderExecution& execution)
     return true;
 }
 
-inline OrderLifecycleManager::VenueType OrderLifecycleManager::route_order(uint64_t order_id) noexcept {
-    const auto start_time = timer_.get_timestamp_ns();
+inline bool OrderLifecycleManager::mark_sent(uint64_t order_id) noexcept {
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS) return false;
+    
+    const OrderState current_state = status_[slot_index].state;
+    if (current_state != OrderState::VALIDATED && current_state != OrderState::ROUTED) return false;
     
-    if (order_id == 0 || order_id >= MAX_ORDERS) return VenueType::PRIMARY_DEALER;
+    update_order_state(order_id, OrderState::PENDING_NEW, AuditReason::ORDER_SENT);
+    return true;
+}
+
+inline bool OrderLifecycleManager::process_ack(uint64_t order_id) noexcept {
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS || is_terminal(status_[slot_index].state)) return false;
     
-    const size_t slot_index = order_id % MAX_ORDERS;
-    if (!order_slots_used_[slot_index].load(std::memory_order_acquire)) {
-        return VenueType::PRIMARY_DEALER;
+    if (status_[slot_index].state == OrderState::PENDING_NEW) {
+        update_order_state(order_id, OrderState::ACKNOWLEDGED, AuditReason::VENUE_ACK);
     }
+    return true;
+}
+
+inline bool OrderLifecycleManager::process_reject(uint64_t order_id) noexcept {
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS || is_terminal(status_[slot_index].state)) return false;
+    
+    orders_[slot_index].leaves_quantity = 0;
+    status_[slot_index].leaves_quantity = 0;
+    update_order_state(order_id, OrderState::REJECTED, AuditReason::VENUE_REJECT);
+    metrics_.orders_rejected.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+inline bool OrderLifecycleManager::process_cancel_ack(uint64_t order_id) noexcept {
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS || is_terminal(status_[slot_index].state)) return false;
+    
+    orders_[slot_index].leaves_quantity = 0;
+    status_[slot_index].leaves_quantity = 0;
+    update_order_state(order_id, OrderState::CANCELLED, AuditReason::CANCEL_CONFIRMED);
+    metrics_.orders_cancelled.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+inline bool OrderLifecycleManager::process_cancel_reject(uint64_t order_id) noexcept {
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS || status_[slot_index].state != OrderState::PENDING_CANCEL) return false;
+    
+    const OrderState working = orders_[slot_index].executed_quantity > 0 ? OrderState::PARTIALLY_FILLED
+                                                                         : OrderState::ACKNOWLEDGED;
+    update_order_state(order_id, working, AuditReason::CANCEL_REJECTED);
+    return true;
+}
+
+inline bool OrderLifecycleManager::process_expire(uint64_t order_id) noexcept {
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS || is_terminal(status_[slot_index].state)) return false;
+    
+    orders_[slot_index].leaves_quantity = 0;
+    status_[slot_index].leaves_quantity = 0;
+    update_order_state(order_id, OrderState::EXPIRED, AuditReason::ORDER_EXPIRED);
+    return true;
+}
+
+inline OrderLifecycleManager::VenueType OrderLifecycleManager::route_order(uint64_t order_id) noexcept {
+    const auto start_time = timer_.get_timestamp_ns();
+    
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS) return VenueType::PRIMARY_DEALER;
     
     const auto& order = orders_[slot_index];
-    if (order.order_id != order_id) return VenueType::PRIMARY_DEALER;
     
     // Select optimal venue
     const VenueType selected_venue = select_optimal_venue(order.instrument, order.side, order.leaves_quantity);
@@ -541,7 +805,7 @@ inline OrderLifecycleManager::VenueType OrderLifecycleManager::route_order(uint6
     // Update order state
     auto& mutable_order = orders_[slot_index];
     mutable_order.target_venue = selected_venue;
-    update_order_state(order_id, OrderState::ROUTED, "Order routed to venue");
+    update_order_state(order_id, OrderState::ROUTED, AuditReason::ORDER_ROUTED);
     
     // Update metrics
     const auto routing_time = timer_.get_timestamp_ns() - start_time;
@@ -601,23 +865,31 @@ inline bool OrderLifecycleManager::check_risk_limits(
     return true;
 }
 
+inline bool OrderLifecycleManager::check_rate_limit(uint8_t strategy_id, VenueType venue, uint64_t now_ns) noexcept {
+    if (rate_limiters_ == nullptr) return true;
+    
+    const auto admission = rate_limiters_->try_acquire(strategy_id, static_cast<size_t>(venue), now_ns);
+    if (__builtin_expect(!admission.admitted, 0)) {
+        throttled_retry_at_ns_ = admission.retry_at_ns;
+        metrics_.orders_throttled.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
 inline void OrderLifecycleManager::update_order_state(
     uint64_t order_id, 
     OrderState new_state, 
-    const char* reason
+    AuditReason reason
 ) noexcept {
-    if (order_id == 0 || order_id >= MAX_ORDERS) return;
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS) return;
     
-    const size_t slot_index = order_id % MAX_ORDERS;
-    if (!order_slots_used_[slot_index].load(std::memory_order_acquire)) {
-        return;
-    }
-    
-    auto& order = orders_[slot_index];
-    if (order.order_id != order_id) return;
-    
-    const OrderState old_state = order.state;
-    order.state = new_state;
+    auto& status = status_[slot_index];
+    const OrderState old_state = status.state;
+    status.state = new_state;
+    orders_[slot_index].state = new_state;
+    journal_order(JournalEntryType::ORDER_UPDATE, orders_[slot_index]);
     
     add_audit_entry(order_id, old_state, new_state, reason);
 }
@@ -626,25 +898,40 @@ inline void OrderLifecycleManager::add_audit_entry(
     uint64_t order_id,
     OrderState old_state,
     OrderState new_state,
-    const char* reason
+    AuditReason reason
 ) noexcept {
+    if (audit_log_ != nullptr) {
+        AuditRecord record;
+        record.timestamp_ns = timer_.get_timestamp_ns();
+        record.order_id = order_id;
+        record.old_state = static_cast<uint8_t>(old_state);
+        record.new_state = static_cast<uint8_t>(new_state);
+        record.reason = reason;
+        record.venue = static_cast<uint8_t>(orders_[slot_of(order_id) % MAX_ORDERS].target_venue);
+        (void)audit_log_->record(audit_producer_, record);
+        return;
+    }
+    
     const size_t index = audit_trail_index_.fetch_add(1, std::memory_order_relaxed) % AUDIT_TRAIL_SIZE;
     
-    auto& entry = audit_trail_[index];
+    // Built whole and stored as one line: slots may never have been written
+    AuditEntry entry{};
     entry.entry_id = index;
     entry.order_id = order_id;
     entry.timestamp_ns = timer_.get_timestamp_ns();
     entry.old_state = old_state;
     entry.new_state = new_state;
     
-    // Copy reason string safely
+    // Copy reason text safely
+    const char* text = audit_reason_text(reason);
     const size_t max_len = sizeof(entry.reason) - 1;
     size_t i = 0;
-    while (i < max_len && reason[i] != '\0') {
-        entry.reason[i] = reason[i];
+    while (i < max_len && text[i] != '\0') {
+        entry.reason[i] = text[i];
         ++i;
     }
     entry.reason[i] = '\0';
+    audit_trail_[index] = entry;
 }
 
 inline OrderLifecycleManager::VenueType OrderLifecycleManager::select_optimal_venue(
@@ -692,39 +979,123 @@ inline void OrderLifecycleManager::update_venue_statistics(VenueType venue, bool
     config.last_activity_time_ns = timer_.get_timestamp_ns();
 }
 
-inline uint64_t OrderLifecycleManager::allocate_order_slot() noexcept {
-    for (size_t i = 0; i < MAX_ORDERS; ++i) {
-        const uint64_t order_id = next_order_id_.fetch_add(1, std::memory_order_relaxed);
-        const size_t slot_index = order_id % MAX_ORDERS;
+inline size_t OrderLifecycleManager::find_slot(uint64_t order_id) const noexcept {
+    const size_t slot_index = slot_of(order_id);
+    const uint32_t generation = generation_of(order_id);
+    
+    // Even generations (including 0) are never issued
+    if (__builtin_expect(slot_index >= MAX_ORDERS || (generation & 1) == 0, 0)) return MAX_ORDERS;
+    return status_[slot_index].generation.load(std::memory_order_acquire) == generation ? slot_index : MAX_ORDERS;
+}
+
+inline bool OrderLifecycleManager::is_terminal(OrderState state) noexcept {
+    return state == OrderState::FILLED || state == OrderState::CANCELLED || state == OrderState::REJECTED ||
+           state == OrderState::EXPIRED || state == OrderState::REPLACED;
+}
+
+inline uint32_t OrderLifecycleManager::allocate_order_slot() noexcept {
+    uint64_t head = free_head_.load(std::memory_order_acquire);
+    for (;;) {
+        const auto slot_index = static_cast<uint32_t>(head & SLOT_MASK);
+        if (slot_index == NO_SLOT) return NO_SLOT;
         
-        bool expected = false;
-        if (order_slots_used_[slot_index].compare_exchange_weak(expected, true, std::memory_order_acquire)) {
-            return order_id;
+        const uint64_t next = (((head >> 32) + 1) << 32) | free_next_[slot_index].load(std::memory_order_relaxed);
+        if (free_head_.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire)) {
+            return slot_index;
         }
     }
-    
-    return 0; // No available slots
 }
 
-inline void OrderLifecycleManager::deallocate_order_slot(uint64_t order_id) noexcept {
-    if (order_id == 0) return;
+inline void OrderLifecycleManager::deallocate_order_slot(uint32_t slot_index) noexcept {
+    // Back to an even generation first so stale IDs miss before the slot is reused
+    status_[slot_index].generation.fetch_add(1, std::memory_order_release);
+    
+    uint64_t head = free_head_.load(std::memory_order_relaxed);
+    uint64_t next;
+    do {
+        free_next_[slot_index].store(static_cast<uint32_t>(head & SLOT_MASK), std::memory_order_relaxed);
+        next = (((head >> 32) + 1) << 32) | slot_index;
+    } while (!free_head_.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+inline bool OrderLifecycleManager::retire_order(uint64_t order_id) noexcept {
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS || !is_terminal(status_[slot_index].state)) return false;
+    
+    const OrderState state = status_[slot_index].state;
+    add_audit_entry(order_id, state, state, AuditReason::ORDER_RETIRED);
+    journal_order(JournalEntryType::ORDER_RETIRE, orders_[slot_index]);
+    deallocate_order_slot(static_cast<uint32_t>(slot_index));
+    return true;
+}
+
+inline void OrderLifecycleManager::journal_order(JournalEntryType type, const OrderRecord& order) noexcept {
+    if (journal_ == nullptr) return;
+    
+    JournalEntry entry;
+    entry.type = type;
+    entry.timestamp_ns = type == JournalEntryType::ORDER_NEW ? order.creation_time_ns : timer_.get_timestamp_ns();
+    entry.order_id = order.order_id;
+    entry.quantity = order.original_quantity;
+    entry.executed_quantity = order.executed_quantity;
+    entry.price = order.order_price;
+    entry.instrument = static_cast<uint8_t>(order.instrument);
+    entry.side = static_cast<uint8_t>(order.side);
+    entry.state = static_cast<uint8_t>(order.state);
+    entry.venue = static_cast<uint8_t>(order.target_venue);
+    entry.strategy_id = order.strategy_id;
+    entry.order_type = static_cast<uint8_t>(order.type);
+    entry.time_in_force = static_cast<uint8_t>(order.time_in_force);
+    if (__builtin_expect(journal_->append(entry) == 0, 0)) {
+        metrics_.journal_entries_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+inline bool OrderLifecycleManager::restore_orders(
+    const uint32_t* generations,
+    const OrderRecord* records,
+    size_t count
+) noexcept {
+    // Every slot starts free under its recovered generation
+    for (size_t i = 0; i < MAX_ORDERS; ++i) {
+        status_[i].generation.store(generations[i] & ~1u, std::memory_order_relaxed);
+        status_[i].state = OrderState::CREATED;
+    }
     
-    const size_t slot_index = order_id % MAX_ORDERS;
-    order_slots_used_[slot_index].store(false, std::memory_order_release);
+    bool ok = true;
+    for (size_t r = 0; r < count; ++r) {
+        const OrderRecord& record = records[r];
+        const size_t slot_index = slot_of(record.order_id);
+        const uint32_t generation = generation_of(record.order_id);
+        if (slot_index >= MAX_ORDERS || (generation & 1) == 0) {
+            ok = false;
+            continue;
+        }
+        orders_[slot_index] = record;
+        auto& status = status_[slot_index];
+        status.state = record.state;
+        status.order_price = record.order_price;
+        status.leaves_quantity = record.leaves_quantity;
+        status.generation.store(generation, std::memory_order_relaxed);
+    }
+    
+    // Rebuild the free list from every slot left free, lowest first
+    uint32_t head = NO_SLOT;
+    for (size_t i = MAX_ORDERS; i-- > 0;) {
+        if ((status_[i].generation.load(std::memory_order_relaxed) & 1) == 0) {
+            free_next_[i].store(head, std::memory_order_relaxed);
+            head = static_cast<uint32_t>(i);
+        }
+    }
+    free_head_.store(head, std::memory_order_release);
+    return ok;
 }
 
 // Getter implementations
 inline const OrderLifecycleManager::OrderRecord* 
 OrderLifecycleManager::get_order(uint64_t order_id) const noexcept {
-    if (order_id == 0 || order_id >= MAX_ORDERS) return nullptr;
-    
-    const size_t slot_index = order_id % MAX_ORDERS;
-    if (!order_slots_used_[slot_index].load(std::memory_order_acquire)) {
-        return nullptr;
-    }
-    
-    const auto& order = orders_[slot_index];
-    return (order.order_id == order_id) ? &order : nullptr;
+    const size_t slot_index = find_slot(order_id);
+    return slot_index < MAX_ORDERS ? &orders_[slot_index] : nullptr;
 }
 
 inline const OrderLifecycleManager::VenueConfig& 
@@ -738,11 +1109,10 @@ inline void OrderLifecycleManager::emergency_stop() noexcept {
     
     // Cancel all active orders
     for (size_t i = 0; i < MAX_ORDERS; ++i) {
-        if (order_slots_used_[i].load(std::memory_order_acquire)) {
-            auto& order = orders_[i];
-            if (order.state != OrderState::FILLED && order.state != OrderState::CANCELLED) {
-                update_order_state(order.order_id, OrderState::CANCELLED, "Emergency stop");
-            }
+        const auto& status = status_[i];
+        if ((status.generation.load(std::memory_order_acquire) & 1) != 0 &&
+            status.state != OrderState::FILLED && status.state != OrderState::CANCELLED) {
+            update_order_state(orders_[i].order_id, OrderState::CANCELLED, AuditReason::EMERGENCY_STOP);
         }
     }
 }
@@ -760,22 +1130,24 @@ inline void OrderLifecycleManager::update_risk_limits(const RiskLimits& limits)
 }
 
 inline bool OrderLifecycleManager::modify_order(uint64_t order_id, Price32nd new_price, uint64_t new_quantity) noexcept {
-    if (order_id == 0 || order_id >= MAX_ORDERS) return false;
+    const size_t slot_index = find_slot(order_id);
+    if (slot_index == MAX_ORDERS) return false;
     
-    const size_t slot_index = order_id % MAX_ORDERS;
-    if (!order_slots_used_[slot_index].load(std::memory_order_acquire)) {
+    auto& order = orders_[slot_index];
+    
+    // An amend is a venue message too
+    if (!check_rate_limit(order.strategy_id, order.target_venue, timer_.get_timestamp_ns())) {
         return false;
     }
     
-    auto& order = orders_[slot_index];
-    if (order.order_id != order_id) return false;
-    
     // Simple modification (in production would validate and send to venue)
     order.order_price = new_price;
     order.original_quantity = new_quantity;
     order.leaves_quantity = new_quantity - order.executed_quantity;
+    status_[slot_index].order_price = new_price;
+    status_[slot_index].leaves_quantity = order.leaves_quantity;
     
-    update_order_state(order_id, OrderState::PENDING_REPLACE, "Order modification");
+    update_order_state(order_id, OrderState::PENDING_REPLACE, AuditReason::ORDER_MODIFIED);
     
     return true;
 }
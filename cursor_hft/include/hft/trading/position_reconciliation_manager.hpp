@@ -7,11 +7,16 @@
 #include <memory>
 #include <unordered_map>
 #include <chrono>
+#include <cstring>
+#include <span>
+#include <vector>
 #include "hft/timing/hft_timer.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
 #include "hft/market_data/treasury_instruments.hpp"
 #include "hft/trading/order_lifecycle_manager.hpp"
+#include "hft/runtime/work_stealing_pool.hpp"
+#include "hft/config/system_traits.hpp"
 
 namespace hft {
 namespace trading {
@@ -29,6 +34,19 @@ using namespace hft::market_data;
  * - Automated position correction workflows
  * - Performance metrics and audit trails
  * 
+ * Reconciliation is incremental. Each (instrument, venue) keeps the venue's
+ * view of the position (last report plus drop-copy fills since) next to
+ * ours, and every fill, drop copy or report re-checks only that pair. A
+ * break opens the moment the difference leaves POSITION_TOLERANCE and
+ * resolves itself when it comes back; open breaks sit on an intrusive list,
+ * so listing them costs O(unresolved), not O(history). Until a venue has
+ * reported or sent a drop copy its pairs are not reconciled.
+ * 
+ * End-of-day settlement nets the day's fill history per (instrument,
+ * venue), optionally split across a WorkStealingPool, into one instruction
+ * per pair held in the settlement ObjectPool; reports are written into a
+ * caller-owned buffer.
+ * 
  * Performance targets:
  * - Position update: <200ns
  * - Settlement calculation: <1μs
@@ -38,11 +56,13 @@ using namespace hft::market_data;
  */
 class alignas(64) PositionReconciliationManager {
 public:
-    static constexpr size_t MAX_INSTRUMENTS = 6;
-    static constexpr size_t MAX_VENUES = 8;
-    static constexpr size_t MAX_SETTLEMENT_ENTRIES = 10000;
+    static constexpr size_t MAX_INSTRUMENTS = config::SystemTraits::MAX_INSTRUMENTS;
+    static constexpr size_t MAX_VENUES = config::SystemTraits::MAX_VENUES;
+    static constexpr size_t MAX_SETTLEMENT_ENTRIES = MAX_INSTRUMENTS * MAX_VENUES;  // One per instrument/venue
+    static constexpr size_t SETTLEMENT_NETTING_CHUNK = 4096;   // History entries per netting task
     static constexpr size_t MAX_POSITION_HISTORY = 100000;
     static constexpr size_t MAX_BREAKS = 1000;
+    static constexpr int64_t POSITION_TOLERANCE = 1;        // Allowed |venue - internal| (rounding)
     
     // Settlement status for Treasury instruments
     enum class SettlementStatus : uint8_t {
@@ -140,11 +160,11 @@ public:
     };
     static_assert(sizeof(PositionHistoryEntry) == 64, "PositionHistoryEntry must be 64 bytes");
     
-    // Daily settlement report
+    // Daily settlement report summary; the instructions go to a caller buffer
     struct SettlementReport {
         uint64_t report_date_ns = 0;
-        std::array<SettlementInstruction, MAX_SETTLEMENT_ENTRIES> settlements;
-        size_t settlement_count = 0;
+        size_t settlement_count = 0;                        // Instructions generated
+        size_t settlements_written = 0;                     // Copied into the caller's buffer
         double total_settlement_value = 0.0;
         size_t pending_settlements = 0;
         size_t failed_settlements = 0;
@@ -160,6 +180,7 @@ public:
         std::atomic<uint64_t> total_position_update_time_ns{0};
         std::atomic<uint64_t> total_settlement_calc_time_ns{0};
         std::atomic<uint64_t> total_break_detection_time_ns{0};
+        std::atomic<uint64_t> journal_entries_dropped{0};  // Journal full: change not recoverable
     };
     
     /**
@@ -210,6 +231,9 @@ public:
      * @param venue Trading venue
      * @param venue_reported_position Position reported by venue
      * @return true if positions match, false if break detected
+     *
+     * Replaces the venue's view of the position. A mismatch opens a break,
+     * or updates the one already open for this instrument/venue.
      */
     bool reconcile_venue_position(
         TreasuryType instrument,
@@ -217,22 +241,59 @@ public:
         int64_t venue_reported_position
     ) noexcept;
     
+    /**
+     * @brief Apply a venue drop-copy fill to the venue's view of the position
+     * @param instrument Treasury instrument
+     * @param venue Trading venue
+     * @param side Order side
+     * @param quantity Fill quantity
+     * @return true if positions match afterwards
+     *
+     * Keeps the venue view current between position reports, so our own
+     * fills only show as breaks while the venue's copy is outstanding.
+     */
+    bool apply_venue_fill(
+        TreasuryType instrument,
+        OrderLifecycleManager::VenueType venue,
+        OrderSide side,
+        uint64_t quantity
+    ) noexcept;
+    
+    /**
+     * @brief Venue view minus internal position (0 until the venue has reported)
+     */
+    [[nodiscard]] int64_t get_position_delta(
+        TreasuryType instrument,
+        OrderLifecycleManager::VenueType venue
+    ) const noexcept;
+    
     /**
      * @brief Generate end-of-day settlement instructions
      * @param settlement_date Settlement date (T+1)
+     * @param pool Nets history chunks on its lanes (nullptr = calling thread)
      * @return Number of settlement instructions generated
+     *
+     * Nets the fills since reset_daily_positions() per instrument/venue:
+     * quantity and cash at the traded prices. If the day's history is
+     * incomplete (it wrapped, or positions were restored) each pair settles
+     * its net position at the current mark instead. Replaces instructions
+     * from an earlier call; fewer are generated if the settlement pool runs
+     * out.
      */
     [[nodiscard]] size_t generate_settlement_instructions(
-        uint64_t settlement_date
+        uint64_t settlement_date,
+        WorkStealingPool* pool = nullptr
     ) noexcept;
     
     /**
      * @brief Generate daily settlement report
      * @param report_date Date for settlement report
-     * @return Settlement report
+     * @param out Receives up to out.size() instructions
+     * @return Settlement report summary (covers every instruction)
      */
     [[nodiscard]] SettlementReport generate_settlement_report(
-        uint64_t report_date
+        uint64_t report_date,
+        std::span<SettlementInstruction> out = {}
     ) const noexcept;
     
     /**
@@ -263,17 +324,22 @@ public:
     /**
      * @brief Get unresolved position breaks
      * @param max_breaks Maximum number of breaks to return
-     * @return Vector of unresolved breaks
+     * @return Vector of unresolved breaks, oldest first
      */
     [[nodiscard]] std::vector<PositionBreak> get_unresolved_breaks(
         size_t max_breaks = 100
     ) const noexcept;
     
+    [[nodiscard]] size_t unresolved_break_count() const noexcept { return unresolved_count_; }
+    
     /**
      * @brief Mark position break as resolved
      * @param break_id Break ID to resolve
      * @param resolution_notes Resolution description
      * @return true if break resolved successfully
+     *
+     * If the positions still differ, the next fill or report on the
+     * instrument/venue opens a new break.
      */
     bool resolve_position_break(
         uint64_t break_id,
@@ -290,6 +356,23 @@ public:
      * @brief Reset all positions (end-of-day cleanup)
      */
     void reset_daily_positions() noexcept;
+    
+    /**
+     * @brief Journal fills and marks for warm restart (nullptr = off)
+     */
+    void set_journal(StateJournal* journal) noexcept { journal_ = journal; }
+    
+    [[nodiscard]] Price32nd get_market_price(TreasuryType instrument) const noexcept {
+        const auto index = static_cast<size_t>(instrument);
+        return index < MAX_INSTRUMENTS ? current_market_prices_[index] : Price32nd{};
+    }
+    
+    /**
+     * @brief Replace positions and marks with recovered state; recovery only
+     * @param positions Placed by their instrument and venue fields
+     * @param market_prices MAX_INSTRUMENTS marks
+     */
+    void restore_positions(const VenuePosition* positions, size_t count, const Price32nd* market_prices) noexcept;
 
 private:
     // Infrastructure references
@@ -302,22 +385,49 @@ private:
     alignas(64) std::array<std::array<VenuePosition, MAX_VENUES>, MAX_INSTRUMENTS> positions_;
     alignas(64) std::array<Price32nd, MAX_INSTRUMENTS> current_market_prices_;
     
-    // Settlement tracking
-    alignas(64) std::array<SettlementInstruction, MAX_SETTLEMENT_ENTRIES> settlement_instructions_;
+    // Settlement tracking: instructions live in settlement_pool_ until regenerated or reset
+    alignas(64) std::array<SettlementInstruction*, MAX_SETTLEMENT_ENTRIES> settlement_instructions_;
     alignas(64) std::atomic<size_t> settlement_count_;
     
-    // Break tracking
+    // Break tracking: a ring of MAX_BREAKS whose open breaks are never overwritten
     alignas(64) std::array<PositionBreak, MAX_BREAKS> position_breaks_;
-    alignas(64) std::atomic<size_t> break_count_;
+    alignas(64) std::atomic<size_t> break_count_;                      // Next ring slot
     alignas(64) std::atomic<uint64_t> next_break_id_;
     
+    // Incremental reconciliation state per instrument/venue
+    static constexpr uint32_t NO_BREAK = UINT32_MAX;
+    
+    struct ReconciliationState {
+        int64_t venue_position = 0;                         // Last report plus drop copies since
+        uint32_t open_break = NO_BREAK;                     // Slot of the unresolved break
+        bool venue_known = false;                           // Reported or sent a drop copy
+    };
+    
+    // Unresolved list links, parallel to position_breaks_
+    struct BreakLink {
+        uint32_t prev = NO_BREAK;
+        uint32_t next = NO_BREAK;
+        uint32_t cell = 0;                                  // Owning reconciliation_ index
+    };
+    
+    alignas(64) std::array<ReconciliationState, MAX_INSTRUMENTS * MAX_VENUES> reconciliation_;
+    alignas(64) std::array<BreakLink, MAX_BREAKS> break_links_;
+    uint32_t unresolved_head_;
+    uint32_t unresolved_tail_;
+    size_t unresolved_count_;
+    
     // Position history for audit
     alignas(64) std::array<PositionHistoryEntry, MAX_POSITION_HISTORY> position_history_;
     alignas(64) std::atomic<size_t> history_index_;
+    size_t history_day_start_;                              // history_index_ at the last daily reset
+    bool history_complete_;                                 // Every fill of the day is in the history
     
     // Performance tracking
     alignas(64) PerformanceMetrics metrics_;
     
+    // Warm-restart journal
+    StateJournal* journal_;
+    
     // Helper methods
     void add_position_history_entry(
         uint64_t order_id,
@@ -338,6 +448,11 @@ private:
         const char* description
     ) noexcept;
     
+    // Open, update or auto-resolve the cell's break; true if within tolerance
+    bool reconcile_cell(size_t cell) noexcept;
+    
+    void unlink_break(uint32_t slot) noexcept;
+    
     void calculate_unrealized_pnl(
         TreasuryType instrument,
         OrderLifecycleManager::VenueType venue
@@ -349,6 +464,17 @@ private:
     ) const noexcept;
     
     [[nodiscard]] uint64_t get_settlement_date(uint64_t trade_date) const noexcept;
+    
+    // Net quantity and cash of one instrument/venue
+    struct NetSettlement {
+        int64_t quantity = 0;
+        double value = 0.0;
+    };
+    using NetTable = std::array<NetSettlement, MAX_SETTLEMENT_ENTRIES>;
+    
+    void net_history(NetTable& net, WorkStealingPool* pool) const noexcept;
+    
+    void release_settlement_instructions() noexcept;
 };
 
 // Implementation
@@ -369,9 +495,17 @@ inline PositionReconciliationManager::PositionReconciliationManager(
       position_breaks_{},
       break_count_(0),
       next_break_id_(1),
+      reconciliation_{},
+      break_links_{},
+      unresolved_head_(NO_BREAK),
+      unresolved_tail_(NO_BREAK),
+      unresolved_count_(0),
       position_history_{},
       history_index_(0),
-      metrics_{} {
+      history_day_start_(0),
+      history_complete_(true),
+      metrics_{},
+      journal_(nullptr) {
     
     // Initialize positions
     for (size_t inst = 0; inst < MAX_INSTRUMENTS; ++inst) {
@@ -442,6 +576,26 @@ inline bool PositionReconciliationManager::update_position(
     add_position_history_entry(order_id, instrument, venue, side, 
                               position_change, position.net_position, price);
     
+    const size_t cell = get_position_index(instrument, venue);
+    if (reconciliation_[cell].venue_known) {
+        (void)reconcile_cell(cell);
+    }
+    
+    if (journal_ != nullptr) {
+        JournalEntry entry;
+        entry.type = JournalEntryType::POSITION_FILL;
+        entry.timestamp_ns = start_time;
+        entry.order_id = order_id;
+        entry.quantity = quantity;
+        entry.price = price;
+        entry.instrument = static_cast<uint8_t>(instrument);
+        entry.side = static_cast<uint8_t>(side);
+        entry.venue = static_cast<uint8_t>(venue);
+        if (__builtin_expect(journal_->append(entry) == 0, 0)) {
+            metrics_.journal_entries_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    
     // Update performance metrics
     metrics_.position_updates_processed.fetch_add(1, std::memory_order_relaxed);
     const auto update_time = timer_.get_timestamp_ns() - start_time;
@@ -463,6 +617,42 @@ inline void PositionReconciliationManager::update_market_price(
     for (size_t venue = 0; venue < MAX_VENUES; ++venue) {
         calculate_unrealized_pnl(instrument, static_cast<OrderLifecycleManager::VenueType>(venue));
     }
+    
+    if (journal_ != nullptr) {
+        JournalEntry entry;
+        entry.type = JournalEntryType::POSITION_MARK;
+        entry.timestamp_ns = timer_.get_timestamp_ns();
+        entry.price = market_price;
+        entry.instrument = static_cast<uint8_t>(instrument);
+        if (__builtin_expect(journal_->append(entry) == 0, 0)) {
+            metrics_.journal_entries_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+inline void PositionReconciliationManager::restore_positions(
+    const VenuePosition* positions,
+    size_t count,
+    const Price32nd* market_prices
+) noexcept {
+    for (size_t inst = 0; inst < MAX_INSTRUMENTS; ++inst) {
+        current_market_prices_[inst] = market_prices[inst];
+    }
+    for (size_t i = 0; i < count; ++i) {
+        const auto inst_index = static_cast<size_t>(positions[i].instrument);
+        const auto venue_index = static_cast<size_t>(positions[i].venue);
+        if (inst_index < MAX_INSTRUMENTS && venue_index < MAX_VENUES) {
+            positions_[inst_index][venue_index] = positions[i];
+        }
+    }
+    
+    // Venue views are not journaled: reconcile again from the next reports
+    for (auto& state : reconciliation_) {
+        state.venue_known = false;
+    }
+    
+    // Fills before the snapshot are not in the history
+    history_complete_ = false;
 }
 
 inline void PositionReconciliationManager::calculate_unrealized_pnl(
@@ -501,23 +691,94 @@ inline bool PositionReconciliationManager::reconcile_venue_position(
         return false;
     }
     
-    const auto& position = positions_[inst_index][venue_index];
-    const int64_t expected_position = position.net_position;
-    const int64_t variance = venue_reported_position - expected_position;
+    const size_t cell = get_position_index(instrument, venue);
+    auto& state = reconciliation_[cell];
+    state.venue_position = venue_reported_position;
+    state.venue_known = true;
     
-    // Check for position break (tolerance of ±1 unit for rounding)
-    if (std::abs(variance) > 1) {
-        detect_position_break(instrument, venue, expected_position, venue_reported_position,
-                             BreakType::POSITION_MISMATCH, "Venue position mismatch");
-        
-        // Update performance metrics
-        const auto detection_time = timer_.get_timestamp_ns() - start_time;
-        metrics_.total_break_detection_time_ns.fetch_add(detection_time, std::memory_order_relaxed);
-        
+    const bool matched = reconcile_cell(cell);
+    
+    // Update performance metrics
+    const auto detection_time = timer_.get_timestamp_ns() - start_time;
+    metrics_.total_break_detection_time_ns.fetch_add(detection_time, std::memory_order_relaxed);
+    
+    return matched;
+}
+
+inline bool PositionReconciliationManager::apply_venue_fill(
+    TreasuryType instrument,
+    OrderLifecycleManager::VenueType venue,
+    OrderSide side,
+    uint64_t quantity
+) noexcept {
+    if (static_cast<size_t>(instrument) >= MAX_INSTRUMENTS || static_cast<size_t>(venue) >= MAX_VENUES) {
         return false;
     }
     
-    return true;
+    const size_t cell = get_position_index(instrument, venue);
+    auto& state = reconciliation_[cell];
+    state.venue_position += (side == OrderSide::BID) ? static_cast<int64_t>(quantity) : -static_cast<int64_t>(quantity);
+    state.venue_known = true;
+    return reconcile_cell(cell);
+}
+
+inline int64_t PositionReconciliationManager::get_position_delta(
+    TreasuryType instrument,
+    OrderLifecycleManager::VenueType venue
+) const noexcept {
+    const auto inst_index = static_cast<size_t>(instrument);
+    const auto venue_index = static_cast<size_t>(venue);
+    if (inst_index >= MAX_INSTRUMENTS || venue_index >= MAX_VENUES) return 0;
+    
+    const auto& state = reconciliation_[get_position_index(instrument, venue)];
+    return state.venue_known ? state.venue_position - positions_[inst_index][venue_index].net_position : 0;
+}
+
+inline bool PositionReconciliationManager::reconcile_cell(size_t cell) noexcept {
+    auto& state = reconciliation_[cell];
+    const auto& position = positions_[cell / MAX_VENUES][cell % MAX_VENUES];
+    const int64_t variance = state.venue_position - position.net_position;
+    const bool matched = std::abs(variance) <= POSITION_TOLERANCE;
+    
+    if (state.open_break == NO_BREAK) {
+        if (!matched) {
+            detect_position_break(position.instrument, position.venue, position.net_position, state.venue_position,
+                                  BreakType::POSITION_MISMATCH, "Venue position mismatch");
+        }
+        return matched;
+    }
+    
+    auto& pos_break = position_breaks_[state.open_break];
+    if (matched) {
+        // Back within tolerance: the break clears itself
+        pos_break.resolved = true;
+        pos_break.resolution_time_ns = timer_.get_timestamp_ns();
+        std::strncpy(pos_break.description, "Reconciled", sizeof(pos_break.description));
+        unlink_break(state.open_break);
+        metrics_.breaks_resolved.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        pos_break.expected_position = position.net_position;
+        pos_break.actual_position = state.venue_position;
+        pos_break.variance = variance;
+    }
+    return matched;
+}
+
+inline void PositionReconciliationManager::unlink_break(uint32_t slot) noexcept {
+    auto& link = break_links_[slot];
+    if (link.prev != NO_BREAK) {
+        break_links_[link.prev].next = link.next;
+    } else {
+        unresolved_head_ = link.next;
+    }
+    if (link.next != NO_BREAK) {
+        break_links_[link.next].prev = link.prev;
+    } else {
+        unresolved_tail_ = link.prev;
+    }
+    reconciliation_[link.cell].open_break = NO_BREAK;
+    link.prev = link.next = NO_BREAK;
+    --unresolved_count_;
 }
 
 inline void PositionReconciliationManager::detect_position_break(
@@ -528,7 +789,16 @@ inline void PositionReconciliationManager::detect_position_break(
     BreakType break_type,
     const char* description
 ) noexcept {
-    const size_t break_index = break_count_.fetch_add(1, std::memory_order_relaxed) % MAX_BREAKS;
+    // Next ring slot not holding an open break; with every slot open, the oldest break is dropped
+    uint32_t break_index;
+    if (unresolved_count_ == MAX_BREAKS) {
+        break_index = unresolved_head_;
+        unlink_break(break_index);
+    } else {
+        do {
+            break_index = static_cast<uint32_t>(break_count_.fetch_add(1, std::memory_order_relaxed) % MAX_BREAKS);
+        } while (position_breaks_[break_index].break_id != 0 && !position_breaks_[break_index].resolved);
+    }
     
     auto& pos_break = position_breaks_[break_index];
     pos_break.break_id = next_break_id_.fetch_add(1, std::memory_order_relaxed);
@@ -551,6 +821,21 @@ inline void PositionReconciliationManager::detect_position_break(
     }
     pos_break.description[i] = '\0';
     
+    // Append to the unresolved list and attach to its instrument/venue
+    const size_t cell = get_position_index(instrument, venue);
+    auto& link = break_links_[break_index];
+    link.prev = unresolved_tail_;
+    link.next = NO_BREAK;
+    link.cell = static_cast<uint32_t>(cell);
+    if (unresolved_tail_ != NO_BREAK) {
+        break_links_[unresolved_tail_].next = break_index;
+    } else {
+        unresolved_head_ = break_index;
+    }
+    unresolved_tail_ = break_index;
+    ++unresolved_count_;
+    reconciliation_[cell].open_break = break_index;
+    
     // Try to send break notification
     break_buffer_.try_push(pos_break);
     
@@ -582,37 +867,48 @@ inline void PositionReconciliationManager::add_position_history_entry(
 }
 
 inline size_t PositionReconciliationManager::generate_settlement_instructions(
-    uint64_t settlement_date
+    uint64_t settlement_date,
+    WorkStealingPool* pool
 ) noexcept {
     const auto start_time = timer_.get_timestamp_ns();
-    size_t instructions_generated = 0;
+    release_settlement_instructions();
     
-    for (size_t inst = 0; inst < MAX_INSTRUMENTS; ++inst) {
-        for (size_t venue = 0; venue < MAX_VENUES; ++venue) {
-            const auto& position = positions_[inst][venue];
-            
-            if (position.net_position != 0) {
-                if (settlement_count_.load() < MAX_SETTLEMENT_ENTRIES) {
-                    const size_t settlement_index = settlement_count_.fetch_add(1, std::memory_order_relaxed);
-                    
-                    auto& instruction = settlement_instructions_[settlement_index];
-                    instruction.settlement_id = settlement_index + 1;
-                    instruction.instrument = position.instrument;
-                    instruction.venue = position.venue;
-                    instruction.status = SettlementStatus::PENDING;
-                    instruction.net_quantity = position.net_position;
-                    instruction.settlement_price = current_market_prices_[inst];
-                    instruction.settlement_value = position.net_position * instruction.settlement_price.to_decimal();
-                    instruction.trade_date_ns = timer_.get_timestamp_ns();
-                    instruction.settlement_date_ns = settlement_date;
-                    instruction.created_time_ns = timer_.get_timestamp_ns();
-                    
-                    ++instructions_generated;
-                }
-            }
+    NetTable net{};
+    if (history_complete_ && history_index_.load(std::memory_order_relaxed) - history_day_start_ <= MAX_POSITION_HISTORY) {
+        net_history(net, pool);
+    } else {
+        for (size_t cell = 0; cell < MAX_SETTLEMENT_ENTRIES; ++cell) {
+            const auto& position = positions_[cell / MAX_VENUES][cell % MAX_VENUES];
+            net[cell].quantity = position.net_position;
+            net[cell].value = position.net_position * current_market_prices_[cell / MAX_VENUES].to_decimal();
         }
     }
     
+    size_t instructions_generated = 0;
+    for (size_t cell = 0; cell < MAX_SETTLEMENT_ENTRIES; ++cell) {
+        const auto& [quantity, value] = net[cell];
+        if (quantity == 0 && value == 0.0) continue;
+        
+        SettlementInstruction* instruction = settlement_pool_.acquire();
+        if (instruction == nullptr) break;
+        
+        const auto& position = positions_[cell / MAX_VENUES][cell % MAX_VENUES];
+        *instruction = SettlementInstruction{};
+        instruction->settlement_id = instructions_generated + 1;
+        instruction->instrument = position.instrument;
+        instruction->venue = position.venue;
+        instruction->status = SettlementStatus::PENDING;
+        instruction->net_quantity = quantity;
+        instruction->settlement_price = quantity != 0 ? Price32nd::from_decimal(std::abs(value / static_cast<double>(quantity)))
+                                                      : current_market_prices_[cell / MAX_VENUES];
+        instruction->settlement_value = value;
+        instruction->trade_date_ns = start_time;
+        instruction->settlement_date_ns = settlement_date;
+        instruction->created_time_ns = start_time;
+        settlement_instructions_[instructions_generated++] = instruction;
+    }
+    settlement_count_.store(instructions_generated, std::memory_order_relaxed);
+    
     // Update performance metrics
     metrics_.settlement_instructions_generated.fetch_add(instructions_generated, std::memory_order_relaxed);
     const auto calc_time = timer_.get_timestamp_ns() - start_time;
@@ -621,23 +917,67 @@ inline size_t PositionReconciliationManager::generate_settlement_instructions(
     return instructions_generated;
 }
 
+inline void PositionReconciliationManager::net_history(NetTable& net, WorkStealingPool* pool) const noexcept {
+    const size_t first = history_day_start_;
+    const size_t count = history_index_.load(std::memory_order_acquire) - first;
+    const size_t chunks = (count + SETTLEMENT_NETTING_CHUNK - 1) / SETTLEMENT_NETTING_CHUNK;
+    if (chunks == 0) return;
+    
+    // One partial table per chunk, summed in chunk order so the cash totals do
+    // not depend on which lane netted what
+    std::vector<NetTable> partials(chunks);
+    const auto net_chunk = [&](size_t chunk, size_t) {
+        NetTable& partial = partials[chunk];
+        const size_t end = std::min(count, (chunk + 1) * SETTLEMENT_NETTING_CHUNK);
+        for (size_t i = chunk * SETTLEMENT_NETTING_CHUNK; i < end; ++i) {
+            const auto& entry = position_history_[(first + i) % MAX_POSITION_HISTORY];
+            auto& cell = partial[get_position_index(entry.instrument, entry.venue)];
+            cell.quantity += entry.position_change;
+            cell.value += static_cast<double>(entry.position_change) * entry.trade_price.to_decimal();
+        }
+    };
+    if (pool != nullptr && chunks > 1) {
+        pool->parallel_for(chunks, net_chunk);
+    } else {
+        for (size_t chunk = 0; chunk < chunks; ++chunk) net_chunk(chunk, 0);
+    }
+    
+    for (const auto& partial : partials) {
+        for (size_t cell = 0; cell < MAX_SETTLEMENT_ENTRIES; ++cell) {
+            net[cell].quantity += partial[cell].quantity;
+            net[cell].value += partial[cell].value;
+        }
+    }
+}
+
+inline void PositionReconciliationManager::release_settlement_instructions() noexcept {
+    const size_t count = settlement_count_.exchange(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        settlement_pool_.release(settlement_instructions_[i]);
+    }
+}
+
 inline PositionReconciliationManager::SettlementReport 
-PositionReconciliationManager::generate_settlement_report(uint64_t report_date) const noexcept {
+PositionReconciliationManager::generate_settlement_report(
+    uint64_t report_date,
+    std::span<SettlementInstruction> out
+) const noexcept {
     SettlementReport report;
     report.report_date_ns = report_date;
     report.report_generation_time_ns = timer_.get_timestamp_ns();
+    report.settlement_count = settlement_count_.load();
+    report.settlements_written = std::min(report.settlement_count, out.size());
     
-    const size_t settlement_count = settlement_count_.load();
-    report.settlement_count = std::min(settlement_count, MAX_SETTLEMENT_ENTRIES);
-    
-    // Copy settlement instructions
     for (size_t i = 0; i < report.settlement_count; ++i) {
-        report.settlements[i] = settlement_instructions_[i];
-        report.total_settlement_value += settlement_instructions_[i].settlement_value;
+        const SettlementInstruction& instruction = *settlement_instructions_[i];
+        if (i < report.settlements_written) {
+            out[i] = instruction;
+        }
+        report.total_settlement_value += instruction.settlement_value;
         
-        if (settlement_instructions_[i].status == SettlementStatus::PENDING) {
+        if (instruction.status == SettlementStatus::PENDING) {
             ++report.pending_settlements;
-        } else if (settlement_instructions_[i].status == SettlementStatus::FAILED) {
+        } else if (instruction.status == SettlementStatus::FAILED) {
             ++report.failed_settlements;
         }
     }
@@ -689,16 +1029,11 @@ inline double PositionReconciliationManager::get_total_pnl(TreasuryType instrume
 inline std::vector<PositionReconciliationManager::PositionBreak> 
 PositionReconciliationManager::get_unresolved_breaks(size_t max_breaks) const noexcept {
     std::vector<PositionBreak> unresolved_breaks;
-    unresolved_breaks.reserve(max_breaks);
-    
-    const size_t break_count = break_count_.load();
-    const size_t total_breaks = std::min(break_count, MAX_BREAKS);
+    unresolved_breaks.reserve(std::min(max_breaks, unresolved_count_));
     
-    for (size_t i = 0; i < total_breaks && unresolved_breaks.size() < max_breaks; ++i) {
-        const auto& pos_break = position_breaks_[i];
-        if (!pos_break.resolved) {
-            unresolved_breaks.push_back(pos_break);
-        }
+    for (uint32_t slot = unresolved_head_; slot != NO_BREAK && unresolved_breaks.size() < max_breaks;
+         slot = break_links_[slot].next) {
+        unresolved_breaks.push_back(position_breaks_[slot]);
     }
     
     return unresolved_breaks;
@@ -708,30 +1043,30 @@ inline bool PositionReconciliationManager::resolve_position_break(
     uint64_t break_id,
     const char* resolution_notes
 ) noexcept {
-    const size_t break_count = break_count_.load();
-    const size_t total_breaks = std::min(break_count, MAX_BREAKS);
-    
-    for (size_t i = 0; i < total_breaks; ++i) {
-        auto& pos_break = position_breaks_[i];
-        if (pos_break.break_id == break_id && !pos_break.resolved) {
-            pos_break.resolved = true;
-            pos_break.resolution_time_ns = timer_.get_timestamp_ns();
-            
-            // Copy resolution notes to description
-            const size_t max_len = sizeof(pos_break.description) - 1;
-            size_t j = 0;
-            while (j < max_len && resolution_notes[j] != '\0') {
-                pos_break.description[j] = resolution_notes[j];
-                ++j;
-            }
-            pos_break.description[j] = '\0';
-            
-            metrics_.breaks_resolved.fetch_add(1, std::memory_order_relaxed);
-            return true;
-        }
+    uint32_t slot = unresolved_head_;
+    while (slot != NO_BREAK && position_breaks_[slot].break_id != break_id) {
+        slot = break_links_[slot].next;
+    }
+    if (slot == NO_BREAK) {
+        return false;
     }
     
-    return false;
+    auto& pos_break = position_breaks_[slot];
+    pos_break.resolved = true;
+    pos_break.resolution_time_ns = timer_.get_timestamp_ns();
+    unlink_break(slot);
+    
+    // Copy resolution notes to description
+    const size_t max_len = sizeof(pos_break.description) - 1;
+    size_t j = 0;
+    while (j < max_len && resolution_notes[j] != '\0') {
+        pos_break.description[j] = resolution_notes[j];
+        ++j;
+    }
+    pos_break.description[j] = '\0';
+    
+    metrics_.breaks_resolved.fetch_add(1, std::memory_order_relaxed);
+    return true;
 }
 
 inline void PositionReconciliationManager::reset_daily_positions() noexcept {
@@ -749,12 +1084,27 @@ inline void PositionReconciliationManager::reset_daily_positions() noexcept {
         }
     }
     
-    // Reset settlement instructions
-    settlement_count_.store(0, std::memory_order_relaxed);
+    // Reset settlement instructions and start the day's history
+    release_settlement_instructions();
+    history_day_start_ = history_index_.load(std::memory_order_relaxed);
+    history_complete_ = true;
     
     // Reset break tracking
     break_count_.store(0, std::memory_order_relaxed);
     next_break_id_.store(1, std::memory_order_relaxed);
+    position_breaks_.fill(PositionBreak{});
+    break_links_.fill(BreakLink{});
+    reconciliation_.fill(ReconciliationState{});
+    unresolved_head_ = NO_BREAK;
+    unresolved_tail_ = NO_BREAK;
+    unresolved_count_ = 0;
+}
+
+inline size_t PositionReconciliationManager::get_position_index(
+    TreasuryType instrument,
+    OrderLifecycleManager::VenueType venue
+) const noexcept {
+    return static_cast<size_t>(instrument) * MAX_VENUES + static_cast<size_t>(venue);
 }
 
 inline uint64_t PositionReconciliationManager::get_settlement_date(uint64_t trade_date) const noexcept {
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <atomic>
+
+namespace hft {
+namespace trading {
+
+/**
+ * @brief Lock-free token bucket for venue message-rate limits
+ *
+ * GCRA form of a token bucket: one atomic "theoretical arrival time" (TAT)
+ * advances by the emission interval (interval_ns / max_messages) per
+ * message, and a message is admitted while the TAT stays within burst
+ * intervals of now. Any number of threads share one limiter; the fast path
+ * is a single fetch_add. A rejected message hands its interval back and
+ * learns the exact time it would have been admitted.
+ *
+ * Leaving an idle period (TAT behind now) resets the TAT with one CAS;
+ * threads racing that reset can each get one message through uncounted.
+ *
+ * Unconfigured (max_messages = 0) limiters admit everything.
+ */
+class alignas(64) RateLimiter {
+public:
+    struct Config {
+        uint64_t interval_ns = 1000000000;              // Rate interval (e.g. 100ms or 1s)
+        uint32_t max_messages = 0;                      // Messages per interval (0 = unlimited)
+        uint32_t burst = 0;                             // Back-to-back allowance (0 = max_messages)
+    };
+
+    struct Admission {
+        bool admitted = true;
+        uint64_t retry_at_ns = 0;                       // Earliest admit time when rejected
+
+        explicit operator bool() const noexcept { return admitted; }
+    };
+
+    RateLimiter() noexcept : tat_ns_(0), emission_ns_(0), capacity_ns_(0), rejected_(0) {}
+    explicit RateLimiter(const Config& config) noexcept : RateLimiter() { configure(config); }
+
+    // No copy (shared by reference)
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    /**
+     * @brief Set the rate; call before the limiter is shared, resets the bucket to full
+     */
+    void configure(const Config& config) noexcept {
+        if (config.max_messages == 0) {
+            emission_ns_ = 0;
+            capacity_ns_ = 0;
+        } else {
+            emission_ns_ = config.interval_ns / config.max_messages;
+            if (emission_ns_ == 0) emission_ns_ = 1;
+            capacity_ns_ = emission_ns_ * (config.burst ? config.burst : config.max_messages);
+        }
+        tat_ns_.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Admit messages at now_ns, or reject with the earliest admit time
+     */
+    [[nodiscard]] Admission try_acquire(uint64_t now_ns, uint32_t messages = 1) noexcept {
+        if (__builtin_expect(emission_ns_ == 0, 0)) return {};
+
+        const uint64_t cost = emission_ns_ * messages;
+        const uint64_t previous = tat_ns_.fetch_add(cost, std::memory_order_acq_rel);
+        const uint64_t tat = previous + cost;
+
+        if (__builtin_expect(previous < now_ns, 0)) {
+            // Idle: the bucket is full again, restart it from now
+            uint64_t expected = tat;
+            (void)tat_ns_.compare_exchange_strong(expected, now_ns + cost, std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed);
+            return {};
+        }
+
+        if (__builtin_expect(tat > now_ns + capacity_ns_, 0)) {
+            tat_ns_.fetch_sub(cost, std::memory_order_acq_rel);
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return {false, tat - capacity_ns_};
+        }
+        return {};
+    }
+
+    /**
+     * @brief Earliest time one more message would be admitted (now_ns if it would be now)
+     */
+    [[nodiscard]] uint64_t next_admit_ns(uint64_t now_ns) const noexcept {
+        if (emission_ns_ == 0) return now_ns;
+        const uint64_t tat = tat_ns_.load(std::memory_order_acquire);
+        const uint64_t next = (tat > now_ns ? tat : now_ns) + emission_ns_;
+        return next > now_ns + capacity_ns_ ? next - capacity_ns_ : now_ns;
+    }
+
+    [[nodiscard]] bool enabled() const noexcept { return emission_ns_ != 0; }
+    [[nodiscard]] uint64_t emission_interval_ns() const noexcept { return emission_ns_; }
+    [[nodiscard]] uint64_t rejected() const noexcept { return rejected_.load(std::memory_order_relaxed); }
+
+    void reset() noexcept {
+        tat_ns_.store(0, std::memory_order_relaxed);
+        rejected_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> tat_ns_;                      // Theoretical arrival time of the next message
+    uint64_t emission_ns_;                              // Interval each message consumes
+    uint64_t capacity_ns_;                              // Burst allowance in ns
+    alignas(64) std::atomic<uint64_t> rejected_;        // Slow path only, off the TAT line
+};
+
+/**
+ * @brief One RateLimiter per strategy x venue
+ */
+template<size_t Strategies, size_t Venues>
+class RateLimiterTable {
+public:
+    static constexpr size_t STRATEGIES = Strategies;
+    static constexpr size_t VENUES = Venues;
+
+    RateLimiterTable() noexcept = default;
+
+    // No copy (shared by reference)
+    RateLimiterTable(const RateLimiterTable&) = delete;
+    RateLimiterTable& operator=(const RateLimiterTable&) = delete;
+
+    [[nodiscard]] RateLimiter& at(size_t strategy, size_t venue) noexcept {
+        return limiters_[(strategy % Strategies) * Venues + venue % Venues];
+    }
+
+    [[nodiscard]] const RateLimiter& at(size_t strategy, size_t venue) const noexcept {
+        return limiters_[(strategy % Strategies) * Venues + venue % Venues];
+    }
+
+    /**
+     * @brief Apply one venue's limit to every strategy quoting it
+     */
+    void configure_venue(size_t venue, const RateLimiter::Config& config) noexcept {
+        for (size_t s = 0; s < Strategies; ++s) at(s, venue).configure(config);
+    }
+
+    [[nodiscard]] RateLimiter::Admission try_acquire(size_t strategy, size_t venue, uint64_t now_ns) noexcept {
+        return at(strategy, venue).try_acquire(now_ns);
+    }
+
+private:
+    std::array<RateLimiter, Strategies * Venues> limiters_;
+};
+
+/** @brief Strategy x venue limits applied by OrderLifecycleManager */
+using OrderRateLimiters = RateLimiterTable<8, 8>;
+
+} // namespace trading
+} // namespace hft
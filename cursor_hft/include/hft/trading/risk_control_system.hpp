@@ -3,14 +3,26 @@
 #include <cstdint>
 #include <cstddef>
 #include <array>
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <cmath>
+#include <span>
+#include <thread>
+#include <chrono>
 #include "hft/timing/hft_timer.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
 #include "hft/market_data/treasury_instruments.hpp"
+#include "hft/market_data/tick_store.hpp"
 #include "hft/trading/order_lifecycle_manager.hpp"
+#include "hft/config/system_traits.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace hft {
 namespace trading {
@@ -29,6 +41,20 @@ using namespace hft::market_data;
  * - Emergency stop mechanisms
  * - Risk breach alerting and logging
  * 
+ * check_orders() gates a whole batch of candidate orders (e.g. one
+ * coordinator tick across all strategies) in one pass: portfolio-wide
+ * limits are evaluated once and per-order position limits are SIMD
+ * compares over a struct-of-arrays copy of the per-instrument state.
+ * 
+ * Breaker state is one atomic word (risk_state()): a latch bit per breaker,
+ * the live portfolio conditions and the emergency stop. The hot path reads
+ * it with one relaxed load and on a breach only sets a bit and pushes a
+ * BreachEvent; history, trigger bookkeeping and portfolio evaluation run in
+ * run_risk_monitor_once(), either on the background thread started by
+ * start_risk_monitor() or wherever the owner calls it. While the monitor
+ * thread runs, the P&L and concentration checks are the monitor's
+ * published conditions instead of inline portfolio loops.
+ * 
  * Performance targets:
  * - Risk check: <100ns
  * - Circuit breaker evaluation: <50ns
@@ -38,10 +64,19 @@ using namespace hft::market_data;
  */
 class alignas(64) RiskControlSystem {
 public:
-    static constexpr size_t MAX_INSTRUMENTS = 6;
+    static constexpr size_t MAX_INSTRUMENTS = config::SystemTraits::MAX_INSTRUMENTS;
     static constexpr size_t MAX_STRATEGIES = 8;
     static constexpr size_t RISK_HISTORY_SIZE = 10000;
-    static constexpr size_t VOLATILITY_WINDOW = 1000;
+    static constexpr size_t VOLATILITY_WINDOW = MarketTickStore::STATS_WINDOW;
+    static constexpr size_t MAX_BATCH_ORDERS = 64;           // One approval bit per order
+    static constexpr size_t BREACH_QUEUE_SIZE = 1024;        // Undrained breach events
+    
+    // Risk state word layout
+    static constexpr uint32_t BREAKER_LATCH_MASK = 0xFFu;    // Bit per CircuitBreakerType: breaker latched
+    static constexpr uint32_t LIVE_CONDITION_SHIFT = 8;      // Bit per CircuitBreakerType: limit breached now (monitor)
+    static constexpr uint32_t LIVE_CONDITION_MASK = 0xFFu << LIVE_CONDITION_SHIFT;
+    static constexpr uint32_t EMERGENCY_STOP_BIT = 1u << 16;
+    static constexpr uint32_t MONITOR_ACTIVE_BIT = 1u << 17; // Portfolio limits evaluated by the monitor thread
     
     // Risk breach severity levels
     enum class RiskSeverity : uint8_t {
@@ -100,19 +135,18 @@ public:
         // Rate limits
         uint32_t max_orders_per_second = 1000;              // Order rate limit
         uint32_t max_cancels_per_minute = 5000;             // Cancel rate limit
-        uint32_t max_order_size = 50000000;                 // Maximum single order size
+        uint32_t max_order_size = 50000000;                 // Maximum single order size (face value)
+        double max_order_notional = 100000000.0;            // Maximum single order notional (face * price / 100)
         
         // Volatility limits
         double max_price_volatility = 0.05;                 // 5% maximum price volatility
         double volatility_window_minutes = 5.0;             // Volatility calculation window
-        
-        RiskLimits() noexcept = default;
     };
     
     // Circuit breaker state
     struct alignas(64) CircuitBreaker {
         CircuitBreakerType type;                            // Breaker type (1 byte)
-        bool active = false;                                // Currently active (1 byte)
+        std::atomic<bool> active{false};                    // Currently active (1 byte)
         RiskSeverity severity = RiskSeverity::WARNING;      // Severity level (1 byte)
         uint8_t _pad0[5];                                   // Padding (5 bytes)
         double threshold = 0.0;                             // Threshold value (8 bytes)
@@ -146,6 +180,55 @@ public:
     };
     static_assert(sizeof(RiskBreach) == 64, "RiskBreach must be 64 bytes");
     
+    // Breach as raised on the hot path, expanded into a RiskBreach by the monitor
+    struct BreachEvent {
+        CircuitBreakerType breaker_type;                    // Breaker type (1 byte)
+        RiskSeverity severity;                              // Severity level (1 byte)
+        TreasuryType instrument;                            // Related instrument (1 byte)
+        uint8_t _pad0[5];                                   // Padding (5 bytes)
+        uint64_t timestamp_ns = 0;                          // Breach time (8 bytes)
+        double threshold_value = 0.0;                       // Threshold that was breached (8 bytes)
+        double actual_value = 0.0;                          // Actual value at breach (8 bytes)
+        const char* reason = "";                            // Static string (8 bytes)
+        // Total: 1+1+1+5+8+8+8+8 = 40 bytes
+        
+        BreachEvent() noexcept : breaker_type(CircuitBreakerType::POSITION_LIMIT), severity(RiskSeverity::INFO),
+                                 instrument(TreasuryType::Note_10Y), _pad0{} {}
+    };
+    static_assert(sizeof(BreachEvent) == 40, "BreachEvent must be 40 bytes");
+    
+    // Candidate order for batch pre-trade checks
+    struct RiskCheckRequest {
+        TreasuryType instrument;                            // Instrument (1 byte)
+        OrderSide side;                                     // Side (1 byte)
+        uint8_t _pad0[6];                                   // Padding (6 bytes)
+        Price32nd price;                                    // Limit price (8 bytes)
+        uint64_t quantity = 0;                              // Quantity (8 bytes)
+        // Total: 1+1+6+8+8 = 24 bytes
+        
+        RiskCheckRequest() noexcept : instrument(TreasuryType::Note_10Y), side(OrderSide::BID), _pad0{}, price{} {}
+        RiskCheckRequest(TreasuryType inst, OrderSide s, uint64_t qty, Price32nd px) noexcept
+            : instrument(inst), side(s), _pad0{}, price(px), quantity(qty) {}
+    };
+    static_assert(sizeof(RiskCheckRequest) == 24, "RiskCheckRequest must be 24 bytes");
+    
+    // Hot per-instrument state in SIMD lanes (unused lanes stay zero)
+    struct alignas(64) RiskLanes {
+        static constexpr size_t LANES = 8;
+        alignas(64) std::array<int64_t, LANES> net_position{};
+        alignas(64) std::array<double, LANES> exposure{};   // |market value|
+        alignas(64) std::array<double, LANES> volatility{};
+    };
+    static_assert(RiskLanes::LANES >= MAX_INSTRUMENTS, "RiskLanes must cover every instrument");
+    
+    // Per-instrument marks published for the monitor thread
+    struct alignas(64) PublishedMarks {
+        alignas(64) std::array<std::atomic<int64_t>, MAX_INSTRUMENTS> net_position{};
+        std::array<std::atomic<double>, MAX_INSTRUMENTS> exposure{};
+        alignas(64) std::array<std::atomic<double>, MAX_INSTRUMENTS> pnl{};
+        std::array<std::atomic<double>, MAX_INSTRUMENTS> value_at_risk{};
+    };
+    
     // Order rate tracking
     struct OrderRateTracker {
         std::array<uint64_t, 60> orders_per_second;         // Rolling 60-second window
@@ -154,19 +237,20 @@ public:
         uint64_t last_update_time_ns = 0;
     };
     
-    // Market volatility tracking
+    // Market volatility tracking (price history lives in the tick store)
     struct VolatilityTracker {
-        std::array<double, VOLATILITY_WINDOW> price_history;
-        size_t current_index = 0;
-        uint64_t sample_count = 0;
         double current_volatility = 0.0;
         uint64_t last_calculation_time_ns = 0;
     };
     
     /**
      * @brief Constructor with risk configuration
+     * @param shared_ticks Tick store shared with strategies, fed by the caller before
+     *                     update_market_price(); nullptr to keep (and feed) a private one
      */
-    RiskControlSystem(const RiskLimits& limits = RiskLimits{}) noexcept;
+    RiskControlSystem() noexcept;
+    explicit RiskControlSystem(const RiskLimits& limits, MarketTickStore* shared_ticks = nullptr) noexcept;
+    ~RiskControlSystem() noexcept { stop_risk_monitor(); }
     
     // No copy or move semantics
     RiskControlSystem(const RiskControlSystem&) = delete;
@@ -187,6 +271,19 @@ public:
         Price32nd price
     ) noexcept;
     
+    /**
+     * @brief Check a batch of candidate orders in one pass
+     * @param orders Candidate orders, evaluated against the current state
+     * @return Approval bitmask, bit i set if orders[i] passes (orders past
+     *         MAX_BATCH_ORDERS are not approved)
+     *
+     * Same limits as check_order_risk() for each order, except the order
+     * rate: the batch is approved as if each order were recorded after its
+     * check, so only the first orders that fit the remaining rate budget
+     * pass. Rejections trigger the same circuit breakers as the scalar path.
+     */
+    [[nodiscard]] uint64_t check_orders(std::span<const RiskCheckRequest> orders) noexcept;
+    
     /**
      * @brief Update position and recalculate risk metrics
      * @param instrument Treasury instrument
@@ -218,9 +315,36 @@ public:
     /**
      * @brief Check all circuit breakers and update status
      * @return true if any circuit breaker is active
+     *
+     * Monitor side: evaluates the portfolio limits from the published marks,
+     * latches breakers on a new breach and publishes the live conditions.
      */
     [[nodiscard]] bool evaluate_circuit_breakers() noexcept;
     
+    /**
+     * @brief One monitor pass: drain breach events, then evaluate the breakers
+     * @return Breach events drained
+     *
+     * Run by the monitor thread; call it directly only while the thread is stopped.
+     */
+    size_t run_risk_monitor_once() noexcept;
+    
+    /**
+     * @brief Start the background risk monitor thread
+     * @param poll_interval_ns Sleep between monitor passes
+     * @return false if already running
+     *
+     * Not hot path. update_risk_limits() must not run while the monitor runs.
+     */
+    bool start_risk_monitor(uint64_t poll_interval_ns = 100000) noexcept;
+    
+    /**
+     * @brief Join the monitor thread; portfolio limits return to inline checks
+     */
+    void stop_risk_monitor() noexcept;
+    
+    [[nodiscard]] bool risk_monitor_running() const noexcept { return monitor_running_.load(std::memory_order_relaxed); }
+    
     /**
      * @brief Force trigger emergency stop
      * @param reason Reason for emergency stop
@@ -260,17 +384,96 @@ public:
      */
     [[nodiscard]] double get_portfolio_var() const noexcept;
     
+    /**
+     * @brief Get current price volatility
+     * @param instrument Treasury instrument
+     * @return RMS of price returns over the volatility window
+     */
+    [[nodiscard]] double get_volatility(TreasuryType instrument) const noexcept {
+        const auto instrument_index = static_cast<size_t>(instrument);
+        return instrument_index < MAX_INSTRUMENTS ? volatility_trackers_[instrument_index].current_volatility : 0.0;
+    }
+    
+    /**
+     * @brief Tick history behind the volatility estimates
+     */
+    [[nodiscard]] const MarketTickStore& tick_store() const noexcept { return *tick_store_; }
+    
+    /**
+     * @brief Journal position and mark updates for warm restart (nullptr = off)
+     *
+     * Any append the journal refuses, from this or the components sharing
+     * it (checked by the monitor), triggers the emergency stop: state past
+     * that point would not survive a restart. Attach before the monitor starts.
+     */
+    void set_journal(StateJournal* journal) noexcept {
+        journal_ = journal;
+        journal_rejects_seen_ = journal ? journal->rejected() : 0;
+    }
+    
+    /**
+     * @brief Risk updates the journal refused
+     */
+    [[nodiscard]] uint64_t journal_entries_dropped() const noexcept { return journal_entries_dropped_.load(std::memory_order_relaxed); }
+    
+    /**
+     * @brief Replace per-instrument risk with recovered state; recovery only
+     * @param risks Placed by their instrument field
+     */
+    void restore_instrument_risk(const InstrumentRisk* risks, size_t count) noexcept;
+    
     /**
      * @brief Check if any circuit breaker is active
      * @return true if any breaker is active
      */
-    [[nodiscard]] bool is_emergency_stop_active() const noexcept { return emergency_stop_active_.load(); }
+    [[nodiscard]] bool is_emergency_stop_active() const noexcept {
+        return (risk_state_.load(std::memory_order_relaxed) & EMERGENCY_STOP_BIT) != 0;
+    }
+    
+    /**
+     * @brief Risk state word (latched breakers, live conditions, emergency stop)
+     */
+    [[nodiscard]] uint32_t risk_state() const noexcept { return risk_state_.load(std::memory_order_relaxed); }
+    
+    /**
+     * @brief No breaker latched, no live breach and no emergency stop
+     */
+    [[nodiscard]] bool trading_allowed() const noexcept {
+        return (risk_state_.load(std::memory_order_relaxed) & ~MONITOR_ACTIVE_BIT) == 0;
+    }
+    
+    /**
+     * @brief Breaches written to the history by the monitor
+     */
+    [[nodiscard]] uint64_t breaches_logged() const noexcept { return breach_history_index_.load(std::memory_order_relaxed); }
+    
+    /**
+     * @brief Breach events lost to a full queue (monitor not keeping up)
+     */
+    [[nodiscard]] uint64_t breach_events_dropped() const noexcept { return breach_events_dropped_.load(std::memory_order_relaxed); }
+    
+    /**
+     * @brief Logged breach by sequence number (the last RISK_HISTORY_SIZE are kept)
+     */
+    [[nodiscard]] const RiskBreach& get_risk_breach(uint64_t sequence) const noexcept {
+        return risk_breach_history_[sequence % RISK_HISTORY_SIZE];
+    }
     
     /**
      * @brief Update risk limits configuration
      * @param limits New risk limits
      */
     void update_risk_limits(const RiskLimits& limits) noexcept;
+    
+    /**
+     * @brief Get current risk limits configuration
+     */
+    [[nodiscard]] const RiskLimits& get_risk_limits() const noexcept { return risk_limits_; }
+    
+    /**
+     * @brief Per-instrument state as laid out for the batch checks
+     */
+    [[nodiscard]] const RiskLanes& risk_lanes() const noexcept { return lanes_; }
 
 private:
     // Risk configuration
@@ -279,36 +482,68 @@ private:
     
     // Risk tracking per instrument
     alignas(64) std::array<InstrumentRisk, MAX_INSTRUMENTS> instrument_risks_;
+    alignas(64) RiskLanes lanes_;
     alignas(64) std::array<VolatilityTracker, MAX_INSTRUMENTS> volatility_trackers_;
+    std::unique_ptr<MarketTickStore> owned_tick_store_;
+    MarketTickStore* tick_store_;
     
     // Circuit breakers
     alignas(64) std::array<CircuitBreaker, 8> circuit_breakers_;  // One for each type
-    alignas(64) std::atomic<bool> emergency_stop_active_;
+    alignas(64) std::atomic<uint32_t> risk_state_;
     
     // Rate limiting
     alignas(64) OrderRateTracker rate_tracker_;
     
-    // Risk breach logging
+    // Risk breach logging (history written by the monitor)
+    hft::SPSCRingBuffer<BreachEvent, BREACH_QUEUE_SIZE> breach_queue_;
+    alignas(64) std::atomic<uint64_t> breach_events_dropped_;
+    alignas(64) PublishedMarks published_marks_;
     alignas(64) std::array<RiskBreach, RISK_HISTORY_SIZE> risk_breach_history_;
     alignas(64) std::atomic<size_t> breach_history_index_;
     
+    // Background monitor
+    std::thread monitor_thread_;
+    alignas(64) std::atomic<bool> monitor_running_;
+    
     // Performance tracking
     alignas(64) std::atomic<uint64_t> risk_checks_performed_;
     alignas(64) std::atomic<uint64_t> total_risk_check_time_ns_;
     
+    // Warm-restart journal
+    StateJournal* journal_;
+    uint64_t journal_rejects_seen_;                             // Monitor only
+    alignas(64) std::atomic<uint64_t> journal_entries_dropped_;
+    
     // Helper methods
     void initialize_circuit_breakers() noexcept;
     void calculate_portfolio_metrics() noexcept;
     void calculate_volatility(TreasuryType instrument) noexcept;
-    void trigger_circuit_breaker(CircuitBreakerType type, double threshold, double actual, const char* reason) noexcept;
+    void trigger_circuit_breaker(CircuitBreakerType type, double threshold, double actual, const char* reason,
+                                 TreasuryType instrument = TreasuryType::Note_10Y) noexcept;
     void log_risk_breach(CircuitBreakerType type, RiskSeverity severity, TreasuryType instrument, 
-                        double threshold, double actual, const char* action) noexcept;
-    
+                        double threshold, double actual, const char* action, uint64_t timestamp_ns) noexcept;
+    void record_breach(const BreachEvent& event) noexcept;
+    void latch_breaker(CircuitBreakerType type, double threshold, double actual, const char* reason) noexcept;
+    void publish_marks(size_t instrument_index) noexcept;
+    void monitor_loop(uint64_t poll_interval_ns) noexcept;
+    void journal_failed() noexcept;
+    bool portfolio_limits_ok(uint32_t state) noexcept;
+    
+    // Fat-finger limits on the order itself: a reject, not a breaker (nothing about the market changed)
+    bool order_within_limits(uint64_t quantity, Price32nd price) const noexcept {
+        return quantity <= risk_limits_.max_order_size &&
+               static_cast<double>(quantity) * price.to_decimal() / 100.0 <= risk_limits_.max_order_notional;
+    }
     bool check_position_limits(TreasuryType instrument, OrderSide side, uint64_t quantity) noexcept;
     bool check_pnl_limits() noexcept;
     bool check_rate_limits() noexcept;
     bool check_volatility_limits(TreasuryType instrument) noexcept;
     bool check_concentration_limits() noexcept;
+    void report_batch_rejects(std::span<const RiskCheckRequest> orders, uint64_t rejected,
+                              uint64_t position_ok, uint64_t total_ok, uint64_t volatility_ok,
+                              uint64_t rate_ok, int64_t total_position, uint64_t order_count) noexcept;
+    int64_t total_net_position() const noexcept;
+    static uint64_t within_limit_mask(const int64_t* values, size_t count, int64_t limit) noexcept;
     
     double calculate_position_var(TreasuryType instrument, int64_t position) const noexcept;
     double calculate_portfolio_correlation() const noexcept;
@@ -316,18 +551,32 @@ private:
 
 // Implementation
 
-inline RiskControlSystem::RiskControlSystem(const RiskLimits& limits) noexcept
+inline RiskControlSystem::RiskControlSystem() noexcept
+    : RiskControlSystem(RiskLimits{}) {}
+
+inline RiskControlSystem::RiskControlSystem(const RiskLimits& limits, MarketTickStore* shared_ticks) noexcept
     : risk_limits_(limits),
       timer_(),
       instrument_risks_{},
+      lanes_{},
       volatility_trackers_{},
+      owned_tick_store_(shared_ticks ? nullptr : std::make_unique<MarketTickStore>()),
+      tick_store_(shared_ticks ? shared_ticks : owned_tick_store_.get()),
       circuit_breakers_{},
-      emergency_stop_active_(false),
+      risk_state_(0),
       rate_tracker_{},
+      breach_queue_(),
+      breach_events_dropped_(0),
+      published_marks_{},
       risk_breach_history_{},
       breach_history_index_(0),
+      monitor_thread_(),
+      monitor_running_(false),
       risk_checks_performed_(0),
-      total_risk_check_time_ns_(0) {
+      total_risk_check_time_ns_(0),
+      journal_(nullptr),
+      journal_rejects_seen_(0),
+      journal_entries_dropped_(0) {
     
     // Initialize instrument risks
     for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
@@ -384,18 +633,19 @@ inline bool RiskControlSystem::check_order_risk(
     const auto start_time = timer_.get_timestamp_ns();
     
     // Check emergency stop
-    if (emergency_stop_active_.load(std::memory_order_acquire)) {
+    const uint32_t state = risk_state_.load(std::memory_order_relaxed);
+    if (state & EMERGENCY_STOP_BIT) {
         return false;
     }
     
     // Check all risk limits
     bool risk_passed = true;
     
+    risk_passed &= order_within_limits(quantity, price);
     risk_passed &= check_position_limits(instrument, side, quantity);
-    risk_passed &= check_pnl_limits();
     risk_passed &= check_rate_limits();
     risk_passed &= check_volatility_limits(instrument);
-    risk_passed &= check_concentration_limits();
+    risk_passed &= portfolio_limits_ok(state);
     
     // Update performance metrics
     risk_checks_performed_.fetch_add(1, std::memory_order_relaxed);
@@ -416,7 +666,7 @@ inline bool RiskControlSystem::check_position_limits(
     const auto& risk = instrument_risks_[instrument_index];
     
     // Calculate position change
-    const int64_t position_change = (side == OrderSide::BUY) ? 
+    const int64_t position_change = (side == OrderSide::BID) ? 
                                    static_cast<int64_t>(quantity) : 
                                    -static_cast<int64_t>(quantity);
     
@@ -427,25 +677,18 @@ inline bool RiskControlSystem::check_position_limits(
         trigger_circuit_breaker(CircuitBreakerType::POSITION_LIMIT, 
                                static_cast<double>(risk_limits_.max_position_per_instrument),
                                static_cast<double>(std::abs(new_position)),
-                               "Instrument position limit exceeded");
+                               "Instrument position limit exceeded", instrument);
         return false;
     }
     
     // Check total position limit
-    int64_t total_position = 0;
-    for (const auto& inst_risk : instrument_risks_) {
-        if (inst_risk.instrument == instrument) {
-            total_position += new_position;
-        } else {
-            total_position += inst_risk.net_position;
-        }
-    }
+    const int64_t total_position = total_net_position() + position_change;
     
     if (std::abs(total_position) > risk_limits_.max_total_position) {
         trigger_circuit_breaker(CircuitBreakerType::POSITION_LIMIT,
                                static_cast<double>(risk_limits_.max_total_position),
                                static_cast<double>(std::abs(total_position)),
-                               "Total position limit exceeded");
+                               "Total position limit exceeded", instrument);
         return false;
     }
     
@@ -493,7 +736,7 @@ inline bool RiskControlSystem::check_volatility_limits(TreasuryType instrument)
         trigger_circuit_breaker(CircuitBreakerType::VOLATILITY_LIMIT,
                                risk_limits_.max_price_volatility,
                                tracker.current_volatility,
-                               "Price volatility limit exceeded");
+                               "Price volatility limit exceeded", instrument);
         return false;
     }
     
@@ -512,6 +755,7 @@ inline void RiskControlSystem::update_position(
     
     // Update position
     risk.net_position += position_change;
+    lanes_.net_position[instrument_index] = risk.net_position;
     
     // Update realized P&L (simple calculation)
     if (position_change != 0) {
@@ -524,6 +768,21 @@ inline void RiskControlSystem::update_position(
     
     // Recalculate portfolio metrics
     calculate_portfolio_metrics();
+    for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+        publish_marks(i);
+    }
+    
+    if (journal_ != nullptr) {
+        JournalEntry entry;
+        entry.type = JournalEntryType::RISK_FILL;
+        entry.timestamp_ns = risk.last_update_time_ns;
+        entry.position_change = position_change;
+        entry.price = fill_price;
+        entry.instrument = static_cast<uint8_t>(instrument);
+        if (__builtin_expect(journal_->append(entry) == 0, 0)) {
+            journal_failed();
+        }
+    }
 }
 
 inline void RiskControlSystem::update_market_price(
@@ -534,21 +793,46 @@ inline void RiskControlSystem::update_market_price(
     if (instrument_index >= MAX_INSTRUMENTS) return;
     
     auto& risk = instrument_risks_[instrument_index];
-    auto& volatility = volatility_trackers_[instrument_index];
     
     // Update market value
     risk.market_value = static_cast<double>(risk.net_position) * market_price.to_decimal();
+    lanes_.exposure[instrument_index] = std::abs(risk.market_value);
     
-    // Update volatility tracking
-    const size_t vol_index = volatility.current_index % VOLATILITY_WINDOW;
-    volatility.price_history[vol_index] = market_price.to_decimal();
-    volatility.current_index++;
-    volatility.sample_count = std::min(volatility.sample_count + 1, static_cast<uint64_t>(VOLATILITY_WINDOW));
+    // Update volatility tracking (a shared store is fed by its owner)
+    if (owned_tick_store_) {
+        owned_tick_store_->record_price(instrument, market_price.to_decimal(), timer_.get_timestamp_ns());
+    }
     
     // Calculate volatility
     calculate_volatility(instrument);
+    publish_marks(instrument_index);
     
     risk.last_update_time_ns = timer_.get_timestamp_ns();
+    
+    if (journal_ != nullptr) {
+        JournalEntry entry;
+        entry.type = JournalEntryType::RISK_MARK;
+        entry.timestamp_ns = risk.last_update_time_ns;
+        entry.price = market_price;
+        entry.instrument = static_cast<uint8_t>(instrument);
+        if (__builtin_expect(journal_->append(entry) == 0, 0)) {
+            journal_failed();
+        }
+    }
+}
+
+inline void RiskControlSystem::restore_instrument_risk(const InstrumentRisk* risks, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        const auto index = static_cast<size_t>(risks[i].instrument);
+        if (index >= MAX_INSTRUMENTS) continue;
+        instrument_risks_[index] = risks[i];
+        lanes_.net_position[index] = risks[i].net_position;
+        lanes_.exposure[index] = std::abs(risks[i].market_value);
+    }
+    calculate_portfolio_metrics();
+    for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+        publish_marks(i);
+    }
 }
 
 inline void RiskControlSystem::calculate_volatility(TreasuryType instrument) noexcept {
@@ -557,32 +841,9 @@ inline void RiskControlSystem::calculate_volatility(TreasuryType instrument) noe
     
     auto& tracker = volatility_trackers_[instrument_index];
     
-    if (tracker.sample_count < 2) {
-        tracker.current_volatility = 0.0;
-        return;
-    }
-    
-    // Calculate standard deviation of price returns
-    double sum_squared_returns = 0.0;
-    size_t count = 0;
-    
-    const size_t samples = std::min(tracker.sample_count, static_cast<uint64_t>(VOLATILITY_WINDOW));
-    
-    for (size_t i = 1; i < samples; ++i) {
-        const size_t idx = (tracker.current_index - i) % VOLATILITY_WINDOW;
-        const size_t prev_idx = (tracker.current_index - i - 1) % VOLATILITY_WINDOW;
-        
-        const double return_val = (tracker.price_history[idx] - tracker.price_history[prev_idx]) / 
-                                 tracker.price_history[prev_idx];
-        sum_squared_returns += return_val * return_val;
-        ++count;
-    }
-    
-    if (count > 0) {
-        const double variance = sum_squared_returns / count;
-        tracker.current_volatility = std::sqrt(variance);
-    }
-    
+    // Standard deviation of price returns, maintained incrementally by the store
+    tracker.current_volatility = tick_store_->realized_volatility(instrument);
+    lanes_.volatility[instrument_index] = tracker.current_volatility;
     tracker.last_calculation_time_ns = timer_.get_timestamp_ns();
 }
 
@@ -609,91 +870,206 @@ inline void RiskControlSystem::record_order_activity(bool is_cancel) noexcept {
 }
 
 inline bool RiskControlSystem::evaluate_circuit_breakers() noexcept {
-    bool any_active = false;
+    // Portfolio totals from the published marks (never the hot-path structs)
+    int64_t total_position = 0;
+    double total_pnl = 0.0;
+    double total_var = 0.0;
+    double total_exposure = 0.0;
+    double max_exposure = 0.0;
+    for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+        total_position += std::abs(published_marks_.net_position[i].load(std::memory_order_relaxed));
+        total_pnl += published_marks_.pnl[i].load(std::memory_order_relaxed);
+        total_var += published_marks_.value_at_risk[i].load(std::memory_order_relaxed);
+        const double exposure = published_marks_.exposure[i].load(std::memory_order_relaxed);
+        total_exposure += exposure;
+        max_exposure = std::max(max_exposure, exposure);
+    }
+    const double concentration = total_exposure > 0.0 ? max_exposure / total_exposure : 0.0;
     
-    for (auto& breaker : circuit_breakers_) {
-        bool should_trigger = false;
-        
-        switch (breaker.type) {
-            case CircuitBreakerType::POSITION_LIMIT: {
-                int64_t total_position = 0;
-                for (const auto& risk : instrument_risks_) {
-                    total_position += std::abs(risk.net_position);
-                }
-                breaker.current_value = static_cast<double>(total_position);
-                should_trigger = (total_position > risk_limits_.max_total_position);
-                break;
-            }
-            
-            case CircuitBreakerType::PNL_LOSS_LIMIT:
-                breaker.current_value = get_total_pnl();
-                should_trigger = (breaker.current_value < breaker.threshold);
-                break;
-                
-            case CircuitBreakerType::VAR_LIMIT:
-                breaker.current_value = get_portfolio_var();
-                should_trigger = (breaker.current_value > breaker.threshold);
-                break;
-                
-            default:
-                break;
-        }
-        
-        if (should_trigger && !breaker.active) {
-            breaker.active = true;
-            breaker.trigger_time_ns = timer_.get_timestamp_ns();
-            breaker.trigger_count++;
-            any_active = true;
-            
-            if (breaker.severity == RiskSeverity::EMERGENCY) {
-                emergency_stop_active_.store(true, std::memory_order_release);
-            }
-        }
+    const auto live_bit = [](CircuitBreakerType type) {
+        return 1u << (LIVE_CONDITION_SHIFT + static_cast<uint32_t>(type));
+    };
+    uint32_t live = 0;
+    if (total_position > risk_limits_.max_total_position) {
+        live |= live_bit(CircuitBreakerType::POSITION_LIMIT);
+        latch_breaker(CircuitBreakerType::POSITION_LIMIT, static_cast<double>(risk_limits_.max_total_position),
+                      static_cast<double>(total_position), "Total position limit exceeded");
+    }
+    if (total_pnl < -risk_limits_.max_daily_loss) {
+        live |= live_bit(CircuitBreakerType::PNL_LOSS_LIMIT);
+        latch_breaker(CircuitBreakerType::PNL_LOSS_LIMIT, -risk_limits_.max_daily_loss, total_pnl,
+                      "Daily loss limit exceeded");
     }
+    if (total_var > risk_limits_.max_value_at_risk) {
+        live |= live_bit(CircuitBreakerType::VAR_LIMIT);
+        latch_breaker(CircuitBreakerType::VAR_LIMIT, risk_limits_.max_value_at_risk, total_var,
+                      "VaR limit exceeded");
+    }
+    if (concentration > risk_limits_.max_concentration_ratio) {
+        live |= live_bit(CircuitBreakerType::CONCENTRATION_LIMIT);
+        latch_breaker(CircuitBreakerType::CONCENTRATION_LIMIT, risk_limits_.max_concentration_ratio, concentration,
+                      "Concentration limit exceeded");
+    }
+    
+    // Publish the live conditions without disturbing latches set concurrently
+    const uint32_t previous = risk_state_.load(std::memory_order_relaxed) & LIVE_CONDITION_MASK;
+    if (live & ~previous) risk_state_.fetch_or(live & ~previous, std::memory_order_release);
+    if (previous & ~live) risk_state_.fetch_and(~(previous & ~live), std::memory_order_release);
     
-    return any_active;
+    return (risk_state_.load(std::memory_order_relaxed) & BREAKER_LATCH_MASK) != 0;
+}
+
+inline size_t RiskControlSystem::run_risk_monitor_once() noexcept {
+    size_t drained = 0;
+    BreachEvent event;
+    while (breach_queue_.try_pop(event)) {
+        record_breach(event);
+        ++drained;
+    }
+    // Refused appends from the order and position managers sharing the journal
+    if (journal_ != nullptr && journal_->rejected() > journal_rejects_seen_) {
+        journal_rejects_seen_ = journal_->rejected();
+        trigger_emergency_stop("State journal full");
+    }
+    (void)evaluate_circuit_breakers();
+    return drained;
+}
+
+inline void RiskControlSystem::journal_failed() noexcept {
+    journal_entries_dropped_.fetch_add(1, std::memory_order_relaxed);
+    trigger_emergency_stop("State journal full");
+}
+
+inline bool RiskControlSystem::start_risk_monitor(uint64_t poll_interval_ns) noexcept {
+    if (monitor_running_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    // Live conditions are current before the hot path starts relying on them
+    (void)run_risk_monitor_once();
+    monitor_running_.store(true, std::memory_order_release);
+    risk_state_.fetch_or(MONITOR_ACTIVE_BIT, std::memory_order_release);
+    monitor_thread_ = std::thread([this, poll_interval_ns] { monitor_loop(poll_interval_ns); });
+    return true;
+}
+
+inline void RiskControlSystem::stop_risk_monitor() noexcept {
+    if (!monitor_running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (monitor_thread_.joinable()) {
+        monitor_thread_.join();
+    }
+    risk_state_.fetch_and(~(MONITOR_ACTIVE_BIT | LIVE_CONDITION_MASK), std::memory_order_release);
+    (void)run_risk_monitor_once();  // Log what was raised during shutdown
+}
+
+inline void RiskControlSystem::monitor_loop(uint64_t poll_interval_ns) noexcept {
+    while (monitor_running_.load(std::memory_order_acquire)) {
+        (void)run_risk_monitor_once();
+        std::this_thread::sleep_for(std::chrono::nanoseconds(poll_interval_ns));
+    }
+}
+
+inline bool RiskControlSystem::portfolio_limits_ok(uint32_t state) noexcept {
+    if (state & MONITOR_ACTIVE_BIT) {
+        constexpr uint32_t gated = (1u << (LIVE_CONDITION_SHIFT + static_cast<uint32_t>(CircuitBreakerType::PNL_LOSS_LIMIT))) |
+                                   (1u << (LIVE_CONDITION_SHIFT + static_cast<uint32_t>(CircuitBreakerType::CONCENTRATION_LIMIT)));
+        return (state & gated) == 0;
+    }
+    return check_pnl_limits() & check_concentration_limits();
+}
+
+inline void RiskControlSystem::publish_marks(size_t instrument_index) noexcept {
+    const auto& risk = instrument_risks_[instrument_index];
+    published_marks_.net_position[instrument_index].store(risk.net_position, std::memory_order_relaxed);
+    published_marks_.exposure[instrument_index].store(std::abs(risk.market_value), std::memory_order_relaxed);
+    published_marks_.pnl[instrument_index].store(risk.unrealized_pnl + risk.realized_pnl, std::memory_order_relaxed);
+    published_marks_.value_at_risk[instrument_index].store(risk.value_at_risk, std::memory_order_relaxed);
 }
 
 inline void RiskControlSystem::trigger_circuit_breaker(
     CircuitBreakerType type,
     double threshold,
     double actual,
-    const char* reason
+    const char* reason,
+    TreasuryType instrument
 ) noexcept {
     const auto type_index = static_cast<size_t>(type);
     if (type_index >= circuit_breakers_.size()) return;
     
+    // Already latched: one load, nothing else to do
+    const uint32_t bit = 1u << type_index;
+    if (risk_state_.load(std::memory_order_relaxed) & bit) return;
+    if (risk_state_.fetch_or(bit, std::memory_order_acq_rel) & bit) return;
+    
     auto& breaker = circuit_breakers_[type_index];
+    breaker.active.store(true, std::memory_order_relaxed);
+    
+    // Logging and trigger bookkeeping happen on the monitor
+    BreachEvent event;
+    event.breaker_type = type;
+    event.severity = breaker.severity;
+    event.instrument = instrument;
+    event.timestamp_ns = timer_.get_timestamp_ns();
+    event.threshold_value = threshold;
+    event.actual_value = actual;
+    event.reason = reason;
+    if (__builtin_expect(!breach_queue_.try_push(event), 0)) {
+        breach_events_dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
     
-    if (!breaker.active) {
-        breaker.active = true;
-        breaker.current_value = actual;
-        breaker.trigger_time_ns = timer_.get_timestamp_ns();
-        breaker.trigger_count++;
-        
-        // Log breach
-        log_risk_breach(type, breaker.severity, TreasuryType::Note_10Y, threshold, actual, reason);
-        
-        // Check if emergency stop required
-        if (breaker.severity == RiskSeverity::EMERGENCY) {
-            trigger_emergency_stop(reason);
-        }
+    // Check if emergency stop required
+    if (breaker.severity == RiskSeverity::EMERGENCY) {
+        trigger_emergency_stop(reason);
     }
 }
 
+inline void RiskControlSystem::latch_breaker(
+    CircuitBreakerType type,
+    double threshold,
+    double actual,
+    const char* reason
+) noexcept {
+    const auto type_index = static_cast<size_t>(type);
+    auto& breaker = circuit_breakers_[type_index];
+    breaker.current_value = actual;
+    
+    const uint32_t bit = 1u << type_index;
+    if (risk_state_.fetch_or(bit, std::memory_order_acq_rel) & bit) return;
+    breaker.active.store(true, std::memory_order_relaxed);
+    breaker.trigger_time_ns = timer_.get_timestamp_ns();
+    breaker.trigger_count++;
+    log_risk_breach(type, breaker.severity, TreasuryType::Note_10Y, threshold, actual, reason, breaker.trigger_time_ns);
+    
+    if (breaker.severity == RiskSeverity::EMERGENCY) {
+        trigger_emergency_stop(reason);
+    }
+}
+
+inline void RiskControlSystem::record_breach(const BreachEvent& event) noexcept {
+    auto& breaker = circuit_breakers_[static_cast<size_t>(event.breaker_type)];
+    breaker.current_value = event.actual_value;
+    breaker.trigger_time_ns = event.timestamp_ns;
+    breaker.trigger_count++;
+    
+    log_risk_breach(event.breaker_type, event.severity, event.instrument,
+                    event.threshold_value, event.actual_value, event.reason, event.timestamp_ns);
+}
+
 inline void RiskControlSystem::log_risk_breach(
     CircuitBreakerType type,
     RiskSeverity severity,
     TreasuryType instrument,
     double threshold,
     double actual,
-    const char* action
+    const char* action,
+    uint64_t timestamp_ns
 ) noexcept {
-    const size_t index = breach_history_index_.fetch_add(1, std::memory_order_relaxed) % RISK_HISTORY_SIZE;
+    const size_t sequence = breach_history_index_.load(std::memory_order_relaxed);
     
-    auto& breach = risk_breach_history_[index];
-    breach.event_id = index;
-    breach.timestamp_ns = timer_.get_timestamp_ns();
+    auto& breach = risk_breach_history_[sequence % RISK_HISTORY_SIZE];
+    breach.event_id = sequence;
+    breach.timestamp_ns = timestamp_ns;
     breach.breaker_type = type;
     breach.severity = severity;
     breach.instrument = instrument;
@@ -709,6 +1085,7 @@ inline void RiskControlSystem::log_risk_breach(
         ++i;
     }
     breach.action_taken[i] = '\0';
+    breach_history_index_.store(sequence + 1, std::memory_order_release);
 }
 
 inline double RiskControlSystem::get_total_pnl() const noexcept {
@@ -743,7 +1120,7 @@ RiskControlSystem::get_circuit_breaker(CircuitBreakerType type) const noexcept {
 
 // Stub implementations for remaining methods
 inline void RiskControlSystem::trigger_emergency_stop(const char* reason) noexcept {
-    emergency_stop_active_.store(true, std::memory_order_release);
+    risk_state_.fetch_or(EMERGENCY_STOP_BIT, std::memory_order_release);
 }
 
 inline bool RiskControlSystem::reset_circuit_breaker(CircuitBreakerType type) noexcept {
@@ -751,8 +1128,9 @@ inline bool RiskControlSystem::reset_circuit_breaker(CircuitBreakerType type) no
     if (index >= circuit_breakers_.size()) return false;
     
     auto& breaker = circuit_breakers_[index];
-    breaker.active = false;
+    breaker.active.store(false, std::memory_order_relaxed);
     breaker.reset_time_ns = timer_.get_timestamp_ns();
+    risk_state_.fetch_and(~(1u << index), std::memory_order_release);
     
     return true;
 }
@@ -778,14 +1156,14 @@ inline void RiskControlSystem::calculate_portfolio_metrics() noexcept {
 inline bool RiskControlSystem::check_concentration_limits() noexcept {
     // Check concentration risk - simplified implementation
     double total_exposure = 0.0;
-    for (const auto& risk : instrument_risks_) {
-        total_exposure += std::abs(risk.market_value);
+    for (size_t i = 0; i < RiskLanes::LANES; ++i) {
+        total_exposure += lanes_.exposure[i];
     }
     
     if (total_exposure == 0.0) return true;
     
-    for (const auto& risk : instrument_risks_) {
-        const double concentration = std::abs(risk.market_value) / total_exposure;
+    for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+        const double concentration = lanes_.exposure[i] / total_exposure;
         if (concentration > risk_limits_.max_concentration_ratio) {
             trigger_circuit_breaker(CircuitBreakerType::CONCENTRATION_LIMIT,
                                    risk_limits_.max_concentration_ratio,
@@ -798,6 +1176,142 @@ inline bool RiskControlSystem::check_concentration_limits() noexcept {
     return true;
 }
 
+inline int64_t RiskControlSystem::total_net_position() const noexcept {
+    int64_t total = 0;
+    for (size_t i = 0; i < RiskLanes::LANES; ++i) {
+        total += lanes_.net_position[i];
+    }
+    return total;
+}
+
+inline uint64_t RiskControlSystem::within_limit_mask(const int64_t* values, size_t count, int64_t limit) noexcept {
+    uint64_t mask = 0;
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i upper = _mm256_set1_epi64x(limit);
+    const __m256i lower = _mm256_set1_epi64x(-limit);
+    for (; i + 4 <= count; i += 4) {
+        const __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(values + i));
+        const __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi64(v, upper), _mm256_cmpgt_epi64(lower, v));
+        const auto bits = static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(outside)));
+        mask |= (~bits & 0xFULL) << i;
+    }
+#elif defined(__ARM_NEON)
+    const int64x2_t upper = vdupq_n_s64(limit);
+    for (; i + 2 <= count; i += 2) {
+        const uint64x2_t inside = vcleq_s64(vabsq_s64(vld1q_s64(values + i)), upper);
+        mask |= ((vgetq_lane_u64(inside, 0) & 1) | ((vgetq_lane_u64(inside, 1) & 1) << 1)) << i;
+    }
+#endif
+    for (; i < count; ++i) {
+        mask |= static_cast<uint64_t>(values[i] <= limit && values[i] >= -limit) << i;
+    }
+    return mask;
+}
+
+inline uint64_t RiskControlSystem::check_orders(std::span<const RiskCheckRequest> orders) noexcept {
+    const size_t n = std::min(orders.size(), MAX_BATCH_ORDERS);
+    const uint32_t state = risk_state_.load(std::memory_order_relaxed);
+    if (n == 0 || (state & EMERGENCY_STOP_BIT)) {
+        return 0;
+    }
+    const auto start_time = timer_.get_timestamp_ns();
+    
+    // Portfolio-wide limits: once per batch
+    uint64_t approved = 0;
+    const bool portfolio_ok = portfolio_limits_ok(state);
+    
+    const uint64_t current_second = (start_time / 1000000000) % 60;
+    const uint64_t sent = rate_tracker_.orders_per_second[current_second];
+    const uint64_t rate_budget = sent < risk_limits_.max_orders_per_second
+                               ? risk_limits_.max_orders_per_second - sent : 0;
+    
+    if (__builtin_expect(portfolio_ok, 1)) {
+        // Lane-wise layout of the candidate positions
+        alignas(64) std::array<int64_t, MAX_BATCH_ORDERS> new_position;
+        alignas(64) std::array<int64_t, MAX_BATCH_ORDERS> new_total;
+        const int64_t total_position = total_net_position();
+        
+        uint64_t instrument_volatility_ok = 0;
+        for (size_t i = 0; i < MAX_INSTRUMENTS; ++i) {
+            instrument_volatility_ok |= static_cast<uint64_t>(lanes_.volatility[i] <= risk_limits_.max_price_volatility) << i;
+        }
+        
+        uint64_t volatility_ok = 0;
+        uint64_t order_ok = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const auto index = static_cast<size_t>(orders[i].instrument);
+            const auto quantity = static_cast<int64_t>(orders[i].quantity);
+            const int64_t change = orders[i].side == OrderSide::BID ? quantity : -quantity;
+            const bool valid = index < MAX_INSTRUMENTS;
+            new_position[i] = (valid ? lanes_.net_position[index] : 0) + change;
+            new_total[i] = total_position + change;
+            volatility_ok |= static_cast<uint64_t>(valid && ((instrument_volatility_ok >> index) & 1)) << i;
+            order_ok |= static_cast<uint64_t>(order_within_limits(orders[i].quantity, orders[i].price)) << i;
+        }
+        
+        const uint64_t position_ok = within_limit_mask(new_position.data(), n, risk_limits_.max_position_per_instrument);
+        const uint64_t total_ok = within_limit_mask(new_total.data(), n, risk_limits_.max_total_position);
+        const uint64_t rate_ok = rate_budget >= 64 ? ~0ULL : (1ULL << rate_budget) - 1;
+        const uint64_t all = n == 64 ? ~0ULL : (1ULL << n) - 1;
+        
+        approved = order_ok & position_ok & total_ok & volatility_ok & rate_ok & all;
+        if (__builtin_expect(approved != all, 0)) {
+            report_batch_rejects(orders, all & ~approved, position_ok, total_ok, volatility_ok, rate_ok,
+                                 total_position, sent);
+        }
+    }
+    
+    risk_checks_performed_.fetch_add(n, std::memory_order_relaxed);
+    total_risk_check_time_ns_.fetch_add(timer_.get_timestamp_ns() - start_time, std::memory_order_relaxed);
+    return approved;
+}
+
+inline void RiskControlSystem::report_batch_rejects(
+    std::span<const RiskCheckRequest> orders,
+    uint64_t rejected,
+    uint64_t position_ok,
+    uint64_t total_ok,
+    uint64_t volatility_ok,
+    uint64_t rate_ok,
+    int64_t total_position,
+    uint64_t order_count
+) noexcept {
+    while (rejected != 0) {
+        const auto i = static_cast<size_t>(__builtin_ctzll(rejected));
+        rejected &= rejected - 1;
+        const auto& order = orders[i];
+        const auto index = static_cast<size_t>(order.instrument);
+        if (index >= MAX_INSTRUMENTS) continue;
+        
+        const auto quantity = static_cast<int64_t>(order.quantity);
+        const int64_t change = order.side == OrderSide::BID ? quantity : -quantity;
+        if (!((position_ok >> i) & 1)) {
+            trigger_circuit_breaker(CircuitBreakerType::POSITION_LIMIT,
+                                   static_cast<double>(risk_limits_.max_position_per_instrument),
+                                   static_cast<double>(std::abs(lanes_.net_position[index] + change)),
+                                   "Instrument position limit exceeded", order.instrument);
+        } else if (!((total_ok >> i) & 1)) {
+            trigger_circuit_breaker(CircuitBreakerType::POSITION_LIMIT,
+                                   static_cast<double>(risk_limits_.max_total_position),
+                                   static_cast<double>(std::abs(total_position + change)),
+                                   "Total position limit exceeded", order.instrument);
+        }
+        if (!((rate_ok >> i) & 1)) {
+            trigger_circuit_breaker(CircuitBreakerType::ORDER_RATE_LIMIT,
+                                   static_cast<double>(risk_limits_.max_orders_per_second),
+                                   static_cast<double>(order_count + i),
+                                   "Order rate limit exceeded");
+        }
+        if (!((volatility_ok >> i) & 1)) {
+            trigger_circuit_breaker(CircuitBreakerType::VOLATILITY_LIMIT,
+                                   risk_limits_.max_price_volatility,
+                                   lanes_.volatility[index],
+                                   "Price volatility limit exceeded", order.instrument);
+        }
+    }
+}
+
 // Static asserts
 static_assert(alignof(RiskControlSystem) == 64, "RiskControlSystem must be cache-aligned");
 
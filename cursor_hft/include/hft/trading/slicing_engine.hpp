@@ -0,0 +1,444 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <algorithm>
+#include <span>
+#include "hft/timing/hft_timer.hpp"
+#include "hft/timing/timer_wheel.hpp"
+#include "hft/memory/object_pool.hpp"
+#include "hft/memory/fixed_hash_map.hpp"
+#include "hft/market_data/treasury_instruments.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+#include "hft/trading/venue_router.hpp"
+#include "hft/trading/book_manager.hpp"
+
+namespace hft {
+namespace trading {
+
+using namespace hft::market_data;
+
+/**
+ * @brief Parent-order slicing (TWAP / VWAP / iceberg) over VenueRouter
+ *
+ * A parent order is worked as a schedule of child LIMIT orders at the
+ * parent's limit price:
+ * - TWAP: equal slices every slice_interval_ns between start and end
+ * - VWAP: cumulative target follows the volume profile over [start, end]
+ * - ICEBERG: one display_quantity child at a time, replenished once filled
+ *
+ * Each slice is capped at max_participation of the opposite-side depth
+ * visible at or through the limit (when a BookManager is attached), then
+ * routed with VenueRouter: the primary venue takes up to max_child_quantity
+ * and the backup the next clip. Whatever the cap leaves over rolls into
+ * the next slice; at end_ns the remainder goes out uncapped.
+ *
+ * Slices fire from a timer wheel driven by on_timer(). Parents and children
+ * live in object pools and the order-id index is a fixed hash map, so
+ * slicing never allocates. Execution reports come in through
+ * on_execution() (alongside OrderLifecycleManager::process_fill()).
+ *
+ * Single-threaded: owned by the order thread.
+ *
+ * Performance targets:
+ * - Slice decision: <1us including routing
+ */
+class alignas(64) SlicingEngine {
+public:
+    static constexpr size_t MAX_PARENTS = 64;
+    static constexpr size_t MAX_CHILDREN = 1024;
+    static constexpr size_t VWAP_BUCKETS = 16;
+    static constexpr size_t DEPTH_LEVELS = 16;
+    static constexpr uint64_t DEFAULT_TICK_NS = 1000000;    // Timer wheel resolution (1ms)
+
+    enum class Algo : uint8_t {
+        TWAP = 0,
+        VWAP = 1,
+        ICEBERG = 2
+    };
+
+    struct Child;
+
+    // Parent order as submitted
+    struct ParentOrder {
+        TreasuryType instrument = TreasuryType::Note_10Y;
+        OrderSide side = OrderSide::BID;
+        Algo algo = Algo::TWAP;
+        uint8_t strategy_id = 0;                            // Passed through to child orders
+        Price32nd limit_price{};
+        uint64_t quantity = 0;
+        uint64_t start_ns = 0;
+        uint64_t end_ns = 0;
+        uint64_t slice_interval_ns = 1000000000;
+        uint64_t display_quantity = 0;                      // Iceberg clip
+        uint64_t max_child_quantity = 0;                    // Per-venue child cap (0 = none)
+        double max_participation = 0.0;                     // Fraction of visible depth per slice (0 = no cap)
+        VenueRouter::SORStrategy routing = VenueRouter::SORStrategy::BALANCED;
+        std::array<float, VWAP_BUCKETS> volume_profile{};   // Relative volume per bucket (all zero = flat)
+    };
+
+    // Parent progress
+    struct alignas(64) Parent {
+        ParentOrder order;
+        uint64_t parent_id = 0;
+        uint64_t working_quantity = 0;                      // Sent and not yet filled or closed
+        uint64_t filled_quantity = 0;
+        uint64_t slices = 0;                                // Slices that sent at least one child
+        uint32_t live_children = 0;
+        hft::TimerWheel<>::handle_t timer = 0;              // Next slice (0 = none pending)
+        Child* first_child = nullptr;
+
+        [[nodiscard]] uint64_t unsent() const noexcept {
+            return order.quantity - filled_quantity - working_quantity;
+        }
+    };
+
+    // Child order working at a venue
+    struct alignas(64) Child {
+        uint64_t order_id = 0;                              // OrderLifecycleManager id (8 bytes)
+        Parent* parent = nullptr;                           // Owning parent (8 bytes)
+        Child* prev = nullptr;                              // Sibling list (8 bytes)
+        Child* next = nullptr;                              // Sibling list (8 bytes)
+        uint64_t quantity = 0;                              // Child size (8 bytes)
+        uint64_t filled = 0;                                // Executed so far (8 bytes)
+        uint64_t sent_time_ns = 0;                          // Slice time (8 bytes)
+        VenueRouter::VenueType venue = VenueRouter::VenueType::PRIMARY_DEALER; // Venue (1 byte)
+        uint8_t _pad0[7];                                   // Padding (7 bytes)
+        // Total: 8+8+8+8+8+8+8+1+7 = 64 bytes
+
+        Child() noexcept : _pad0{} {}
+    };
+    static_assert(sizeof(Child) == 64, "Child must be 64 bytes");
+
+    struct Stats {
+        uint64_t parents_submitted = 0;
+        uint64_t parents_completed = 0;
+        uint64_t slices = 0;
+        uint64_t children_sent = 0;
+        uint64_t child_rejects = 0;                         // Refused by the order manager or pool
+        uint64_t depth_capped = 0;                          // Slices cut by the participation cap
+        uint64_t throttled = 0;                             // Slices deferred by venue rate limits
+    };
+
+    /**
+     * @param books Book depth for participation caps; nullptr disables them
+     */
+    SlicingEngine(OrderLifecycleManager& orders, VenueRouter& router, const BookManager* books = nullptr,
+                  uint64_t tick_ns = DEFAULT_TICK_NS, uint64_t start_ns = 0) noexcept
+        : orders_(orders), router_(router), books_(books), wheel_(tick_ns, start_ns),
+          parent_pool_(), child_pool_(), parents_(), children_(), next_parent_id_(1), stats_{} {}
+
+    // No copy (children point into the pools)
+    SlicingEngine(const SlicingEngine&) = delete;
+    SlicingEngine& operator=(const SlicingEngine&) = delete;
+
+    /**
+     * @brief Start working a parent order; the first slice fires at max(start_ns, now_ns)
+     * @return Parent id, 0 if the order is invalid or the engine is full
+     */
+    [[nodiscard]] uint64_t submit(const ParentOrder& order, uint64_t now_ns) noexcept {
+        if (!valid(order)) return 0;
+        Parent* parent = parent_pool_.acquire();
+        if (__builtin_expect(parent == nullptr, 0)) return 0;
+
+        *parent = Parent{};
+        parent->order = order;
+        parent->parent_id = next_parent_id_++;
+        parent->timer = wheel_.schedule(std::max(order.start_ns, now_ns), parent->parent_id);
+        if (parent->timer == 0 || !parents_.try_emplace(parent->parent_id, parent).second) {
+            (void)wheel_.cancel(parent->timer);
+            parent_pool_.release(parent);
+            return 0;
+        }
+        ++stats_.parents_submitted;
+        return parent->parent_id;
+    }
+
+    /**
+     * @brief Stop slicing and cancel the working children
+     * @return false if the parent is unknown or already finished
+     */
+    bool cancel(uint64_t parent_id) noexcept {
+        Parent** found = parents_.find(parent_id);
+        if (!found) return false;
+        retire(*found);
+        return true;
+    }
+
+    /**
+     * @brief Fire due slices
+     * @return Child orders sent
+     */
+    size_t on_timer(uint64_t now_ns) noexcept {
+        const uint64_t before = stats_.children_sent;
+        wheel_.advance(now_ns, [this, now_ns](uint64_t parent_id, uint64_t) {
+            if (Parent** found = parents_.find(parent_id)) {
+                (*found)->timer = 0;
+                run_slice(**found, now_ns);
+            }
+        });
+        return static_cast<size_t>(stats_.children_sent - before);
+    }
+
+    /**
+     * @brief Apply an execution report for a child order
+     * @return false if the order is not a child of this engine
+     */
+    bool on_execution(const OrderLifecycleManager::OrderExecution& execution) noexcept {
+        Child** found = children_.find(execution.order_id);
+        if (!found) return false;
+        Child* child = *found;
+        Parent* parent = child->parent;
+
+        const uint64_t executed = std::min(execution.executed_quantity, child->quantity - child->filled);
+        child->filled += executed;
+        parent->filled_quantity += executed;
+        parent->working_quantity -= executed;
+        if (execution.leaves_quantity == 0 || child->filled == child->quantity) {
+            close_child(child);
+        }
+
+        if (parent->filled_quantity >= parent->order.quantity) {
+            ++stats_.parents_completed;
+            retire(parent);
+        }
+        return true;
+    }
+
+    /**
+     * @brief A child left the venue unfilled (cancelled, expired, rejected)
+     */
+    bool on_child_closed(uint64_t order_id) noexcept {
+        Child** found = children_.find(order_id);
+        if (!found) return false;
+        Parent* parent = (*found)->parent;
+        close_child(*found);
+        if (parent->timer == 0) {
+            parent->timer = wheel_.schedule(0, parent->parent_id);  // Resend on the next on_timer()
+        }
+        return true;
+    }
+
+    /**
+     * @brief Working parent by id, nullptr once completed or cancelled
+     */
+    [[nodiscard]] const Parent* parent(uint64_t parent_id) const noexcept {
+        Parent* const* found = parents_.find(parent_id);
+        return found ? *found : nullptr;
+    }
+
+    /**
+     * @brief Visit a parent's working children, newest first
+     */
+    template<typename Fn>
+    void for_each_child(uint64_t parent_id, Fn&& fn) const noexcept {
+        const Parent* working = parent(parent_id);
+        for (const Child* child = working ? working->first_child : nullptr; child; child = child->next) {
+            fn(*child);
+        }
+    }
+
+    [[nodiscard]] size_t active_parents() const noexcept { return parents_.size(); }
+    [[nodiscard]] size_t working_children() const noexcept { return children_.size(); }
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+
+private:
+    static bool valid(const ParentOrder& order) noexcept {
+        if (order.quantity == 0 || static_cast<size_t>(order.instrument) >= BookManager::MAX_INSTRUMENTS) return false;
+        if (order.algo == Algo::ICEBERG) return order.display_quantity != 0;
+        return order.slice_interval_ns != 0 && order.end_ns >= order.start_ns;
+    }
+
+    // Cumulative share of the parent due by now_ns
+    static double scheduled_fraction(const ParentOrder& order, uint64_t now_ns) noexcept {
+        if (now_ns >= order.end_ns || order.end_ns == order.start_ns) return 1.0;
+        if (now_ns < order.start_ns) return 0.0;
+        const uint64_t span = order.end_ns - order.start_ns;
+
+        if (order.algo == Algo::TWAP) {
+            // Slice k (from 1) is due at start + (k - 1) * interval
+            const uint64_t slice_count = (span + order.slice_interval_ns - 1) / order.slice_interval_ns;
+            const uint64_t due = (now_ns - order.start_ns) / order.slice_interval_ns + 1;
+            return static_cast<double>(std::min(due, slice_count)) / static_cast<double>(slice_count);
+        }
+
+        double total = 0.0;
+        for (const float weight : order.volume_profile) total += weight;
+        const double position = static_cast<double>(now_ns - order.start_ns) / static_cast<double>(span) * VWAP_BUCKETS;
+        if (total <= 0.0) return position / VWAP_BUCKETS;
+
+        const auto bucket = static_cast<size_t>(position);
+        double done = 0.0;
+        for (size_t i = 0; i < bucket; ++i) done += order.volume_profile[i];
+        done += (position - static_cast<double>(bucket)) * order.volume_profile[bucket];
+        return done / total;
+    }
+
+    // Minimum order increment OrderLifecycleManager accepts
+    static constexpr uint64_t lot_size(TreasuryType instrument) noexcept {
+        return instrument == TreasuryType::Bill_3M || instrument == TreasuryType::Bill_6M ? 100000 : 1000000;
+    }
+
+    // Opposite-side quantity at or through the limit
+    uint64_t visible_depth(const ParentOrder& order) const noexcept {
+        const auto& book = books_->book(order.instrument);
+        const OrderSide opposite = order.side == OrderSide::BID ? OrderSide::ASK : OrderSide::BID;
+        std::array<TreasuryOrderBook::MarketDepth, DEPTH_LEVELS> levels;
+        const size_t count = book.get_market_depth(opposite, levels);
+
+        const double limit = order.limit_price.to_decimal();
+        uint64_t depth = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const double price = levels[i].price.to_decimal();
+            if (order.side == OrderSide::BID ? price > limit : price < limit) break;
+            depth += levels[i].quantity;
+        }
+        return depth;
+    }
+
+    uint64_t slice_quantity(const Parent& parent, uint64_t now_ns) noexcept {
+        const auto& order = parent.order;
+        const uint64_t unsent = parent.unsent();
+        if (unsent == 0) return 0;
+
+        uint64_t quantity = 0;
+        if (order.algo == Algo::ICEBERG) {
+            quantity = parent.working_quantity == 0 ? std::min(order.display_quantity, unsent) : 0;
+        } else {
+            const auto target = static_cast<uint64_t>(scheduled_fraction(order, now_ns) * static_cast<double>(order.quantity) + 0.5);
+            const uint64_t committed = parent.filled_quantity + parent.working_quantity;
+            quantity = target > committed ? std::min(target - committed, unsent) : 0;
+        }
+
+        const bool final_slice = order.algo != Algo::ICEBERG && now_ns >= order.end_ns;
+        if (quantity != 0 && books_ && order.max_participation > 0.0 && !final_slice) {
+            const auto cap = static_cast<uint64_t>(static_cast<double>(visible_depth(order)) * order.max_participation);
+            if (cap < quantity) {
+                quantity = cap;
+                ++stats_.depth_capped;
+            }
+        }
+        // Whole lots only until the final slice sweeps the remainder
+        if (!final_slice && quantity < unsent) quantity -= quantity % lot_size(order.instrument);
+        return quantity;
+    }
+
+    void run_slice(Parent& parent, uint64_t now_ns) noexcept {
+        const auto& order = parent.order;
+        const uint64_t remaining = slice_quantity(parent, now_ns);
+        uint64_t next_ns = now_ns + order.slice_interval_ns;
+
+        if (remaining != 0) {
+            VenueRouter::OrderCharacteristics characteristics{};
+            characteristics.instrument = order.instrument;
+            characteristics.side = order.side;
+            characteristics.quantity = remaining;
+            characteristics.price = order.limit_price;
+            characteristics.is_aggressive = false;
+            characteristics.urgency_factor = order.algo == Algo::ICEBERG ? 0.5 : scheduled_fraction(order, now_ns);
+            const auto decision = router_.route_order(characteristics, order.routing);
+
+            if (decision.throttled) {
+                ++stats_.throttled;
+                next_ns = std::max(decision.retry_at_ns, now_ns + 1);
+            } else {
+                const uint64_t clip = order.max_child_quantity ? order.max_child_quantity : remaining;
+                const uint64_t primary = std::min(clip, remaining);
+                if (send_child(parent, decision.primary_venue, primary, now_ns) && remaining > primary &&
+                    decision.backup_venue != decision.primary_venue) {
+                    (void)send_child(parent, decision.backup_venue, std::min(clip, remaining - primary), now_ns);
+                }
+                ++stats_.slices;
+                ++parent.slices;
+            }
+        }
+
+        // Keep the schedule alive while anything is left to send
+        if (parent.unsent() != 0 || order.algo == Algo::ICEBERG) {
+            if (order.algo != Algo::ICEBERG && now_ns < order.end_ns) {
+                next_ns = std::min(next_ns, order.end_ns);
+            }
+            parent.timer = wheel_.schedule(next_ns, parent.parent_id);
+        }
+    }
+
+    bool send_child(Parent& parent, VenueRouter::VenueType venue, uint64_t quantity, uint64_t now_ns) noexcept {
+        Child* child = child_pool_.acquire();
+        if (__builtin_expect(child == nullptr, 0)) {
+            ++stats_.child_rejects;
+            return false;
+        }
+
+        const auto& order = parent.order;
+        const uint64_t order_id = orders_.create_order(order.instrument, order.side, OrderType::LIMIT, order.limit_price,
+                                                       quantity, OrderLifecycleManager::TimeInForce::DAY,
+                                                       order.strategy_id, venue);
+        if (order_id == 0 || !children_.try_emplace(order_id, child).second) {
+            if (order_id != 0) (void)orders_.cancel_order(order_id);
+            child_pool_.release(child);
+            ++stats_.child_rejects;
+            return false;
+        }
+
+        *child = Child{};
+        child->order_id = order_id;
+        child->parent = &parent;
+        child->quantity = quantity;
+        child->sent_time_ns = now_ns;
+        child->venue = venue;
+        child->next = parent.first_child;
+        if (parent.first_child) parent.first_child->prev = child;
+        parent.first_child = child;
+
+        parent.working_quantity += quantity;
+        ++parent.live_children;
+        ++stats_.children_sent;
+        return true;
+    }
+
+    void close_child(Child* child) noexcept {
+        Parent* parent = child->parent;
+        parent->working_quantity -= child->quantity - child->filled;
+        --parent->live_children;
+        if (child->prev) {
+            child->prev->next = child->next;
+        } else {
+            parent->first_child = child->next;
+        }
+        if (child->next) child->next->prev = child->prev;
+
+        (void)children_.erase(child->order_id);
+        (void)orders_.retire_order(child->order_id);  // Frees the slot once the child is terminal
+        child_pool_.release(child);
+    }
+
+    void retire(Parent* parent) noexcept {
+        // Completed parents can still have unfilled clips working
+        while (parent->first_child) {
+            Child* child = parent->first_child;
+            (void)orders_.cancel_order(child->order_id);
+            close_child(child);
+        }
+        if (parent->timer != 0) {
+            (void)wheel_.cancel(parent->timer);
+            parent->timer = 0;
+        }
+        (void)parents_.erase(parent->parent_id);
+        parent_pool_.release(parent);
+    }
+
+    OrderLifecycleManager& orders_;
+    VenueRouter& router_;
+    const BookManager* books_;
+    hft::TimerWheel<> wheel_;
+    hft::ObjectPool<Parent, MAX_PARENTS> parent_pool_;
+    hft::ObjectPool<Child, MAX_CHILDREN> child_pool_;
+    hft::FixedHashMap<uint64_t, Parent*, MAX_PARENTS> parents_;
+    hft::FixedHashMap<uint64_t, Child*, MAX_CHILDREN> children_;
+    uint64_t next_parent_id_;
+    Stats stats_;
+};
+
+} // namespace trading
+} // namespace hft
@@ -0,0 +1,328 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "hft/market_data/treasury_instruments.hpp"
+
+namespace hft {
+namespace trading {
+
+using namespace hft::market_data;
+
+// ========================= 1. Entry Format =========================
+//
+// A journal is a sequence of generation files <base>.journal.00000, ...
+// Each generation is preallocated and mapped shared:
+//   JournalSegmentHeader                      (64 bytes)
+//   JournalEntry[capacity]                    (64 bytes each)
+// Entry i of a generation carries sequence first_sequence + i; an entry
+// whose sequence does not match (never written, or torn by a crash mid
+// copy) ends the generation. A snapshot taken at generation N covers every
+// entry before generation N's first_sequence. Appends refused because the
+// generation was full are counted in its header: replaying such a
+// generation cannot reproduce the state it was recording.
+
+constexpr uint64_t JOURNAL_MAGIC = 0x31304c4e524a4648ULL;  // "HFJRNL01"
+constexpr uint32_t JOURNAL_VERSION = 1;
+
+enum class JournalEntryType : uint8_t {
+    NONE = 0,
+    ORDER_NEW = 1,          // Immutable order fields at creation
+    ORDER_UPDATE = 2,       // Post-image of state, price and quantities
+    ORDER_RETIRE = 3,       // Slot freed; the ID's generation is over
+    POSITION_FILL = 4,      // PositionReconciliationManager::update_position
+    POSITION_MARK = 5,      // PositionReconciliationManager::update_market_price
+    RISK_FILL = 6,          // RiskControlSystem::update_position
+    RISK_MARK = 7           // RiskControlSystem::update_market_price
+};
+
+struct alignas(64) JournalEntry {
+    uint64_t sequence = 0;                              // Stored last; 0 = never written (8 bytes)
+    uint64_t timestamp_ns = 0;                          // Event time (8 bytes)
+    uint64_t order_id = 0;                              // Order the event belongs to (8 bytes)
+    uint64_t quantity = 0;                              // Original or fill quantity (8 bytes)
+    uint64_t executed_quantity = 0;                     // ORDER_UPDATE cumulative fills (8 bytes)
+    int64_t position_change = 0;                        // RISK_FILL signed change (8 bytes)
+    Price32nd price;                                    // Order, fill or mark price (8 bytes)
+    JournalEntryType type = JournalEntryType::NONE;     // Event type (1 byte)
+    uint8_t instrument = 0;                             // TreasuryType (1 byte)
+    uint8_t side = 0;                                   // OrderSide (1 byte)
+    uint8_t state = 0;                                  // OrderState (1 byte)
+    uint8_t venue = 0;                                  // VenueType (1 byte)
+    uint8_t strategy_id = 0;                            // Originating strategy (1 byte)
+    uint8_t order_type = 0;                             // OrderType (1 byte)
+    uint8_t time_in_force = 0;                          // TimeInForce (1 byte)
+    // Total: 8*6+8+8 = 64 bytes
+};
+static_assert(sizeof(JournalEntry) == 64, "JournalEntry must be 64 bytes");
+
+struct alignas(64) JournalSegmentHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t generation;
+    uint64_t first_sequence;
+    uint64_t capacity;          // Entries the generation holds
+    uint32_t entry_size;        // sizeof(JournalEntry) at write time
+    uint32_t _reserved;
+    uint64_t entries_dropped;   // Appends refused while full (updated in place)
+    uint8_t _pad[16];
+};
+static_assert(sizeof(JournalSegmentHeader) == 64, "JournalSegmentHeader must be 64 bytes");
+
+namespace detail {
+
+inline std::string journal_path(const std::string& base_path, const char* kind, uint32_t generation) {
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), ".%s.%05u", kind, generation);
+    return base_path + suffix;
+}
+
+} // namespace detail
+
+// ========================= 2. Journal Writer =========================
+
+/**
+ * @brief Write-ahead journal of order, position and risk state changes
+ *
+ * Each generation file is preallocated and mapped MAP_SHARED, so append()
+ * is a slot reservation (one fetch_add) plus a 64-byte copy with the
+ * sequence stored last; the entry survives a process crash as soon as
+ * append() returns. sync() adds power-loss durability (msync) for the
+ * range appended since the previous sync and is meant for a cadence, not
+ * per entry. Any thread may append; open() and rotate() need appenders
+ * quiesced (in practice: called from the trading thread).
+ *
+ * A full generation refuses appends: append() returns 0 and the loss is
+ * counted both in rejected() and in the generation's header, so recovery
+ * can tell the journal is incomplete. Owners roll the journal before that
+ * happens once needs_rotation() (see WarmRestart::maintain()).
+ */
+class StateJournal {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1 << 20;    // 64MB per generation
+
+    StateJournal() noexcept
+        : fd_(-1), map_(nullptr), map_bytes_(0), entries_(nullptr), capacity_(0), generation_(0),
+          first_sequence_(1), synced_(0), tail_(0), rejected_(0) {}
+    ~StateJournal() { close(); }
+
+    StateJournal(const StateJournal&) = delete;
+    StateJournal& operator=(const StateJournal&) = delete;
+
+    /**
+     * @brief Create generation `generation` starting at first_sequence (replaces an existing file)
+     */
+    bool open(const std::string& base_path, uint32_t generation, uint64_t first_sequence,
+              size_t capacity = DEFAULT_CAPACITY) noexcept {
+        close();
+        base_path_ = base_path;
+        capacity_ = capacity ? capacity : DEFAULT_CAPACITY;
+        return open_generation(generation, first_sequence);
+    }
+
+    /**
+     * @brief Continue in a fresh generation after every entry appended so far
+     * @return New generation number (0 on failure)
+     */
+    uint32_t rotate() noexcept {
+        if (entries_ == nullptr) return 0;
+        const uint64_t next = next_sequence();
+        const uint32_t generation = generation_ + 1;
+        unmap(true);
+        return open_generation(generation, next) ? generation : 0;
+    }
+
+    /**
+     * @brief Append one entry; the sequence field is assigned here
+     * @return Sequence assigned, 0 if the generation is full
+     */
+    uint64_t append(const JournalEntry& entry) noexcept {
+        const uint64_t index = tail_.fetch_add(1, std::memory_order_relaxed);
+        if (__builtin_expect(index >= capacity_, 0)) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            if (map_ != nullptr) {
+                __atomic_fetch_add(&static_cast<JournalSegmentHeader*>(map_)->entries_dropped, 1, __ATOMIC_RELAXED);
+            }
+            return 0;
+        }
+        const uint64_t sequence = first_sequence_ + index;
+        JournalEntry* slot = entries_ + index;
+        std::memcpy(reinterpret_cast<uint8_t*>(slot) + sizeof(uint64_t),
+                    reinterpret_cast<const uint8_t*>(&entry) + sizeof(uint64_t), sizeof(JournalEntry) - sizeof(uint64_t));
+        __atomic_store_n(&slot->sequence, sequence, __ATOMIC_RELEASE);
+        return sequence;
+    }
+
+    /**
+     * @brief msync everything appended since the last sync
+     */
+    bool sync() noexcept {
+        if (entries_ == nullptr) return false;
+        const uint64_t end = appended();
+        if (end <= synced_) return true;
+        // msync wants page-aligned starts
+        const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t from = (sizeof(JournalSegmentHeader) + synced_ * sizeof(JournalEntry)) / page * page;
+        const size_t to = sizeof(JournalSegmentHeader) + end * sizeof(JournalEntry);
+        if (::msync(static_cast<uint8_t*>(map_) + from, to - from, MS_SYNC) != 0) return false;
+        synced_ = end;
+        return true;
+    }
+
+    void close() noexcept { unmap(true); }
+
+    [[nodiscard]] bool is_open() const noexcept { return entries_ != nullptr; }
+    [[nodiscard]] uint32_t generation() const noexcept { return generation_; }
+    [[nodiscard]] uint64_t first_sequence() const noexcept { return first_sequence_; }
+    [[nodiscard]] uint64_t next_sequence() const noexcept { return first_sequence_ + appended(); }
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] bool full() const noexcept { return appended() >= capacity_; }
+    /** @brief Past 7/8 of the generation: roll before appends start failing */
+    [[nodiscard]] bool needs_rotation() const noexcept { return appended() >= capacity_ - capacity_ / 8; }
+    [[nodiscard]] uint64_t rejected() const noexcept { return rejected_.load(std::memory_order_relaxed); }
+    [[nodiscard]] const std::string& base_path() const noexcept { return base_path_; }
+
+private:
+    uint64_t appended() const noexcept {
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        return tail < capacity_ ? tail : capacity_;
+    }
+
+    bool open_generation(uint32_t generation, uint64_t first_sequence) noexcept {
+        const std::string path = detail::journal_path(base_path_, "journal", generation);
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd_ < 0) return false;
+        map_bytes_ = sizeof(JournalSegmentHeader) + capacity_ * sizeof(JournalEntry);
+        if (::ftruncate(fd_, static_cast<off_t>(map_bytes_)) != 0) {
+            unmap(false);
+            return false;
+        }
+        void* addr = ::mmap(nullptr, map_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (addr == MAP_FAILED) {
+            unmap(false);
+            return false;
+        }
+        map_ = addr;
+
+        JournalSegmentHeader header{};
+        header.magic = JOURNAL_MAGIC;
+        header.version = JOURNAL_VERSION;
+        header.generation = generation;
+        header.first_sequence = first_sequence;
+        header.capacity = capacity_;
+        header.entry_size = sizeof(JournalEntry);
+        std::memcpy(map_, &header, sizeof(header));
+
+        entries_ = reinterpret_cast<JournalEntry*>(static_cast<uint8_t*>(map_) + sizeof(JournalSegmentHeader));
+        generation_ = generation;
+        first_sequence_ = first_sequence;
+        synced_ = 0;
+        tail_.store(0, std::memory_order_release);
+        return true;
+    }
+
+    void unmap(bool sync_first) noexcept {
+        if (map_ != nullptr) {
+            if (sync_first) (void)sync();
+            ::munmap(map_, map_bytes_);
+        }
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = -1;
+        map_ = nullptr;
+        entries_ = nullptr;
+    }
+
+    std::string base_path_;
+    int fd_;
+    void* map_;
+    size_t map_bytes_;
+    JournalEntry* entries_;
+    size_t capacity_;
+    uint32_t generation_;
+    uint64_t first_sequence_;
+    uint64_t synced_;                                   // Entries covered by the last sync()
+    alignas(64) std::atomic<uint64_t> tail_;            // Next free index (may run past capacity)
+    alignas(64) std::atomic<uint64_t> rejected_;
+};
+
+// ========================= 3. Journal Reader =========================
+
+/**
+ * @brief Maps one journal generation read-only for replay
+ */
+class JournalReader {
+public:
+    JournalReader() noexcept : map_(nullptr), map_bytes_(0), header_(nullptr), count_(0) {}
+    ~JournalReader() { close(); }
+
+    JournalReader(const JournalReader&) = delete;
+    JournalReader& operator=(const JournalReader&) = delete;
+
+    /**
+     * @brief Map <base>.journal.<generation> and find its written prefix
+     */
+    bool open(const std::string& base_path, uint32_t generation) noexcept {
+        close();
+        const std::string path = detail::journal_path(base_path, "journal", generation);
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(JournalSegmentHeader)) {
+            ::close(fd);
+            return false;
+        }
+        map_bytes_ = static_cast<size_t>(st.st_size);
+        void* addr = ::mmap(nullptr, map_bytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) return false;
+        map_ = addr;
+
+        header_ = static_cast<const JournalSegmentHeader*>(map_);
+        const size_t room = (map_bytes_ - sizeof(JournalSegmentHeader)) / sizeof(JournalEntry);
+        if (header_->magic != JOURNAL_MAGIC || header_->version != JOURNAL_VERSION ||
+            header_->entry_size != sizeof(JournalEntry) || header_->capacity > room) {
+            close();
+            return false;
+        }
+        (void)::madvise(addr, map_bytes_, MADV_SEQUENTIAL);
+        count_ = 0;
+        while (count_ < header_->capacity && entries()[count_].sequence == header_->first_sequence + count_) {
+            ++count_;
+        }
+        return true;
+    }
+
+    void close() noexcept {
+        if (map_ != nullptr) ::munmap(map_, map_bytes_);
+        map_ = nullptr;
+        header_ = nullptr;
+        count_ = 0;
+    }
+
+    [[nodiscard]] uint64_t first_sequence() const noexcept { return header_ ? header_->first_sequence : 0; }
+    /** @brief Appends the writer refused while this generation was full */
+    [[nodiscard]] uint64_t entries_dropped() const noexcept { return header_ ? header_->entries_dropped : 0; }
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] const JournalEntry& operator[](size_t i) const noexcept { return entries()[i]; }
+
+private:
+    const JournalEntry* entries() const noexcept {
+        return reinterpret_cast<const JournalEntry*>(static_cast<const uint8_t*>(map_) + sizeof(JournalSegmentHeader));
+    }
+
+    void* map_;
+    size_t map_bytes_;
+    const JournalSegmentHeader* header_;
+    size_t count_;
+};
+
+} // namespace trading
+} // namespace hft
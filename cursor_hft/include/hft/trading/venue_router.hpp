@@ -6,11 +6,14 @@
 #include <atomic>
 #include <memory>
 #include <cmath>
+#include <utility>
 #include "hft/timing/hft_timer.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
 #include "hft/market_data/treasury_instruments.hpp"
 #include "hft/trading/order_lifecycle_manager.hpp"
+#include "hft/trading/rate_limiter.hpp"
+#include "hft/config/system_traits.hpp"
 
 namespace hft {
 namespace trading {
@@ -27,6 +30,15 @@ using namespace hft::market_data;
  * - Smart order routing (SOR) algorithms
  * - Venue connectivity monitoring
  * - Load balancing and failover
+ * - Per-venue message-rate throttles (lock-free, shared by all callers)
+ * 
+ * Venue selection is a lookup in a materialized ranking keyed by
+ * (strategy, size bucket, instrument, aggressive, urgent). An entry is
+ * rebuilt by the full scoring pass, at the bucket's representative size,
+ * the first time it is used after an invalidation; connectivity, enable
+ * flags and performance moves beyond the ranking threshold invalidate the
+ * table. Order-specific estimates (fill probability, confidence) are still
+ * computed for the selected venue.
  * 
  * Performance targets:
  * - Routing decision: <200ns
@@ -37,9 +49,20 @@ using namespace hft::market_data;
  */
 class alignas(64) VenueRouter {
 public:
-    static constexpr size_t MAX_VENUES = 8;
+    using VenueType = OrderLifecycleManager::VenueType;
+    
+    static constexpr size_t MAX_VENUES = config::SystemTraits::MAX_VENUES;
     static constexpr size_t PERFORMANCE_HISTORY_SIZE = 1000;
     static constexpr size_t CONNECTIVITY_HISTORY_SIZE = 100;
+    static constexpr size_t SOR_STRATEGIES = 6;
+    static constexpr size_t SIZE_BUCKETS = 4;
+    static constexpr size_t RANKING_INSTRUMENTS = 6;
+    static constexpr size_t RANKING_ENTRIES = SOR_STRATEGIES * SIZE_BUCKETS * RANKING_INSTRUMENTS * 4;
+    static constexpr double DEFAULT_RANKING_THRESHOLD = 0.05;  // Relative move that re-ranks
+    
+    // Size buckets: upper bounds and the size each bucket is ranked at
+    static constexpr std::array<uint64_t, SIZE_BUCKETS - 1> SIZE_BUCKET_LIMITS{1000000, 10000000, 50000000};
+    static constexpr std::array<uint64_t, SIZE_BUCKETS> SIZE_BUCKET_REPRESENTATIVE{1000000, 5000000, 25000000, 100000000};
     
     // Venue connection status
     enum class ConnectionStatus : uint8_t {
@@ -88,6 +111,8 @@ public:
         double expected_latency_ns = 1000.0;                // Expected response time
         uint64_t decision_time_ns = 0;                      // Decision timestamp
         SORStrategy strategy_used = SORStrategy::BALANCED;   // Strategy applied
+        bool throttled = false;                             // Primary and backup both at their rate limit
+        uint64_t retry_at_ns = 0;                           // Earliest send time when throttled
     };
     
     // Venue-specific order characteristics
@@ -112,6 +137,26 @@ public:
         PerformanceHistory() noexcept : latencies{}, fill_results{}, market_impacts{} {}
     };
     
+    // Performance inputs a ranking was built from
+    struct RankingInputs {
+        double fill_rate = 0.0;
+        double average_latency_ns = 0.0;
+        double market_impact = 0.0;
+        double p95_latency_ns = 0.0;
+    };
+    
+    // Materialized routing decision for one key
+    struct RankingEntry {
+        uint64_t epoch = 0;                                 // Ranking epoch built in (0 = never)
+        RoutingDecision decision;
+    };
+    
+    struct RankingCacheStats {
+        uint64_t hits = 0;
+        uint64_t rebuilds = 0;
+        uint64_t invalidations = 0;
+    };
+    
     // Connectivity monitoring
     struct alignas(64) ConnectivityMonitor {
         std::array<ConnectionStatus, CONNECTIVITY_HISTORY_SIZE> status_history;
@@ -138,6 +183,10 @@ public:
      * @param characteristics Order characteristics
      * @param strategy Routing strategy to apply
      * @return Routing decision with venue selection
+     *
+     * A throttled venue reserves one message per decision: a primary at
+     * its limit falls back to the backup, and when both are limited the
+     * decision is marked throttled with the primary's retry time.
      */
     [[nodiscard]] RoutingDecision route_order(
         const OrderCharacteristics& characteristics,
@@ -214,6 +263,26 @@ public:
      * @param enabled Enable/disable flag
      */
     void set_venue_enabled(VenueType venue, bool enabled) noexcept;
+    
+    /**
+     * @brief Set a venue's message-rate limit (max_messages = 0 removes it)
+     */
+    void configure_venue_throttle(VenueType venue, const RateLimiter::Config& config) noexcept {
+        const auto index = static_cast<size_t>(venue);
+        if (index < MAX_VENUES) venue_throttles_[index].configure(config);
+    }
+    
+    [[nodiscard]] const RateLimiter& get_venue_throttle(VenueType venue) const noexcept {
+        return venue_throttles_[static_cast<size_t>(venue) % MAX_VENUES];
+    }
+    
+    /**
+     * @brief Relative change in a venue's fill rate, latency or impact that re-ranks
+     */
+    void set_ranking_threshold(double relative_change) noexcept { ranking_threshold_ = relative_change; }
+    
+    [[nodiscard]] const RankingCacheStats& ranking_cache_stats() const noexcept { return ranking_stats_; }
+    [[nodiscard]] uint64_t ranking_epoch() const noexcept { return ranking_epoch_.load(std::memory_order_relaxed); }
 
 private:
     // Performance tracking per venue
@@ -229,6 +298,14 @@ private:
     alignas(64) std::array<uint64_t, MAX_VENUES> last_performance_update_;
     alignas(64) std::array<double, MAX_VENUES> cached_venue_scores_;
     alignas(64) std::atomic<uint64_t> cache_invalidation_time_;
+    alignas(64) std::atomic<uint64_t> ranking_epoch_;
+    double ranking_threshold_;
+    RankingCacheStats ranking_stats_;
+    alignas(64) std::array<RankingInputs, MAX_VENUES> ranked_inputs_;
+    alignas(64) std::array<RankingEntry, RANKING_ENTRIES> ranking_table_;
+    
+    // Venue message-rate throttles
+    alignas(64) std::array<RateLimiter, MAX_VENUES> venue_throttles_;
     
     // Algorithm implementations
     RoutingDecision apply_latency_optimization(const OrderCharacteristics& characteristics) noexcept;
@@ -242,6 +319,11 @@ private:
     void update_performance_cache(VenueType venue) noexcept;
     bool is_cache_valid() const noexcept;
     void invalidate_cache() noexcept;
+    void apply_venue_throttles(RoutingDecision& decision, uint64_t now_ns) noexcept;
+    RoutingDecision compute_decision(const OrderCharacteristics& characteristics, SORStrategy strategy) noexcept;
+    void refine_decision(RoutingDecision& decision, const OrderCharacteristics& characteristics,
+                         SORStrategy strategy) noexcept;
+    static size_t size_bucket(uint64_t quantity) noexcept;
     
     double calculate_latency_percentile(VenueType venue, double percentile) const noexcept;
     double calculate_historical_fill_rate(VenueType venue, uint64_t lookback_samples) const noexcept;
@@ -258,7 +340,13 @@ inline VenueRouter::VenueRouter() noexcept
       timer_(),
       last_performance_update_{},
       cached_venue_scores_{},
-      cache_invalidation_time_(0) {
+      cache_invalidation_time_(0),
+      ranking_epoch_(1),
+      ranking_threshold_(DEFAULT_RANKING_THRESHOLD),
+      ranking_stats_{},
+      ranked_inputs_{},
+      ranking_table_{},
+      venue_throttles_{} {
     
     // Initialize venue performance with defaults
     for (size_t i = 0; i < MAX_VENUES; ++i) {
@@ -273,6 +361,7 @@ inline VenueRouter::VenueRouter() noexcept
         venue_enabled_[i] = true;
         last_performance_update_[i] = 0;
         cached_venue_scores_[i] = 0.0;
+        update_performance_cache(static_cast<VenueType>(i));
     }
 }
 
@@ -283,35 +372,105 @@ inline VenueRouter::RoutingDecision VenueRouter::route_order(
     const auto start_time = timer_.get_timestamp_ns();
     
     RoutingDecision decision;
+    const auto instrument_index = static_cast<size_t>(characteristics.instrument);
+    const auto strategy_index = static_cast<size_t>(strategy);
+    if (__builtin_expect(instrument_index < RANKING_INSTRUMENTS && strategy_index < SOR_STRATEGIES, 1)) {
+        const size_t bucket = size_bucket(characteristics.quantity);
+        const size_t key = (((strategy_index * SIZE_BUCKETS + bucket) *
+                             RANKING_INSTRUMENTS + instrument_index) * 2 + (characteristics.is_aggressive ? 1 : 0)) * 2 +
+                           (characteristics.urgency_factor > 0.8 ? 1 : 0);
+        auto& entry = ranking_table_[key];
+        const uint64_t epoch = ranking_epoch_.load(std::memory_order_relaxed);
+        if (__builtin_expect(entry.epoch != epoch, 0)) {
+            // Rank at the bucket's representative size
+            OrderCharacteristics representative = characteristics;
+            representative.quantity = SIZE_BUCKET_REPRESENTATIVE[bucket];
+            entry.decision = compute_decision(representative, strategy);
+            entry.epoch = epoch;
+            ++ranking_stats_.rebuilds;
+        } else {
+            ++ranking_stats_.hits;
+        }
+        decision = entry.decision;
+        refine_decision(decision, characteristics, strategy);
+    } else {
+        decision = compute_decision(characteristics, strategy);
+    }
+    
     decision.decision_time_ns = start_time;
     decision.strategy_used = strategy;
+    apply_venue_throttles(decision, start_time);
     
+    return decision;
+}
+
+inline VenueRouter::RoutingDecision VenueRouter::compute_decision(
+    const OrderCharacteristics& characteristics,
+    SORStrategy strategy
+) noexcept {
     // Apply selected strategy
     switch (strategy) {
         case SORStrategy::LATENCY_OPTIMIZED:
-            decision = apply_latency_optimization(characteristics);
-            break;
+            return apply_latency_optimization(characteristics);
         case SORStrategy::FILL_RATE_OPTIMIZED:
-            decision = apply_fill_rate_optimization(characteristics);
-            break;
+            return apply_fill_rate_optimization(characteristics);
         case SORStrategy::COST_OPTIMIZED:
-            decision = apply_cost_optimization(characteristics);
-            break;
+            return apply_cost_optimization(characteristics);
         case SORStrategy::BALANCED:
-            decision = apply_balanced_optimization(characteristics);
-            break;
+            return apply_balanced_optimization(characteristics);
         case SORStrategy::VOLUME_WEIGHTED:
-            decision = apply_volume_weighted_routing(characteristics);
+            return apply_volume_weighted_routing(characteristics);
+        default:
+            return apply_balanced_optimization(characteristics);
+    }
+}
+
+inline void VenueRouter::refine_decision(
+    RoutingDecision& decision,
+    const OrderCharacteristics& characteristics,
+    SORStrategy strategy
+) noexcept {
+    // Estimates for this order at the cached venue (skipped when no venue qualified)
+    switch (strategy) {
+        case SORStrategy::LATENCY_OPTIMIZED:
+            break;
+        case SORStrategy::FILL_RATE_OPTIMIZED:
+            if (decision.expected_fill_rate > 0.0) {
+                decision.expected_fill_rate = calculate_fill_probability(decision.primary_venue, characteristics);
+                decision.confidence_score = decision.expected_fill_rate;
+            }
             break;
         default:
-            decision = apply_balanced_optimization(characteristics);
+            if (decision.confidence_score >= 0.0) {
+                decision.confidence_score = std::min(1.0, calculate_venue_score(decision.primary_venue, characteristics,
+                                                                                SORStrategy::BALANCED));
+            }
             break;
     }
+}
+
+inline size_t VenueRouter::size_bucket(uint64_t quantity) noexcept {
+    size_t bucket = 0;
+    while (bucket < SIZE_BUCKET_LIMITS.size() && quantity > SIZE_BUCKET_LIMITS[bucket]) {
+        ++bucket;
+    }
+    return bucket;
+}
+
+inline void VenueRouter::apply_venue_throttles(RoutingDecision& decision, uint64_t now_ns) noexcept {
+    const auto primary = venue_throttles_[static_cast<size_t>(decision.primary_venue)].try_acquire(now_ns);
+    if (__builtin_expect(primary.admitted, 1)) return;
+    
+    if (decision.backup_venue != decision.primary_venue &&
+        venue_throttles_[static_cast<size_t>(decision.backup_venue)].try_acquire(now_ns)) {
+        std::swap(decision.primary_venue, decision.backup_venue);
+        decision.expected_latency_ns = venue_performance_[static_cast<size_t>(decision.primary_venue)].average_latency_ns;
+        decision.expected_fill_rate = venue_performance_[static_cast<size_t>(decision.primary_venue)].fill_rate;
+        return;
+    }
     
-    decision.decision_time_ns = start_time;
-    decision.strategy_used = strategy;
-    
-    return decision;
+    decision.throttled = true;
+    decision.retry_at_ns = primary.retry_at_ns;
 }
 
 inline VenueRouter::RoutingDecision VenueRouter::apply_latency_optimization(
@@ -518,8 +677,18 @@ inline void VenueRouter::update_venue_performance(
     
     perf.last_response_time_ns = timer_.get_timestamp_ns();
     
-    // Invalidate cache
-    invalidate_cache();
+    // Re-rank only on a move beyond the threshold since the last ranking
+    const auto& ranked = ranked_inputs_[venue_index];
+    const auto moved = [this](double current, double ranked_value) {
+        return std::abs(current - ranked_value) > ranking_threshold_ * std::abs(ranked_value);
+    };
+    if (moved(perf.fill_rate, ranked.fill_rate) ||
+        moved(perf.average_latency_ns, ranked.average_latency_ns) ||
+        moved(perf.market_impact, ranked.market_impact) ||
+        moved(calculate_latency_percentile(venue, 0.95), ranked.p95_latency_ns)) {
+        update_performance_cache(venue);
+        invalidate_cache();
+    }
 }
 
 inline double VenueRouter::calculate_fill_probability(
@@ -583,6 +752,9 @@ inline void VenueRouter::update_connectivity_status(VenueType venue, ConnectionS
     auto& perf = venue_performance_[venue_index];
     auto& monitor = connectivity_monitors_[venue_index];
     
+    if (perf.status != status) {
+        invalidate_cache();
+    }
     perf.status = status;
     
     // Update connectivity history
@@ -624,6 +796,19 @@ inline double VenueRouter::calculate_latency_percentile(VenueType venue, double
 
 inline void VenueRouter::invalidate_cache() noexcept {
     cache_invalidation_time_.store(timer_.get_timestamp_ns(), std::memory_order_relaxed);
+    ranking_epoch_.fetch_add(1, std::memory_order_relaxed);
+    ++ranking_stats_.invalidations;
+}
+
+inline void VenueRouter::update_performance_cache(VenueType venue) noexcept {
+    const auto venue_index = static_cast<size_t>(venue);
+    const auto& perf = venue_performance_[venue_index];
+    auto& ranked = ranked_inputs_[venue_index];
+    ranked.fill_rate = perf.fill_rate;
+    ranked.average_latency_ns = perf.average_latency_ns;
+    ranked.market_impact = perf.market_impact;
+    ranked.p95_latency_ns = calculate_latency_percentile(venue, 0.95);
+    last_performance_update_[venue_index] = timer_.get_timestamp_ns();
 }
 
 inline void VenueRouter::set_venue_enabled(VenueType venue, bool enabled) noexcept {
@@ -635,7 +820,7 @@ inline void VenueRouter::set_venue_enabled(VenueType venue, bool enabled) noexce
 }
 
 // Stub implementations for remaining getter methods
-inline std::array<VenueType, VenueRouter::MAX_VENUES> VenueRouter::get_venue_ranking(
+inline std::array<VenueRouter::VenueType, VenueRouter::MAX_VENUES> VenueRouter::get_venue_ranking(
     TreasuryType instrument,
     OrderSide side
 ) const noexcept {
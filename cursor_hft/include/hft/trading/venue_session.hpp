@@ -0,0 +1,673 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "hft/config/system_traits.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+#include "hft/runtime/coroutine.hpp"
+#include "hft/timing/hft_timer.hpp"
+#include "hft/trading/order_entry_codec.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+
+namespace hft {
+namespace trading {
+
+/**
+ * @brief Fixed receive/send buffer with a consumed-prefix offset
+ *
+ * Consuming only moves the read offset, so decoding message after message
+ * never shifts bytes; compact() moves the unread tail to the front when
+ * the free room at the end runs short.
+ */
+template<size_t Capacity>
+class SessionBuffer {
+public:
+    [[nodiscard]] const char* data() const noexcept { return data_ + begin_; }
+    [[nodiscard]] size_t size() const noexcept { return end_ - begin_; }
+    [[nodiscard]] size_t room() const noexcept { return Capacity - end_; }
+    [[nodiscard]] char* tail() noexcept { return data_ + end_; }
+
+    void commit(size_t bytes) noexcept { end_ += bytes; }
+
+    void consume(size_t bytes) noexcept {
+        begin_ += bytes;
+        if (begin_ == end_) begin_ = end_ = 0;
+    }
+
+    /** @return true if room() >= bytes, compacting if that makes it so */
+    bool reserve(size_t bytes) noexcept {
+        if (room() < bytes && begin_ > 0) {
+            std::memmove(data_, data_ + begin_, end_ - begin_);
+            end_ -= begin_;
+            begin_ = 0;
+        }
+        return room() >= bytes;
+    }
+
+private:
+    size_t begin_ = 0;
+    size_t end_ = 0;
+    alignas(64) char data_[Capacity];
+};
+
+/**
+ * @brief One venue connection's settings
+ */
+struct SessionConfig {
+    OrderLifecycleManager::VenueType venue = OrderLifecycleManager::VenueType::PRIMARY_DEALER;
+    SessionProtocol protocol = SessionProtocol::FIX44;
+    SessionIdentity identity;
+    uint64_t heartbeat_interval_ns = 1000000000;        // Heartbeat after this long without sending; non-zero
+    uint64_t logon_timeout_ns = 2000000000;             // Also bounds the logout handshake
+};
+
+enum class SessionState : uint8_t {
+    IDLE = 0,           // Added, not started
+    LOGGING_ON = 1,     // Logon sent; orders queue until it is answered
+    ACTIVE = 2,         // Orders flow
+    LOGGING_OUT = 3,    // Logout sent; new orders are refused
+    CLOSED = 4,         // Logged out cleanly
+    FAILED = 5          // Logon refused or timed out, peer silent, or connection lost
+};
+
+/**
+ * @brief Per-session counters (loop thread)
+ */
+struct SessionStats {
+    uint64_t messages_sent = 0;
+    uint64_t messages_received = 0;
+    uint64_t bytes_sent = 0;
+    uint64_t send_calls = 0;            // At most one per poll_once(), however many messages
+    uint64_t heartbeats_sent = 0;
+    uint64_t sequence_gaps = 0;         // Inbound sequence numbers skipped
+    uint64_t malformed = 0;
+    uint64_t rejected_offline = 0;      // Requests answered SESSION_DOWN
+    uint64_t reports_dropped = 0;       // Report ring full
+};
+
+class SessionEventLoop;
+
+/**
+ * @brief One order-entry connection to a venue, driven by a SessionEventLoop
+ *
+ * The session protocol (logon, heartbeats, logout, execution reports)
+ * is a coroutine, run(), whose frame comes from the loop's
+ * CoroutineFramePool. It suspends in co_await next_message(deadline)
+ * and the loop resumes it when a message is decoded, the deadline
+ * passes, or the connection drops, so protocol timing reads as straight
+ * line code and an idle session costs nothing but a deadline compare.
+ *
+ * Orders do not go through the coroutine: the OMS thread pushes
+ * NEW_ORDER / CANCEL_REQUEST messages into requests() (an SPSC ring),
+ * and the loop encodes them straight into the session's send buffer.
+ * Everything encoded in one poll_once() leaves in one send() call.
+ * Execution reports go to the loop's report ring, stamped with the
+ * session's venue.
+ *
+ * Everything but requests() and state() belongs to the loop thread.
+ */
+class OrderEntrySession {
+public:
+    static constexpr size_t SEND_BUFFER_SIZE = 64 * 1024;
+    static constexpr size_t RECV_BUFFER_SIZE = 64 * 1024;
+    static constexpr size_t REQUEST_RING_SIZE = 1024;
+    using RequestRing = SPSCRingBuffer<SessionMessage, REQUEST_RING_SIZE>;
+
+    OrderEntrySession(SessionEventLoop& loop, const SessionConfig& config, int fd) noexcept
+        : loop_(loop), config_(config), fd_(fd) {}
+
+    ~OrderEntrySession() {
+        task_.reset();
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    OrderEntrySession(const OrderEntrySession&) = delete;
+    OrderEntrySession& operator=(const OrderEntrySession&) = delete;
+
+    /** @brief OMS -> session orders and cancels (single producer) */
+    [[nodiscard]] RequestRing& requests() noexcept { return requests_; }
+
+    [[nodiscard]] SessionState state() const noexcept { return state_.load(std::memory_order_acquire); }
+    [[nodiscard]] const SessionConfig& config() const noexcept { return config_; }
+    [[nodiscard]] const SessionStats& stats() const noexcept { return stats_; }
+    [[nodiscard]] bool connected() const noexcept { return fd_ >= 0; }
+
+    /** @brief Pool the protocol coroutine's frame comes from */
+    [[nodiscard]] CoroutineFramePool& frame_pool() noexcept;
+
+    /** @brief Log out at the next poll (loop thread) */
+    void request_logout() noexcept { logout_requested_ = true; }
+
+private:
+    friend class SessionEventLoop;
+
+    struct MessageAwaiter {
+        OrderEntrySession& session;
+        uint64_t deadline_ns;
+
+        bool await_ready() noexcept { return session.wakeable(deadline_ns); }
+        void await_suspend(std::coroutine_handle<>) noexcept { session.deadline_ns_ = deadline_ns; }
+        /** @return The message (valid until the next co_await), or nullptr on deadline/wake/disconnect */
+        const SessionMessage* await_resume() noexcept {
+            if (!session.has_message_) return nullptr;
+            session.has_message_ = false;
+            return &session.inbound_;
+        }
+    };
+
+    Task run() noexcept;
+
+    MessageAwaiter next_message(uint64_t deadline_ns) noexcept { return MessageAwaiter{*this, deadline_ns}; }
+
+    // Resume condition: a message is ready, the deadline passed, or the run() loop has work
+    bool wakeable(uint64_t deadline_ns) noexcept {
+        if (!has_message_) has_message_ = take_message();
+        return has_message_ || fd_ < 0 || now_ns_ >= deadline_ns ||
+               (logout_requested_ && state() == SessionState::ACTIVE);
+    }
+
+    bool take_message() noexcept;
+    void read_socket() noexcept;
+    size_t pump(uint64_t now_ns) noexcept;
+    size_t drain_requests() noexcept;
+    bool flush() noexcept;
+    bool send(SessionMessage& msg) noexcept;
+    void publish(const SessionMessage& report) noexcept;
+    void close(SessionState final_state) noexcept;
+    void disconnect() noexcept;
+
+    SessionEventLoop& loop_;
+    SessionConfig config_;
+    int fd_;
+    std::atomic<SessionState> state_{SessionState::IDLE};
+    bool logout_requested_ = false;
+    bool has_message_ = false;
+    Task task_;
+    uint64_t now_ns_ = 0;
+    uint64_t deadline_ns_ = 0;
+    uint64_t last_send_ns_ = 0;
+    uint64_t last_recv_ns_ = 0;
+    uint32_t next_out_seq_ = 1;
+    uint32_t expected_in_seq_ = 1;
+    SessionStats stats_;
+    SessionMessage inbound_;
+    alignas(64) RequestRing requests_;
+    SessionBuffer<SEND_BUFFER_SIZE> send_;
+    SessionBuffer<RECV_BUFFER_SIZE> recv_;
+};
+
+/**
+ * @brief Drives every venue session of the process from one thread
+ *
+ * Each poll_once():
+ * 1. One epoll_wait(0) finds the readable connections; each gets one recv()
+ * 2. Every session's coroutine is resumed for each decoded message or
+ *    expired deadline, then its queued orders are encoded
+ * 3. Every session with pending bytes gets one send()
+ *
+ * Step 3 is the batching point: however many orders, cancels and
+ * heartbeats a poll produced for a venue, they cost one syscall. Nothing
+ * in the loop blocks, so run() busy-polls on its (pinned) core.
+ *
+ * Sessions are added during setup, before the loop is polled.
+ */
+class SessionEventLoop {
+public:
+    static constexpr size_t MAX_SESSIONS = 64;
+    static constexpr size_t REPORT_RING_SIZE = 8192;
+    static constexpr size_t FRAME_BLOCK_SIZE = 1024;    // Per protocol coroutine, pool header included
+    using ReportRing = SPSCRingBuffer<SessionMessage, REPORT_RING_SIZE>;
+
+    SessionEventLoop() noexcept
+        : epoll_fd_(::epoll_create1(EPOLL_CLOEXEC)), frame_pool_(MAX_SESSIONS, FRAME_BLOCK_SIZE) {
+        venue_sessions_.fill(NO_SESSION);
+        timespec wall{};
+        ::clock_gettime(CLOCK_REALTIME, &wall);
+        wall_offset_ns_ = static_cast<int64_t>(wall.tv_sec) * 1000000000 + wall.tv_nsec -
+                          static_cast<int64_t>(HFTTimer::get_timestamp_ns());
+    }
+
+    ~SessionEventLoop() {
+        for (auto& session : sessions_) session.reset();  // Frames go back before the pool does
+        if (epoll_fd_ >= 0) ::close(epoll_fd_);
+    }
+
+    SessionEventLoop(const SessionEventLoop&) = delete;
+    SessionEventLoop& operator=(const SessionEventLoop&) = delete;
+
+    /**
+     * @brief Take over a connected socket as the session for config.venue
+     * @return The session, or nullptr if the venue already has one, the
+     *         loop is full, the config has no heartbeat interval (the
+     *         session would never sleep) or the socket cannot be watched
+     *         (fd is not closed)
+     */
+    OrderEntrySession* add_session(const SessionConfig& config, int fd) noexcept {
+        const auto venue = static_cast<size_t>(config.venue);
+        if (epoll_fd_ < 0 || fd < 0 || config.heartbeat_interval_ns == 0 || session_count_ == MAX_SESSIONS ||
+            venue >= venue_sessions_.size() || venue_sessions_[venue] != NO_SESSION) {
+            return nullptr;
+        }
+        const int flags = ::fcntl(fd, F_GETFL, 0);
+        if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) return nullptr;
+        const int one = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));  // Fails harmlessly off TCP
+
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.u32 = static_cast<uint32_t>(session_count_);
+        if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0) return nullptr;
+
+        auto session = std::make_unique<OrderEntrySession>(*this, config, fd);
+        OrderEntrySession* added = session.get();
+        venue_sessions_[venue] = static_cast<uint8_t>(session_count_);
+        sessions_[session_count_++] = std::move(session);
+        return added;
+    }
+
+    /** @brief The session orders for a venue go to (nullptr if none) */
+    [[nodiscard]] OrderEntrySession* session_for(OrderLifecycleManager::VenueType venue) noexcept {
+        const auto index = static_cast<size_t>(venue);
+        return index < venue_sessions_.size() && venue_sessions_[index] != NO_SESSION
+                   ? sessions_[venue_sessions_[index]].get()
+                   : nullptr;
+    }
+
+    [[nodiscard]] size_t session_count() const noexcept { return session_count_; }
+    [[nodiscard]] OrderEntrySession& session(size_t index) noexcept { return *sessions_[index]; }
+
+    /**
+     * @brief One pass over every connection; never blocks
+     * @param now_ns HFTTimer::get_timestamp_ns() clock
+     * @return Work done (reads, protocol steps, orders, sends); 0 when idle
+     */
+    size_t poll_once(uint64_t now_ns) noexcept {
+        size_t work = 0;
+        epoll_event events[MAX_SESSIONS];
+        const int ready = ::epoll_wait(epoll_fd_, events, static_cast<int>(MAX_SESSIONS), 0);
+        for (int i = 0; i < ready; ++i) {
+            sessions_[events[i].data.u32]->read_socket();
+            ++work;
+        }
+        for (size_t i = 0; i < session_count_; ++i) {
+            work += sessions_[i]->pump(now_ns);
+            work += sessions_[i]->drain_requests();
+        }
+        for (size_t i = 0; i < session_count_; ++i) {
+            work += sessions_[i]->flush() ? 1 : 0;
+        }
+        return work;
+    }
+
+    /** @brief Busy-poll until stop() returns true, e.g. a ThreadTopology stage's stop_requested() */
+    template<typename StopFn>
+    void run(StopFn&& stop) noexcept {
+        while (!stop()) {
+            poll_once(HFTTimer::get_timestamp_ns());
+        }
+    }
+
+    /** @brief Ask every session to log out (loop thread) */
+    void request_logout() noexcept {
+        for (size_t i = 0; i < session_count_; ++i) sessions_[i]->request_logout();
+    }
+
+    /** @brief No session can send any more (all CLOSED or FAILED) */
+    [[nodiscard]] bool finished() const noexcept {
+        for (size_t i = 0; i < session_count_; ++i) {
+            const SessionState state = sessions_[i]->state();
+            if (state != SessionState::CLOSED && state != SessionState::FAILED) return false;
+        }
+        return true;
+    }
+
+    /** @brief Session -> OMS execution reports (single consumer, e.g. OrderEntryGateway) */
+    [[nodiscard]] ReportRing& reports() noexcept { return reports_; }
+
+    [[nodiscard]] CoroutineFramePool& frame_pool() noexcept { return frame_pool_; }
+
+    /** @brief Wall-clock time for a loop timestamp (FIX SendingTime) */
+    [[nodiscard]] uint64_t wall_clock_ns(uint64_t now_ns) const noexcept {
+        return static_cast<uint64_t>(static_cast<int64_t>(now_ns) + wall_offset_ns_);
+    }
+
+private:
+    friend class OrderEntrySession;
+
+    static constexpr uint8_t NO_SESSION = UINT8_MAX;
+    static_assert(MAX_SESSIONS < NO_SESSION, "Session indices must fit the venue table");
+
+    void unwatch(int fd) noexcept { ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr); }
+
+    int epoll_fd_;
+    CoroutineFramePool frame_pool_;
+    std::array<std::unique_ptr<OrderEntrySession>, MAX_SESSIONS> sessions_;
+    size_t session_count_ = 0;
+    std::array<uint8_t, config::SystemTraits::MAX_VENUES> venue_sessions_;
+    int64_t wall_offset_ns_ = 0;
+    alignas(64) ReportRing reports_;
+};
+
+inline CoroutineFramePool& OrderEntrySession::frame_pool() noexcept { return loop_.frame_pool(); }
+
+inline Task OrderEntrySession::run() noexcept {
+    const uint64_t heartbeat_ns = config_.heartbeat_interval_ns;
+    state_.store(SessionState::LOGGING_ON, std::memory_order_release);
+    last_recv_ns_ = now_ns_;
+
+    SessionMessage logon;
+    logon.type = SessionMsgType::LOGON;
+    logon.heartbeat_s = static_cast<uint16_t>(std::clamp<uint64_t>(heartbeat_ns / 1000000000, 1, UINT16_MAX));
+    send(logon);
+    const SessionMessage* reply = co_await next_message(now_ns_ + config_.logon_timeout_ns);
+    if (reply == nullptr || reply->type != SessionMsgType::LOGON) {
+        close(SessionState::FAILED);
+        co_return;
+    }
+    state_.store(SessionState::ACTIVE, std::memory_order_release);
+
+    uint64_t logout_deadline_ns = UINT64_MAX;
+    while (fd_ >= 0) {
+        // Heartbeat when we have been quiet, give up when the venue has been
+        const uint64_t deadline = std::min({last_send_ns_ + heartbeat_ns, last_recv_ns_ + 2 * heartbeat_ns + 1,
+                                            logout_deadline_ns});
+        const SessionMessage* msg = co_await next_message(deadline);
+
+        if (logout_requested_ && state() == SessionState::ACTIVE) {
+            state_.store(SessionState::LOGGING_OUT, std::memory_order_release);
+            SessionMessage logout;
+            logout.type = SessionMsgType::LOGOUT;
+            send(logout);
+            logout_deadline_ns = now_ns_ + config_.logon_timeout_ns;
+        }
+        if (msg == nullptr) {
+            if (fd_ < 0 || now_ns_ >= logout_deadline_ns || now_ns_ > last_recv_ns_ + 2 * heartbeat_ns) break;
+            if (now_ns_ >= last_send_ns_ + heartbeat_ns) {
+                SessionMessage heartbeat;
+                heartbeat.type = SessionMsgType::HEARTBEAT;
+                send(heartbeat);
+                ++stats_.heartbeats_sent;
+            }
+            continue;
+        }
+
+        switch (msg->type) {
+            case SessionMsgType::EXECUTION_REPORT:
+                publish(*msg);
+                break;
+            case SessionMsgType::TEST_REQUEST: {
+                SessionMessage heartbeat;
+                heartbeat.type = SessionMsgType::HEARTBEAT;
+                std::memcpy(heartbeat.test_req_id, msg->test_req_id, sizeof(heartbeat.test_req_id));
+                send(heartbeat);
+                ++stats_.heartbeats_sent;
+                break;
+            }
+            case SessionMsgType::LOGOUT:
+                if (state() == SessionState::ACTIVE) {  // Venue-initiated: confirm
+                    SessionMessage logout;
+                    logout.type = SessionMsgType::LOGOUT;
+                    send(logout);
+                }
+                close(SessionState::CLOSED);
+                co_return;
+            default:
+                break;
+        }
+    }
+    close(SessionState::FAILED);
+}
+
+inline bool OrderEntrySession::take_message() noexcept {
+    if (recv_.size() == 0) return false;
+    const size_t used = decode_session_message(config_.protocol, recv_.data(), recv_.size(), inbound_);
+    if (used == 0) return false;
+    if (used == FixCodec::MALFORMED) {
+        ++stats_.malformed;
+        recv_.consume(recv_.size());
+        disconnect();
+        return false;
+    }
+    recv_.consume(used);
+    ++stats_.messages_received;
+    last_recv_ns_ = now_ns_;
+    if (inbound_.seq_num > expected_in_seq_) ++stats_.sequence_gaps;
+    expected_in_seq_ = inbound_.seq_num + 1;
+    return true;
+}
+
+inline void OrderEntrySession::read_socket() noexcept {
+    if (fd_ < 0) return;
+    recv_.reserve(RECV_BUFFER_SIZE / 2);
+    if (recv_.room() == 0) return;  // Coroutine is behind; epoll reports the socket again
+    const ssize_t received = ::recv(fd_, recv_.tail(), recv_.room(), MSG_DONTWAIT);
+    if (received > 0) {
+        recv_.commit(static_cast<size_t>(received));
+    } else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+        disconnect();
+    }
+}
+
+inline size_t OrderEntrySession::pump(uint64_t now_ns) noexcept {
+    now_ns_ = now_ns;
+    size_t steps = 0;
+    if (state() == SessionState::IDLE) {
+        task_ = run();
+        if (!task_.valid()) {  // Frame pool exhausted
+            close(SessionState::FAILED);
+            return 0;
+        }
+    }
+    while (!task_.done() && wakeable(deadline_ns_)) {
+        task_.resume();
+        ++steps;
+    }
+    if (task_.valid() && task_.done()) task_.reset();
+    return steps;
+}
+
+inline size_t OrderEntrySession::drain_requests() noexcept {
+    size_t handled = 0;
+    SessionMessage request;
+    const SessionState current = state();
+    if (current == SessionState::ACTIVE) {
+        while (send_.reserve(MAX_SESSION_MESSAGE_SIZE) && requests_.try_pop(request)) {
+            send(request);
+            ++handled;
+        }
+    } else if (current != SessionState::IDLE && current != SessionState::LOGGING_ON) {
+        // Refuse rather than hold orders for a session that will not come back
+        while (requests_.try_pop(request)) {
+            SessionMessage report;
+            report.type = SessionMsgType::EXECUTION_REPORT;
+            report.exec_type = request.type == SessionMsgType::CANCEL_REQUEST ? ExecType::CANCEL_REJECTED
+                                                                              : ExecType::REJECTED;
+            report.reject_reason = SessionRejectReason::SESSION_DOWN;
+            report.cl_ord_id = request.cl_ord_id;
+            report.security_id = request.security_id;
+            report.side = request.side;
+            publish(report);
+            ++stats_.rejected_offline;
+            ++handled;
+        }
+    }
+    return handled;
+}
+
+inline bool OrderEntrySession::flush() noexcept {
+    if (fd_ < 0 || send_.size() == 0) return false;
+    const ssize_t sent = ::send(fd_, send_.data(), send_.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+    ++stats_.send_calls;
+    if (sent > 0) {
+        stats_.bytes_sent += static_cast<uint64_t>(sent);
+        send_.consume(static_cast<size_t>(sent));
+        return true;
+    }
+    if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) disconnect();
+    return false;
+}
+
+inline bool OrderEntrySession::send(SessionMessage& msg) noexcept {
+    if (!send_.reserve(MAX_SESSION_MESSAGE_SIZE)) {
+        flush();  // Socket behind: push some out now rather than drop an admin message
+        if (!send_.reserve(MAX_SESSION_MESSAGE_SIZE)) return false;
+    }
+    msg.seq_num = next_out_seq_;
+    const size_t written = encode_session_message(config_.protocol, send_.tail(), send_.room(), msg,
+                                                  config_.identity, loop_.wall_clock_ns(now_ns_));
+    send_.commit(written);
+    ++next_out_seq_;
+    ++stats_.messages_sent;
+    last_send_ns_ = now_ns_;
+    return true;
+}
+
+inline void OrderEntrySession::publish(const SessionMessage& report) noexcept {
+    SessionMessage stamped = report;
+    stamped.venue = config_.venue;
+    if (!loop_.reports().try_push(stamped)) ++stats_.reports_dropped;
+}
+
+inline void OrderEntrySession::close(SessionState final_state) noexcept {
+    state_.store(final_state, std::memory_order_release);
+    flush();  // Last words (a logout) go out before the socket closes
+    disconnect();
+}
+
+inline void OrderEntrySession::disconnect() noexcept {
+    if (fd_ < 0) return;
+    loop_.unwatch(fd_);
+    ::close(fd_);
+    fd_ = -1;
+}
+
+/**
+ * @brief OMS-side end of the session layer
+ *
+ * Sends OrderLifecycleManager orders to the session of their
+ * target_venue and applies the loop's execution reports back to the
+ * manager: acks, rejects (including SESSION_DOWN refusals), cancel
+ * confirms/refusals and fills. A report that leaves the order terminal
+ * (filled, cancelled, rejected, expired) also retires it, so its ID goes
+ * stale and the slot is free for a new order. Lives on the thread that owns the
+ * manager; the sessions run on the loop's thread, and the two only
+ * meet in the SPSC rings.
+ */
+class OrderEntryGateway {
+public:
+    OrderEntryGateway(OrderLifecycleManager& orders, SessionEventLoop& loop) noexcept
+        : orders_(orders), loop_(loop) {}
+
+    /**
+     * @brief Queue a created (or routed) order for its venue; it becomes PENDING_NEW
+     * @return false if the ID is stale, the order was already sent, its venue
+     *         has no session, or the session's request ring is full
+     */
+    bool send_order(uint64_t order_id) noexcept {
+        const auto* order = orders_.get_order(order_id);
+        if (order == nullptr || (order->state != OrderLifecycleManager::OrderState::VALIDATED &&
+                                 order->state != OrderLifecycleManager::OrderState::ROUTED)) {
+            return false;
+        }
+        OrderEntrySession* session = loop_.session_for(order->target_venue);
+        if (session == nullptr) return false;
+
+        SessionMessage request;
+        request.type = SessionMsgType::NEW_ORDER;
+        request.cl_ord_id = order_id;
+        request.security_id = config::Instruments::primary_id(order->instrument);
+        request.side = order->side;
+        request.ord_type = order->type;
+        request.time_in_force = order->time_in_force;
+        request.price_64ths = to_64ths(order->order_price);
+        request.quantity = order->leaves_quantity;
+        if (!session->requests().try_push(request)) return false;
+        return orders_.mark_sent(order_id);
+    }
+
+    /**
+     * @brief Request a cancel from the order's venue; it becomes PENDING_CANCEL
+     * @return false if the manager refuses the cancel or it cannot be queued
+     */
+    bool send_cancel(uint64_t order_id) noexcept {
+        const auto* order = orders_.get_order(order_id);
+        if (order == nullptr) return false;
+        OrderEntrySession* session = loop_.session_for(order->target_venue);
+        if (session == nullptr || !orders_.cancel_order(order_id)) return false;
+
+        SessionMessage request;
+        request.type = SessionMsgType::CANCEL_REQUEST;
+        request.cl_ord_id = order_id;
+        request.security_id = config::Instruments::primary_id(order->instrument);
+        request.side = order->side;
+        if (!session->requests().try_push(request)) {
+            orders_.process_cancel_reject(order_id);  // As if the venue had refused it
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Apply queued execution reports to the manager
+     * @return Reports applied (reports for stale IDs are consumed, not counted)
+     */
+    size_t apply_reports(size_t max_reports = SIZE_MAX) noexcept {
+        size_t applied = 0;
+        SessionMessage report;
+        for (size_t n = 0; n < max_reports && loop_.reports().try_pop(report); ++n) {
+            applied += apply(report) ? 1 : 0;
+        }
+        return applied;
+    }
+
+private:
+    bool apply(const SessionMessage& report) noexcept {
+        if (!transition(report)) return false;
+        (void)orders_.retire_order(report.cl_ord_id);  // No-op unless the report was final
+        return true;
+    }
+
+    bool transition(const SessionMessage& report) noexcept {
+        switch (report.exec_type) {
+            case ExecType::NEW: return orders_.process_ack(report.cl_ord_id);
+            case ExecType::REJECTED: return orders_.process_reject(report.cl_ord_id);
+            case ExecType::CANCELED: return orders_.process_cancel_ack(report.cl_ord_id);
+            case ExecType::CANCEL_REJECTED: return orders_.process_cancel_reject(report.cl_ord_id);
+            case ExecType::EXPIRED: return orders_.process_expire(report.cl_ord_id);
+            case ExecType::TRADE: {
+                OrderLifecycleManager::OrderExecution execution;
+                execution.order_id = report.cl_ord_id;
+                execution.execution_id = report.exec_id;
+                execution.venue_order_id = report.venue_order_id;
+                execution.venue = report.venue;
+                execution.instrument = config::Instruments::lookup(report.security_id);
+                execution.execution_price = from_64ths(report.last_price_64ths);
+                execution.executed_quantity = report.last_quantity;
+                execution.leaves_quantity = report.leaves_quantity;
+                execution.execution_time_ns = HFTTimer::get_timestamp_ns();
+                return orders_.process_fill(execution);
+            }
+        }
+        return false;
+    }
+
+    OrderLifecycleManager& orders_;
+    SessionEventLoop& loop_;
+};
+
+} // namespace trading
+} // namespace hft
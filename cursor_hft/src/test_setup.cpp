@@ -1,13 +1,22 @@
 // Test file - delete after verification
 #include <iostream>
 #include <chrono>
-#include <arm_neon.h>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
-// ARM64 cycle counter implementation
+// Cycle counter implementation (ARM64 cntvct_el0, x86-64 TSC)
 inline uint64_t read_cycle_counter() {
+#if defined(__aarch64__)
     uint64_t val;
     asm volatile("mrs %0, cntvct_el0" : "=r" (val));
     return val;
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
 }
 
 int main() {
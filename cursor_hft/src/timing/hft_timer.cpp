@@ -1,56 +1,222 @@
 #include "hft/timing/hft_timer.hpp"
-#include <arm_acle.h>
-#include <arm_neon.h>
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <time.h>
+
+#if defined(HFT_TIMER_USE_CLOCK_MONOTONIC)
+#define HFT_TIMER_BACKEND_CLOCK 1
+#elif defined(__aarch64__)
+#define HFT_TIMER_BACKEND_ARM 1
+#elif defined(__x86_64__) || defined(__i386__)
+#define HFT_TIMER_BACKEND_TSC 1
+#include <x86intrin.h>
+#include <cpuid.h>
+#else
+#define HFT_TIMER_BACKEND_CLOCK 1
+#endif
 
 namespace hft {
 
 // Initialize static member with proper alignment
-alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<double> HFTTimer::cycles_per_ns_{0.0};
+alignas(HFTTimer::CACHE_LINE_SIZE) std::atomic<uint64_t> HFTTimer::ns_mult_{0};
+
+namespace {
+
+HFTTimer::ns_t monotonic_raw_ns() noexcept {
+    timespec ts;
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return static_cast<HFTTimer::ns_t>(ts.tv_sec) * 1000000000ULL + static_cast<HFTTimer::ns_t>(ts.tv_nsec);
+}
+
+#if defined(HFT_TIMER_BACKEND_TSC)
+struct CalibrationSample {
+    HFTTimer::cycle_t cycles;
+    HFTTimer::ns_t ns;
+};
+
+// Pair a clock read with the counter, keeping the tightest of several brackets
+CalibrationSample take_sample() noexcept {
+    CalibrationSample best{0, 0};
+    HFTTimer::cycle_t best_width = ~0ULL;
+    for (int i = 0; i < 8; ++i) {
+        const auto c0 = HFTTimer::get_cycles();
+        const auto ns = monotonic_raw_ns();
+        const auto c1 = HFTTimer::get_cycles();
+        if (c1 - c0 < best_width) {
+            best_width = c1 - c0;
+            best = {c0 + (c1 - c0) / 2, ns};
+        }
+    }
+    return best;
+}
+
+double calibrate_cycles_per_ns(HFTTimer::ns_t window_ns = 2000000) noexcept {
+    // Median of a few windows: one preempted window cannot skew the result
+    constexpr int ROUNDS = 3;
+    const HFTTimer::ns_t WINDOW_NS = window_ns;
+    double rates[ROUNDS];
+    for (int r = 0; r < ROUNDS; ++r) {
+        const auto start = take_sample();
+        while (monotonic_raw_ns() - start.ns < WINDOW_NS) {
+            _mm_pause();
+        }
+        const auto end = take_sample();
+        rates[r] = static_cast<double>(end.cycles - start.cycles) / static_cast<double>(end.ns - start.ns);
+    }
+    std::sort(rates, rates + ROUNDS);
+    return rates[ROUNDS / 2];
+}
+#endif
+
+double measure_cycles_per_ns() noexcept {
+#if defined(HFT_TIMER_BACKEND_ARM)
+    uint64_t freq;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(freq));
+    return static_cast<double>(freq) / 1e9;
+#elif defined(HFT_TIMER_BACKEND_TSC)
+    return calibrate_cycles_per_ns();
+#else
+    return 1.0;
+#endif
+}
+
+// Cache file: "hft_timer_calibration <backend> <cycles per ns>"
+constexpr const char* CALIBRATION_TAG = "hft_timer_calibration";
+
+bool load_cached_rate(const char* path, double& rate) noexcept {
+    FILE* file = std::fopen(path, "r");
+    if (file == nullptr) {
+        return false;
+    }
+    char tag[32];
+    unsigned backend = 0;
+    const bool parsed = std::fscanf(file, "%31s %u %lf", tag, &backend, &rate) == 3;
+    std::fclose(file);
+    return parsed && std::string_view(tag) == CALIBRATION_TAG &&
+           backend == static_cast<unsigned>(HFTTimer::backend()) && rate > 0.0 && std::isfinite(rate);
+}
+
+void store_cached_rate(const char* path, double rate) noexcept {
+    // Write aside and rename, so a crash never leaves a torn cache
+    char tmp[4096];
+    if (std::snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= static_cast<int>(sizeof(tmp))) {
+        return;
+    }
+    FILE* file = std::fopen(tmp, "w");
+    if (file == nullptr) {
+        return;
+    }
+    const bool written = std::fprintf(file, "%s %u %.17g\n", CALIBRATION_TAG,
+                                      static_cast<unsigned>(HFTTimer::backend()), rate) > 0;
+    if (std::fclose(file) == 0 && written) {
+        std::rename(tmp, path);
+    } else {
+        std::remove(tmp);
+    }
+}
+
+} // namespace
+
+HFTTimer::CalibrationSource HFTTimer::calibrate(const char* cache_path) noexcept {
+#if defined(HFT_TIMER_BACKEND_TSC)
+    double rate = 0.0;
+    CalibrationSource source = CalibrationSource::Measured;
+    if (cache_path != nullptr && load_cached_rate(cache_path, rate) &&
+        std::abs(calibrate_cycles_per_ns(200000) / rate - 1.0) < 0.002) {
+        source = CalibrationSource::Cached;
+    } else {
+        rate = calibrate_cycles_per_ns();
+        if (cache_path != nullptr) {
+            store_cached_rate(cache_path, rate);
+        }
+    }
+    ns_mult_.store(std::max<uint64_t>(static_cast<uint64_t>(std::ldexp(1.0 / rate, NS_SHIFT)), 1),
+                   std::memory_order_release);
+    return source;
+#else
+    (void)cache_path;
+    initialize();
+    return CalibrationSource::Fixed;
+#endif
+}
 
-// Initialize the timer system by calibrating cycles_per_ns_
+// Initialize the timer system by calibrating the ns conversion factor
 void HFTTimer::initialize() noexcept {
-    if (cycles_per_ns_.load(std::memory_order_relaxed) > 0.0) {
+    if (ns_mult_.load(std::memory_order_relaxed) != 0) {
         return; // Already initialized
     }
 
-    // Calibrate using high-resolution system clock
-    const auto start_sys = std::chrono::steady_clock::now();
-    const auto start_cycles = get_cycles();
-    
-    // Wait for a significant number of cycles to pass
-    constexpr uint64_t CALIBRATION_CYCLES = 1000000;
-    while (get_cycles() - start_cycles < CALIBRATION_CYCLES) {
-        __builtin_arm_dmb(0xF); // Full memory barrier
-    }
-    
-    const auto end_sys = std::chrono::steady_clock::now();
-    const auto end_cycles = get_cycles();
-    
-    const auto sys_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
-        end_sys - start_sys).count();
-    const auto cycles = end_cycles - start_cycles;
-    
-    cycles_per_ns_.store(static_cast<double>(cycles) / sys_ns,
-                        std::memory_order_release);
+    const double rate = measure_cycles_per_ns();
+    const auto mult = static_cast<uint64_t>(std::ldexp(1.0 / rate, NS_SHIFT));
+    uint64_t expected = 0;
+    ns_mult_.compare_exchange_strong(expected, std::max<uint64_t>(mult, 1), std::memory_order_acq_rel);
 }
 
 HFTTimer::cycle_t HFTTimer::get_cycles() noexcept {
+#if defined(HFT_TIMER_BACKEND_ARM)
     uint64_t cycles;
     __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(cycles));
     return cycles;
+#elif defined(HFT_TIMER_BACKEND_TSC)
+#if defined(HFT_TIMER_USE_RDTSCP)
+    unsigned int aux;
+    return __rdtscp(&aux);
+#else
+    // lfence keeps rdtsc from executing ahead of earlier instructions
+    _mm_lfence();
+    return __rdtsc();
+#endif
+#else
+    return monotonic_raw_ns();
+#endif
 }
 
 HFTTimer::ns_t HFTTimer::cycles_to_ns(cycle_t cycles) noexcept {
-    initialize();
-    return static_cast<ns_t>(cycles / cycles_per_ns_.load(std::memory_order_acquire));
+    uint64_t mult = ns_mult_.load(std::memory_order_acquire);
+    if (__builtin_expect(mult == 0, 0)) {
+        initialize();
+        mult = ns_mult_.load(std::memory_order_acquire);
+    }
+    return static_cast<ns_t>((static_cast<unsigned __int128>(cycles) * mult) >> NS_SHIFT);
 }
 
 HFTTimer::ns_t HFTTimer::get_timestamp_ns() noexcept {
     return cycles_to_ns(get_cycles());
 }
 
+HFTTimer::Backend HFTTimer::backend() noexcept {
+#if defined(HFT_TIMER_BACKEND_ARM)
+    return Backend::ArmVirtualCounter;
+#elif defined(HFT_TIMER_BACKEND_TSC)
+    return Backend::X86Tsc;
+#else
+    return Backend::ClockMonotonic;
+#endif
+}
+
+bool HFTTimer::invariant_tsc() noexcept {
+#if defined(HFT_TIMER_BACKEND_TSC)
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007) {
+        return false;
+    }
+    __cpuid(0x80000007, eax, ebx, ecx, edx);
+    return (edx & (1u << 8)) != 0;
+#else
+    return true;
+#endif
+}
+
+double HFTTimer::cycles_per_ns() noexcept {
+    initialize();
+    return std::ldexp(1.0, NS_SHIFT) / static_cast<double>(ns_mult_.load(std::memory_order_acquire));
+}
+
 // ScopedTimer implementation
 HFTTimer::ScopedTimer::ScopedTimer(LatencyHistogram& histogram, std::string_view name) noexcept
     : histogram_(histogram)
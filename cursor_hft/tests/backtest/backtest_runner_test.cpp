@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include "hft/backtest/backtest_runner.hpp"
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace hft::backtest;
+using namespace hft::market_data;
+using hft::WorkStealingPool;
+
+namespace {
+
+uint16_t compute_checksum(const RawMarketMessage& msg) {
+    uint16_t sum = 0;
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&msg);
+    for (size_t i = 0; i < offsetof(RawMarketMessage, checksum); ++i) sum ^= ptr[i];
+    return sum;
+}
+
+RawMarketMessage make_message(MessageType type, uint64_t seq, uint64_t ts, uint32_t instrument_id,
+                              double price0, double price1, uint64_t size0, uint64_t size1) {
+    RawMarketMessage msg{};
+    msg.sequence_number = seq;
+    msg.timestamp_exchange_ns = ts;
+    msg.message_type = static_cast<uint32_t>(type);
+    msg.instrument_id = instrument_id;
+    std::memcpy(msg.raw_data, &price0, sizeof(double));
+    std::memcpy(msg.raw_data + 8, type == MessageType::Tick ? static_cast<const void*>(&price1)
+                                                            : static_cast<const void*>(&size0), 8);
+    if (type == MessageType::Tick) {
+        std::memcpy(msg.raw_data + 16, &size0, sizeof(uint64_t));
+        std::memcpy(msg.raw_data + 24, &size1, sizeof(uint64_t));
+    }
+    msg.checksum = compute_checksum(msg);
+    return msg;
+}
+
+class BacktestRunnerTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        for (const auto& path : paths_) {
+            for (uint32_t i = 0; ::unlink(detail::capture_segment_path(path, i).c_str()) == 0; ++i) {
+            }
+        }
+    }
+
+    std::string path_for(const std::string& day) {
+        paths_.push_back("/tmp/hft_backtest_test_" + std::to_string(::getpid()) + "_" +
+                         ::testing::UnitTest::GetInstance()->current_test_info()->name() + "_" + day);
+        return paths_.back();
+    }
+
+    // Every instrument: a quote each millisecond on a random walk, and a trade
+    // through the touch every third quote, alternating sides
+    std::string write_day(const std::string& day, uint64_t seed, size_t quotes_per_instrument) {
+        const std::string path = path_for(day);
+        auto writer = std::make_unique<CaptureWriter>();
+        EXPECT_TRUE(writer->open(path));
+        uint64_t seq = 1;
+        uint64_t state = seed;
+        double mids[6];
+        for (size_t i = 0; i < 6; ++i) mids[i] = 99.0 + static_cast<double>(i) / 4.0;
+        for (size_t q = 0; q < quotes_per_instrument; ++q) {
+            const uint64_t ts = 1'000'000'000ULL + q * 1'000'000ULL;
+            for (uint32_t id = 1; id <= 6; ++id) {
+                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                const int step = static_cast<int>(state >> 62) - 1;  // -1, 0, +1, +2 (drifts up)
+                double& mid = mids[id - 1];
+                mid += (step > 1 ? 0 : step) / 32.0;
+                const double bid = mid - 1.0 / 64.0;
+                const double ask = mid + 1.0 / 64.0;
+                EXPECT_TRUE(writer->append(make_message(MessageType::Tick, seq++, ts + id, id, bid, ask,
+                                                        5'000'000, 5'000'000), ts + id));
+                if (q % 3 == 2) {
+                    const double price = (q / 3) % 2 == 0 ? bid : ask;
+                    EXPECT_TRUE(writer->append(make_message(MessageType::Trade, seq++, ts + 500'000 + id, id,
+                                                            price, 0, 20'000'000, 0), ts + 500'000 + id));
+                }
+            }
+        }
+        EXPECT_TRUE(writer->close());
+        return path;
+    }
+
+    static BacktestConfig base_config(std::vector<std::string> days) {
+        BacktestConfig config;
+        config.days = std::move(days);
+        config.seed = 7;
+        return config;
+    }
+
+    static void expect_same(const BacktestStats& a, const BacktestStats& b) {
+        EXPECT_DOUBLE_EQ(a.cash, b.cash);
+        EXPECT_DOUBLE_EQ(a.pnl, b.pnl);
+        EXPECT_EQ(a.positions, b.positions);
+        EXPECT_EQ(a.ticks, b.ticks);
+        EXPECT_EQ(a.trades, b.trades);
+        EXPECT_EQ(a.orders_submitted, b.orders_submitted);
+        EXPECT_EQ(a.risk_rejects, b.risk_rejects);
+        EXPECT_EQ(a.cancels, b.cancels);
+        EXPECT_EQ(a.fills, b.fills);
+        EXPECT_EQ(a.filled_quantity, b.filled_quantity);
+        EXPECT_EQ(a.ack_latency.total_samples(), b.ack_latency.total_samples());
+        EXPECT_EQ(a.ack_latency.value_at_percentile(99.0), b.ack_latency.value_at_percentile(99.0));
+    }
+
+    std::vector<std::string> paths_;
+};
+
+} // namespace
+
+TEST_F(BacktestRunnerTest, RunsDaysAndMergesTotals) {
+    BacktestRunner runner(base_config({write_day("d1", 1, 600), write_day("d2", 2, 600)}));
+    ASSERT_EQ(runner.shards().size(), 2u);
+
+    WorkStealingPool pool(2);
+    const BacktestReport report = runner.run(pool);
+    ASSERT_EQ(report.shards.size(), 2u);
+    EXPECT_EQ(report.failed_shards, 0u);
+    EXPECT_EQ(report.lanes, 2u);
+
+    BacktestStats sum;
+    for (const auto& shard : report.shards) {
+        ASSERT_TRUE(shard.completed);
+        EXPECT_EQ(shard.stats.ticks, 6u * 600);
+        EXPECT_EQ(shard.stats.trades, 6u * 200);
+        EXPECT_GT(shard.stats.orders_submitted, 0u);
+        EXPECT_GT(shard.stats.fills, 0u);
+        EXPECT_EQ(shard.stats.ack_latency.total_samples(), shard.stats.orders_submitted - shard.stats.venue_rejects);
+        EXPECT_EQ(shard.stats.decision_latency.total_samples(), shard.stats.ticks);
+        sum.merge(shard.stats);
+    }
+    expect_same(report.total, sum);
+    ASSERT_EQ(report.by_params.size(), 1u);
+    expect_same(report.by_params[0], sum);
+}
+
+TEST_F(BacktestRunnerTest, ResultsIndependentOfScheduling) {
+    BacktestConfig config = base_config({write_day("d1", 3, 300), write_day("d2", 4, 300)});
+    config.shard_by_instrument = true;
+    BacktestRunner runner(config);
+    ASSERT_EQ(runner.shards().size(), 12u);
+
+    WorkStealingPool serial(1);
+    WorkStealingPool parallel(3);
+    const BacktestReport a = runner.run(serial);
+    const BacktestReport b = runner.run(parallel);
+    ASSERT_EQ(a.shards.size(), b.shards.size());
+    for (size_t i = 0; i < a.shards.size(); ++i) {
+        EXPECT_EQ(a.shards[i].spec.instrument_mask, b.shards[i].spec.instrument_mask);
+        expect_same(a.shards[i].stats, b.shards[i].stats);
+    }
+    expect_same(a.total, b.total);
+
+    // Each instrument shard trades only its own instrument
+    for (const auto& shard : a.shards) {
+        for (size_t inst = 0; inst < INSTRUMENT_COUNT; ++inst) {
+            if (!(shard.spec.instrument_mask >> inst & 1u)) EXPECT_EQ(shard.stats.positions[inst], 0);
+        }
+        EXPECT_EQ(shard.stats.ticks, 300u);
+    }
+}
+
+TEST_F(BacktestRunnerTest, ParameterSweep) {
+    BacktestConfig config = base_config({write_day("d1", 5, 600)});
+    AdvancedMarketMaker::SpreadParameters tight;
+    AdvancedMarketMaker::SpreadParameters wide;
+    wide.base_spread_bps *= 20.0;
+    wide.minimum_spread_bps *= 20.0;
+    wide.maximum_spread_bps *= 20.0;
+    config.parameter_grid = {tight, wide};
+    BacktestRunner runner(config);
+
+    WorkStealingPool pool(2);
+    const BacktestReport report = runner.run(pool);
+    ASSERT_EQ(report.by_params.size(), 2u);
+    ASSERT_EQ(report.shards.size(), 2u);
+    EXPECT_EQ(report.shards[0].spec.params, 0u);
+    EXPECT_EQ(report.shards[1].spec.params, 1u);
+
+    // Same market data, different quoting: wider quotes fill less
+    EXPECT_EQ(report.by_params[0].ticks, report.by_params[1].ticks);
+    EXPECT_GT(report.by_params[0].filled_quantity, report.by_params[1].filled_quantity);
+}
+
+TEST_F(BacktestRunnerTest, MissingDayFailsItsShardsOnly) {
+    BacktestRunner runner(base_config({write_day("d1", 6, 100), path_for("missing")}));
+    WorkStealingPool pool(2);
+    const BacktestReport report = runner.run(pool);
+    ASSERT_EQ(report.shards.size(), 2u);
+    EXPECT_TRUE(report.shards[0].completed);
+    EXPECT_FALSE(report.shards[1].completed);
+    EXPECT_EQ(report.failed_shards, 1u);
+    EXPECT_EQ(report.total.ticks, report.shards[0].stats.ticks);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// Small-deployment traits for hft_small_deployment_test (selected through
+// HFT_SYSTEM_TRAITS_HEADER / HFT_SYSTEM_TRAITS on that target only)
+
+namespace hft_test {
+
+struct BillsDeskTraits : hft::config::DefaultSystemTraits {
+    static constexpr std::array INSTRUMENTS = {
+        hft::config::InstrumentListing{1, hft::market_data::TreasuryType::Bill_3M},
+        hft::config::InstrumentListing{2, hft::market_data::TreasuryType::Bill_6M},
+        hft::config::InstrumentListing{912796001, hft::market_data::TreasuryType::Bill_6M},  // Off-the-run
+    };
+    static constexpr size_t MAX_INSTRUMENTS = 2;
+    static constexpr bool PARTIAL_UNIVERSE = true;
+    static constexpr size_t MAX_VENUES = 4;
+    static constexpr size_t MAX_ORDERS = 1024;
+    static constexpr size_t ORDER_POOL_SIZE = 256;
+    static constexpr size_t LEVEL_POOL_SIZE = 64;
+    static constexpr size_t UPDATE_RING_SIZE = 512;
+};
+
+} // namespace hft_test
@@ -0,0 +1,63 @@
+// Built with BillsDeskTraits selected (see CMakeLists.txt): the same
+// subsystems shrink to a two-instrument, 256-order footprint
+#include <gtest/gtest.h>
+#include <memory>
+#include "hft/config/system_traits.hpp"
+#include "hft/market_data/feed_handler.hpp"
+#include "hft/trading/book_manager.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+#include "hft/trading/risk_control_system.hpp"
+#include "hft/strategy/quote_manager.hpp"
+#include "hft/market_data/tick_store.hpp"
+
+using namespace hft::trading;
+using namespace hft::market_data;
+
+static_assert(std::is_same_v<hft::config::SystemTraits, hft_test::BillsDeskTraits>);
+static_assert(BookManager::MAX_INSTRUMENTS == 2);
+static_assert(OrderLifecycleManager::MAX_ORDERS == 1024);
+static_assert(RiskControlSystem::MAX_INSTRUMENTS == 2);
+static_assert(hft::strategy::QuoteManager::MAX_INSTRUMENTS == 2);
+static_assert(hft::config::covers_every_treasury_type<hft_test::BillsDeskTraits>());  // Opted in
+
+TEST(SmallDeploymentTest, NormalizerUsesDeploymentUniverse) {
+    EXPECT_EQ(MessageNormalizer::normalize_instrument_id(1), TreasuryType::Bill_3M);
+    EXPECT_EQ(MessageNormalizer::normalize_instrument_id(2), TreasuryType::Bill_6M);
+    EXPECT_EQ(MessageNormalizer::normalize_instrument_id(912796001), TreasuryType::Bill_6M);
+    EXPECT_EQ(MessageNormalizer::normalize_instrument_id(5), TreasuryType::Bill_3M);  // Not on this desk
+}
+
+TEST(SmallDeploymentTest, StructuresShrink) {
+    EXPECT_EQ(TreasuryOrderPool{}.capacity(), 256u);
+    EXPECT_LT(sizeof(BookManager), 256u * 1024);                  // ~2MB with the defaults
+    EXPECT_LT(sizeof(OrderLifecycleManager), 70u * 1024 * 1024);  // 64MB audit trail dominates
+}
+
+TEST(SmallDeploymentTest, InstrumentsOutsideTheUniverseAreRejected) {
+    auto ticks = std::make_unique<MarketTickStore>();
+    ticks->record_price(TreasuryType::Bill_3M, 99.5, 1);
+    ticks->record_price(TreasuryType::Note_10Y, 101.0, 2);  // Slot 4 of 2: dropped, not folded onto Bill_3M
+    EXPECT_EQ(ticks->total_recorded(TreasuryType::Bill_3M), 1u);
+    EXPECT_EQ(ticks->last_mid(TreasuryType::Bill_3M), 99.5);
+    EXPECT_EQ(ticks->columns(TreasuryType::Note_10Y).total, 0u);
+    EXPECT_EQ(ticks->mid_stats(TreasuryType::Note_10Y).count(), 0u);
+
+    hft::strategy::QuoteManager quotes;
+    EXPECT_NE(&quotes.working(TreasuryType::Note_10Y), &quotes.working(TreasuryType::Bill_3M));
+    EXPECT_FALSE(quotes.working(TreasuryType::Note_10Y).bid.live);
+}
+
+TEST(SmallDeploymentTest, OrdersFlowEndToEnd) {
+    auto books = std::make_unique<BookManager>();
+    EXPECT_EQ(books->book(TreasuryType::Bill_6M).max_orders(), 128u);
+    ASSERT_TRUE(books->add_order(TreasuryOrder(1, TreasuryType::Bill_6M, OrderSide::BID, OrderType::LIMIT,
+                                               Price32nd::from_decimal(99.5), 1000000, 1)));
+    EXPECT_EQ(books->total_orders(), 1u);
+
+    auto orders = std::make_unique<OrderLifecycleManager>(books->order_pool(), books->level_pool(),
+                                                          books->update_buffer());
+    const uint64_t id = orders->create_order(TreasuryType::Bill_3M, OrderSide::BID, OrderType::LIMIT,
+                                             Price32nd::from_decimal(99.25), 1000000);
+    EXPECT_NE(id, 0u);
+    EXPECT_TRUE(orders->cancel_order(id));
+}
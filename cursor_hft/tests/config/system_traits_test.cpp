@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "hft/config/system_traits.hpp"
+#include "hft/market_data/feed_handler.hpp"
+#include "hft/trading/book_manager.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+
+using namespace hft::config;
+using hft::market_data::MessageNormalizer;
+using hft::market_data::TreasuryType;
+
+namespace {
+
+// CUSIP-style ids: too sparse for a direct table
+struct SparseTraits : DefaultSystemTraits {
+    static constexpr std::array INSTRUMENTS = {
+        InstrumentListing{912828900, TreasuryType::Note_10Y},
+        InstrumentListing{912810100, TreasuryType::Bond_30Y},
+        InstrumentListing{912828700, TreasuryType::Note_10Y},  // Off-the-run, same slot
+        InstrumentListing{912796400, TreasuryType::Bill_3M},
+    };
+    static constexpr TreasuryType UNLISTED_INSTRUMENT = TreasuryType::Note_2Y;
+};
+
+struct TooFewSlots : DefaultSystemTraits {
+    static constexpr size_t MAX_INSTRUMENTS = 3;  // Bond_30Y is listed
+};
+
+struct OddRing : DefaultSystemTraits {
+    static constexpr size_t UPDATE_RING_SIZE = 1000;
+};
+
+struct NotTraits {
+    static constexpr size_t MAX_INSTRUMENTS = 6;
+};
+
+static_assert(valid_system_traits<DefaultSystemTraits>());
+static_assert(valid_system_traits<SparseTraits>());
+static_assert(!valid_system_traits<TooFewSlots>());
+static_assert(!valid_system_traits<OddRing>());
+static_assert(!SystemTraitsType<NotTraits>);
+static_assert(covers_every_treasury_type<SparseTraits>());
+static_assert(!covers_every_treasury_type<TooFewSlots>());  // Shrinking is opt-in (PARTIAL_UNIVERSE)
+
+// Lookups are usable at compile time
+static_assert(MessageNormalizer::normalize_instrument_id(5) == TreasuryType::Note_10Y);
+static_assert(InstrumentDirectory<SparseTraits>::lookup(912828700) == TreasuryType::Note_10Y);
+
+} // namespace
+
+TEST(SystemTraitsTest, DefaultUniverseMatchesVenueNumbering) {
+    const TreasuryType expected[] = {TreasuryType::Bill_3M, TreasuryType::Bill_6M, TreasuryType::Note_2Y,
+                                     TreasuryType::Note_5Y, TreasuryType::Note_10Y, TreasuryType::Bond_30Y};
+    for (uint32_t id = 1; id <= 6; ++id) {
+        EXPECT_EQ(MessageNormalizer::normalize_instrument_id(id), expected[id - 1]) << id;
+        EXPECT_TRUE(Instruments::listed(id));
+    }
+    // Unlisted ids keep the historical fallback
+    for (uint32_t id : {0u, 7u, 4095u, 4096u, 0xFFFFFFFFu}) {
+        EXPECT_EQ(MessageNormalizer::normalize_instrument_id(id), TreasuryType::Bill_3M) << id;
+        EXPECT_FALSE(Instruments::listed(id));
+    }
+}
+
+TEST(SystemTraitsTest, SparseIdsUseSortedLookup) {
+    using Directory = InstrumentDirectory<SparseTraits>;
+    EXPECT_EQ(Directory::LISTED, 4u);
+    EXPECT_EQ(Directory::lookup(912828900), TreasuryType::Note_10Y);
+    EXPECT_EQ(Directory::lookup(912828700), TreasuryType::Note_10Y);
+    EXPECT_EQ(Directory::lookup(912810100), TreasuryType::Bond_30Y);
+    EXPECT_EQ(Directory::lookup(912796400), TreasuryType::Bill_3M);
+    EXPECT_EQ(Directory::lookup(912828800), TreasuryType::Note_2Y);
+    EXPECT_EQ(Directory::lookup(0), TreasuryType::Note_2Y);
+    EXPECT_EQ(Directory::lookup(999999999), TreasuryType::Note_2Y);
+    EXPECT_TRUE(Directory::listed(912810100));
+    EXPECT_FALSE(Directory::listed(912810101));
+    // Orders go out under a slot's first listing
+    EXPECT_EQ(Directory::primary_id(TreasuryType::Note_10Y), 912828900u);
+    EXPECT_EQ(Directory::primary_id(TreasuryType::Note_5Y), 0u);
+    EXPECT_EQ(Instruments::primary_id(TreasuryType::Bond_30Y), 6u);
+}
+
+TEST(SystemTraitsTest, SubsystemsShareTheSelectedCapacities) {
+    EXPECT_EQ(hft::trading::BookManager::MAX_INSTRUMENTS, SystemTraits::MAX_INSTRUMENTS);
+    EXPECT_EQ(hft::trading::BookManager::ORDER_CAPACITY, SystemTraits::ORDER_POOL_SIZE);
+    EXPECT_EQ(hft::trading::OrderLifecycleManager::MAX_ORDERS, SystemTraits::MAX_ORDERS);
+    EXPECT_EQ(hft::trading::OrderLifecycleManager::MAX_VENUES, SystemTraits::MAX_VENUES);
+    EXPECT_EQ(hft::trading::TreasuryOrderPool{}.capacity(), SystemTraits::ORDER_POOL_SIZE);
+}
@@ -4,6 +4,7 @@
 #include <random>
 #include <cstring>
 #include <vector>
+#include <memory>
 
 using hft::HFTTimer;
 
@@ -110,6 +111,93 @@ TEST(FeedHandler, BatchParsing) {
     EXPECT_EQ(invalid, 0u);
 }
 
+TEST(FeedHandler, VectorizedChecksumMatchesScalar) {
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 1000; ++i) {
+        RawMarketMessage msg{};
+        uint64_t words[8];
+        for (auto& w : words) w = rng();
+        std::memcpy(&msg, words, sizeof(msg));
+        EXPECT_EQ(BatchMessageDecoder::compute_checksum(msg), compute_checksum(msg));
+        msg.checksum = compute_checksum(msg);
+        EXPECT_TRUE(BatchMessageDecoder::validate_checksum(msg));
+        corrupt_checksum(msg);
+        EXPECT_FALSE(BatchMessageDecoder::validate_checksum(msg));
+    }
+}
+
+TEST(FeedHandler, DecodeBatchClassifiesLanes) {
+    // Full batch (gather path on AVX2) and a short tail
+    for (size_t n : {8u, 5u}) {
+        std::vector<RawMarketMessage> batch;
+        for (size_t i = 0; i < n; ++i) {
+            const auto type = (i % 3 == 0) ? MessageType::Trade : (i % 3 == 1 ? MessageType::Tick : MessageType::Heartbeat);
+            batch.push_back(make_raw_msg(i + 1, type, static_cast<uint32_t>(i % 6 + 1), 99.5, 100 + i));
+        }
+        corrupt_checksum(batch[1]);
+
+        DecodedBatch decoded;
+        ASSERT_EQ(BatchMessageDecoder::decode(batch.data(), batch.size(), decoded), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(decoded.message_type[i], batch[i].message_type);
+            EXPECT_EQ(decoded.instrument_id[i], batch[i].instrument_id);
+            EXPECT_EQ(decoded.sequence_number[i], batch[i].sequence_number);
+            EXPECT_EQ(((decoded.tick_mask >> i) & 1u) != 0, batch[i].message_type == static_cast<uint32_t>(MessageType::Tick));
+            EXPECT_EQ(((decoded.trade_mask >> i) & 1u) != 0, batch[i].message_type == static_cast<uint32_t>(MessageType::Trade));
+            EXPECT_EQ(decoded.checksum_ok(i), i != 1);
+        }
+    }
+}
+
+TEST(FeedHandler, BurstParsingMatchesScalarParsing) {
+    auto batch = make_batch(100, MessageType::Tick, 3);
+    corrupt_checksum(batch[10]);
+    corrupt_checksum(batch[57]);
+
+    std::vector<TreasuryTick> burst(100);
+    size_t invalid = 0;
+    HFTTimer::ns_t burst_ns = 0;
+    const size_t parsed = MessageParser<TreasuryTick>::parse_burst(
+        batch.data(), batch.size(), burst.data(), burst.size(), invalid, &burst_ns);
+    EXPECT_EQ(parsed, 98u);
+    EXPECT_EQ(invalid, 2u);
+    EXPECT_GT(burst_ns, 0u);
+
+    size_t out = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        TreasuryTick tick;
+        if (MessageParser<TreasuryTick>::parse_message(batch[i], tick) != ValidationResult::Valid) continue;
+        ASSERT_LT(out, parsed);
+        EXPECT_EQ(burst[out].timestamp_ns, tick.timestamp_ns);
+        EXPECT_EQ(burst[out].bid_price.whole, tick.bid_price.whole);
+        EXPECT_EQ(burst[out].bid_price.thirty_seconds, tick.bid_price.thirty_seconds);
+        EXPECT_EQ(burst[out].ask_size, tick.ask_size);
+        EXPECT_EQ(burst[out].instrument_type, tick.instrument_type);
+        ++out;
+    }
+    EXPECT_EQ(out, parsed);
+
+    // Output capacity bounds the burst
+    const size_t capped = MessageParser<TreasuryTick>::parse_burst(
+        batch.data(), batch.size(), burst.data(), 20, invalid);
+    EXPECT_EQ(capped, 20u);
+}
+
+TEST(FeedHandler, PerMessageTimingOptional) {
+    for (bool per_message : {false, true}) {
+        TreasuryFeedHandler handler;
+        handler.set_per_message_timing(per_message);
+        auto batch = make_batch(21, MessageType::Trade, 2);
+        EXPECT_EQ(handler.process_messages(batch.data(), batch.size()), 21u);
+        auto stats = handler.get_quality_stats();
+        EXPECT_EQ(stats.total_messages_processed, 21u);
+        EXPECT_EQ(stats.invalid_messages, 0u);
+        std::vector<TreasuryTrade> out(21);
+        EXPECT_EQ(handler.get_parsed_trades(out.data(), out.size()), 21u);
+        EXPECT_EQ(out[20].trade_size, 1020u);
+    }
+}
+
 TEST(FeedHandler, FeedHandlerWorkflow) {
     TreasuryFeedHandler handler;
     auto batch = make_batch(10, MessageType::Tick, 5);
@@ -120,6 +208,33 @@ TEST(FeedHandler, FeedHandlerWorkflow) {
     EXPECT_EQ(got, 10u);
 }
 
+TEST(FeedHandler, TracerTagsSampledTicks) {
+    TreasuryFeedHandler handler;
+    hft::PipelineTracer tracer(4);
+    handler.set_tracer(&tracer);
+    auto batch = make_batch(16, MessageType::Tick, 5);
+    ASSERT_EQ(handler.process_messages(batch.data(), batch.size()), 16u);
+    std::vector<TreasuryTick> out(16);
+    ASSERT_EQ(handler.get_parsed_ticks(out.data(), out.size()), 16u);
+
+    size_t traced = 0;
+    for (const auto& tick : out) {
+        if (tick.trace_id == 0) continue;
+        ++traced;
+        EXPECT_TRUE(tracer.finish(tick.trace_id, hft::TraceStage::PARSED));
+    }
+    EXPECT_EQ(traced, 4u);
+    EXPECT_EQ(tracer.drain(), 4u);
+    EXPECT_EQ(tracer.stage_breakdown(hft::TraceStage::PARSED).count, 4u);
+
+    // Without a tracer ticks leave untraced
+    handler.set_tracer(nullptr);
+    auto more = make_batch(20, MessageType::Tick, 5);
+    handler.process_messages(more.data() + 16, 4);
+    ASSERT_EQ(handler.get_parsed_ticks(out.data(), out.size()), 4u);
+    for (size_t i = 0; i < 4; ++i) EXPECT_EQ(out[i].trace_id, 0u);
+}
+
 TEST(FeedHandler, QualityControlDuplicatesAndSequence) {
     TreasuryFeedHandler handler;
     auto batch = make_batch(5, MessageType::Tick, 1);
@@ -153,6 +268,155 @@ TEST(FeedHandler, ObjectPoolIntegration) {
     tick_pool.release(tick);
 }
 
+TEST(FeedHandler, DuplicatesAfterWindowWrap) {
+    // More than one window of distinct sequences, then replay the tail
+    TreasuryFeedHandler handler;
+    auto batch = make_batch(3000, MessageType::Trade, 1);
+    EXPECT_EQ(handler.process_messages(batch.data(), batch.size()), 3000u);
+    EXPECT_EQ(handler.process_messages(batch.data() + 2500, 500), 0u);
+    auto stats = handler.get_quality_stats();
+    EXPECT_EQ(stats.duplicate_messages, 500u);
+    EXPECT_EQ(stats.sequence_gaps, 0u);
+}
+
+TEST(FeedHandler, LateFillDoesNotRewindSequence) {
+    TreasuryFeedHandler handler;
+    auto batch = make_batch(6, MessageType::Trade, 1);
+    std::swap(batch[2], batch[4]);  // 1, 2, 5, 4, 3, 6
+    EXPECT_EQ(handler.process_messages(batch.data(), batch.size()), 6u);
+    auto stats = handler.get_quality_stats();
+    EXPECT_EQ(stats.sequence_gaps, 1u);
+    EXPECT_EQ(stats.duplicate_messages, 0u);
+}
+
+TEST(FeedHandler, GapRecoveryReleasesInOrder) {
+    TreasuryFeedHandler handler;
+    std::vector<std::pair<uint64_t, uint64_t>> requests;
+    handler.enable_gap_recovery([&](uint64_t first, uint64_t last) { requests.emplace_back(first, last); });
+
+    auto all = make_batch(10, MessageType::Trade, 1);
+    // Deliver 1-3, lose 4-5, deliver 6-8
+    std::vector<RawMarketMessage> live = {all[0], all[1], all[2], all[5], all[6], all[7]};
+    EXPECT_EQ(handler.process_messages(live.data(), live.size()), 6u);
+    EXPECT_EQ(handler.feed_state(), TreasuryFeedHandler::FeedState::Recovering);
+    EXPECT_EQ(handler.buffered_messages(), 3u);
+    EXPECT_EQ(handler.last_released_sequence(), 3u);
+    ASSERT_EQ(requests.size(), 1u);
+    EXPECT_EQ(requests[0], std::make_pair(uint64_t{4}, uint64_t{5}));
+
+    std::vector<TreasuryTrade> out(10);
+    EXPECT_EQ(handler.get_parsed_trades(out.data(), out.size()), 3u);
+
+    // Retransmission arrives out of order: 5 waits for 4
+    EXPECT_EQ(handler.process_messages(&all[4], 1), 1u);
+    EXPECT_EQ(handler.last_released_sequence(), 3u);
+    EXPECT_EQ(handler.process_messages(&all[3], 1), 1u);
+    EXPECT_EQ(handler.feed_state(), TreasuryFeedHandler::FeedState::Live);
+    EXPECT_EQ(handler.last_released_sequence(), 8u);
+
+    const size_t got = handler.get_parsed_trades(out.data(), out.size());
+    ASSERT_EQ(got, 5u);
+    for (size_t i = 0; i < got; ++i) {
+        EXPECT_EQ(out[i].timestamp_ns, all[3 + i].timestamp_exchange_ns);  // 4, 5, 6, 7, 8
+    }
+    auto stats = handler.get_quality_stats();
+    EXPECT_EQ(stats.retransmit_requests, 1u);
+    EXPECT_EQ(stats.recovered_messages, 4u);  // 5 (buffered) plus 6-8
+    EXPECT_EQ(stats.total_messages_processed, 8u);
+}
+
+TEST(FeedHandler, GapRecoveryFlushGivesUp) {
+    TreasuryFeedHandler handler;
+    handler.enable_gap_recovery(nullptr);
+    auto all = make_batch(6, MessageType::Trade, 1);
+    std::vector<RawMarketMessage> live = {all[0], all[3], all[5]};
+    handler.process_messages(live.data(), live.size());
+    EXPECT_EQ(handler.buffered_messages(), 2u);
+
+    EXPECT_EQ(handler.flush_recovery(), 2u);
+    EXPECT_EQ(handler.feed_state(), TreasuryFeedHandler::FeedState::Live);
+    EXPECT_EQ(handler.last_released_sequence(), 6u);
+    auto stats = handler.get_quality_stats();
+    EXPECT_EQ(stats.lost_messages, 3u);  // 2, 3, 5
+
+    // A retransmission after giving up is dropped, not delivered out of order
+    EXPECT_EQ(handler.process_messages(&all[1], 1), 0u);
+    EXPECT_EQ(handler.get_quality_stats().late_messages, 1u);
+}
+
+TEST(FeedHandler, ArbitratorTakesFirstCopy) {
+    auto arb = std::make_unique<FeedArbitrator>();
+    auto all = make_batch(10, MessageType::Tick, 2);
+
+    // A leads for 1-6; B leads for 7-10
+    EXPECT_EQ(arb->process_line(FeedArbitrator::Line::A, all.data(), 6, 1000), 6u);
+    EXPECT_EQ(arb->process_line(FeedArbitrator::Line::B, all.data(), 10, 1250), 4u);
+    EXPECT_EQ(arb->process_line(FeedArbitrator::Line::A, all.data() + 6, 4, 1300), 0u);
+
+    std::vector<TreasuryTick> out(20);
+    const size_t got = arb->get_parsed_ticks(out.data(), out.size());
+    ASSERT_EQ(got, 10u);
+    for (size_t i = 0; i < got; ++i) {
+        EXPECT_EQ(out[i].timestamp_ns, all[i].timestamp_exchange_ns);
+    }
+
+    const auto a = arb->line_stats(FeedArbitrator::Line::A);
+    const auto b = arb->line_stats(FeedArbitrator::Line::B);
+    EXPECT_EQ(a.messages, 10u);
+    EXPECT_EQ(a.wins, 6u);
+    EXPECT_EQ(a.losses, 4u);
+    EXPECT_EQ(b.wins, 4u);
+    EXPECT_EQ(b.losses, 6u);
+    EXPECT_NEAR(a.win_rate(), 0.6, 1e-9);
+    EXPECT_EQ(b.avg_lag_ns, 250u);
+    EXPECT_EQ(a.max_lag_ns, 50u);
+
+    // Losing copies never reach the parser
+    const auto quality = arb->handler().get_quality_stats();
+    EXPECT_EQ(quality.total_messages_processed, 10u);
+    EXPECT_EQ(quality.duplicate_messages, 0u);
+}
+
+TEST(FeedHandler, ArbitratorInterleavedLines) {
+    auto arb = std::make_unique<FeedArbitrator>();
+    auto all = make_batch(8, MessageType::Trade, 3);
+
+    // A drops 3 and 6; B fills them in
+    std::vector<RawMarketMessage> line_a = {all[0], all[1], all[3], all[4], all[6], all[7]};
+    std::vector<RawMarketMessage> line_b = {all[2], all[5]};
+    arb->process_line(FeedArbitrator::Line::A, line_a.data(), 2, 10);
+    arb->process_line(FeedArbitrator::Line::B, line_b.data(), 1, 11);
+    arb->process_line(FeedArbitrator::Line::A, line_a.data() + 2, 2, 12);
+    arb->process_line(FeedArbitrator::Line::B, line_b.data() + 1, 1, 13);
+    arb->process_line(FeedArbitrator::Line::A, line_a.data() + 4, 2, 14);
+
+    std::vector<TreasuryTrade> out(8);
+    EXPECT_EQ(arb->get_parsed_trades(out.data(), out.size()), 8u);
+    EXPECT_EQ(arb->handler().get_quality_stats().sequence_gaps, 0u);
+    EXPECT_EQ(arb->line_stats(FeedArbitrator::Line::B).wins, 2u);
+}
+
+TEST(FeedHandler, ArbitratorSkipsCorruptCopy) {
+    auto arb = std::make_unique<FeedArbitrator>();
+    auto all = make_batch(4, MessageType::Tick, 2);
+    auto line_a = all;
+    corrupt_checksum(line_a[1]);
+
+    // A's copy of 2 is corrupt; B's clean copy must still be taken
+    EXPECT_EQ(arb->process_line(FeedArbitrator::Line::A, line_a.data(), 4, 100), 3u);
+    EXPECT_EQ(arb->process_line(FeedArbitrator::Line::B, all.data(), 4, 200), 1u);
+
+    std::vector<TreasuryTick> out(8);
+    EXPECT_EQ(arb->get_parsed_ticks(out.data(), out.size()), 4u);
+    const auto a = arb->line_stats(FeedArbitrator::Line::A);
+    const auto b = arb->line_stats(FeedArbitrator::Line::B);
+    EXPECT_EQ(a.wins, 3u);
+    EXPECT_EQ(a.corrupt, 1u);
+    EXPECT_EQ(b.wins, 1u);
+    EXPECT_EQ(b.losses, 3u);
+    EXPECT_EQ(arb->handler().get_quality_stats().invalid_messages, 0u);
+}
+
 TEST(FeedHandler, RingBufferIntegration) {
     TreasuryTickBuffer tick_buffer;
     auto batch = make_batch(8, MessageType::Tick, 3);
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "hft/market_data/sequence_window.hpp"
+
+using namespace hft::market_data;
+
+namespace {
+
+using Window = SequenceWindow<128>;
+using Status = Window::Status;
+
+} // namespace
+
+TEST(SequenceWindow, InOrderAndDuplicates) {
+    Window w;
+    EXPECT_TRUE(w.empty());
+    EXPECT_EQ(w.observe(1000), Status::InOrder);  // First sequence anchors the window
+    for (uint64_t s = 1001; s < 1200; ++s) {
+        EXPECT_EQ(w.observe(s), Status::InOrder);
+    }
+    EXPECT_EQ(w.highest(), 1199u);
+    EXPECT_EQ(w.observe(1199), Status::Duplicate);
+    EXPECT_EQ(w.observe(1150), Status::Duplicate);
+    EXPECT_TRUE(w.is_duplicate(1100));
+    EXPECT_FALSE(w.is_duplicate(1200));
+}
+
+TEST(SequenceWindow, GapsAndLateFills) {
+    Window w;
+    w.observe(1);
+    EXPECT_EQ(w.observe(5), Status::Gap);
+    EXPECT_FALSE(w.contains(2));
+    EXPECT_FALSE(w.contains(4));
+    EXPECT_TRUE(w.contains(5));
+
+    EXPECT_EQ(w.observe(3), Status::LateFill);
+    EXPECT_EQ(w.observe(3), Status::Duplicate);
+    EXPECT_EQ(w.observe(2), Status::LateFill);
+    EXPECT_EQ(w.observe(4), Status::LateFill);
+    EXPECT_EQ(w.observe(6), Status::InOrder);
+}
+
+TEST(SequenceWindow, SlidingClearsReusedSlots) {
+    Window w;
+    w.observe(10);
+    // Jump by exactly one window: slot of 10 is reused by 138
+    EXPECT_EQ(w.observe(10 + 128), Status::Gap);
+    EXPECT_EQ(w.observe(10), Status::Stale);
+    // 11..137 were skipped and are still unseen inside the window
+    EXPECT_EQ(w.observe(100), Status::LateFill);
+
+    // Far jump wipes the whole window
+    EXPECT_EQ(w.observe(100000), Status::Gap);
+    EXPECT_EQ(w.observe(99999), Status::LateFill);
+    EXPECT_EQ(w.observe(138), Status::Stale);
+}
+
+TEST(SequenceWindow, Reset) {
+    Window w;
+    w.observe(42);
+    w.reset();
+    EXPECT_TRUE(w.empty());
+    EXPECT_FALSE(w.is_duplicate(42));
+    EXPECT_EQ(w.observe(42), Status::InOrder);
+}
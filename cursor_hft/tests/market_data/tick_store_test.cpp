@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "hft/market_data/tick_store.hpp"
+#include "hft/trading/risk_control_system.hpp"
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace hft::market_data;
+
+namespace {
+
+double brute_mean(const std::vector<double>& v, size_t window) {
+    const size_t n = std::min(window, v.size());
+    double sum = 0.0;
+    for (size_t i = v.size() - n; i < v.size(); ++i) sum += v[i];
+    return sum / n;
+}
+
+double brute_variance(const std::vector<double>& v, size_t window) {
+    const size_t n = std::min(window, v.size());
+    const double m = brute_mean(v, window);
+    double sum = 0.0;
+    for (size_t i = v.size() - n; i < v.size(); ++i) sum += (v[i] - m) * (v[i] - m);
+    return sum / n;
+}
+
+double brute_rms(const std::vector<double>& v, size_t window) {
+    const size_t n = std::min(window, v.size());
+    double sum = 0.0;
+    for (size_t i = v.size() - n; i < v.size(); ++i) sum += v[i] * v[i];
+    return std::sqrt(sum / n);
+}
+
+} // namespace
+
+TEST(TickStoreTest, RollingStatsMatchesRescan) {
+    auto stats = std::make_unique<RollingStats<100>>();
+    std::mt19937 rng(7);
+    std::normal_distribution<double> dist(99.5, 0.25);
+    std::vector<double> samples;
+
+    for (int i = 0; i < 5000; ++i) {
+        samples.push_back(dist(rng));
+        stats->push(samples.back());
+        if (i % 97 == 0 || i == 4999) {
+            EXPECT_EQ(stats->count(), std::min<size_t>(samples.size(), 100));
+            EXPECT_NEAR(stats->mean(), brute_mean(samples, 100), 1e-9);
+            EXPECT_NEAR(stats->variance(), brute_variance(samples, 100), 1e-7);
+        }
+    }
+}
+
+TEST(TickStoreTest, ColumnarRingAndViews) {
+    auto store = std::make_unique<TickStore<1024, 1000>>();
+    for (uint64_t i = 0; i < 1500; ++i) {
+        store->record(TreasuryType::Note_10Y, 100.0 + i, 100.5 + i, 1000 + i, 2000 + i, 0.04, 0.041, i);
+    }
+
+    EXPECT_EQ(store->size(TreasuryType::Note_10Y), 1024u);
+    EXPECT_EQ(store->total_recorded(TreasuryType::Note_10Y), 1500u);
+    EXPECT_EQ(store->size(TreasuryType::Bond_30Y), 0u);
+    EXPECT_DOUBLE_EQ(store->last_mid(TreasuryType::Note_10Y), 100.25 + 1499);
+
+    // Oldest first across the wrap
+    const auto view = store->view(TreasuryType::Note_10Y, TickStore<>::Column::Bid);
+    ASSERT_EQ(view.size(), 1024u);
+    for (size_t i = 0; i < view.size(); ++i) {
+        ASSERT_DOUBLE_EQ(view[i], 100.0 + 476 + i);
+    }
+
+    // Every column is its own contiguous, cache-line aligned array
+    const auto& cols = store->columns(TreasuryType::Note_10Y);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cols.bid.data()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cols.ask.data()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cols.bid_size.data()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cols.bid_yield.data()) % 64, 0u);
+
+    store->reset(TreasuryType::Note_10Y);
+    EXPECT_EQ(store->size(TreasuryType::Note_10Y), 0u);
+    EXPECT_EQ(store->view(TreasuryType::Note_10Y, TickStore<>::Column::Mid).size(), 0u);
+}
+
+TEST(TickStoreTest, IncrementalVolatilityMatchesWindowRescan) {
+    auto store = std::make_unique<MarketTickStore>();
+    std::mt19937 rng(11);
+    std::normal_distribution<double> step(0.0, 0.01);
+    std::vector<double> returns;
+    double price = 99.0;
+
+    EXPECT_EQ(store->realized_volatility(TreasuryType::Note_2Y), 0.0);
+    for (int i = 0; i < 3000; ++i) {
+        const double next = price + step(rng);
+        if (i > 0) returns.push_back((next - price) / price);
+        price = next;
+        store->record_price(TreasuryType::Note_2Y, price, static_cast<uint64_t>(i));
+        if (i % 250 == 1 || i == 2999) {
+            EXPECT_NEAR(store->realized_volatility(TreasuryType::Note_2Y),
+                        brute_rms(returns, MarketTickStore::STATS_WINDOW - 1), 1e-12);
+        }
+    }
+    EXPECT_GT(store->ewma_volatility(TreasuryType::Note_2Y), 0.0);
+    EXPECT_NEAR(store->mid_stats(TreasuryType::Note_2Y).mean(), price, 1.0);
+}
+
+TEST(TickStoreTest, SharedWithRiskControls) {
+    using hft::trading::RiskControlSystem;
+    auto store = std::make_unique<MarketTickStore>();
+    auto risk = std::make_unique<RiskControlSystem>(RiskControlSystem::RiskLimits{}, store.get());
+    EXPECT_EQ(&risk->tick_store(), store.get());
+
+    const Price32nd px = Price32nd::from_decimal(99.5);
+    for (int i = 0; i < 50; ++i) {
+        const double mid = 99.5 + ((i % 2) ? 0.03125 : 0.0);
+        store->record_price(TreasuryType::Note_5Y, mid, static_cast<uint64_t>(i));
+    }
+    // Risk reads the shared history; it does not append its own copy
+    risk->update_market_price(TreasuryType::Note_5Y, px);
+    EXPECT_EQ(store->total_recorded(TreasuryType::Note_5Y), 50u);
+    EXPECT_GT(risk->get_volatility(TreasuryType::Note_5Y), 0.0);
+    EXPECT_DOUBLE_EQ(risk->get_volatility(TreasuryType::Note_5Y),
+                     store->realized_volatility(TreasuryType::Note_5Y));
+
+    // A private store is fed by the risk system itself
+    auto standalone = std::make_unique<RiskControlSystem>();
+    standalone->update_market_price(TreasuryType::Note_5Y, px);
+    standalone->update_market_price(TreasuryType::Note_5Y, Price32nd::from_decimal(100.0));
+    EXPECT_EQ(standalone->tick_store().total_recorded(TreasuryType::Note_5Y), 2u);
+    EXPECT_GT(standalone->get_volatility(TreasuryType::Note_5Y), 0.0);
+}
+
+TEST(TickStoreTest, WelfordMatchesTwoPass) {
+    WelfordStats stats;
+    std::mt19937 rng(3);
+    std::normal_distribution<double> dist(1e6, 5.0);  // Large mean: naive sum of squares cancels
+    std::vector<double> samples;
+
+    EXPECT_EQ(stats.variance(), 0.0);
+    for (int i = 0; i < 20000; ++i) {
+        samples.push_back(dist(rng));
+        stats.push(samples.back());
+    }
+    EXPECT_EQ(stats.count(), samples.size());
+    EXPECT_NEAR(stats.mean(), brute_mean(samples, samples.size()), 1e-6);
+    EXPECT_NEAR(stats.variance(), brute_variance(samples, samples.size()), 1e-6);
+    EXPECT_NEAR(stats.sample_variance(),
+                stats.variance() * samples.size() / (samples.size() - 1), 1e-9);
+
+    stats.reset();
+    EXPECT_EQ(stats.count(), 0u);
+}
+
+TEST(TickStoreTest, LongWindowBeyondRingCapacity) {
+    // 16k-price window over a 1k tick ring: the statistics keep their own samples
+    using LongWindowStore = TickStore<1024, 16384>;
+    auto store = std::make_unique<LongWindowStore>();
+    std::mt19937 rng(5);
+    std::normal_distribution<double> step(0.0, 0.01);
+    std::vector<double> returns;
+    double price = 99.0;
+
+    for (int i = 0; i < 40000; ++i) {
+        const double next = price + step(rng);
+        if (i > 0) returns.push_back((next - price) / price);
+        price = next;
+        store->record_price(TreasuryType::Bond_30Y, price, static_cast<uint64_t>(i));
+    }
+    EXPECT_EQ(store->size(TreasuryType::Bond_30Y), 1024u);
+    EXPECT_EQ(store->return_stats(TreasuryType::Bond_30Y).count(), LongWindowStore::STATS_WINDOW - 1);
+    EXPECT_NEAR(store->realized_volatility(TreasuryType::Bond_30Y),
+                brute_rms(returns, LongWindowStore::STATS_WINDOW - 1), 1e-12);
+    EXPECT_NEAR(store->return_stats(TreasuryType::Bond_30Y).variance(),
+                brute_variance(returns, LongWindowStore::STATS_WINDOW - 1), 1e-14);
+    EXPECT_NEAR(store->session_volatility(TreasuryType::Bond_30Y),
+                std::sqrt(brute_variance(returns, returns.size())), 1e-12);
+}
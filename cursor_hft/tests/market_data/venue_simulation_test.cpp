@@ -3,6 +3,7 @@
 #include "hft/market_data/treasury_instruments.hpp"
 #include "hft/timing/hft_timer.hpp"
 #include <memory>
+#include <string>
 #include <vector>
 
 using namespace hft::market_data;
@@ -264,6 +265,227 @@ TEST_F(VenueSimulationTest, HighThroughput) {
     EXPECT_GT(stats.orders_filled + stats.orders_partially_filled, 0);
 }
 
+// Simulated time: responses wait for their modelled arrival
+TEST_F(VenueSimulationTest, SimulatedResponsesArriveAtModelledTime) {
+    VenueSimulation sim(1'000'000);
+    sim.add_venue(*venue_);
+
+    auto order = create_test_order(1, OrderSide::Buy, 99.0, 10);
+    ASSERT_TRUE(venue_->submit_order(order));
+
+    VenueResponse response{};
+    EXPECT_EQ(venue_->get_venue_responses(&response, 1), 0);
+    const uint64_t due = venue_->next_response_ns();
+    ASSERT_GT(due, sim.now_ns());
+
+    std::vector<std::pair<uint64_t, VenueResponse>> delivered;
+    const auto on_tick = [](const TreasuryTick&) {};
+    const auto on_response = [&](size_t, const VenueResponse& r) { delivered.emplace_back(sim.now_ns(), r); };
+    EXPECT_EQ(sim.run_until(due - 1, on_tick, on_response), 0);
+    EXPECT_EQ(sim.now_ns(), due - 1);
+    EXPECT_EQ(sim.run(on_tick, on_response), 1);
+
+    ASSERT_EQ(delivered.size(), 1);
+    EXPECT_EQ(delivered[0].first, due);
+    EXPECT_EQ(delivered[0].second.timestamp_venue_ns, due);
+    EXPECT_EQ(delivered[0].second.new_status, OrderStatus::Acknowledged);
+}
+
+// Simulated time: an order cannot fill before the venue has acknowledged it
+TEST_F(VenueSimulationTest, SimulatedFillsFollowAcknowledgment) {
+    VenueSimulation sim(1'000'000);
+    sim.add_venue(*venue_);
+
+    ASSERT_TRUE(venue_->submit_order(create_test_order(1, OrderSide::Buy, 99.5, 10)));
+    const uint64_t ack_due = venue_->next_response_ns();
+
+    // Marketable against a tick just before the ack lands: fills once live, not before
+    auto tick = create_test_tick(99.0, 99.25, 100);
+    tick.timestamp_ns = ack_due - 1;
+    ASSERT_TRUE(sim.schedule_market_data(tick));
+    for (uint64_t i = 1; i <= 20; ++i) {
+        tick.timestamp_ns = ack_due + i * 100'000;
+        ASSERT_TRUE(sim.schedule_market_data(tick));
+    }
+
+    std::vector<VenueResponse> responses;
+    sim.run([](const TreasuryTick&) {}, [&](size_t, const VenueResponse& r) { responses.push_back(r); });
+
+    ASSERT_GE(responses.size(), 2);
+    EXPECT_EQ(responses[0].new_status, OrderStatus::Acknowledged);
+    uint64_t filled = 0;
+    for (size_t i = 1; i < responses.size(); ++i) {
+        EXPECT_GE(responses[i].timestamp_venue_ns, responses[i - 1].timestamp_venue_ns);
+        EXPECT_GT(responses[i].timestamp_venue_ns, ack_due);
+        filled += responses[i].fill_quantity;
+    }
+    EXPECT_EQ(filled, 10);
+}
+
+// A full response queue refuses new orders and counts the responses it had to drop
+TEST_F(VenueSimulationTest, FullResponseQueueIsReportedNotSwallowed) {
+    VenueSimulation sim(1'000'000);
+    sim.add_venue(*venue_);
+
+    ASSERT_TRUE(venue_->submit_order(create_test_order(1, OrderSide::Buy, 99.5, 10)));
+    sim.run_until(venue_->next_response_ns(), [](const TreasuryTick&) {}, [](size_t, const VenueResponse&) {});
+    ASSERT_EQ(venue_->active_orders(), 1);
+
+    // Duplicate IDs are answered with rejects until the queue is full
+    size_t queued = 0;
+    while (venue_->submit_order(create_test_order(1, OrderSide::Buy, 99.5, 10))) {
+        ++queued;
+    }
+    EXPECT_EQ(queued, PrimaryDealerVenue::RESPONSE_BUFFER_SIZE);
+    EXPECT_EQ(venue_->get_venue_stats().responses_dropped, 0);
+
+    // The resting order fills, but its fill report has nowhere to go
+    venue_->process_market_update(create_test_tick(99.0, 99.25, 100));
+    EXPECT_EQ(venue_->get_venue_stats().orders_filled, 1);
+    EXPECT_EQ(venue_->get_venue_stats().responses_dropped, 1);
+}
+
+// Queue position: an order joining the touch fills only after the displayed size ahead has traded
+TEST_F(VenueSimulationTest, JoiningTouchWaitsForQueueAhead) {
+    venue_->process_market_update(create_test_tick(99.0, 99.25, 50));
+    ASSERT_TRUE(venue_->submit_order(create_test_order(1, OrderSide::Buy, 99.0, 10)));
+
+    VenueResponse response{};
+    ASSERT_EQ(venue_->get_venue_responses(&response, 1), 1);
+    EXPECT_EQ(response.new_status, OrderStatus::Acknowledged);
+    EXPECT_EQ(venue_->queue_ahead(1), 50);
+
+    TreasuryTrade trade{};
+    trade.instrument_type = TreasuryType::Note_10Y;
+    trade.trade_price = Price32nd::from_decimal(99.25);
+    trade.trade_size = 100;
+    venue_->process_market_trade(trade);  // Lifts the offer: our bid is untouched
+    trade.trade_price = Price32nd::from_decimal(99.0);
+    trade.trade_size = 30;
+    venue_->process_market_trade(trade);
+    EXPECT_EQ(venue_->get_venue_responses(&response, 1), 0);
+    EXPECT_EQ(venue_->queue_ahead(1), 20);
+
+    trade.trade_size = 25;
+    venue_->process_market_trade(trade);
+    ASSERT_EQ(venue_->get_venue_responses(&response, 1), 1);
+    EXPECT_EQ(response.new_status, OrderStatus::PartiallyFilled);
+    EXPECT_EQ(response.fill_quantity, 5);
+    EXPECT_DOUBLE_EQ(response.fill_price.to_decimal(), 99.0);
+
+    trade.trade_size = 10;
+    venue_->process_market_trade(trade);
+    ASSERT_EQ(venue_->get_venue_responses(&response, 1), 1);
+    EXPECT_EQ(response.new_status, OrderStatus::Filled);
+    EXPECT_EQ(response.fill_quantity, 5);
+    EXPECT_EQ(venue_->active_orders(), 0);
+}
+
+// Queue position: improving the touch puts the order first; a smaller quote shortens the queue
+TEST_F(VenueSimulationTest, QueueAheadFollowsQuotes) {
+    venue_->process_market_update(create_test_tick(99.0, 99.25, 50));
+    ASSERT_TRUE(venue_->submit_order(create_test_order(1, OrderSide::Buy, 99.0, 10)));
+    ASSERT_TRUE(venue_->submit_order(create_test_order(2, OrderSide::Buy, 99.0 + 1.0 / 32.0, 10)));
+    VenueResponse responses[4];
+    ASSERT_EQ(venue_->get_venue_responses(responses, 4), 2);
+    EXPECT_EQ(venue_->queue_ahead(1), 50);
+    EXPECT_EQ(venue_->queue_ahead(2), 0);
+
+    // 20 displayed at 99.0, our 10 included
+    venue_->process_market_update(create_test_tick(99.0, 99.25, 20));
+    EXPECT_EQ(venue_->queue_ahead(1), 10);
+
+    TreasuryTrade trade{};
+    trade.instrument_type = TreasuryType::Note_10Y;
+    trade.trade_price = Price32nd::from_decimal(99.0);
+    trade.trade_size = 15;  // Through order 2's level, then 5 of the queue at 99.0
+    venue_->process_market_trade(trade);
+    ASSERT_EQ(venue_->get_venue_responses(responses, 4), 1);
+    EXPECT_EQ(responses[0].order_id, 2);
+    EXPECT_EQ(responses[0].new_status, OrderStatus::Filled);
+    EXPECT_DOUBLE_EQ(responses[0].fill_price.to_decimal(), 99.0 + 1.0 / 32.0);
+    EXPECT_EQ(venue_->queue_ahead(1), 5);
+
+    // Cancelling leaves nothing behind in the book
+    ASSERT_TRUE(venue_->cancel_order(1));
+    ASSERT_EQ(venue_->get_venue_responses(responses, 4), 1);
+    EXPECT_EQ(responses[0].new_status, OrderStatus::Cancelled);
+    EXPECT_EQ(venue_->active_orders(), 0);
+    EXPECT_EQ(venue_->queue_ahead(1), 0);
+}
+
+namespace {
+
+struct SimulatedEvent {
+    size_t venue;
+    uint64_t order_id;
+    uint64_t timestamp_ns;
+    uint64_t fill_quantity;
+    OrderStatus status;
+    bool operator==(const SimulatedEvent&) const = default;
+};
+
+// A multi-venue session: quote around every tick on every venue, cancel on partial fills
+std::vector<SimulatedEvent> run_simulated_session(uint64_t seed_offset) {
+    std::vector<std::unique_ptr<PrimaryDealerVenue>> venues;
+    VenueSimulation sim(34'200'000'000'000);  // 09:30
+    for (uint64_t v = 0; v < 3; ++v) {
+        venues.push_back(std::make_unique<PrimaryDealerVenue>(
+            "Venue" + std::to_string(v), VenueLatencyModel{50'000, 10'000, 100'000, 0.1}, 1 + v + seed_offset));
+        sim.add_venue(*venues.back());
+    }
+
+    TreasuryTick tick{};
+    tick.instrument_type = TreasuryType::Note_10Y;
+    tick.bid_size = 100;
+    tick.ask_size = 100;
+    for (uint64_t i = 0; i < 2000; ++i) {
+        tick.timestamp_ns = sim.now_ns() + i * 1'000'000;
+        tick.bid_price = Price32nd::from_decimal(99.0 + static_cast<double>(i % 16) / 32.0);
+        tick.ask_price = Price32nd::from_decimal(99.0 + static_cast<double>(i % 16 + 1) / 32.0);
+        EXPECT_TRUE(sim.schedule_market_data(tick));
+    }
+
+    uint64_t next_order_id = 1;
+    std::vector<SimulatedEvent> events;
+    sim.run(
+        [&](const TreasuryTick& t) {
+            for (size_t v = 0; v < sim.venue_count(); ++v) {
+                TreasuryOrder order{};
+                order.order_id = next_order_id++;
+                order.instrument_type = t.instrument_type;
+                order.order_type = OrderType::Limit;
+                order.side = (order.order_id & 1) ? OrderSide::Buy : OrderSide::Sell;
+                order.limit_price = order.side == OrderSide::Buy ? t.bid_price : t.ask_price;
+                order.quantity = 10;
+                EXPECT_TRUE(sim.venue(v).submit_order(order));
+            }
+        },
+        [&](size_t v, const VenueResponse& r) {
+            events.push_back({v, r.order_id, r.timestamp_venue_ns, r.fill_quantity, r.new_status});
+            if (r.new_status == OrderStatus::PartiallyFilled) (void)sim.venue(v).cancel_order(r.order_id);
+        });
+    return events;
+}
+
+} // namespace
+
+// Same seeds, same inputs: identical responses at identical simulated times
+TEST(VenueSimulationDeterminismTest, SeededRunsAreReproducible) {
+    const auto first = run_simulated_session(0);
+    const auto second = run_simulated_session(0);
+    const auto reseeded = run_simulated_session(100);
+
+    ASSERT_GT(first.size(), 6000);  // At least an ack per order
+    size_t fills = 0;
+    for (const auto& event : first) {
+        fills += event.status == OrderStatus::Filled || event.status == OrderStatus::PartiallyFilled;
+    }
+    EXPECT_GT(fills, 0);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, reseeded);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "hft/market_data/yield_curve.hpp"
+#include <memory>
+#include <random>
+
+using namespace hft::market_data;
+
+namespace {
+
+constexpr int32_t SETTLE = 20'000;  // 2024-10-04
+
+const YieldTables& test_tables() {
+    static std::unique_ptr<YieldTables> tables = [] {
+        auto t = std::make_unique<YieldTables>();
+        t->build_on_the_run(SETTLE);
+        return t;
+    }();
+    return *tables;
+}
+
+std::array<double, 6> sample_curve() {
+    return {0.0520, 0.0505, 0.0460, 0.0425, 0.0415, 0.0440};
+}
+
+} // namespace
+
+TEST(YieldCurveTest, SplinePassesThroughKnotsAndIsContinuous) {
+    auto curve = std::make_unique<YieldCurve>(test_tables());
+    ASSERT_EQ(curve->size(), 6u);
+    curve->update(sample_curve());
+    ASSERT_TRUE(curve->add_point(7.0, 0.0420));
+    ASSERT_TRUE(curve->add_point(20.0, 0.0455));
+    EXPECT_FALSE(curve->add_point(7.0, 0.0430));
+    ASSERT_EQ(curve->size(), 8u);
+
+    for (size_t i = 0; i < curve->size(); ++i) {
+        const double m = curve->point_maturity(i);
+        EXPECT_NEAR(curve->yield_at(m), curve->point_yield(i), 1e-14);
+        EXPECT_NEAR(curve->yield_at(m - 1e-9), curve->point_yield(i), 1e-9);
+        EXPECT_NEAR(curve->yield_at(m + 1e-9), curve->point_yield(i), 1e-9);
+        if (i > 0) EXPECT_GT(m, curve->point_maturity(i - 1));
+    }
+
+    // Instruments keep their knots across inserts; flat beyond the ends
+    EXPECT_EQ(curve->point_yield(curve->point_of(TreasuryType::Note_10Y)), 0.0415);
+    EXPECT_EQ(curve->yield_at(0.01), 0.0520);
+    EXPECT_EQ(curve->yield_at(40.0), 0.0440);
+}
+
+TEST(YieldCurveTest, IncrementalRefitMatchesFullRebuild) {
+    auto curve = std::make_unique<YieldCurve>(test_tables());
+    curve->update(sample_curve());
+    curve->add_point(7.0, 0.0420);
+    curve->add_point(20.0, 0.0455);
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> pick(0, 5);
+    std::normal_distribution<double> move(0.0, 0.0002);
+    auto yields = sample_curve();
+    for (int tick = 0; tick < 500; ++tick) {
+        const int i = pick(rng);
+        yields[i] += move(rng);
+        const uint64_t before = curve->segments_refit();
+        ASSERT_TRUE(curve->update(static_cast<TreasuryType>(i), yields[i]));
+        EXPECT_LE(curve->segments_refit() - before, 4u);  // Only the segments the knot touches
+    }
+
+    // Same knots, fitted from scratch
+    auto fresh = std::make_unique<YieldCurve>(test_tables());
+    fresh->update(yields);
+    fresh->add_point(7.0, 0.0420);
+    fresh->add_point(20.0, 0.0455);
+    for (double m = 0.1; m < 31.0; m += 0.05) {
+        EXPECT_NEAR(curve->yield_at(m), fresh->yield_at(m), 1e-14) << "maturity " << m;
+    }
+}
+
+TEST(YieldCurveTest, UnchangedYieldsDoNotBumpVersions) {
+    auto curve = std::make_unique<YieldCurve>(test_tables());
+    EXPECT_EQ(curve->update(sample_curve()), 6u);
+    const uint64_t version = curve->version();
+    const uint64_t risk_10y = curve->risk_version(TreasuryType::Note_10Y);
+
+    EXPECT_EQ(curve->update(sample_curve()), 0u);
+    EXPECT_EQ(curve->version(), version);
+
+    auto moved = sample_curve();
+    moved[static_cast<size_t>(TreasuryType::Note_5Y)] += 0.0001;
+    EXPECT_EQ(curve->update(moved), 1u);
+    EXPECT_EQ(curve->version(), version + 1);
+    EXPECT_EQ(curve->risk_version(TreasuryType::Note_10Y), risk_10y);
+    EXPECT_FALSE(curve->update(TreasuryType::Note_5Y, moved[3]));
+}
+
+TEST(YieldCurveTest, Dv01AndHedgeRatiosMatchRepricing) {
+    const auto& tables = test_tables();
+    auto curve = std::make_unique<YieldCurve>(tables);
+    curve->update(sample_curve());
+
+    for (size_t i = 0; i < 6; ++i) {
+        const auto type = static_cast<TreasuryType>(i);
+        const double y = sample_curve()[i];
+        const double bumped = (tables.clean_price(type, y - 0.00005) - tables.clean_price(type, y + 0.00005));
+        EXPECT_NEAR(curve->dv01(type), bumped, bumped * 1e-6) << "instrument " << i;
+        const double h = 0.0001;
+        const double second = (tables.clean_price(type, y + h) - 2.0 * tables.clean_price(type, y) +
+                               tables.clean_price(type, y - h)) / (h * h);
+        EXPECT_NEAR(curve->risk(type).convexity * curve->risk(type).dirty_price, second, second * 1e-5);
+        EXPECT_GT(curve->risk(type).convexity, 0.0);
+        EXPECT_NEAR(curve->hedge_ratio(type, type), 1.0, 1e-15);
+    }
+
+    // Longer maturities carry more DV01 per 100 face
+    EXPECT_LT(curve->dv01(TreasuryType::Note_2Y), curve->dv01(TreasuryType::Note_10Y));
+    EXPECT_LT(curve->dv01(TreasuryType::Note_10Y), curve->dv01(TreasuryType::Bond_30Y));
+
+    // Cached ratios follow a single-instrument move in both directions of the matrix
+    curve->update(TreasuryType::Bond_30Y, 0.0500);
+    const double ratio = curve->dv01(TreasuryType::Note_10Y) / curve->dv01(TreasuryType::Bond_30Y);
+    EXPECT_DOUBLE_EQ(curve->hedge_ratio(TreasuryType::Note_10Y, TreasuryType::Bond_30Y), ratio);
+    EXPECT_DOUBLE_EQ(curve->hedge_ratio(TreasuryType::Bond_30Y, TreasuryType::Note_10Y), 1.0 / ratio);
+}
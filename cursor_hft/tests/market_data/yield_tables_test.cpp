@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "hft/market_data/yield_tables.hpp"
+#include "hft/market_data/feed_handler.hpp"
+#include <memory>
+
+using namespace hft::market_data;
+
+TEST(TreasuryYieldTables, CouponScheduleActualActual) {
+    // 4.25% note maturing 2035-08-15, settling 2026-10-15
+    const int32_t settle = days_from_civil(2026, 10, 15);
+    const BondSpec spec{TreasuryType::Note_10Y, 0.0425, days_from_civil(2035, 8, 15), 2};
+    BondTerms terms;
+    ASSERT_TRUE(make_bond_terms(spec, settle, terms));
+    EXPECT_FALSE(terms.is_bill);
+    EXPECT_EQ(terms.coupons_remaining, 18u);  // 2027-02-15 .. 2035-08-15
+    // Period 2026-08-15 .. 2027-02-15 is 184 days, 61 accrued
+    EXPECT_NEAR(terms.accrual_fraction, 123.0 / 184.0, 1e-12);
+    EXPECT_NEAR(terms.accrued_interest, 2.125 * 61.0 / 184.0, 1e-12);
+
+    // Matured instruments are rejected
+    EXPECT_FALSE(make_bond_terms(spec, days_from_civil(2035, 8, 15), terms));
+}
+
+TEST(TreasuryYieldTables, ParOnCouponDate) {
+    const int32_t settle = days_from_civil(2026, 2, 28);
+    BondTerms terms;
+    // End-of-month schedule: Aug 31 / Feb 28
+    ASSERT_TRUE(make_bond_terms({TreasuryType::Note_5Y, 0.04, days_from_civil(2031, 2, 28), 2}, settle, terms));
+    EXPECT_NEAR(terms.accrued_interest, 0.0, 1e-12);
+    EXPECT_NEAR(terms.clean_price(0.04), 100.0, 1e-9);
+    EXPECT_GT(terms.clean_price(0.03), 100.0);
+    EXPECT_LT(terms.clean_price(0.05), 100.0);
+}
+
+TEST(TreasuryYieldTables, TableMatchesExactNewton) {
+    auto tables = std::make_unique<YieldTables>();
+    tables->build_on_the_run(days_from_civil(2026, 10, 15));
+
+    for (size_t i = 0; i < YieldTables::MAX_INSTRUMENTS; ++i) {
+        const auto type = static_cast<TreasuryType>(i);
+        ASSERT_TRUE(tables->valid(type));
+        int max_iterations = 0;
+        for (double y = 0.0; y < 0.15; y += 0.0007) {
+            const double price = tables->clean_price(type, y);
+            EXPECT_NEAR(tables->price_to_yield(type, price), y, 1e-8);
+            int iterations = 0;
+            EXPECT_NEAR(tables->exact_yield(type, price, &iterations), y, 1e-11);
+            max_iterations = std::max(max_iterations, iterations);
+        }
+        // Table seed: Newton stops after at most two steps
+        EXPECT_LE(max_iterations, 2) << "instrument " << i;
+    }
+
+    // Bills agree with the simple-interest YieldCalculator
+    TreasuryInstrument bill(TreasuryType::Bill_3M, 91, 1'000'000);
+    const double y = tables->price_to_yield(TreasuryType::Bill_3M, Price32nd::from_decimal(99.0));
+    EXPECT_NEAR(y, YieldCalculator::price_to_yield(bill, Price32nd::from_decimal(99.0), 91), 1e-4);
+}
+
+TEST(TreasuryYieldTables, BatchMatchesScalar) {
+    auto tables = std::make_unique<YieldTables>();
+    tables->build_on_the_run(days_from_civil(2026, 3, 31));
+
+    // Mixed instruments, including prices off the table and a zero price
+    const TreasuryType types[11] = {
+        TreasuryType::Note_10Y, TreasuryType::Bill_3M, TreasuryType::Bond_30Y, TreasuryType::Note_2Y,
+        TreasuryType::Note_5Y, TreasuryType::Bill_6M, TreasuryType::Bond_30Y, TreasuryType::Note_10Y,
+        TreasuryType::Note_2Y, TreasuryType::Bond_30Y, TreasuryType::Bill_3M};
+    const double prices[11] = {99.5, 99.0, 97.25, 100.015625, 101.5, 98.0, 400.0, 5.0, 100.0, 112.75, 0.0};
+    double batch[11];
+    tables->price_to_yield(types, prices, batch, 11);
+    for (size_t i = 0; i < 11; ++i) {
+        EXPECT_NEAR(batch[i], tables->price_to_yield(types[i], prices[i]), 1e-12) << "lane " << i;
+    }
+    // Off-table quotes saturate; exact_yield() still solves them
+    EXPECT_EQ(batch[6], YieldTables::YIELD_MIN);
+    EXPECT_EQ(batch[7], YieldTables::YIELD_MAX);
+    EXPECT_LT(tables->exact_yield(types[6], prices[6]), YieldTables::YIELD_MIN);
+    EXPECT_GT(tables->exact_yield(types[7], prices[7]), YieldTables::YIELD_MAX);
+    EXPECT_EQ(tables->exact_yield(types[10], prices[10]), 0.0);
+
+    double single[6];
+    const double ten_year[6] = {98.0, 98.5, 99.0, 99.5, 100.0, 100.5};
+    tables->price_to_yield(TreasuryType::Note_10Y, ten_year, single, 6);
+    for (size_t i = 0; i < 6; ++i) {
+        EXPECT_NEAR(single[i], tables->exact_yield(TreasuryType::Note_10Y, ten_year[i]), 1e-8);
+        if (i > 0) EXPECT_LT(single[i], single[i - 1]);
+    }
+}
+
+TEST(TreasuryYieldTables, FeedParserUsesTables) {
+    RawMarketMessage raw{};
+    raw.sequence_number = 1;
+    raw.message_type = static_cast<uint32_t>(MessageType::Tick);
+    raw.instrument_id = 5;  // Note_10Y
+    const double bid = 99.5, ask = 99.53125;
+    const uint64_t size = 1000;
+    std::memcpy(raw.raw_data, &bid, sizeof(double));
+    std::memcpy(raw.raw_data + 8, &ask, sizeof(double));
+    std::memcpy(raw.raw_data + 16, &size, sizeof(uint64_t));
+    std::memcpy(raw.raw_data + 24, &size, sizeof(uint64_t));
+    raw.checksum = BatchMessageDecoder::compute_checksum(raw);
+
+    const auto& tables = default_yield_tables();
+    TreasuryTick scalar{};
+    ASSERT_EQ(MessageParser<TreasuryTick>::parse_message(raw, scalar), ValidationResult::Valid);
+    EXPECT_NEAR(scalar.bid_yield, tables.price_to_yield(TreasuryType::Note_10Y, bid), 1e-12);
+    EXPECT_GT(scalar.bid_yield, scalar.ask_yield);
+
+    DecodedBatch batch;
+    ASSERT_EQ(BatchMessageDecoder::decode(&raw, 1, batch), 1u);
+    TreasuryTick decoded{};
+    ASSERT_EQ(MessageParser<TreasuryTick>::parse_decoded(batch, 0, decoded), ValidationResult::Valid);
+    EXPECT_DOUBLE_EQ(decoded.bid_yield, scalar.bid_yield);
+    EXPECT_DOUBLE_EQ(decoded.ask_yield, scalar.ask_yield);
+}
+
+TEST(TreasuryYieldTables, DefaultTablesBuiltBeforeFirstUse) {
+    // Built during static initialisation, not by the first feed message
+    const YieldTables& tables = default_yield_tables();
+    const int32_t startup_date = tables.settlement_date();
+    EXPECT_GT(startup_date, days_from_civil(2020, 1, 1));
+    for (size_t i = 0; i < YieldTables::MAX_INSTRUMENTS; ++i) {
+        EXPECT_TRUE(tables.valid(static_cast<TreasuryType>(i)));
+    }
+
+    // Session start installs its own settlement date in place
+    build_default_yield_tables(days_from_civil(2026, 10, 15));
+    EXPECT_EQ(&default_yield_tables(), &tables);
+    EXPECT_EQ(tables.settlement_date(), days_from_civil(2026, 10, 15));
+    build_default_yield_tables(startup_date);
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "hft/memory/concurrent_object_pool.hpp"
+#include <array>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <set>
+#include <cstdint>
+
+namespace hft {
+namespace {
+
+struct alignas(64) TestStruct {
+    uint64_t owner;
+    uint64_t value;
+};
+
+constexpr size_t POOL_SIZE = 256;
+using Pool = ConcurrentObjectPool<TestStruct, POOL_SIZE, 16, 8>;
+
+TEST(ConcurrentObjectPoolTest, GlobalAcquireRelease) {
+    auto pool = std::make_unique<Pool>();
+    EXPECT_EQ(pool->global_available(), POOL_SIZE);
+
+    std::set<TestStruct*> seen;
+    for (size_t i = 0; i < POOL_SIZE; ++i) {
+        auto* obj = pool->acquire();
+        ASSERT_NE(obj, nullptr);
+        EXPECT_TRUE(seen.insert(obj).second);
+    }
+    EXPECT_EQ(pool->acquire(), nullptr);
+
+    for (auto* obj : seen) pool->release(obj);
+    EXPECT_EQ(pool->global_available(), POOL_SIZE);
+}
+
+TEST(ConcurrentObjectPoolTest, LocalCacheRefillsAndSpills) {
+    auto pool = std::make_unique<Pool>();
+    auto* cache = pool->attach();
+    ASSERT_NE(cache, nullptr);
+
+    auto* obj = cache->acquire();
+    ASSERT_NE(obj, nullptr);
+    // One refill moved half a magazine off the global list
+    EXPECT_EQ(cache->cached(), Pool::magazine_size() / 2 - 1);
+    EXPECT_EQ(pool->global_available(), POOL_SIZE - Pool::magazine_size() / 2);
+
+    // Drain the whole pool through the cache
+    std::vector<TestStruct*> held{obj};
+    while (auto* o = cache->acquire()) held.push_back(o);
+    EXPECT_EQ(held.size(), POOL_SIZE);
+
+    // Releasing everything spills back to global in half-magazine batches
+    for (auto* o : held) cache->release(o);
+    EXPECT_LE(cache->cached(), Pool::magazine_size());
+    EXPECT_EQ(pool->global_available() + cache->cached(), POOL_SIZE);
+
+    pool->detach(cache);
+    EXPECT_EQ(pool->global_available(), POOL_SIZE);
+}
+
+TEST(ConcurrentObjectPoolTest, AttachLimit) {
+    auto pool = std::make_unique<Pool>();
+    std::vector<Pool::LocalCache*> caches;
+    for (size_t i = 0; i < Pool::max_threads(); ++i) {
+        caches.push_back(pool->attach());
+        ASSERT_NE(caches.back(), nullptr);
+    }
+    EXPECT_EQ(pool->attach(), nullptr);
+    pool->detach(caches.back());
+    EXPECT_NE(pool->attach(), nullptr);
+}
+
+TEST(ConcurrentObjectPoolTest, CrossThreadReleaseReturnsToOwner) {
+    auto pool = std::make_unique<Pool>();
+    auto* owner = pool->attach();
+    auto* other = pool->attach();
+
+    auto* obj = owner->acquire();
+    const size_t owner_cached = owner->cached();
+    other->release(obj);  // Goes to owner's remote list, not other's magazine
+    EXPECT_EQ(other->cached(), 0u);
+    EXPECT_EQ(owner->cached(), owner_cached);
+
+    // Owner drains remote releases before touching the global list
+    std::vector<TestStruct*> held;
+    for (size_t i = 0; i < owner_cached; ++i) held.push_back(owner->acquire());
+    const size_t global_before = pool->global_available();
+    EXPECT_EQ(owner->acquire(), obj);
+    EXPECT_EQ(pool->global_available(), global_before);
+}
+
+TEST(ConcurrentObjectPoolTest, ConcurrentThreadsNeverShareObjects) {
+    constexpr int THREADS = 4;
+    constexpr int ROUNDS = 20000;
+    auto pool = std::make_unique<Pool>();
+    std::atomic<bool> corrupted{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            auto* cache = pool->attach();
+            std::array<TestStruct*, 24> held{};
+            for (int r = 0; r < ROUNDS; ++r) {
+                const size_t slot = static_cast<size_t>(r) % held.size();
+                if (held[slot]) {
+                    if (held[slot]->owner != static_cast<uint64_t>(t) ||
+                        held[slot]->value != static_cast<uint64_t>(slot)) {
+                        corrupted = true;
+                    }
+                    // Alternate local and global release paths
+                    if (r & 1) cache->release(held[slot]); else pool->release(held[slot]);
+                    held[slot] = nullptr;
+                } else if (auto* obj = cache->acquire()) {
+                    obj->owner = static_cast<uint64_t>(t);
+                    obj->value = slot;
+                    held[slot] = obj;
+                }
+            }
+            for (auto* obj : held) {
+                if (obj) cache->release(obj);
+            }
+            pool->detach(cache);
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    EXPECT_FALSE(corrupted.load());
+    EXPECT_EQ(pool->global_available(), POOL_SIZE);
+}
+
+} // namespace
+} // namespace hft
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include "hft/memory/fixed_hash_map.hpp"
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace hft {
+namespace {
+
+constexpr size_t MAP_SIZE = 256;
+using Map = FixedHashMap<uint64_t, uint64_t, MAP_SIZE>;
+
+TEST(FixedHashMapTest, InsertFindErase) {
+    Map map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(42), nullptr);
+
+    auto [value, inserted] = map.try_emplace(42, 7);
+    ASSERT_NE(value, nullptr);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(*value, 7u);
+    EXPECT_EQ(map.size(), 1u);
+
+    ASSERT_NE(map.find(42), nullptr);
+    EXPECT_EQ(*map.find(42), 7u);
+
+    EXPECT_TRUE(map.erase(42));
+    EXPECT_FALSE(map.erase(42));
+    EXPECT_EQ(map.find(42), nullptr);
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(FixedHashMapTest, DuplicateKeyReturnsExisting) {
+    Map map;
+    EXPECT_TRUE(map.try_emplace(1, 100).second);
+
+    auto [value, inserted] = map.try_emplace(1, 200);
+    EXPECT_FALSE(inserted);
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 100u);
+
+    EXPECT_TRUE(map.insert_or_assign(1, 300));
+    EXPECT_EQ(*map.find(1), 300u);
+    EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(FixedHashMapTest, RejectsInsertWhenFull) {
+    Map map;
+    for (uint64_t i = 1; i <= MAP_SIZE; ++i) {
+        ASSERT_TRUE(map.try_emplace(i, i * 10).second);
+    }
+    EXPECT_EQ(map.size(), MAP_SIZE);
+
+    auto [value, inserted] = map.try_emplace(MAP_SIZE + 1, 0);
+    EXPECT_EQ(value, nullptr);
+    EXPECT_FALSE(inserted);
+
+    // Existing keys remain reachable at capacity
+    for (uint64_t i = 1; i <= MAP_SIZE; ++i) {
+        ASSERT_NE(map.find(i), nullptr);
+        EXPECT_EQ(*map.find(i), i * 10);
+    }
+}
+
+TEST(FixedHashMapTest, ProbeOverflowLeavesTableIntact) {
+    // Keys that all hash to the same home slot build one long cluster
+    constexpr unsigned shift = 64 - __builtin_ctzll(Map::SLOT_COUNT);
+    auto home = [](uint64_t key) { return (key * 0x9E3779B97F4A7C15ULL) >> shift; };
+    std::vector<uint64_t> colliding;
+    uint64_t neighbour = 0;
+    for (uint64_t key = 1; colliding.size() < Map::MAX_PROBE; ++key) {
+        if (home(key) == 0) {
+            colliding.push_back(key);
+        } else if (neighbour == 0 && home(key) == 200) {
+            neighbour = key;
+        }
+    }
+
+    Map map;
+    ASSERT_TRUE(map.try_emplace(neighbour, 1).second);
+    size_t accepted = 0;
+    for (uint64_t key : colliding) {
+        auto [value, inserted] = map.try_emplace(key, key);
+        if (!value) {
+            break;
+        }
+        ASSERT_TRUE(inserted);
+        ++accepted;
+    }
+    ASSERT_LT(accepted, colliding.size());
+    EXPECT_EQ(map.size(), accepted + 1);
+
+    // The refused insert displaced nothing
+    EXPECT_EQ(map.find(colliding[accepted]), nullptr);
+    ASSERT_NE(map.find(neighbour), nullptr);
+    EXPECT_EQ(*map.find(neighbour), 1u);
+    for (size_t i = 0; i < accepted; ++i) {
+        ASSERT_NE(map.find(colliding[i]), nullptr);
+        EXPECT_EQ(*map.find(colliding[i]), colliding[i]);
+    }
+    size_t visited = 0;
+    map.for_each([&](uint64_t, uint64_t) { ++visited; });
+    EXPECT_EQ(visited, map.size());
+}
+
+TEST(FixedHashMapTest, ClearAndForEach) {
+    Map map;
+    for (uint64_t i = 0; i < 50; ++i) {
+        ASSERT_TRUE(map.try_emplace(i * 1000, i).second);
+    }
+
+    uint64_t sum = 0;
+    size_t visited = 0;
+    map.for_each([&](uint64_t, uint64_t value) {
+        sum += value;
+        ++visited;
+    });
+    EXPECT_EQ(visited, 50u);
+    EXPECT_EQ(sum, 49u * 50u / 2u);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(0), nullptr);
+}
+
+TEST(FixedHashMapTest, RandomOperationsMatchStdMap) {
+    Map map;
+    std::unordered_map<uint64_t, uint64_t> reference;
+    std::mt19937_64 gen(1234);
+    std::uniform_int_distribution<uint64_t> key_dist(0, 1023);
+
+    for (int i = 0; i < 100000; ++i) {
+        const uint64_t key = key_dist(gen);
+        if (gen() & 1) {
+            const bool room = reference.size() < MAP_SIZE || reference.count(key);
+            auto [value, inserted] = map.try_emplace(key, static_cast<uint64_t>(i));
+            if (!room) {
+                EXPECT_EQ(value, nullptr);
+                continue;
+            }
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(inserted, reference.emplace(key, static_cast<uint64_t>(i)).second);
+        } else {
+            EXPECT_EQ(map.erase(key), reference.erase(key) == 1);
+        }
+        ASSERT_EQ(map.size(), reference.size());
+    }
+
+    for (const auto& [key, value] : reference) {
+        ASSERT_NE(map.find(key), nullptr);
+        EXPECT_EQ(*map.find(key), value);
+    }
+}
+
+TEST(FixedHashMapTest, SequentialOrderIdsWithChurn) {
+    // Order-book style usage: monotonically increasing IDs, FIFO retirement
+    FixedHashMap<uint64_t, uint32_t, 4096> map;
+    uint64_t next_insert = 1;
+    uint64_t next_erase = 1;
+    for (int i = 0; i < 50000; ++i) {
+        ASSERT_TRUE(map.try_emplace(next_insert, static_cast<uint32_t>(next_insert)).second);
+        ++next_insert;
+        if (map.size() == 4096) {
+            for (int j = 0; j < 1000; ++j) {
+                ASSERT_TRUE(map.erase(next_erase++));
+            }
+        }
+    }
+    for (uint64_t id = next_erase; id < next_insert; ++id) {
+        ASSERT_NE(map.find(id), nullptr);
+    }
+}
+
+} // namespace
+} // namespace hft
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "hft/memory/huge_page_pool.hpp"
+#include <vector>
+#include <set>
+#include <cstdint>
+
+namespace hft {
+namespace {
+
+struct alignas(64) TestStruct {
+    uint64_t a;
+    uint64_t b;
+};
+
+// Odd-sized object to check stride rounding
+struct Unaligned {
+    uint8_t bytes[72];
+};
+
+using Pool = HugePageObjectPool<TestStruct, false>;
+
+Pool::Options small_options(size_t per_slab, size_t max_slabs) {
+    Pool::Options opts;
+    opts.objects_per_slab = per_slab;
+    opts.max_slabs = max_slabs;
+    opts.lock_memory = false;  // CI hosts often have a tiny RLIMIT_MEMLOCK
+    return opts;
+}
+
+TEST(HugePageObjectPoolTest, BasicAcquireRelease) {
+    Pool pool(small_options(1024, 1));
+    ASSERT_TRUE(pool.valid());
+    EXPECT_EQ(pool.capacity(), 1024u);
+    EXPECT_EQ(pool.available(), 1024u);
+    EXPECT_TRUE(pool.validate_memory());
+
+    std::set<TestStruct*> seen;
+    for (size_t i = 0; i < 1024; ++i) {
+        auto* obj = pool.acquire();
+        ASSERT_NE(obj, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(obj) % 64, 0u);
+        EXPECT_TRUE(seen.insert(obj).second);
+        obj->a = i;
+    }
+    EXPECT_EQ(pool.acquire(), nullptr);
+    EXPECT_EQ(pool.size(), 1024u);
+
+    for (auto* obj : seen) pool.release(obj);
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_EQ(pool.available(), 1024u);
+}
+
+TEST(HugePageObjectPoolTest, BeyondInlinePoolLimit) {
+    // More than ObjectPool's 65536 cap in one slab
+    Pool pool(small_options(100000, 1));
+    ASSERT_TRUE(pool.valid());
+    std::vector<TestStruct*> held;
+    held.reserve(100000);
+    while (auto* obj = pool.acquire()) held.push_back(obj);
+    EXPECT_EQ(held.size(), 100000u);
+    pool.reset();
+    EXPECT_EQ(pool.available(), 100000u);
+}
+
+TEST(HugePageObjectPoolTest, GrowAddsSlabsOffHotPath) {
+    Pool pool(small_options(256, 3));
+    ASSERT_TRUE(pool.valid());
+    EXPECT_EQ(pool.slab_count(), 1u);
+    EXPECT_EQ(pool.max_capacity(), 768u);
+
+    std::vector<TestStruct*> held;
+    while (auto* obj = pool.acquire()) held.push_back(obj);
+    EXPECT_EQ(held.size(), 256u);  // acquire() never grows on its own
+    EXPECT_TRUE(pool.needs_growth());
+
+    ASSERT_TRUE(pool.grow());
+    ASSERT_TRUE(pool.grow());
+    EXPECT_FALSE(pool.grow());
+    EXPECT_FALSE(pool.needs_growth() && pool.slab_count() < 3);
+    EXPECT_EQ(pool.capacity(), 768u);
+
+    while (auto* obj = pool.acquire()) held.push_back(obj);
+    EXPECT_EQ(held.size(), 768u);
+
+    // Objects from every slab are owned and released normally
+    for (auto* obj : held) {
+        EXPECT_TRUE(pool.owns(obj));
+        pool.release(obj);
+    }
+    EXPECT_EQ(pool.available(), 768u);
+}
+
+TEST(HugePageObjectPoolTest, StrideKeepsCacheLineAlignment) {
+    HugePageObjectPool<Unaligned> pool([] {
+        HugePageObjectPool<Unaligned>::Options opts;
+        opts.objects_per_slab = 64;
+        opts.lock_memory = false;
+        return opts;
+    }());
+    ASSERT_TRUE(pool.valid());
+    EXPECT_EQ(HugePageObjectPool<Unaligned>::OBJECT_STRIDE, 128u);
+    auto* a = pool.acquire();
+    auto* b = pool.acquire();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 64, 0u);
+    EXPECT_FALSE(pool.owns(reinterpret_cast<Unaligned*>(reinterpret_cast<char*>(a) + 8)));
+}
+
+TEST(HugePageObjectPoolTest, RegularPagesWhenHugePagesDisabled) {
+    auto opts = small_options(128, 1);
+    opts.huge_pages = false;
+    Pool pool(opts);
+    ASSERT_TRUE(pool.valid());
+    EXPECT_FALSE(pool.huge_pages_active());
+    EXPECT_NE(pool.acquire(), nullptr);
+}
+
+} // namespace
+} // namespace hft
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <array>
+#include <hft/messaging/broadcast_ring_buffer.hpp>
+
+using namespace hft;
+
+class BroadcastRingBufferTest : public ::testing::Test {
+protected:
+    static constexpr size_t BUFFER_SIZE = 64;
+    BroadcastRingBuffer<int, BUFFER_SIZE, 4> buffer;
+};
+
+TEST_F(BroadcastRingBufferTest, EveryConsumerSeesEveryItem) {
+    auto a = buffer.subscribe();
+    auto b = buffer.subscribe();
+    ASSERT_TRUE(a.valid());
+    ASSERT_TRUE(b.valid());
+    EXPECT_EQ(buffer.consumer_count(), 2);
+
+    for (int i = 0; i < 10; ++i) ASSERT_TRUE(buffer.try_push(i));
+
+    std::array<int, 10> out{};
+    EXPECT_EQ(a.try_pop_batch(out.begin(), out.end()), 10);
+    EXPECT_EQ(out[9], 9);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(b.size(), 10);
+
+    int value = -1;
+    ASSERT_TRUE(b.try_pop(value));
+    EXPECT_EQ(value, 0);
+}
+
+TEST_F(BroadcastRingBufferTest, SlowestConsumerGatesProducer) {
+    auto fast = buffer.subscribe();
+    auto slow = buffer.subscribe();
+
+    for (size_t i = 0; i < BUFFER_SIZE; ++i) ASSERT_TRUE(buffer.try_push(static_cast<int>(i)));
+    EXPECT_FALSE(buffer.try_push(0));
+
+    std::array<int, BUFFER_SIZE> out;
+    EXPECT_EQ(fast.try_pop_batch(out.begin(), out.end()), BUFFER_SIZE);
+    EXPECT_FALSE(buffer.try_push(0));  // slow consumer still holds the lap
+
+    int value = -1;
+    ASSERT_TRUE(slow.try_pop(value));
+    EXPECT_TRUE(buffer.try_push(100));
+
+    // Detaching the slow consumer releases the producer
+    buffer.unsubscribe(slow);
+    EXPECT_FALSE(slow.valid());
+    std::array<int, 8> more{};
+    EXPECT_EQ(buffer.try_push_batch(more.begin(), more.end()), 8);
+}
+
+TEST_F(BroadcastRingBufferTest, SubscribeLimit) {
+    for (size_t i = 0; i < buffer.max_consumers(); ++i) {
+        EXPECT_TRUE(buffer.subscribe().valid());
+    }
+    EXPECT_FALSE(buffer.subscribe().valid());
+}
+
+TEST_F(BroadcastRingBufferTest, ConcurrentConsumers) {
+    constexpr int CONSUMERS = 3;
+    constexpr int ITEMS = 50000;
+    BroadcastRingBuffer<int, 256, CONSUMERS> ring;
+    std::array<BroadcastRingBuffer<int, 256, CONSUMERS>::Consumer, CONSUMERS> handles;
+    for (auto& h : handles) h = ring.subscribe();
+
+    std::array<int64_t, CONSUMERS> sums{};
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < CONSUMERS; ++c) {
+        consumers.emplace_back([&, c]() {
+            std::array<int, 16> out;
+            int expected = 0;
+            while (expected < ITEMS) {
+                const size_t n = handles[c].try_pop_batch(out.begin(), out.end());
+                if (n == 0) std::this_thread::yield();
+                for (size_t i = 0; i < n; ++i) {
+                    if (out[i] != expected) return;
+                    sums[c] += out[i];
+                    ++expected;
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < ITEMS;) {
+        if (ring.try_push(i)) {
+            ++i;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& t : consumers) t.join();
+
+    const int64_t expected_sum = int64_t{ITEMS} * (ITEMS - 1) / 2;
+    for (int c = 0; c < CONSUMERS; ++c) {
+        EXPECT_EQ(sums[c], expected_sum);
+    }
+}
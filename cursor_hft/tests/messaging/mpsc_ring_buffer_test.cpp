@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <hft/messaging/mpsc_ring_buffer.hpp>
+
+using namespace hft;
+
+// Producer-tagged message for ordering checks
+struct TaggedMessage {
+    uint32_t producer;
+    uint32_t sequence;
+};
+
+class MPSCRingBufferTest : public ::testing::Test {
+protected:
+    static constexpr size_t BUFFER_SIZE = 1024;
+    MPSCRingBuffer<int, BUFFER_SIZE> buffer;
+};
+
+TEST_F(MPSCRingBufferTest, BasicPushPop) {
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_TRUE(buffer.try_push(42));
+    EXPECT_EQ(buffer.size(), 1);
+
+    int result = 0;
+    EXPECT_TRUE(buffer.try_pop(result));
+    EXPECT_EQ(result, 42);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(buffer.try_pop(result));
+}
+
+TEST_F(MPSCRingBufferTest, FullCapacityUsable) {
+    EXPECT_EQ(buffer.capacity(), BUFFER_SIZE);
+    for (size_t i = 0; i < BUFFER_SIZE; ++i) {
+        ASSERT_TRUE(buffer.try_push(static_cast<int>(i)));
+    }
+    EXPECT_TRUE(buffer.full());
+    EXPECT_FALSE(buffer.try_push(0));
+
+    // Wrap several laps
+    for (int lap = 0; lap < 3; ++lap) {
+        for (size_t i = 0; i < BUFFER_SIZE; ++i) {
+            int value = -1;
+            ASSERT_TRUE(buffer.try_pop(value));
+            ASSERT_TRUE(buffer.try_push(value));
+        }
+    }
+    for (size_t i = 0; i < BUFFER_SIZE; ++i) {
+        int value = -1;
+        ASSERT_TRUE(buffer.try_pop(value));
+        EXPECT_EQ(value, static_cast<int>(i));
+    }
+}
+
+TEST_F(MPSCRingBufferTest, BatchOperations) {
+    std::array<int, 100> input;
+    std::array<int, 100> output;
+    for (size_t i = 0; i < input.size(); ++i) input[i] = static_cast<int>(i);
+
+    EXPECT_EQ(buffer.try_push_batch(input.begin(), input.end()), 100);
+    EXPECT_EQ(buffer.try_pop_batch(output.begin(), output.begin() + 60), 60);
+    EXPECT_EQ(output[59], 59);
+    EXPECT_EQ(buffer.try_pop_batch(output.begin(), output.end()), 40);
+    EXPECT_EQ(output[0], 60);
+
+    // Partial batch when nearly full
+    for (size_t i = 0; i < BUFFER_SIZE - 30; ++i) ASSERT_TRUE(buffer.try_push(0));
+    EXPECT_EQ(buffer.try_push_batch(input.begin(), input.end()), 30);
+    EXPECT_TRUE(buffer.full());
+}
+
+TEST_F(MPSCRingBufferTest, ConcurrentProducersPreserveOrder) {
+    constexpr uint32_t PRODUCERS = 4;
+    constexpr uint32_t PER_PRODUCER = 20000;
+    MPSCRingBuffer<TaggedMessage, 1024> queue;
+    std::atomic<bool> start{false};
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p]() {
+            while (!start.load(std::memory_order_acquire)) {}
+            std::array<TaggedMessage, 8> batch;
+            uint32_t seq = 0;
+            while (seq < PER_PRODUCER) {
+                size_t pushed;
+                if (p % 2 == 0) {
+                    pushed = queue.try_push(TaggedMessage{p, seq}) ? 1 : 0;
+                } else {
+                    const uint32_t n = std::min<uint32_t>(batch.size(), PER_PRODUCER - seq);
+                    for (uint32_t i = 0; i < n; ++i) batch[i] = TaggedMessage{p, seq + i};
+                    pushed = queue.try_push_batch(batch.begin(), batch.begin() + n);
+                }
+                seq += static_cast<uint32_t>(pushed);
+                if (pushed == 0) std::this_thread::yield();
+            }
+        });
+    }
+
+    std::array<uint32_t, PRODUCERS> next_expected{};
+    std::array<TaggedMessage, 32> out;
+    uint64_t received = 0;
+    start.store(true, std::memory_order_release);
+    while (received < uint64_t{PRODUCERS} * PER_PRODUCER) {
+        const size_t n = queue.try_pop_batch(out.begin(), out.end());
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(out[i].sequence, next_expected[out[i].producer]);
+            ++next_expected[out[i].producer];
+        }
+        received += n;
+        if (n == 0) std::this_thread::yield();
+    }
+    for (auto& t : producers) t.join();
+    EXPECT_TRUE(queue.empty());
+}
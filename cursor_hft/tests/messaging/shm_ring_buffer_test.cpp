@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <hft/messaging/shm_ring_buffer.hpp>
+
+using namespace hft;
+
+namespace {
+struct Quote {
+    uint64_t sequence;
+    double bid;
+    double ask;
+    uint32_t instrument;
+    uint32_t flags;
+};
+
+std::string channel_name(const char* test) {
+    return "hft_shm_test_" + std::to_string(::getpid()) + "_" + test;
+}
+
+// Child side of a fork(): stream `count` quotes and optionally detach cleanly
+[[noreturn]] void produce_in_child(const std::string& name, uint64_t count, bool clean_close) {
+    ShmSPSCRingBuffer<Quote, 256> ring;
+    if (!ring.open(name.c_str(), ShmRole::PRODUCER)) ::_exit(2);
+    for (uint64_t i = 0; i < count;) {
+        if (ring.try_push(Quote{i, 99.0 + i, 99.5 + i, 4, 0})) {
+            ++i;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    if (clean_close) ring.close();
+    ::_exit(0);  // No destructors: without close() this looks like a crash
+}
+} // namespace
+
+TEST(ShmRingBufferTest, MatchesSpscInterfaceAcrossHandles) {
+    const std::string name = channel_name("interface");
+    ShmSPSCRingBuffer<uint64_t, 16> producer;
+    ShmSPSCRingBuffer<uint64_t, 16> consumer;
+    ASSERT_TRUE(producer.create(name.c_str(), ShmRole::PRODUCER));
+    ASSERT_TRUE(consumer.open(name.c_str(), ShmRole::CONSUMER));
+    EXPECT_TRUE(consumer.empty());
+    EXPECT_EQ((ShmSPSCRingBuffer<uint64_t, 16>::capacity()), 15u);
+
+    for (uint64_t i = 0; i < 15; ++i) ASSERT_TRUE(producer.try_push(i));
+    EXPECT_FALSE(producer.try_push(99));
+    EXPECT_TRUE(consumer.full());
+    EXPECT_EQ(consumer.size(), 15u);
+
+    std::array<uint64_t, 10> out{};
+    ASSERT_EQ(consumer.try_pop_batch(out.begin(), out.end()), 10u);
+    for (uint64_t i = 0; i < 10; ++i) EXPECT_EQ(out[i], i);
+
+    const std::array<uint64_t, 4> more{100, 101, 102, 103};
+    EXPECT_EQ(producer.try_push_batch(more.begin(), more.end()), 4u);
+    auto slots = producer.claim(1);
+    ASSERT_EQ(slots.size(), 1u);
+    slots[0] = 200;
+    producer.commit(1);
+
+    uint64_t value = 0;
+    for (uint64_t expected : {10, 11, 12, 13, 14, 100, 101, 102, 103, 200}) {
+        ASSERT_TRUE(consumer.try_pop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(consumer.try_pop(value));
+    EXPECT_TRUE((ShmSPSCRingBuffer<uint64_t, 16>::unlink(name.c_str())));
+}
+
+TEST(ShmRingBufferTest, RejectsDuplicateRoleAndMismatchedType) {
+    const std::string name = channel_name("reject");
+    ShmSPSCRingBuffer<uint64_t, 64> producer;
+    ASSERT_TRUE(producer.create(name.c_str(), ShmRole::PRODUCER));
+
+    ShmSPSCRingBuffer<uint64_t, 64> second_producer;
+    EXPECT_FALSE(second_producer.open(name.c_str(), ShmRole::PRODUCER));
+
+    ShmSPSCRingBuffer<uint32_t, 64> wrong_type;
+    EXPECT_FALSE(wrong_type.open(name.c_str(), ShmRole::CONSUMER));
+    ShmSPSCRingBuffer<uint64_t, 128> wrong_size;
+    EXPECT_FALSE(wrong_size.open(name.c_str(), ShmRole::CONSUMER));
+
+    ShmChannelOptions quick;
+    quick.open_timeout_ms = 5;
+    ShmSPSCRingBuffer<uint64_t, 64> missing;
+    EXPECT_FALSE(missing.open("hft_shm_test_no_such_channel", ShmRole::CONSUMER, quick));
+    EXPECT_FALSE(missing.open("bad/name", ShmRole::CONSUMER, quick));
+
+    // A closed role can be taken again
+    producer.close();
+    EXPECT_TRUE(second_producer.open(name.c_str(), ShmRole::PRODUCER));
+    ShmSPSCRingBuffer<uint64_t, 64>::unlink(name.c_str());
+}
+
+TEST(ShmRingBufferTest, StreamsInOrderFromAnotherProcess) {
+    constexpr uint64_t COUNT = 50000;
+    const std::string name = channel_name("stream");
+    ShmSPSCRingBuffer<Quote, 256> consumer;
+    ASSERT_TRUE(consumer.create(name.c_str(), ShmRole::CONSUMER));
+    EXPECT_EQ(consumer.peer_state(), ShmPeerState::NEVER_ATTACHED);
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) produce_in_child(name, COUNT, true);
+
+    Quote quote{};
+    for (uint64_t expected = 0; expected < COUNT;) {
+        if (consumer.try_pop(quote)) {
+            ASSERT_EQ(quote.sequence, expected);
+            ASSERT_DOUBLE_EQ(quote.bid, 99.0 + expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+    EXPECT_EQ(consumer.peer_state(), ShmPeerState::CLOSED);
+    EXPECT_EQ(consumer.peer_pid(), 0);
+    ShmSPSCRingBuffer<Quote, 256>::unlink(name.c_str());
+}
+
+TEST(ShmRingBufferTest, DetectsCrashedPeer) {
+    const std::string name = channel_name("crash");
+    ShmSPSCRingBuffer<Quote, 256> consumer;
+    ASSERT_TRUE(consumer.create(name.c_str(), ShmRole::CONSUMER));
+
+    int gate[2];
+    ASSERT_EQ(::pipe(gate), 0);
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        ::close(gate[1]);
+        ShmSPSCRingBuffer<Quote, 256> producer;
+        if (!producer.open(name.c_str(), ShmRole::PRODUCER) || !producer.try_push(Quote{7, 0, 0, 0, 0})) ::_exit(2);
+        char byte;
+        (void)::read(gate[0], &byte, 1);  // Hold the ring until the parent has looked
+        ::_exit(0);
+    }
+    ::close(gate[0]);
+
+    Quote quote{};
+    while (!consumer.try_pop(quote)) std::this_thread::yield();
+    EXPECT_EQ(quote.sequence, 7u);
+    EXPECT_EQ(consumer.peer_state(), ShmPeerState::ATTACHED);
+    EXPECT_EQ(consumer.peer_pid(), child);
+
+    ::close(gate[1]);
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    EXPECT_EQ(consumer.peer_state(), ShmPeerState::CRASHED);
+
+    // A restarted producer reattaches and carries on from the shared indices
+    ShmSPSCRingBuffer<Quote, 256> restarted;
+    ASSERT_TRUE(restarted.open(name.c_str(), ShmRole::PRODUCER));
+    EXPECT_EQ(consumer.peer_state(), ShmPeerState::ATTACHED);
+    ASSERT_TRUE(restarted.try_push(Quote{8, 0, 0, 0, 0}));
+    ASSERT_TRUE(consumer.try_pop(quote));
+    EXPECT_EQ(quote.sequence, 8u);
+    ShmSPSCRingBuffer<Quote, 256>::unlink(name.c_str());
+}
+
+TEST(ShmRingBufferTest, RegistryFindsChannelsByName) {
+    const std::string registry_name = channel_name("registry");
+    const std::string quotes = channel_name("registry_quotes");
+    const std::string orders = channel_name("registry_orders");
+    ShmChannelRegistry registry(registry_name.c_str());
+    ASSERT_TRUE(registry.is_open());
+
+    ShmSPSCRingBuffer<Quote, 256> quote_producer;
+    ShmSPSCRingBuffer<uint64_t, 1024> order_consumer;
+    ASSERT_TRUE(registry.create(quotes.c_str(), quote_producer, ShmRole::PRODUCER));
+    ASSERT_TRUE(registry.create(orders.c_str(), order_consumer, ShmRole::CONSUMER));
+
+    // Another component (here: another registry handle) looks them up
+    ShmChannelRegistry other(registry_name.c_str());
+    EXPECT_EQ(other.channels().size(), 2u);
+    ShmChannelInfo info{};
+    ASSERT_TRUE(other.find(quotes.c_str(), info));
+    EXPECT_EQ(info.element_size, sizeof(Quote));
+    EXPECT_EQ(info.slots, 256u);
+    EXPECT_EQ(info.creator_pid, ::getpid());
+
+    ShmSPSCRingBuffer<Quote, 256> quote_consumer;
+    ASSERT_TRUE(other.open(quotes.c_str(), quote_consumer, ShmRole::CONSUMER));
+    ASSERT_TRUE(quote_producer.try_push(Quote{42, 1, 2, 3, 0}));
+    Quote quote{};
+    ASSERT_TRUE(quote_consumer.try_pop(quote));
+    EXPECT_EQ(quote.sequence, 42u);
+
+    ShmSPSCRingBuffer<uint32_t, 1024> wrong;
+    EXPECT_FALSE(other.open(orders.c_str(), wrong, ShmRole::PRODUCER));
+
+    EXPECT_TRUE(registry.remove(quotes.c_str()));
+    EXPECT_TRUE(registry.remove(orders.c_str()));
+    EXPECT_FALSE(other.find(quotes.c_str(), info));
+    EXPECT_TRUE(other.channels().empty());
+    ::unlink(("/dev/shm/" + registry_name).c_str());
+}
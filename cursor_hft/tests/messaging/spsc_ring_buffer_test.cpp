@@ -82,6 +82,58 @@ TEST_F(SPSCRingBufferTest, BatchOperations) {
     }
 }
 
+// Test zero-copy claim/commit
+TEST_F(SPSCRingBufferTest, ClaimCommit) {
+    auto slots = buffer.claim(4);
+    ASSERT_EQ(slots.size(), 4);
+    for (size_t i = 0; i < slots.size(); ++i) {
+        slots[i] = static_cast<int>(100 + i);
+    }
+    EXPECT_TRUE(buffer.empty());  // Not visible before commit
+    
+    buffer.commit(3);  // Publish fewer than claimed
+    EXPECT_EQ(buffer.size(), 3);
+    
+    int value = 0;
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(buffer.try_pop(value));
+        EXPECT_EQ(value, 100 + i);
+    }
+    EXPECT_FALSE(buffer.try_pop(value));
+}
+
+// Claims never cross the end of storage and stop at full
+TEST_F(SPSCRingBufferTest, ClaimWrapAndFull) {
+    // Move head close to the end
+    for (size_t i = 0; i < BUFFER_SIZE - 2; ++i) {
+        ASSERT_TRUE(buffer.try_push(0));
+        int drained;
+        ASSERT_TRUE(buffer.try_pop(drained));
+    }
+    
+    auto tail_slots = buffer.claim(8);
+    EXPECT_EQ(tail_slots.size(), 2);
+    tail_slots[0] = 1;
+    tail_slots[1] = 2;
+    buffer.commit(2);
+    
+    auto wrapped = buffer.claim(8);
+    EXPECT_EQ(wrapped.size(), 8);
+    wrapped[0] = 3;
+    buffer.commit(1);
+    
+    std::array<int, 3> out{};
+    EXPECT_EQ(buffer.try_pop_batch(out.begin(), out.end()), 3);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[2], 3);
+    
+    // Full buffer yields an empty claim
+    for (size_t i = 0; i < buffer.capacity(); ++i) {
+        ASSERT_TRUE(buffer.try_push(static_cast<int>(i)));
+    }
+    EXPECT_TRUE(buffer.claim(1).empty());
+}
+
 // Test concurrent producer/consumer
 TEST_F(SPSCRingBufferTest, ConcurrentProducerConsumer) {
     static constexpr size_t NUM_ITEMS = 1000000;
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <hft/messaging/wait_strategy.hpp>
+#include <hft/messaging/spsc_ring_buffer.hpp>
+#include <hft/messaging/mpsc_ring_buffer.hpp>
+
+using namespace hft;
+
+namespace {
+constexpr int ITEMS = 20000;
+
+template<typename Wait>
+void stream_items(Wait& wait) {
+    SPSCRingBuffer<int, 256> ring;
+    std::thread producer([&]() {
+        for (int i = 0; i < ITEMS;) {
+            if (push_and_notify(ring, wait, i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (int expected = 0; expected < ITEMS; ++expected) {
+        int value = -1;
+        pop_wait(ring, wait, value);
+        ASSERT_EQ(value, expected);
+    }
+    producer.join();
+}
+} // namespace
+
+TEST(WaitStrategyTest, SpinWaitDeliversInOrder) {
+    SpinWait wait;
+    stream_items(wait);
+}
+
+TEST(WaitStrategyTest, SpinYieldWaitDeliversInOrder) {
+    SpinYieldWait<> wait;
+    stream_items(wait);
+}
+
+TEST(WaitStrategyTest, ParkingWaitDeliversInOrder) {
+    ParkingWait<16> wait;
+    stream_items(wait);
+}
+
+TEST(WaitStrategyTest, ParkedConsumerIsWoken) {
+    SPSCRingBuffer<int, 16> ring;
+    ParkingWait<1> wait;
+    std::atomic<int> received{-1};
+
+    std::thread consumer([&]() {
+        int value = -1;
+        pop_wait(ring, wait, value);
+        received.store(value);
+    });
+
+    // Give the consumer time to park
+    for (int i = 0; i < 1000 && wait.parked_consumers() == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(wait.parked_consumers(), 1u);
+
+    ASSERT_TRUE(push_and_notify(ring, wait, 7));
+    consumer.join();
+    EXPECT_EQ(received.load(), 7);
+    EXPECT_EQ(wait.parked_consumers(), 0u);
+}
+
+TEST(WaitStrategyTest, StopReleasesParkedConsumer) {
+    MPSCRingBuffer<int, 16> ring;
+    ParkingWait<1> wait;
+    std::atomic<bool> stop{false};
+    std::atomic<bool> result{true};
+
+    std::thread consumer([&]() {
+        int value = 0;
+        result.store(pop_wait(ring, wait, value, stop));
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    stop.store(true, std::memory_order_release);
+    wait.notify_all();
+    consumer.join();
+    EXPECT_FALSE(result.load());
+}
+
+TEST(WaitStrategyTest, NotifyWithoutParkedConsumerIsCheap) {
+    ParkingWait<> wait;
+    EXPECT_EQ(wait.parked_consumers(), 0u);
+    for (int i = 0; i < 1000; ++i) {
+        wait.notify();  // Must not block or change state
+    }
+    EXPECT_EQ(wait.parked_consumers(), 0u);
+}
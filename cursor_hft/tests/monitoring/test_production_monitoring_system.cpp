@@ -2,6 +2,7 @@
 #include <memory>
 #include <thread>
 #include <chrono>
+#include <algorithm>
 #include "hft/monitoring/production_monitoring_system.hpp"
 #include "hft/memory/object_pool.hpp"
 #include "hft/messaging/spsc_ring_buffer.hpp"
@@ -471,4 +472,150 @@ TEST_F(ProductionMonitoringSystemTest, EdgeCasesAndErrorHandling) {
         99999, ProductionMonitoringSystem::ComponentHealth::HEALTHY, 0.0, 0.0);
     
     // Should not crash
-}
\ No newline at end of file
+}
+
+// Test sharded recording: posts are raw until the aggregator applies them
+TEST_F(ProductionMonitoringSystemTest, ShardedMetricsAggregateOffHotPath) {
+    const uint64_t component_id = monitoring_system_->register_component(
+        "ShardTest", ProductionMonitoringSystem::ComponentType::CUSTOM);
+    
+    ProductionMonitoringSystem::AlertConfig config;
+    config.metric_type = ProductionMonitoringSystem::MetricType::LATENCY;
+    config.warning_threshold = 1000.0;
+    config.critical_threshold = 5000.0;
+    config.emergency_threshold = 10000.0;
+    config.enabled = true;
+    monitoring_system_->configure_alert(component_id, 1, config);
+    
+    const int shard = monitoring_system_->register_metric_shard();
+    ASSERT_GE(shard, 0);
+    const auto before = hft::HFTTimer::get_timestamp_ns();
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(monitoring_system_->post_metric(shard, component_id, 1,
+                                                    ProductionMonitoringSystem::MetricType::LATENCY, 2000.0));
+    }
+    ASSERT_TRUE(monitoring_system_->post_metric(shard, 99999, 1,
+                                                ProductionMonitoringSystem::MetricType::LATENCY, 2000.0));
+    
+    // Nothing is applied on the recording thread
+    EXPECT_EQ(monitoring_system_->get_monitoring_metrics().metrics_collected.load(), 0);
+    EXPECT_TRUE(monitoring_system_->get_metric_history(component_id, 1).empty());
+    EXPECT_TRUE(monitoring_system_->get_active_alerts().empty());
+    
+    EXPECT_EQ(monitoring_system_->aggregate_metrics(), 11u);
+    EXPECT_EQ(monitoring_system_->get_monitoring_metrics().metrics_collected.load(), 10);
+    const auto history = monitoring_system_->get_metric_history(component_id, 1, 20);
+    ASSERT_EQ(history.size(), 10u);
+    EXPECT_GE(history.front().timestamp_ns, before);
+    EXPECT_LE(history.back().timestamp_ns, hft::HFTTimer::get_timestamp_ns());
+    EXPECT_EQ(history.back().sample_count, 10u);
+    EXPECT_FALSE(monitoring_system_->get_active_alerts(ProductionMonitoringSystem::AlertSeverity::WARNING).empty());
+    EXPECT_EQ(monitoring_system_->aggregate_metrics(), 0u);
+    
+    // A full shard drops and counts instead of blocking
+    size_t accepted = 0;
+    for (size_t i = 0; i < ProductionMonitoringSystem::METRIC_SHARD_SIZE + 10; ++i) {
+        accepted += monitoring_system_->post_metric(shard, component_id, 2,
+                                                    ProductionMonitoringSystem::MetricType::COUNT, 1.0);
+    }
+    EXPECT_EQ(accepted, ProductionMonitoringSystem::METRIC_SHARD_SIZE - 1);
+    EXPECT_EQ(monitoring_system_->dropped_metric_samples(), 11u);
+    
+    // Shards run out at MAX_METRIC_SHARDS
+    for (size_t i = 1; i < ProductionMonitoringSystem::MAX_METRIC_SHARDS; ++i) {
+        EXPECT_GE(monitoring_system_->register_metric_shard(), 0);
+    }
+    EXPECT_EQ(monitoring_system_->register_metric_shard(), -1);
+}
+
+// Test the aggregator thread draining several recording threads
+TEST_F(ProductionMonitoringSystemTest, AggregatorThreadDrainsRecordingThreads) {
+    constexpr int THREADS = 4;
+    constexpr int SAMPLES = 20000;
+    std::array<uint64_t, THREADS> component_ids{};
+    for (auto& id : component_ids) {
+        id = monitoring_system_->register_component("Recorder", ProductionMonitoringSystem::ComponentType::CUSTOM);
+    }
+    ASSERT_TRUE(monitoring_system_->start_aggregator(10000));
+    EXPECT_FALSE(monitoring_system_->start_aggregator());
+    
+    std::vector<std::thread> recorders;
+    for (int t = 0; t < THREADS; ++t) {
+        recorders.emplace_back([this, t, &component_ids] {
+            const int shard = monitoring_system_->register_metric_shard();
+            ASSERT_GE(shard, 0);
+            for (int i = 0; i < SAMPLES;) {
+                if (monitoring_system_->post_metric(shard, component_ids[t], 3,
+                                                    ProductionMonitoringSystem::MetricType::THROUGHPUT, 100.0)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& recorder : recorders) recorder.join();
+    monitoring_system_->stop_aggregator();
+    EXPECT_FALSE(monitoring_system_->aggregator_running());
+    
+    const auto& metrics = monitoring_system_->get_monitoring_metrics();
+    EXPECT_EQ(metrics.shard_samples_aggregated.load(), static_cast<uint64_t>(THREADS * SAMPLES));
+    EXPECT_EQ(metrics.metrics_collected.load(), static_cast<uint64_t>(THREADS * SAMPLES));
+    const auto snapshot = monitoring_system_->generate_dashboard_snapshot();
+    EXPECT_DOUBLE_EQ(snapshot.total_throughput_ops_sec, 100.0 * THREADS);
+}
+
+// Test hot-path cost of a sharded post against the inline path it replaces
+TEST_F(ProductionMonitoringSystemTest, ShardedPostPerformance) {
+    const uint64_t component_id = monitoring_system_->register_component(
+        "PostPerf", ProductionMonitoringSystem::ComponentType::CUSTOM);
+    const int shard = monitoring_system_->register_metric_shard();
+    ASSERT_GE(shard, 0);
+    
+    // Best round of each: preemption on a shared host only ever adds time
+    constexpr int BATCH = 2048;
+    constexpr int ROUNDS = 50;
+    uint64_t stamped_best = UINT64_MAX;
+    uint64_t supplied_best = UINT64_MAX;
+    uint64_t inline_best = UINT64_MAX;
+    for (int round = 0; round < ROUNDS; ++round) {
+        auto start_time = hft::HFTTimer::get_timestamp_ns();
+        for (int i = 0; i < BATCH; ++i) {
+            (void)monitoring_system_->post_metric(shard, component_id, 1,
+                                                  ProductionMonitoringSystem::MetricType::LATENCY, 100.0 + i);
+        }
+        stamped_best = std::min(stamped_best, hft::HFTTimer::get_timestamp_ns() - start_time);
+        (void)monitoring_system_->aggregate_metrics();
+        
+        // Instrumented code usually holds a counter reading already
+        const uint64_t cycles = hft::HFTTimer::get_cycles();
+        start_time = hft::HFTTimer::get_timestamp_ns();
+        for (int i = 0; i < BATCH; ++i) {
+            (void)monitoring_system_->post_metric(shard, component_id, 1,
+                                                  ProductionMonitoringSystem::MetricType::LATENCY, 100.0 + i, cycles);
+        }
+        supplied_best = std::min(supplied_best, hft::HFTTimer::get_timestamp_ns() - start_time);
+        (void)monitoring_system_->aggregate_metrics();
+        
+        start_time = hft::HFTTimer::get_timestamp_ns();
+        for (int i = 0; i < BATCH; ++i) {
+            monitoring_system_->record_metric(component_id, 1,
+                                              ProductionMonitoringSystem::MetricType::LATENCY, 100.0 + i);
+        }
+        inline_best = std::min(inline_best, hft::HFTTimer::get_timestamp_ns() - start_time);
+    }
+    
+    const double stamped_avg = static_cast<double>(stamped_best) / BATCH;
+    const double supplied_avg = static_cast<double>(supplied_best) / BATCH;
+    const double inline_avg = static_cast<double>(inline_best) / BATCH;
+    std::cout << "Sharded Metric Post Performance:" << std::endl;
+    std::cout << "  Self-stamped: " << stamped_avg << "ns" << std::endl;
+    std::cout << "  Caller-stamped: " << supplied_avg << "ns" << std::endl;
+    std::cout << "  Inline record_metric: " << inline_avg << "ns" << std::endl;
+    std::cout << "  Target: <10ns" << std::endl;
+    
+    // Relative, so it holds under parallel ctest and on small hosts
+    EXPECT_EQ(monitoring_system_->dropped_metric_samples(), 0u);
+    EXPECT_LT(supplied_avg, inline_avg);
+    EXPECT_LT(stamped_avg, inline_avg);
+}
@@ -0,0 +1,302 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "hft/monitoring/telemetry.hpp"
+
+using namespace hft::monitoring;
+
+/**
+ * @brief Test fixture for TelemetryPublisher, TelemetryReader and TelemetryExporter
+ *
+ * Each test publishes into its own /dev/shm region, removed afterwards.
+ */
+class TelemetryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        metric_pool_ = std::make_unique<hft::ObjectPool<ProductionMonitoringSystem::MetricSample, 10000>>();
+        alert_buffer_ = std::make_unique<hft::SPSCRingBuffer<ProductionMonitoringSystem::Alert, 1024>>();
+        monitoring_ = std::make_unique<ProductionMonitoringSystem>(*metric_pool_, *alert_buffer_);
+        region_ = "hft_tlm_" + std::to_string(::getpid()) + "_" +
+                  ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    void TearDown() override { TelemetryPublisher::unlink(region_.c_str()); }
+
+    uint64_t populate() {
+        const uint64_t feed = monitoring_->register_component("feed \"A\"", ProductionMonitoringSystem::ComponentType::FEED_HANDLER);
+        ProductionMonitoringSystem::AlertConfig config;
+        config.metric_type = ProductionMonitoringSystem::MetricType::LATENCY;
+        config.warning_threshold = 500.0;
+        config.critical_threshold = 5000.0;
+        config.emergency_threshold = 10000.0;
+        config.enabled = true;
+        monitoring_->configure_alert(feed, 1, config);
+        monitoring_->record_metric(feed, 1, ProductionMonitoringSystem::MetricType::LATENCY, 800.0);
+        monitoring_->record_metric(feed, 2, ProductionMonitoringSystem::MetricType::THROUGHPUT, 250000.0);
+        return feed;
+    }
+
+    template<typename Predicate>
+    static bool wait_for(Predicate predicate, std::chrono::milliseconds limit = std::chrono::milliseconds(2000)) {
+        const auto deadline = std::chrono::steady_clock::now() + limit;
+        while (!predicate()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return true;
+    }
+
+    std::unique_ptr<hft::ObjectPool<ProductionMonitoringSystem::MetricSample, 10000>> metric_pool_;
+    std::unique_ptr<hft::SPSCRingBuffer<ProductionMonitoringSystem::Alert, 1024>> alert_buffer_;
+    std::unique_ptr<ProductionMonitoringSystem> monitoring_;
+    std::string region_;
+};
+
+TEST_F(TelemetryTest, ReaderSeesPublishedFrameAndHistogramDeltas) {
+    const uint64_t feed = populate();
+    hft::HdrHistogram<> tick_to_trade;
+    for (int i = 0; i < 100; ++i) tick_to_trade.record_latency(1000);
+
+    TelemetryPublisher publisher(*monitoring_);
+    ASSERT_TRUE(publisher.create(region_.c_str()));
+    ASSERT_TRUE(publisher.add_histogram("tick_to_trade", tick_to_trade));
+
+    TelemetryReader reader;
+    ASSERT_TRUE(reader.open(region_.c_str()));
+    EXPECT_EQ(reader.publisher_pid(), ::getpid());
+    auto frame = std::make_unique<TelemetryFrame>();
+    EXPECT_FALSE(reader.read(*frame));  // Nothing published yet
+
+    publisher.publish();
+    ASSERT_TRUE(reader.read(*frame));
+    EXPECT_EQ(frame->sequence, 1u);
+    EXPECT_EQ(frame->dashboard.total_components, 1u);
+    ASSERT_EQ(frame->component_count, 1u);
+    EXPECT_STREQ(frame->components[0].name, "feed \"A\"");
+    ASSERT_EQ(frame->metric_count, 2u);
+    EXPECT_EQ(frame->metrics[0].component_id, feed);
+    EXPECT_DOUBLE_EQ(frame->metrics[0].value, 800.0);
+    EXPECT_DOUBLE_EQ(frame->metrics[1].avg_value, 250000.0);
+    ASSERT_EQ(frame->alert_count, 1u);
+    EXPECT_EQ(frame->alerts[0].severity, ProductionMonitoringSystem::AlertSeverity::WARNING);
+
+    ASSERT_EQ(frame->histogram_count, 1u);
+    const auto& first = frame->histograms[0];
+    EXPECT_STREQ(first.name, "tick_to_trade");
+    EXPECT_EQ(first.total_samples, 100u);
+    EXPECT_EQ(first.interval_samples, 100u);
+    EXPECT_EQ(first.buckets[10], 100u);  // 1000ns <= 2^10 - 1
+    EXPECT_GE(first.interval_p99_ns, 1000u);
+
+    // The next publish carries only what was recorded since
+    for (int i = 0; i < 10; ++i) tick_to_trade.record_latency(50000);
+    publisher.publish();
+    ASSERT_TRUE(reader.read(*frame));
+    const auto& second = frame->histograms[0];
+    EXPECT_EQ(frame->sequence, 2u);
+    EXPECT_EQ(second.total_samples, 110u);
+    EXPECT_EQ(second.interval_samples, 10u);
+    EXPECT_EQ(second.interval_buckets[10], 0u);
+    EXPECT_EQ(second.interval_buckets[16], 10u);
+    EXPECT_GE(second.interval_p50_ns, 50000u);
+    EXPECT_LT(second.interval_p50_ns, 65536u);
+    EXPECT_GT(frame->interval_ns, 0u);
+}
+
+TEST_F(TelemetryTest, OpenMetricsTextRendersEveryFamily) {
+    populate();
+    hft::ShardedLatencyHistogram<> order_ack;
+    auto* shard = order_ack.attach();
+    ASSERT_NE(shard, nullptr);
+    shard->record_latency(3);
+    shard->record_latency(700);
+
+    TelemetryPublisher publisher(*monitoring_);
+    ASSERT_TRUE(publisher.create(region_.c_str()));
+    ASSERT_TRUE(publisher.add_histogram("order_ack", order_ack));
+    publisher.publish();
+    TelemetryReader reader;
+    ASSERT_TRUE(reader.open(region_.c_str()));
+    auto frame = std::make_unique<TelemetryFrame>();
+    ASSERT_TRUE(reader.read(*frame));
+
+    std::string text;
+    write_openmetrics(*frame, text);
+    EXPECT_NE(text.find("hft_telemetry_publishes_total 1\n"), std::string::npos);
+    EXPECT_NE(text.find("hft_components{state=\"healthy\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("hft_component_health{component=\"feed \\\"A\\\"\",component_id=\"1\",health=\"healthy\"} 1\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("hft_metric_value{component=\"feed \\\"A\\\"\",component_id=\"1\",metric_id=\"1\",type=\"latency\"} 800\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("hft_alert_value{"), std::string::npos);
+    EXPECT_NE(text.find("hft_latency_ns_bucket{name=\"order_ack\",le=\"3\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("hft_latency_ns_bucket{name=\"order_ack\",le=\"1023\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("hft_latency_ns_bucket{name=\"order_ack\",le=\"+Inf\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("hft_latency_ns_count{name=\"order_ack\"} 2\n"), std::string::npos);
+    ASSERT_GE(text.size(), 6u);
+    EXPECT_EQ(text.substr(text.size() - 6), "# EOF\n");
+
+    // Every family is declared once, before its samples
+    EXPECT_EQ(text.find("# TYPE hft_metric_value gauge"), text.rfind("# TYPE hft_metric_value gauge"));
+    EXPECT_LT(text.find("# TYPE hft_latency_ns histogram"), text.find("hft_latency_ns_bucket"));
+}
+
+TEST_F(TelemetryTest, ExporterServesScrapesAndStreamsDatagrams) {
+    populate();
+    TelemetryPublisher publisher(*monitoring_);
+    TelemetryOptions options;
+    options.publish_interval_ns = 2000000;
+    ASSERT_TRUE(publisher.create(region_.c_str(), options));
+    ASSERT_TRUE(publisher.start());
+
+    // Local receiver for the binary stream
+    const int receiver = ::socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(receiver, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(receiver, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    socklen_t len = sizeof(addr);
+    ASSERT_EQ(::getsockname(receiver, reinterpret_cast<sockaddr*>(&addr), &len), 0);
+
+    TelemetryReader reader;
+    ASSERT_TRUE(reader.open(region_.c_str()));
+    TelemetryExporterConfig config;
+    config.udp_address = "127.0.0.1";
+    config.udp_port = ntohs(addr.sin_port);
+    TelemetryExporter exporter(reader, config);
+    ASSERT_TRUE(exporter.start());
+    ASSERT_NE(exporter.bound_port(), 0);
+    ASSERT_TRUE(wait_for([&] { return exporter.frames_streamed() > 0; }));
+
+    // Dashboard datagram leads each frame, then the metric records
+    alignas(8) uint8_t datagram[TELEMETRY_DATAGRAM_BYTES];
+    pollfd pfd{receiver, POLLIN, 0};
+    ASSERT_GT(::poll(&pfd, 1, 1000), 0);
+    ssize_t length = ::recv(receiver, datagram, sizeof(datagram), 0);
+    ASSERT_GE(length, static_cast<ssize_t>(sizeof(TelemetryDatagramHeader)));
+    TelemetryDatagramHeader header{};
+    std::memcpy(&header, datagram, sizeof(header));
+    EXPECT_EQ(header.magic, TELEMETRY_STREAM_MAGIC);
+    EXPECT_EQ(header.type, TelemetryRecordType::DASHBOARD);
+    EXPECT_EQ(header.fragment, 0u);
+    EXPECT_EQ(header.fragment_count, 2u);
+    ProductionMonitoringSystem::DashboardSnapshot dashboard;
+    std::memcpy(&dashboard, datagram + sizeof(header), sizeof(dashboard));
+    EXPECT_EQ(dashboard.total_components, 1u);
+
+    ASSERT_GT(::poll(&pfd, 1, 1000), 0);
+    length = ::recv(receiver, datagram, sizeof(datagram), 0);
+    std::memcpy(&header, datagram, sizeof(header));
+    EXPECT_EQ(header.type, TelemetryRecordType::METRIC);
+    ASSERT_EQ(header.record_count, 2u);
+    EXPECT_EQ(static_cast<size_t>(length), sizeof(header) + 2 * sizeof(TelemetryWireMetric));
+    TelemetryWireMetric metric{};
+    std::memcpy(&metric, datagram + sizeof(header), sizeof(metric));
+    EXPECT_EQ(metric.metric_id, 1u);
+    EXPECT_DOUBLE_EQ(metric.value, 800.0);
+
+    // Scrape over HTTP
+    const int client = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(client, 0);
+    sockaddr_in http{};
+    http.sin_family = AF_INET;
+    http.sin_port = htons(exporter.bound_port());
+    http.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::connect(client, reinterpret_cast<sockaddr*>(&http), sizeof(http)), 0);
+    const char request[] = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    ASSERT_EQ(::send(client, request, sizeof(request) - 1, 0), static_cast<ssize_t>(sizeof(request) - 1));
+    std::string response;
+    char chunk[4096];
+    for (ssize_t n; (n = ::recv(client, chunk, sizeof(chunk), 0)) > 0;) response.append(chunk, static_cast<size_t>(n));
+    ::close(client);
+    EXPECT_EQ(response.rfind("HTTP/1.1 200 OK\r\n", 0), 0u);
+    EXPECT_NE(response.find("application/openmetrics-text"), std::string::npos);
+    EXPECT_NE(response.find("hft_metric_avg{"), std::string::npos);
+    EXPECT_EQ(response.substr(response.size() - 6), "# EOF\n");
+    EXPECT_TRUE(wait_for([&] { return exporter.scrapes_served() == 1; }));
+
+    exporter.stop();
+    publisher.stop();
+    ::close(receiver);
+}
+
+TEST_F(TelemetryTest, StartedPublisherPublishesFromAggregatorThread) {
+    const uint64_t feed = populate();
+    TelemetryPublisher publisher(*monitoring_);
+    TelemetryOptions options;
+    options.publish_interval_ns = 1000000;
+    ASSERT_TRUE(publisher.create(region_.c_str(), options));
+
+    // The aggregator is the only writer of the state publish() reads
+    ASSERT_TRUE(monitoring_->start_aggregator());
+    EXPECT_FALSE(publisher.start());
+    monitoring_->stop_aggregator();
+    ASSERT_TRUE(publisher.start());
+    EXPECT_TRUE(monitoring_->aggregator_running());
+
+    // Samples posted from a recording thread reach the frame through the aggregator
+    const int shard = monitoring_->register_metric_shard();
+    ASSERT_GE(shard, 0);
+    ASSERT_TRUE(monitoring_->post_metric(static_cast<size_t>(shard), feed, 3,
+                                         ProductionMonitoringSystem::MetricType::THROUGHPUT, 42.0));
+    TelemetryReader reader;
+    ASSERT_TRUE(reader.open(region_.c_str()));
+    auto frame = std::make_unique<TelemetryFrame>();
+    EXPECT_TRUE(wait_for([&] { return reader.read(*frame) && frame->metric_count == 3; }));
+
+    // Stopping publishes the final drain and stops the aggregator it started
+    ASSERT_TRUE(monitoring_->post_metric(static_cast<size_t>(shard), feed, 4,
+                                         ProductionMonitoringSystem::MetricType::THROUGHPUT, 7.0));
+    publisher.stop();
+    EXPECT_FALSE(monitoring_->aggregator_running());
+    ASSERT_TRUE(reader.read(*frame));
+    EXPECT_EQ(frame->metric_count, 4u);
+    EXPECT_EQ(frame->sequence, publisher.publishes());
+}
+
+TEST_F(TelemetryTest, ReaderInAnotherProcessNeverSeesTornFrames) {
+    constexpr uint32_t PUBLISHES = 2000;
+    const uint64_t feed = monitoring_->register_component("seq", ProductionMonitoringSystem::ComponentType::CUSTOM);
+    TelemetryPublisher publisher(*monitoring_);
+    ASSERT_TRUE(publisher.create(region_.c_str()));
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        // Sequence leads the frame, the metric's sample count sits 16KB+ further in
+        TelemetryReader reader;
+        while (!reader.open(region_.c_str())) std::this_thread::yield();
+        auto frame = std::make_unique<TelemetryFrame>();
+        uint64_t last = 0;
+        while (last < PUBLISHES) {
+            if (!reader.read(*frame)) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (frame->sequence < last || frame->metric_count != 1 ||
+                frame->metrics[0].sample_count != frame->sequence ||
+                frame->metrics[0].value != static_cast<double>(frame->sequence)) {
+                ::_exit(1);
+            }
+            last = frame->sequence;
+        }
+        ::_exit(0);
+    }
+
+    for (uint32_t i = 1; i <= PUBLISHES; ++i) {
+        monitoring_->record_metric(feed, 0, ProductionMonitoringSystem::MetricType::COUNT, static_cast<double>(i));
+        publisher.publish();
+        if (i % 64 == 0) std::this_thread::yield();
+    }
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+    EXPECT_EQ(publisher.publishes(), PUBLISHES);
+}
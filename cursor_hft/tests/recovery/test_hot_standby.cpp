@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include "hft/recovery/hot_standby.hpp"
+#include "hft/trading/book_manager.hpp"
+
+using namespace hft::recovery;
+using namespace hft::trading;
+using namespace hft::market_data;
+using hft::monitoring::ProductionMonitoringSystem;
+
+/**
+ * @brief One node's trading state
+ */
+struct NodeState {
+    NodeState()
+        : books(std::make_unique<BookManager>()),
+          orders(std::make_unique<OrderLifecycleManager>(books->order_pool(), books->level_pool(), books->update_buffer())),
+          settlement_pool(std::make_unique<hft::ObjectPool<PositionReconciliationManager::SettlementInstruction, 1024>>()),
+          break_buffer(std::make_unique<hft::SPSCRingBuffer<PositionReconciliationManager::PositionBreak, 1024>>()),
+          positions(std::make_unique<PositionReconciliationManager>(*orders, *settlement_pool, *break_buffer)),
+          risk(std::make_unique<RiskControlSystem>()) {}
+
+    RecoveryComponents components() const { return {orders.get(), positions.get(), risk.get()}; }
+
+    uint64_t buy(TreasuryType instrument, uint64_t quantity) {
+        return orders->create_order(instrument, OrderSide::BID, OrderType::LIMIT, Price32nd::from_decimal(100.0), quantity);
+    }
+
+    void fill(uint64_t order_id, uint64_t quantity) {
+        OrderLifecycleManager::OrderExecution execution;
+        execution.order_id = order_id;
+        execution.executed_quantity = quantity;
+        ASSERT_TRUE(orders->process_fill(execution));
+        const auto* order = orders->get_order(order_id);
+        ASSERT_NE(order, nullptr);
+        ASSERT_TRUE(positions->update_position(order->instrument, OrderLifecycleManager::VenueType::ECN, order->side,
+                                               quantity, Price32nd::from_decimal(100.0), order_id));
+        risk->update_position(order->instrument, static_cast<int64_t>(quantity), Price32nd::from_decimal(100.0));
+    }
+
+    std::unique_ptr<BookManager> books;
+    std::unique_ptr<OrderLifecycleManager> orders;
+    std::unique_ptr<hft::ObjectPool<PositionReconciliationManager::SettlementInstruction, 1024>> settlement_pool;
+    std::unique_ptr<hft::SPSCRingBuffer<PositionReconciliationManager::PositionBreak, 1024>> break_buffer;
+    std::unique_ptr<PositionReconciliationManager> positions;
+    std::unique_ptr<RiskControlSystem> risk;
+};
+
+/**
+ * @brief Test fixture for JournalShipper and HotStandby
+ *
+ * Primary and standby run in one process over loopback TCP; the primary
+ * journals to its own files under /tmp, removed afterwards.
+ */
+class HotStandbyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        base_path_ = "/tmp/hft_hot_standby_test_" + std::to_string(::getpid()) + "_" +
+                     ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    void TearDown() override {
+        for (uint32_t generation = 0; generation < 16; ++generation) {
+            ::unlink(hft::trading::detail::journal_path(base_path_, "journal", generation).c_str());
+            ::unlink(hft::trading::detail::journal_path(base_path_, "snapshot", generation).c_str());
+        }
+    }
+
+    template<typename Predicate>
+    static bool wait_for(Predicate predicate, std::chrono::milliseconds limit = std::chrono::milliseconds(2000)) {
+        const auto deadline = std::chrono::steady_clock::now() + limit;
+        while (!predicate()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        return true;
+    }
+
+    std::string base_path_;
+};
+
+TEST_F(HotStandbyTest, StandbyTracksPrimaryAndTakesOverOnLinkLoss) {
+    NodeState primary;
+    WarmRestart restart(base_path_, primary.components());
+    ASSERT_TRUE(restart.start_fresh());
+    ReplicationConfig config;
+    config.batch_entries = 16;
+    JournalShipper shipper(base_path_, config);
+    ASSERT_TRUE(shipper.start());
+
+    NodeState standby_state;
+    config.port = shipper.bound_port();
+    HotStandby standby(standby_state.components(), config);
+    std::atomic<bool> took_over{false};
+    standby.set_takeover_callback([&](const HotStandby::TakeoverStats&) { took_over.store(true); });
+    ASSERT_TRUE(standby.start());
+    ASSERT_TRUE(wait_for([&] { return shipper.connected(); }));
+
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < 200; ++i) {
+        ids.push_back(primary.buy(static_cast<TreasuryType>(2 + i % 4), 2000000));
+        ASSERT_NE(ids.back(), 0u);
+        if (i % 3 == 0) primary.fill(ids.back(), 1000000);
+        if (i == 100) {
+            // Rotation mid-stream: the standby follows into the next generation
+            ASSERT_TRUE(restart.take_snapshot());
+            ASSERT_TRUE(restart.poll_snapshot(true));
+        }
+    }
+    primary.fill(ids[1], 2000000);
+    ASSERT_TRUE(primary.orders->retire_order(ids[1]));
+
+    const uint64_t head = restart.journal().next_sequence() - 1;
+    ASSERT_TRUE(wait_for([&] { return standby.applied_sequence() == head; }));
+    EXPECT_TRUE(wait_for([&] { return shipper.acked_sequence() == head; }));
+    EXPECT_EQ(standby.lag_entries(), 0u);
+    EXPECT_FALSE(standby.promoted());
+
+    // Positions and risk are live on the standby before any takeover
+    for (int inst = 2; inst < 6; ++inst) {
+        const auto instrument = static_cast<TreasuryType>(inst);
+        EXPECT_EQ(standby_state.positions->get_net_position(instrument), primary.positions->get_net_position(instrument));
+        EXPECT_EQ(standby_state.risk->get_instrument_risk(instrument).net_position,
+                  primary.risk->get_instrument_risk(instrument).net_position);
+    }
+
+    // Lag and apply rate go to the monitoring system
+    auto metric_pool = std::make_unique<hft::ObjectPool<ProductionMonitoringSystem::MetricSample, 10000>>();
+    auto alert_buffer = std::make_unique<hft::SPSCRingBuffer<ProductionMonitoringSystem::Alert, 1024>>();
+    auto monitoring = std::make_unique<ProductionMonitoringSystem>(*metric_pool, *alert_buffer);
+    const uint64_t link_id = monitoring->register_component("standby_link", ProductionMonitoringSystem::ComponentType::NETWORK);
+    standby.publish_metrics(*monitoring, link_id);
+    standby.publish_metrics(*monitoring, link_id);
+    EXPECT_FALSE(monitoring->get_metric_history(link_id, HotStandby::METRIC_LAG_ENTRIES).empty());
+    EXPECT_FALSE(monitoring->get_metric_history(link_id, HotStandby::METRIC_APPLY_RATE).empty());
+    EXPECT_EQ(monitoring->get_component_status(link_id).health, ProductionMonitoringSystem::ComponentHealth::HEALTHY);
+
+    // Primary goes away: the standby installs its orders and takes over
+    shipper.stop();
+    ASSERT_TRUE(wait_for([&] { return standby.promoted() && took_over.load(); }));
+    EXPECT_TRUE(standby.takeover_stats().primary_closed);
+    EXPECT_EQ(standby.takeover_stats().last_sequence, head);
+    EXPECT_EQ(standby.takeover_stats().orders_installed, ids.size() - 1);
+    for (size_t i = 0; i < ids.size(); i += 7) {
+        if (i == 1) continue;
+        const auto* expected = primary.orders->get_order(ids[i]);
+        const auto* actual = standby_state.orders->get_order(ids[i]);
+        ASSERT_NE(actual, nullptr);
+        EXPECT_EQ(actual->state, expected->state);
+        EXPECT_EQ(actual->leaves_quantity, expected->leaves_quantity);
+    }
+    EXPECT_EQ(standby_state.orders->get_order(ids[1]), nullptr);
+    EXPECT_FALSE(standby.promote());
+}
+
+TEST_F(HotStandbyTest, SilentPrimaryTriggersTakeoverWithinHeartbeatTimeout) {
+    // A peer that accepts the connection and then never speaks
+    const int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(listener, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    ASSERT_EQ(::listen(listener, 1), 0);
+    socklen_t len = sizeof(addr);
+    ASSERT_EQ(::getsockname(listener, reinterpret_cast<sockaddr*>(&addr), &len), 0);
+
+    NodeState standby_state;
+    ReplicationConfig config;
+    config.port = ntohs(addr.sin_port);
+    HotStandby standby(standby_state.components(), config);
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(standby.start());
+    ASSERT_TRUE(wait_for([&] { return standby.promoted(); }));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_FALSE(standby.takeover_stats().primary_closed);
+    EXPECT_GE(standby.takeover_stats().silence_ns, config.heartbeat_timeout_ns);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+    ::close(listener);
+}
+
+TEST_F(HotStandbyTest, ShipperRefusesStandbyBehindOldestGeneration) {
+    NodeState primary;
+    WarmRestart restart(base_path_, primary.components());
+    ASSERT_TRUE(restart.start_fresh());
+    ASSERT_NE(primary.buy(TreasuryType::Note_10Y, 1000000), 0u);
+    ASSERT_TRUE(restart.take_snapshot());
+    ASSERT_TRUE(restart.poll_snapshot(true));  // Generation 0 is gone
+
+    JournalShipper shipper(base_path_, ReplicationConfig{});
+    ASSERT_TRUE(shipper.start());
+    NodeState standby_state;
+    ReplicationConfig config;
+    config.port = shipper.bound_port();
+    HotStandby standby(standby_state.components(), config);
+    ASSERT_TRUE(standby.start(0));
+    EXPECT_TRUE(wait_for([&] { return shipper.resyncs_required() == 1; }));
+    EXPECT_FALSE(shipper.connected());
+
+    // The refusal is not a lost primary: the standby must not go live on empty state
+    ASSERT_TRUE(wait_for([&] { return standby.resync_required(); }));
+    std::this_thread::sleep_for(std::chrono::nanoseconds(2 * config.heartbeat_timeout_ns));
+    EXPECT_FALSE(standby.promoted());
+    standby.stop();
+    EXPECT_FALSE(standby.promoted());
+}
@@ -0,0 +1,302 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include "hft/recovery/warm_restart.hpp"
+#include "hft/trading/book_manager.hpp"
+
+using namespace hft::recovery;
+using namespace hft::trading;
+using namespace hft::market_data;
+
+/**
+ * @brief One process's worth of journaled trading state
+ */
+struct TradingState {
+    TradingState()
+        : books(std::make_unique<BookManager>()),
+          orders(std::make_unique<OrderLifecycleManager>(books->order_pool(), books->level_pool(), books->update_buffer())),
+          settlement_pool(std::make_unique<hft::ObjectPool<PositionReconciliationManager::SettlementInstruction, 1024>>()),
+          break_buffer(std::make_unique<hft::SPSCRingBuffer<PositionReconciliationManager::PositionBreak, 1024>>()),
+          positions(std::make_unique<PositionReconciliationManager>(*orders, *settlement_pool, *break_buffer)),
+          risk(std::make_unique<RiskControlSystem>()) {}
+
+    WarmRestart::Components components() const { return {orders.get(), positions.get(), risk.get()}; }
+
+    uint64_t buy(TreasuryType instrument, double price, uint64_t quantity) {
+        return orders->create_order(instrument, OrderSide::BID, OrderType::LIMIT, Price32nd::from_decimal(price), quantity);
+    }
+
+    void fill(uint64_t order_id, double price, uint64_t quantity) {
+        OrderLifecycleManager::OrderExecution execution;
+        execution.order_id = order_id;
+        execution.executed_quantity = quantity;
+        ASSERT_TRUE(orders->process_fill(execution));
+        const auto* order = orders->get_order(order_id);
+        ASSERT_NE(order, nullptr);
+        const auto fill_price = Price32nd::from_decimal(price);
+        ASSERT_TRUE(positions->update_position(order->instrument, OrderLifecycleManager::VenueType::ECN, order->side,
+                                               quantity, fill_price, order_id));
+        risk->update_position(order->instrument, static_cast<int64_t>(quantity), fill_price);
+    }
+
+    void mark(TreasuryType instrument, double price) {
+        positions->update_market_price(instrument, Price32nd::from_decimal(price));
+        risk->update_market_price(instrument, Price32nd::from_decimal(price));
+    }
+
+    std::unique_ptr<BookManager> books;
+    std::unique_ptr<OrderLifecycleManager> orders;
+    std::unique_ptr<hft::ObjectPool<PositionReconciliationManager::SettlementInstruction, 1024>> settlement_pool;
+    std::unique_ptr<hft::SPSCRingBuffer<PositionReconciliationManager::PositionBreak, 1024>> break_buffer;
+    std::unique_ptr<PositionReconciliationManager> positions;
+    std::unique_ptr<RiskControlSystem> risk;
+};
+
+/**
+ * @brief Test fixture for StateJournal and WarmRestart
+ *
+ * Each test journals to its own files under /tmp and removes them. A
+ * "restart" is a second TradingState recovering from the first one's files.
+ */
+class WarmRestartTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        base_path_ = "/tmp/hft_warm_restart_test_" + std::to_string(::getpid()) + "_" +
+                     ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    void TearDown() override {
+        for (uint32_t generation = 0; generation < 16; ++generation) {
+            ::unlink(hft::trading::detail::journal_path(base_path_, "journal", generation).c_str());
+            ::unlink(hft::trading::detail::journal_path(base_path_, "snapshot", generation).c_str());
+        }
+    }
+
+    static void expect_same_state(const TradingState& before, const TradingState& after, TreasuryType instrument) {
+        const auto& a = before.positions->get_venue_position(instrument, OrderLifecycleManager::VenueType::ECN);
+        const auto& b = after.positions->get_venue_position(instrument, OrderLifecycleManager::VenueType::ECN);
+        EXPECT_EQ(a.net_position, b.net_position);
+        EXPECT_DOUBLE_EQ(a.weighted_average_cost, b.weighted_average_cost);
+        EXPECT_DOUBLE_EQ(a.unrealized_pnl, b.unrealized_pnl);
+        EXPECT_EQ(after.positions->get_market_price(instrument).to_decimal(), before.positions->get_market_price(instrument).to_decimal());
+        EXPECT_EQ(after.risk->get_instrument_risk(instrument).net_position, before.risk->get_instrument_risk(instrument).net_position);
+        EXPECT_DOUBLE_EQ(after.risk->get_instrument_risk(instrument).market_value, before.risk->get_instrument_risk(instrument).market_value);
+    }
+
+    static void expect_same_order(const TradingState& before, const TradingState& after, uint64_t order_id) {
+        const auto* a = before.orders->get_order(order_id);
+        const auto* b = after.orders->get_order(order_id);
+        ASSERT_NE(a, nullptr);
+        ASSERT_NE(b, nullptr);
+        EXPECT_EQ(b->state, a->state);
+        EXPECT_EQ(b->instrument, a->instrument);
+        EXPECT_EQ(b->side, a->side);
+        EXPECT_EQ(b->order_price.to_decimal(), a->order_price.to_decimal());
+        EXPECT_EQ(b->original_quantity, a->original_quantity);
+        EXPECT_EQ(b->executed_quantity, a->executed_quantity);
+        EXPECT_EQ(b->leaves_quantity, a->leaves_quantity);
+        EXPECT_EQ(after.orders->get_order_status(order_id)->leaves_quantity, a->leaves_quantity);
+    }
+
+    std::string base_path_;
+};
+
+TEST_F(WarmRestartTest, JournalReaderStopsAtTornEntry) {
+    StateJournal journal;
+    ASSERT_TRUE(journal.open(base_path_, 0, 100, 16));
+    JournalEntry entry;
+    entry.type = JournalEntryType::POSITION_MARK;
+    for (uint64_t i = 0; i < 16; ++i) {
+        entry.quantity = i;
+        ASSERT_EQ(journal.append(entry), 100 + i);
+    }
+    EXPECT_TRUE(journal.full());
+    EXPECT_EQ(journal.append(entry), 0u);
+    EXPECT_EQ(journal.rejected(), 1u);
+    journal.close();
+
+    JournalReader reader;
+    ASSERT_TRUE(reader.open(base_path_, 0));
+    ASSERT_EQ(reader.size(), 16u);
+    EXPECT_EQ(reader.entries_dropped(), 1u);  // The refused append is on record
+    EXPECT_EQ(reader[15].sequence, 115u);
+    EXPECT_EQ(reader[15].quantity, 15u);
+
+    // An entry whose sequence never landed ends the valid prefix
+    const int fd = ::open(hft::trading::detail::journal_path(base_path_, "journal", 0).c_str(), O_WRONLY);
+    ASSERT_GE(fd, 0);
+    const uint64_t torn = 0;
+    ASSERT_EQ(::pwrite(fd, &torn, sizeof(torn), sizeof(JournalSegmentHeader) + 5 * sizeof(JournalEntry)),
+              static_cast<ssize_t>(sizeof(torn)));
+    ::close(fd);
+    ASSERT_TRUE(reader.open(base_path_, 0));
+    EXPECT_EQ(reader.size(), 5u);
+}
+
+TEST_F(WarmRestartTest, RecoversFromSnapshotAndJournalTail) {
+    TradingState live;
+    WarmRestart restart(base_path_, live.components());
+    ASSERT_TRUE(restart.start_fresh());
+
+    const uint64_t working = live.buy(TreasuryType::Note_10Y, 99.5, 5000000);
+    const uint64_t done = live.buy(TreasuryType::Bond_30Y, 101.0, 2000000);
+    ASSERT_NE(working, 0u);
+    ASSERT_NE(done, 0u);
+    live.fill(working, 99.5, 2000000);
+    live.mark(TreasuryType::Note_10Y, 99.75);
+
+    ASSERT_TRUE(restart.take_snapshot());
+    ASSERT_TRUE(restart.poll_snapshot(true));
+    EXPECT_EQ(restart.snapshot_generation(), 1u);
+    EXPECT_EQ(restart.snapshots_written(), 1u);
+
+    // Tail after the snapshot: a new order, a completed-and-retired one, more fills
+    const uint64_t late = live.buy(TreasuryType::Bill_3M, 98.25, 300000);
+    ASSERT_NE(late, 0u);
+    live.fill(done, 101.0, 2000000);
+    ASSERT_TRUE(live.orders->retire_order(done));
+    live.fill(working, 99.625, 1000000);
+    live.mark(TreasuryType::Bond_30Y, 100.5);
+
+    // Restart without a clean shutdown of `live`
+    TradingState restored;
+    WarmRestart recovery(base_path_, restored.components());
+    const auto stats = recovery.recover();
+    ASSERT_TRUE(stats.ok);
+    EXPECT_TRUE(stats.from_snapshot);
+    EXPECT_EQ(stats.snapshot_generation, 1u);
+    EXPECT_EQ(stats.orders_restored, 2u);
+    EXPECT_GT(stats.entries_replayed, 0u);
+    EXPECT_EQ(stats.last_sequence, restart.journal().next_sequence() - 1);
+
+    expect_same_order(live, restored, working);
+    expect_same_order(live, restored, late);
+    expect_same_state(live, restored, TreasuryType::Note_10Y);
+    expect_same_state(live, restored, TreasuryType::Bond_30Y);
+
+    // The retired ID stays dead, and new IDs never collide with restored ones
+    EXPECT_EQ(restored.orders->get_order(done), nullptr);
+    EXPECT_FALSE(restored.orders->cancel_order(done));
+    const uint64_t fresh = restored.buy(TreasuryType::Note_2Y, 100.0, 1000000);
+    ASSERT_NE(fresh, 0u);
+    EXPECT_NE(fresh, working);
+    EXPECT_NE(fresh, late);
+    EXPECT_NE(fresh, done);
+    EXPECT_NE(restored.orders->get_order(working), nullptr);
+
+    // Journaling resumes straight after the recovered sequence
+    EXPECT_EQ(recovery.journal().first_sequence(), stats.last_sequence + 1);
+    EXPECT_GT(recovery.journal().next_sequence(), stats.last_sequence + 1);
+}
+
+TEST_F(WarmRestartTest, RecoversFromJournalAlone) {
+    TradingState live;
+    WarmRestart restart(base_path_, live.components());
+    ASSERT_TRUE(restart.start_fresh());
+
+    const uint64_t order_id = live.buy(TreasuryType::Note_5Y, 100.25, 3000000);
+    ASSERT_NE(order_id, 0u);
+    live.fill(order_id, 100.25, 1000000);
+    live.mark(TreasuryType::Note_5Y, 100.5);
+    ASSERT_TRUE(live.orders->modify_order(order_id, Price32nd::from_decimal(100.375), 4000000));
+
+    TradingState restored;
+    WarmRestart recovery(base_path_, restored.components());
+    const auto stats = recovery.recover();
+    ASSERT_TRUE(stats.ok);
+    EXPECT_FALSE(stats.from_snapshot);
+    EXPECT_EQ(stats.orders_restored, 1u);
+    EXPECT_EQ(stats.journal_generations, 1u);
+    expect_same_order(live, restored, order_id);
+    expect_same_state(live, restored, TreasuryType::Note_5Y);
+}
+
+TEST_F(WarmRestartTest, MaintainRollsTheJournalBeforeItFills) {
+    TradingState live;
+    WarmRestart restart(base_path_, live.components(), 32);
+    ASSERT_TRUE(restart.start_fresh());
+
+    const uint64_t order_id = live.buy(TreasuryType::Note_10Y, 99.5, 50000000);
+    ASSERT_NE(order_id, 0u);
+    for (int i = 0; i < 40; ++i) {
+        live.fill(order_id, 99.5, 1000000);
+        live.mark(TreasuryType::Note_10Y, 99.5 + (i % 4) / 32.0);
+        ASSERT_TRUE(restart.maintain());
+    }
+    (void)restart.poll_snapshot(true);
+    EXPECT_EQ(restart.journal().rejected(), 0u);
+    EXPECT_GT(restart.journal().generation(), 1u);
+
+    TradingState restored;
+    WarmRestart recovery(base_path_, restored.components(), 32);
+    const auto stats = recovery.recover();
+    ASSERT_TRUE(stats.ok);
+    EXPECT_EQ(stats.entries_dropped, 0u);
+    expect_same_order(live, restored, order_id);
+    expect_same_state(live, restored, TreasuryType::Note_10Y);
+}
+
+TEST_F(WarmRestartTest, FullJournalStopsTradingAndFailsRecovery) {
+    TradingState live;
+    WarmRestart restart(base_path_, live.components(), 32);
+    ASSERT_TRUE(restart.start_fresh());
+
+    // No maintain(): the generation fills and starts refusing appends
+    const uint64_t order_id = live.buy(TreasuryType::Note_10Y, 99.5, 50000000);
+    ASSERT_NE(order_id, 0u);
+    for (int i = 0; i < 12; ++i) {
+        live.fill(order_id, 99.5, 1000000);
+    }
+    ASSERT_TRUE(restart.journal().full());
+    EXPECT_GT(restart.journal().rejected(), 0u);
+    EXPECT_GT(live.orders->get_metrics().journal_entries_dropped.load(), 0u);
+    EXPECT_GT(live.positions->get_metrics().journal_entries_dropped.load(), 0u);
+    EXPECT_GT(live.risk->journal_entries_dropped(), 0u);
+    EXPECT_TRUE(live.risk->is_emergency_stop_active());
+
+    TradingState restored;
+    WarmRestart recovery(base_path_, restored.components(), 32);
+    const auto stats = recovery.recover();
+    EXPECT_FALSE(stats.ok);
+    EXPECT_GT(stats.entries_dropped, 0u);
+
+    // A snapshot taken after the loss captures the live state again
+    ASSERT_TRUE(restart.take_snapshot());
+    ASSERT_TRUE(restart.poll_snapshot(true));
+    TradingState resnapshotted;
+    WarmRestart again(base_path_, resnapshotted.components(), 32);
+    const auto healed = again.recover();
+    ASSERT_TRUE(healed.ok);
+    expect_same_state(live, resnapshotted, TreasuryType::Note_10Y);
+}
+
+TEST_F(WarmRestartTest, WarmRestartOfBusyBookIsSubSecond) {
+    constexpr uint64_t ORDERS = 20000;
+    TradingState live;
+    WarmRestart restart(base_path_, live.components());
+    ASSERT_TRUE(restart.start_fresh());
+
+    std::vector<uint64_t> ids;
+    ids.reserve(ORDERS);
+    for (uint64_t i = 0; i < ORDERS; ++i) {
+        ids.push_back(live.buy(static_cast<TreasuryType>(2 + i % 4), 100.0, 1000000 * (1 + i % 5)));
+        ASSERT_NE(ids.back(), 0u);
+        if (i == ORDERS / 2) {
+            ASSERT_TRUE(restart.take_snapshot());
+            ASSERT_TRUE(restart.poll_snapshot(true));
+        }
+    }
+    for (uint64_t i = 0; i < ORDERS; i += 7) live.fill(ids[i], 100.0, 1000000);
+
+    TradingState restored;
+    WarmRestart recovery(base_path_, restored.components());
+    const auto stats = recovery.recover();
+    ASSERT_TRUE(stats.ok);
+    EXPECT_TRUE(stats.from_snapshot);
+    EXPECT_EQ(stats.orders_restored, ORDERS);
+    EXPECT_LT(stats.duration_ns, 1000000000u);
+    for (uint64_t i = 0; i < ORDERS; i += 997) expect_same_order(live, restored, ids[i]);
+    expect_same_state(live, restored, TreasuryType::Note_10Y);
+}
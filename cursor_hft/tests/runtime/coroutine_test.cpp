@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "hft/runtime/coroutine.hpp"
+#include <coroutine>
+#include <cstdint>
+#include <vector>
+
+using namespace hft;
+
+namespace {
+
+// Owner of a pooled coroutine: a counter that yields after every step
+class Stepper {
+public:
+    explicit Stepper(CoroutineFramePool& pool) noexcept : pool_(pool) {}
+
+    CoroutineFramePool& frame_pool() noexcept { return pool_; }
+
+    Task count_to(uint32_t limit) noexcept {
+        for (uint32_t i = 0; i < limit; ++i) {
+            ++steps;
+            co_await std::suspend_always{};
+        }
+        finished = true;
+    }
+
+    Task hold_buffer() noexcept {
+        char scratch[256] = {};
+        co_await std::suspend_always{};
+        steps += static_cast<uint32_t>(scratch[steps % sizeof(scratch)]);
+    }
+
+    uint32_t steps = 0;
+    bool finished = false;
+
+private:
+    CoroutineFramePool& pool_;
+};
+
+} // namespace
+
+TEST(CoroutineTest, FramesComeFromThePool) {
+    CoroutineFramePool pool(2, 512);
+    EXPECT_EQ(pool.capacity(), 2u);
+    EXPECT_EQ(pool.frame_size(), 512u - CoroutineFramePool::HEADER_SIZE);
+
+    Stepper stepper(pool);
+    Task task = stepper.count_to(3);
+    ASSERT_TRUE(task.valid());
+    EXPECT_EQ(pool.in_use(), 1u);
+    EXPECT_EQ(stepper.steps, 0u);  // Starts suspended
+
+    task.resume();
+    EXPECT_EQ(stepper.steps, 1u);
+    while (!task.done()) task.resume();
+    EXPECT_EQ(stepper.steps, 3u);
+    EXPECT_TRUE(stepper.finished);
+    EXPECT_EQ(pool.in_use(), 1u);  // Kept until the Task goes
+    task.resume();                 // No-op once done
+
+    Task moved = std::move(task);
+    EXPECT_FALSE(task.valid());
+    moved.reset();
+    EXPECT_EQ(pool.in_use(), 0u);
+    EXPECT_EQ(pool.high_water(), 1u);
+}
+
+TEST(CoroutineTest, ExhaustedPoolYieldsInvalidTask) {
+    CoroutineFramePool pool(2, 512);
+    Stepper stepper(pool);
+    std::vector<Task> tasks;
+    tasks.push_back(stepper.count_to(10));
+    tasks.push_back(stepper.count_to(10));
+    Task refused = stepper.count_to(10);
+    EXPECT_FALSE(refused.valid());
+    EXPECT_TRUE(refused.done());
+    EXPECT_EQ(pool.failures(), 1u);
+
+    // A frame released by an unfinished Task is reused
+    tasks.front().resume();
+    tasks.erase(tasks.begin());
+    EXPECT_EQ(pool.in_use(), 1u);
+    Task reused = stepper.count_to(1);
+    EXPECT_TRUE(reused.valid());
+    EXPECT_EQ(pool.in_use(), 2u);
+
+    // Frames larger than a block are refused, not sent to the heap
+    CoroutineFramePool tiny(4, 128 + CoroutineFramePool::HEADER_SIZE);
+    Stepper cramped(tiny);
+    Task too_big = cramped.hold_buffer();
+    EXPECT_FALSE(too_big.valid());
+    EXPECT_EQ(tiny.in_use(), 0u);
+}
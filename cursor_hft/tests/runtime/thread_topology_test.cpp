@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include "hft/runtime/thread_topology.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+
+using namespace hft;
+
+TEST(ThreadTopologyTest, ParsesConfig) {
+    TopologyConfig config;
+    ASSERT_TRUE(TopologyConfig::parse(R"(
+        # production layout
+        lock_memory off
+        stage feed      core=2 priority=80
+        stage strategy0 core=3 node=1   # trailing comment
+        stage monitor
+    )", config));
+    EXPECT_FALSE(config.lock_memory);
+    ASSERT_EQ(config.stages.size(), 3u);
+    EXPECT_EQ(config.stages[0].name, "feed");
+    EXPECT_EQ(config.stages[0].core, 2);
+    EXPECT_EQ(config.stages[0].rt_priority, 80);
+    EXPECT_EQ(config.stages[0].numa_node, -1);
+    EXPECT_EQ(config.stages[1].numa_node, 1);
+    EXPECT_EQ(config.stages[2].core, -1);
+    EXPECT_EQ(config.stages[2].rt_priority, 0);
+
+    size_t line = 99;
+    EXPECT_FALSE(TopologyConfig::parse("stage feed core=2\nstage risk cpu=3\n", config, &line));
+    EXPECT_EQ(line, 2u);
+    EXPECT_FALSE(TopologyConfig::parse("stage feed core=x\n", config, &line));
+    EXPECT_EQ(line, 1u);
+    EXPECT_FALSE(TopologyConfig::parse("lock_memory maybe\n", config, &line));
+    EXPECT_FALSE(TopologyConfig::parse("stage\n", config, &line));
+    // Parses, but two stages share a core / a name
+    EXPECT_FALSE(TopologyConfig::parse("stage a core=1\nstage b core=1\n", config, &line));
+    EXPECT_EQ(line, 0u);
+    EXPECT_FALSE(TopologyConfig::parse("stage a\nstage a\n", config, &line));
+    EXPECT_EQ(config.stages.size(), 3u);  // Untouched by failed parses
+}
+
+TEST(ThreadTopologyTest, ParsesCpuList) {
+    std::bitset<CPU_SETSIZE> cpus;
+    ASSERT_TRUE(topology::parse_cpu_list("1-3,6,8-9\n", cpus));
+    EXPECT_EQ(cpus.count(), 6u);
+    EXPECT_TRUE(cpus.test(1) && cpus.test(3) && cpus.test(6) && cpus.test(9));
+    EXPECT_FALSE(cpus.test(4));
+    ASSERT_TRUE(topology::parse_cpu_list("\n", cpus));
+    EXPECT_TRUE(cpus.none());
+    EXPECT_FALSE(topology::parse_cpu_list("3-1", cpus));
+    EXPECT_FALSE(topology::parse_cpu_list("1,,2", cpus));
+}
+
+TEST(ThreadTopologyTest, LaunchesPlacedStages) {
+    TopologyConfig config;
+    config.lock_memory = false;
+    config.stages = {{"feed", 0, -1, 0}, {"strategy0", -1, -1, 0}, {"journal_writer_thread", -1, -1, 0}};
+    ThreadTopology topology(config);
+
+    std::atomic<int> feed_cpu{-2};
+    std::atomic<uint32_t> running{0};
+    std::string names[3];
+    std::atomic<uint64_t> loops[3] = {};
+    size_t index = 0;
+    for (const auto& stage : config.stages) {
+        ASSERT_TRUE(topology.bind(stage.name, [&, index](StageContext& context) {
+            char name[16] = {};
+            pthread_getname_np(pthread_self(), name, sizeof(name));
+            names[index] = name;
+            if (context.name() == "feed") feed_cpu.store(sched_getcpu());
+            running.fetch_add(1);
+            while (!context.stop_requested()) {
+                loops[index].fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::yield();
+            }
+        }));
+        ++index;
+    }
+    EXPECT_FALSE(topology.bind("risk", [](StageContext&) {}));
+
+    ASSERT_TRUE(topology.start());
+    EXPECT_TRUE(topology.running());
+    EXPECT_FALSE(topology.start());
+    while (running.load() < 3) std::this_thread::yield();
+
+    const StageStatus* feed = topology.status("feed");
+    ASSERT_NE(feed, nullptr);
+    EXPECT_TRUE(feed->started);
+    EXPECT_TRUE(feed->pinned);
+    EXPECT_FALSE(feed->realtime);
+    EXPECT_EQ(feed_cpu.load(), 0);
+    EXPECT_FALSE(topology.status("strategy0")->pinned);
+    EXPECT_EQ(topology.status("risk"), nullptr);
+
+    topology.stop();
+    EXPECT_FALSE(topology.running());
+    EXPECT_EQ(names[0], "feed");
+    EXPECT_EQ(names[1], "strategy0");
+    EXPECT_EQ(names[2], "journal_writer_");  // Kernel limit: 15 characters
+    for (const auto& count : loops) EXPECT_GT(count.load(), 0u);
+}
+
+TEST(ThreadTopologyTest, RefusesUnboundStage) {
+    TopologyConfig config;
+    config.lock_memory = false;
+    config.stages = {{"feed", -1, -1, 0}, {"risk", -1, -1, 0}};
+    ThreadTopology topology(config);
+    ASSERT_TRUE(topology.bind("feed", [](StageContext&) {}));
+    EXPECT_FALSE(topology.start());
+
+    // A realtime request the host may refuse still runs the stage
+    TopologyConfig rt = config;
+    rt.stages[1].rt_priority = 10;
+    ThreadTopology restarted(rt);
+    std::atomic<uint32_t> ran{0};
+    ASSERT_TRUE(restarted.bind("feed", [&](StageContext&) { ran.fetch_add(1); }));
+    ASSERT_TRUE(restarted.bind("risk", [&](StageContext& context) {
+        EXPECT_EQ(context.status().realtime, sched_getscheduler(0) == SCHED_FIFO);
+        ran.fetch_add(1);
+    }));
+    ASSERT_TRUE(restarted.start());
+    restarted.stop();
+    EXPECT_EQ(ran.load(), 2u);
+}
+
+TEST(ThreadTopologyTest, RingLocalToConsumer) {
+    TopologyConfig config;
+    config.lock_memory = false;
+    config.stages = {{"feed", -1, -1, 0}, {"strategy0", 0, -1, 0}};
+    ThreadTopology topology(config);
+    EXPECT_EQ(topology.node_of("strategy0"), topology::numa_node_of_cpu(0));
+    EXPECT_EQ(topology.node_of("feed"), -1);
+
+    using Ring = SPSCRingBuffer<uint64_t, 1024>;
+    NodeLocal<Ring> ring(topology.node_of("strategy0"), false);
+    ASSERT_NE(ring.get(), nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ring.get()) % alignof(Ring), 0u);
+
+    constexpr uint64_t COUNT = 100000;
+    std::atomic<uint64_t> sum{0};
+    ASSERT_TRUE(topology.bind("feed", [&](StageContext&) {
+        for (uint64_t i = 1; i <= COUNT; ++i) {
+            while (!ring->try_push(i)) std::this_thread::yield();
+        }
+    }));
+    ASSERT_TRUE(topology.bind("strategy0", [&](StageContext& context) {
+        uint64_t local = 0;
+        uint64_t seen = 0;
+        uint64_t value;
+        while (seen < COUNT && !context.stop_requested()) {
+            if (ring->try_pop(value)) {
+                local += value;
+                ++seen;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        sum.store(local);
+    }));
+    ASSERT_TRUE(topology.start());
+    while (sum.load() == 0) std::this_thread::yield();
+    topology.stop();
+    EXPECT_EQ(sum.load(), COUNT * (COUNT + 1) / 2);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "hft/runtime/warmup.hpp"
+#include "hft/memory/object_pool.hpp"
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace hft;
+
+namespace {
+
+struct alignas(64) Slot {
+    uint64_t id;
+    uint64_t payload[7];
+};
+
+size_t resident_pages(void* addr, size_t bytes) {
+    const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    std::vector<unsigned char> vec((bytes + page - 1) / page);
+    if (::mincore(addr, bytes, vec.data()) != 0) return 0;
+    size_t resident = 0;
+    for (unsigned char v : vec) resident += v & 1u;
+    return resident;
+}
+
+class Mapping {
+public:
+    explicit Mapping(size_t bytes)
+        : bytes_(bytes), base_(::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) {}
+    ~Mapping() { if (base_ != MAP_FAILED) ::munmap(base_, bytes_); }
+    char* data() const { return static_cast<char*>(base_); }
+    size_t size() const { return bytes_; }
+
+private:
+    size_t bytes_;
+    void* base_;
+};
+
+} // namespace
+
+TEST(WarmupTest, PrefaultKeepsContents) {
+    const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    Mapping map(4 * 1024 * 1024);
+    ASSERT_NE(map.data(), MAP_FAILED);
+    map.data()[0] = 'a';
+    map.data()[5 * page + 17] = 'b';
+    ASSERT_LT(resident_pages(map.data(), map.size()), map.size() / page);
+
+    // Unaligned range: the pages it touches are covered
+    EXPECT_EQ(warmup::prefault(map.data() + 10, map.size() - 20), map.size() / page);
+    EXPECT_EQ(resident_pages(map.data(), map.size()), map.size() / page);
+    EXPECT_EQ(map.data()[0], 'a');
+    EXPECT_EQ(map.data()[5 * page + 17], 'b');
+    EXPECT_EQ(map.data()[page], 0);
+    EXPECT_EQ(warmup::prefault(map.data(), 0), 0u);
+}
+
+TEST(WarmupTest, ReadinessWaitsForEveryParty) {
+    Readiness readiness(2);
+    EXPECT_FALSE(readiness.ready());
+    std::atomic<bool> released{false};
+    std::thread gate([&] {
+        readiness.wait();
+        released.store(true);
+    });
+    readiness.arrive();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_FALSE(released.load());
+    EXPECT_EQ(readiness.ready_at_ns(), 0u);
+    readiness.arrive();
+    gate.join();
+    EXPECT_TRUE(released.load());
+    EXPECT_TRUE(readiness.ready());
+    EXPECT_GT(readiness.ready_at_ns(), 0u);
+}
+
+TEST(WarmupTest, PlanPrefaultsWarmsAndSignals) {
+    const std::string cache = "/tmp/hft_warmup_calibration_" + std::to_string(::getpid());
+    std::remove(cache.c_str());
+    const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+
+    using Pool = ObjectPool<Slot, 8192>;
+    auto pool = std::make_unique<Pool>();
+    Mapping journal(9 * 1024 * 1024 + 123);  // Not a multiple of the chunk size
+    ASSERT_NE(journal.data(), MAP_FAILED);
+
+    WarmupPlan plan(cache);
+    plan.add_object("slot_pool", *pool);
+    plan.add_region("journal", journal.data(), journal.size());
+    uint64_t checksum = 0;
+    plan.add_traffic("slot_pool", 1000, [&](size_t i) {
+        Slot* slot = pool->acquire();
+        slot->id = i;
+        checksum += slot->id;
+        pool->release(slot);
+    });
+    EXPECT_EQ(plan.region_count(), 2u);
+    EXPECT_EQ(plan.traffic_count(), 1u);
+
+    Readiness readiness(1);
+    WorkStealingPool workers(3);
+    const WarmupReport report = plan.run(workers, &readiness);
+    EXPECT_TRUE(readiness.ready());
+    EXPECT_EQ(report.regions, 2u);
+    EXPECT_EQ(report.bytes_prefaulted, sizeof(Pool) + journal.size());
+    EXPECT_GE(report.pages_prefaulted, (sizeof(Pool) + journal.size()) / page);
+    EXPECT_EQ(resident_pages(journal.data(), journal.size()), (journal.size() + page - 1) / page);
+    EXPECT_EQ(report.traffic_iterations, 1000u);
+    EXPECT_EQ(checksum, 999u * 1000 / 2);
+    EXPECT_EQ(pool->size(), 0u);
+    EXPECT_GE(report.total_ns, report.calibration_ns + report.prefault_ns + report.traffic_ns);
+
+    // A second start on this host reuses the persisted calibration
+    if (HFTTimer::backend() == HFTTimer::Backend::X86Tsc) {
+        EXPECT_EQ(report.calibration, HFTTimer::CalibrationSource::Measured);
+        Readiness again(1);
+        EXPECT_EQ(plan.run(workers, &again).calibration, HFTTimer::CalibrationSource::Cached);
+    }
+    std::remove(cache.c_str());
+}
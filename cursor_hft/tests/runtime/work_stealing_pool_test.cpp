@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "hft/runtime/work_stealing_pool.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using hft::WorkStealingPool;
+
+TEST(WorkStealingPoolTest, RunsEveryTaskOnce) {
+    WorkStealingPool pool(4);
+    EXPECT_EQ(pool.lane_count(), 4u);
+
+    constexpr size_t TASKS = 10000;
+    auto hits = std::make_unique<std::atomic<uint32_t>[]>(TASKS);
+    pool.parallel_for(TASKS, [&](size_t task, size_t lane) {
+        EXPECT_LT(lane, 4u);
+        hits[task].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    uint64_t per_lane = 0;
+    for (size_t lane = 0; lane < pool.lane_count(); ++lane) per_lane += pool.tasks_run(lane);
+    EXPECT_EQ(per_lane, TASKS);
+    for (size_t i = 0; i < TASKS; ++i) {
+        ASSERT_EQ(hits[i].load(), 1u) << "task " << i;
+    }
+}
+
+TEST(WorkStealingPoolTest, SlowRangeIsStolen) {
+    // The caller's share (tasks 0-15 of 64) is slow: other lanes must take some of it
+    WorkStealingPool pool(4);
+    std::atomic<uint32_t> done{0};
+    pool.parallel_for(64, [&](size_t task, size_t) {
+        if (task < 16) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        done.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    EXPECT_EQ(done.load(), 64u);
+    EXPECT_GT(pool.steals(), 0u);
+    EXPECT_LT(pool.tasks_run(0), 16u);
+}
+
+TEST(WorkStealingPoolTest, ReusedAcrossJobs) {
+    WorkStealingPool pool(3);
+    for (size_t job = 0; job < 200; ++job) {
+        // Includes jobs with fewer tasks than lanes
+        const size_t count = job % 7;
+        std::vector<uint32_t> hits(count, 0);
+        pool.parallel_for(count, [&](size_t task, size_t) { ++hits[task]; });
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(hits[i], 1u) << "job " << job << " task " << i;
+        }
+    }
+}
+
+TEST(WorkStealingPoolTest, SingleLaneRunsInline) {
+    WorkStealingPool pool(1);
+    const auto caller = std::this_thread::get_id();
+    size_t next = 0;
+    bool in_order = true;
+    pool.parallel_for(100, [&](size_t task, size_t lane) {
+        in_order &= task == next++ && lane == 0 && std::this_thread::get_id() == caller;
+    });
+    EXPECT_EQ(next, 100u);
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(pool.steals(), 0u);
+}
@@ -187,6 +187,26 @@ TEST_F(AdvancedMarketMakerTest, MarketConditionUpdates) {
     EXPECT_LE(updated_conditions.liquidity_score, 1.0);
 }
 
+// A traced update is stamped BOOK once the tick store and market conditions are updated
+TEST_F(AdvancedMarketMakerTest, TracedUpdateStampsBookStage) {
+    auto tracer = std::make_unique<hft::PipelineTracer>(1);
+    strategy_->set_tracer(tracer.get());
+
+    auto update = create_test_market_update();
+    update.trace_id = tracer->begin(hft::HFTTimer::get_cycles());
+    ASSERT_NE(update.trace_id, 0u);
+    strategy_->update_market_conditions(update);
+    EXPECT_TRUE(tracer->finish(update.trace_id, hft::TraceStage::SEND));
+
+    // Untraced updates are left alone
+    update.trace_id = 0;
+    strategy_->update_market_conditions(update);
+
+    EXPECT_EQ(tracer->drain(), 1u);
+    EXPECT_EQ(tracer->stage_breakdown(hft::TraceStage::BOOK).count, 1u);
+    strategy_->set_tracer(nullptr);
+}
+
 // Test position sizing based on confidence
 TEST_F(AdvancedMarketMakerTest, ConfidenceBasedPositionSizing) {
     const TreasuryType instrument = TreasuryType::Note_10Y;
@@ -223,6 +243,35 @@ TEST_F(AdvancedMarketMakerTest, InventoryManagement) {
     EXPECT_EQ(updated_inventory.target_position, 0);
 }
 
+// Test streaming inventory analytics
+TEST_F(AdvancedMarketMakerTest, InventoryAnalyticsTrackPosition) {
+    const TreasuryType instrument = TreasuryType::Note_10Y;
+    constexpr uint64_t SECOND = 1000000000ULL;
+    const uint64_t t0 = 1000 * SECOND;
+    
+    strategy_->analyze_inventory(instrument, t0);
+    EXPECT_EQ(strategy_->get_inventory_state(instrument).time_in_position_seconds, 0u);
+    EXPECT_EQ(strategy_->get_inventory_state(instrument).inventory_risk, 0.0);
+    
+    // Long position held: holding time grows, risk follows recent inventory
+    strategy_->update_position(instrument, 4000000);
+    strategy_->analyze_inventory(instrument, t0 + SECOND);
+    strategy_->analyze_inventory(instrument, t0 + 6 * SECOND);
+    auto inventory = strategy_->get_inventory_state(instrument);
+    EXPECT_EQ(inventory.current_position, 4000000);
+    EXPECT_EQ(inventory.time_in_position_seconds, 5u);
+    EXPECT_GT(inventory.inventory_risk, 0.0);
+    EXPECT_LT(inventory.inventory_risk, 0.04);
+    
+    // Flipping short restarts the clock
+    strategy_->update_position(instrument, -6000000);
+    strategy_->analyze_inventory(instrument, t0 + 7 * SECOND);
+    EXPECT_EQ(strategy_->get_inventory_state(instrument).time_in_position_seconds, 0u);
+    EXPECT_EQ(strategy_->get_inventory_stats(instrument).position_session.count(), 4u);
+    EXPECT_DOUBLE_EQ(strategy_->get_inventory_stats(instrument).position_session.mean(),
+                     (0.0 + 4000000 + 4000000 - 2000000) / 4.0);
+}
+
 // Test hedge ratio calculations
 TEST_F(AdvancedMarketMakerTest, HedgeRatioCalculations) {
     // Create mock treasury curve yields
@@ -239,6 +288,29 @@ TEST_F(AdvancedMarketMakerTest, HedgeRatioCalculations) {
     EXPECT_GT(hedge_ratios.last_calculation_time_ns, 0);
 }
 
+// Strategies sharing a curve apply each tick once and skip unchanged recalculation
+TEST_F(AdvancedMarketMakerTest, SharedCurveSkipsUnchangedRecalculation) {
+    auto curve = std::make_unique<YieldCurve>();
+    AdvancedMarketMaker first(*order_pool_, *order_book_, nullptr, curve.get());
+    AdvancedMarketMaker second(*order_pool_, *order_book_, nullptr, curve.get());
+    EXPECT_EQ(&first.yield_curve(), &second.yield_curve());
+
+    std::array<double, 6> yields = {0.052, 0.050, 0.046, 0.042, 0.041, 0.044};
+    first.update_hedge_ratios(yields);
+    const uint64_t version = curve->version();
+    second.update_hedge_ratios(yields);
+    EXPECT_EQ(curve->version(), version);
+    EXPECT_GT(second.get_hedge_ratios().last_calculation_time_ns, 0);
+
+    const uint64_t calculated = first.get_hedge_ratios().last_calculation_time_ns;
+    first.update_hedge_ratios(yields);
+    EXPECT_EQ(first.get_hedge_ratios().last_calculation_time_ns, calculated);
+
+    yields[4] += 0.0001;
+    second.update_hedge_ratios(yields);
+    EXPECT_EQ(curve->version(), version + 1);
+}
+
 // Test decision making in volatile conditions
 TEST_F(AdvancedMarketMakerTest, VolatileMarketDecisions) {
     // Create extremely volatile market update
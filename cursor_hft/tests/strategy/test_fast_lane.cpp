@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "hft/strategy/fast_lane.hpp"
+#include "hft/memory/object_pool.hpp"
+#include "hft/trading/order_book.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+
+using namespace hft::strategy;
+using namespace hft::trading;
+using namespace hft::market_data;
+
+/**
+ * @brief Test fixture for the tick-to-trade fast lane
+ *
+ * One SimpleMarketMaker quoting through a FastLane into a venue session,
+ * with full risk run after each tick as a caller would.
+ */
+class FastLaneTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        order_pool_ = std::make_unique<hft::ObjectPool<TreasuryOrder, 4096>>();
+        level_pool_ = std::make_unique<hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>>();
+        update_buffer_ = std::make_unique<hft::SPSCRingBuffer<OrderBookUpdate, 8192>>();
+        order_book_ = std::make_unique<TreasuryOrderBook>(*order_pool_, *level_pool_, *update_buffer_);
+        strategy_ = std::make_unique<SimpleMarketMaker>(*order_pool_, *order_book_);
+        risk_ = std::make_unique<RiskControlSystem>();
+        session_ = std::make_unique<VenueSession>();
+    }
+
+    void make_lane(const FastLane::Config& config = FastLane::Config{}) {
+        lane_ = std::make_unique<FastLane>(*strategy_, *risk_, *session_, config);
+    }
+
+    static TreasuryTick make_tick(TreasuryType instrument = TreasuryType::Note_10Y) {
+        TreasuryTick tick{};
+        tick.instrument_type = instrument;
+        tick.timestamp_ns = hft::HFTTimer::get_timestamp_ns();
+        tick.bid_price = Price32nd::from_decimal(102.5);
+        tick.ask_price = Price32nd::from_decimal(102.53125);
+        tick.bid_size = 5000000;
+        tick.ask_size = 5000000;
+        return tick;
+    }
+
+    QuoteUpdate pop_session() {
+        QuoteUpdate update{};
+        EXPECT_TRUE(session_->try_pop(update));
+        return update;
+    }
+
+    std::unique_ptr<hft::ObjectPool<TreasuryOrder, 4096>> order_pool_;
+    std::unique_ptr<hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>> level_pool_;
+    std::unique_ptr<hft::SPSCRingBuffer<OrderBookUpdate, 8192>> update_buffer_;
+    std::unique_ptr<TreasuryOrderBook> order_book_;
+    std::unique_ptr<SimpleMarketMaker> strategy_;
+    std::unique_ptr<RiskControlSystem> risk_;
+    std::unique_ptr<VenueSession> session_;
+    std::unique_ptr<FastLane> lane_;
+};
+
+TEST_F(FastLaneTest, TickWritesQuoteToSession) {
+    make_lane();
+    const auto tick = make_tick();
+
+    ASSERT_TRUE(lane_->on_tick(tick));
+    EXPECT_EQ(session_->size(), 1u);
+    EXPECT_EQ(lane_->pending_full_risk(), 1u);
+
+    const QuoteUpdate sent = pop_session();
+    EXPECT_EQ(sent.sequence, 1u);
+    EXPECT_EQ(sent.instrument, TreasuryType::Note_10Y);
+    EXPECT_EQ(sent.venue, OrderLifecycleManager::VenueType::PRIMARY_DEALER);
+    EXPECT_EQ(sent.tick_time_ns, tick.timestamp_ns);
+    EXPECT_GE(sent.send_time_ns, tick.timestamp_ns);
+    EXPECT_GT(sent.bid_size, 0u);
+    EXPECT_GT(sent.ask_size, 0u);
+    EXPECT_LT(sent.bid_price.to_decimal(), sent.ask_price.to_decimal());
+
+    // Full risk runs after the send and accepts it
+    EXPECT_EQ(lane_->run_full_risk(), 0u);
+    EXPECT_EQ(lane_->pending_full_risk(), 0u);
+    EXPECT_EQ(lane_->stats().full_risk_checks, 1u);
+    EXPECT_TRUE(session_->empty());
+}
+
+TEST_F(FastLaneTest, EnvelopeClampsToPositionHeadroom) {
+    RiskControlSystem::RiskLimits limits;
+    limits.max_position_per_instrument = 10000000;
+    limits.max_daily_loss = 1e12;
+    risk_->update_risk_limits(limits);
+    risk_->update_position(TreasuryType::Note_10Y, 9600000, Price32nd::from_decimal(102.5));
+    make_lane();
+
+    EXPECT_EQ(lane_->envelope(TreasuryType::Note_10Y).max_bid_size, 400000u);
+    EXPECT_EQ(lane_->envelope(TreasuryType::Note_10Y).max_ask_size, 19600000u);  // Selling flattens first
+
+    ASSERT_TRUE(lane_->on_tick(make_tick()));
+    const QuoteUpdate sent = pop_session();
+    EXPECT_EQ(sent.bid_size, 400000u);
+    EXPECT_GT(sent.ask_size, 400000u);
+    EXPECT_EQ(lane_->stats().quotes_clamped, 1u);
+
+    // The clamped quote is one full risk accepts
+    EXPECT_EQ(lane_->run_full_risk(), 0u);
+}
+
+TEST_F(FastLaneTest, FullRiskRejectPullsQuotes) {
+    RiskControlSystem::RiskLimits limits;
+    limits.max_orders_per_second = 1;  // Bid passes, ask trips the rate breaker
+    risk_->update_risk_limits(limits);
+    make_lane();
+
+    ASSERT_TRUE(lane_->on_tick(make_tick()));
+    EXPECT_EQ(lane_->run_full_risk(), 1u);
+    EXPECT_EQ(lane_->stats().full_risk_rejects, 1u);
+
+    (void)pop_session();
+    const QuoteUpdate pull = pop_session();
+    EXPECT_EQ(pull.instrument, TreasuryType::Note_10Y);
+    EXPECT_EQ(pull.bid_size, 0u);
+    EXPECT_EQ(pull.ask_size, 0u);
+    EXPECT_EQ(pull.sequence, 2u);
+
+    // Envelope stays shut while the breaker is active
+    EXPECT_FALSE(lane_->envelope(TreasuryType::Note_10Y).enabled);
+    EXPECT_FALSE(lane_->on_tick(make_tick()));
+    EXPECT_TRUE(session_->empty());
+
+    EXPECT_TRUE(risk_->reset_circuit_breaker(RiskControlSystem::CircuitBreakerType::ORDER_RATE_LIMIT));
+    lane_->refresh_envelope();
+    EXPECT_TRUE(lane_->envelope(TreasuryType::Note_10Y).enabled);
+
+    risk_->trigger_emergency_stop("test");
+    lane_->refresh_envelope();
+    EXPECT_FALSE(lane_->on_tick(make_tick()));
+}
+
+TEST_F(FastLaneTest, PullRefusedByFullSessionIsRetried) {
+    RiskControlSystem::RiskLimits limits;
+    limits.max_orders_per_second = 1;
+    risk_->update_risk_limits(limits);
+    make_lane();
+    ASSERT_TRUE(lane_->on_tick(make_tick()));
+
+    // Gateway stalled: no room for the pull
+    size_t filler = 0;
+    while (!session_->claim().empty()) {
+        session_->commit();
+        ++filler;
+    }
+    EXPECT_EQ(lane_->run_full_risk(), 1u);
+    EXPECT_TRUE(lane_->pull_pending(TreasuryType::Note_10Y));
+
+    // The instrument stays shut even once the breaker clears, until the pull is out
+    EXPECT_TRUE(risk_->reset_circuit_breaker(RiskControlSystem::CircuitBreakerType::ORDER_RATE_LIMIT));
+    lane_->refresh_envelope();
+    EXPECT_FALSE(lane_->envelope(TreasuryType::Note_10Y).enabled);
+    EXPECT_TRUE(lane_->envelope(TreasuryType::Note_5Y).enabled);
+    EXPECT_FALSE(lane_->on_tick(make_tick()));
+
+    // Next pass after the gateway drains sends the pull and reopens the instrument
+    (void)pop_session();
+    for (size_t i = 0; i < filler; ++i) (void)pop_session();
+    EXPECT_EQ(lane_->run_full_risk(), 0u);
+    EXPECT_FALSE(lane_->pull_pending(TreasuryType::Note_10Y));
+    const QuoteUpdate pull = pop_session();
+    EXPECT_EQ(pull.instrument, TreasuryType::Note_10Y);
+    EXPECT_EQ(pull.bid_size, 0u);
+    EXPECT_EQ(pull.ask_size, 0u);
+    EXPECT_TRUE(lane_->envelope(TreasuryType::Note_10Y).enabled);
+}
+
+TEST_F(FastLaneTest, UncheckedQuotesAreBounded) {
+    FastLane::Config config;
+    config.max_unchecked_quotes = 2;
+    make_lane(config);
+
+    EXPECT_TRUE(lane_->on_tick(make_tick()));
+    EXPECT_TRUE(lane_->on_tick(make_tick(TreasuryType::Note_5Y)));
+    EXPECT_EQ(lane_->unchecked_budget(), 0u);
+    EXPECT_FALSE(lane_->on_tick(make_tick()));
+    EXPECT_EQ(lane_->stats().envelope_rejects, 1u);
+
+    EXPECT_EQ(lane_->run_full_risk(), 0u);
+    EXPECT_EQ(lane_->unchecked_budget(), 2u);
+    EXPECT_TRUE(lane_->on_tick(make_tick()));
+    EXPECT_EQ(lane_->stats().quotes_sent, 3u);
+}
@@ -374,4 +374,39 @@ TEST_F(MultiStrategyManagerTest, ConsistencyAcrossMultipleCycles) {
             EXPECT_GT(current.coordination_overhead_ns, 0);
         }
     }
-}
\ No newline at end of file
+}
+
+// Test mixed strategy types in one manager, dispatched without virtual calls
+TEST_F(MultiStrategyManagerTest, MixedStrategyTypes) {
+    using MixedManager = BasicMultiStrategyManager<SimpleMarketMaker, AdvancedMarketMaker>;
+    static_assert(MixedManager::MAX_STRATEGIES == 2);
+    static_assert(!std::is_polymorphic_v<SimpleMarketMaker> && !std::is_polymorphic_v<AdvancedMarketMaker>);
+    
+    auto mixed = std::make_unique<MixedManager>(*order_pool_, *level_pool_, *update_buffer_, *order_book_);
+    auto update = create_test_market_update();
+    
+    std::array<MixedManager::StrategyResult, 2> results;
+    for (int i = 0; i < 5; ++i) {
+        results = mixed->coordinate_strategies(update);
+    }
+    EXPECT_EQ(results[0].strategy_id, 0);
+    EXPECT_EQ(results[1].strategy_id, 1);
+    EXPECT_EQ(results[0].action, MixedManager::StrategyResult::Action::UPDATE_QUOTES);
+    EXPECT_NE(results[1].action, MixedManager::StrategyResult::Action::RISK_LIMIT_HIT);
+    
+    // Typed access reaches the in-place strategies
+    EXPECT_EQ(mixed->strategy<0>().get_decision_count(), 5u);
+    EXPECT_EQ(mixed->strategy<1>().tick_store().total_recorded(TreasuryType::Note_10Y), 5u);
+    
+    mixed->update_strategy_config(0, MixedManager::StrategyConfig(1));
+    mixed->update_strategy_config(1, MixedManager::StrategyConfig(0, true, 0.5));
+    results = mixed->coordinate_strategies(update);
+    EXPECT_EQ(results[0].strategy_id, 1);
+    EXPECT_EQ(results[0].priority, 0);
+    
+    mixed->emergency_stop();
+    results = mixed->coordinate_strategies(update);
+    for (const auto& result : results) {
+        EXPECT_EQ(result.action, MixedManager::StrategyResult::Action::NO_ACTION);
+    }
+}
@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "hft/strategy/quote_manager.hpp"
+#include "hft/memory/object_pool.hpp"
+#include "hft/trading/order_book.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+
+using namespace hft::strategy;
+using namespace hft::trading;
+using namespace hft::market_data;
+
+/**
+ * @brief Test fixture for QuoteManager
+ *
+ * Covers tolerance diffing, coalescing, pulls and the amend set applied to
+ * an OrderLifecycleManager, plus message counts for both market makers.
+ */
+class QuoteManagerTest : public ::testing::Test {
+protected:
+    using AmendType = QuoteManager::AmendType;
+
+    void SetUp() override {
+        order_pool_ = std::make_unique<hft::ObjectPool<TreasuryOrder, 4096>>();
+        level_pool_ = std::make_unique<hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>>();
+        update_buffer_ = std::make_unique<hft::SPSCRingBuffer<OrderBookUpdate, 8192>>();
+        order_book_ = std::make_unique<TreasuryOrderBook>(*order_pool_, *level_pool_, *update_buffer_);
+    }
+
+    static StrategyQuote make_quote(double bid, double ask, uint64_t size = 1000000,
+                                    TreasuryType instrument = TreasuryType::Note_10Y) {
+        StrategyQuote quote{};
+        quote.action = StrategyQuote::Action::UPDATE_QUOTES;
+        quote.instrument = instrument;
+        quote.bid_price = Price32nd::from_decimal(bid);
+        quote.ask_price = Price32nd::from_decimal(ask);
+        quote.bid_size = size;
+        quote.ask_size = size;
+        return quote;
+    }
+
+    static constexpr double THIRTY_SECOND = 1.0 / 32.0;
+    static constexpr uint64_t T0 = 1000000000;
+
+    std::unique_ptr<hft::ObjectPool<TreasuryOrder, 4096>> order_pool_;
+    std::unique_ptr<hft::ObjectPool<TreasuryOrderBook::PriceLevel, 1024>> level_pool_;
+    std::unique_ptr<hft::SPSCRingBuffer<OrderBookUpdate, 8192>> update_buffer_;
+    std::unique_ptr<TreasuryOrderBook> order_book_;
+};
+
+TEST_F(QuoteManagerTest, UnchangedAndWithinToleranceQuotesAreSuppressed) {
+    QuoteManager::Config config;
+    config.price_tolerance_32nds = 1;
+    config.size_tolerance = 100000;
+    QuoteManager manager(config);
+
+    auto amend = manager.on_quote(make_quote(102.5, 102.5625), T0);
+    EXPECT_EQ(amend.bid.type, AmendType::NEW);
+    EXPECT_EQ(amend.ask.type, AmendType::NEW);
+
+    // Same quote, one 32nd move, small size change: nothing to send
+    EXPECT_TRUE(manager.on_quote(make_quote(102.5, 102.5625), T0 + 1).empty());
+    EXPECT_TRUE(manager.on_quote(make_quote(102.5 + THIRTY_SECOND, 102.5625), T0 + 2).empty());
+    EXPECT_TRUE(manager.on_quote(make_quote(102.5, 102.5625, 1050000), T0 + 3).empty());
+
+    // Two 32nds on the bid only: one amend
+    amend = manager.on_quote(make_quote(102.5 + 2 * THIRTY_SECOND, 102.5625), T0 + 4);
+    EXPECT_EQ(amend.count(), 1u);
+    EXPECT_EQ(amend.bid.type, AmendType::AMEND);
+    EXPECT_EQ(amend.ask.type, AmendType::NONE);
+    EXPECT_DOUBLE_EQ(manager.working(TreasuryType::Note_10Y).bid.price.to_decimal(), 102.5625);
+
+    EXPECT_EQ(manager.stats().decisions, 5u);
+    EXPECT_EQ(manager.stats().messages, 3u);
+    EXPECT_EQ(manager.stats().suppressed, 7u);
+}
+
+TEST_F(QuoteManagerTest, UpdatesCoalesceWithinWindow) {
+    QuoteManager::Config config;
+    config.coalesce_window_ns = 1000;
+    QuoteManager manager(config);
+
+    EXPECT_EQ(manager.on_quote(make_quote(102.5, 102.5625), T0).count(), 2u);
+
+    // Three moves inside the window collapse into the last one
+    EXPECT_TRUE(manager.on_quote(make_quote(102.5625, 102.625), T0 + 100).empty());
+    EXPECT_TRUE(manager.on_quote(make_quote(102.625, 102.6875), T0 + 200).empty());
+    EXPECT_TRUE(manager.on_quote(make_quote(102.6875, 102.75), T0 + 300).empty());
+    EXPECT_TRUE(manager.flush(TreasuryType::Note_10Y, T0 + 999).empty());
+    EXPECT_EQ(manager.stats().coalesced, 6u);
+
+    const auto amend = manager.flush(TreasuryType::Note_10Y, T0 + 1000);
+    EXPECT_EQ(amend.bid.type, AmendType::AMEND);
+    EXPECT_EQ(amend.ask.type, AmendType::AMEND);
+    EXPECT_DOUBLE_EQ(amend.bid.price.to_decimal(), 102.6875);
+    EXPECT_DOUBLE_EQ(amend.ask.price.to_decimal(), 102.75);
+    EXPECT_TRUE(manager.flush(TreasuryType::Note_10Y, T0 + 2000).empty());
+
+    // A move back to the working quote drops the held target
+    EXPECT_TRUE(manager.on_quote(make_quote(102.5, 102.5625), T0 + 1500).empty());
+    EXPECT_TRUE(manager.on_quote(make_quote(102.6875, 102.75), T0 + 1600).empty());
+    EXPECT_TRUE(manager.flush(TreasuryType::Note_10Y, T0 + 5000).empty());
+}
+
+TEST_F(QuoteManagerTest, PullsBypassWindow) {
+    QuoteManager::Config config;
+    config.coalesce_window_ns = 1000000;
+    QuoteManager manager(config);
+
+    (void)manager.on_quote(make_quote(102.5, 102.5625), T0);
+
+    StrategyQuote cancel{};
+    cancel.action = StrategyQuote::Action::CANCEL_QUOTES;
+    cancel.instrument = TreasuryType::Note_10Y;
+    auto amend = manager.on_quote(cancel, T0 + 10);
+    EXPECT_EQ(amend.bid.type, AmendType::CANCEL);
+    EXPECT_EQ(amend.ask.type, AmendType::CANCEL);
+    EXPECT_FALSE(manager.working(TreasuryType::Note_10Y).bid.live);
+
+    // Nothing left to pull; one-sided zero size pulls just that side
+    EXPECT_TRUE(manager.on_quote(cancel, T0 + 20).empty());
+    amend = manager.on_quote(make_quote(102.5, 102.5625), T0 + 2000000);
+    EXPECT_EQ(amend.count(), 2u);
+    auto one_sided = make_quote(102.5, 102.5625);
+    one_sided.ask_size = 0;
+    amend = manager.on_quote(one_sided, T0 + 2000010);
+    EXPECT_EQ(amend.bid.type, AmendType::NONE);
+    EXPECT_EQ(amend.ask.type, AmendType::CANCEL);
+}
+
+TEST_F(QuoteManagerTest, ApplyDrivesOrderLifecycle) {
+    auto orders = std::make_unique<OrderLifecycleManager>(*order_pool_, *level_pool_, *update_buffer_);
+    QuoteManager manager;
+
+    EXPECT_EQ(manager.apply(manager.on_quote(make_quote(102.5, 102.5625), T0), *orders), 2u);
+    const uint64_t bid_id = manager.working(TreasuryType::Note_10Y).bid.order_id;
+    const uint64_t ask_id = manager.working(TreasuryType::Note_10Y).ask.order_id;
+    ASSERT_NE(bid_id, 0u);
+    ASSERT_NE(ask_id, 0u);
+    EXPECT_EQ(orders->get_order(bid_id)->side, OrderSide::BID);
+
+    // Amend keeps the order id and replaces price in place
+    EXPECT_EQ(manager.apply(manager.on_quote(make_quote(102.53125, 102.5625), T0 + 1), *orders), 1u);
+    EXPECT_EQ(manager.working(TreasuryType::Note_10Y).bid.order_id, bid_id);
+    EXPECT_DOUBLE_EQ(orders->get_order(bid_id)->order_price.to_decimal(), 102.53125);
+    EXPECT_EQ(orders->get_order(bid_id)->state, OrderLifecycleManager::OrderState::PENDING_REPLACE);
+
+    StrategyQuote cancel{};
+    cancel.action = StrategyQuote::Action::CANCEL_QUOTES;
+    cancel.instrument = TreasuryType::Note_10Y;
+    EXPECT_EQ(manager.apply(manager.on_quote(cancel, T0 + 2), *orders), 2u);
+    EXPECT_EQ(orders->get_order(ask_id)->state, OrderLifecycleManager::OrderState::PENDING_CANCEL);
+    EXPECT_EQ(orders->get_metrics().orders_created.load(), 2u);
+
+    // A fill closing the bid makes the next quote a fresh order
+    (void)manager.apply(manager.on_quote(make_quote(102.5, 102.5625), T0 + 3), *orders);
+    manager.on_side_closed(TreasuryType::Note_10Y, OrderSide::BID, *orders);
+    const auto amend = manager.on_quote(make_quote(102.5, 102.5625), T0 + 4);
+    EXPECT_EQ(amend.bid.type, AmendType::NEW);
+    EXPECT_EQ(amend.ask.type, AmendType::NONE);
+}
+
+TEST_F(QuoteManagerTest, RefusedAmendKeepsOrderAndRetries) {
+    auto orders = std::make_unique<OrderLifecycleManager>(*order_pool_, *level_pool_, *update_buffer_);
+    auto limiters = std::make_unique<OrderRateLimiters>();
+    RateLimiter::Config limit;
+    limit.interval_ns = 60000000000ULL;
+    limit.max_messages = 2;
+    limiters->configure_venue(static_cast<size_t>(OrderLifecycleManager::VenueType::ECN), limit);
+    orders->set_rate_limiters(limiters.get());
+
+    QuoteManager::Config config;
+    config.strategy_id = 3;
+    config.venue = OrderLifecycleManager::VenueType::ECN;
+    QuoteManager manager(config);
+
+    // New orders carry the manager's strategy and venue, and use up the venue budget
+    ASSERT_EQ(manager.apply(manager.on_quote(make_quote(102.5, 102.5625), T0), *orders), 2u);
+    const auto& bid = manager.working(TreasuryType::Note_10Y).bid;
+    const uint64_t bid_id = bid.order_id;
+    EXPECT_EQ(orders->get_order(bid_id)->strategy_id, 3);
+    EXPECT_EQ(orders->get_order(bid_id)->target_venue, OrderLifecycleManager::VenueType::ECN);
+
+    // The throttled amend leaves the resting order and its confirmed quote in place
+    EXPECT_EQ(manager.apply(manager.on_quote(make_quote(102.53125, 102.5625), T0 + 1), *orders), 0u);
+    EXPECT_EQ(bid.order_id, bid_id);
+    EXPECT_TRUE(bid.live);
+    EXPECT_DOUBLE_EQ(bid.price.to_decimal(), 102.5);
+    EXPECT_DOUBLE_EQ(orders->get_order(bid_id)->order_price.to_decimal(), 102.5);
+
+    // ...and the target is sent again, as an amend rather than a second order
+    const auto retry = manager.flush(TreasuryType::Note_10Y, T0 + 2);
+    EXPECT_EQ(retry.bid.type, AmendType::AMEND);
+    EXPECT_DOUBLE_EQ(retry.bid.price.to_decimal(), 102.53125);
+    EXPECT_EQ(retry.ask.type, AmendType::NONE);
+    EXPECT_EQ(manager.apply(retry, *orders), 0u);
+    EXPECT_EQ(bid.order_id, bid_id);
+
+    // Cancels are not throttled; the pull goes out and the pending amend is dropped
+    StrategyQuote cancel{};
+    cancel.action = StrategyQuote::Action::CANCEL_QUOTES;
+    cancel.instrument = TreasuryType::Note_10Y;
+    EXPECT_EQ(manager.apply(manager.on_quote(cancel, T0 + 3), *orders), 2u);
+    EXPECT_EQ(orders->get_order(bid_id)->state, OrderLifecycleManager::OrderState::PENDING_CANCEL);
+    EXPECT_TRUE(manager.flush(TreasuryType::Note_10Y, T0 + 4).empty());
+    EXPECT_EQ(orders->get_metrics().orders_created.load(), 2u);
+}
+
+TEST_F(QuoteManagerTest, ClosedSidesFreeTheirOrderSlots) {
+    auto orders = std::make_unique<OrderLifecycleManager>(*order_pool_, *level_pool_, *update_buffer_);
+    QuoteManager manager;
+
+    // More quotes over the run than the manager has slots: each fill retires its order
+    constexpr size_t QUOTES = OrderLifecycleManager::MAX_ORDERS + 100;
+    auto one_sided = make_quote(102.5, 102.5625);
+    one_sided.ask_size = 0;
+    for (size_t i = 0; i < QUOTES; ++i) {
+        ASSERT_EQ(manager.apply(manager.on_quote(one_sided, T0 + i), *orders), 1u) << i;
+        const uint64_t bid_id = manager.working(TreasuryType::Note_10Y).bid.order_id;
+
+        OrderLifecycleManager::OrderExecution fill;
+        fill.order_id = bid_id;
+        fill.instrument = TreasuryType::Note_10Y;
+        fill.execution_price = one_sided.bid_price;
+        fill.executed_quantity = one_sided.bid_size;
+        ASSERT_TRUE(orders->process_fill(fill));
+        manager.on_side_closed(TreasuryType::Note_10Y, OrderSide::BID, *orders);
+        ASSERT_EQ(orders->get_order(bid_id), nullptr);
+    }
+    EXPECT_EQ(orders->get_metrics().orders_created.load(), QUOTES);
+    EXPECT_EQ(orders->get_metrics().orders_filled.load(), QUOTES);
+}
+
+TEST_F(QuoteManagerTest, MarketMakerDecisionsCollapseToMinimalAmends) {
+    SimpleMarketMaker simple(*order_pool_, *order_book_);
+    AdvancedMarketMaker advanced(*order_pool_, *order_book_);
+    QuoteManager::Config config;
+    config.price_tolerance_32nds = 1;
+    QuoteManager simple_quotes(config);
+    QuoteManager advanced_quotes(config);
+
+    const SimpleMarketMaker::MarketUpdate update(TreasuryType::Note_10Y,
+                                                 Price32nd::from_decimal(102.5),
+                                                 Price32nd::from_decimal(102.53125),
+                                                 5000000, 5000000);
+    constexpr size_t TICKS = 100;
+    for (size_t i = 0; i < TICKS; ++i) {
+        (void)simple_quotes.on_quote(run_strategy(simple, update), T0 + i);
+        (void)advanced_quotes.on_quote(run_strategy(advanced, update), T0 + i);
+    }
+
+    // Decisions restate the same quotes: only the opening pair goes out
+    EXPECT_EQ(simple_quotes.stats().decisions, TICKS);
+    EXPECT_EQ(simple_quotes.stats().messages, 2u);
+    EXPECT_LE(advanced_quotes.stats().messages, TICKS / 10);
+}
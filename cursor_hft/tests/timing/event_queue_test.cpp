@@ -0,0 +1,83 @@
+#include "hft/timing/event_queue.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace hft {
+namespace test {
+
+using Queue = EventQueue<uint64_t, 16>;
+
+TEST(EventQueueTest, PopsInDueOrder) {
+    auto queue = std::make_unique<Queue>();
+    EXPECT_EQ(queue->next_due_ns(), Queue::NEVER);
+    ASSERT_TRUE(queue->schedule(2500, 1));
+    ASSERT_TRUE(queue->schedule(500, 2));
+    ASSERT_TRUE(queue->schedule(7000, 3));
+    EXPECT_EQ(queue->next_due_ns(), 500u);
+    EXPECT_EQ(queue->top(), 2u);
+
+    uint64_t payload = 0;
+    EXPECT_FALSE(queue->pop_due(499, payload));
+    ASSERT_TRUE(queue->pop_due(500, payload));
+    EXPECT_EQ(payload, 2u);
+    ASSERT_TRUE(queue->pop_due(10000, payload));
+    EXPECT_EQ(payload, 1u);
+    ASSERT_TRUE(queue->pop_due(10000, payload));
+    EXPECT_EQ(payload, 3u);
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST(EventQueueTest, TiesKeepScheduleOrder) {
+    auto queue = std::make_unique<Queue>();
+    for (uint64_t i = 0; i < 8; ++i) ASSERT_TRUE(queue->schedule(1000, i));
+    ASSERT_TRUE(queue->schedule(999, 100));
+
+    std::vector<uint64_t> popped;
+    uint64_t payload = 0;
+    while (queue->pop_due(1000, payload)) popped.push_back(payload);
+    EXPECT_EQ(popped, (std::vector<uint64_t>{100, 0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST(EventQueueTest, CapacityAndSlotReuse) {
+    auto queue = std::make_unique<Queue>();
+    for (uint64_t i = 0; i < Queue::CAPACITY; ++i) ASSERT_TRUE(queue->schedule(i, i));
+    EXPECT_TRUE(queue->full());
+    EXPECT_FALSE(queue->schedule(0, 99));
+
+    uint64_t payload = 0;
+    ASSERT_TRUE(queue->pop_due(0, payload));
+    ASSERT_TRUE(queue->schedule(0, 99));
+    ASSERT_TRUE(queue->pop_due(0, payload));
+    EXPECT_EQ(payload, 99u);
+}
+
+TEST(EventQueueTest, RandomScheduleComesOutSorted) {
+    auto queue = std::make_unique<EventQueue<uint64_t, 4096>>();
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 4096; ++i) ASSERT_TRUE(queue->schedule(rng() % 100000, 0));
+
+    uint64_t last = 0;
+    uint64_t payload = 0;
+    size_t count = 0;
+    while (!queue->empty()) {
+        const uint64_t due = queue->next_due_ns();
+        EXPECT_GE(due, last);
+        last = due;
+        ASSERT_TRUE(queue->pop_due(due, payload));
+        ++count;
+    }
+    EXPECT_EQ(count, 4096u);
+}
+
+TEST(EventQueueTest, SimClockOnlyMovesForward) {
+    SimClock clock(1000);
+    EXPECT_EQ(clock.now_ns(), 1000u);
+    clock.advance_to(5000);
+    clock.advance_to(2000);
+    EXPECT_EQ(clock.now_ns(), 5000u);
+}
+
+} // namespace test
+} // namespace hft
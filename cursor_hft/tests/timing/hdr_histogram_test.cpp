@@ -0,0 +1,157 @@
+#include "hft/timing/hdr_histogram.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <random>
+
+namespace hft {
+namespace test {
+
+using Hist = HdrHistogram<7, 40>;
+
+TEST(HdrHistogramTest, BucketBoundaries) {
+    // Values below 2^SubBucketBits are exact
+    for (HFTTimer::ns_t v = 0; v < Hist::SUB_BUCKET_COUNT; ++v) {
+        EXPECT_EQ(Hist::index_of(v), v);
+        EXPECT_EQ(Hist::lowest_equivalent(Hist::index_of(v)), v);
+        EXPECT_EQ(Hist::highest_equivalent(Hist::index_of(v)), v);
+    }
+
+    // Every value lies inside its bucket, and buckets are contiguous
+    for (HFTTimer::ns_t v : {128ULL, 129ULL, 255ULL, 256ULL, 511ULL, 512ULL, 700ULL, 1023ULL, 1024ULL,
+                             1000000ULL, 123456789ULL}) {
+        const size_t idx = Hist::index_of(v);
+        EXPECT_LE(Hist::lowest_equivalent(idx), v);
+        EXPECT_GE(Hist::highest_equivalent(idx), v);
+        EXPECT_EQ(Hist::lowest_equivalent(idx + 1), Hist::highest_equivalent(idx) + 1);
+    }
+
+    // 4ns resolution between 512ns and 1024ns at 7 bits
+    EXPECT_EQ(Hist::highest_equivalent(Hist::index_of(600)) - Hist::lowest_equivalent(Hist::index_of(600)) + 1, 4u);
+
+    // Out-of-range values clamp into the last bucket
+    EXPECT_EQ(Hist::index_of(~0ULL), Hist::BUCKET_COUNT - 1);
+    EXPECT_EQ(Hist::index_of(Hist::MAX_TRACKABLE), Hist::BUCKET_COUNT - 1);
+}
+
+TEST(HdrHistogramTest, PercentilesWithinPrecision) {
+    auto hist = std::make_unique<Hist>();
+    for (HFTTimer::ns_t v = 1; v <= 10000; ++v) {
+        hist->record_latency(v);
+    }
+
+    const auto stats = hist->get_stats();
+    EXPECT_EQ(stats.total_samples, 10000u);
+    EXPECT_EQ(stats.min_latency, 1u);
+    EXPECT_EQ(stats.max_latency, 10000u);
+    EXPECT_NEAR(stats.mean_latency, 5000.5, 1e-6);
+
+    const std::array<double, 4> expected = {5000, 9000, 9500, 9900};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_GE(stats.percentiles[i], expected[i]);
+        EXPECT_LE(stats.percentiles[i], expected[i] * (1.0 + 1.0 / Hist::SUB_BUCKET_COUNT));
+    }
+}
+
+TEST(HdrHistogramTest, ResolvesWithinOctave) {
+    // 99% at 520ns, 1% at 1000ns: pure log2 bins cannot separate p50 from p99
+    auto hist = std::make_unique<Hist>();
+    hist->record_latency(520, 990);
+    hist->record_latency(1000, 10);
+
+    Hist::Snapshot snap;
+    hist->snapshot_into(snap);
+    EXPECT_EQ(snap.total_samples(), 1000u);
+    EXPECT_NEAR(static_cast<double>(snap.value_at_percentile(50.0)), 520.0, 4.0);
+    EXPECT_NEAR(static_cast<double>(snap.value_at_percentile(99.0)), 520.0, 4.0);
+    EXPECT_NEAR(static_cast<double>(snap.value_at_percentile(99.5)), 1000.0, 8.0);
+    EXPECT_EQ(snap.value_at_percentile(100.0), 1000u);
+}
+
+TEST(HdrHistogramTest, ResetAndEmpty) {
+    auto hist = std::make_unique<Hist>();
+    auto stats = hist->get_stats();
+    EXPECT_EQ(stats.total_samples, 0u);
+    EXPECT_EQ(stats.percentiles[3], 0);
+
+    hist->record_latency(1000);
+    hist->reset();
+    stats = hist->get_stats();
+    EXPECT_EQ(stats.total_samples, 0u);
+    EXPECT_EQ(stats.max_latency, 0u);
+}
+
+TEST(HdrHistogramTest, SnapshotMerge) {
+    auto a = std::make_unique<Hist>();
+    auto b = std::make_unique<Hist>();
+    a->record_latency(100, 50);
+    b->record_latency(5000, 50);
+
+    Hist::Snapshot sa, sb;
+    a->snapshot_into(sa);
+    b->snapshot_into(sb);
+    sa.merge(sb);
+
+    EXPECT_EQ(sa.total_samples(), 100u);
+    EXPECT_EQ(sa.min_latency(), 100u);
+    EXPECT_EQ(sa.max_latency(), 5000u);
+    EXPECT_NEAR(sa.mean_latency(), 2550.0, 1e-6);
+    EXPECT_EQ(sa.value_at_percentile(50.0), 100u);
+    EXPECT_NEAR(static_cast<double>(sa.value_at_percentile(90.0)), 5000.0, 5000.0 / Hist::SUB_BUCKET_COUNT);
+}
+
+TEST(HdrHistogramTest, ShardedConcurrentRecording) {
+    auto sharded = std::make_unique<ShardedLatencyHistogram<4>>();
+    constexpr int NUM_THREADS = 4;
+    constexpr int SAMPLES = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&sharded, t]() {
+            auto* shard = sharded->attach();
+            ASSERT_NE(shard, nullptr);
+            for (int i = 0; i < SAMPLES; ++i) {
+                shard->record_latency(static_cast<HFTTimer::ns_t>(100 * (t + 1)));
+            }
+            sharded->detach(shard);
+        });
+    }
+
+    // Readers may merge while writers run
+    ShardedLatencyHistogram<4>::Snapshot snap;
+    sharded->snapshot(snap);
+    EXPECT_LE(snap.total_samples(), static_cast<uint64_t>(NUM_THREADS * SAMPLES));
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    sharded->snapshot(snap);
+    EXPECT_EQ(snap.total_samples(), static_cast<uint64_t>(NUM_THREADS * SAMPLES));
+    EXPECT_EQ(snap.min_latency(), 100u);
+    EXPECT_EQ(snap.max_latency(), 400u);
+    EXPECT_NEAR(snap.mean_latency(), 250.0, 1e-6);
+}
+
+TEST(HdrHistogramTest, ShardExhaustion) {
+    auto sharded = std::make_unique<ShardedLatencyHistogram<2>>();
+    auto* a = sharded->attach();
+    auto* b = sharded->attach();
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(sharded->attach(), nullptr);
+
+    a->record_latency(42);
+    sharded->detach(a);
+    auto* c = sharded->attach();
+    EXPECT_EQ(c, a);
+
+    // Detached data is retained until reset
+    EXPECT_EQ(sharded->get_stats().total_samples, 1u);
+    sharded->reset();
+    EXPECT_EQ(sharded->get_stats().total_samples, 0u);
+}
+
+} // namespace test
+} // namespace hft
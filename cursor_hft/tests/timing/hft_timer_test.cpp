@@ -4,6 +4,9 @@
 #include <vector>
 #include <random>
 #include <chrono>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
 
 namespace hft {
 namespace test {
@@ -25,6 +28,31 @@ TEST_F(HFTTimerTest, BasicTiming) {
     EXPECT_LT(end - start, 2000000); // Should be < 2ms
 }
 
+TEST_F(HFTTimerTest, CalibrationMatchesMonotonicClock) {
+    EXPECT_GT(HFTTimer::cycles_per_ns(), 0.0);
+    
+    const auto start_cycles = HFTTimer::get_cycles();
+    const auto start_sys = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const auto end_cycles = HFTTimer::get_cycles();
+    const auto end_sys = std::chrono::steady_clock::now();
+    
+    const auto timer_ns = static_cast<double>(HFTTimer::cycles_to_ns(end_cycles - start_cycles));
+    const auto sys_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end_sys - start_sys).count());
+    EXPECT_NEAR(timer_ns / sys_ns, 1.0, 0.01);
+}
+
+TEST_F(HFTTimerTest, CyclesToNsFixedPoint) {
+    EXPECT_EQ(HFTTimer::cycles_to_ns(0), 0u);
+    
+    // Monotonic and linear across the fixed-point range (no overflow on large spans)
+    const auto one_second = static_cast<HFTTimer::cycle_t>(HFTTimer::cycles_per_ns() * 1e9);
+    const auto ns = HFTTimer::cycles_to_ns(one_second);
+    EXPECT_NEAR(static_cast<double>(ns), 1e9, 1e3);
+    EXPECT_NEAR(static_cast<double>(HFTTimer::cycles_to_ns(one_second * 3600)), 3600e9, 1e7);
+}
+
 TEST_F(HFTTimerTest, ScopedTimer) {
     LatencyHistogram histogram;
     
@@ -124,5 +152,36 @@ TEST_F(HFTTimerTest, ResetFunctionality) {
     EXPECT_DOUBLE_EQ(stats.std_dev, 0);
 }
 
+TEST_F(HFTTimerTest, CalibrationCache) {
+    const std::string path = "/tmp/hft_timer_calibration_" + std::to_string(::getpid());
+    std::remove(path.c_str());
+    if (HFTTimer::backend() != HFTTimer::Backend::X86Tsc) {
+        EXPECT_EQ(HFTTimer::calibrate(path.c_str()), HFTTimer::CalibrationSource::Fixed);
+        return;
+    }
+
+    EXPECT_EQ(HFTTimer::calibrate(path.c_str()), HFTTimer::CalibrationSource::Measured);
+    const double rate = HFTTimer::cycles_per_ns();
+    EXPECT_EQ(HFTTimer::calibrate(path.c_str()), HFTTimer::CalibrationSource::Cached);
+    EXPECT_NEAR(HFTTimer::cycles_per_ns() / rate, 1.0, 1e-6);
+
+    // A rate from another host (or a garbled file) is measured over and replaced
+    FILE* file = std::fopen(path.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    std::fprintf(file, "hft_timer_calibration %u %.17g\n", static_cast<unsigned>(HFTTimer::backend()), rate * 1.5);
+    std::fclose(file);
+    EXPECT_EQ(HFTTimer::calibrate(path.c_str()), HFTTimer::CalibrationSource::Measured);
+    EXPECT_NEAR(HFTTimer::cycles_per_ns() / rate, 1.0, 0.01);
+    EXPECT_EQ(HFTTimer::calibrate(path.c_str()), HFTTimer::CalibrationSource::Cached);
+
+    file = std::fopen(path.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("not a calibration\n", file);
+    std::fclose(file);
+    EXPECT_EQ(HFTTimer::calibrate(path.c_str()), HFTTimer::CalibrationSource::Measured);
+    EXPECT_EQ(HFTTimer::calibrate(nullptr), HFTTimer::CalibrationSource::Measured);
+    std::remove(path.c_str());
+}
+
 } // namespace test
 } // namespace hft 
\ No newline at end of file
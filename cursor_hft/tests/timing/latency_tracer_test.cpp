@@ -0,0 +1,111 @@
+#include "hft/timing/latency_tracer.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace hft {
+namespace test {
+
+namespace {
+// Same bucket as the HdrHistogram would put `ns` in
+void expect_near_ns(uint64_t actual, uint64_t expected) {
+    using Hist = HdrHistogram<>;
+    EXPECT_EQ(Hist::lowest_equivalent(Hist::index_of(actual)), Hist::lowest_equivalent(Hist::index_of(expected)))
+        << "actual " << actual << "ns, expected " << expected << "ns";
+}
+} // namespace
+
+TEST(LatencyTracerTest, SamplesOneTickInN) {
+    auto tracer = std::make_unique<PipelineTracer>(3);
+    EXPECT_EQ(tracer->sample_every(), 4u);  // Rounded up to a power of two
+
+    std::vector<uint32_t> ids;
+    for (int i = 0; i < 16; ++i) {
+        const uint32_t id = tracer->begin(HFTTimer::get_cycles());
+        if (id != 0) ids.push_back(id);
+    }
+    ASSERT_EQ(ids.size(), 4u);
+    for (size_t i = 1; i < ids.size(); ++i) EXPECT_NE(ids[i], ids[i - 1]);
+    EXPECT_EQ(tracer->ticks_seen(), 16u);
+    EXPECT_EQ(tracer->traces_started(), 4u);
+}
+
+TEST(LatencyTracerTest, BreakdownAttributesEachStage) {
+    auto tracer = std::make_unique<PipelineTracer>(1);
+    const uint64_t base = HFTTimer::get_cycles();
+    for (uint64_t i = 0; i < 100; ++i) {
+        const uint64_t t0 = base + i * 1000000;
+        const uint32_t id = tracer->begin(t0);
+        ASSERT_NE(id, 0u);
+        tracer->stamp(id, TraceStage::PARSED, t0 + 2000);
+        tracer->stamp(id, TraceStage::DECISION, t0 + 8000);
+        tracer->stamp(id, TraceStage::RISK, t0 + 9000);
+        EXPECT_TRUE(tracer->finish(id, TraceStage::SEND, t0 + 20000));
+    }
+    EXPECT_EQ(tracer->drain(), 100u);
+    EXPECT_EQ(tracer->traces_drained(), 100u);
+
+    // Each stage holds the time since the previous stamped one; BOOK was never stamped
+    const auto parse = tracer->stage_breakdown(TraceStage::PARSED);
+    EXPECT_EQ(parse.count, 100u);
+    expect_near_ns(parse.p50_ns, HFTTimer::cycles_to_ns(2000));
+    EXPECT_EQ(tracer->stage_breakdown(TraceStage::BOOK).count, 0u);
+    expect_near_ns(tracer->stage_breakdown(TraceStage::DECISION).p99_ns, HFTTimer::cycles_to_ns(6000));
+    expect_near_ns(tracer->stage_breakdown(TraceStage::RISK).max_ns, HFTTimer::cycles_to_ns(1000));
+    expect_near_ns(tracer->stage_breakdown(TraceStage::SEND).p50_ns, HFTTimer::cycles_to_ns(11000));
+    EXPECT_EQ(tracer->stage_breakdown(TraceStage::INGRESS).count, 0u);
+
+    const auto total = tracer->total_breakdown();
+    EXPECT_EQ(total.count, 100u);
+    expect_near_ns(total.p90_ns, HFTTimer::cycles_to_ns(20000));
+    EXPECT_EQ(tracer->stage_histogram(TraceStage::SEND).get_stats().total_samples, 100u);
+
+    tracer->reset_breakdown();
+    EXPECT_EQ(tracer->total_breakdown().count, 0u);
+}
+
+TEST(LatencyTracerTest, UntracedAndStaleIdsAreIgnored) {
+    auto tracer = std::make_unique<LatencyTracer<4>>(1);
+    tracer->stamp(0, TraceStage::RISK);
+    EXPECT_FALSE(tracer->finish(0));
+
+    // A fifth trace reuses the first one's slot; the first can no longer be stamped
+    const uint32_t first = tracer->begin(HFTTimer::get_cycles());
+    for (int i = 0; i < 3; ++i) (void)tracer->begin(HFTTimer::get_cycles());
+    const uint32_t fifth = tracer->begin(HFTTimer::get_cycles());
+    EXPECT_EQ(tracer->traces_overwritten(), 1u);
+    EXPECT_FALSE(tracer->finish(first));
+    EXPECT_TRUE(tracer->finish(fifth));
+    EXPECT_FALSE(tracer->finish(fifth));  // Already finished
+    EXPECT_EQ(tracer->drain(), 1u);
+}
+
+TEST(LatencyTracerTest, ReporterDrainsWhilePipelineTraces) {
+    auto tracer = std::make_unique<PipelineTracer>(1);
+    constexpr int TRACES = 20000;
+    std::atomic<bool> done{false};
+    size_t drained = 0;
+    std::thread reporter([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            drained += tracer->drain();
+            std::this_thread::yield();
+        }
+        drained += tracer->drain();
+    });
+
+    for (int i = 0; i < TRACES; ++i) {
+        const uint32_t id = tracer->begin(HFTTimer::get_cycles());
+        tracer->stamp(id, TraceStage::DECISION);
+        if (!tracer->finish(id)) std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+    reporter.join();
+
+    EXPECT_EQ(drained + tracer->completed_dropped(), static_cast<size_t>(TRACES));
+    EXPECT_EQ(tracer->total_breakdown().count, drained);
+}
+
+} // namespace test
+} // namespace hft
@@ -0,0 +1,66 @@
+#include "hft/timing/perf_counters.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+namespace hft {
+namespace test {
+
+namespace {
+uint64_t spin(uint64_t rounds) {
+    volatile uint64_t sum = 0;
+    for (uint64_t i = 0; i < rounds; ++i) sum = sum + i * 7;
+    return sum;
+}
+} // namespace
+
+TEST(PerfCountersTest, UnavailableGroupIsANoOp) {
+    PerfCounterGroup group;
+    group.start();
+    (void)spin(1000);
+    const PerfCounts counts = group.stop();
+    if (group.available()) {
+        EXPECT_NE(counts.valid_mask, 0u);
+        return;
+    }
+    // No PMU access here (VM, perf_event_paranoid): nothing counted, nothing reported
+    EXPECT_EQ(counts.valid_mask, 0u);
+    for (uint64_t value : counts.values) EXPECT_EQ(value, 0u);
+}
+
+TEST(PerfCountersTest, CountsScaleWithWork) {
+    PerfCounterGroup group;
+    if (!group.available() || !group.has(PerfEvent::INSTRUCTIONS)) GTEST_SKIP() << "No hardware counters";
+
+    group.start();
+    (void)spin(10000);
+    const PerfCounts small = group.stop();
+    group.start();
+    (void)spin(1000000);
+    const PerfCounts large = group.stop();
+
+    EXPECT_GT(small[PerfEvent::INSTRUCTIONS], 10000u);
+    EXPECT_GT(large[PerfEvent::INSTRUCTIONS], small[PerfEvent::INSTRUCTIONS] * 10);
+}
+
+TEST(PerfCountersTest, PausedWorkIsNotCounted) {
+    PerfCounterGroup group;
+    if (!group.available() || !group.has(PerfEvent::INSTRUCTIONS)) GTEST_SKIP() << "No hardware counters";
+
+    group.start();
+    (void)spin(10000);
+    group.pause();
+    (void)spin(1000000);
+    group.resume();
+    const PerfCounts counts = group.stop();
+    EXPECT_LT(counts[PerfEvent::INSTRUCTIONS], 500000u);
+}
+
+TEST(PerfCountersTest, EventNames) {
+    EXPECT_STREQ(perf_event_name(PerfEvent::INSTRUCTIONS), "instructions");
+    EXPECT_STREQ(perf_event_name(PerfEvent::L1D_MISSES), "l1d_misses");
+    EXPECT_STREQ(perf_event_name(PerfEvent::DTLB_MISSES), "dtlb_misses");
+}
+
+} // namespace test
+} // namespace hft
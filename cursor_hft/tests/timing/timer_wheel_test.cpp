@@ -0,0 +1,86 @@
+#include "hft/timing/timer_wheel.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+namespace hft {
+namespace test {
+
+using Wheel = TimerWheel<8, 16>;
+constexpr uint64_t TICK = 1000;
+
+TEST(TimerWheelTest, FiresInDueOrderOfTicks) {
+    Wheel wheel(TICK, 0);
+    ASSERT_NE(wheel.schedule(2500, 1), 0u);
+    ASSERT_NE(wheel.schedule(500, 2), 0u);
+    ASSERT_NE(wheel.schedule(7000, 3), 0u);
+    EXPECT_EQ(wheel.size(), 3u);
+
+    std::vector<uint64_t> fired;
+    const auto record = [&](uint64_t payload, uint64_t) { fired.push_back(payload); };
+    EXPECT_EQ(wheel.advance(1000, record), 1u);
+    EXPECT_EQ(wheel.advance(2499, record), 0u);
+    EXPECT_EQ(wheel.advance(2500, record), 1u);
+    EXPECT_EQ(wheel.advance(10000, record), 1u);
+    EXPECT_EQ(fired, (std::vector<uint64_t>{2, 1, 3}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, TimersBeyondOneRevolutionWait) {
+    Wheel wheel(TICK, 0);
+    (void)wheel.schedule(3000, 1);
+    (void)wheel.schedule(3000 + 8 * TICK, 2);  // Same slot, next revolution
+
+    std::vector<uint64_t> fired;
+    const auto record = [&](uint64_t payload, uint64_t) { fired.push_back(payload); };
+    EXPECT_EQ(wheel.advance(3000, record), 1u);
+    EXPECT_EQ(wheel.advance(9000, record), 0u);
+    EXPECT_EQ(wheel.advance(11000, record), 1u);
+    EXPECT_EQ(fired, (std::vector<uint64_t>{1, 2}));
+
+    // A long jump still visits every slot once
+    (void)wheel.schedule(12000, 3);
+    (void)wheel.schedule(15000, 4);
+    EXPECT_EQ(wheel.advance(100000, record), 2u);
+}
+
+TEST(TimerWheelTest, CancelAndCapacity) {
+    Wheel wheel(TICK, 0);
+    std::vector<Wheel::handle_t> handles;
+    for (uint64_t i = 0; i < Wheel::CAPACITY; ++i) {
+        handles.push_back(wheel.schedule(1000 + i * 100, i));
+        ASSERT_NE(handles.back(), 0u);
+    }
+    EXPECT_EQ(wheel.schedule(5000, 99), 0u);
+
+    EXPECT_TRUE(wheel.cancel(handles[3]));
+    EXPECT_FALSE(wheel.cancel(handles[3]));
+    EXPECT_FALSE(wheel.cancel(0));
+    EXPECT_NE(wheel.schedule(5000, 99), 0u);
+
+    size_t fired = 0;
+    wheel.advance(1000000, [&](uint64_t payload, uint64_t) {
+        EXPECT_NE(payload, 3u);
+        ++fired;
+    });
+    EXPECT_EQ(fired, Wheel::CAPACITY);
+}
+
+TEST(TimerWheelTest, CallbacksCanReschedule) {
+    Wheel wheel(TICK, 0);
+    (void)wheel.schedule(1000, 0);
+
+    uint64_t count = 0;
+    const auto periodic = [&](uint64_t payload, uint64_t due_ns) {
+        ++count;
+        (void)wheel.schedule(due_ns + 2 * TICK, payload + 1);
+    };
+    for (uint64_t now = 0; now <= 10000; now += TICK) {
+        wheel.advance(now, periodic);
+    }
+    EXPECT_EQ(count, 5u);  // 1000, 3000, 5000, 7000, 9000
+    EXPECT_EQ(wheel.size(), 1u);
+}
+
+} // namespace test
+} // namespace hft
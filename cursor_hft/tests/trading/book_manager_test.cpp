@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "hft/trading/book_manager.hpp"
+
+using namespace hft::trading;
+using namespace hft::market_data;
+
+class BookManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        manager_ = std::make_unique<BookManager>();
+        next_sequence_ = 1;
+    }
+
+    void TearDown() override {
+        manager_->reset();
+    }
+
+    TreasuryOrder make_order(uint64_t id, TreasuryType inst, OrderSide side,
+                             double price, uint64_t qty) {
+        return TreasuryOrder(id, inst, side, OrderType::LIMIT,
+                             Price32nd::from_decimal(price), qty, next_sequence_++);
+    }
+
+    std::unique_ptr<BookManager> manager_;
+    uint64_t next_sequence_;
+};
+
+TEST_F(BookManagerTest, OrdersRouteToInstrumentBook) {
+    ASSERT_TRUE(manager_->add_order(make_order(1, TreasuryType::Note_2Y, OrderSide::BID, 99.5, 1000000)));
+    ASSERT_TRUE(manager_->add_order(make_order(1, TreasuryType::Bond_30Y, OrderSide::BID, 95.0, 2000000)));
+
+    EXPECT_EQ(manager_->book(TreasuryType::Note_2Y).get_best_bid().first.to_decimal(), 99.5);
+    EXPECT_EQ(manager_->book(TreasuryType::Bond_30Y).get_best_bid().first.to_decimal(), 95.0);
+    EXPECT_EQ(manager_->book(TreasuryType::Note_10Y).get_stats().total_orders, 0);
+    EXPECT_EQ(manager_->total_orders(), 2);
+
+    EXPECT_TRUE(manager_->cancel_order(TreasuryType::Note_2Y, 1));
+    EXPECT_EQ(manager_->book(TreasuryType::Note_2Y).get_stats().total_orders, 0);
+    EXPECT_EQ(manager_->book(TreasuryType::Bond_30Y).get_stats().total_orders, 1);
+}
+
+TEST_F(BookManagerTest, BooksStampTheirInstrument) {
+    for (size_t i = 0; i < BookManager::MAX_INSTRUMENTS; ++i) {
+        const auto inst = static_cast<TreasuryType>(i);
+        EXPECT_EQ(manager_->book(inst).instrument(), inst);
+    }
+
+    ASSERT_TRUE(manager_->add_order(make_order(7, TreasuryType::Bill_6M, OrderSide::ASK, 99.75, 1000000)));
+    while (!manager_->update_buffer().empty()) {
+        OrderBookUpdate drained;
+        (void)manager_->update_buffer().try_pop(drained);
+    }
+    ASSERT_EQ(manager_->book(TreasuryType::Bill_6M).process_trade(
+                  Price32nd::from_decimal(99.75), 500000, OrderSide::ASK), 1);
+
+    OrderBookUpdate update;
+    ASSERT_TRUE(manager_->update_buffer().try_pop(update));
+    EXPECT_EQ(update.update_type, OrderBookUpdate::TRADE_EXECUTED);
+    EXPECT_EQ(update.instrument_type, TreasuryType::Bill_6M);
+}
+
+TEST_F(BookManagerTest, HotInstrumentCannotStarveOthers) {
+    const size_t quota = manager_->book(TreasuryType::Note_10Y).max_orders();
+    EXPECT_EQ(quota, BookManager::ORDER_CAPACITY / BookManager::MAX_INSTRUMENTS);
+
+    // Fill the 10Y quota on a handful of levels
+    size_t accepted = 0;
+    for (uint64_t id = 1; id <= quota + 100; ++id) {
+        if (manager_->add_order(make_order(id, TreasuryType::Note_10Y, OrderSide::BID,
+                                           99.0 + (id % 8) / 32.0, 1000000))) {
+            ++accepted;
+        }
+    }
+    EXPECT_EQ(accepted, quota);
+
+    // Every other instrument still gets its full share
+    for (size_t i = 0; i < BookManager::MAX_INSTRUMENTS; ++i) {
+        const auto inst = static_cast<TreasuryType>(i);
+        if (inst == TreasuryType::Note_10Y) continue;
+        for (uint64_t id = 1; id <= quota; ++id) {
+            ASSERT_TRUE(manager_->add_order(make_order(id, inst, OrderSide::ASK, 100.0, 1000000)));
+        }
+    }
+}
+
+TEST_F(BookManagerTest, LevelQuotaIsEnforced) {
+    const size_t level_quota = manager_->book(TreasuryType::Note_5Y).max_levels();
+    size_t accepted = 0;
+    for (uint64_t id = 1; id <= level_quota + 10; ++id) {
+        if (manager_->add_order(make_order(id, TreasuryType::Note_5Y, OrderSide::BID,
+                                           90.0 + id / 64.0, 1000000))) {
+            ++accepted;
+        }
+    }
+    EXPECT_EQ(accepted, level_quota);
+    EXPECT_EQ(manager_->book(TreasuryType::Note_5Y).get_stats().total_bid_levels, level_quota);
+}
+
+TEST_F(BookManagerTest, QuotasCannotOversubscribePools) {
+    EXPECT_FALSE(manager_->set_quota(TreasuryType::Note_10Y, BookManager::ORDER_CAPACITY, 100));
+
+    // Shrink the bills and hand the spare capacity to the 10Y
+    const size_t share = BookManager::ORDER_CAPACITY / BookManager::MAX_INSTRUMENTS;
+    EXPECT_TRUE(manager_->set_quota(TreasuryType::Bill_3M, 16, 16));
+    EXPECT_TRUE(manager_->set_quota(TreasuryType::Note_10Y, share * 2 - 16, 100));
+    EXPECT_EQ(manager_->book(TreasuryType::Note_10Y).max_orders(), share * 2 - 16);
+}
+
+TEST_F(BookManagerTest, TickDispatchUsesInstrument) {
+    std::vector<TreasuryTick> ticks(3);
+    ticks[0].instrument_type = TreasuryType::Bill_3M;
+    ticks[1].instrument_type = TreasuryType::Note_5Y;
+    ticks[2].instrument_type = TreasuryType::Bond_30Y;
+
+    std::vector<TreasuryType> seen;
+    manager_->on_ticks(ticks.data(), ticks.size(), [&](TreasuryOrderBook& book, const TreasuryTick& tick) {
+        EXPECT_EQ(book.instrument(), tick.instrument_type);
+        seen.push_back(book.instrument());
+    });
+    ASSERT_EQ(seen.size(), 3);
+    EXPECT_EQ(seen[1], TreasuryType::Note_5Y);
+
+    bool called = false;
+    manager_->on_tick(ticks[2], [&](TreasuryOrderBook& book, const TreasuryTick&) {
+        called = (&book == &manager_->book(TreasuryType::Bond_30Y));
+    });
+    EXPECT_TRUE(called);
+}
+
+TEST_F(BookManagerTest, MatchingIsPerInstrument) {
+    ASSERT_TRUE(manager_->add_order(make_order(1, TreasuryType::Note_2Y, OrderSide::ASK, 100.0, 1000000)));
+    ASSERT_TRUE(manager_->add_order(make_order(1, TreasuryType::Note_5Y, OrderSide::ASK, 100.0, 1000000)));
+
+    auto result = manager_->match_order(make_order(2, TreasuryType::Note_2Y, OrderSide::BID, 100.0, 1000000));
+    EXPECT_EQ(result.filled_quantity, 1000000);
+    EXPECT_EQ(manager_->book(TreasuryType::Note_2Y).get_best_ask().second, 0);
+    EXPECT_EQ(manager_->book(TreasuryType::Note_5Y).get_best_ask().second, 1000000);
+}
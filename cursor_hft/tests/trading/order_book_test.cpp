@@ -3,6 +3,9 @@
 #include <vector>
 #include <chrono>
 #include <random>
+#include <array>
+#include <map>
+#include <cmath>
 #include "hft/trading/order_book.hpp"
 #include "hft/timing/hft_timer.hpp"
 
@@ -480,4 +483,432 @@ TEST_F(OrderBookTest, RandomOperationsStressTest) {
     
     // Clean up
     order_book_->reset();
-}
\ No newline at end of file
+}
+
+// Allocation-free depth API tests
+TEST_F(OrderBookTest, MarketDepthIntoCallerBuffer) {
+    EXPECT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::BID, 99.5, 1000000)));
+    EXPECT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::BID, 99.25, 500000)));
+    EXPECT_TRUE(order_book_->add_order(create_test_order(3, OrderSide::BID, 99.25, 250000)));
+    EXPECT_TRUE(order_book_->add_order(create_test_order(4, OrderSide::BID, 99.0, 750000)));
+
+    std::array<TreasuryOrderBook::MarketDepth, 2> top{};
+    ASSERT_EQ(order_book_->get_market_depth(OrderSide::BID, top), 2u);
+    EXPECT_DOUBLE_EQ(top[0].price.to_decimal(), 99.5);
+    EXPECT_EQ(top[0].quantity, 1000000u);
+    EXPECT_DOUBLE_EQ(top[1].price.to_decimal(), 99.25);
+    EXPECT_EQ(top[1].quantity, 750000u);
+    EXPECT_EQ(top[1].order_count, 2u);
+
+    std::array<TreasuryOrderBook::MarketDepth, 8> full{};
+    EXPECT_EQ(order_book_->get_market_depth(OrderSide::BID, full), 3u);
+    EXPECT_EQ(order_book_->get_market_depth(OrderSide::ASK, full), 0u);
+}
+
+TEST_F(OrderBookTest, DepthLevelsFillParallelArrays) {
+    EXPECT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::ASK, 100.0, 1000000)));
+    EXPECT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::ASK, 100.25, 2000000)));
+
+    // Same shape as a strategy MarketUpdate's ask_levels/ask_sizes
+    std::array<Price32nd, 5> prices{};
+    std::array<uint64_t, 5> sizes;
+    sizes.fill(42);
+    ASSERT_EQ(order_book_->get_depth_levels(OrderSide::ASK, prices, sizes), 2u);
+    EXPECT_DOUBLE_EQ(prices[0].to_decimal(), 100.0);
+    EXPECT_DOUBLE_EQ(prices[1].to_decimal(), 100.25);
+    EXPECT_EQ(sizes[0], 1000000u);
+    EXPECT_EQ(sizes[1], 2000000u);
+    for (size_t i = 2; i < sizes.size(); ++i) {
+        EXPECT_EQ(sizes[i], 0u);
+        EXPECT_EQ(prices[i].whole, 0);
+    }
+}
+
+TEST_F(OrderBookTest, IncrementalDepthChanges) {
+    std::array<TreasuryOrderBook::DepthChange, 16> changes;
+
+    order_book_->set_depth_tracking(true);
+    auto delta = order_book_->drain_depth_changes(changes);
+    EXPECT_TRUE(delta.snapshot_required); // Seed the mirror first
+    EXPECT_EQ(delta.count, 0u);
+
+    EXPECT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::BID, 99.5, 1000000)));
+    EXPECT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::BID, 99.5, 500000)));
+    EXPECT_TRUE(order_book_->add_order(create_test_order(3, OrderSide::ASK, 100.0, 300000)));
+
+    // Repeated changes to one level collapse into a single record
+    delta = order_book_->drain_depth_changes(changes);
+    EXPECT_FALSE(delta.snapshot_required);
+    ASSERT_EQ(delta.count, 2u);
+    EXPECT_EQ(changes[0].side, OrderSide::BID);
+    EXPECT_DOUBLE_EQ(changes[0].price.to_decimal(), 99.5);
+    EXPECT_EQ(changes[0].quantity, 1500000u);
+    EXPECT_EQ(changes[0].order_count, 2u);
+    EXPECT_EQ(changes[1].side, OrderSide::ASK);
+    EXPECT_EQ(changes[1].quantity, 300000u);
+
+    // Nothing changed since the last drain
+    EXPECT_EQ(order_book_->drain_depth_changes(changes).count, 0u);
+
+    // Level removal publishes quantity 0
+    EXPECT_TRUE(order_book_->cancel_order(3));
+    (void)order_book_->process_trade(make_price(99.5), 200000, OrderSide::BID);
+    delta = order_book_->drain_depth_changes(changes);
+    ASSERT_EQ(delta.count, 2u);
+    EXPECT_EQ(changes[0].side, OrderSide::ASK);
+    EXPECT_EQ(changes[0].quantity, 0u);
+    EXPECT_EQ(changes[1].quantity, 1300000u);
+}
+
+TEST_F(OrderBookTest, IncrementalDepthMirrorStaysConsistent) {
+    std::mt19937 gen(99);
+    std::uniform_int_distribution<> tick_dist(-40, 40);
+    std::vector<uint64_t> active;
+    std::array<TreasuryOrderBook::DepthChange, TreasuryOrderBook::MAX_PENDING_DEPTH_CHANGES> changes;
+    std::array<TreasuryOrderBook::MarketDepth, 256> snapshot;
+
+    // Mirror: tick -> quantity per side
+    std::map<int, uint64_t> bid_mirror, ask_mirror;
+    auto to_tick = [](Price32nd p) { return static_cast<int>(std::lround(p.to_decimal() * 64.0)); };
+
+    order_book_->set_depth_tracking(true);
+    uint64_t next_id = 1;
+    for (int round = 0; round < 200; ++round) {
+        for (int op = 0; op < 20; ++op) {
+            if (active.empty() || (gen() % 3) != 0) {
+                OrderSide side = (gen() & 1) ? OrderSide::BID : OrderSide::ASK;
+                double base = side == OrderSide::BID ? 99.0 : 100.0;
+                if (order_book_->add_order(create_test_order(next_id, side, base + tick_dist(gen) / 64.0, 100000))) {
+                    active.push_back(next_id);
+                }
+                ++next_id;
+            } else {
+                size_t idx = gen() % active.size();
+                (void)order_book_->cancel_order(active[idx]);
+                active.erase(active.begin() + idx);
+            }
+        }
+
+        auto delta = order_book_->drain_depth_changes(changes);
+        if (delta.snapshot_required) {
+            bid_mirror.clear();
+            ask_mirror.clear();
+            for (OrderSide side : {OrderSide::BID, OrderSide::ASK}) {
+                auto& mirror = side == OrderSide::BID ? bid_mirror : ask_mirror;
+                size_t n = order_book_->get_market_depth(side, snapshot);
+                for (size_t i = 0; i < n; ++i) mirror[to_tick(snapshot[i].price)] = snapshot[i].quantity;
+            }
+        } else {
+            for (size_t i = 0; i < delta.count; ++i) {
+                auto& mirror = changes[i].side == OrderSide::BID ? bid_mirror : ask_mirror;
+                if (changes[i].quantity == 0) {
+                    mirror.erase(to_tick(changes[i].price));
+                } else {
+                    mirror[to_tick(changes[i].price)] = changes[i].quantity;
+                }
+            }
+        }
+
+        for (OrderSide side : {OrderSide::BID, OrderSide::ASK}) {
+            auto& mirror = side == OrderSide::BID ? bid_mirror : ask_mirror;
+            size_t n = order_book_->get_market_depth(side, snapshot);
+            ASSERT_EQ(n, mirror.size());
+            for (size_t i = 0; i < n; ++i) {
+                ASSERT_EQ(mirror[to_tick(snapshot[i].price)], snapshot[i].quantity);
+            }
+        }
+    }
+}
+
+// Matching engine mode tests
+TEST_F(OrderBookTest, MatchCrossingLimitFillsAndRestsRemainder) {
+    ASSERT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::ASK, 100.0, 1000000)));
+    ASSERT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::ASK, 100.03125, 1000000)));
+
+    // Buy 1.5MM up to 100-01: takes the touch, rests 500K at the limit
+    auto result = order_book_->match_order(create_test_order(10, OrderSide::BID, 100.015625, 1500000));
+    EXPECT_TRUE(result.accepted);
+    EXPECT_EQ(result.filled_quantity, 1000000);
+    EXPECT_EQ(result.remaining_quantity, 500000);
+    EXPECT_EQ(result.trade_count, 1);
+    EXPECT_TRUE(result.rested);
+
+    EXPECT_EQ(order_book_->get_best_bid().first.to_decimal(), 100.015625);
+    EXPECT_EQ(order_book_->get_best_ask().first.to_decimal(), 100.03125);
+    EXPECT_EQ(order_book_->get_best_bid().second, 500000);
+    EXPECT_EQ(order_book_->get_order(1), nullptr);
+    ASSERT_NE(order_book_->get_order(10), nullptr);
+    EXPECT_EQ(order_book_->get_order(10)->remaining_quantity, 500000);
+}
+
+TEST_F(OrderBookTest, MatchPartialFillLeavesRestingOrder) {
+    ASSERT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::BID, 99.5, 3000000)));
+
+    auto result = order_book_->match_order(create_test_order(10, OrderSide::ASK, 99.5, 1000000));
+    EXPECT_EQ(result.filled_quantity, 1000000);
+    EXPECT_EQ(result.remaining_quantity, 0);
+    EXPECT_FALSE(result.rested);
+
+    const auto* resting = order_book_->get_order(1);
+    ASSERT_NE(resting, nullptr);
+    EXPECT_EQ(resting->remaining_quantity, 2000000);
+    EXPECT_EQ(order_book_->get_best_bid().second, 2000000);
+    EXPECT_EQ(order_book_->get_order(10), nullptr);
+}
+
+TEST_F(OrderBookTest, MatchRespectsTimePriority) {
+    ASSERT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::ASK, 100.0, 1000000)));
+    ASSERT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::ASK, 100.0, 1000000)));
+    ASSERT_TRUE(order_book_->add_order(create_test_order(3, OrderSide::ASK, 100.0, 1000000)));
+
+    auto result = order_book_->match_order(create_test_order(10, OrderSide::BID, 100.0, 1500000));
+    EXPECT_EQ(result.trade_count, 2);
+    EXPECT_EQ(order_book_->get_order(1), nullptr);
+    ASSERT_NE(order_book_->get_order(2), nullptr);
+    EXPECT_EQ(order_book_->get_order(2)->remaining_quantity, 500000);
+    ASSERT_NE(order_book_->get_order(3), nullptr);
+    EXPECT_EQ(order_book_->get_order(3)->remaining_quantity, 1000000);
+}
+
+TEST_F(OrderBookTest, MatchIocCancelsRemainder) {
+    ASSERT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::ASK, 100.0, 1000000)));
+    ASSERT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::ASK, 100.0625, 1000000)));
+
+    auto ioc = create_test_order(10, OrderSide::BID, 100.03125, 2000000);
+    ioc.type = OrderType::IOC;
+    auto result = order_book_->match_order(ioc);
+    EXPECT_EQ(result.filled_quantity, 1000000);
+    EXPECT_EQ(result.remaining_quantity, 1000000);
+    EXPECT_FALSE(result.rested);
+    EXPECT_EQ(order_book_->get_order(10), nullptr);
+    EXPECT_EQ(order_book_->get_best_bid().first.whole, 0);
+    EXPECT_EQ(order_book_->get_best_ask().first.to_decimal(), 100.0625);
+}
+
+TEST_F(OrderBookTest, MatchMarketOrderSweepsLevels) {
+    ASSERT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::BID, 99.5, 1000000)));
+    ASSERT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::BID, 99.0, 1000000)));
+    ASSERT_TRUE(order_book_->add_order(create_test_order(3, OrderSide::BID, 98.5, 1000000)));
+
+    auto market = create_test_order(10, OrderSide::ASK, 0.0, 2500000);
+    market.type = OrderType::MARKET;
+    auto result = order_book_->match_order(market);
+    EXPECT_TRUE(result.accepted);
+    EXPECT_EQ(result.filled_quantity, 2500000);
+    EXPECT_EQ(result.trade_count, 3);
+
+    auto stats = order_book_->get_stats();
+    EXPECT_EQ(stats.total_bid_levels, 1);
+    EXPECT_EQ(order_book_->get_best_bid().first.to_decimal(), 98.5);
+    EXPECT_EQ(order_book_->get_best_bid().second, 500000);
+    EXPECT_EQ(order_book_->total_trades(), 3);
+    EXPECT_EQ(order_book_->total_matched_quantity(), 2500000);
+}
+
+TEST_F(OrderBookTest, MatchNonCrossingLimitRests) {
+    ASSERT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::ASK, 100.0, 1000000)));
+
+    auto result = order_book_->match_order(create_test_order(10, OrderSide::BID, 99.96875, 1000000));
+    EXPECT_EQ(result.filled_quantity, 0);
+    EXPECT_TRUE(result.rested);
+    EXPECT_EQ(order_book_->get_best_bid().first.to_decimal(), 99.96875);
+
+    // Duplicate IDs are rejected before any matching
+    auto dup = order_book_->match_order(create_test_order(1, OrderSide::BID, 100.0, 1000000));
+    EXPECT_FALSE(dup.accepted);
+    EXPECT_EQ(order_book_->get_best_ask().second, 1000000);
+}
+
+TEST_F(OrderBookTest, MatchEmitsTradeEvents) {
+    ASSERT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::ASK, 100.0, 1000000)));
+    ASSERT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::ASK, 100.03125, 2000000)));
+
+    // Discard add notifications
+    OrderBookUpdate update;
+    while (update_buffer_->try_pop(update)) {}
+
+    (void)order_book_->match_order(create_test_order(10, OrderSide::BID, 100.03125, 2000000));
+
+    std::vector<OrderBookUpdate> trades;
+    while (update_buffer_->try_pop(update)) {
+        if (update.update_type == OrderBookUpdate::TRADE_EXECUTED) trades.push_back(update);
+    }
+    ASSERT_EQ(trades.size(), 2);
+    EXPECT_EQ(trades[0].order_id, 1);
+    EXPECT_EQ(trades[0].quantity, 1000000);
+    EXPECT_EQ(trades[0].side, OrderSide::ASK);
+    EXPECT_EQ(trades[0].aggressor_order_id, 10);
+    EXPECT_EQ(trades[1].order_id, 2);
+    EXPECT_EQ(trades[1].quantity, 1000000);
+    EXPECT_EQ(trades[1].price.to_decimal(), 100.03125);
+    EXPECT_EQ(trades[0].timestamp_ns, trades[1].timestamp_ns);
+}
+
+TEST_F(OrderBookTest, ReduceOrderKeepsTimePriority) {
+    ASSERT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::BID, 99.5, 3000000)));
+    ASSERT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::BID, 99.5, 1000000)));
+
+    EXPECT_FALSE(order_book_->reduce_order(1, 3000000));  // Not a reduction
+    EXPECT_FALSE(order_book_->reduce_order(1, 0));        // That is a cancel
+    EXPECT_FALSE(order_book_->reduce_order(99, 1000000));
+    ASSERT_TRUE(order_book_->reduce_order(1, 1000000));
+
+    const auto* level = order_book_->get_level(OrderSide::BID, make_price(99.5));
+    ASSERT_NE(level, nullptr);
+    EXPECT_EQ(level->total_quantity, 2000000);
+    EXPECT_EQ(level->first_order->order_id, 1);
+    EXPECT_EQ(order_book_->get_level(OrderSide::ASK, make_price(99.5)), nullptr);
+
+    // Order 1 is still first in the queue
+    OrderBookUpdate update;
+    while (update_buffer_->try_pop(update)) {}
+    const auto result = order_book_->match_order(create_test_order(10, OrderSide::ASK, 99.5, 1000000));
+    EXPECT_EQ(result.filled_quantity, 1000000);
+    EXPECT_EQ(order_book_->get_order(1), nullptr);
+    ASSERT_NE(order_book_->get_order(2), nullptr);
+}
+
+// Ladder mode tests
+class LadderOrderBookTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        order_pool_ = std::make_unique<TreasuryOrderPool>();
+        level_pool_ = std::make_unique<LadderPriceLevelPool>();
+        update_buffer_ = std::make_unique<OrderBookUpdateBuffer>();
+        order_book_ = std::make_unique<TreasuryLadderOrderBook>(
+            *order_pool_, *level_pool_, *update_buffer_);
+        next_sequence_ = 1;
+    }
+
+    void TearDown() override {
+        order_book_->reset();
+        order_pool_->reset();
+        level_pool_->reset();
+    }
+
+    TreasuryOrder create_test_order(uint64_t order_id, OrderSide side,
+                                   double price_decimal, uint64_t quantity) {
+        return TreasuryOrder(order_id, TreasuryType::Note_10Y, side, OrderType::LIMIT,
+                           Price32nd::from_decimal(price_decimal), quantity, next_sequence_++);
+    }
+
+    std::unique_ptr<TreasuryOrderPool> order_pool_;
+    std::unique_ptr<LadderPriceLevelPool> level_pool_;
+    std::unique_ptr<OrderBookUpdateBuffer> update_buffer_;
+    std::unique_ptr<TreasuryLadderOrderBook> order_book_;
+    uint64_t next_sequence_;
+};
+
+TEST_F(LadderOrderBookTest, DeepBookSortedDepth) {
+    // Insert 200 bid levels one tick apart in scrambled order
+    for (int i = 0; i < 200; ++i) {
+        int tick = (i * 37) % 200;
+        EXPECT_TRUE(order_book_->add_order(
+            create_test_order(i + 1, OrderSide::BID, 99.0 - tick / 64.0, 1000000)));
+    }
+
+    auto stats = order_book_->get_stats();
+    EXPECT_EQ(stats.total_bid_levels, 200);
+
+    auto depth = order_book_->get_market_depth(OrderSide::BID, 200);
+    ASSERT_EQ(depth.size(), 200);
+    for (size_t i = 0; i < depth.size(); ++i) {
+        EXPECT_DOUBLE_EQ(depth[i].price.to_decimal(), 99.0 - i / 64.0);
+    }
+}
+
+TEST_F(LadderOrderBookTest, CancelDeepLevelKeepsOrdering) {
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(order_book_->add_order(
+            create_test_order(i + 1, OrderSide::ASK, 100.0 + i / 64.0, 500000)));
+    }
+
+    // Remove every other level, including the best
+    for (int i = 0; i < 100; i += 2) {
+        EXPECT_TRUE(order_book_->cancel_order(i + 1));
+    }
+
+    auto depth = order_book_->get_market_depth(OrderSide::ASK, 100);
+    ASSERT_EQ(depth.size(), 50);
+    for (size_t i = 0; i < depth.size(); ++i) {
+        EXPECT_DOUBLE_EQ(depth[i].price.to_decimal(), 100.0 + (2 * i + 1) / 64.0);
+    }
+    EXPECT_DOUBLE_EQ(order_book_->get_best_ask().first.to_decimal(), 100.0 + 1 / 64.0);
+}
+
+TEST_F(LadderOrderBookTest, RecentersWhenPriceDrifts) {
+    // Best bid starts at 99, then moves 100 points away (beyond the window)
+    EXPECT_TRUE(order_book_->add_order(create_test_order(1, OrderSide::BID, 99.0, 1000000)));
+    EXPECT_TRUE(order_book_->add_order(create_test_order(2, OrderSide::BID, 199.0, 1000000)));
+    EXPECT_DOUBLE_EQ(order_book_->get_best_bid().first.to_decimal(), 199.0);
+
+    // New levels near the new touch are indexed and sorted correctly
+    EXPECT_TRUE(order_book_->add_order(create_test_order(3, OrderSide::BID, 198.5, 1000000)));
+    EXPECT_TRUE(order_book_->add_order(create_test_order(4, OrderSide::BID, 198.75, 1000000)));
+
+    auto depth = order_book_->get_market_depth(OrderSide::BID, 10);
+    ASSERT_EQ(depth.size(), 4);
+    EXPECT_DOUBLE_EQ(depth[0].price.to_decimal(), 199.0);
+    EXPECT_DOUBLE_EQ(depth[1].price.to_decimal(), 198.75);
+    EXPECT_DOUBLE_EQ(depth[2].price.to_decimal(), 198.5);
+    EXPECT_DOUBLE_EQ(depth[3].price.to_decimal(), 99.0);
+
+    // Cancelling the far touch drifts back and the old level stays reachable
+    EXPECT_TRUE(order_book_->cancel_order(2));
+    EXPECT_TRUE(order_book_->cancel_order(4));
+    EXPECT_TRUE(order_book_->cancel_order(3));
+    EXPECT_DOUBLE_EQ(order_book_->get_best_bid().first.to_decimal(), 99.0);
+    EXPECT_TRUE(order_book_->cancel_order(1));
+    EXPECT_EQ(order_book_->get_stats().total_bid_levels, 0);
+}
+
+TEST_F(LadderOrderBookTest, MatchesListBookUnderRandomOperations) {
+    TreasuryOrderPool list_order_pool;
+    PriceLevelPool list_level_pool;
+    OrderBookUpdateBuffer list_buffer;
+    auto list_book = std::make_unique<TreasuryOrderBook>(list_order_pool, list_level_pool, list_buffer);
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<> op_dist(0, 3);
+    std::uniform_int_distribution<> tick_dist(-300, 300);
+    std::vector<uint64_t> active;
+    uint64_t next_id = 1;
+
+    for (int i = 0; i < 5000; ++i) {
+        int op = op_dist(gen);
+        if (op <= 1 || active.empty()) {
+            // Occasionally jump far away to force re-centring
+            double base = (i % 997 == 0) ? 150.0 : 100.0;
+            OrderSide side = (gen() & 1) ? OrderSide::BID : OrderSide::ASK;
+            auto order = create_test_order(next_id, side, base + tick_dist(gen) / 64.0, 100000);
+            bool a = order_book_->add_order(order);
+            bool b = list_book->add_order(order);
+            ASSERT_EQ(a, b);
+            if (a) active.push_back(next_id);
+            ++next_id;
+        } else if (op == 2) {
+            size_t idx = gen() % active.size();
+            ASSERT_EQ(order_book_->cancel_order(active[idx]), list_book->cancel_order(active[idx]));
+            active.erase(active.begin() + idx);
+        } else {
+            auto price = Price32nd::from_decimal(100.0 + tick_dist(gen) / 64.0);
+            OrderSide side = (gen() & 1) ? OrderSide::BID : OrderSide::ASK;
+            (void)order_book_->process_trade(price, 50000, side);
+            (void)list_book->process_trade(price, 50000, side);
+        }
+
+        if (i % 250 == 0) {
+            for (OrderSide side : {OrderSide::BID, OrderSide::ASK}) {
+                auto ladder_depth = order_book_->get_market_depth(side, 1000);
+                auto list_depth = list_book->get_market_depth(side, 1000);
+                ASSERT_EQ(ladder_depth.size(), list_depth.size());
+                for (size_t j = 0; j < ladder_depth.size(); ++j) {
+                    EXPECT_DOUBLE_EQ(ladder_depth[j].price.to_decimal(), list_depth[j].price.to_decimal());
+                    EXPECT_EQ(ladder_depth[j].quantity, list_depth[j].quantity);
+                }
+            }
+        }
+    }
+
+    list_book->reset();
+}
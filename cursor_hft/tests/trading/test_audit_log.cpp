@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "hft/trading/audit_log.hpp"
+#include "hft/trading/book_manager.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+
+using namespace hft::trading;
+using namespace hft::market_data;
+
+/**
+ * @brief Test fixture for AuditLog
+ *
+ * Each test logs to its own segment files under /tmp and removes them.
+ */
+class AuditLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        base_path_ = "/tmp/hft_audit_test_" + std::to_string(::getpid()) + "_" +
+                     ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        log_ = std::make_unique<AuditLog>();
+    }
+
+    void TearDown() override {
+        log_.reset();
+        for (uint32_t i = 0; ::unlink(detail::audit_segment_path(base_path_, i).c_str()) == 0; ++i) {
+        }
+    }
+
+    static AuditRecord make_record(uint64_t order_id) {
+        AuditRecord record;
+        record.order_id = order_id;
+        record.timestamp_ns = 1000 + order_id;
+        record.reason = AuditReason::FILL_PROCESSED;
+        return record;
+    }
+
+    std::vector<AuditRecord> read_back() {
+        AuditLogReader reader;
+        EXPECT_TRUE(reader.open(base_path_));
+        return reader.records();
+    }
+
+    std::string base_path_;
+    std::unique_ptr<AuditLog> log_;
+};
+
+TEST_F(AuditLogTest, RecordsRoundTripAcrossSegments) {
+    ASSERT_TRUE(log_->open(base_path_, 256));  // Two blocks per segment
+    const int producer = log_->register_producer();
+    ASSERT_EQ(producer, 0);
+
+    for (uint64_t i = 1; i <= 600; ++i) {
+        ASSERT_TRUE(log_->record(producer, make_record(i)));
+    }
+    ASSERT_TRUE(log_->close());
+    EXPECT_EQ(log_->stats().records_logged, 600u);
+    EXPECT_EQ(log_->stats().segments_closed, 3u);
+
+    AuditLogReader reader;
+    ASSERT_TRUE(reader.open(base_path_));
+    EXPECT_EQ(reader.segment_count(), 3u);
+    const auto& records = reader.records();
+    ASSERT_EQ(records.size(), 600u);
+    for (size_t i = 0; i < records.size(); ++i) {
+        ASSERT_EQ(records[i].sequence, i + 1);
+        ASSERT_EQ(records[i].order_id, i + 1);
+        EXPECT_EQ(records[i].reason, AuditReason::FILL_PROCESSED);
+    }
+}
+
+TEST_F(AuditLogTest, PartialBlockIsRewrittenInPlace) {
+    ASSERT_TRUE(log_->open(base_path_));
+    const int producer = log_->register_producer();
+
+    for (uint64_t i = 1; i <= 10; ++i) ASSERT_TRUE(log_->record(producer, make_record(i)));
+    ASSERT_TRUE(log_->flush());
+    for (uint64_t i = 11; i <= 20; ++i) ASSERT_TRUE(log_->record(producer, make_record(i)));
+    ASSERT_TRUE(log_->flush());
+
+    // Both flushes are durable already, and share one data block
+    struct stat st{};
+    ASSERT_EQ(::stat(detail::audit_segment_path(base_path_, 0).c_str(), &st), 0);
+    EXPECT_EQ(static_cast<size_t>(st.st_size), 2 * AUDIT_BLOCK_SIZE);
+    EXPECT_EQ(read_back().size(), 20u);
+
+    ASSERT_TRUE(log_->close());
+    const auto records = read_back();
+    ASSERT_EQ(records.size(), 20u);
+    EXPECT_EQ(records.back().sequence, 20u);
+}
+
+TEST_F(AuditLogTest, FullRingDropsInsteadOfBlocking) {
+    ASSERT_TRUE(log_->open(base_path_));
+    const int producer = log_->register_producer();
+
+    uint64_t accepted = 0;
+    for (uint64_t i = 1; i <= AuditLog::RING_SIZE + 16; ++i) {
+        accepted += log_->record(producer, make_record(i)) ? 1 : 0;
+    }
+    EXPECT_LT(accepted, AuditLog::RING_SIZE + 16);
+    EXPECT_EQ(log_->stats().records_dropped, AuditLog::RING_SIZE + 16 - accepted);
+
+    ASSERT_TRUE(log_->close());
+    EXPECT_EQ(read_back().size(), accepted);
+}
+
+TEST_F(AuditLogTest, WriterThreadDrainsConcurrentProducers) {
+    constexpr uint64_t PER_PRODUCER = 5000;
+    ASSERT_TRUE(log_->open(base_path_, 4096));
+    ASSERT_TRUE(log_->start_writer(100000));
+
+    std::vector<std::thread> producers;
+    for (uint64_t p = 0; p < 2; ++p) {
+        producers.emplace_back([this, p] {
+            const int producer = log_->register_producer();
+            ASSERT_GE(producer, 0);
+            for (uint64_t i = 0; i < PER_PRODUCER; ++i) {
+                while (!log_->record(producer, make_record((p << 32) | i))) std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& thread : producers) thread.join();
+    ASSERT_TRUE(log_->close());
+    EXPECT_FALSE(log_->writer_running());
+
+    // Each producer's events stay in order within the log-wide sequence
+    const auto records = read_back();
+    ASSERT_EQ(records.size(), 2 * PER_PRODUCER);
+    std::array<uint64_t, 2> next{};
+    for (size_t i = 0; i < records.size(); ++i) {
+        ASSERT_EQ(records[i].sequence, i + 1);
+        const uint64_t p = records[i].order_id >> 32;
+        ASSERT_LT(p, 2u);
+        ASSERT_EQ(records[i].order_id & 0xFFFFFFFF, next[p]++);
+    }
+}
+
+TEST_F(AuditLogTest, ReopenContinuesExistingLog) {
+    ASSERT_TRUE(log_->open(base_path_, 128));
+    int producer = log_->register_producer();
+    for (uint64_t i = 1; i <= 200; ++i) {
+        ASSERT_TRUE(log_->record(producer, make_record(i)));
+    }
+    ASSERT_TRUE(log_->close());
+
+    // A restart on the same path appends new segments and carries on the sequence
+    log_ = std::make_unique<AuditLog>();
+    ASSERT_TRUE(log_->open(base_path_, 128));
+    producer = log_->register_producer();
+    for (uint64_t i = 201; i <= 250; ++i) {
+        ASSERT_TRUE(log_->record(producer, make_record(i)));
+    }
+    ASSERT_TRUE(log_->close());
+
+    AuditLogReader reader;
+    ASSERT_TRUE(reader.open(base_path_));
+    EXPECT_EQ(reader.segment_count(), 3u);
+    const auto& records = reader.records();
+    ASSERT_EQ(records.size(), 250u);
+    for (size_t i = 0; i < records.size(); ++i) {
+        ASSERT_EQ(records[i].sequence, i + 1);
+        ASSERT_EQ(records[i].order_id, i + 1);
+    }
+}
+
+TEST_F(AuditLogTest, SwitchingLogsReleasesProducerRing) {
+    auto books = std::make_unique<BookManager>();
+    auto orders = std::make_unique<OrderLifecycleManager>(books->order_pool(), books->level_pool(), books->update_buffer());
+    ASSERT_TRUE(log_->open(base_path_));
+
+    // Re-setting the same log keeps its ring; detaching gives it back
+    for (size_t i = 0; i < AuditLog::MAX_PRODUCERS * 2; ++i) {
+        ASSERT_TRUE(orders->set_audit_log(log_.get()));
+        ASSERT_TRUE(orders->set_audit_log(nullptr));
+    }
+    std::vector<int> producers;
+    for (size_t i = 0; i < AuditLog::MAX_PRODUCERS; ++i) {
+        producers.push_back(log_->register_producer());
+        EXPECT_GE(producers.back(), 0);
+    }
+    EXPECT_EQ(log_->register_producer(), -1);
+}
+
+TEST_F(AuditLogTest, OrderLifecycleManagerAuditsToLog) {
+    auto books = std::make_unique<BookManager>();
+    auto orders = std::make_unique<OrderLifecycleManager>(books->order_pool(), books->level_pool(), books->update_buffer());
+    ASSERT_TRUE(log_->open(base_path_));
+    ASSERT_TRUE(orders->set_audit_log(log_.get()));
+
+    const uint64_t order_id = orders->create_order(TreasuryType::Note_10Y, OrderSide::BID, OrderType::LIMIT,
+                                                   Price32nd::from_decimal(99.5), 1000000, OrderLifecycleManager::TimeInForce::DAY,
+                                                   0, OrderLifecycleManager::VenueType::ECN);
+    ASSERT_NE(order_id, 0u);
+    ASSERT_TRUE(orders->cancel_order(order_id));
+    ASSERT_TRUE(log_->close());
+
+    using State = OrderLifecycleManager::OrderState;
+    const auto records = read_back();
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(records[0].reason, AuditReason::ORDER_CREATED);
+    EXPECT_EQ(records[1].reason, AuditReason::VALIDATION_COMPLETE);
+    EXPECT_EQ(records[2].reason, AuditReason::CANCEL_REQUESTED);
+    EXPECT_EQ(records[2].old_state, static_cast<uint8_t>(State::VALIDATED));
+    EXPECT_EQ(records[2].new_state, static_cast<uint8_t>(State::PENDING_CANCEL));
+    for (const auto& record : records) {
+        EXPECT_EQ(record.order_id, order_id);
+        EXPECT_EQ(record.venue, static_cast<uint8_t>(OrderLifecycleManager::VenueType::ECN));
+    }
+}
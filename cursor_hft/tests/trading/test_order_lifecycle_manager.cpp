@@ -191,6 +191,49 @@ TEST_F(OrderLifecycleManagerTest, FillProcessing) {
     EXPECT_EQ(order->leaves_quantity, 0);
 }
 
+// Test venue session reports: send, ack, reject, cancel confirm/refuse
+TEST_F(OrderLifecycleManagerTest, VenueReports) {
+    using State = OrderLifecycleManager::OrderState;
+    auto create = [&] {
+        return order_manager_->create_order(TreasuryType::Note_10Y, OrderSide::BID, OrderType::LIMIT,
+                                            Price32nd::from_decimal(102.5), 5000000);
+    };
+    const auto acked = create();
+    const auto rejected = create();
+    ASSERT_GT(acked, 0);
+    ASSERT_GT(rejected, 0);
+
+    EXPECT_TRUE(order_manager_->mark_sent(acked));
+    EXPECT_EQ(order_manager_->get_order(acked)->state, State::PENDING_NEW);
+    EXPECT_FALSE(order_manager_->mark_sent(acked));  // Already sent
+    EXPECT_TRUE(order_manager_->process_ack(acked));
+    EXPECT_EQ(order_manager_->get_order(acked)->state, State::ACKNOWLEDGED);
+
+    EXPECT_TRUE(order_manager_->mark_sent(rejected));
+    EXPECT_TRUE(order_manager_->process_reject(rejected));
+    EXPECT_EQ(order_manager_->get_order_status(rejected)->state, State::REJECTED);
+    EXPECT_EQ(order_manager_->get_order_status(rejected)->leaves_quantity, 0u);
+    EXPECT_FALSE(order_manager_->process_ack(rejected));
+    EXPECT_FALSE(order_manager_->process_reject(rejected));
+    EXPECT_EQ(order_manager_->get_metrics().orders_rejected.load(), 1u);
+
+    // A refused cancel puts the order back to work, a confirmed one ends it
+    EXPECT_FALSE(order_manager_->process_cancel_reject(acked));
+    ASSERT_TRUE(order_manager_->cancel_order(acked));
+    EXPECT_TRUE(order_manager_->process_cancel_reject(acked));
+    EXPECT_EQ(order_manager_->get_order(acked)->state, State::ACKNOWLEDGED);
+    ASSERT_TRUE(order_manager_->cancel_order(acked));
+    EXPECT_TRUE(order_manager_->process_ack(acked));  // Late ack leaves the cancel pending
+    EXPECT_EQ(order_manager_->get_order(acked)->state, State::PENDING_CANCEL);
+    EXPECT_TRUE(order_manager_->process_cancel_ack(acked));
+    EXPECT_EQ(order_manager_->get_order(acked)->state, State::CANCELLED);
+    EXPECT_EQ(order_manager_->get_order(acked)->leaves_quantity, 0u);
+    EXPECT_FALSE(order_manager_->process_cancel_ack(acked));
+    EXPECT_EQ(order_manager_->get_metrics().orders_cancelled.load(), 1u);
+    EXPECT_TRUE(order_manager_->retire_order(acked));
+    EXPECT_FALSE(order_manager_->process_ack(acked));  // Stale ID
+}
+
 // Test venue routing
 TEST_F(OrderLifecycleManagerTest, VenueRouting) {
     const auto order_id = order_manager_->create_order(
@@ -211,6 +254,38 @@ TEST_F(OrderLifecycleManagerTest, VenueRouting) {
     EXPECT_EQ(order->target_venue, venue);
 }
 
+// Test strategy x venue rate limiting before submit
+TEST_F(OrderLifecycleManagerTest, RateLimitedSubmits) {
+    auto limiters = std::make_unique<OrderRateLimiters>();
+    RateLimiter::Config config;
+    config.interval_ns = 1000000000;
+    config.max_messages = 2;
+    limiters->configure_venue(static_cast<size_t>(OrderLifecycleManager::VenueType::PRIMARY_DEALER), config);
+    order_manager_->set_rate_limiters(limiters.get());
+    
+    const auto price = Price32nd::from_decimal(102.5);
+    const auto first = order_manager_->create_order(TreasuryType::Note_10Y, OrderSide::BID, OrderType::LIMIT, price, 5000000);
+    const auto second = order_manager_->create_order(TreasuryType::Note_10Y, OrderSide::ASK, OrderType::LIMIT, price, 5000000);
+    ASSERT_GT(first, 0);
+    ASSERT_GT(second, 0);
+    
+    // Third message this second is refused and says when it would pass
+    const auto before = hft::HFTTimer::get_timestamp_ns();
+    EXPECT_EQ(order_manager_->create_order(TreasuryType::Note_10Y, OrderSide::BID, OrderType::LIMIT, price, 5000000), 0);
+    EXPECT_EQ(order_manager_->get_metrics().orders_throttled.load(), 1);
+    EXPECT_GT(order_manager_->throttled_retry_at_ns(), before);
+    EXPECT_FALSE(order_manager_->modify_order(first, Price32nd::from_decimal(102.53125), 5000000));
+    
+    // Other strategies and venues have their own budgets; cancels always go
+    const auto other = order_manager_->create_order(TreasuryType::Note_10Y, OrderSide::BID, OrderType::LIMIT, price,
+                                                    5000000, OrderLifecycleManager::TimeInForce::DAY, 1);
+    EXPECT_GT(other, 0);
+    EXPECT_EQ(order_manager_->get_order(other)->strategy_id, 1);
+    EXPECT_GT(order_manager_->create_order(TreasuryType::Note_10Y, OrderSide::BID, OrderType::LIMIT, price, 5000000,
+                                           OrderLifecycleManager::TimeInForce::DAY, 0, OrderLifecycleManager::VenueType::ECN), 0);
+    EXPECT_TRUE(order_manager_->cancel_order(second));
+}
+
 // Test venue configuration
 TEST_F(OrderLifecycleManagerTest, VenueConfiguration) {
     OrderLifecycleManager::VenueConfig config;
@@ -281,6 +356,70 @@ TEST_F(OrderLifecycleManagerTest, EmergencyStop) {
     EXPECT_EQ(new_order_id, 0);
 }
 
+// Test generational order IDs across slot reuse
+TEST_F(OrderLifecycleManagerTest, RetiredSlotReuseRejectsStaleIds) {
+    const auto price = Price32nd::from_decimal(102.5);
+    const auto first = order_manager_->create_order(TreasuryType::Note_10Y, OrderSide::BID, OrderType::LIMIT, price, 5000000);
+    ASSERT_GT(first, 0);
+    
+    // Working orders cannot be retired
+    EXPECT_FALSE(order_manager_->retire_order(first));
+    
+    OrderLifecycleManager::OrderExecution execution;
+    execution.order_id = first;
+    execution.executed_quantity = 5000000;
+    ASSERT_TRUE(order_manager_->process_fill(execution));
+    ASSERT_TRUE(order_manager_->retire_order(first));
+    EXPECT_FALSE(order_manager_->retire_order(first));
+    
+    // The freed slot comes straight back under a new generation
+    const auto second = order_manager_->create_order(TreasuryType::Note_10Y, OrderSide::ASK, OrderType::LIMIT, price, 3000000);
+    ASSERT_GT(second, 0);
+    EXPECT_NE(second, first);
+    EXPECT_EQ(OrderLifecycleManager::slot_of(second), OrderLifecycleManager::slot_of(first));
+    EXPECT_NE(OrderLifecycleManager::generation_of(second), OrderLifecycleManager::generation_of(first));
+    
+    // Every path rejects the stale ID rather than touching the new order
+    EXPECT_EQ(order_manager_->get_order(first), nullptr);
+    EXPECT_EQ(order_manager_->get_order_status(first), nullptr);
+    EXPECT_FALSE(order_manager_->cancel_order(first));
+    EXPECT_FALSE(order_manager_->modify_order(first, price, 1000000));
+    EXPECT_FALSE(order_manager_->process_fill(execution));
+    EXPECT_EQ(order_manager_->get_order(second)->leaves_quantity, 3000000);
+    EXPECT_EQ(order_manager_->get_order(second)->state, OrderLifecycleManager::OrderState::VALIDATED);
+    
+    // IDs that were never issued miss too
+    EXPECT_EQ(order_manager_->get_order(0), nullptr);
+    EXPECT_EQ(order_manager_->get_order(OrderLifecycleManager::slot_of(second)), nullptr);
+    EXPECT_EQ(order_manager_->get_order((1ULL << 32) | OrderLifecycleManager::MAX_ORDERS), nullptr);
+}
+
+// Test the hot status entry tracks the record
+TEST_F(OrderLifecycleManagerTest, OrderStatusMirrorsHotFields) {
+    const auto order_id = order_manager_->create_order(
+        TreasuryType::Note_10Y, OrderSide::BID, OrderType::LIMIT,
+        Price32nd::from_decimal(102.5), 5000000
+    );
+    ASSERT_GT(order_id, 0);
+    
+    const auto* status = order_manager_->get_order_status(order_id);
+    ASSERT_NE(status, nullptr);
+    EXPECT_EQ(status->state, OrderLifecycleManager::OrderState::VALIDATED);
+    EXPECT_EQ(status->leaves_quantity, 5000000);
+    
+    OrderLifecycleManager::OrderExecution execution;
+    execution.order_id = order_id;
+    execution.executed_quantity = 2000000;
+    ASSERT_TRUE(order_manager_->process_fill(execution));
+    EXPECT_EQ(status->state, OrderLifecycleManager::OrderState::PARTIALLY_FILLED);
+    EXPECT_EQ(status->leaves_quantity, 3000000);
+    
+    ASSERT_TRUE(order_manager_->modify_order(order_id, Price32nd::from_decimal(102.53125), 6000000));
+    EXPECT_EQ(status->leaves_quantity, 4000000);
+    EXPECT_DOUBLE_EQ(status->order_price.to_decimal(), 102.53125);
+    EXPECT_EQ(status->state, order_manager_->get_order(order_id)->state);
+}
+
 // Test performance metrics
 TEST_F(OrderLifecycleManagerTest, PerformanceMetrics) {
     const auto& initial_metrics = order_manager_->get_metrics();
@@ -392,6 +531,7 @@ TEST_F(OrderLifecycleManagerTest, DataStructureValidation) {
     
     // Verify structure sizes (must be cache-line aligned for performance)
     EXPECT_EQ(sizeof(OrderLifecycleManager::OrderRecord), 128);
+    EXPECT_EQ(sizeof(OrderLifecycleManager::OrderStatus), 32);
     EXPECT_EQ(sizeof(OrderLifecycleManager::OrderExecution), 64);
     EXPECT_EQ(sizeof(OrderLifecycleManager::VenueConfig), 64);
     EXPECT_EQ(sizeof(OrderLifecycleManager::AuditEntry), 64);
@@ -219,6 +219,82 @@ TEST_F(PositionReconciliationManagerTest, BreakResolution) {
     EXPECT_EQ(updated_breaks.size(), 0);
 }
 
+// Test that breaks open and clear as the venue/internal delta moves
+TEST_F(PositionReconciliationManagerTest, IncrementalBreakLifecycle) {
+    const auto instrument = TreasuryType::Note_10Y;
+    const auto venue = OrderLifecycleManager::VenueType::PRIMARY_DEALER;
+    const auto price = Price32nd::from_decimal(102.5);
+    
+    // Not reconciled until the venue has reported
+    EXPECT_TRUE(position_manager_->update_position(instrument, venue, OrderSide::BID, 5000000, price, 1));
+    EXPECT_EQ(position_manager_->unresolved_break_count(), 0);
+    EXPECT_EQ(position_manager_->get_position_delta(instrument, venue), 0);
+    
+    // Repeated mismatching reports update one break in place
+    EXPECT_FALSE(position_manager_->reconcile_venue_position(instrument, venue, 4000000));
+    EXPECT_FALSE(position_manager_->reconcile_venue_position(instrument, venue, 3000000));
+    ASSERT_EQ(position_manager_->unresolved_break_count(), 1);
+    auto breaks = position_manager_->get_unresolved_breaks();
+    ASSERT_EQ(breaks.size(), 1);
+    EXPECT_EQ(breaks[0].actual_position, 3000000);
+    EXPECT_EQ(breaks[0].variance, -2000000);
+    EXPECT_EQ(position_manager_->get_metrics().breaks_detected.load(), 1);
+    
+    // The venue's drop copies catch up: the break resolves itself
+    EXPECT_FALSE(position_manager_->apply_venue_fill(instrument, venue, OrderSide::BID, 1000000));
+    EXPECT_TRUE(position_manager_->apply_venue_fill(instrument, venue, OrderSide::BID, 1000000));
+    EXPECT_EQ(position_manager_->unresolved_break_count(), 0);
+    EXPECT_TRUE(position_manager_->get_unresolved_breaks().empty());
+    EXPECT_EQ(position_manager_->get_metrics().breaks_resolved.load(), 1);
+    
+    // Our fill ahead of the venue's copy opens a break until the copy arrives
+    EXPECT_TRUE(position_manager_->update_position(instrument, venue, OrderSide::ASK, 2000000, price, 2));
+    EXPECT_EQ(position_manager_->get_position_delta(instrument, venue), 2000000);
+    EXPECT_EQ(position_manager_->unresolved_break_count(), 1);
+    EXPECT_TRUE(position_manager_->apply_venue_fill(instrument, venue, OrderSide::ASK, 2000000));
+    EXPECT_EQ(position_manager_->unresolved_break_count(), 0);
+    EXPECT_EQ(position_manager_->get_position_delta(instrument, venue), 0);
+}
+
+// Test the unresolved list across instruments, manual resolution and ring wrap
+TEST_F(PositionReconciliationManagerTest, UnresolvedBreakList) {
+    const auto venue = OrderLifecycleManager::VenueType::PRIMARY_DEALER;
+    const auto price = Price32nd::from_decimal(102.5);
+    
+    for (int inst = 0; inst < 6; ++inst) {
+        const auto instrument = static_cast<TreasuryType>(inst);
+        position_manager_->update_position(instrument, venue, OrderSide::BID, 1000000, price, inst + 1);
+        EXPECT_FALSE(position_manager_->reconcile_venue_position(instrument, venue, 0));
+    }
+    auto breaks = position_manager_->get_unresolved_breaks();
+    ASSERT_EQ(breaks.size(), 6);
+    for (int inst = 0; inst < 6; ++inst) {
+        EXPECT_EQ(breaks[inst].instrument, static_cast<TreasuryType>(inst));  // Oldest first
+    }
+    
+    // Resolve one from the middle; a further mismatch on it opens a new break
+    EXPECT_TRUE(position_manager_->resolve_position_break(breaks[2].break_id, "Booked"));
+    EXPECT_FALSE(position_manager_->resolve_position_break(breaks[2].break_id, "Booked"));
+    EXPECT_EQ(position_manager_->unresolved_break_count(), 5);
+    EXPECT_FALSE(position_manager_->reconcile_venue_position(TreasuryType::Note_2Y, venue, 1));
+    breaks = position_manager_->get_unresolved_breaks();
+    ASSERT_EQ(breaks.size(), 6);
+    EXPECT_EQ(breaks.back().instrument, TreasuryType::Note_2Y);
+    
+    // Opening and clearing far more breaks than the ring holds keeps the open ones
+    const auto instrument = TreasuryType::Bond_30Y;
+    for (size_t i = 0; i < PositionReconciliationManager::MAX_BREAKS * 2; ++i) {
+        EXPECT_FALSE(position_manager_->reconcile_venue_position(instrument, venue, 2000000));
+        EXPECT_TRUE(position_manager_->reconcile_venue_position(instrument, venue, 1000000));
+    }
+    EXPECT_EQ(position_manager_->unresolved_break_count(), 5);
+    EXPECT_EQ(position_manager_->get_unresolved_breaks().size(), 5);
+    
+    position_manager_->reset_daily_positions();
+    EXPECT_EQ(position_manager_->unresolved_break_count(), 0);
+    EXPECT_TRUE(position_manager_->get_unresolved_breaks().empty());
+}
+
 // Test settlement instruction generation
 TEST_F(PositionReconciliationManagerTest, SettlementInstructionGeneration) {
     const auto instrument1 = TreasuryType::Note_10Y;
@@ -245,6 +321,87 @@ TEST_F(PositionReconciliationManagerTest, SettlementInstructionGeneration) {
     EXPECT_GE(report.pending_settlements, 2);
 }
 
+// Test netting the day's fills into pooled instructions and a caller-owned report
+TEST_F(PositionReconciliationManagerTest, SettlementNetsFillsAtTradedPrices) {
+    const auto instrument = TreasuryType::Note_10Y;
+    const auto dealer = OrderLifecycleManager::VenueType::PRIMARY_DEALER;
+    const auto other = static_cast<OrderLifecycleManager::VenueType>(1);
+    
+    // Dealer: buy 5 @ 100, sell 2 @ 101 -> net +3, cash 500 - 202
+    position_manager_->update_position(instrument, dealer, OrderSide::BID, 5, Price32nd::from_decimal(100.0), 1);
+    position_manager_->update_position(instrument, dealer, OrderSide::ASK, 2, Price32nd::from_decimal(101.0), 2);
+    // Other venue: round trip, flat but with cash to settle
+    position_manager_->update_position(instrument, other, OrderSide::BID, 4, Price32nd::from_decimal(100.0), 3);
+    position_manager_->update_position(instrument, other, OrderSide::ASK, 4, Price32nd::from_decimal(100.5), 4);
+    
+    const uint64_t settlement_date = hft::HFTTimer::get_timestamp_ns() + 86400000000000ULL;
+    ASSERT_EQ(position_manager_->generate_settlement_instructions(settlement_date), 2);
+    EXPECT_EQ(settlement_pool_->size(), 2);
+    
+    // Regenerating replaces the earlier instructions
+    ASSERT_EQ(position_manager_->generate_settlement_instructions(settlement_date), 2);
+    EXPECT_EQ(settlement_pool_->size(), 2);
+    
+    std::array<PositionReconciliationManager::SettlementInstruction, 4> out{};
+    const auto report = position_manager_->generate_settlement_report(settlement_date, out);
+    ASSERT_EQ(report.settlement_count, 2);
+    ASSERT_EQ(report.settlements_written, 2);
+    EXPECT_EQ(out[0].venue, dealer);
+    EXPECT_EQ(out[0].net_quantity, 3);
+    EXPECT_DOUBLE_EQ(out[0].settlement_value, 298.0);
+    EXPECT_EQ(out[1].venue, other);
+    EXPECT_EQ(out[1].net_quantity, 0);
+    EXPECT_DOUBLE_EQ(out[1].settlement_value, -2.0);
+    EXPECT_DOUBLE_EQ(report.total_settlement_value, 296.0);
+    
+    // A short buffer gets a prefix; the summary still covers everything
+    std::array<PositionReconciliationManager::SettlementInstruction, 1> short_out{};
+    const auto partial = position_manager_->generate_settlement_report(settlement_date, short_out);
+    EXPECT_EQ(partial.settlement_count, 2);
+    EXPECT_EQ(partial.settlements_written, 1);
+    EXPECT_DOUBLE_EQ(partial.total_settlement_value, 296.0);
+    
+    position_manager_->reset_daily_positions();
+    EXPECT_EQ(settlement_pool_->size(), 0);
+    EXPECT_EQ(position_manager_->generate_settlement_instructions(settlement_date), 0);
+}
+
+// Test that netting on a pool matches netting on the calling thread
+TEST_F(PositionReconciliationManagerTest, ParallelSettlementNetting) {
+    // Several netting chunks across every instrument and a few venues
+    const size_t fills = PositionReconciliationManager::SETTLEMENT_NETTING_CHUNK * 5 + 123;
+    for (size_t i = 0; i < fills; ++i) {
+        position_manager_->update_position(
+            static_cast<TreasuryType>(i % 6),
+            static_cast<OrderLifecycleManager::VenueType>(i % 4),
+            (i % 3 == 0) ? OrderSide::ASK : OrderSide::BID,
+            1000 + i % 17,
+            Price32nd::from_decimal(99.0 + static_cast<double>(i % 64) / 32.0),
+            i + 1);
+    }
+    
+    const uint64_t settlement_date = hft::HFTTimer::get_timestamp_ns();
+    std::array<PositionReconciliationManager::SettlementInstruction, 48> serial{};
+    std::array<PositionReconciliationManager::SettlementInstruction, 48> parallel{};
+    const size_t count = position_manager_->generate_settlement_instructions(settlement_date);
+    const auto serial_report = position_manager_->generate_settlement_report(settlement_date, serial);
+    
+    hft::WorkStealingPool pool(3);
+    EXPECT_EQ(position_manager_->generate_settlement_instructions(settlement_date, &pool), count);
+    const auto parallel_report = position_manager_->generate_settlement_report(settlement_date, parallel);
+    
+    ASSERT_EQ(serial_report.settlement_count, parallel_report.settlement_count);
+    EXPECT_DOUBLE_EQ(serial_report.total_settlement_value, parallel_report.total_settlement_value);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(serial[i].instrument, parallel[i].instrument);
+        EXPECT_EQ(serial[i].venue, parallel[i].venue);
+        EXPECT_EQ(serial[i].net_quantity, parallel[i].net_quantity);
+        EXPECT_EQ(serial[i].settlement_value, parallel[i].settlement_value);  // Same summation order
+        EXPECT_EQ(serial[i].net_quantity,
+                  position_manager_->get_venue_position(serial[i].instrument, serial[i].venue).net_position);
+    }
+}
+
 // Test daily position reset
 TEST_F(PositionReconciliationManagerTest, DailyPositionReset) {
     const auto instrument = TreasuryType::Note_10Y;
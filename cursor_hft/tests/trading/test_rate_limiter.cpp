@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "hft/trading/rate_limiter.hpp"
+#include "hft/trading/venue_router.hpp"
+
+using namespace hft::trading;
+using namespace hft::market_data;
+
+namespace {
+
+constexpr uint64_t MS = 1000000;
+constexpr uint64_t T0 = 1000000000000ULL;
+
+RateLimiter::Config per_100ms(uint32_t messages, uint32_t burst = 0) {
+    RateLimiter::Config config;
+    config.interval_ns = 100 * MS;
+    config.max_messages = messages;
+    config.burst = burst;
+    return config;
+}
+
+} // namespace
+
+TEST(RateLimiterTest, BurstThenSteadyRate) {
+    RateLimiter limiter(per_100ms(10));
+    EXPECT_EQ(limiter.emission_interval_ns(), 10 * MS);
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(limiter.try_acquire(T0).admitted) << i;
+    }
+    const auto rejected = limiter.try_acquire(T0);
+    EXPECT_FALSE(rejected.admitted);
+    EXPECT_EQ(rejected.retry_at_ns, T0 + 10 * MS);
+    EXPECT_EQ(limiter.next_admit_ns(T0), T0 + 10 * MS);
+    EXPECT_EQ(limiter.rejected(), 1u);
+
+    // Exactly at the retry time one more goes, then the rate holds
+    EXPECT_FALSE(limiter.try_acquire(T0 + 10 * MS - 1).admitted);
+    EXPECT_TRUE(limiter.try_acquire(T0 + 10 * MS).admitted);
+    EXPECT_FALSE(limiter.try_acquire(T0 + 10 * MS).admitted);
+    EXPECT_TRUE(limiter.try_acquire(T0 + 20 * MS).admitted);
+}
+
+TEST(RateLimiterTest, BurstAllowanceAndIdleRefill) {
+    RateLimiter limiter(per_100ms(10, 3));
+    EXPECT_TRUE(limiter.try_acquire(T0, 3).admitted);
+    EXPECT_FALSE(limiter.try_acquire(T0).admitted);
+
+    // A long idle period refills to the burst, not beyond
+    const uint64_t later = T0 + 10000 * MS;
+    EXPECT_EQ(limiter.next_admit_ns(later), later);
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(limiter.try_acquire(later).admitted) << i;
+    }
+    EXPECT_FALSE(limiter.try_acquire(later).admitted);
+}
+
+TEST(RateLimiterTest, UnconfiguredAdmitsEverything) {
+    RateLimiter limiter;
+    EXPECT_FALSE(limiter.enabled());
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(limiter.try_acquire(T0).admitted);
+    }
+    limiter.configure(per_100ms(1));
+    EXPECT_TRUE(limiter.try_acquire(T0).admitted);
+    EXPECT_FALSE(limiter.try_acquire(T0).admitted);
+}
+
+TEST(RateLimiterTest, ConcurrentCallersShareOneBudget) {
+    constexpr uint32_t BURST = 500;
+    constexpr size_t THREADS = 4;
+    constexpr int ATTEMPTS = 2000;
+    auto limiter = std::make_unique<RateLimiter>(per_100ms(BURST));
+    std::atomic<uint64_t> admitted{0};
+    std::atomic<bool> go{false};
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) {}
+            uint64_t mine = 0;
+            for (int i = 0; i < ATTEMPTS; ++i) {
+                mine += limiter->try_acquire(T0).admitted ? 1 : 0;
+            }
+            admitted.fetch_add(mine);
+        });
+    }
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) thread.join();
+
+    // One burst in total; racing the idle reset can add at most one per thread
+    EXPECT_GE(admitted.load(), BURST);
+    EXPECT_LE(admitted.load(), BURST + THREADS);
+    EXPECT_EQ(limiter->rejected(), THREADS * ATTEMPTS - admitted.load());
+}
+
+TEST(RateLimiterTest, TableKeepsStrategyVenueBudgetsApart) {
+    auto table = std::make_unique<OrderRateLimiters>();
+    table->configure_venue(1, per_100ms(1));
+
+    EXPECT_TRUE(table->try_acquire(0, 1, T0).admitted);
+    EXPECT_FALSE(table->try_acquire(0, 1, T0).admitted);
+    EXPECT_TRUE(table->try_acquire(3, 1, T0).admitted);
+    EXPECT_TRUE(table->try_acquire(0, 2, T0).admitted);  // Venue 2 unlimited
+}
+
+TEST(RateLimiterTest, VenueRouterFallsBackWhenThrottled) {
+    auto router = std::make_unique<VenueRouter>();
+    VenueRouter::OrderCharacteristics order{};
+    order.instrument = TreasuryType::Note_10Y;
+    order.side = OrderSide::BID;
+    order.quantity = 1000000;
+    order.price = Price32nd::from_decimal(99.5);
+    order.urgency_factor = 0.5;
+
+    const auto strategy = VenueRouter::SORStrategy::LATENCY_OPTIMIZED;
+    const auto unthrottled = router->route_order(order, strategy);
+    ASSERT_NE(unthrottled.primary_venue, unthrottled.backup_venue);
+    EXPECT_FALSE(unthrottled.throttled);
+
+    RateLimiter::Config one_per_second;
+    one_per_second.max_messages = 1;
+    router->configure_venue_throttle(unthrottled.primary_venue, one_per_second);
+    router->configure_venue_throttle(unthrottled.backup_venue, one_per_second);
+
+    EXPECT_EQ(router->route_order(order, strategy).primary_venue, unthrottled.primary_venue);
+    const auto fallback = router->route_order(order, strategy);
+    EXPECT_EQ(fallback.primary_venue, unthrottled.backup_venue);
+    EXPECT_FALSE(fallback.throttled);
+
+    const auto throttled = router->route_order(order, strategy);
+    EXPECT_TRUE(throttled.throttled);
+    EXPECT_GT(throttled.retry_at_ns, throttled.decision_time_ns);
+    EXPECT_EQ(router->get_venue_throttle(unthrottled.primary_venue).rejected(), 2u);
+}
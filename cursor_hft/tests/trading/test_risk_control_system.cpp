@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include "hft/trading/risk_control_system.hpp"
+
+using namespace hft::trading;
+using namespace hft::market_data;
+
+/**
+ * @brief Test fixture for RiskControlSystem
+ *
+ * Covers the batch pre-trade gate against the scalar per-order checks and
+ * the risk state word / breach monitor.
+ */
+class RiskControlSystemTest : public ::testing::Test {
+protected:
+    using Request = RiskControlSystem::RiskCheckRequest;
+    using BreakerType = RiskControlSystem::CircuitBreakerType;
+
+    void SetUp() override {
+        RiskControlSystem::RiskLimits limits;
+        limits.max_position_per_instrument = 20000000;
+        limits.max_total_position = 50000000;
+        limits.max_orders_per_second = 1000000;
+        limits.max_daily_loss = 1e12;
+        limits.max_concentration_ratio = 1.0;
+        risk_ = std::make_unique<RiskControlSystem>(limits);
+    }
+
+    static Request order(TreasuryType instrument, OrderSide side, uint64_t quantity) {
+        return Request(instrument, side, quantity, Price32nd::from_decimal(99.5));
+    }
+
+    uint64_t scalar_mask(const std::vector<Request>& orders) {
+        uint64_t mask = 0;
+        for (size_t i = 0; i < orders.size(); ++i) {
+            const auto& o = orders[i];
+            mask |= static_cast<uint64_t>(risk_->check_order_risk(o.instrument, o.side, o.quantity, o.price)) << i;
+        }
+        return mask;
+    }
+
+    std::unique_ptr<RiskControlSystem> risk_;
+};
+
+TEST_F(RiskControlSystemTest, BatchMatchesScalarChecks) {
+    risk_->update_position(TreasuryType::Note_10Y, 15000000, Price32nd::from_decimal(99.5));
+    risk_->update_position(TreasuryType::Bond_30Y, -12000000, Price32nd::from_decimal(99.5));
+    risk_->update_position(TreasuryType::Note_2Y, 18000000, Price32nd::from_decimal(99.5));
+
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<int> instrument(0, 5);
+    std::uniform_int_distribution<uint64_t> quantity(1, 12000000);
+    for (int round = 0; round < 50; ++round) {
+        std::vector<Request> orders;
+        const size_t count = 1 + round % RiskControlSystem::MAX_BATCH_ORDERS;
+        for (size_t i = 0; i < count; ++i) {
+            orders.push_back(order(static_cast<TreasuryType>(instrument(rng)),
+                                   (i & 1) ? OrderSide::ASK : OrderSide::BID, quantity(rng)));
+        }
+        const uint64_t batch = risk_->check_orders(orders);
+        ASSERT_EQ(batch, scalar_mask(orders)) << "round " << round;
+        ASSERT_NE(batch, 0u);
+    }
+}
+
+TEST_F(RiskControlSystemTest, BatchRejectsTripBreakers) {
+    risk_->update_position(TreasuryType::Note_5Y, 19000000, Price32nd::from_decimal(99.5));
+    const std::vector<Request> orders{
+        order(TreasuryType::Note_5Y, OrderSide::BID, 2000000),   // Over the instrument limit
+        order(TreasuryType::Note_5Y, OrderSide::ASK, 2000000),
+        order(TreasuryType::Note_10Y, OrderSide::BID, 5000000),
+        order(static_cast<TreasuryType>(9), OrderSide::BID, 1),  // Unknown instrument
+    };
+
+    EXPECT_EQ(risk_->check_orders(orders), 0b0110u);
+    EXPECT_TRUE(risk_->get_circuit_breaker(BreakerType::POSITION_LIMIT).active);
+    EXPECT_FALSE(risk_->get_circuit_breaker(BreakerType::ORDER_RATE_LIMIT).active);
+
+    // Nothing to check, or everything halted
+    EXPECT_EQ(risk_->check_orders({}), 0u);
+    risk_->trigger_emergency_stop("test");
+    EXPECT_EQ(risk_->check_orders(orders), 0u);
+}
+
+TEST_F(RiskControlSystemTest, BatchRespectsRemainingRateBudget) {
+    RiskControlSystem::RiskLimits limits = risk_->get_risk_limits();
+    limits.max_orders_per_second = 3;
+    risk_->update_risk_limits(limits);
+    risk_->record_order_activity();
+
+    std::vector<Request> orders;
+    for (size_t i = 0; i < 5; ++i) {
+        orders.push_back(order(TreasuryType::Note_10Y, OrderSide::BID, 1000000));
+    }
+
+    // Two orders left this second
+    EXPECT_EQ(risk_->check_orders(orders), 0b00011u);
+    EXPECT_TRUE(risk_->get_circuit_breaker(BreakerType::ORDER_RATE_LIMIT).active);
+}
+
+TEST_F(RiskControlSystemTest, OrderOverMaxSizeRejected) {
+    RiskControlSystem::RiskLimits limits = risk_->get_risk_limits();
+    limits.max_order_size = 5000000;
+    risk_->update_risk_limits(limits);
+
+    const std::vector<Request> orders{
+        order(TreasuryType::Note_10Y, OrderSide::BID, 5000000),
+        order(TreasuryType::Note_10Y, OrderSide::BID, 5000001),
+        order(TreasuryType::Note_2Y, OrderSide::ASK, 8000000),
+    };
+    EXPECT_EQ(risk_->check_orders(orders), 0b001u);
+    EXPECT_EQ(scalar_mask(orders), 0b001u);
+    // A fat-finger reject is not a market condition
+    EXPECT_FALSE(risk_->get_circuit_breaker(BreakerType::POSITION_LIMIT).active);
+    EXPECT_EQ(risk_->risk_state(), 0u);
+}
+
+TEST_F(RiskControlSystemTest, OrderOverMaxNotionalRejected) {
+    RiskControlSystem::RiskLimits limits = risk_->get_risk_limits();
+    limits.max_order_notional = 10000000.0;
+    risk_->update_risk_limits(limits);
+
+    // 10M face passes at par and below, not above
+    const std::vector<Request> orders{
+        Request(TreasuryType::Note_10Y, OrderSide::BID, 10000000, Price32nd::from_decimal(100.0)),
+        Request(TreasuryType::Note_10Y, OrderSide::BID, 10000000, Price32nd::from_decimal(100.03125)),
+        Request(TreasuryType::Note_5Y, OrderSide::ASK, 10000000, Price32nd::from_decimal(99.5)),
+    };
+    EXPECT_EQ(risk_->check_orders(orders), 0b101u);
+    EXPECT_EQ(scalar_mask(orders), 0b101u);
+    EXPECT_EQ(risk_->risk_state(), 0u);
+}
+
+TEST_F(RiskControlSystemTest, RiskLanesTrackInstrumentState) {
+    risk_->update_position(TreasuryType::Bill_6M, -3000000, Price32nd::from_decimal(100.0));
+    risk_->update_market_price(TreasuryType::Bill_6M, Price32nd::from_decimal(100.0));
+
+    const auto& lanes = risk_->risk_lanes();
+    const auto index = static_cast<size_t>(TreasuryType::Bill_6M);
+    EXPECT_EQ(lanes.net_position[index], -3000000);
+    EXPECT_DOUBLE_EQ(lanes.exposure[index], 300000000.0);
+    EXPECT_EQ(lanes.net_position[RiskControlSystem::RiskLanes::LANES - 1], 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(lanes.net_position.data()) % 64, 0u);
+}
+
+TEST_F(RiskControlSystemTest, RiskStateWordTracksBreakers) {
+    EXPECT_TRUE(risk_->trading_allowed());
+    EXPECT_EQ(risk_->risk_state(), 0u);
+
+    EXPECT_FALSE(risk_->check_order_risk(TreasuryType::Note_5Y, OrderSide::BID, 25000000, Price32nd::from_decimal(99.5)));
+    EXPECT_FALSE(risk_->trading_allowed());
+    EXPECT_EQ(risk_->risk_state(), 1u << static_cast<uint32_t>(BreakerType::POSITION_LIMIT));
+
+    EXPECT_TRUE(risk_->reset_circuit_breaker(BreakerType::POSITION_LIMIT));
+    EXPECT_TRUE(risk_->trading_allowed());
+    EXPECT_FALSE(risk_->get_circuit_breaker(BreakerType::POSITION_LIMIT).active);
+
+    risk_->trigger_emergency_stop("test");
+    EXPECT_TRUE(risk_->is_emergency_stop_active());
+    EXPECT_EQ(risk_->risk_state(), RiskControlSystem::EMERGENCY_STOP_BIT);
+}
+
+TEST_F(RiskControlSystemTest, BreachesLoggedOffHotPath) {
+    EXPECT_FALSE(risk_->check_order_risk(TreasuryType::Bond_30Y, OrderSide::ASK, 21000000, Price32nd::from_decimal(99.5)));
+    EXPECT_FALSE(risk_->check_order_risk(TreasuryType::Bond_30Y, OrderSide::ASK, 22000000, Price32nd::from_decimal(99.5)));
+
+    // Latched on the hot path, logged by the monitor
+    const auto& breaker = risk_->get_circuit_breaker(BreakerType::POSITION_LIMIT);
+    EXPECT_TRUE(breaker.active);
+    EXPECT_EQ(breaker.trigger_count, 0u);
+    EXPECT_EQ(risk_->breaches_logged(), 0u);
+
+    EXPECT_EQ(risk_->run_risk_monitor_once(), 1u);
+    EXPECT_EQ(breaker.trigger_count, 1u);
+    EXPECT_DOUBLE_EQ(breaker.current_value, 21000000.0);
+    ASSERT_EQ(risk_->breaches_logged(), 1u);
+
+    const auto& breach = risk_->get_risk_breach(0);
+    EXPECT_EQ(breach.breaker_type, BreakerType::POSITION_LIMIT);
+    EXPECT_EQ(breach.instrument, TreasuryType::Bond_30Y);
+    EXPECT_DOUBLE_EQ(breach.threshold_value, 20000000.0);
+    EXPECT_DOUBLE_EQ(breach.percentage_over, 5.0);
+    EXPECT_EQ(breach.timestamp_ns, breaker.trigger_time_ns);
+    EXPECT_STREQ(breach.action_taken, "Instrument posi");
+    EXPECT_EQ(risk_->breach_events_dropped(), 0u);
+}
+
+TEST_F(RiskControlSystemTest, MonitorThreadPublishesPortfolioBreach) {
+    RiskControlSystem::RiskLimits limits = risk_->get_risk_limits();
+    limits.max_daily_loss = 1000000.0;
+    limits.max_value_at_risk = 1e12;
+    risk_->update_risk_limits(limits);
+
+    ASSERT_TRUE(risk_->start_risk_monitor(10000));
+    EXPECT_FALSE(risk_->start_risk_monitor());
+    EXPECT_TRUE(risk_->trading_allowed());
+    EXPECT_TRUE(risk_->check_order_risk(TreasuryType::Note_2Y, OrderSide::BID, 1000000, Price32nd::from_decimal(99.5)));
+
+    // Buying 1MM at 99.5 books a realized loss far past the daily limit
+    risk_->update_position(TreasuryType::Note_2Y, 1000000, Price32nd::from_decimal(99.5));
+    for (int i = 0; i < 20000 && !risk_->is_emergency_stop_active(); ++i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    EXPECT_TRUE(risk_->is_emergency_stop_active());
+    EXPECT_FALSE(risk_->trading_allowed());
+    EXPECT_TRUE(risk_->get_circuit_breaker(BreakerType::PNL_LOSS_LIMIT).active);
+    EXPECT_FALSE(risk_->check_order_risk(TreasuryType::Note_2Y, OrderSide::ASK, 1000000, Price32nd::from_decimal(99.5)));
+
+    risk_->stop_risk_monitor();
+    EXPECT_FALSE(risk_->risk_monitor_running());
+    EXPECT_EQ(risk_->risk_state() & RiskControlSystem::MONITOR_ACTIVE_BIT, 0u);
+    EXPECT_EQ(risk_->get_circuit_breaker(BreakerType::PNL_LOSS_LIMIT).trigger_count, 1u);
+    EXPECT_EQ(risk_->breaches_logged(), 1u);
+}
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "hft/trading/slicing_engine.hpp"
+
+using namespace hft::trading;
+using namespace hft::market_data;
+
+/**
+ * @brief Test fixture for SlicingEngine
+ *
+ * Drives parent orders through the timer wheel with synthetic clocks.
+ */
+class SlicingEngineTest : public ::testing::Test {
+protected:
+    using Algo = SlicingEngine::Algo;
+    static constexpr uint64_t MS = 1000000;
+    static constexpr uint64_t T0 = 1000000000000ULL;
+
+    void SetUp() override {
+        books_ = std::make_unique<BookManager>();
+        orders_ = std::make_unique<OrderLifecycleManager>(books_->order_pool(), books_->level_pool(),
+                                                          books_->update_buffer());
+        router_ = std::make_unique<VenueRouter>();
+        engine_ = std::make_unique<SlicingEngine>(*orders_, *router_, books_.get(), MS, T0);
+    }
+
+    static SlicingEngine::ParentOrder parent(Algo algo, uint64_t quantity) {
+        SlicingEngine::ParentOrder order;
+        order.instrument = TreasuryType::Note_10Y;
+        order.side = OrderSide::BID;
+        order.algo = algo;
+        order.limit_price = Price32nd::from_decimal(99.5);
+        order.quantity = quantity;
+        order.start_ns = T0;
+        order.end_ns = T0 + 100 * MS;
+        order.slice_interval_ns = 10 * MS;
+        return order;
+    }
+
+    std::vector<SlicingEngine::Child> children(uint64_t parent_id) const {
+        std::vector<SlicingEngine::Child> out;
+        engine_->for_each_child(parent_id, [&](const SlicingEngine::Child& child) { out.push_back(child); });
+        return out;
+    }
+
+    bool fill(uint64_t order_id, uint64_t quantity, uint64_t leaves) {
+        OrderLifecycleManager::OrderExecution execution;
+        execution.order_id = order_id;
+        execution.instrument = TreasuryType::Note_10Y;
+        execution.execution_price = Price32nd::from_decimal(99.5);
+        execution.executed_quantity = quantity;
+        execution.leaves_quantity = leaves;
+        return engine_->on_execution(execution);
+    }
+
+    std::unique_ptr<BookManager> books_;
+    std::unique_ptr<OrderLifecycleManager> orders_;
+    std::unique_ptr<VenueRouter> router_;
+    std::unique_ptr<SlicingEngine> engine_;
+};
+
+TEST_F(SlicingEngineTest, TwapSlicesEvenlyAcrossTheWindow) {
+    const uint64_t id = engine_->submit(parent(Algo::TWAP, 10000000), T0);
+    ASSERT_NE(id, 0u);
+
+    uint64_t sent = 0;
+    for (uint64_t step = 0; step <= 10; ++step) {
+        const size_t count = engine_->on_timer(T0 + step * 10 * MS);
+        const auto working = children(id);
+        uint64_t total = 0;
+        for (const auto& child : working) total += child.quantity;
+        if (step < 10) {
+            ASSERT_EQ(count, 1u) << step;
+            EXPECT_EQ(working.front().quantity, 1000000u) << step;
+        } else {
+            EXPECT_EQ(count, 0u);  // Everything already out
+        }
+        sent = total;
+    }
+    EXPECT_EQ(sent, 10000000u);
+    EXPECT_EQ(engine_->stats().slices, 10u);
+
+    // Between slice times nothing more goes out
+    EXPECT_EQ(engine_->on_timer(T0 + 105 * MS), 0u);
+
+    for (const auto& child : children(id)) {
+        EXPECT_EQ(orders_->get_order(child.order_id)->original_quantity, child.quantity);
+        ASSERT_TRUE(fill(child.order_id, child.quantity, 0));
+    }
+    EXPECT_EQ(engine_->parent(id), nullptr);
+    EXPECT_EQ(engine_->stats().parents_completed, 1u);
+    EXPECT_EQ(engine_->working_children(), 0u);
+}
+
+TEST_F(SlicingEngineTest, VwapFollowsTheVolumeProfile) {
+    auto order = parent(Algo::VWAP, 8000000);
+    order.volume_profile.fill(0.0f);
+    order.volume_profile[0] = 3.0f;  // Three quarters of the volume in the first bucket
+    order.volume_profile[SlicingEngine::VWAP_BUCKETS - 1] = 1.0f;
+    const uint64_t id = engine_->submit(order, T0);
+
+    // 100ms / 16 buckets: the first bucket is complete by 6.25ms
+    ASSERT_EQ(engine_->on_timer(T0), 0u);
+    ASSERT_EQ(engine_->on_timer(T0 + 10 * MS), 1u);
+    EXPECT_EQ(children(id).front().quantity, 6000000u);
+    for (uint64_t step = 2; step < 10; ++step) {
+        EXPECT_EQ(engine_->on_timer(T0 + step * 10 * MS), 0u) << step;
+    }
+    ASSERT_EQ(engine_->on_timer(T0 + 100 * MS), 1u);
+    EXPECT_EQ(children(id).front().quantity, 2000000u);
+}
+
+TEST_F(SlicingEngineTest, IcebergReplenishesAfterFill) {
+    auto order = parent(Algo::ICEBERG, 5000000);
+    order.display_quantity = 2000000;
+    const uint64_t id = engine_->submit(order, T0);
+
+    ASSERT_EQ(engine_->on_timer(T0), 1u);
+    auto working = children(id);
+    ASSERT_EQ(working.size(), 1u);
+    EXPECT_EQ(working[0].quantity, 2000000u);
+
+    // Still working: no new clip
+    EXPECT_EQ(engine_->on_timer(T0 + 10 * MS), 0u);
+    ASSERT_TRUE(fill(working[0].order_id, 500000, 1500000));
+    EXPECT_EQ(engine_->on_timer(T0 + 20 * MS), 0u);
+
+    ASSERT_TRUE(fill(working[0].order_id, 1500000, 0));
+    ASSERT_EQ(engine_->on_timer(T0 + 30 * MS), 1u);
+    ASSERT_TRUE(fill(children(id)[0].order_id, 2000000, 0));
+    ASSERT_EQ(engine_->on_timer(T0 + 40 * MS), 1u);
+    working = children(id);
+    EXPECT_EQ(working[0].quantity, 1000000u);
+    ASSERT_TRUE(fill(working[0].order_id, 1000000, 0));
+    EXPECT_EQ(engine_->parent(id), nullptr);
+}
+
+TEST_F(SlicingEngineTest, ParticipationCapsToVisibleDepth) {
+    // 3MM offered through the limit, 1MM above it
+    ASSERT_TRUE(books_->add_order(TreasuryOrder(1, TreasuryType::Note_10Y, OrderSide::ASK, OrderType::LIMIT,
+                                                Price32nd::from_decimal(99.25), 1000000, 1)));
+    ASSERT_TRUE(books_->add_order(TreasuryOrder(2, TreasuryType::Note_10Y, OrderSide::ASK, OrderType::LIMIT,
+                                                Price32nd::from_decimal(99.5), 2000000, 2)));
+    ASSERT_TRUE(books_->add_order(TreasuryOrder(3, TreasuryType::Note_10Y, OrderSide::ASK, OrderType::LIMIT,
+                                                Price32nd::from_decimal(99.75), 1000000, 3)));
+
+    auto order = parent(Algo::TWAP, 20000000);
+    order.end_ns = T0 + 20 * MS;
+    order.max_participation = 0.5;
+    const uint64_t id = engine_->submit(order, T0);
+
+    // Half of 3MM, rounded down to the 1MM note increment
+    ASSERT_EQ(engine_->on_timer(T0), 1u);
+    EXPECT_EQ(children(id).front().quantity, 1000000u);
+    EXPECT_EQ(engine_->stats().depth_capped, 1u);
+
+    // The remainder goes out uncapped at the end of the window
+    ASSERT_EQ(engine_->on_timer(T0 + 20 * MS), 1u);
+    EXPECT_EQ(children(id).front().quantity, 19000000u);
+}
+
+TEST_F(SlicingEngineTest, LargeSlicesSplitAcrossVenues) {
+    auto order = parent(Algo::TWAP, 6000000);
+    order.end_ns = T0;  // Everything due at once
+    order.max_child_quantity = 2000000;
+    order.routing = VenueRouter::SORStrategy::LATENCY_OPTIMIZED;
+    const uint64_t id = engine_->submit(order, T0);
+
+    ASSERT_EQ(engine_->on_timer(T0), 2u);
+    const auto working = children(id);
+    ASSERT_EQ(working.size(), 2u);
+    EXPECT_NE(working[0].venue, working[1].venue);
+    EXPECT_EQ(working[0].quantity + working[1].quantity, 4000000u);
+    EXPECT_EQ(orders_->get_order(working[0].order_id)->target_venue, working[0].venue);
+
+    // The clip left over goes out on the next slice
+    ASSERT_EQ(engine_->on_timer(T0 + 10 * MS), 1u);
+    EXPECT_EQ(children(id).front().quantity, 2000000u);
+}
+
+TEST_F(SlicingEngineTest, CancelPullsWorkingChildren) {
+    const uint64_t id = engine_->submit(parent(Algo::TWAP, 10000000), T0);
+    ASSERT_EQ(engine_->on_timer(T0), 1u);
+    ASSERT_EQ(engine_->on_timer(T0 + 10 * MS), 1u);
+    EXPECT_EQ(engine_->working_children(), 2u);
+
+    EXPECT_TRUE(engine_->cancel(id));
+    EXPECT_FALSE(engine_->cancel(id));
+    EXPECT_EQ(engine_->parent(id), nullptr);
+    EXPECT_EQ(engine_->working_children(), 0u);
+    EXPECT_EQ(engine_->on_timer(T0 + 20 * MS), 0u);
+
+    // Invalid parents are refused
+    EXPECT_EQ(engine_->submit(parent(Algo::TWAP, 0), T0), 0u);
+    EXPECT_EQ(engine_->submit(parent(Algo::ICEBERG, 1000000), T0), 0u);
+}
+
+TEST_F(SlicingEngineTest, ClosedChildIsResent) {
+    auto order = parent(Algo::TWAP, 4000000);
+    order.end_ns = T0;
+    const uint64_t id = engine_->submit(order, T0);
+    ASSERT_EQ(engine_->on_timer(T0), 1u);
+    const auto first = children(id).front();
+
+    // Venue cancel after the window: the engine reschedules and resends
+    ASSERT_TRUE(engine_->on_child_closed(first.order_id));
+    EXPECT_EQ(engine_->working_children(), 0u);
+    ASSERT_EQ(engine_->on_timer(T0 + 1 * MS), 1u);
+    EXPECT_EQ(children(id).front().quantity, 4000000u);
+}
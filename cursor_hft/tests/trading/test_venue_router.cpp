@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "hft/trading/venue_router.hpp"
+
+using namespace hft::trading;
+using namespace hft::market_data;
+
+/**
+ * @brief Test fixture for VenueRouter
+ *
+ * Covers the materialized venue ranking and its invalidation.
+ */
+class VenueRouterTest : public ::testing::Test {
+protected:
+    using SORStrategy = VenueRouter::SORStrategy;
+
+    void SetUp() override {
+        router_ = std::make_unique<VenueRouter>();
+    }
+
+    static VenueRouter::OrderCharacteristics order(TreasuryType instrument, uint64_t quantity) {
+        VenueRouter::OrderCharacteristics characteristics{};
+        characteristics.instrument = instrument;
+        characteristics.side = OrderSide::BID;
+        characteristics.quantity = quantity;
+        characteristics.price = Price32nd::from_decimal(99.5);
+        characteristics.urgency_factor = 0.5;
+        return characteristics;
+    }
+
+    std::unique_ptr<VenueRouter> router_;
+};
+
+TEST_F(VenueRouterTest, RepeatedOrdersHitTheRanking) {
+    const auto characteristics = order(TreasuryType::Bill_3M, VenueRouter::SIZE_BUCKET_REPRESENTATIVE[1]);
+    const auto first = router_->route_order(characteristics, SORStrategy::FILL_RATE_OPTIMIZED);
+    EXPECT_EQ(router_->ranking_cache_stats().rebuilds, 1u);
+
+    for (int i = 0; i < 10; ++i) {
+        const auto again = router_->route_order(characteristics, SORStrategy::FILL_RATE_OPTIMIZED);
+        ASSERT_EQ(again.primary_venue, first.primary_venue);
+        ASSERT_DOUBLE_EQ(again.expected_fill_rate, first.expected_fill_rate);
+    }
+    EXPECT_EQ(router_->ranking_cache_stats().hits, 10u);
+    EXPECT_EQ(router_->ranking_cache_stats().rebuilds, 1u);
+
+    // Same bucket, different size: same venue, fill estimate for the actual order
+    auto smaller = characteristics;
+    smaller.quantity = 2000000;
+    const auto bucketed = router_->route_order(smaller, SORStrategy::FILL_RATE_OPTIMIZED);
+    EXPECT_EQ(bucketed.primary_venue, first.primary_venue);
+    EXPECT_DOUBLE_EQ(bucketed.expected_fill_rate,
+                     router_->calculate_fill_probability(bucketed.primary_venue, smaller));
+    EXPECT_EQ(router_->ranking_cache_stats().rebuilds, 1u);
+
+    // Other buckets, instruments and strategies are separate entries
+    (void)router_->route_order(order(TreasuryType::Bill_3M, 90000000), SORStrategy::FILL_RATE_OPTIMIZED);
+    (void)router_->route_order(order(TreasuryType::Bond_30Y, 2000000), SORStrategy::FILL_RATE_OPTIMIZED);
+    (void)router_->route_order(characteristics, SORStrategy::BALANCED);
+    EXPECT_EQ(router_->ranking_cache_stats().rebuilds, 4u);
+}
+
+TEST_F(VenueRouterTest, SmallPerformanceMovesKeepTheRanking) {
+    const auto& perf = router_->get_venue_performance(VenueRouter::VenueType::ECN);
+    const uint64_t epoch = router_->ranking_epoch();
+
+    // A sample at the current averages moves the fill rate by <1%
+    router_->update_venue_performance(VenueRouter::VenueType::ECN,
+                                      static_cast<uint64_t>(perf.average_latency_ns), true, perf.market_impact);
+    EXPECT_EQ(router_->ranking_epoch(), epoch);
+
+    // A latency spike moves the average past the threshold
+    router_->update_venue_performance(VenueRouter::VenueType::ECN, 50000, true, perf.market_impact);
+    EXPECT_EQ(router_->ranking_epoch(), epoch + 1);
+
+    router_->set_ranking_threshold(0.0);
+    router_->update_venue_performance(VenueRouter::VenueType::ECN, 50000, true, perf.market_impact);
+    EXPECT_EQ(router_->ranking_epoch(), epoch + 2);
+}
+
+TEST_F(VenueRouterTest, ConnectivityChangesReRank) {
+    const auto characteristics = order(TreasuryType::Note_10Y, 1000000);
+    const auto best = router_->route_order(characteristics, SORStrategy::BALANCED).primary_venue;
+
+    router_->update_connectivity_status(best, VenueRouter::ConnectionStatus::DISCONNECTED);
+    const auto failover = router_->route_order(characteristics, SORStrategy::BALANCED).primary_venue;
+    EXPECT_NE(failover, best);
+
+    // Repeating a status does not invalidate
+    const uint64_t epoch = router_->ranking_epoch();
+    router_->update_connectivity_status(best, VenueRouter::ConnectionStatus::DISCONNECTED);
+    EXPECT_EQ(router_->ranking_epoch(), epoch);
+
+    router_->update_connectivity_status(best, VenueRouter::ConnectionStatus::CONNECTED);
+    EXPECT_EQ(router_->route_order(characteristics, SORStrategy::BALANCED).primary_venue, best);
+
+    router_->set_venue_enabled(best, false);
+    EXPECT_NE(router_->route_order(characteristics, SORStrategy::BALANCED).primary_venue, best);
+}
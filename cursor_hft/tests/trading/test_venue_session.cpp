@@ -0,0 +1,558 @@
+#include <gtest/gtest.h>
+#include "hft/trading/venue_session.hpp"
+#include "hft/trading/order_lifecycle_manager.hpp"
+#include "hft/memory/object_pool.hpp"
+#include "hft/messaging/spsc_ring_buffer.hpp"
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace hft;
+using namespace hft::trading;
+using namespace hft::market_data;
+
+namespace {
+
+using State = OrderLifecycleManager::OrderState;
+using Venue = OrderLifecycleManager::VenueType;
+
+SessionIdentity identity(const char* sender, const char* target) {
+    SessionIdentity id;
+    std::strncpy(id.sender_comp_id, sender, sizeof(id.sender_comp_id) - 1);
+    std::strncpy(id.target_comp_id, target, sizeof(id.target_comp_id) - 1);
+    return id;
+}
+
+std::string encode(const SessionMessage& msg, uint64_t sending_time_ns = 0) {
+    char buffer[FixCodec::MAX_MESSAGE_SIZE];
+    const size_t size = FixCodec::encode(buffer, sizeof(buffer), msg, identity("DESK", "VENUE"), sending_time_ns);
+    return std::string(buffer, size);
+}
+
+// Venue end of a socketpair: decodes what the session sends, answers with encoded reports
+class FakeVenue {
+public:
+    FakeVenue(int fd, SessionProtocol protocol) : fd_(fd), protocol_(protocol) {
+        ::fcntl(fd_, F_SETFL, ::fcntl(fd_, F_GETFL, 0) | O_NONBLOCK);
+    }
+    ~FakeVenue() { hang_up(); }
+
+    std::vector<SessionMessage> receive() {
+        char chunk[4096];
+        ssize_t n;
+        while (fd_ >= 0 && (n = ::recv(fd_, chunk, sizeof(chunk), 0)) > 0) {
+            pending_.append(chunk, static_cast<size_t>(n));
+        }
+        std::vector<SessionMessage> messages;
+        SessionMessage msg;
+        size_t used;
+        while ((used = decode_session_message(protocol_, pending_.data(), pending_.size(), msg)) != 0) {
+            EXPECT_NE(used, FixCodec::MALFORMED);
+            if (used == FixCodec::MALFORMED) break;
+            pending_.erase(0, used);
+            messages.push_back(msg);
+        }
+        return messages;
+    }
+
+    void reply(SessionMessage msg) {
+        msg.seq_num = next_seq_++;
+        char buffer[MAX_SESSION_MESSAGE_SIZE];
+        const size_t size = encode_session_message(protocol_, buffer, sizeof(buffer), msg,
+                                                   identity("VENUE", "DESK"), 0);
+        write_raw(buffer, size);
+    }
+
+    void report(uint64_t order_id, ExecType type, uint64_t quantity = 0, uint64_t leaves = 0) {
+        SessionMessage msg;
+        msg.type = SessionMsgType::EXECUTION_REPORT;
+        msg.exec_type = type;
+        msg.cl_ord_id = order_id;
+        msg.venue_order_id = 9000 + order_id % 1000;
+        msg.exec_id = ++exec_id_;
+        msg.security_id = 5;
+        msg.leaves_quantity = leaves;
+        if (type == ExecType::TRADE) {
+            msg.last_quantity = quantity;
+            msg.last_price_64ths = to_64ths(Price32nd::from_decimal(102.5));
+        } else {
+            msg.quantity = quantity;
+            msg.price_64ths = to_64ths(Price32nd::from_decimal(102.5));
+        }
+        reply(msg);
+    }
+
+    void write_raw(const char* data, size_t size) { ASSERT_EQ(::send(fd_, data, size, 0), static_cast<ssize_t>(size)); }
+
+    void hang_up() {
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = -1;
+    }
+
+    [[nodiscard]] bool peer_closed() {
+        char byte;
+        return ::recv(fd_, &byte, 1, 0) == 0;
+    }
+
+private:
+    int fd_;
+    SessionProtocol protocol_;
+    std::string pending_;
+    uint32_t next_seq_ = 1;
+    uint64_t exec_id_ = 0;
+};
+
+} // namespace
+
+TEST(OrderEntryCodecTest, FixRoundTrip) {
+    SessionMessage order;
+    order.type = SessionMsgType::NEW_ORDER;
+    order.seq_num = 7;
+    order.cl_ord_id = (3ULL << 32) | 42;
+    order.security_id = 5;
+    order.side = OrderSide::ASK;
+    order.ord_type = OrderType::LIMIT;
+    order.time_in_force = OrderLifecycleManager::TimeInForce::GTC;
+    order.quantity = 5000000;
+    order.price_64ths = to_64ths(Price32nd{99, 16, 1, {}});  // 99-16+
+
+    const std::string wire = encode(order, 1700000000123456789ULL);
+    EXPECT_EQ(wire.rfind("8=FIX.4.4\x01" "9=", 0), 0u);
+    EXPECT_NE(wire.find("\x01" "35=D\x01" "34=7\x01" "49=DESK\x01" "56=VENUE\x01" "52=20231114-22:13:20.123\x01"),
+              std::string::npos);
+    EXPECT_NE(wire.find("\x01" "44=99.515625\x01"), std::string::npos);
+    EXPECT_NE(wire.find("\x01" "54=2\x01" "38=5000000\x01" "40=2\x01"), std::string::npos);
+    EXPECT_EQ(wire.substr(wire.size() - 8, 4), "\x01" "10=");
+
+    SessionMessage decoded;
+    ASSERT_EQ(FixCodec::decode(wire.data(), wire.size(), decoded), wire.size());
+    EXPECT_EQ(decoded.type, SessionMsgType::NEW_ORDER);
+    EXPECT_EQ(decoded.seq_num, 7u);
+    EXPECT_EQ(decoded.cl_ord_id, order.cl_ord_id);
+    EXPECT_EQ(decoded.security_id, 5u);
+    EXPECT_EQ(decoded.side, OrderSide::ASK);
+    EXPECT_EQ(decoded.quantity, 5000000u);
+    EXPECT_EQ(decoded.price_64ths, order.price_64ths);
+    EXPECT_EQ(decoded.time_in_force, OrderLifecycleManager::TimeInForce::GTC);
+    EXPECT_EQ(from_64ths(decoded.price_64ths).to_decimal(), 99.515625);
+
+    // Cancels name the order in OrigClOrdID and carry their own 'C' ClOrdID
+    SessionMessage cancel;
+    cancel.type = SessionMsgType::CANCEL_REQUEST;
+    cancel.cl_ord_id = 77;
+    const std::string cancel_wire = encode(cancel);
+    EXPECT_NE(cancel_wire.find("\x01" "11=C77\x01" "41=77\x01"), std::string::npos);
+    ASSERT_EQ(FixCodec::decode(cancel_wire.data(), cancel_wire.size(), decoded), cancel_wire.size());
+    EXPECT_EQ(decoded.type, SessionMsgType::CANCEL_REQUEST);
+    EXPECT_EQ(decoded.cl_ord_id, 77u);
+
+    SessionMessage fill;
+    fill.type = SessionMsgType::EXECUTION_REPORT;
+    fill.exec_type = ExecType::TRADE;
+    fill.cl_ord_id = 77;
+    fill.venue_order_id = 555;
+    fill.exec_id = 9;
+    fill.quantity = 5000000;
+    fill.leaves_quantity = 3000000;
+    fill.price_64ths = to_64ths(Price32nd::from_decimal(101.25));
+    fill.last_quantity = 2000000;
+    fill.last_price_64ths = to_64ths(Price32nd::from_decimal(101.21875));
+    const std::string fill_wire = encode(fill);
+    EXPECT_NE(fill_wire.find("\x01" "39=1\x01"), std::string::npos);  // Partially filled
+    ASSERT_EQ(FixCodec::decode(fill_wire.data(), fill_wire.size(), decoded), fill_wire.size());
+    EXPECT_EQ(decoded.exec_type, ExecType::TRADE);
+    EXPECT_EQ(decoded.venue_order_id, 555u);
+    EXPECT_EQ(decoded.exec_id, 9u);
+    EXPECT_EQ(decoded.quantity, 5000000u);          // OrderQty and LastQty stay apart
+    EXPECT_EQ(decoded.last_quantity, 2000000u);
+    EXPECT_EQ(decoded.leaves_quantity, 3000000u);
+    EXPECT_EQ(decoded.price_64ths, fill.price_64ths);
+    EXPECT_EQ(decoded.last_price_64ths, fill.last_price_64ths);
+
+    fill.exec_type = ExecType::CANCEL_REJECTED;
+    const std::string reject_wire = encode(fill);
+    EXPECT_NE(reject_wire.find("\x01" "35=9\x01"), std::string::npos);
+    ASSERT_EQ(FixCodec::decode(reject_wire.data(), reject_wire.size(), decoded), reject_wire.size());
+    EXPECT_EQ(decoded.type, SessionMsgType::EXECUTION_REPORT);
+    EXPECT_EQ(decoded.exec_type, ExecType::CANCEL_REJECTED);
+    EXPECT_EQ(decoded.cl_ord_id, 77u);
+}
+
+TEST(OrderEntryCodecTest, FixExecTypes) {
+    SessionMessage report;
+    report.type = SessionMsgType::EXECUTION_REPORT;
+    report.cl_ord_id = 42;
+    std::string wire = encode(report);
+    const size_t exec_type_at = wire.find("\x01" "150=") + 5;
+    SessionMessage decoded;
+
+    // Expired and done-for-day end the order; pending/restated reports are ignored
+    for (const auto& [code, type] : {std::pair{'C', ExecType::EXPIRED}, std::pair{'3', ExecType::EXPIRED},
+                                     std::pair{'F', ExecType::TRADE}, std::pair{'0', ExecType::NEW}}) {
+        report.exec_type = type;
+        wire = encode(report);
+        ASSERT_EQ(FixCodec::decode(wire.data(), wire.size(), decoded), wire.size());
+        EXPECT_EQ(decoded.type, SessionMsgType::EXECUTION_REPORT) << code;
+        EXPECT_EQ(decoded.exec_type, type) << code;
+    }
+    for (const char code : {'5', '6', 'A', 'D', 'I'}) {
+        report.exec_type = ExecType::NEW;
+        wire = encode(report);
+        wire[exec_type_at] = code;
+        // Re-frame with a fresh checksum
+        const std::string body = wire.substr(0, wire.rfind("10="));
+        uint32_t sum = 0;
+        for (const char c : body) sum += static_cast<unsigned char>(c);
+        char trailer[8];
+        std::snprintf(trailer, sizeof(trailer), "10=%03u\x01", sum % 256);
+        wire = body + trailer;
+        ASSERT_EQ(FixCodec::decode(wire.data(), wire.size(), decoded), wire.size()) << code;
+        EXPECT_EQ(decoded.type, SessionMsgType::UNSUPPORTED) << code;
+    }
+
+    SessionMessage test_request;
+    test_request.type = SessionMsgType::TEST_REQUEST;
+    std::strcpy(test_request.test_req_id, "TEST-20261015");
+    wire = encode(test_request);
+    EXPECT_NE(wire.find("\x01" "35=1\x01"), std::string::npos);
+    ASSERT_EQ(FixCodec::decode(wire.data(), wire.size(), decoded), wire.size());
+    EXPECT_EQ(decoded.type, SessionMsgType::TEST_REQUEST);
+    EXPECT_STREQ(decoded.test_req_id, "TEST-20261015");
+}
+
+TEST(OrderEntryCodecTest, FixFramingErrors) {
+    SessionMessage heartbeat;
+    const std::string wire = encode(heartbeat);
+    SessionMessage decoded;
+
+    // Incomplete input waits for more bytes
+    for (size_t len : {size_t{0}, size_t{1}, size_t{12}, wire.size() - 1}) {
+        EXPECT_EQ(FixCodec::decode(wire.data(), len, decoded), 0u) << len;
+    }
+    // Two messages back to back decode one at a time
+    const std::string two = wire + wire;
+    EXPECT_EQ(FixCodec::decode(two.data(), two.size(), decoded), wire.size());
+
+    std::string corrupt = wire;
+    corrupt[wire.find("35=") + 3] = '1';  // Checksum no longer matches
+    EXPECT_EQ(FixCodec::decode(corrupt.data(), corrupt.size(), decoded), FixCodec::MALFORMED);
+    const std::string garbage = "GET / HTTP/1.1\r\n";
+    EXPECT_EQ(FixCodec::decode(garbage.data(), garbage.size(), decoded), FixCodec::MALFORMED);
+
+    char small[FixCodec::MAX_MESSAGE_SIZE - 1];
+    EXPECT_EQ(FixCodec::encode(small, sizeof(small), heartbeat, SessionIdentity{}, 0), 0u);
+}
+
+TEST(OrderEntryCodecTest, BinaryRoundTrip) {
+    SessionMessage fill;
+    fill.type = SessionMsgType::EXECUTION_REPORT;
+    fill.exec_type = ExecType::TRADE;
+    fill.seq_num = 12;
+    fill.cl_ord_id = (5ULL << 32) | 9;
+    fill.venue_order_id = 31;
+    fill.exec_id = 32;
+    fill.quantity = 5000000;
+    fill.leaves_quantity = 4000000;
+    fill.price_64ths = to_64ths(Price32nd::from_decimal(99.75));
+    fill.last_quantity = 1000000;
+    fill.last_price_64ths = to_64ths(Price32nd::from_decimal(99.71875));
+    fill.security_id = 912828900;
+    fill.side = OrderSide::ASK;
+    fill.ord_type = OrderType::IOC;
+
+    char frame[BinaryCodec::FRAME_SIZE];
+    ASSERT_EQ(BinaryCodec::encode(frame, sizeof(frame), fill, SessionIdentity{}, 0), BinaryCodec::FRAME_SIZE);
+    SessionMessage decoded;
+    EXPECT_EQ(BinaryCodec::decode(frame, sizeof(frame) - 1, decoded), 0u);
+    ASSERT_EQ(BinaryCodec::decode(frame, sizeof(frame), decoded), BinaryCodec::FRAME_SIZE);
+    EXPECT_EQ(decoded.type, SessionMsgType::EXECUTION_REPORT);
+    EXPECT_EQ(decoded.exec_type, ExecType::TRADE);
+    EXPECT_EQ(decoded.seq_num, 12u);
+    EXPECT_EQ(decoded.cl_ord_id, fill.cl_ord_id);
+    EXPECT_EQ(decoded.venue_order_id, 31u);
+    EXPECT_EQ(decoded.exec_id, 32u);
+    EXPECT_EQ(decoded.quantity, 5000000u);
+    EXPECT_EQ(decoded.leaves_quantity, 4000000u);
+    EXPECT_EQ(decoded.price_64ths, fill.price_64ths);
+    EXPECT_EQ(decoded.last_quantity, 1000000u);
+    EXPECT_EQ(decoded.last_price_64ths, fill.last_price_64ths);
+    EXPECT_EQ(decoded.security_id, 912828900u);
+    EXPECT_EQ(decoded.side, OrderSide::ASK);
+    EXPECT_EQ(decoded.ord_type, OrderType::IOC);
+
+    frame[3] = 1;  // Unknown version
+    EXPECT_EQ(BinaryCodec::decode(frame, sizeof(frame), decoded), BinaryCodec::MALFORMED);
+}
+
+class OrderEntrySessionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        order_pool_ = std::make_unique<TreasuryOrderPool>();
+        level_pool_ = std::make_unique<PriceLevelPool>();
+        update_buffer_ = std::make_unique<OrderBookUpdateBuffer>();
+        orders_ = std::make_unique<OrderLifecycleManager>(*order_pool_, *level_pool_, *update_buffer_);
+        loop_ = std::make_unique<SessionEventLoop>();
+        gateway_ = std::make_unique<OrderEntryGateway>(*orders_, *loop_);
+    }
+
+    // Session on our end of a fresh socketpair; the venue gets the other end
+    std::unique_ptr<FakeVenue> connect(Venue venue, SessionProtocol protocol, OrderEntrySession*& session) {
+        int fds[2];
+        EXPECT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+        SessionConfig config;
+        config.venue = venue;
+        config.protocol = protocol;
+        config.identity = identity("DESK", "VENUE");
+        config.heartbeat_interval_ns = HEARTBEAT_NS;
+        config.logon_timeout_ns = LOGON_TIMEOUT_NS;
+        session = loop_->add_session(config, fds[0]);
+        EXPECT_NE(session, nullptr);
+        return std::make_unique<FakeVenue>(fds[1], protocol);
+    }
+
+    // Poll, then let the venue log the session on
+    void log_on(FakeVenue& venue) {
+        loop_->poll_once(now_);
+        const auto received = venue.receive();
+        ASSERT_EQ(received.size(), 1u);
+        EXPECT_EQ(received[0].type, SessionMsgType::LOGON);
+        EXPECT_EQ(received[0].seq_num, 1u);
+        SessionMessage logon;
+        logon.type = SessionMsgType::LOGON;
+        venue.reply(logon);
+    }
+
+    uint64_t create(TreasuryType instrument, Venue venue, uint64_t quantity = 5000000) {
+        return orders_->create_order(instrument, OrderSide::BID, OrderType::LIMIT, Price32nd::from_decimal(102.5),
+                                     quantity, OrderLifecycleManager::TimeInForce::DAY, 0, venue);
+    }
+
+    State state_of(uint64_t order_id) const { return orders_->get_order(order_id)->state; }
+
+    // Final reports retire the order: its ID no longer resolves
+    bool retired(uint64_t order_id) const { return orders_->get_order(order_id) == nullptr; }
+
+    static constexpr uint64_t HEARTBEAT_NS = 1000000;
+    static constexpr uint64_t LOGON_TIMEOUT_NS = 5000000;
+
+    uint64_t now_ = 1000000000;
+    std::unique_ptr<TreasuryOrderPool> order_pool_;
+    std::unique_ptr<PriceLevelPool> level_pool_;
+    std::unique_ptr<OrderBookUpdateBuffer> update_buffer_;
+    std::unique_ptr<OrderLifecycleManager> orders_;
+    std::unique_ptr<SessionEventLoop> loop_;
+    std::unique_ptr<OrderEntryGateway> gateway_;
+};
+
+TEST_F(OrderEntrySessionTest, OrdersAcksAndFillsFlowBackToTheManager) {
+    OrderEntrySession* dealer = nullptr;
+    OrderEntrySession* ecn = nullptr;
+    auto fix_venue = connect(Venue::PRIMARY_DEALER, SessionProtocol::FIX44, dealer);
+    auto binary_venue = connect(Venue::ECN, SessionProtocol::BINARY, ecn);
+    OrderEntrySession* duplicate = nullptr;
+    int spare[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, spare), 0);
+    SessionConfig again;
+    again.venue = Venue::ECN;
+    duplicate = loop_->add_session(again, spare[0]);
+    EXPECT_EQ(duplicate, nullptr);  // One session per venue
+    SessionConfig no_heartbeat;
+    no_heartbeat.venue = Venue::DARK_POOL;
+    no_heartbeat.heartbeat_interval_ns = 0;
+    EXPECT_EQ(loop_->add_session(no_heartbeat, spare[0]), nullptr);  // Would spin in pump()
+    EXPECT_EQ(loop_->session_count(), 2u);
+    ::close(spare[0]);
+    ::close(spare[1]);
+
+    log_on(*fix_venue);
+    log_on(*binary_venue);
+    loop_->poll_once(now_);
+    EXPECT_EQ(dealer->state(), SessionState::ACTIVE);
+    EXPECT_EQ(ecn->state(), SessionState::ACTIVE);
+    EXPECT_EQ(loop_->frame_pool().in_use(), 2u);  // One protocol coroutine each
+
+    const uint64_t filled = create(TreasuryType::Note_10Y, Venue::PRIMARY_DEALER);
+    const uint64_t rejected = create(TreasuryType::Note_10Y, Venue::PRIMARY_DEALER);
+    const uint64_t cancelled = create(TreasuryType::Bill_3M, Venue::ECN, 1000000);
+    const uint64_t unrouted = create(TreasuryType::Note_2Y, Venue::DARK_POOL);
+    ASSERT_TRUE(filled && rejected && cancelled && unrouted);
+    EXPECT_TRUE(gateway_->send_order(filled));
+    EXPECT_TRUE(gateway_->send_order(rejected));
+    EXPECT_TRUE(gateway_->send_order(cancelled));
+    EXPECT_FALSE(gateway_->send_order(filled));    // Already sent
+    EXPECT_FALSE(gateway_->send_order(unrouted));  // No session for the venue
+    EXPECT_EQ(state_of(filled), State::PENDING_NEW);
+
+    // Both dealer orders leave in one send()
+    const uint64_t send_calls = dealer->stats().send_calls;
+    loop_->poll_once(now_);
+    EXPECT_EQ(dealer->stats().send_calls, send_calls + 1);
+    const auto dealer_orders = fix_venue->receive();
+    ASSERT_EQ(dealer_orders.size(), 2u);
+    EXPECT_EQ(dealer_orders[0].type, SessionMsgType::NEW_ORDER);
+    EXPECT_EQ(dealer_orders[0].cl_ord_id, filled);
+    EXPECT_EQ(dealer_orders[0].security_id, config::Instruments::primary_id(TreasuryType::Note_10Y));
+    EXPECT_EQ(dealer_orders[0].quantity, 5000000u);
+    EXPECT_EQ(dealer_orders[0].price_64ths, to_64ths(Price32nd::from_decimal(102.5)));
+    EXPECT_EQ(dealer_orders[1].cl_ord_id, rejected);
+    EXPECT_EQ(dealer_orders[1].seq_num, dealer_orders[0].seq_num + 1);
+    const auto ecn_orders = binary_venue->receive();
+    ASSERT_EQ(ecn_orders.size(), 1u);
+    EXPECT_EQ(ecn_orders[0].cl_ord_id, cancelled);
+
+    fix_venue->report(filled, ExecType::NEW, 0, 5000000);
+    fix_venue->report(filled, ExecType::TRADE, 2000000, 3000000);
+    fix_venue->report(rejected, ExecType::REJECTED);
+    binary_venue->report(cancelled, ExecType::NEW, 0, 1000000);
+    loop_->poll_once(now_);
+    EXPECT_EQ(gateway_->apply_reports(), 4u);
+    EXPECT_EQ(state_of(filled), State::PARTIALLY_FILLED);
+    EXPECT_EQ(orders_->get_order(filled)->executed_quantity, 2000000u);
+    EXPECT_TRUE(retired(rejected));
+    EXPECT_EQ(orders_->get_metrics().orders_rejected.load(), 1u);
+    EXPECT_EQ(state_of(cancelled), State::ACKNOWLEDGED);
+
+    fix_venue->report(filled, ExecType::TRADE, 3000000, 0);
+    EXPECT_TRUE(gateway_->send_cancel(cancelled));
+    EXPECT_EQ(state_of(cancelled), State::PENDING_CANCEL);
+    EXPECT_FALSE(gateway_->send_cancel(cancelled));  // Already pending
+    loop_->poll_once(now_);
+    const auto cancels = binary_venue->receive();
+    ASSERT_EQ(cancels.size(), 1u);
+    EXPECT_EQ(cancels[0].type, SessionMsgType::CANCEL_REQUEST);
+    EXPECT_EQ(cancels[0].cl_ord_id, cancelled);
+    binary_venue->report(cancelled, ExecType::CANCELED);
+    loop_->poll_once(now_);
+    EXPECT_EQ(gateway_->apply_reports(), 2u);
+    EXPECT_TRUE(retired(filled));
+    EXPECT_EQ(orders_->get_metrics().orders_filled.load(), 1u);
+    EXPECT_TRUE(retired(cancelled));
+    EXPECT_EQ(orders_->get_metrics().orders_cancelled.load(), 1u);
+
+    // A day order the venue ends at the close
+    const uint64_t day_order = create(TreasuryType::Note_10Y, Venue::PRIMARY_DEALER);
+    ASSERT_TRUE(gateway_->send_order(day_order));
+    loop_->poll_once(now_);
+    ASSERT_EQ(fix_venue->receive().size(), 1u);
+    fix_venue->report(day_order, ExecType::EXPIRED);
+    loop_->poll_once(now_);
+    EXPECT_EQ(gateway_->apply_reports(), 1u);
+    EXPECT_TRUE(retired(day_order));
+
+    EXPECT_EQ(dealer->stats().messages_received, 6u);  // Logon + 5 reports
+    EXPECT_EQ(dealer->stats().sequence_gaps, 0u);
+    EXPECT_EQ(dealer->stats().malformed, 0u);
+    EXPECT_EQ(dealer->stats().reports_dropped, 0u);
+}
+
+TEST_F(OrderEntrySessionTest, HeartbeatsAndLogout) {
+    OrderEntrySession* session = nullptr;
+    auto venue = connect(Venue::PRIMARY_DEALER, SessionProtocol::FIX44, session);
+    log_on(*venue);
+    loop_->poll_once(now_);
+    ASSERT_EQ(session->state(), SessionState::ACTIVE);
+
+    // Quiet for a heartbeat interval: the session speaks up, once
+    now_ += HEARTBEAT_NS / 2;
+    EXPECT_EQ(loop_->poll_once(now_), 0u);
+    now_ += HEARTBEAT_NS / 2;
+    loop_->poll_once(now_);
+    loop_->poll_once(now_);
+    auto received = venue->receive();
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].type, SessionMsgType::HEARTBEAT);
+    EXPECT_EQ(session->stats().heartbeats_sent, 1u);
+    SessionMessage heartbeat;
+    venue->reply(heartbeat);
+    now_ += HEARTBEAT_NS;
+    loop_->poll_once(now_);
+    EXPECT_EQ(session->state(), SessionState::ACTIVE);
+
+    // A test request is answered straight away, echoing its id
+    (void)venue->receive();
+    SessionMessage test_request;
+    test_request.type = SessionMsgType::TEST_REQUEST;
+    std::strcpy(test_request.test_req_id, "PING7");
+    venue->reply(test_request);
+    loop_->poll_once(now_);
+    received = venue->receive();
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].type, SessionMsgType::HEARTBEAT);
+    EXPECT_STREQ(received[0].test_req_id, "PING7");
+
+    // Orders queued while logging out are refused, not sent
+    loop_->request_logout();
+    loop_->poll_once(now_);
+    EXPECT_EQ(session->state(), SessionState::LOGGING_OUT);
+    const uint64_t late = create(TreasuryType::Note_10Y, Venue::PRIMARY_DEALER);
+    ASSERT_TRUE(gateway_->send_order(late));
+    loop_->poll_once(now_);
+    EXPECT_EQ(gateway_->apply_reports(), 1u);
+    EXPECT_TRUE(retired(late));
+    EXPECT_EQ(session->stats().rejected_offline, 1u);
+
+    received = venue->receive();
+    ASSERT_FALSE(received.empty());
+    EXPECT_EQ(received.back().type, SessionMsgType::LOGOUT);
+    SessionMessage logout;
+    logout.type = SessionMsgType::LOGOUT;
+    venue->reply(logout);
+    loop_->poll_once(now_);
+    EXPECT_EQ(session->state(), SessionState::CLOSED);
+    EXPECT_FALSE(session->connected());
+    EXPECT_TRUE(venue->peer_closed());
+    EXPECT_TRUE(loop_->finished());
+    EXPECT_EQ(loop_->frame_pool().in_use(), 0u);
+}
+
+TEST_F(OrderEntrySessionTest, FailuresRefuseQueuedOrders) {
+    OrderEntrySession* unanswered = nullptr;
+    OrderEntrySession* dropped = nullptr;
+    OrderEntrySession* silent = nullptr;
+    OrderEntrySession* garbled = nullptr;
+    auto no_reply = connect(Venue::PRIMARY_DEALER, SessionProtocol::FIX44, unanswered);
+    auto hangs_up = connect(Venue::ECN, SessionProtocol::BINARY, dropped);
+    auto goes_quiet = connect(Venue::DARK_POOL, SessionProtocol::FIX44, silent);
+    auto sends_garbage = connect(Venue::CROSSING_NETWORK, SessionProtocol::FIX44, garbled);
+
+    loop_->poll_once(now_);
+    for (FakeVenue* venue : {hangs_up.get(), goes_quiet.get(), sends_garbage.get()}) {
+        ASSERT_EQ(venue->receive().size(), 1u);
+        SessionMessage logon;
+        logon.type = SessionMsgType::LOGON;
+        venue->reply(logon);
+    }
+    // Orders wait while the logon is outstanding
+    const uint64_t waiting = create(TreasuryType::Note_10Y, Venue::PRIMARY_DEALER);
+    ASSERT_TRUE(gateway_->send_order(waiting));
+    loop_->poll_once(now_);
+    EXPECT_EQ(unanswered->state(), SessionState::LOGGING_ON);
+    EXPECT_EQ(state_of(waiting), State::PENDING_NEW);
+    EXPECT_EQ(gateway_->apply_reports(), 0u);
+
+    hangs_up->hang_up();
+    sends_garbage->write_raw("8=FIX.4.4\x01" "9=oops\x01", 17);
+    now_ += LOGON_TIMEOUT_NS;
+    loop_->poll_once(now_);
+    EXPECT_EQ(unanswered->state(), SessionState::FAILED);
+    EXPECT_EQ(no_reply->receive().size(), 1u);  // The unanswered logon
+    EXPECT_TRUE(no_reply->peer_closed());
+    EXPECT_EQ(dropped->state(), SessionState::FAILED);
+    EXPECT_EQ(garbled->state(), SessionState::FAILED);
+    EXPECT_EQ(garbled->stats().malformed, 1u);
+    // Nothing from the quiet venue for over two heartbeat intervals
+    EXPECT_EQ(silent->state(), SessionState::FAILED);
+    EXPECT_TRUE(goes_quiet->peer_closed());
+
+    EXPECT_EQ(gateway_->apply_reports(), 1u);
+    EXPECT_TRUE(retired(waiting));
+    EXPECT_TRUE(loop_->finished());
+    EXPECT_EQ(loop_->frame_pool().in_use(), 0u);
+    EXPECT_EQ(loop_->frame_pool().high_water(), 4u);
+}
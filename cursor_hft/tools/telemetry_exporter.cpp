@@ -0,0 +1,51 @@
+// Out-of-process telemetry exporter: maps a trading process's telemetry
+// region read-only and serves it as OpenMetrics text and a UDP stream.
+//
+// Usage: hft_telemetry_exporter <region> [http_port] [udp_host udp_port]
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "hft/monitoring/telemetry.hpp"
+
+namespace {
+std::atomic<bool> g_stop{false};
+void handle_signal(int) { g_stop.store(true); }
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <region> [http_port] [udp_host udp_port]\n", argv[0]);
+        return 2;
+    }
+    std::signal(SIGINT, handle_signal);
+    std::signal(SIGTERM, handle_signal);
+
+    hft::monitoring::TelemetryExporterConfig config;
+    config.http_port = argc > 2 ? static_cast<uint16_t>(std::atoi(argv[2])) : 9464;
+    if (argc > 4) {
+        config.udp_address = argv[3];
+        config.udp_port = static_cast<uint16_t>(std::atoi(argv[4]));
+    }
+
+    // The trading process may not have created its region yet
+    hft::monitoring::TelemetryReader reader;
+    while (!reader.open(argv[1])) {
+        if (g_stop.load()) return 1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    hft::monitoring::TelemetryExporter exporter(reader, config);
+    if (!exporter.start()) {
+        std::fprintf(stderr, "failed to start exporter on port %u\n", config.http_port);
+        return 1;
+    }
+    std::printf("exporting %s (publisher pid %d) on http://%s:%u/metrics\n", argv[1], reader.publisher_pid(),
+                config.http_address, exporter.bound_port());
+    while (!g_stop.load()) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    exporter.stop();
+    return 0;
+}